@@ -9,7 +9,13 @@ struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct timer;
+struct traceent;
+struct itimerval;
+struct timespec;
+struct vdso;
 struct sigaction;
+struct siginfo;
 struct trapframe;
 
 // bio.c
@@ -42,6 +48,8 @@ int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+struct inode*   iexec(struct inode*);
+void            iputexec(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -68,6 +76,8 @@ void            ioapicinit(void);
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+void            kref(char*);
+int             krefcount(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -82,6 +92,12 @@ void            lapiceoi(void);
 void            lapicinit(void);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
+int             lapictick(void);
+void            lapicarm(uint64);
+void            tsc2ts(uint64, struct timespec*);
+uint64          ts2tsc(struct timespec*);
+extern uint     tsckhz;
+extern uint64   tsc0;
 
 // log.c
 void            initlog(int dev);
@@ -89,6 +105,17 @@ void            log_write(struct buf*);
 void            begin_op();
 void            end_op();
 
+// mmap.c
+struct vma*     vmafind(struct proc*, uint);
+uint            vmabase(struct proc*);
+int             mmap(uint, int, int, struct file*, uint);
+int             munmap(uint, uint);
+int             vmacopy(struct proc*, struct proc*);
+void            vmaclear(struct proc*, pde_t*);
+void            mmapinit(void);
+char*           shget(struct inode*, uint);
+void            shupdate(struct inode*, uint, char*, uint);
+
 // mp.c
 extern int      ismp;
 void            mpinit(void);
@@ -97,6 +124,13 @@ void            mpinit(void);
 void            picenable(int);
 void            picinit(void);
 
+// pcache.c
+void            pcacheinit(void);
+char*           pcacheget(struct inode*, uint, uint, uint*);
+int             pcacheput(struct inode*, uint, uint, char*, uint);
+void            pcacheinval(struct inode*);
+int             pcachereclaim(void);
+
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
@@ -106,10 +140,16 @@ int             pipewrite(struct pipe*, char*, int);
 //PAGEBREAK: 16
 // proc.c
 int             cpuid(void);
-void            exit(void);
+void            exit(int);
 int             fork(void);
 int             growproc(int);
 int             kill(int, int);
+int             sigqueue(int, int, int);
+int             sigread(uint, struct siginfo*, int);
+int             sigwait(uint);
+int             sigsuspend(uint);
+int             setitimer(int, struct itimerval*, struct itimerval*);
+void            itimertick(void);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
@@ -118,17 +158,22 @@ void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
+int             sleepticks(int);
+int             nanosleep(struct timespec*);
 void            userinit(void);
 int             wait(void);
+int             waitpid(int, int*, int);
 void            wakeup(void*);
 void            yield(void);
 uint            sigprocmask(uint); // Task-2.1.3
 int             sigaction(int signum, const struct sigaction* act, struct sigaction* oldact); // Task-2.1.4
-void sigret(void); // Task-2.1.5
+int             sigret(void); // Task-2.1.5
 void SIGKILL_handler(void); // Task-2.3
 void SIGSTOP_handler(void); // Task-2.3
 void SIGCONT_handler(void); // Task-2.3
+int             sig_continues(struct proc*, int);
 void sig_handler_runner(struct trapframe*); // Task-2.4
+uint            sig_pending(struct trapframe*);
 void start_implicit_sigret(void); // Task-2.1.5 + Task-2.4
 void done_implicit_sigret(void); // Task-2.1.5 + Task-2.4
 
@@ -162,16 +207,29 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argrdptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
+int             validrange(uint, uint, int);
 void            syscall(void);
 
 // timer.c
 void            timerinit(void);
+uint            timercancel(struct timer*);
+void            timerset(struct timer*, uint);
+void            timertick(void);
+void            hrtimerset(struct timer*, uint64);
+void            hrtick(void);
+
+// trace.c
+void            traceinit(void);
+void            trace(int, int, uint);
+int             traceread(struct traceent*, int);
 
 // trap.c
 void            idtinit(void);
+void            sysenterinit(void);
 extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
@@ -186,16 +244,24 @@ void            seginit(void);
 void            kvmalloc(void);
 pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
+char*           uvmpage(pde_t*, uint, int);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
+int             sharerange(pde_t*, pde_t*, uint, uint, int);
 pde_t*          copyuvm(pde_t*, uint);
+int             cowpage(pde_t*, uint);
+int             pagefault(struct proc*, uint, int);
+int             pagein(struct proc*, uint, uint, int);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+void            trampinit(void);
+void            vdsoinit(void);
+int             mapvproc(pde_t*, char*);
+extern struct vdso *vdso;
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -14,8 +14,10 @@ exec(char *path, char **argv)
   int i, off;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
-  struct inode *ip;
+  struct inode *ip, *exe, *oldexe;
   struct proghdr ph;
+  struct seg seg[NSEG];
+  int nseg;
   pde_t *pgdir, *oldpgdir;
   struct proc *curproc = myproc();
 
@@ -28,6 +30,7 @@ exec(char *path, char **argv)
   }
   ilock(ip);
   pgdir = 0;
+  exe = 0;
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -35,11 +38,13 @@ exec(char *path, char **argv)
   if(elf.magic != ELF_MAGIC)
     goto bad;
 
-  if((pgdir = setupkvm()) == 0)
+  if((pgdir = setupkvm()) == 0 || mapvproc(pgdir, curproc->vproc) < 0)
     goto bad;
 
-  // Load program into memory.
+  // Record the program's segments; pagefault() reads each page
+  // in from ip when it is first touched.
   sz = 0;
+  nseg = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -49,13 +54,22 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr + ph.memsz > USERTOP)
       goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(ph.vaddr < sz || nseg == NSEG)
       goto bad;
+    seg[nseg].va = ph.vaddr;
+    seg[nseg].filesz = ph.filesz;
+    seg[nseg].memsz = ph.memsz;
+    seg[nseg].off = ph.off;
+    nseg++;
+    sz = ph.vaddr + ph.memsz;
   }
+  // From here on writes to ip fail, so the pages read in later
+  // match the ones already read.
+  exe = iexec(ip);
   iunlockput(ip);
   end_op();
   ip = 0;
@@ -95,8 +109,12 @@ exec(char *path, char **argv)
 
   // Commit to the user image.
   oldpgdir = curproc->pgdir;
+  oldexe = curproc->exe;
   curproc->pgdir = pgdir;
   curproc->sz = sz;
+  curproc->exe = exe;
+  memmove(curproc->seg, seg, sizeof(seg));
+  curproc->nseg = nseg;
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
 
@@ -110,7 +128,13 @@ exec(char *path, char **argv)
   /**********************************************/
 
   switchuvm(curproc);
+  vmaclear(curproc, oldpgdir);
   freevm(oldpgdir);
+  if(oldexe){
+    begin_op();
+    iputexec(oldexe);
+    end_op();
+  }
   return 0;
 
  bad:
@@ -120,5 +144,10 @@ exec(char *path, char **argv)
     iunlockput(ip);
     end_op();
   }
+  if(exe){
+    begin_op();
+    iputexec(exe);
+    end_op();
+  }
   return -1;
 }
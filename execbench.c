@@ -0,0 +1,104 @@
+// Exec-to-main latency benchmark.
+// Forks children that exec a small and a large program and reports
+// the mean time from just before exec() to the start of main() in
+// each. The programs are this one (execbench) and the same source
+// built with PAD bytes of initialized data (execbig). In -t mode the
+// program exits with the microseconds since the time in its
+// arguments.
+//   usage: execbench [iterations]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#ifdef PAD
+char pad[PAD] = { 1 };  // file-backed, never touched
+#endif
+
+// Microseconds from a to b.
+static int
+usecs(struct timespec *a, struct timespec *b)
+{
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+}
+
+static void
+utoa(uint x, char *buf)
+{
+  char tmp[16];
+  int i;
+
+  i = 0;
+  do {
+    tmp[i++] = '0' + x % 10;
+    x /= 10;
+  } while(x);
+  while(i > 0)
+    *buf++ = tmp[--i];
+  *buf = 0;
+}
+
+// Mean exec-to-main microseconds for prog over n runs.
+static int
+run(char *prog, int n)
+{
+  struct timespec t0;
+  char sec[16], nsec[16];
+  char *argv[5];
+  int i, pid, status, total;
+
+  total = 0;
+  for(i = 0; i < n; i++){
+    if((pid = fork()) < 0){
+      printf(2, "execbench: fork failed\n");
+      exit(1);
+    }
+    if(pid == 0){
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      utoa(t0.tv_sec, sec);
+      utoa(t0.tv_nsec, nsec);
+      argv[0] = prog;
+      argv[1] = "-t";
+      argv[2] = sec;
+      argv[3] = nsec;
+      argv[4] = 0;
+      exec(prog, argv);
+      printf(2, "execbench: exec %s failed\n", prog);
+      exit(-1);
+    }
+    if(waitpid(pid, &status, 0) != pid || status < 0){
+      printf(2, "execbench: %s failed\n", prog);
+      exit(1);
+    }
+    total += status;
+  }
+  return total / n;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct timespec t0, t1;
+  struct stat st;
+  int n;
+
+  if(argc == 4 && strcmp(argv[1], "-t") == 0){
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    t0.tv_sec = atoi(argv[2]);
+    t0.tv_nsec = atoi(argv[3]);
+    exit(usecs(&t0, &t1));
+  }
+
+  n = argc > 1 ? atoi(argv[1]) : 50;
+  if(n <= 0){
+    printf(2, "usage: execbench [iterations]\n");
+    exit(1);
+  }
+
+  if(stat("execbench", &st) == 0)
+    printf(1, "execbench small %d bytes %d us\n", st.size, run("execbench", n));
+  if(stat("execbig", &st) == 0)
+    printf(1, "execbench large %d bytes %d us\n", st.size, run("execbig", n));
+  exit(0);
+}
@@ -0,0 +1,1814 @@
+
+_execbig:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return total / n;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 2c             	sub    $0x2c,%esp
+  13:	8b 01                	mov    (%ecx),%eax
+  15:	8b 59 04             	mov    0x4(%ecx),%ebx
+  struct timespec t0, t1;
+  struct stat st;
+  int n;
+
+  if(argc == 4 && strcmp(argv[1], "-t") == 0){
+  18:	83 f8 04             	cmp    $0x4,%eax
+  1b:	0f 84 9d 00 00 00    	je     be <main+0xbe>
+    t0.tv_sec = atoi(argv[2]);
+    t0.tv_nsec = atoi(argv[3]);
+    exit(usecs(&t0, &t1));
+  }
+
+  n = argc > 1 ? atoi(argv[1]) : 50;
+  21:	83 f8 01             	cmp    $0x1,%eax
+  24:	7e 4f                	jle    75 <main+0x75>
+  26:	83 ec 0c             	sub    $0xc,%esp
+  29:	ff 73 04             	push   0x4(%ebx)
+  2c:	e8 4f 04 00 00       	call   480 <atoi>
+  if(n <= 0){
+  31:	83 c4 10             	add    $0x10,%esp
+  n = argc > 1 ? atoi(argv[1]) : 50;
+  34:	89 c3                	mov    %eax,%ebx
+  if(n <= 0){
+  36:	85 c0                	test   %eax,%eax
+  38:	0f 8e df 00 00 00    	jle    11d <main+0x11d>
+    printf(2, "usage: execbench [iterations]\n");
+    exit(1);
+  }
+
+  if(stat("execbench", &st) == 0)
+  3e:	83 ec 08             	sub    $0x8,%esp
+  41:	8d 75 d4             	lea    -0x2c(%ebp),%esi
+  44:	56                   	push   %esi
+  45:	68 44 0d 00 00       	push   $0xd44
+  4a:	e8 e1 03 00 00       	call   430 <stat>
+  4f:	83 c4 10             	add    $0x10,%esp
+  52:	85 c0                	test   %eax,%eax
+  54:	74 26                	je     7c <main+0x7c>
+    printf(1, "execbench small %d bytes %d us\n", st.size, run("execbench", n));
+  if(stat("execbig", &st) == 0)
+  56:	83 ec 08             	sub    $0x8,%esp
+  59:	56                   	push   %esi
+  5a:	68 4e 0d 00 00       	push   $0xd4e
+  5f:	e8 cc 03 00 00       	call   430 <stat>
+  64:	83 c4 10             	add    $0x10,%esp
+  67:	85 c0                	test   %eax,%eax
+  69:	74 32                	je     9d <main+0x9d>
+    printf(1, "execbench large %d bytes %d us\n", st.size, run("execbig", n));
+  exit(0);
+  6b:	83 ec 0c             	sub    $0xc,%esp
+  6e:	6a 00                	push   $0x0
+  70:	e8 6c 05 00 00       	call   5e1 <exit>
+  n = argc > 1 ? atoi(argv[1]) : 50;
+  75:	bb 32 00 00 00       	mov    $0x32,%ebx
+  7a:	eb c2                	jmp    3e <main+0x3e>
+    printf(1, "execbench small %d bytes %d us\n", st.size, run("execbench", n));
+  7c:	89 da                	mov    %ebx,%edx
+  7e:	b8 44 0d 00 00       	mov    $0xd44,%eax
+  83:	e8 28 01 00 00       	call   1b0 <run>
+  88:	50                   	push   %eax
+  89:	ff 75 e4             	push   -0x1c(%ebp)
+  8c:	68 78 0d 00 00       	push   $0xd78
+  91:	6a 01                	push   $0x1
+  93:	e8 38 09 00 00       	call   9d0 <printf>
+  98:	83 c4 10             	add    $0x10,%esp
+  9b:	eb b9                	jmp    56 <main+0x56>
+    printf(1, "execbench large %d bytes %d us\n", st.size, run("execbig", n));
+  9d:	89 da                	mov    %ebx,%edx
+  9f:	b8 4e 0d 00 00       	mov    $0xd4e,%eax
+  a4:	e8 07 01 00 00       	call   1b0 <run>
+  a9:	50                   	push   %eax
+  aa:	ff 75 e4             	push   -0x1c(%ebp)
+  ad:	68 98 0d 00 00       	push   $0xd98
+  b2:	6a 01                	push   $0x1
+  b4:	e8 17 09 00 00       	call   9d0 <printf>
+  b9:	83 c4 10             	add    $0x10,%esp
+  bc:	eb ad                	jmp    6b <main+0x6b>
+  if(argc == 4 && strcmp(argv[1], "-t") == 0){
+  be:	50                   	push   %eax
+  bf:	50                   	push   %eax
+  c0:	68 10 0d 00 00       	push   $0xd10
+  c5:	ff 73 04             	push   0x4(%ebx)
+  c8:	e8 13 02 00 00       	call   2e0 <strcmp>
+  cd:	83 c4 10             	add    $0x10,%esp
+  d0:	85 c0                	test   %eax,%eax
+  d2:	0f 85 4e ff ff ff    	jne    26 <main+0x26>
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+  d8:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  db:	52                   	push   %edx
+  dc:	52                   	push   %edx
+  dd:	50                   	push   %eax
+  de:	6a 01                	push   $0x1
+  e0:	e8 6b 04 00 00       	call   550 <clock_gettime>
+    t0.tv_sec = atoi(argv[2]);
+  e5:	59                   	pop    %ecx
+  e6:	ff 73 08             	push   0x8(%ebx)
+  e9:	e8 92 03 00 00       	call   480 <atoi>
+  ee:	89 c6                	mov    %eax,%esi
+    t0.tv_nsec = atoi(argv[3]);
+  f0:	58                   	pop    %eax
+  f1:	ff 73 0c             	push   0xc(%ebx)
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+  f4:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+    t0.tv_nsec = atoi(argv[3]);
+  f9:	e8 82 03 00 00       	call   480 <atoi>
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+  fe:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    t0.tv_nsec = atoi(argv[3]);
+ 101:	89 c2                	mov    %eax,%edx
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 103:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 106:	29 f1                	sub    %esi,%ecx
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 108:	29 d0                	sub    %edx,%eax
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 10a:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 110:	99                   	cltd
+ 111:	f7 fb                	idiv   %ebx
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 113:	01 c1                	add    %eax,%ecx
+    exit(usecs(&t0, &t1));
+ 115:	89 0c 24             	mov    %ecx,(%esp)
+ 118:	e8 c4 04 00 00       	call   5e1 <exit>
+    printf(2, "usage: execbench [iterations]\n");
+ 11d:	50                   	push   %eax
+ 11e:	50                   	push   %eax
+ 11f:	68 58 0d 00 00       	push   $0xd58
+ 124:	6a 02                	push   $0x2
+ 126:	e8 a5 08 00 00       	call   9d0 <printf>
+    exit(1);
+ 12b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 132:	e8 aa 04 00 00       	call   5e1 <exit>
+ 137:	66 90                	xchg   %ax,%ax
+ 139:	66 90                	xchg   %ax,%ax
+ 13b:	66 90                	xchg   %ax,%ax
+ 13d:	66 90                	xchg   %ax,%ax
+ 13f:	90                   	nop
+
+00000140 <utoa>:
+{
+ 140:	55                   	push   %ebp
+ 141:	89 c1                	mov    %eax,%ecx
+ 143:	89 e5                	mov    %esp,%ebp
+ 145:	57                   	push   %edi
+ 146:	56                   	push   %esi
+  i = 0;
+ 147:	31 f6                	xor    %esi,%esi
+{
+ 149:	53                   	push   %ebx
+ 14a:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+ 14d:	83 ec 18             	sub    $0x18,%esp
+    tmp[i++] = '0' + x % 10;
+ 150:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+ 15d:	89 75 e0             	mov    %esi,-0x20(%ebp)
+ 160:	83 c6 01             	add    $0x1,%esi
+ 163:	f7 e1                	mul    %ecx
+ 165:	89 c8                	mov    %ecx,%eax
+ 167:	c1 ea 03             	shr    $0x3,%edx
+ 16a:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ 16d:	01 ff                	add    %edi,%edi
+ 16f:	29 f8                	sub    %edi,%eax
+ 171:	83 c0 30             	add    $0x30,%eax
+ 174:	88 44 35 e3          	mov    %al,-0x1d(%ebp,%esi,1)
+    x /= 10;
+ 178:	89 c8                	mov    %ecx,%eax
+ 17a:	89 d1                	mov    %edx,%ecx
+  } while(x);
+ 17c:	83 f8 09             	cmp    $0x9,%eax
+ 17f:	77 d7                	ja     158 <utoa+0x18>
+ 181:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  while(i > 0)
+ 184:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  } while(x);
+ 187:	89 f9                	mov    %edi,%ecx
+ 189:	01 da                	add    %ebx,%edx
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+    *buf++ = tmp[--i];
+ 190:	0f b6 02             	movzbl (%edx),%eax
+ 193:	83 c1 01             	add    $0x1,%ecx
+ 196:	88 41 ff             	mov    %al,-0x1(%ecx)
+  while(i > 0)
+ 199:	89 d0                	mov    %edx,%eax
+ 19b:	83 ea 01             	sub    $0x1,%edx
+ 19e:	39 d8                	cmp    %ebx,%eax
+ 1a0:	75 ee                	jne    190 <utoa+0x50>
+  *buf = 0;
+ 1a2:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+}
+ 1a6:	83 c4 18             	add    $0x18,%esp
+ 1a9:	5b                   	pop    %ebx
+ 1aa:	5e                   	pop    %esi
+ 1ab:	5f                   	pop    %edi
+ 1ac:	5d                   	pop    %ebp
+ 1ad:	c3                   	ret
+ 1ae:	66 90                	xchg   %ax,%ax
+
+000001b0 <run>:
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	56                   	push   %esi
+  total = 0;
+ 1b5:	31 f6                	xor    %esi,%esi
+{
+ 1b7:	53                   	push   %ebx
+  for(i = 0; i < n; i++){
+ 1b8:	31 db                	xor    %ebx,%ebx
+{
+ 1ba:	83 ec 5c             	sub    $0x5c,%esp
+ 1bd:	89 45 a0             	mov    %eax,-0x60(%ebp)
+ 1c0:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+    if((pid = fork()) < 0){
+ 1c8:	e8 fa 03 00 00       	call   5c7 <fork>
+ 1cd:	89 c7                	mov    %eax,%edi
+ 1cf:	85 c0                	test   %eax,%eax
+ 1d1:	0f 88 bc 00 00 00    	js     293 <run+0xe3>
+    if(pid == 0){
+ 1d7:	74 51                	je     22a <run+0x7a>
+    if(waitpid(pid, &status, 0) != pid || status < 0){
+ 1d9:	83 ec 04             	sub    $0x4,%esp
+ 1dc:	8d 45 a8             	lea    -0x58(%ebp),%eax
+ 1df:	6a 00                	push   $0x0
+ 1e1:	50                   	push   %eax
+ 1e2:	57                   	push   %edi
+ 1e3:	e8 9d 06 00 00       	call   885 <waitpid>
+ 1e8:	83 c4 10             	add    $0x10,%esp
+ 1eb:	39 f8                	cmp    %edi,%eax
+ 1ed:	75 1f                	jne    20e <run+0x5e>
+ 1ef:	8b 45 a8             	mov    -0x58(%ebp),%eax
+ 1f2:	85 c0                	test   %eax,%eax
+ 1f4:	78 18                	js     20e <run+0x5e>
+    total += status;
+ 1f6:	01 c6                	add    %eax,%esi
+  for(i = 0; i < n; i++){
+ 1f8:	83 c3 01             	add    $0x1,%ebx
+ 1fb:	39 5d a4             	cmp    %ebx,-0x5c(%ebp)
+ 1fe:	75 c8                	jne    1c8 <run+0x18>
+  return total / n;
+ 200:	89 f0                	mov    %esi,%eax
+ 202:	99                   	cltd
+ 203:	f7 7d a4             	idivl  -0x5c(%ebp)
+}
+ 206:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 209:	5b                   	pop    %ebx
+ 20a:	5e                   	pop    %esi
+ 20b:	5f                   	pop    %edi
+ 20c:	5d                   	pop    %ebp
+ 20d:	c3                   	ret
+      printf(2, "execbench: %s failed\n", prog);
+ 20e:	50                   	push   %eax
+ 20f:	ff 75 a0             	push   -0x60(%ebp)
+ 212:	68 2e 0d 00 00       	push   $0xd2e
+ 217:	6a 02                	push   $0x2
+ 219:	e8 b2 07 00 00       	call   9d0 <printf>
+      exit(1);
+ 21e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 225:	e8 b7 03 00 00       	call   5e1 <exit>
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+ 22a:	8d 45 ac             	lea    -0x54(%ebp),%eax
+ 22d:	52                   	push   %edx
+      utoa(t0.tv_sec, sec);
+ 22e:	8d 75 b4             	lea    -0x4c(%ebp),%esi
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+ 231:	52                   	push   %edx
+      utoa(t0.tv_nsec, nsec);
+ 232:	8d 5d c4             	lea    -0x3c(%ebp),%ebx
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+ 235:	50                   	push   %eax
+ 236:	6a 01                	push   $0x1
+ 238:	e8 13 03 00 00       	call   550 <clock_gettime>
+      utoa(t0.tv_sec, sec);
+ 23d:	8b 45 ac             	mov    -0x54(%ebp),%eax
+ 240:	89 f2                	mov    %esi,%edx
+ 242:	e8 f9 fe ff ff       	call   140 <utoa>
+      utoa(t0.tv_nsec, nsec);
+ 247:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 24a:	89 da                	mov    %ebx,%edx
+ 24c:	e8 ef fe ff ff       	call   140 <utoa>
+      argv[0] = prog;
+ 251:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+      argv[3] = nsec;
+ 254:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      exec(prog, argv);
+ 257:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+      argv[4] = 0;
+ 25a:	31 db                	xor    %ebx,%ebx
+      argv[1] = "-t";
+ 25c:	c7 45 d8 10 0d 00 00 	movl   $0xd10,-0x28(%ebp)
+      argv[0] = prog;
+ 263:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+      argv[2] = sec;
+ 266:	89 75 dc             	mov    %esi,-0x24(%ebp)
+      argv[4] = 0;
+ 269:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+      exec(prog, argv);
+ 26c:	5e                   	pop    %esi
+ 26d:	89 ce                	mov    %ecx,%esi
+ 26f:	5f                   	pop    %edi
+ 270:	50                   	push   %eax
+ 271:	51                   	push   %ecx
+ 272:	e8 20 04 00 00       	call   697 <exec>
+      printf(2, "execbench: exec %s failed\n", prog);
+ 277:	83 c4 0c             	add    $0xc,%esp
+ 27a:	56                   	push   %esi
+ 27b:	68 13 0d 00 00       	push   $0xd13
+ 280:	6a 02                	push   $0x2
+ 282:	e8 49 07 00 00       	call   9d0 <printf>
+      exit(-1);
+ 287:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+ 28e:	e8 4e 03 00 00       	call   5e1 <exit>
+      printf(2, "execbench: fork failed\n");
+ 293:	50                   	push   %eax
+ 294:	50                   	push   %eax
+ 295:	68 f8 0c 00 00       	push   $0xcf8
+ 29a:	6a 02                	push   $0x2
+ 29c:	e8 2f 07 00 00       	call   9d0 <printf>
+      exit(1);
+ 2a1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 2a8:	e8 34 03 00 00       	call   5e1 <exit>
+ 2ad:	66 90                	xchg   %ax,%ax
+ 2af:	90                   	nop
+
+000002b0 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2b1:	31 c0                	xor    %eax,%eax
+{
+ 2b3:	89 e5                	mov    %esp,%ebp
+ 2b5:	53                   	push   %ebx
+ 2b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2c7:	83 c0 01             	add    $0x1,%eax
+ 2ca:	84 d2                	test   %dl,%dl
+ 2cc:	75 f2                	jne    2c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d1:	89 c8                	mov    %ecx,%eax
+ 2d3:	c9                   	leave
+ 2d4:	c3                   	ret
+ 2d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ea:	0f b6 02             	movzbl (%edx),%eax
+ 2ed:	84 c0                	test   %al,%al
+ 2ef:	75 17                	jne    308 <strcmp+0x28>
+ 2f1:	eb 3a                	jmp    32d <strcmp+0x4d>
+ 2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2f7:	90                   	nop
+ 2f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2fc:	83 c2 01             	add    $0x1,%edx
+ 2ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 302:	84 c0                	test   %al,%al
+ 304:	74 1a                	je     320 <strcmp+0x40>
+    p++, q++;
+ 306:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 308:	0f b6 19             	movzbl (%ecx),%ebx
+ 30b:	38 c3                	cmp    %al,%bl
+ 30d:	74 e9                	je     2f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 30f:	29 d8                	sub    %ebx,%eax
+}
+ 311:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 314:	c9                   	leave
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 320:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 324:	31 c0                	xor    %eax,%eax
+ 326:	29 d8                	sub    %ebx,%eax
+}
+ 328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 32b:	c9                   	leave
+ 32c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 32d:	0f b6 19             	movzbl (%ecx),%ebx
+ 330:	31 c0                	xor    %eax,%eax
+ 332:	eb db                	jmp    30f <strcmp+0x2f>
+ 334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 346:	80 3a 00             	cmpb   $0x0,(%edx)
+ 349:	74 15                	je     360 <strlen+0x20>
+ 34b:	31 c0                	xor    %eax,%eax
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+ 350:	83 c0 01             	add    $0x1,%eax
+ 353:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 357:	89 c1                	mov    %eax,%ecx
+ 359:	75 f5                	jne    350 <strlen+0x10>
+    ;
+  return n;
+}
+ 35b:	89 c8                	mov    %ecx,%eax
+ 35d:	5d                   	pop    %ebp
+ 35e:	c3                   	ret
+ 35f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 360:	31 c9                	xor    %ecx,%ecx
+}
+ 362:	5d                   	pop    %ebp
+ 363:	89 c8                	mov    %ecx,%eax
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 377:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 37a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 37d:	89 d7                	mov    %edx,%edi
+ 37f:	fc                   	cld
+ 380:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 382:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 385:	89 d0                	mov    %edx,%eax
+ 387:	c9                   	leave
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 39a:	0f b6 10             	movzbl (%eax),%edx
+ 39d:	84 d2                	test   %dl,%dl
+ 39f:	75 12                	jne    3b3 <strchr+0x23>
+ 3a1:	eb 1d                	jmp    3c0 <strchr+0x30>
+ 3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3a7:	90                   	nop
+ 3a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3ac:	83 c0 01             	add    $0x1,%eax
+ 3af:	84 d2                	test   %dl,%dl
+ 3b1:	74 0d                	je     3c0 <strchr+0x30>
+    if(*s == c)
+ 3b3:	38 d1                	cmp    %dl,%cl
+ 3b5:	75 f1                	jne    3a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3b7:	5d                   	pop    %ebp
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3c0:	31 c0                	xor    %eax,%eax
+}
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	c3                   	ret
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3d9:	31 db                	xor    %ebx,%ebx
+{
+ 3db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3de:	eb 27                	jmp    407 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3e0:	83 ec 04             	sub    $0x4,%esp
+ 3e3:	6a 01                	push   $0x1
+ 3e5:	56                   	push   %esi
+ 3e6:	6a 00                	push   $0x0
+ 3e8:	e8 42 02 00 00       	call   62f <read>
+    if(cc < 1)
+ 3ed:	83 c4 10             	add    $0x10,%esp
+ 3f0:	85 c0                	test   %eax,%eax
+ 3f2:	7e 1d                	jle    411 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3ff:	3c 0a                	cmp    $0xa,%al
+ 401:	74 10                	je     413 <gets+0x43>
+ 403:	3c 0d                	cmp    $0xd,%al
+ 405:	74 0c                	je     413 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 407:	89 df                	mov    %ebx,%edi
+ 409:	83 c3 01             	add    $0x1,%ebx
+ 40c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 40f:	7c cf                	jl     3e0 <gets+0x10>
+ 411:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 413:	8b 45 08             	mov    0x8(%ebp),%eax
+ 416:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 41a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 41d:	5b                   	pop    %ebx
+ 41e:	5e                   	pop    %esi
+ 41f:	5f                   	pop    %edi
+ 420:	5d                   	pop    %ebp
+ 421:	c3                   	ret
+ 422:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	56                   	push   %esi
+ 434:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 435:	83 ec 08             	sub    $0x8,%esp
+ 438:	6a 00                	push   $0x0
+ 43a:	ff 75 08             	push   0x8(%ebp)
+ 43d:	e8 6f 02 00 00       	call   6b1 <open>
+  if(fd < 0)
+ 442:	83 c4 10             	add    $0x10,%esp
+ 445:	85 c0                	test   %eax,%eax
+ 447:	78 27                	js     470 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 449:	83 ec 08             	sub    $0x8,%esp
+ 44c:	ff 75 0c             	push   0xc(%ebp)
+ 44f:	89 c3                	mov    %eax,%ebx
+ 451:	50                   	push   %eax
+ 452:	e8 a8 02 00 00       	call   6ff <fstat>
+  close(fd);
+ 457:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 45a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 45c:	e8 02 02 00 00       	call   663 <close>
+  return r;
+ 461:	83 c4 10             	add    $0x10,%esp
+}
+ 464:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 467:	89 f0                	mov    %esi,%eax
+ 469:	5b                   	pop    %ebx
+ 46a:	5e                   	pop    %esi
+ 46b:	5d                   	pop    %ebp
+ 46c:	c3                   	ret
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 470:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 475:	eb ed                	jmp    464 <stat+0x34>
+ 477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47e:	66 90                	xchg   %ax,%ax
+
+00000480 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	53                   	push   %ebx
+ 484:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 487:	0f be 02             	movsbl (%edx),%eax
+ 48a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 48d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 490:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 495:	77 1e                	ja     4b5 <atoi+0x35>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4a0:	83 c2 01             	add    $0x1,%edx
+ 4a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4aa:	0f be 02             	movsbl (%edx),%eax
+ 4ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4b0:	80 fb 09             	cmp    $0x9,%bl
+ 4b3:	76 eb                	jbe    4a0 <atoi+0x20>
+  return n;
+}
+ 4b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4b8:	89 c8                	mov    %ecx,%eax
+ 4ba:	c9                   	leave
+ 4bb:	c3                   	ret
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ce:	85 c0                	test   %eax,%eax
+ 4d0:	7e 13                	jle    4e5 <memmove+0x25>
+ 4d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4d4:	89 d7                	mov    %edx,%edi
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4e1:	39 f8                	cmp    %edi,%eax
+ 4e3:	75 fb                	jne    4e0 <memmove+0x20>
+  return vdst;
+}
+ 4e5:	5e                   	pop    %esi
+ 4e6:	89 d0                	mov    %edx,%eax
+ 4e8:	5f                   	pop    %edi
+ 4e9:	5d                   	pop    %ebp
+ 4ea:	c3                   	ret
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+
+000004f0 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 4f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 4f9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 500:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 503:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 506:	50                   	push   %eax
+ 507:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 50a:	50                   	push   %eax
+ 50b:	6a 00                	push   $0x0
+ 50d:	e8 8d 03 00 00       	call   89f <setitimer>
+ 512:	83 c4 10             	add    $0x10,%esp
+ 515:	89 c2                	mov    %eax,%edx
+ 517:	31 c0                	xor    %eax,%eax
+ 519:	85 d2                	test   %edx,%edx
+ 51b:	78 03                	js     520 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 51d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 520:	c9                   	leave
+ 521:	c3                   	ret
+ 522:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 530:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 535:	c3                   	ret
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000540 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 540:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 545:	c3                   	ret
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000550 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 559:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 55d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 560:	75 5e                	jne    5c0 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 562:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 568:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 56a:	89 d3                	mov    %edx,%ebx
+ 56c:	89 c1                	mov    %eax,%ecx
+ 56e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 574:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 57a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 57d:	31 d2                	xor    %edx,%edx
+ 57f:	89 d8                	mov    %ebx,%eax
+ 581:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 584:	f7 f6                	div    %esi
+ 586:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 588:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 58b:	f7 f6                	div    %esi
+ 58d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 58f:	89 da                	mov    %ebx,%edx
+ 591:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 596:	f7 f3                	div    %ebx
+ 598:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 59a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 59f:	89 d3                	mov    %edx,%ebx
+ 5a1:	f7 e1                	mul    %ecx
+ 5a3:	f7 f6                	div    %esi
+ 5a5:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 5ab:	01 c3                	add    %eax,%ebx
+  return 0;
+ 5ad:	31 c0                	xor    %eax,%eax
+ 5af:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 5b2:	83 c4 0c             	add    $0xc,%esp
+ 5b5:	5b                   	pop    %ebx
+ 5b6:	5e                   	pop    %esi
+ 5b7:	5f                   	pop    %edi
+ 5b8:	5d                   	pop    %ebp
+ 5b9:	c3                   	ret
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 5c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 5c5:	eb eb                	jmp    5b2 <clock_gettime+0x62>
+
+000005c7 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5c7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5cc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5d3:	74 09                	je     5de <fork+0x17>
+ 5d5:	89 e1                	mov    %esp,%ecx
+ 5d7:	ba e0 05 00 00       	mov    $0x5e0,%edx
+ 5dc:	0f 34                	sysenter
+ 5de:	cd 40                	int    $0x40
+ 5e0:	c3                   	ret
+
+000005e1 <exit>:
+SYSCALL(exit)
+ 5e1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5ed:	74 09                	je     5f8 <exit+0x17>
+ 5ef:	89 e1                	mov    %esp,%ecx
+ 5f1:	ba fa 05 00 00       	mov    $0x5fa,%edx
+ 5f6:	0f 34                	sysenter
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <wait>:
+SYSCALL(wait)
+ 5fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 600:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 607:	74 09                	je     612 <wait+0x17>
+ 609:	89 e1                	mov    %esp,%ecx
+ 60b:	ba 14 06 00 00       	mov    $0x614,%edx
+ 610:	0f 34                	sysenter
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <pipe>:
+SYSCALL(pipe)
+ 615:	b8 04 00 00 00       	mov    $0x4,%eax
+ 61a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 621:	74 09                	je     62c <pipe+0x17>
+ 623:	89 e1                	mov    %esp,%ecx
+ 625:	ba 2e 06 00 00       	mov    $0x62e,%edx
+ 62a:	0f 34                	sysenter
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <read>:
+SYSCALL(read)
+ 62f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 634:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 63b:	74 09                	je     646 <read+0x17>
+ 63d:	89 e1                	mov    %esp,%ecx
+ 63f:	ba 48 06 00 00       	mov    $0x648,%edx
+ 644:	0f 34                	sysenter
+ 646:	cd 40                	int    $0x40
+ 648:	c3                   	ret
+
+00000649 <write>:
+SYSCALL(write)
+ 649:	b8 10 00 00 00       	mov    $0x10,%eax
+ 64e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 655:	74 09                	je     660 <write+0x17>
+ 657:	89 e1                	mov    %esp,%ecx
+ 659:	ba 62 06 00 00       	mov    $0x662,%edx
+ 65e:	0f 34                	sysenter
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <close>:
+SYSCALL(close)
+ 663:	b8 15 00 00 00       	mov    $0x15,%eax
+ 668:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 66f:	74 09                	je     67a <close+0x17>
+ 671:	89 e1                	mov    %esp,%ecx
+ 673:	ba 7c 06 00 00       	mov    $0x67c,%edx
+ 678:	0f 34                	sysenter
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <kill>:
+SYSCALL(kill)
+ 67d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 682:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 689:	74 09                	je     694 <kill+0x17>
+ 68b:	89 e1                	mov    %esp,%ecx
+ 68d:	ba 96 06 00 00       	mov    $0x696,%edx
+ 692:	0f 34                	sysenter
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <exec>:
+SYSCALL(exec)
+ 697:	b8 07 00 00 00       	mov    $0x7,%eax
+ 69c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6a3:	74 09                	je     6ae <exec+0x17>
+ 6a5:	89 e1                	mov    %esp,%ecx
+ 6a7:	ba b0 06 00 00       	mov    $0x6b0,%edx
+ 6ac:	0f 34                	sysenter
+ 6ae:	cd 40                	int    $0x40
+ 6b0:	c3                   	ret
+
+000006b1 <open>:
+SYSCALL(open)
+ 6b1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6b6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6bd:	74 09                	je     6c8 <open+0x17>
+ 6bf:	89 e1                	mov    %esp,%ecx
+ 6c1:	ba ca 06 00 00       	mov    $0x6ca,%edx
+ 6c6:	0f 34                	sysenter
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <mknod>:
+SYSCALL(mknod)
+ 6cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6d0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6d7:	74 09                	je     6e2 <mknod+0x17>
+ 6d9:	89 e1                	mov    %esp,%ecx
+ 6db:	ba e4 06 00 00       	mov    $0x6e4,%edx
+ 6e0:	0f 34                	sysenter
+ 6e2:	cd 40                	int    $0x40
+ 6e4:	c3                   	ret
+
+000006e5 <unlink>:
+SYSCALL(unlink)
+ 6e5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6ea:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6f1:	74 09                	je     6fc <unlink+0x17>
+ 6f3:	89 e1                	mov    %esp,%ecx
+ 6f5:	ba fe 06 00 00       	mov    $0x6fe,%edx
+ 6fa:	0f 34                	sysenter
+ 6fc:	cd 40                	int    $0x40
+ 6fe:	c3                   	ret
+
+000006ff <fstat>:
+SYSCALL(fstat)
+ 6ff:	b8 08 00 00 00       	mov    $0x8,%eax
+ 704:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 70b:	74 09                	je     716 <fstat+0x17>
+ 70d:	89 e1                	mov    %esp,%ecx
+ 70f:	ba 18 07 00 00       	mov    $0x718,%edx
+ 714:	0f 34                	sysenter
+ 716:	cd 40                	int    $0x40
+ 718:	c3                   	ret
+
+00000719 <link>:
+SYSCALL(link)
+ 719:	b8 13 00 00 00       	mov    $0x13,%eax
+ 71e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 725:	74 09                	je     730 <link+0x17>
+ 727:	89 e1                	mov    %esp,%ecx
+ 729:	ba 32 07 00 00       	mov    $0x732,%edx
+ 72e:	0f 34                	sysenter
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <mkdir>:
+SYSCALL(mkdir)
+ 733:	b8 14 00 00 00       	mov    $0x14,%eax
+ 738:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 73f:	74 09                	je     74a <mkdir+0x17>
+ 741:	89 e1                	mov    %esp,%ecx
+ 743:	ba 4c 07 00 00       	mov    $0x74c,%edx
+ 748:	0f 34                	sysenter
+ 74a:	cd 40                	int    $0x40
+ 74c:	c3                   	ret
+
+0000074d <chdir>:
+SYSCALL(chdir)
+ 74d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 752:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 759:	74 09                	je     764 <chdir+0x17>
+ 75b:	89 e1                	mov    %esp,%ecx
+ 75d:	ba 66 07 00 00       	mov    $0x766,%edx
+ 762:	0f 34                	sysenter
+ 764:	cd 40                	int    $0x40
+ 766:	c3                   	ret
+
+00000767 <dup>:
+SYSCALL(dup)
+ 767:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 76c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 773:	74 09                	je     77e <dup+0x17>
+ 775:	89 e1                	mov    %esp,%ecx
+ 777:	ba 80 07 00 00       	mov    $0x780,%edx
+ 77c:	0f 34                	sysenter
+ 77e:	cd 40                	int    $0x40
+ 780:	c3                   	ret
+
+00000781 <sbrk>:
+SYSCALL(sbrk)
+ 781:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 786:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 78d:	74 09                	je     798 <sbrk+0x17>
+ 78f:	89 e1                	mov    %esp,%ecx
+ 791:	ba 9a 07 00 00       	mov    $0x79a,%edx
+ 796:	0f 34                	sysenter
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <sleep>:
+SYSCALL(sleep)
+ 79b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7a0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7a7:	74 09                	je     7b2 <sleep+0x17>
+ 7a9:	89 e1                	mov    %esp,%ecx
+ 7ab:	ba b4 07 00 00       	mov    $0x7b4,%edx
+ 7b0:	0f 34                	sysenter
+ 7b2:	cd 40                	int    $0x40
+ 7b4:	c3                   	ret
+
+000007b5 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 7b5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7ba:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7c1:	74 09                	je     7cc <sigprocmask+0x17>
+ 7c3:	89 e1                	mov    %esp,%ecx
+ 7c5:	ba ce 07 00 00       	mov    $0x7ce,%edx
+ 7ca:	0f 34                	sysenter
+ 7cc:	cd 40                	int    $0x40
+ 7ce:	c3                   	ret
+
+000007cf <sigaction>:
+SYSCALL(sigaction)
+ 7cf:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7d4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7db:	74 09                	je     7e6 <sigaction+0x17>
+ 7dd:	89 e1                	mov    %esp,%ecx
+ 7df:	ba e8 07 00 00       	mov    $0x7e8,%edx
+ 7e4:	0f 34                	sysenter
+ 7e6:	cd 40                	int    $0x40
+ 7e8:	c3                   	ret
+
+000007e9 <sigret>:
+SYSCALL(sigret)
+ 7e9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7ee:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7f5:	74 09                	je     800 <sigret+0x17>
+ 7f7:	89 e1                	mov    %esp,%ecx
+ 7f9:	ba 02 08 00 00       	mov    $0x802,%edx
+ 7fe:	0f 34                	sysenter
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <traceread>:
+SYSCALL(traceread)
+ 803:	b8 19 00 00 00       	mov    $0x19,%eax
+ 808:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 80f:	74 09                	je     81a <traceread+0x17>
+ 811:	89 e1                	mov    %esp,%ecx
+ 813:	ba 1c 08 00 00       	mov    $0x81c,%edx
+ 818:	0f 34                	sysenter
+ 81a:	cd 40                	int    $0x40
+ 81c:	c3                   	ret
+
+0000081d <sigqueue>:
+SYSCALL(sigqueue)
+ 81d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 822:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 829:	74 09                	je     834 <sigqueue+0x17>
+ 82b:	89 e1                	mov    %esp,%ecx
+ 82d:	ba 36 08 00 00       	mov    $0x836,%edx
+ 832:	0f 34                	sysenter
+ 834:	cd 40                	int    $0x40
+ 836:	c3                   	ret
+
+00000837 <signalfd>:
+SYSCALL(signalfd)
+ 837:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 83c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 843:	74 09                	je     84e <signalfd+0x17>
+ 845:	89 e1                	mov    %esp,%ecx
+ 847:	ba 50 08 00 00       	mov    $0x850,%edx
+ 84c:	0f 34                	sysenter
+ 84e:	cd 40                	int    $0x40
+ 850:	c3                   	ret
+
+00000851 <sigwait>:
+SYSCALL(sigwait)
+ 851:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 856:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 85d:	74 09                	je     868 <sigwait+0x17>
+ 85f:	89 e1                	mov    %esp,%ecx
+ 861:	ba 6a 08 00 00       	mov    $0x86a,%edx
+ 866:	0f 34                	sysenter
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <sigsuspend>:
+SYSCALL(sigsuspend)
+ 86b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 870:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 877:	74 09                	je     882 <sigsuspend+0x17>
+ 879:	89 e1                	mov    %esp,%ecx
+ 87b:	ba 84 08 00 00       	mov    $0x884,%edx
+ 880:	0f 34                	sysenter
+ 882:	cd 40                	int    $0x40
+ 884:	c3                   	ret
+
+00000885 <waitpid>:
+SYSCALL(waitpid)
+ 885:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 88a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 891:	74 09                	je     89c <waitpid+0x17>
+ 893:	89 e1                	mov    %esp,%ecx
+ 895:	ba 9e 08 00 00       	mov    $0x89e,%edx
+ 89a:	0f 34                	sysenter
+ 89c:	cd 40                	int    $0x40
+ 89e:	c3                   	ret
+
+0000089f <setitimer>:
+SYSCALL(setitimer)
+ 89f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8a4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8ab:	74 09                	je     8b6 <setitimer+0x17>
+ 8ad:	89 e1                	mov    %esp,%ecx
+ 8af:	ba b8 08 00 00       	mov    $0x8b8,%edx
+ 8b4:	0f 34                	sysenter
+ 8b6:	cd 40                	int    $0x40
+ 8b8:	c3                   	ret
+
+000008b9 <nanosleep>:
+SYSCALL(nanosleep)
+ 8b9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8be:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8c5:	74 09                	je     8d0 <nanosleep+0x17>
+ 8c7:	89 e1                	mov    %esp,%ecx
+ 8c9:	ba d2 08 00 00       	mov    $0x8d2,%edx
+ 8ce:	0f 34                	sysenter
+ 8d0:	cd 40                	int    $0x40
+ 8d2:	c3                   	ret
+
+000008d3 <mmap>:
+SYSCALL(mmap)
+ 8d3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8d8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8df:	74 09                	je     8ea <mmap+0x17>
+ 8e1:	89 e1                	mov    %esp,%ecx
+ 8e3:	ba ec 08 00 00       	mov    $0x8ec,%edx
+ 8e8:	0f 34                	sysenter
+ 8ea:	cd 40                	int    $0x40
+ 8ec:	c3                   	ret
+
+000008ed <munmap>:
+SYSCALL(munmap)
+ 8ed:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8f2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8f9:	74 09                	je     904 <munmap+0x17>
+ 8fb:	89 e1                	mov    %esp,%ecx
+ 8fd:	ba 06 09 00 00       	mov    $0x906,%edx
+ 902:	0f 34                	sysenter
+ 904:	cd 40                	int    $0x40
+ 906:	c3                   	ret
+
+00000907 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 907:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 90c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 913:	74 09                	je     91e <getpid_syscall+0x17>
+ 915:	89 e1                	mov    %esp,%ecx
+ 917:	ba 20 09 00 00       	mov    $0x920,%edx
+ 91c:	0f 34                	sysenter
+ 91e:	cd 40                	int    $0x40
+ 920:	c3                   	ret
+
+00000921 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 921:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 926:	cd 40                	int    $0x40
+ 928:	c3                   	ret
+ 929:	66 90                	xchg   %ax,%ax
+ 92b:	66 90                	xchg   %ax,%ax
+ 92d:	66 90                	xchg   %ax,%ax
+ 92f:	90                   	nop
+
+00000930 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	57                   	push   %edi
+ 934:	56                   	push   %esi
+ 935:	53                   	push   %ebx
+ 936:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 938:	89 d1                	mov    %edx,%ecx
+{
+ 93a:	83 ec 3c             	sub    $0x3c,%esp
+ 93d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 940:	85 d2                	test   %edx,%edx
+ 942:	0f 89 80 00 00 00    	jns    9c8 <printint+0x98>
+ 948:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 94c:	74 7a                	je     9c8 <printint+0x98>
+    x = -xx;
+ 94e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 950:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 955:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 958:	31 f6                	xor    %esi,%esi
+ 95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 960:	89 c8                	mov    %ecx,%eax
+ 962:	31 d2                	xor    %edx,%edx
+ 964:	89 f7                	mov    %esi,%edi
+ 966:	f7 f3                	div    %ebx
+ 968:	8d 76 01             	lea    0x1(%esi),%esi
+ 96b:	0f b6 92 18 0e 00 00 	movzbl 0xe18(%edx),%edx
+ 972:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 976:	89 ca                	mov    %ecx,%edx
+ 978:	89 c1                	mov    %eax,%ecx
+ 97a:	39 da                	cmp    %ebx,%edx
+ 97c:	73 e2                	jae    960 <printint+0x30>
+  if(neg)
+ 97e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 981:	85 c0                	test   %eax,%eax
+ 983:	74 07                	je     98c <printint+0x5c>
+    buf[i++] = '-';
+ 985:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 98a:	89 f7                	mov    %esi,%edi
+ 98c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 98f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 992:	01 df                	add    %ebx,%edi
+ 994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 998:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 99b:	83 ec 04             	sub    $0x4,%esp
+ 99e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9a4:	6a 01                	push   $0x1
+ 9a6:	50                   	push   %eax
+ 9a7:	56                   	push   %esi
+ 9a8:	e8 9c fc ff ff       	call   649 <write>
+  while(--i >= 0)
+ 9ad:	89 f8                	mov    %edi,%eax
+ 9af:	83 c4 10             	add    $0x10,%esp
+ 9b2:	83 ef 01             	sub    $0x1,%edi
+ 9b5:	39 d8                	cmp    %ebx,%eax
+ 9b7:	75 df                	jne    998 <printint+0x68>
+}
+ 9b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9bc:	5b                   	pop    %ebx
+ 9bd:	5e                   	pop    %esi
+ 9be:	5f                   	pop    %edi
+ 9bf:	5d                   	pop    %ebp
+ 9c0:	c3                   	ret
+ 9c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 9c8:	31 c0                	xor    %eax,%eax
+ 9ca:	eb 89                	jmp    955 <printint+0x25>
+ 9cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	57                   	push   %edi
+ 9d4:	56                   	push   %esi
+ 9d5:	53                   	push   %ebx
+ 9d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 9dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 9df:	0f b6 1e             	movzbl (%esi),%ebx
+ 9e2:	83 c6 01             	add    $0x1,%esi
+ 9e5:	84 db                	test   %bl,%bl
+ 9e7:	74 67                	je     a50 <printf+0x80>
+ 9e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 9ec:	31 d2                	xor    %edx,%edx
+ 9ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 9f1:	eb 34                	jmp    a27 <printf+0x57>
+ 9f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9f7:	90                   	nop
+ 9f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 9fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a00:	83 f8 25             	cmp    $0x25,%eax
+ a03:	74 18                	je     a1d <printf+0x4d>
+  write(fd, &c, 1);
+ a05:	83 ec 04             	sub    $0x4,%esp
+ a08:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a0b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a0e:	6a 01                	push   $0x1
+ a10:	50                   	push   %eax
+ a11:	57                   	push   %edi
+ a12:	e8 32 fc ff ff       	call   649 <write>
+ a17:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a1a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a1d:	0f b6 1e             	movzbl (%esi),%ebx
+ a20:	83 c6 01             	add    $0x1,%esi
+ a23:	84 db                	test   %bl,%bl
+ a25:	74 29                	je     a50 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a27:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a2a:	85 d2                	test   %edx,%edx
+ a2c:	74 ca                	je     9f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a2e:	83 fa 25             	cmp    $0x25,%edx
+ a31:	75 ea                	jne    a1d <printf+0x4d>
+      if(c == 'd'){
+ a33:	83 f8 25             	cmp    $0x25,%eax
+ a36:	0f 84 24 01 00 00    	je     b60 <printf+0x190>
+ a3c:	83 e8 63             	sub    $0x63,%eax
+ a3f:	83 f8 15             	cmp    $0x15,%eax
+ a42:	77 1c                	ja     a60 <printf+0x90>
+ a44:	ff 24 85 c0 0d 00 00 	jmp    *0xdc0(,%eax,4)
+ a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a4f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a53:	5b                   	pop    %ebx
+ a54:	5e                   	pop    %esi
+ a55:	5f                   	pop    %edi
+ a56:	5d                   	pop    %ebp
+ a57:	c3                   	ret
+ a58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+  write(fd, &c, 1);
+ a60:	83 ec 04             	sub    $0x4,%esp
+ a63:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a66:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a6a:	6a 01                	push   $0x1
+ a6c:	52                   	push   %edx
+ a6d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a70:	57                   	push   %edi
+ a71:	e8 d3 fb ff ff       	call   649 <write>
+ a76:	83 c4 0c             	add    $0xc,%esp
+ a79:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a7c:	6a 01                	push   $0x1
+ a7e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a81:	52                   	push   %edx
+ a82:	57                   	push   %edi
+ a83:	e8 c1 fb ff ff       	call   649 <write>
+        putc(fd, c);
+ a88:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a8b:	31 d2                	xor    %edx,%edx
+ a8d:	eb 8e                	jmp    a1d <printf+0x4d>
+ a8f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a93:	83 ec 0c             	sub    $0xc,%esp
+ a96:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a9b:	8b 13                	mov    (%ebx),%edx
+ a9d:	6a 00                	push   $0x0
+ a9f:	89 f8                	mov    %edi,%eax
+        ap++;
+ aa1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ aa4:	e8 87 fe ff ff       	call   930 <printint>
+        ap++;
+ aa9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ aac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aaf:	31 d2                	xor    %edx,%edx
+ ab1:	e9 67 ff ff ff       	jmp    a1d <printf+0x4d>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ ac0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ ac3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ ac5:	83 c0 04             	add    $0x4,%eax
+ ac8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ acb:	85 db                	test   %ebx,%ebx
+ acd:	0f 84 9d 00 00 00    	je     b70 <printf+0x1a0>
+        while(*s != 0){
+ ad3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ ad6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ ad8:	84 c0                	test   %al,%al
+ ada:	0f 84 3d ff ff ff    	je     a1d <printf+0x4d>
+ ae0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ae3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ ae6:	89 de                	mov    %ebx,%esi
+ ae8:	89 d3                	mov    %edx,%ebx
+ aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ af0:	83 ec 04             	sub    $0x4,%esp
+ af3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ af6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ af9:	6a 01                	push   $0x1
+ afb:	53                   	push   %ebx
+ afc:	57                   	push   %edi
+ afd:	e8 47 fb ff ff       	call   649 <write>
+        while(*s != 0){
+ b02:	0f b6 06             	movzbl (%esi),%eax
+ b05:	83 c4 10             	add    $0x10,%esp
+ b08:	84 c0                	test   %al,%al
+ b0a:	75 e4                	jne    af0 <printf+0x120>
+      state = 0;
+ b0c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b0f:	31 d2                	xor    %edx,%edx
+ b11:	e9 07 ff ff ff       	jmp    a1d <printf+0x4d>
+ b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b23:	83 ec 0c             	sub    $0xc,%esp
+ b26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b2b:	8b 13                	mov    (%ebx),%edx
+ b2d:	6a 01                	push   $0x1
+ b2f:	e9 6b ff ff ff       	jmp    a9f <printf+0xcf>
+ b34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b38:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b3b:	83 ec 04             	sub    $0x4,%esp
+ b3e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b41:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b43:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b46:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b49:	6a 01                	push   $0x1
+ b4b:	52                   	push   %edx
+ b4c:	57                   	push   %edi
+ b4d:	e8 f7 fa ff ff       	call   649 <write>
+        ap++;
+ b52:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b55:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b58:	31 d2                	xor    %edx,%edx
+ b5a:	e9 be fe ff ff       	jmp    a1d <printf+0x4d>
+ b5f:	90                   	nop
+  write(fd, &c, 1);
+ b60:	83 ec 04             	sub    $0x4,%esp
+ b63:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b66:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b69:	6a 01                	push   $0x1
+ b6b:	e9 11 ff ff ff       	jmp    a81 <printf+0xb1>
+ b70:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b75:	bb b8 0d 00 00       	mov    $0xdb8,%ebx
+ b7a:	e9 61 ff ff ff       	jmp    ae0 <printf+0x110>
+ b7f:	90                   	nop
+
+00000b80 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b81:	a1 a0 d1 00 00       	mov    0xd1a0,%eax
+{
+ b86:	89 e5                	mov    %esp,%ebp
+ b88:	57                   	push   %edi
+ b89:	56                   	push   %esi
+ b8a:	53                   	push   %ebx
+ b8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b8e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b98:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b9a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b9c:	39 ca                	cmp    %ecx,%edx
+ b9e:	73 30                	jae    bd0 <free+0x50>
+ ba0:	39 c1                	cmp    %eax,%ecx
+ ba2:	72 04                	jb     ba8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ba4:	39 c2                	cmp    %eax,%edx
+ ba6:	72 f0                	jb     b98 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ba8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ bab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ bae:	39 f8                	cmp    %edi,%eax
+ bb0:	74 2e                	je     be0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bb2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ bb5:	8b 42 04             	mov    0x4(%edx),%eax
+ bb8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ bbb:	39 f1                	cmp    %esi,%ecx
+ bbd:	74 38                	je     bf7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ bbf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ bc1:	5b                   	pop    %ebx
+  freep = p;
+ bc2:	89 15 a0 d1 00 00    	mov    %edx,0xd1a0
+}
+ bc8:	5e                   	pop    %esi
+ bc9:	5f                   	pop    %edi
+ bca:	5d                   	pop    %ebp
+ bcb:	c3                   	ret
+ bcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bd0:	39 c1                	cmp    %eax,%ecx
+ bd2:	72 d0                	jb     ba4 <free+0x24>
+ bd4:	eb c2                	jmp    b98 <free+0x18>
+ bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bdd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ be0:	03 70 04             	add    0x4(%eax),%esi
+ be3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ be6:	8b 02                	mov    (%edx),%eax
+ be8:	8b 00                	mov    (%eax),%eax
+ bea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ bed:	8b 42 04             	mov    0x4(%edx),%eax
+ bf0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ bf3:	39 f1                	cmp    %esi,%ecx
+ bf5:	75 c8                	jne    bbf <free+0x3f>
+    p->s.size += bp->s.size;
+ bf7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ bfa:	89 15 a0 d1 00 00    	mov    %edx,0xd1a0
+    p->s.size += bp->s.size;
+ c00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c06:	89 0a                	mov    %ecx,(%edx)
+}
+ c08:	5b                   	pop    %ebx
+ c09:	5e                   	pop    %esi
+ c0a:	5f                   	pop    %edi
+ c0b:	5d                   	pop    %ebp
+ c0c:	c3                   	ret
+ c0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c10:	55                   	push   %ebp
+ c11:	89 e5                	mov    %esp,%ebp
+ c13:	57                   	push   %edi
+ c14:	56                   	push   %esi
+ c15:	53                   	push   %ebx
+ c16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c1c:	8b 15 a0 d1 00 00    	mov    0xd1a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c22:	8d 78 07             	lea    0x7(%eax),%edi
+ c25:	c1 ef 03             	shr    $0x3,%edi
+ c28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c2b:	85 d2                	test   %edx,%edx
+ c2d:	0f 84 8d 00 00 00    	je     cc0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c35:	8b 48 04             	mov    0x4(%eax),%ecx
+ c38:	39 f9                	cmp    %edi,%ecx
+ c3a:	73 64                	jae    ca0 <malloc+0x90>
+  if(nu < 4096)
+ c3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c41:	39 df                	cmp    %ebx,%edi
+ c43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c4d:	eb 0a                	jmp    c59 <malloc+0x49>
+ c4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c52:	8b 48 04             	mov    0x4(%eax),%ecx
+ c55:	39 f9                	cmp    %edi,%ecx
+ c57:	73 47                	jae    ca0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c59:	89 c2                	mov    %eax,%edx
+ c5b:	39 05 a0 d1 00 00    	cmp    %eax,0xd1a0
+ c61:	75 ed                	jne    c50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c63:	83 ec 0c             	sub    $0xc,%esp
+ c66:	56                   	push   %esi
+ c67:	e8 15 fb ff ff       	call   781 <sbrk>
+  if(p == (char*)-1)
+ c6c:	83 c4 10             	add    $0x10,%esp
+ c6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c72:	74 1c                	je     c90 <malloc+0x80>
+  hp->s.size = nu;
+ c74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c77:	83 ec 0c             	sub    $0xc,%esp
+ c7a:	83 c0 08             	add    $0x8,%eax
+ c7d:	50                   	push   %eax
+ c7e:	e8 fd fe ff ff       	call   b80 <free>
+  return freep;
+ c83:	8b 15 a0 d1 00 00    	mov    0xd1a0,%edx
+      if((p = morecore(nunits)) == 0)
+ c89:	83 c4 10             	add    $0x10,%esp
+ c8c:	85 d2                	test   %edx,%edx
+ c8e:	75 c0                	jne    c50 <malloc+0x40>
+        return 0;
+  }
+}
+ c90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c93:	31 c0                	xor    %eax,%eax
+}
+ c95:	5b                   	pop    %ebx
+ c96:	5e                   	pop    %esi
+ c97:	5f                   	pop    %edi
+ c98:	5d                   	pop    %ebp
+ c99:	c3                   	ret
+ c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ca0:	39 cf                	cmp    %ecx,%edi
+ ca2:	74 4c                	je     cf0 <malloc+0xe0>
+        p->s.size -= nunits;
+ ca4:	29 f9                	sub    %edi,%ecx
+ ca6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ca9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ cac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ caf:	89 15 a0 d1 00 00    	mov    %edx,0xd1a0
+}
+ cb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ cb8:	83 c0 08             	add    $0x8,%eax
+}
+ cbb:	5b                   	pop    %ebx
+ cbc:	5e                   	pop    %esi
+ cbd:	5f                   	pop    %edi
+ cbe:	5d                   	pop    %ebp
+ cbf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ cc0:	c7 05 a0 d1 00 00 a4 	movl   $0xd1a4,0xd1a0
+ cc7:	d1 00 00 
+    base.s.size = 0;
+ cca:	b8 a4 d1 00 00       	mov    $0xd1a4,%eax
+    base.s.ptr = freep = prevp = &base;
+ ccf:	c7 05 a4 d1 00 00 a4 	movl   $0xd1a4,0xd1a4
+ cd6:	d1 00 00 
+    base.s.size = 0;
+ cd9:	c7 05 a8 d1 00 00 00 	movl   $0x0,0xd1a8
+ ce0:	00 00 00 
+    if(p->s.size >= nunits){
+ ce3:	e9 54 ff ff ff       	jmp    c3c <malloc+0x2c>
+ ce8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ cf0:	8b 08                	mov    (%eax),%ecx
+ cf2:	89 0a                	mov    %ecx,(%edx)
+ cf4:	eb b9                	jmp    caf <malloc+0x9f>
@@ -2,3 +2,12 @@
 #define O_WRONLY  0x001
 #define O_RDWR    0x002
 #define O_CREATE  0x200
+
+// mmap() protection
+#define PROT_READ   0x1
+#define PROT_WRITE  0x2
+
+// mmap() flags
+#define MAP_SHARED    0x01  // Writes reach the file (at munmap/exit)
+#define MAP_PRIVATE   0x02  // Writes stay in this process
+#define MAP_ANONYMOUS 0x20  // Zero-filled memory; fd is ignored
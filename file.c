@@ -70,6 +70,7 @@ fileclose(struct file *f)
   f->type = FD_NONE;
   release(&ftable.lock);
 
+  // FD_SIGNAL files hold no resources.
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
   else if(ff.type == FD_INODE){
@@ -109,6 +110,13 @@ fileread(struct file *f, char *addr, int n)
     iunlock(f->ip);
     return r;
   }
+  if(f->type == FD_SIGNAL){
+    // Whole struct siginfo records only.
+    if(n < sizeof(struct siginfo))
+      return -1;
+    r = sigread(f->sigmask, (struct siginfo*)addr, n / sizeof(struct siginfo));
+    return r < 0 ? -1 : r * sizeof(struct siginfo);
+  }
   panic("fileread");
 }
 
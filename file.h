@@ -1,11 +1,12 @@
 struct file {
-  enum { FD_NONE, FD_PIPE, FD_INODE } type;
+  enum { FD_NONE, FD_PIPE, FD_INODE, FD_SIGNAL } type;
   int ref; // reference count
   char readable;
   char writable;
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  uint sigmask; // FD_SIGNAL: signals read() returns
 };
 
 
@@ -14,8 +15,10 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  int nexec;          // References held by processes running it (see iexec)
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
+  int nshared;        // Pages of it mapped MAP_SHARED (see shget)
 
   short type;         // copy of disk inode
   short major;
@@ -0,0 +1,1747 @@
+
+_forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return usecs(&t0, &t1) / n;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  int n, kb;
+  char *p, *top;
+
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+  1a:	0f 8f ba 00 00 00    	jg     da <main+0xda>
+    exit(0);
+  self = argv[0];
+  20:	8b 03                	mov    (%ebx),%eax
+  n = argc > 1 ? atoi(argv[1]) : 20;
+  22:	bf 14 00 00 00       	mov    $0x14,%edi
+  self = argv[0];
+  27:	a3 ec 10 00 00       	mov    %eax,0x10ec
+  if(n <= 0){
+    printf(2, "usage: forkbench [iterations]\n");
+    exit(1);
+  }
+
+  top = sbrk(0);
+  2c:	83 ec 0c             	sub    $0xc,%esp
+  for(kb = 64; kb <= 64 * 1024; kb *= 4){
+  2f:	be 40 00 00 00       	mov    $0x40,%esi
+  top = sbrk(0);
+  34:	6a 00                	push   $0x0
+  36:	e8 e6 06 00 00       	call   721 <sbrk>
+  3b:	c7 45 e0 06 00 00 00 	movl   $0x6,-0x20(%ebp)
+  42:	83 c4 10             	add    $0x10,%esp
+  for(kb = 64; kb <= 64 * 1024; kb *= 4){
+  45:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  top = sbrk(0);
+  48:	89 c3                	mov    %eax,%ebx
+  for(kb = 64; kb <= 64 * 1024; kb *= 4){
+  4a:	eb 46                	jmp    92 <main+0x92>
+  4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(2, "forkbench: sbrk %d KB failed\n", kb);
+      exit(1);
+    }
+    for(p = top; p < (char*)(kb * 1024); p += PGSIZE)
+      *p = 1;
+    top = sbrk(0);
+  50:	83 ec 0c             	sub    $0xc,%esp
+  53:	6a 00                	push   $0x0
+  55:	e8 c7 06 00 00       	call   721 <sbrk>
+
+    printf(1, "forkbench %d KB fork %d us fork+exec %d us\n",
+  5a:	ba 01 00 00 00       	mov    $0x1,%edx
+    top = sbrk(0);
+  5f:	89 c3                	mov    %eax,%ebx
+    printf(1, "forkbench %d KB fork %d us fork+exec %d us\n",
+  61:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  64:	e8 e7 00 00 00       	call   150 <run>
+  69:	31 d2                	xor    %edx,%edx
+  6b:	89 c7                	mov    %eax,%edi
+  6d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  70:	e8 db 00 00 00       	call   150 <run>
+  75:	89 3c 24             	mov    %edi,(%esp)
+  78:	50                   	push   %eax
+  79:	56                   	push   %esi
+  for(kb = 64; kb <= 64 * 1024; kb *= 4){
+  7a:	c1 e6 02             	shl    $0x2,%esi
+    printf(1, "forkbench %d KB fork %d us fork+exec %d us\n",
+  7d:	68 0c 0d 00 00       	push   $0xd0c
+  82:	6a 01                	push   $0x1
+  84:	e8 e7 08 00 00       	call   970 <printf>
+  for(kb = 64; kb <= 64 * 1024; kb *= 4){
+  89:	83 c4 20             	add    $0x20,%esp
+  8c:	83 6d e0 01          	subl   $0x1,-0x20(%ebp)
+  90:	74 3e                	je     d0 <main+0xd0>
+    if(kb * 1024 > (uint)top && sbrk(kb * 1024 - (uint)top) == (char*)-1){
+  92:	89 f7                	mov    %esi,%edi
+  94:	c1 e7 0a             	shl    $0xa,%edi
+  97:	39 fb                	cmp    %edi,%ebx
+  99:	73 b5                	jae    50 <main+0x50>
+  9b:	89 f8                	mov    %edi,%eax
+  9d:	83 ec 0c             	sub    $0xc,%esp
+  a0:	29 d8                	sub    %ebx,%eax
+  a2:	50                   	push   %eax
+  a3:	e8 79 06 00 00       	call   721 <sbrk>
+  a8:	83 c4 10             	add    $0x10,%esp
+  ab:	83 f8 ff             	cmp    $0xffffffff,%eax
+  ae:	75 11                	jne    c1 <main+0xc1>
+  b0:	eb 77                	jmp    129 <main+0x129>
+  b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *p = 1;
+  b8:	c6 03 01             	movb   $0x1,(%ebx)
+    for(p = top; p < (char*)(kb * 1024); p += PGSIZE)
+  bb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  c1:	39 fb                	cmp    %edi,%ebx
+  c3:	72 f3                	jb     b8 <main+0xb8>
+  c5:	eb 89                	jmp    50 <main+0x50>
+  c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ce:	66 90                	xchg   %ax,%ax
+    exit(0);
+  d0:	83 ec 0c             	sub    $0xc,%esp
+  d3:	6a 00                	push   $0x0
+  d5:	e8 a7 04 00 00       	call   581 <exit>
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+  da:	51                   	push   %ecx
+  db:	51                   	push   %ecx
+  dc:	68 98 0c 00 00       	push   $0xc98
+  e1:	ff 73 04             	push   0x4(%ebx)
+  e4:	e8 97 01 00 00       	call   280 <strcmp>
+  e9:	83 c4 10             	add    $0x10,%esp
+  ec:	85 c0                	test   %eax,%eax
+  ee:	74 e0                	je     d0 <main+0xd0>
+  self = argv[0];
+  f0:	8b 03                	mov    (%ebx),%eax
+  n = argc > 1 ? atoi(argv[1]) : 20;
+  f2:	83 ec 0c             	sub    $0xc,%esp
+  f5:	ff 73 04             	push   0x4(%ebx)
+  self = argv[0];
+  f8:	a3 ec 10 00 00       	mov    %eax,0x10ec
+  n = argc > 1 ? atoi(argv[1]) : 20;
+  fd:	e8 1e 03 00 00       	call   420 <atoi>
+  if(n <= 0){
+ 102:	83 c4 10             	add    $0x10,%esp
+  n = argc > 1 ? atoi(argv[1]) : 20;
+ 105:	89 c7                	mov    %eax,%edi
+  if(n <= 0){
+ 107:	85 c0                	test   %eax,%eax
+ 109:	0f 8f 1d ff ff ff    	jg     2c <main+0x2c>
+    printf(2, "usage: forkbench [iterations]\n");
+ 10f:	52                   	push   %edx
+ 110:	52                   	push   %edx
+ 111:	68 ec 0c 00 00       	push   $0xcec
+ 116:	6a 02                	push   $0x2
+ 118:	e8 53 08 00 00       	call   970 <printf>
+    exit(1);
+ 11d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 124:	e8 58 04 00 00       	call   581 <exit>
+      printf(2, "forkbench: sbrk %d KB failed\n", kb);
+ 129:	50                   	push   %eax
+ 12a:	56                   	push   %esi
+ 12b:	68 ce 0c 00 00       	push   $0xcce
+ 130:	6a 02                	push   $0x2
+ 132:	e8 39 08 00 00       	call   970 <printf>
+      exit(1);
+ 137:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 13e:	e8 3e 04 00 00       	call   581 <exit>
+ 143:	66 90                	xchg   %ax,%ax
+ 145:	66 90                	xchg   %ax,%ax
+ 147:	66 90                	xchg   %ax,%ax
+ 149:	66 90                	xchg   %ax,%ax
+ 14b:	66 90                	xchg   %ax,%ax
+ 14d:	66 90                	xchg   %ax,%ax
+ 14f:	90                   	nop
+
+00000150 <run>:
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	89 d7                	mov    %edx,%edi
+ 156:	56                   	push   %esi
+ 157:	89 c6                	mov    %eax,%esi
+ 159:	53                   	push   %ebx
+  for(i = 0; i < n; i++){
+ 15a:	31 db                	xor    %ebx,%ebx
+{
+ 15c:	83 ec 34             	sub    $0x34,%esp
+  argv[0] = self;
+ 15f:	a1 ec 10 00 00       	mov    0x10ec,%eax
+  argv[1] = "-x";
+ 164:	c7 45 e0 98 0c 00 00 	movl   $0xc98,-0x20(%ebp)
+  argv[2] = 0;
+ 16b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  argv[0] = self;
+ 172:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+ 175:	8d 45 cc             	lea    -0x34(%ebp),%eax
+ 178:	50                   	push   %eax
+ 179:	6a 01                	push   $0x1
+ 17b:	e8 70 03 00 00       	call   4f0 <clock_gettime>
+ 180:	83 c4 10             	add    $0x10,%esp
+ 183:	eb 0f                	jmp    194 <run+0x44>
+ 185:	8d 76 00             	lea    0x0(%esi),%esi
+    wait();
+ 188:	e8 0e 04 00 00       	call   59b <wait>
+  for(i = 0; i < n; i++){
+ 18d:	83 c3 01             	add    $0x1,%ebx
+ 190:	39 de                	cmp    %ebx,%esi
+ 192:	74 4c                	je     1e0 <run+0x90>
+    if((pid = fork()) < 0){
+ 194:	e8 ce 03 00 00       	call   567 <fork>
+ 199:	85 c0                	test   %eax,%eax
+ 19b:	0f 88 89 00 00 00    	js     22a <run+0xda>
+    if(pid == 0){
+ 1a1:	75 e5                	jne    188 <run+0x38>
+      if(doexec){
+ 1a3:	85 ff                	test   %edi,%edi
+ 1a5:	74 79                	je     220 <run+0xd0>
+        exec(self, argv);
+ 1a7:	83 ec 08             	sub    $0x8,%esp
+ 1aa:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 1ad:	50                   	push   %eax
+ 1ae:	ff 35 ec 10 00 00    	push   0x10ec
+ 1b4:	e8 7e 04 00 00       	call   637 <exec>
+        printf(2, "forkbench: exec %s failed\n", self);
+ 1b9:	83 c4 0c             	add    $0xc,%esp
+ 1bc:	ff 35 ec 10 00 00    	push   0x10ec
+ 1c2:	68 b3 0c 00 00       	push   $0xcb3
+ 1c7:	6a 02                	push   $0x2
+ 1c9:	e8 a2 07 00 00       	call   970 <printf>
+        exit(1);
+ 1ce:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 1d5:	e8 a7 03 00 00       	call   581 <exit>
+ 1da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+ 1e0:	83 ec 08             	sub    $0x8,%esp
+ 1e3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 1e6:	50                   	push   %eax
+ 1e7:	6a 01                	push   $0x1
+ 1e9:	e8 02 03 00 00       	call   4f0 <clock_gettime>
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 1ee:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 1f1:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+ 1f6:	2b 5d d0             	sub    -0x30(%ebp),%ebx
+ 1f9:	f7 eb                	imul   %ebx
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 1fb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 1fe:	2b 4d cc             	sub    -0x34(%ebp),%ecx
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 201:	c1 fb 1f             	sar    $0x1f,%ebx
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 204:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+}
+ 20a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 20d:	c1 fa 06             	sar    $0x6,%edx
+ 210:	29 da                	sub    %ebx,%edx
+}
+ 212:	5b                   	pop    %ebx
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 213:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+  return usecs(&t0, &t1) / n;
+ 216:	31 d2                	xor    %edx,%edx
+ 218:	f7 f6                	div    %esi
+}
+ 21a:	5e                   	pop    %esi
+ 21b:	5f                   	pop    %edi
+ 21c:	5d                   	pop    %ebp
+ 21d:	c3                   	ret
+ 21e:	66 90                	xchg   %ax,%ax
+      exit(0);
+ 220:	83 ec 0c             	sub    $0xc,%esp
+ 223:	6a 00                	push   $0x0
+ 225:	e8 57 03 00 00       	call   581 <exit>
+      printf(2, "forkbench: fork failed\n");
+ 22a:	83 ec 08             	sub    $0x8,%esp
+ 22d:	68 9b 0c 00 00       	push   $0xc9b
+ 232:	6a 02                	push   $0x2
+ 234:	e8 37 07 00 00       	call   970 <printf>
+      exit(1);
+ 239:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 240:	e8 3c 03 00 00       	call   581 <exit>
+ 245:	66 90                	xchg   %ax,%ax
+ 247:	66 90                	xchg   %ax,%ax
+ 249:	66 90                	xchg   %ax,%ax
+ 24b:	66 90                	xchg   %ax,%ax
+ 24d:	66 90                	xchg   %ax,%ax
+ 24f:	90                   	nop
+
+00000250 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 250:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 251:	31 c0                	xor    %eax,%eax
+{
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	53                   	push   %ebx
+ 256:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 260:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 264:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 267:	83 c0 01             	add    $0x1,%eax
+ 26a:	84 d2                	test   %dl,%dl
+ 26c:	75 f2                	jne    260 <strcpy+0x10>
+    ;
+  return os;
+}
+ 26e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 271:	89 c8                	mov    %ecx,%eax
+ 273:	c9                   	leave
+ 274:	c3                   	ret
+ 275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+ 287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 28a:	0f b6 02             	movzbl (%edx),%eax
+ 28d:	84 c0                	test   %al,%al
+ 28f:	75 17                	jne    2a8 <strcmp+0x28>
+ 291:	eb 3a                	jmp    2cd <strcmp+0x4d>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 29c:	83 c2 01             	add    $0x1,%edx
+ 29f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2a2:	84 c0                	test   %al,%al
+ 2a4:	74 1a                	je     2c0 <strcmp+0x40>
+    p++, q++;
+ 2a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2ab:	38 c3                	cmp    %al,%bl
+ 2ad:	74 e9                	je     298 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2af:	29 d8                	sub    %ebx,%eax
+}
+ 2b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b4:	c9                   	leave
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2c4:	31 c0                	xor    %eax,%eax
+ 2c6:	29 d8                	sub    %ebx,%eax
+}
+ 2c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2d0:	31 c0                	xor    %eax,%eax
+ 2d2:	eb db                	jmp    2af <strcmp+0x2f>
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2e9:	74 15                	je     300 <strlen+0x20>
+ 2eb:	31 c0                	xor    %eax,%eax
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 2f0:	83 c0 01             	add    $0x1,%eax
+ 2f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2f7:	89 c1                	mov    %eax,%ecx
+ 2f9:	75 f5                	jne    2f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2fb:	89 c8                	mov    %ecx,%eax
+ 2fd:	5d                   	pop    %ebp
+ 2fe:	c3                   	ret
+ 2ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 300:	31 c9                	xor    %ecx,%ecx
+}
+ 302:	5d                   	pop    %ebp
+ 303:	89 c8                	mov    %ecx,%eax
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 317:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 31a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31d:	89 d7                	mov    %edx,%edi
+ 31f:	fc                   	cld
+ 320:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 322:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 325:	89 d0                	mov    %edx,%eax
+ 327:	c9                   	leave
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 33a:	0f b6 10             	movzbl (%eax),%edx
+ 33d:	84 d2                	test   %dl,%dl
+ 33f:	75 12                	jne    353 <strchr+0x23>
+ 341:	eb 1d                	jmp    360 <strchr+0x30>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 34c:	83 c0 01             	add    $0x1,%eax
+ 34f:	84 d2                	test   %dl,%dl
+ 351:	74 0d                	je     360 <strchr+0x30>
+    if(*s == c)
+ 353:	38 d1                	cmp    %dl,%cl
+ 355:	75 f1                	jne    348 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 357:	5d                   	pop    %ebp
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 360:	31 c0                	xor    %eax,%eax
+}
+ 362:	5d                   	pop    %ebp
+ 363:	c3                   	ret
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 375:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 378:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 379:	31 db                	xor    %ebx,%ebx
+{
+ 37b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 37e:	eb 27                	jmp    3a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 380:	83 ec 04             	sub    $0x4,%esp
+ 383:	6a 01                	push   $0x1
+ 385:	56                   	push   %esi
+ 386:	6a 00                	push   $0x0
+ 388:	e8 42 02 00 00       	call   5cf <read>
+    if(cc < 1)
+ 38d:	83 c4 10             	add    $0x10,%esp
+ 390:	85 c0                	test   %eax,%eax
+ 392:	7e 1d                	jle    3b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 394:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 39f:	3c 0a                	cmp    $0xa,%al
+ 3a1:	74 10                	je     3b3 <gets+0x43>
+ 3a3:	3c 0d                	cmp    $0xd,%al
+ 3a5:	74 0c                	je     3b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3a7:	89 df                	mov    %ebx,%edi
+ 3a9:	83 c3 01             	add    $0x1,%ebx
+ 3ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3af:	7c cf                	jl     380 <gets+0x10>
+ 3b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bd:	5b                   	pop    %ebx
+ 3be:	5e                   	pop    %esi
+ 3bf:	5f                   	pop    %edi
+ 3c0:	5d                   	pop    %ebp
+ 3c1:	c3                   	ret
+ 3c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3d5:	83 ec 08             	sub    $0x8,%esp
+ 3d8:	6a 00                	push   $0x0
+ 3da:	ff 75 08             	push   0x8(%ebp)
+ 3dd:	e8 6f 02 00 00       	call   651 <open>
+  if(fd < 0)
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	78 27                	js     410 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3e9:	83 ec 08             	sub    $0x8,%esp
+ 3ec:	ff 75 0c             	push   0xc(%ebp)
+ 3ef:	89 c3                	mov    %eax,%ebx
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 a8 02 00 00       	call   69f <fstat>
+  close(fd);
+ 3f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3fc:	e8 02 02 00 00       	call   603 <close>
+  return r;
+ 401:	83 c4 10             	add    $0x10,%esp
+}
+ 404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 407:	89 f0                	mov    %esi,%eax
+ 409:	5b                   	pop    %ebx
+ 40a:	5e                   	pop    %esi
+ 40b:	5d                   	pop    %ebp
+ 40c:	c3                   	ret
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 415:	eb ed                	jmp    404 <stat+0x34>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 427:	0f be 02             	movsbl (%edx),%eax
+ 42a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 42d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 435:	77 1e                	ja     455 <atoi+0x35>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 440:	83 c2 01             	add    $0x1,%edx
+ 443:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 446:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 44a:	0f be 02             	movsbl (%edx),%eax
+ 44d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 450:	80 fb 09             	cmp    $0x9,%bl
+ 453:	76 eb                	jbe    440 <atoi+0x20>
+  return n;
+}
+ 455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 458:	89 c8                	mov    %ecx,%eax
+ 45a:	c9                   	leave
+ 45b:	c3                   	ret
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	8b 45 10             	mov    0x10(%ebp),%eax
+ 468:	8b 55 08             	mov    0x8(%ebp),%edx
+ 46b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 46e:	85 c0                	test   %eax,%eax
+ 470:	7e 13                	jle    485 <memmove+0x25>
+ 472:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 474:	89 d7                	mov    %edx,%edi
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 480:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 481:	39 f8                	cmp    %edi,%eax
+ 483:	75 fb                	jne    480 <memmove+0x20>
+  return vdst;
+}
+ 485:	5e                   	pop    %esi
+ 486:	89 d0                	mov    %edx,%eax
+ 488:	5f                   	pop    %edi
+ 489:	5d                   	pop    %ebp
+ 48a:	c3                   	ret
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 496:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 499:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 4a0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 4a3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 4a6:	50                   	push   %eax
+ 4a7:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 4aa:	50                   	push   %eax
+ 4ab:	6a 00                	push   $0x0
+ 4ad:	e8 8d 03 00 00       	call   83f <setitimer>
+ 4b2:	83 c4 10             	add    $0x10,%esp
+ 4b5:	89 c2                	mov    %eax,%edx
+ 4b7:	31 c0                	xor    %eax,%eax
+ 4b9:	85 d2                	test   %edx,%edx
+ 4bb:	78 03                	js     4c0 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 4bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 4c0:	c9                   	leave
+ 4c1:	c3                   	ret
+ 4c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 4d0:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 4d5:	c3                   	ret
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004e0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 4e0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 4e5:	c3                   	ret
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004f0 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 4f9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 4fd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 500:	75 5e                	jne    560 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 502:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 508:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 50a:	89 d3                	mov    %edx,%ebx
+ 50c:	89 c1                	mov    %eax,%ecx
+ 50e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 514:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 51a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 51d:	31 d2                	xor    %edx,%edx
+ 51f:	89 d8                	mov    %ebx,%eax
+ 521:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 524:	f7 f6                	div    %esi
+ 526:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 528:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 52b:	f7 f6                	div    %esi
+ 52d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 52f:	89 da                	mov    %ebx,%edx
+ 531:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 536:	f7 f3                	div    %ebx
+ 538:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 53a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 53f:	89 d3                	mov    %edx,%ebx
+ 541:	f7 e1                	mul    %ecx
+ 543:	f7 f6                	div    %esi
+ 545:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 54b:	01 c3                	add    %eax,%ebx
+  return 0;
+ 54d:	31 c0                	xor    %eax,%eax
+ 54f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 552:	83 c4 0c             	add    $0xc,%esp
+ 555:	5b                   	pop    %ebx
+ 556:	5e                   	pop    %esi
+ 557:	5f                   	pop    %edi
+ 558:	5d                   	pop    %ebp
+ 559:	c3                   	ret
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 560:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 565:	eb eb                	jmp    552 <clock_gettime+0x62>
+
+00000567 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 567:	b8 01 00 00 00       	mov    $0x1,%eax
+ 56c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 573:	74 09                	je     57e <fork+0x17>
+ 575:	89 e1                	mov    %esp,%ecx
+ 577:	ba 80 05 00 00       	mov    $0x580,%edx
+ 57c:	0f 34                	sysenter
+ 57e:	cd 40                	int    $0x40
+ 580:	c3                   	ret
+
+00000581 <exit>:
+SYSCALL(exit)
+ 581:	b8 02 00 00 00       	mov    $0x2,%eax
+ 586:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 58d:	74 09                	je     598 <exit+0x17>
+ 58f:	89 e1                	mov    %esp,%ecx
+ 591:	ba 9a 05 00 00       	mov    $0x59a,%edx
+ 596:	0f 34                	sysenter
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <wait>:
+SYSCALL(wait)
+ 59b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5a0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5a7:	74 09                	je     5b2 <wait+0x17>
+ 5a9:	89 e1                	mov    %esp,%ecx
+ 5ab:	ba b4 05 00 00       	mov    $0x5b4,%edx
+ 5b0:	0f 34                	sysenter
+ 5b2:	cd 40                	int    $0x40
+ 5b4:	c3                   	ret
+
+000005b5 <pipe>:
+SYSCALL(pipe)
+ 5b5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5ba:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5c1:	74 09                	je     5cc <pipe+0x17>
+ 5c3:	89 e1                	mov    %esp,%ecx
+ 5c5:	ba ce 05 00 00       	mov    $0x5ce,%edx
+ 5ca:	0f 34                	sysenter
+ 5cc:	cd 40                	int    $0x40
+ 5ce:	c3                   	ret
+
+000005cf <read>:
+SYSCALL(read)
+ 5cf:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5d4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5db:	74 09                	je     5e6 <read+0x17>
+ 5dd:	89 e1                	mov    %esp,%ecx
+ 5df:	ba e8 05 00 00       	mov    $0x5e8,%edx
+ 5e4:	0f 34                	sysenter
+ 5e6:	cd 40                	int    $0x40
+ 5e8:	c3                   	ret
+
+000005e9 <write>:
+SYSCALL(write)
+ 5e9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5ee:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5f5:	74 09                	je     600 <write+0x17>
+ 5f7:	89 e1                	mov    %esp,%ecx
+ 5f9:	ba 02 06 00 00       	mov    $0x602,%edx
+ 5fe:	0f 34                	sysenter
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <close>:
+SYSCALL(close)
+ 603:	b8 15 00 00 00       	mov    $0x15,%eax
+ 608:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 60f:	74 09                	je     61a <close+0x17>
+ 611:	89 e1                	mov    %esp,%ecx
+ 613:	ba 1c 06 00 00       	mov    $0x61c,%edx
+ 618:	0f 34                	sysenter
+ 61a:	cd 40                	int    $0x40
+ 61c:	c3                   	ret
+
+0000061d <kill>:
+SYSCALL(kill)
+ 61d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 622:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 629:	74 09                	je     634 <kill+0x17>
+ 62b:	89 e1                	mov    %esp,%ecx
+ 62d:	ba 36 06 00 00       	mov    $0x636,%edx
+ 632:	0f 34                	sysenter
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <exec>:
+SYSCALL(exec)
+ 637:	b8 07 00 00 00       	mov    $0x7,%eax
+ 63c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 643:	74 09                	je     64e <exec+0x17>
+ 645:	89 e1                	mov    %esp,%ecx
+ 647:	ba 50 06 00 00       	mov    $0x650,%edx
+ 64c:	0f 34                	sysenter
+ 64e:	cd 40                	int    $0x40
+ 650:	c3                   	ret
+
+00000651 <open>:
+SYSCALL(open)
+ 651:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 656:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 65d:	74 09                	je     668 <open+0x17>
+ 65f:	89 e1                	mov    %esp,%ecx
+ 661:	ba 6a 06 00 00       	mov    $0x66a,%edx
+ 666:	0f 34                	sysenter
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <mknod>:
+SYSCALL(mknod)
+ 66b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 670:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 677:	74 09                	je     682 <mknod+0x17>
+ 679:	89 e1                	mov    %esp,%ecx
+ 67b:	ba 84 06 00 00       	mov    $0x684,%edx
+ 680:	0f 34                	sysenter
+ 682:	cd 40                	int    $0x40
+ 684:	c3                   	ret
+
+00000685 <unlink>:
+SYSCALL(unlink)
+ 685:	b8 12 00 00 00       	mov    $0x12,%eax
+ 68a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 691:	74 09                	je     69c <unlink+0x17>
+ 693:	89 e1                	mov    %esp,%ecx
+ 695:	ba 9e 06 00 00       	mov    $0x69e,%edx
+ 69a:	0f 34                	sysenter
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <fstat>:
+SYSCALL(fstat)
+ 69f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6a4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6ab:	74 09                	je     6b6 <fstat+0x17>
+ 6ad:	89 e1                	mov    %esp,%ecx
+ 6af:	ba b8 06 00 00       	mov    $0x6b8,%edx
+ 6b4:	0f 34                	sysenter
+ 6b6:	cd 40                	int    $0x40
+ 6b8:	c3                   	ret
+
+000006b9 <link>:
+SYSCALL(link)
+ 6b9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6be:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6c5:	74 09                	je     6d0 <link+0x17>
+ 6c7:	89 e1                	mov    %esp,%ecx
+ 6c9:	ba d2 06 00 00       	mov    $0x6d2,%edx
+ 6ce:	0f 34                	sysenter
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <mkdir>:
+SYSCALL(mkdir)
+ 6d3:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6d8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6df:	74 09                	je     6ea <mkdir+0x17>
+ 6e1:	89 e1                	mov    %esp,%ecx
+ 6e3:	ba ec 06 00 00       	mov    $0x6ec,%edx
+ 6e8:	0f 34                	sysenter
+ 6ea:	cd 40                	int    $0x40
+ 6ec:	c3                   	ret
+
+000006ed <chdir>:
+SYSCALL(chdir)
+ 6ed:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6f2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6f9:	74 09                	je     704 <chdir+0x17>
+ 6fb:	89 e1                	mov    %esp,%ecx
+ 6fd:	ba 06 07 00 00       	mov    $0x706,%edx
+ 702:	0f 34                	sysenter
+ 704:	cd 40                	int    $0x40
+ 706:	c3                   	ret
+
+00000707 <dup>:
+SYSCALL(dup)
+ 707:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 70c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 713:	74 09                	je     71e <dup+0x17>
+ 715:	89 e1                	mov    %esp,%ecx
+ 717:	ba 20 07 00 00       	mov    $0x720,%edx
+ 71c:	0f 34                	sysenter
+ 71e:	cd 40                	int    $0x40
+ 720:	c3                   	ret
+
+00000721 <sbrk>:
+SYSCALL(sbrk)
+ 721:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 726:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 72d:	74 09                	je     738 <sbrk+0x17>
+ 72f:	89 e1                	mov    %esp,%ecx
+ 731:	ba 3a 07 00 00       	mov    $0x73a,%edx
+ 736:	0f 34                	sysenter
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <sleep>:
+SYSCALL(sleep)
+ 73b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 740:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 747:	74 09                	je     752 <sleep+0x17>
+ 749:	89 e1                	mov    %esp,%ecx
+ 74b:	ba 54 07 00 00       	mov    $0x754,%edx
+ 750:	0f 34                	sysenter
+ 752:	cd 40                	int    $0x40
+ 754:	c3                   	ret
+
+00000755 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 755:	b8 16 00 00 00       	mov    $0x16,%eax
+ 75a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 761:	74 09                	je     76c <sigprocmask+0x17>
+ 763:	89 e1                	mov    %esp,%ecx
+ 765:	ba 6e 07 00 00       	mov    $0x76e,%edx
+ 76a:	0f 34                	sysenter
+ 76c:	cd 40                	int    $0x40
+ 76e:	c3                   	ret
+
+0000076f <sigaction>:
+SYSCALL(sigaction)
+ 76f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 774:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 77b:	74 09                	je     786 <sigaction+0x17>
+ 77d:	89 e1                	mov    %esp,%ecx
+ 77f:	ba 88 07 00 00       	mov    $0x788,%edx
+ 784:	0f 34                	sysenter
+ 786:	cd 40                	int    $0x40
+ 788:	c3                   	ret
+
+00000789 <sigret>:
+SYSCALL(sigret)
+ 789:	b8 18 00 00 00       	mov    $0x18,%eax
+ 78e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 795:	74 09                	je     7a0 <sigret+0x17>
+ 797:	89 e1                	mov    %esp,%ecx
+ 799:	ba a2 07 00 00       	mov    $0x7a2,%edx
+ 79e:	0f 34                	sysenter
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <traceread>:
+SYSCALL(traceread)
+ 7a3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7a8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7af:	74 09                	je     7ba <traceread+0x17>
+ 7b1:	89 e1                	mov    %esp,%ecx
+ 7b3:	ba bc 07 00 00       	mov    $0x7bc,%edx
+ 7b8:	0f 34                	sysenter
+ 7ba:	cd 40                	int    $0x40
+ 7bc:	c3                   	ret
+
+000007bd <sigqueue>:
+SYSCALL(sigqueue)
+ 7bd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7c2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7c9:	74 09                	je     7d4 <sigqueue+0x17>
+ 7cb:	89 e1                	mov    %esp,%ecx
+ 7cd:	ba d6 07 00 00       	mov    $0x7d6,%edx
+ 7d2:	0f 34                	sysenter
+ 7d4:	cd 40                	int    $0x40
+ 7d6:	c3                   	ret
+
+000007d7 <signalfd>:
+SYSCALL(signalfd)
+ 7d7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7dc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7e3:	74 09                	je     7ee <signalfd+0x17>
+ 7e5:	89 e1                	mov    %esp,%ecx
+ 7e7:	ba f0 07 00 00       	mov    $0x7f0,%edx
+ 7ec:	0f 34                	sysenter
+ 7ee:	cd 40                	int    $0x40
+ 7f0:	c3                   	ret
+
+000007f1 <sigwait>:
+SYSCALL(sigwait)
+ 7f1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7f6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7fd:	74 09                	je     808 <sigwait+0x17>
+ 7ff:	89 e1                	mov    %esp,%ecx
+ 801:	ba 0a 08 00 00       	mov    $0x80a,%edx
+ 806:	0f 34                	sysenter
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <sigsuspend>:
+SYSCALL(sigsuspend)
+ 80b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 810:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 817:	74 09                	je     822 <sigsuspend+0x17>
+ 819:	89 e1                	mov    %esp,%ecx
+ 81b:	ba 24 08 00 00       	mov    $0x824,%edx
+ 820:	0f 34                	sysenter
+ 822:	cd 40                	int    $0x40
+ 824:	c3                   	ret
+
+00000825 <waitpid>:
+SYSCALL(waitpid)
+ 825:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 82a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 831:	74 09                	je     83c <waitpid+0x17>
+ 833:	89 e1                	mov    %esp,%ecx
+ 835:	ba 3e 08 00 00       	mov    $0x83e,%edx
+ 83a:	0f 34                	sysenter
+ 83c:	cd 40                	int    $0x40
+ 83e:	c3                   	ret
+
+0000083f <setitimer>:
+SYSCALL(setitimer)
+ 83f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 844:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 84b:	74 09                	je     856 <setitimer+0x17>
+ 84d:	89 e1                	mov    %esp,%ecx
+ 84f:	ba 58 08 00 00       	mov    $0x858,%edx
+ 854:	0f 34                	sysenter
+ 856:	cd 40                	int    $0x40
+ 858:	c3                   	ret
+
+00000859 <nanosleep>:
+SYSCALL(nanosleep)
+ 859:	b8 21 00 00 00       	mov    $0x21,%eax
+ 85e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 865:	74 09                	je     870 <nanosleep+0x17>
+ 867:	89 e1                	mov    %esp,%ecx
+ 869:	ba 72 08 00 00       	mov    $0x872,%edx
+ 86e:	0f 34                	sysenter
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <mmap>:
+SYSCALL(mmap)
+ 873:	b8 22 00 00 00       	mov    $0x22,%eax
+ 878:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 87f:	74 09                	je     88a <mmap+0x17>
+ 881:	89 e1                	mov    %esp,%ecx
+ 883:	ba 8c 08 00 00       	mov    $0x88c,%edx
+ 888:	0f 34                	sysenter
+ 88a:	cd 40                	int    $0x40
+ 88c:	c3                   	ret
+
+0000088d <munmap>:
+SYSCALL(munmap)
+ 88d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 892:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 899:	74 09                	je     8a4 <munmap+0x17>
+ 89b:	89 e1                	mov    %esp,%ecx
+ 89d:	ba a6 08 00 00       	mov    $0x8a6,%edx
+ 8a2:	0f 34                	sysenter
+ 8a4:	cd 40                	int    $0x40
+ 8a6:	c3                   	ret
+
+000008a7 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 8a7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8ac:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8b3:	74 09                	je     8be <getpid_syscall+0x17>
+ 8b5:	89 e1                	mov    %esp,%ecx
+ 8b7:	ba c0 08 00 00       	mov    $0x8c0,%edx
+ 8bc:	0f 34                	sysenter
+ 8be:	cd 40                	int    $0x40
+ 8c0:	c3                   	ret
+
+000008c1 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 8c1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8c6:	cd 40                	int    $0x40
+ 8c8:	c3                   	ret
+ 8c9:	66 90                	xchg   %ax,%ax
+ 8cb:	66 90                	xchg   %ax,%ax
+ 8cd:	66 90                	xchg   %ax,%ax
+ 8cf:	90                   	nop
+
+000008d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8d8:	89 d1                	mov    %edx,%ecx
+{
+ 8da:	83 ec 3c             	sub    $0x3c,%esp
+ 8dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8e0:	85 d2                	test   %edx,%edx
+ 8e2:	0f 89 80 00 00 00    	jns    968 <printint+0x98>
+ 8e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8ec:	74 7a                	je     968 <printint+0x98>
+    x = -xx;
+ 8ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8f8:	31 f6                	xor    %esi,%esi
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 900:	89 c8                	mov    %ecx,%eax
+ 902:	31 d2                	xor    %edx,%edx
+ 904:	89 f7                	mov    %esi,%edi
+ 906:	f7 f3                	div    %ebx
+ 908:	8d 76 01             	lea    0x1(%esi),%esi
+ 90b:	0f b6 92 98 0d 00 00 	movzbl 0xd98(%edx),%edx
+ 912:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 916:	89 ca                	mov    %ecx,%edx
+ 918:	89 c1                	mov    %eax,%ecx
+ 91a:	39 da                	cmp    %ebx,%edx
+ 91c:	73 e2                	jae    900 <printint+0x30>
+  if(neg)
+ 91e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 921:	85 c0                	test   %eax,%eax
+ 923:	74 07                	je     92c <printint+0x5c>
+    buf[i++] = '-';
+ 925:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 92a:	89 f7                	mov    %esi,%edi
+ 92c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 92f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 932:	01 df                	add    %ebx,%edi
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 938:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 941:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 944:	6a 01                	push   $0x1
+ 946:	50                   	push   %eax
+ 947:	56                   	push   %esi
+ 948:	e8 9c fc ff ff       	call   5e9 <write>
+  while(--i >= 0)
+ 94d:	89 f8                	mov    %edi,%eax
+ 94f:	83 c4 10             	add    $0x10,%esp
+ 952:	83 ef 01             	sub    $0x1,%edi
+ 955:	39 d8                	cmp    %ebx,%eax
+ 957:	75 df                	jne    938 <printint+0x68>
+}
+ 959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 95c:	5b                   	pop    %ebx
+ 95d:	5e                   	pop    %esi
+ 95e:	5f                   	pop    %edi
+ 95f:	5d                   	pop    %ebp
+ 960:	c3                   	ret
+ 961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 968:	31 c0                	xor    %eax,%eax
+ 96a:	eb 89                	jmp    8f5 <printint+0x25>
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 979:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 97c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 97f:	0f b6 1e             	movzbl (%esi),%ebx
+ 982:	83 c6 01             	add    $0x1,%esi
+ 985:	84 db                	test   %bl,%bl
+ 987:	74 67                	je     9f0 <printf+0x80>
+ 989:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 98c:	31 d2                	xor    %edx,%edx
+ 98e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 991:	eb 34                	jmp    9c7 <printf+0x57>
+ 993:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 997:	90                   	nop
+ 998:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 99b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9a0:	83 f8 25             	cmp    $0x25,%eax
+ 9a3:	74 18                	je     9bd <printf+0x4d>
+  write(fd, &c, 1);
+ 9a5:	83 ec 04             	sub    $0x4,%esp
+ 9a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ae:	6a 01                	push   $0x1
+ 9b0:	50                   	push   %eax
+ 9b1:	57                   	push   %edi
+ 9b2:	e8 32 fc ff ff       	call   5e9 <write>
+ 9b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 9c0:	83 c6 01             	add    $0x1,%esi
+ 9c3:	84 db                	test   %bl,%bl
+ 9c5:	74 29                	je     9f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9ca:	85 d2                	test   %edx,%edx
+ 9cc:	74 ca                	je     998 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9ce:	83 fa 25             	cmp    $0x25,%edx
+ 9d1:	75 ea                	jne    9bd <printf+0x4d>
+      if(c == 'd'){
+ 9d3:	83 f8 25             	cmp    $0x25,%eax
+ 9d6:	0f 84 24 01 00 00    	je     b00 <printf+0x190>
+ 9dc:	83 e8 63             	sub    $0x63,%eax
+ 9df:	83 f8 15             	cmp    $0x15,%eax
+ 9e2:	77 1c                	ja     a00 <printf+0x90>
+ 9e4:	ff 24 85 40 0d 00 00 	jmp    *0xd40(,%eax,4)
+ 9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9f3:	5b                   	pop    %ebx
+ 9f4:	5e                   	pop    %esi
+ 9f5:	5f                   	pop    %edi
+ 9f6:	5d                   	pop    %ebp
+ 9f7:	c3                   	ret
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+  write(fd, &c, 1);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a06:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a0a:	6a 01                	push   $0x1
+ a0c:	52                   	push   %edx
+ a0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a10:	57                   	push   %edi
+ a11:	e8 d3 fb ff ff       	call   5e9 <write>
+ a16:	83 c4 0c             	add    $0xc,%esp
+ a19:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a1c:	6a 01                	push   $0x1
+ a1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a21:	52                   	push   %edx
+ a22:	57                   	push   %edi
+ a23:	e8 c1 fb ff ff       	call   5e9 <write>
+        putc(fd, c);
+ a28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a2b:	31 d2                	xor    %edx,%edx
+ a2d:	eb 8e                	jmp    9bd <printf+0x4d>
+ a2f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a3b:	8b 13                	mov    (%ebx),%edx
+ a3d:	6a 00                	push   $0x0
+ a3f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a41:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a44:	e8 87 fe ff ff       	call   8d0 <printint>
+        ap++;
+ a49:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a4f:	31 d2                	xor    %edx,%edx
+ a51:	e9 67 ff ff ff       	jmp    9bd <printf+0x4d>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a65:	83 c0 04             	add    $0x4,%eax
+ a68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a6b:	85 db                	test   %ebx,%ebx
+ a6d:	0f 84 9d 00 00 00    	je     b10 <printf+0x1a0>
+        while(*s != 0){
+ a73:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a76:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a78:	84 c0                	test   %al,%al
+ a7a:	0f 84 3d ff ff ff    	je     9bd <printf+0x4d>
+ a80:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a83:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a86:	89 de                	mov    %ebx,%esi
+ a88:	89 d3                	mov    %edx,%ebx
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a90:	83 ec 04             	sub    $0x4,%esp
+ a93:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a96:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	53                   	push   %ebx
+ a9c:	57                   	push   %edi
+ a9d:	e8 47 fb ff ff       	call   5e9 <write>
+        while(*s != 0){
+ aa2:	0f b6 06             	movzbl (%esi),%eax
+ aa5:	83 c4 10             	add    $0x10,%esp
+ aa8:	84 c0                	test   %al,%al
+ aaa:	75 e4                	jne    a90 <printf+0x120>
+      state = 0;
+ aac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ aaf:	31 d2                	xor    %edx,%edx
+ ab1:	e9 07 ff ff ff       	jmp    9bd <printf+0x4d>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ac0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ acb:	8b 13                	mov    (%ebx),%edx
+ acd:	6a 01                	push   $0x1
+ acf:	e9 6b ff ff ff       	jmp    a3f <printf+0xcf>
+ ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ad8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ adb:	83 ec 04             	sub    $0x4,%esp
+ ade:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ae1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ae3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ae6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ae9:	6a 01                	push   $0x1
+ aeb:	52                   	push   %edx
+ aec:	57                   	push   %edi
+ aed:	e8 f7 fa ff ff       	call   5e9 <write>
+        ap++;
+ af2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ af5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ af8:	31 d2                	xor    %edx,%edx
+ afa:	e9 be fe ff ff       	jmp    9bd <printf+0x4d>
+ aff:	90                   	nop
+  write(fd, &c, 1);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b09:	6a 01                	push   $0x1
+ b0b:	e9 11 ff ff ff       	jmp    a21 <printf+0xb1>
+ b10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b15:	bb 38 0d 00 00       	mov    $0xd38,%ebx
+ b1a:	e9 61 ff ff ff       	jmp    a80 <printf+0x110>
+ b1f:	90                   	nop
+
+00000b20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b21:	a1 f0 10 00 00       	mov    0x10f0,%eax
+{
+ b26:	89 e5                	mov    %esp,%ebp
+ b28:	57                   	push   %edi
+ b29:	56                   	push   %esi
+ b2a:	53                   	push   %ebx
+ b2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b2e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b38:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b3a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b3c:	39 ca                	cmp    %ecx,%edx
+ b3e:	73 30                	jae    b70 <free+0x50>
+ b40:	39 c1                	cmp    %eax,%ecx
+ b42:	72 04                	jb     b48 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b44:	39 c2                	cmp    %eax,%edx
+ b46:	72 f0                	jb     b38 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b48:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b4b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b4e:	39 f8                	cmp    %edi,%eax
+ b50:	74 2e                	je     b80 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b52:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b55:	8b 42 04             	mov    0x4(%edx),%eax
+ b58:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b5b:	39 f1                	cmp    %esi,%ecx
+ b5d:	74 38                	je     b97 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b5f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b61:	5b                   	pop    %ebx
+  freep = p;
+ b62:	89 15 f0 10 00 00    	mov    %edx,0x10f0
+}
+ b68:	5e                   	pop    %esi
+ b69:	5f                   	pop    %edi
+ b6a:	5d                   	pop    %ebp
+ b6b:	c3                   	ret
+ b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b70:	39 c1                	cmp    %eax,%ecx
+ b72:	72 d0                	jb     b44 <free+0x24>
+ b74:	eb c2                	jmp    b38 <free+0x18>
+ b76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b80:	03 70 04             	add    0x4(%eax),%esi
+ b83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b86:	8b 02                	mov    (%edx),%eax
+ b88:	8b 00                	mov    (%eax),%eax
+ b8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b8d:	8b 42 04             	mov    0x4(%edx),%eax
+ b90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b93:	39 f1                	cmp    %esi,%ecx
+ b95:	75 c8                	jne    b5f <free+0x3f>
+    p->s.size += bp->s.size;
+ b97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b9a:	89 15 f0 10 00 00    	mov    %edx,0x10f0
+    p->s.size += bp->s.size;
+ ba0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ba3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ba6:	89 0a                	mov    %ecx,(%edx)
+}
+ ba8:	5b                   	pop    %ebx
+ ba9:	5e                   	pop    %esi
+ baa:	5f                   	pop    %edi
+ bab:	5d                   	pop    %ebp
+ bac:	c3                   	ret
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bb0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	57                   	push   %edi
+ bb4:	56                   	push   %esi
+ bb5:	53                   	push   %ebx
+ bb6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bbc:	8b 15 f0 10 00 00    	mov    0x10f0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bc2:	8d 78 07             	lea    0x7(%eax),%edi
+ bc5:	c1 ef 03             	shr    $0x3,%edi
+ bc8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bcb:	85 d2                	test   %edx,%edx
+ bcd:	0f 84 8d 00 00 00    	je     c60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bd3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bd5:	8b 48 04             	mov    0x4(%eax),%ecx
+ bd8:	39 f9                	cmp    %edi,%ecx
+ bda:	73 64                	jae    c40 <malloc+0x90>
+  if(nu < 4096)
+ bdc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ be1:	39 df                	cmp    %ebx,%edi
+ be3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ be6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bed:	eb 0a                	jmp    bf9 <malloc+0x49>
+ bef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bf0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bf2:	8b 48 04             	mov    0x4(%eax),%ecx
+ bf5:	39 f9                	cmp    %edi,%ecx
+ bf7:	73 47                	jae    c40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ bf9:	89 c2                	mov    %eax,%edx
+ bfb:	39 05 f0 10 00 00    	cmp    %eax,0x10f0
+ c01:	75 ed                	jne    bf0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c03:	83 ec 0c             	sub    $0xc,%esp
+ c06:	56                   	push   %esi
+ c07:	e8 15 fb ff ff       	call   721 <sbrk>
+  if(p == (char*)-1)
+ c0c:	83 c4 10             	add    $0x10,%esp
+ c0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c12:	74 1c                	je     c30 <malloc+0x80>
+  hp->s.size = nu;
+ c14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c17:	83 ec 0c             	sub    $0xc,%esp
+ c1a:	83 c0 08             	add    $0x8,%eax
+ c1d:	50                   	push   %eax
+ c1e:	e8 fd fe ff ff       	call   b20 <free>
+  return freep;
+ c23:	8b 15 f0 10 00 00    	mov    0x10f0,%edx
+      if((p = morecore(nunits)) == 0)
+ c29:	83 c4 10             	add    $0x10,%esp
+ c2c:	85 d2                	test   %edx,%edx
+ c2e:	75 c0                	jne    bf0 <malloc+0x40>
+        return 0;
+  }
+}
+ c30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c33:	31 c0                	xor    %eax,%eax
+}
+ c35:	5b                   	pop    %ebx
+ c36:	5e                   	pop    %esi
+ c37:	5f                   	pop    %edi
+ c38:	5d                   	pop    %ebp
+ c39:	c3                   	ret
+ c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c40:	39 cf                	cmp    %ecx,%edi
+ c42:	74 4c                	je     c90 <malloc+0xe0>
+        p->s.size -= nunits;
+ c44:	29 f9                	sub    %edi,%ecx
+ c46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c4f:	89 15 f0 10 00 00    	mov    %edx,0x10f0
+}
+ c55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c58:	83 c0 08             	add    $0x8,%eax
+}
+ c5b:	5b                   	pop    %ebx
+ c5c:	5e                   	pop    %esi
+ c5d:	5f                   	pop    %edi
+ c5e:	5d                   	pop    %ebp
+ c5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c60:	c7 05 f0 10 00 00 f4 	movl   $0x10f4,0x10f0
+ c67:	10 00 00 
+    base.s.size = 0;
+ c6a:	b8 f4 10 00 00       	mov    $0x10f4,%eax
+    base.s.ptr = freep = prevp = &base;
+ c6f:	c7 05 f4 10 00 00 f4 	movl   $0x10f4,0x10f4
+ c76:	10 00 00 
+    base.s.size = 0;
+ c79:	c7 05 f8 10 00 00 00 	movl   $0x0,0x10f8
+ c80:	00 00 00 
+    if(p->s.size >= nunits){
+ c83:	e9 54 ff ff ff       	jmp    bdc <malloc+0x2c>
+ c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c90:	8b 08                	mov    (%eax),%ecx
+ c92:	89 0a                	mov    %ecx,(%edx)
+ c94:	eb b9                	jmp    c4f <malloc+0x9f>
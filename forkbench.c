@@ -0,0 +1,86 @@
+// Fork latency benchmark.
+// Grows itself to each size from 64 KB to 64 MB, touching every
+// page, and reports the mean latency of fork+exit+wait and of
+// fork+exec+exit+wait at that size. The exec'd image is this program
+// with the -x flag, which exits at once.
+//   usage: forkbench [iterations]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define PGSIZE 4096
+
+static char *self;
+
+// Microseconds from a to b.
+static uint
+usecs(struct timespec *a, struct timespec *b)
+{
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+}
+
+// Mean microseconds per fork of this process, with the child
+// exec'ing if doexec is set.
+static uint
+run(int n, int doexec)
+{
+  struct timespec t0, t1;
+  char *argv[3];
+  int i, pid;
+
+  argv[0] = self;
+  argv[1] = "-x";
+  argv[2] = 0;
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for(i = 0; i < n; i++){
+    if((pid = fork()) < 0){
+      printf(2, "forkbench: fork failed\n");
+      exit(1);
+    }
+    if(pid == 0){
+      if(doexec){
+        exec(self, argv);
+        printf(2, "forkbench: exec %s failed\n", self);
+        exit(1);
+      }
+      exit(0);
+    }
+    wait();
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  return usecs(&t0, &t1) / n;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, kb;
+  char *p, *top;
+
+  if(argc > 1 && strcmp(argv[1], "-x") == 0)
+    exit(0);
+  self = argv[0];
+  n = argc > 1 ? atoi(argv[1]) : 20;
+  if(n <= 0){
+    printf(2, "usage: forkbench [iterations]\n");
+    exit(1);
+  }
+
+  top = sbrk(0);
+  for(kb = 64; kb <= 64 * 1024; kb *= 4){
+    // Grow to kb and make every page real.
+    if(kb * 1024 > (uint)top && sbrk(kb * 1024 - (uint)top) == (char*)-1){
+      printf(2, "forkbench: sbrk %d KB failed\n", kb);
+      exit(1);
+    }
+    for(p = top; p < (char*)(kb * 1024); p += PGSIZE)
+      *p = 1;
+    top = sbrk(0);
+
+    printf(1, "forkbench %d KB fork %d us fork+exec %d us\n",
+           kb, run(n, 0), run(n, 1));
+  }
+  exit(0);
+}
@@ -0,0 +1,1056 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  forktest();
+  11:	e8 3a 00 00 00       	call   50 <forktest>
+  exit(0);
+  16:	83 ec 0c             	sub    $0xc,%esp
+  19:	6a 00                	push   $0x0
+  1b:	e8 61 04 00 00       	call   481 <exit>
+
+00000020 <printf>:
+{
+  20:	55                   	push   %ebp
+  21:	89 e5                	mov    %esp,%ebp
+  23:	53                   	push   %ebx
+  24:	83 ec 10             	sub    $0x10,%esp
+  27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  2a:	53                   	push   %ebx
+  2b:	e8 b0 01 00 00       	call   1e0 <strlen>
+  30:	83 c4 0c             	add    $0xc,%esp
+  33:	50                   	push   %eax
+  34:	53                   	push   %ebx
+  35:	ff 75 08             	push   0x8(%ebp)
+  38:	e8 ac 04 00 00       	call   4e9 <write>
+}
+  3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	c9                   	leave
+  44:	c3                   	ret
+  45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000050 <forktest>:
+{
+  50:	55                   	push   %ebp
+  51:	89 e5                	mov    %esp,%ebp
+  53:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+  54:	31 db                	xor    %ebx,%ebx
+{
+  56:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+  59:	68 cc 07 00 00       	push   $0x7cc
+  5e:	e8 7d 01 00 00       	call   1e0 <strlen>
+  63:	83 c4 0c             	add    $0xc,%esp
+  66:	50                   	push   %eax
+  67:	68 cc 07 00 00       	push   $0x7cc
+  6c:	6a 01                	push   $0x1
+  6e:	e8 76 04 00 00       	call   4e9 <write>
+  73:	83 c4 10             	add    $0x10,%esp
+  76:	eb 19                	jmp    91 <forktest+0x41>
+  78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  7f:	90                   	nop
+    if(pid == 0)
+  80:	74 5b                	je     dd <forktest+0x8d>
+  for(n=0; n<N; n++){
+  82:	83 c3 01             	add    $0x1,%ebx
+  85:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  8b:	0f 84 99 00 00 00    	je     12a <forktest+0xda>
+    pid = fork();
+  91:	e8 d1 03 00 00       	call   467 <fork>
+    if(pid < 0)
+  96:	85 c0                	test   %eax,%eax
+  98:	79 e6                	jns    80 <forktest+0x30>
+  for(; n > 0; n--){
+  9a:	85 db                	test   %ebx,%ebx
+  9c:	74 10                	je     ae <forktest+0x5e>
+  9e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+  a0:	e8 f6 03 00 00       	call   49b <wait>
+  a5:	85 c0                	test   %eax,%eax
+  a7:	78 3e                	js     e7 <forktest+0x97>
+  for(; n > 0; n--){
+  a9:	83 eb 01             	sub    $0x1,%ebx
+  ac:	75 f2                	jne    a0 <forktest+0x50>
+  if(wait() != -1){
+  ae:	e8 e8 03 00 00       	call   49b <wait>
+  b3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  b6:	75 58                	jne    110 <forktest+0xc0>
+  write(fd, s, strlen(s));
+  b8:	83 ec 0c             	sub    $0xc,%esp
+  bb:	68 fe 07 00 00       	push   $0x7fe
+  c0:	e8 1b 01 00 00       	call   1e0 <strlen>
+  c5:	83 c4 0c             	add    $0xc,%esp
+  c8:	50                   	push   %eax
+  c9:	68 fe 07 00 00       	push   $0x7fe
+  ce:	6a 01                	push   $0x1
+  d0:	e8 14 04 00 00       	call   4e9 <write>
+}
+  d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d8:	83 c4 10             	add    $0x10,%esp
+  db:	c9                   	leave
+  dc:	c3                   	ret
+      exit(0);
+  dd:	83 ec 0c             	sub    $0xc,%esp
+  e0:	6a 00                	push   $0x0
+  e2:	e8 9a 03 00 00       	call   481 <exit>
+  write(fd, s, strlen(s));
+  e7:	83 ec 0c             	sub    $0xc,%esp
+  ea:	68 d7 07 00 00       	push   $0x7d7
+  ef:	e8 ec 00 00 00       	call   1e0 <strlen>
+  f4:	83 c4 0c             	add    $0xc,%esp
+  f7:	50                   	push   %eax
+  f8:	68 d7 07 00 00       	push   $0x7d7
+  fd:	6a 01                	push   $0x1
+  ff:	e8 e5 03 00 00       	call   4e9 <write>
+      exit(1);
+ 104:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 10b:	e8 71 03 00 00       	call   481 <exit>
+    printf(1, "wait got too many\n");
+ 110:	50                   	push   %eax
+ 111:	50                   	push   %eax
+ 112:	68 eb 07 00 00       	push   $0x7eb
+ 117:	6a 01                	push   $0x1
+ 119:	e8 02 ff ff ff       	call   20 <printf>
+    exit(1);
+ 11e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 125:	e8 57 03 00 00       	call   481 <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 12a:	52                   	push   %edx
+ 12b:	68 e8 03 00 00       	push   $0x3e8
+ 130:	68 0c 08 00 00       	push   $0x80c
+ 135:	6a 01                	push   $0x1
+ 137:	e8 e4 fe ff ff       	call   20 <printf>
+    exit(1);
+ 13c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 143:	e8 39 03 00 00       	call   481 <exit>
+ 148:	66 90                	xchg   %ax,%ax
+ 14a:	66 90                	xchg   %ax,%ax
+ 14c:	66 90                	xchg   %ax,%ax
+ 14e:	66 90                	xchg   %ax,%ax
+
+00000150 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 150:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 151:	31 c0                	xor    %eax,%eax
+{
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	53                   	push   %ebx
+ 156:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 159:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 160:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 164:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 167:	83 c0 01             	add    $0x1,%eax
+ 16a:	84 d2                	test   %dl,%dl
+ 16c:	75 f2                	jne    160 <strcpy+0x10>
+    ;
+  return os;
+}
+ 16e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 171:	89 c8                	mov    %ecx,%eax
+ 173:	c9                   	leave
+ 174:	c3                   	ret
+ 175:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	53                   	push   %ebx
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+ 187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 18a:	0f b6 02             	movzbl (%edx),%eax
+ 18d:	84 c0                	test   %al,%al
+ 18f:	75 17                	jne    1a8 <strcmp+0x28>
+ 191:	eb 3a                	jmp    1cd <strcmp+0x4d>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+ 198:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 19c:	83 c2 01             	add    $0x1,%edx
+ 19f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1a2:	84 c0                	test   %al,%al
+ 1a4:	74 1a                	je     1c0 <strcmp+0x40>
+    p++, q++;
+ 1a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1ab:	38 c3                	cmp    %al,%bl
+ 1ad:	74 e9                	je     198 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1af:	29 d8                	sub    %ebx,%eax
+}
+ 1b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b4:	c9                   	leave
+ 1b5:	c3                   	ret
+ 1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1c4:	31 c0                	xor    %eax,%eax
+ 1c6:	29 d8                	sub    %ebx,%eax
+}
+ 1c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1cb:	c9                   	leave
+ 1cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1d0:	31 c0                	xor    %eax,%eax
+ 1d2:	eb db                	jmp    1af <strcmp+0x2f>
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1e9:	74 15                	je     200 <strlen+0x20>
+ 1eb:	31 c0                	xor    %eax,%eax
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 1f0:	83 c0 01             	add    $0x1,%eax
+ 1f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1f7:	89 c1                	mov    %eax,%ecx
+ 1f9:	75 f5                	jne    1f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1fb:	89 c8                	mov    %ecx,%eax
+ 1fd:	5d                   	pop    %ebp
+ 1fe:	c3                   	ret
+ 1ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 200:	31 c9                	xor    %ecx,%ecx
+}
+ 202:	5d                   	pop    %ebp
+ 203:	89 c8                	mov    %ecx,%eax
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 217:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 21a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 21d:	89 d7                	mov    %edx,%edi
+ 21f:	fc                   	cld
+ 220:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 222:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 225:	89 d0                	mov    %edx,%eax
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 45 08             	mov    0x8(%ebp),%eax
+ 236:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 23a:	0f b6 10             	movzbl (%eax),%edx
+ 23d:	84 d2                	test   %dl,%dl
+ 23f:	75 12                	jne    253 <strchr+0x23>
+ 241:	eb 1d                	jmp    260 <strchr+0x30>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 24c:	83 c0 01             	add    $0x1,%eax
+ 24f:	84 d2                	test   %dl,%dl
+ 251:	74 0d                	je     260 <strchr+0x30>
+    if(*s == c)
+ 253:	38 d1                	cmp    %dl,%cl
+ 255:	75 f1                	jne    248 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 257:	5d                   	pop    %ebp
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 260:	31 c0                	xor    %eax,%eax
+}
+ 262:	5d                   	pop    %ebp
+ 263:	c3                   	ret
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 275:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 278:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 279:	31 db                	xor    %ebx,%ebx
+{
+ 27b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 27e:	eb 27                	jmp    2a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 280:	83 ec 04             	sub    $0x4,%esp
+ 283:	6a 01                	push   $0x1
+ 285:	56                   	push   %esi
+ 286:	6a 00                	push   $0x0
+ 288:	e8 42 02 00 00       	call   4cf <read>
+    if(cc < 1)
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	85 c0                	test   %eax,%eax
+ 292:	7e 1d                	jle    2b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 294:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 29f:	3c 0a                	cmp    $0xa,%al
+ 2a1:	74 10                	je     2b3 <gets+0x43>
+ 2a3:	3c 0d                	cmp    $0xd,%al
+ 2a5:	74 0c                	je     2b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2a7:	89 df                	mov    %ebx,%edi
+ 2a9:	83 c3 01             	add    $0x1,%ebx
+ 2ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2af:	7c cf                	jl     280 <gets+0x10>
+ 2b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2bd:	5b                   	pop    %ebx
+ 2be:	5e                   	pop    %esi
+ 2bf:	5f                   	pop    %edi
+ 2c0:	5d                   	pop    %ebp
+ 2c1:	c3                   	ret
+ 2c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	56                   	push   %esi
+ 2d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d5:	83 ec 08             	sub    $0x8,%esp
+ 2d8:	6a 00                	push   $0x0
+ 2da:	ff 75 08             	push   0x8(%ebp)
+ 2dd:	e8 6f 02 00 00       	call   551 <open>
+  if(fd < 0)
+ 2e2:	83 c4 10             	add    $0x10,%esp
+ 2e5:	85 c0                	test   %eax,%eax
+ 2e7:	78 27                	js     310 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2e9:	83 ec 08             	sub    $0x8,%esp
+ 2ec:	ff 75 0c             	push   0xc(%ebp)
+ 2ef:	89 c3                	mov    %eax,%ebx
+ 2f1:	50                   	push   %eax
+ 2f2:	e8 a8 02 00 00       	call   59f <fstat>
+  close(fd);
+ 2f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2fc:	e8 02 02 00 00       	call   503 <close>
+  return r;
+ 301:	83 c4 10             	add    $0x10,%esp
+}
+ 304:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 307:	89 f0                	mov    %esi,%eax
+ 309:	5b                   	pop    %ebx
+ 30a:	5e                   	pop    %esi
+ 30b:	5d                   	pop    %ebp
+ 30c:	c3                   	ret
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 315:	eb ed                	jmp    304 <stat+0x34>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+
+00000320 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 327:	0f be 02             	movsbl (%edx),%eax
+ 32a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 32d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 330:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 335:	77 1e                	ja     355 <atoi+0x35>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 340:	83 c2 01             	add    $0x1,%edx
+ 343:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 346:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 34a:	0f be 02             	movsbl (%edx),%eax
+ 34d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 350:	80 fb 09             	cmp    $0x9,%bl
+ 353:	76 eb                	jbe    340 <atoi+0x20>
+  return n;
+}
+ 355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 358:	89 c8                	mov    %ecx,%eax
+ 35a:	c9                   	leave
+ 35b:	c3                   	ret
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+ 365:	8b 45 10             	mov    0x10(%ebp),%eax
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 36e:	85 c0                	test   %eax,%eax
+ 370:	7e 13                	jle    385 <memmove+0x25>
+ 372:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 374:	89 d7                	mov    %edx,%edi
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 380:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 381:	39 f8                	cmp    %edi,%eax
+ 383:	75 fb                	jne    380 <memmove+0x20>
+  return vdst;
+}
+ 385:	5e                   	pop    %esi
+ 386:	89 d0                	mov    %edx,%eax
+ 388:	5f                   	pop    %edi
+ 389:	5d                   	pop    %ebp
+ 38a:	c3                   	ret
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 396:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 399:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 3a0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 3a3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 3a6:	50                   	push   %eax
+ 3a7:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 3aa:	50                   	push   %eax
+ 3ab:	6a 00                	push   $0x0
+ 3ad:	e8 8d 03 00 00       	call   73f <setitimer>
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	89 c2                	mov    %eax,%edx
+ 3b7:	31 c0                	xor    %eax,%eax
+ 3b9:	85 d2                	test   %edx,%edx
+ 3bb:	78 03                	js     3c0 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 3bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 3c0:	c9                   	leave
+ 3c1:	c3                   	ret
+ 3c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 3d0:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 3d5:	c3                   	ret
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003e0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 3e0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 3e5:	c3                   	ret
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003f0 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	53                   	push   %ebx
+ 3f6:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 3f9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 3fd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 400:	75 5e                	jne    460 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 402:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 408:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 40a:	89 d3                	mov    %edx,%ebx
+ 40c:	89 c1                	mov    %eax,%ecx
+ 40e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 414:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 41a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 41d:	31 d2                	xor    %edx,%edx
+ 41f:	89 d8                	mov    %ebx,%eax
+ 421:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 424:	f7 f6                	div    %esi
+ 426:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 428:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 42b:	f7 f6                	div    %esi
+ 42d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 42f:	89 da                	mov    %ebx,%edx
+ 431:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 436:	f7 f3                	div    %ebx
+ 438:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 43a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 43f:	89 d3                	mov    %edx,%ebx
+ 441:	f7 e1                	mul    %ecx
+ 443:	f7 f6                	div    %esi
+ 445:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 44b:	01 c3                	add    %eax,%ebx
+  return 0;
+ 44d:	31 c0                	xor    %eax,%eax
+ 44f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 452:	83 c4 0c             	add    $0xc,%esp
+ 455:	5b                   	pop    %ebx
+ 456:	5e                   	pop    %esi
+ 457:	5f                   	pop    %edi
+ 458:	5d                   	pop    %ebp
+ 459:	c3                   	ret
+ 45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 460:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 465:	eb eb                	jmp    452 <clock_gettime+0x62>
+
+00000467 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 467:	b8 01 00 00 00       	mov    $0x1,%eax
+ 46c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 473:	74 09                	je     47e <fork+0x17>
+ 475:	89 e1                	mov    %esp,%ecx
+ 477:	ba 80 04 00 00       	mov    $0x480,%edx
+ 47c:	0f 34                	sysenter
+ 47e:	cd 40                	int    $0x40
+ 480:	c3                   	ret
+
+00000481 <exit>:
+SYSCALL(exit)
+ 481:	b8 02 00 00 00       	mov    $0x2,%eax
+ 486:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 48d:	74 09                	je     498 <exit+0x17>
+ 48f:	89 e1                	mov    %esp,%ecx
+ 491:	ba 9a 04 00 00       	mov    $0x49a,%edx
+ 496:	0f 34                	sysenter
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <wait>:
+SYSCALL(wait)
+ 49b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4a0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4a7:	74 09                	je     4b2 <wait+0x17>
+ 4a9:	89 e1                	mov    %esp,%ecx
+ 4ab:	ba b4 04 00 00       	mov    $0x4b4,%edx
+ 4b0:	0f 34                	sysenter
+ 4b2:	cd 40                	int    $0x40
+ 4b4:	c3                   	ret
+
+000004b5 <pipe>:
+SYSCALL(pipe)
+ 4b5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4ba:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4c1:	74 09                	je     4cc <pipe+0x17>
+ 4c3:	89 e1                	mov    %esp,%ecx
+ 4c5:	ba ce 04 00 00       	mov    $0x4ce,%edx
+ 4ca:	0f 34                	sysenter
+ 4cc:	cd 40                	int    $0x40
+ 4ce:	c3                   	ret
+
+000004cf <read>:
+SYSCALL(read)
+ 4cf:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4d4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4db:	74 09                	je     4e6 <read+0x17>
+ 4dd:	89 e1                	mov    %esp,%ecx
+ 4df:	ba e8 04 00 00       	mov    $0x4e8,%edx
+ 4e4:	0f 34                	sysenter
+ 4e6:	cd 40                	int    $0x40
+ 4e8:	c3                   	ret
+
+000004e9 <write>:
+SYSCALL(write)
+ 4e9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ee:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4f5:	74 09                	je     500 <write+0x17>
+ 4f7:	89 e1                	mov    %esp,%ecx
+ 4f9:	ba 02 05 00 00       	mov    $0x502,%edx
+ 4fe:	0f 34                	sysenter
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <close>:
+SYSCALL(close)
+ 503:	b8 15 00 00 00       	mov    $0x15,%eax
+ 508:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 50f:	74 09                	je     51a <close+0x17>
+ 511:	89 e1                	mov    %esp,%ecx
+ 513:	ba 1c 05 00 00       	mov    $0x51c,%edx
+ 518:	0f 34                	sysenter
+ 51a:	cd 40                	int    $0x40
+ 51c:	c3                   	ret
+
+0000051d <kill>:
+SYSCALL(kill)
+ 51d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 522:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 529:	74 09                	je     534 <kill+0x17>
+ 52b:	89 e1                	mov    %esp,%ecx
+ 52d:	ba 36 05 00 00       	mov    $0x536,%edx
+ 532:	0f 34                	sysenter
+ 534:	cd 40                	int    $0x40
+ 536:	c3                   	ret
+
+00000537 <exec>:
+SYSCALL(exec)
+ 537:	b8 07 00 00 00       	mov    $0x7,%eax
+ 53c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 543:	74 09                	je     54e <exec+0x17>
+ 545:	89 e1                	mov    %esp,%ecx
+ 547:	ba 50 05 00 00       	mov    $0x550,%edx
+ 54c:	0f 34                	sysenter
+ 54e:	cd 40                	int    $0x40
+ 550:	c3                   	ret
+
+00000551 <open>:
+SYSCALL(open)
+ 551:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 556:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 55d:	74 09                	je     568 <open+0x17>
+ 55f:	89 e1                	mov    %esp,%ecx
+ 561:	ba 6a 05 00 00       	mov    $0x56a,%edx
+ 566:	0f 34                	sysenter
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <mknod>:
+SYSCALL(mknod)
+ 56b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 570:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 577:	74 09                	je     582 <mknod+0x17>
+ 579:	89 e1                	mov    %esp,%ecx
+ 57b:	ba 84 05 00 00       	mov    $0x584,%edx
+ 580:	0f 34                	sysenter
+ 582:	cd 40                	int    $0x40
+ 584:	c3                   	ret
+
+00000585 <unlink>:
+SYSCALL(unlink)
+ 585:	b8 12 00 00 00       	mov    $0x12,%eax
+ 58a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 591:	74 09                	je     59c <unlink+0x17>
+ 593:	89 e1                	mov    %esp,%ecx
+ 595:	ba 9e 05 00 00       	mov    $0x59e,%edx
+ 59a:	0f 34                	sysenter
+ 59c:	cd 40                	int    $0x40
+ 59e:	c3                   	ret
+
+0000059f <fstat>:
+SYSCALL(fstat)
+ 59f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5a4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5ab:	74 09                	je     5b6 <fstat+0x17>
+ 5ad:	89 e1                	mov    %esp,%ecx
+ 5af:	ba b8 05 00 00       	mov    $0x5b8,%edx
+ 5b4:	0f 34                	sysenter
+ 5b6:	cd 40                	int    $0x40
+ 5b8:	c3                   	ret
+
+000005b9 <link>:
+SYSCALL(link)
+ 5b9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5be:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5c5:	74 09                	je     5d0 <link+0x17>
+ 5c7:	89 e1                	mov    %esp,%ecx
+ 5c9:	ba d2 05 00 00       	mov    $0x5d2,%edx
+ 5ce:	0f 34                	sysenter
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <mkdir>:
+SYSCALL(mkdir)
+ 5d3:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5d8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5df:	74 09                	je     5ea <mkdir+0x17>
+ 5e1:	89 e1                	mov    %esp,%ecx
+ 5e3:	ba ec 05 00 00       	mov    $0x5ec,%edx
+ 5e8:	0f 34                	sysenter
+ 5ea:	cd 40                	int    $0x40
+ 5ec:	c3                   	ret
+
+000005ed <chdir>:
+SYSCALL(chdir)
+ 5ed:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5f2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5f9:	74 09                	je     604 <chdir+0x17>
+ 5fb:	89 e1                	mov    %esp,%ecx
+ 5fd:	ba 06 06 00 00       	mov    $0x606,%edx
+ 602:	0f 34                	sysenter
+ 604:	cd 40                	int    $0x40
+ 606:	c3                   	ret
+
+00000607 <dup>:
+SYSCALL(dup)
+ 607:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 60c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 613:	74 09                	je     61e <dup+0x17>
+ 615:	89 e1                	mov    %esp,%ecx
+ 617:	ba 20 06 00 00       	mov    $0x620,%edx
+ 61c:	0f 34                	sysenter
+ 61e:	cd 40                	int    $0x40
+ 620:	c3                   	ret
+
+00000621 <sbrk>:
+SYSCALL(sbrk)
+ 621:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 626:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 62d:	74 09                	je     638 <sbrk+0x17>
+ 62f:	89 e1                	mov    %esp,%ecx
+ 631:	ba 3a 06 00 00       	mov    $0x63a,%edx
+ 636:	0f 34                	sysenter
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <sleep>:
+SYSCALL(sleep)
+ 63b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 640:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 647:	74 09                	je     652 <sleep+0x17>
+ 649:	89 e1                	mov    %esp,%ecx
+ 64b:	ba 54 06 00 00       	mov    $0x654,%edx
+ 650:	0f 34                	sysenter
+ 652:	cd 40                	int    $0x40
+ 654:	c3                   	ret
+
+00000655 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 655:	b8 16 00 00 00       	mov    $0x16,%eax
+ 65a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 661:	74 09                	je     66c <sigprocmask+0x17>
+ 663:	89 e1                	mov    %esp,%ecx
+ 665:	ba 6e 06 00 00       	mov    $0x66e,%edx
+ 66a:	0f 34                	sysenter
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <sigaction>:
+SYSCALL(sigaction)
+ 66f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 674:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 67b:	74 09                	je     686 <sigaction+0x17>
+ 67d:	89 e1                	mov    %esp,%ecx
+ 67f:	ba 88 06 00 00       	mov    $0x688,%edx
+ 684:	0f 34                	sysenter
+ 686:	cd 40                	int    $0x40
+ 688:	c3                   	ret
+
+00000689 <sigret>:
+SYSCALL(sigret)
+ 689:	b8 18 00 00 00       	mov    $0x18,%eax
+ 68e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 695:	74 09                	je     6a0 <sigret+0x17>
+ 697:	89 e1                	mov    %esp,%ecx
+ 699:	ba a2 06 00 00       	mov    $0x6a2,%edx
+ 69e:	0f 34                	sysenter
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <traceread>:
+SYSCALL(traceread)
+ 6a3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6a8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6af:	74 09                	je     6ba <traceread+0x17>
+ 6b1:	89 e1                	mov    %esp,%ecx
+ 6b3:	ba bc 06 00 00       	mov    $0x6bc,%edx
+ 6b8:	0f 34                	sysenter
+ 6ba:	cd 40                	int    $0x40
+ 6bc:	c3                   	ret
+
+000006bd <sigqueue>:
+SYSCALL(sigqueue)
+ 6bd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6c2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6c9:	74 09                	je     6d4 <sigqueue+0x17>
+ 6cb:	89 e1                	mov    %esp,%ecx
+ 6cd:	ba d6 06 00 00       	mov    $0x6d6,%edx
+ 6d2:	0f 34                	sysenter
+ 6d4:	cd 40                	int    $0x40
+ 6d6:	c3                   	ret
+
+000006d7 <signalfd>:
+SYSCALL(signalfd)
+ 6d7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6dc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6e3:	74 09                	je     6ee <signalfd+0x17>
+ 6e5:	89 e1                	mov    %esp,%ecx
+ 6e7:	ba f0 06 00 00       	mov    $0x6f0,%edx
+ 6ec:	0f 34                	sysenter
+ 6ee:	cd 40                	int    $0x40
+ 6f0:	c3                   	ret
+
+000006f1 <sigwait>:
+SYSCALL(sigwait)
+ 6f1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6f6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6fd:	74 09                	je     708 <sigwait+0x17>
+ 6ff:	89 e1                	mov    %esp,%ecx
+ 701:	ba 0a 07 00 00       	mov    $0x70a,%edx
+ 706:	0f 34                	sysenter
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <sigsuspend>:
+SYSCALL(sigsuspend)
+ 70b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 710:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 717:	74 09                	je     722 <sigsuspend+0x17>
+ 719:	89 e1                	mov    %esp,%ecx
+ 71b:	ba 24 07 00 00       	mov    $0x724,%edx
+ 720:	0f 34                	sysenter
+ 722:	cd 40                	int    $0x40
+ 724:	c3                   	ret
+
+00000725 <waitpid>:
+SYSCALL(waitpid)
+ 725:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 72a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 731:	74 09                	je     73c <waitpid+0x17>
+ 733:	89 e1                	mov    %esp,%ecx
+ 735:	ba 3e 07 00 00       	mov    $0x73e,%edx
+ 73a:	0f 34                	sysenter
+ 73c:	cd 40                	int    $0x40
+ 73e:	c3                   	ret
+
+0000073f <setitimer>:
+SYSCALL(setitimer)
+ 73f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 744:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 74b:	74 09                	je     756 <setitimer+0x17>
+ 74d:	89 e1                	mov    %esp,%ecx
+ 74f:	ba 58 07 00 00       	mov    $0x758,%edx
+ 754:	0f 34                	sysenter
+ 756:	cd 40                	int    $0x40
+ 758:	c3                   	ret
+
+00000759 <nanosleep>:
+SYSCALL(nanosleep)
+ 759:	b8 21 00 00 00       	mov    $0x21,%eax
+ 75e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 765:	74 09                	je     770 <nanosleep+0x17>
+ 767:	89 e1                	mov    %esp,%ecx
+ 769:	ba 72 07 00 00       	mov    $0x772,%edx
+ 76e:	0f 34                	sysenter
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <mmap>:
+SYSCALL(mmap)
+ 773:	b8 22 00 00 00       	mov    $0x22,%eax
+ 778:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 77f:	74 09                	je     78a <mmap+0x17>
+ 781:	89 e1                	mov    %esp,%ecx
+ 783:	ba 8c 07 00 00       	mov    $0x78c,%edx
+ 788:	0f 34                	sysenter
+ 78a:	cd 40                	int    $0x40
+ 78c:	c3                   	ret
+
+0000078d <munmap>:
+SYSCALL(munmap)
+ 78d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 792:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 799:	74 09                	je     7a4 <munmap+0x17>
+ 79b:	89 e1                	mov    %esp,%ecx
+ 79d:	ba a6 07 00 00       	mov    $0x7a6,%edx
+ 7a2:	0f 34                	sysenter
+ 7a4:	cd 40                	int    $0x40
+ 7a6:	c3                   	ret
+
+000007a7 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 7a7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7ac:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7b3:	74 09                	je     7be <getpid_syscall+0x17>
+ 7b5:	89 e1                	mov    %esp,%ecx
+ 7b7:	ba c0 07 00 00       	mov    $0x7c0,%edx
+ 7bc:	0f 34                	sysenter
+ 7be:	cd 40                	int    $0x40
+ 7c0:	c3                   	ret
+
+000007c1 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 7c1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7c6:	cd 40                	int    $0x40
+ 7c8:	c3                   	ret
@@ -282,6 +282,33 @@ idup(struct inode *ip)
   return ip;
 }
 
+// Increment reference count for ip on behalf of a process
+// running it. pagefault() reads program pages from the inode
+// lazily, so while any process runs it writes are refused
+// (see writei); otherwise the process would end up running a
+// mix of old and new pages. Caller must hold ip->lock or
+// another such reference. Returns ip.
+struct inode*
+iexec(struct inode *ip)
+{
+  acquire(&icache.lock);
+  ip->ref++;
+  ip->nexec++;
+  release(&icache.lock);
+  return ip;
+}
+
+// Drop a reference taken by iexec().
+// All calls to iputexec() must be inside a transaction.
+void
+iputexec(struct inode *ip)
+{
+  acquire(&icache.lock);
+  ip->nexec--;
+  release(&icache.lock);
+  iput(ip);
+}
+
 // Lock the given inode.
 // Reads the inode from disk if necessary.
 void
@@ -432,6 +459,7 @@ itrunc(struct inode *ip)
 
   ip->size = 0;
   iupdate(ip);
+  pcacheinval(ip);
 }
 
 // Copy stat information from inode.
@@ -478,12 +506,16 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
+// Fails while a process is running ip (see iexec).
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
   uint tot, m;
   struct buf *bp;
 
+  if(ip->nexec > 0)
+    return -1;
+
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
       return -1;
@@ -500,6 +532,8 @@ writei(struct inode *ip, char *src, uint off, uint n)
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
     log_write(bp);
+    if(ip->nshared > 0)
+      shupdate(ip, off, (char*)bp->data + off%BSIZE, m);
     brelse(bp);
   }
 
@@ -507,6 +541,8 @@ writei(struct inode *ip, char *src, uint off, uint n)
     ip->size = off;
     iupdate(ip);
   }
+  if(n > 0)
+    pcacheinval(ip);
   return n;
 }
 
@@ -0,0 +1,1954 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 7b                	jle    9c <main+0x9c>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit(1);
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit(0);
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 7f                	jmp    b6 <main+0xb6>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit(1);
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 ae 01 00 00       	call   200 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 09 07 00 00       	call   763 <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 30                	jle    92 <main+0x92>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 43 07 00 00       	call   7b1 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 18 0e 00 00       	push   $0xe18
+  7f:	6a 01                	push   $0x1
+  81:	e8 4a 0a 00 00       	call   ad0 <printf>
+      exit(1);
+  86:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8d:	e8 4f 06 00 00       	call   6e1 <exit>
+  }
+  exit(0);
+  92:	83 ec 0c             	sub    $0xc,%esp
+  95:	6a 00                	push   $0x0
+  97:	e8 45 06 00 00       	call   6e1 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  9c:	53                   	push   %ebx
+  9d:	53                   	push   %ebx
+  9e:	68 f8 0d 00 00       	push   $0xdf8
+  a3:	6a 02                	push   $0x2
+  a5:	e8 26 0a 00 00       	call   ad0 <printf>
+    exit(1);
+  aa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  b1:	e8 2b 06 00 00       	call   6e1 <exit>
+    grep(pattern, 0);
+  b6:	52                   	push   %edx
+  b7:	52                   	push   %edx
+  b8:	6a 00                	push   $0x0
+  ba:	50                   	push   %eax
+  bb:	e8 40 01 00 00       	call   200 <grep>
+    exit(0);
+  c0:	31 c9                	xor    %ecx,%ecx
+  c2:	89 0c 24             	mov    %ecx,(%esp)
+  c5:	e8 17 06 00 00       	call   6e1 <exit>
+  ca:	66 90                	xchg   %ax,%ax
+  cc:	66 90                	xchg   %ax,%ax
+  ce:	66 90                	xchg   %ax,%ax
+
+000000d0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	57                   	push   %edi
+  d4:	56                   	push   %esi
+  d5:	53                   	push   %ebx
+  d6:	83 ec 0c             	sub    $0xc,%esp
+  d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  df:	0f b6 0f             	movzbl (%edi),%ecx
+  e2:	84 c9                	test   %cl,%cl
+  e4:	0f 84 96 00 00 00    	je     180 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  ea:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  ee:	3c 2a                	cmp    $0x2a,%al
+  f0:	74 2d                	je     11f <matchhere+0x4f>
+  f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  f8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  fb:	80 f9 24             	cmp    $0x24,%cl
+  fe:	74 50                	je     150 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 100:	89 f2                	mov    %esi,%edx
+ 102:	84 d2                	test   %dl,%dl
+ 104:	74 6e                	je     174 <matchhere+0xa4>
+ 106:	80 f9 2e             	cmp    $0x2e,%cl
+ 109:	75 65                	jne    170 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+ 10b:	83 c3 01             	add    $0x1,%ebx
+ 10e:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 111:	84 c0                	test   %al,%al
+ 113:	74 6b                	je     180 <matchhere+0xb0>
+ 115:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 117:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 11b:	3c 2a                	cmp    $0x2a,%al
+ 11d:	75 d9                	jne    f8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 11f:	8d 77 02             	lea    0x2(%edi),%esi
+ 122:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 125:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 128:	83 ec 08             	sub    $0x8,%esp
+ 12b:	53                   	push   %ebx
+ 12c:	56                   	push   %esi
+ 12d:	e8 9e ff ff ff       	call   d0 <matchhere>
+ 132:	83 c4 10             	add    $0x10,%esp
+ 135:	85 c0                	test   %eax,%eax
+ 137:	75 47                	jne    180 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 139:	0f be 13             	movsbl (%ebx),%edx
+ 13c:	84 d2                	test   %dl,%dl
+ 13e:	74 45                	je     185 <matchhere+0xb5>
+ 140:	83 c3 01             	add    $0x1,%ebx
+ 143:	39 fa                	cmp    %edi,%edx
+ 145:	74 e1                	je     128 <matchhere+0x58>
+ 147:	83 ff 2e             	cmp    $0x2e,%edi
+ 14a:	74 dc                	je     128 <matchhere+0x58>
+ 14c:	eb 37                	jmp    185 <matchhere+0xb5>
+ 14e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 150:	84 c0                	test   %al,%al
+ 152:	74 39                	je     18d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 154:	89 f2                	mov    %esi,%edx
+ 156:	84 d2                	test   %dl,%dl
+ 158:	74 1a                	je     174 <matchhere+0xa4>
+ 15a:	80 fa 24             	cmp    $0x24,%dl
+ 15d:	75 15                	jne    174 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 15f:	83 c3 01             	add    $0x1,%ebx
+ 162:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 165:	89 c1                	mov    %eax,%ecx
+ 167:	eb ae                	jmp    117 <matchhere+0x47>
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 170:	38 ca                	cmp    %cl,%dl
+ 172:	74 97                	je     10b <matchhere+0x3b>
+}
+ 174:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 177:	31 c0                	xor    %eax,%eax
+}
+ 179:	5b                   	pop    %ebx
+ 17a:	5e                   	pop    %esi
+ 17b:	5f                   	pop    %edi
+ 17c:	5d                   	pop    %ebp
+ 17d:	c3                   	ret
+ 17e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 180:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 185:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 188:	5b                   	pop    %ebx
+ 189:	5e                   	pop    %esi
+ 18a:	5f                   	pop    %edi
+ 18b:	5d                   	pop    %ebp
+ 18c:	c3                   	ret
+    return *text == '\0';
+ 18d:	89 f0                	mov    %esi,%eax
+ 18f:	84 c0                	test   %al,%al
+ 191:	0f 94 c0             	sete   %al
+ 194:	0f b6 c0             	movzbl %al,%eax
+ 197:	eb ec                	jmp    185 <matchhere+0xb5>
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <match>:
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	56                   	push   %esi
+ 1a4:	53                   	push   %ebx
+ 1a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 1ab:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 1ae:	75 11                	jne    1c1 <match+0x21>
+ 1b0:	eb 2e                	jmp    1e0 <match+0x40>
+ 1b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1b8:	83 c6 01             	add    $0x1,%esi
+ 1bb:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1bf:	74 16                	je     1d7 <match+0x37>
+    if(matchhere(re, text))
+ 1c1:	83 ec 08             	sub    $0x8,%esp
+ 1c4:	56                   	push   %esi
+ 1c5:	53                   	push   %ebx
+ 1c6:	e8 05 ff ff ff       	call   d0 <matchhere>
+ 1cb:	83 c4 10             	add    $0x10,%esp
+ 1ce:	85 c0                	test   %eax,%eax
+ 1d0:	74 e6                	je     1b8 <match+0x18>
+      return 1;
+ 1d2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1da:	5b                   	pop    %ebx
+ 1db:	5e                   	pop    %esi
+ 1dc:	5d                   	pop    %ebp
+ 1dd:	c3                   	ret
+ 1de:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1e0:	83 c3 01             	add    $0x1,%ebx
+ 1e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1ec:	e9 df fe ff ff       	jmp    d0 <matchhere>
+ 1f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+
+00000200 <grep>:
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+  m = 0;
+ 204:	31 ff                	xor    %edi,%edi
+{
+ 206:	56                   	push   %esi
+ 207:	53                   	push   %ebx
+ 208:	83 ec 1c             	sub    $0x1c,%esp
+ 20b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 20e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 211:	8d 43 01             	lea    0x1(%ebx),%eax
+ 214:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 220:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 223:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	29 c8                	sub    %ecx,%eax
+ 22d:	50                   	push   %eax
+ 22e:	8d 81 a0 12 00 00    	lea    0x12a0(%ecx),%eax
+ 234:	50                   	push   %eax
+ 235:	ff 75 0c             	push   0xc(%ebp)
+ 238:	e8 f2 04 00 00       	call   72f <read>
+ 23d:	83 c4 10             	add    $0x10,%esp
+ 240:	85 c0                	test   %eax,%eax
+ 242:	0f 8e fd 00 00 00    	jle    345 <grep+0x145>
+    m += n;
+ 248:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 24b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 24e:	bf a0 12 00 00       	mov    $0x12a0,%edi
+ 253:	89 de                	mov    %ebx,%esi
+ 255:	c6 81 a0 12 00 00 00 	movb   $0x0,0x12a0(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 260:	83 ec 08             	sub    $0x8,%esp
+ 263:	6a 0a                	push   $0xa
+ 265:	57                   	push   %edi
+ 266:	e8 25 02 00 00       	call   490 <strchr>
+ 26b:	83 c4 10             	add    $0x10,%esp
+ 26e:	89 c2                	mov    %eax,%edx
+ 270:	85 c0                	test   %eax,%eax
+ 272:	0f 84 88 00 00 00    	je     300 <grep+0x100>
+      *q = 0;
+ 278:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 27b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 27e:	74 58                	je     2d8 <grep+0xd8>
+ 280:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 283:	89 d3                	mov    %edx,%ebx
+ 285:	eb 12                	jmp    299 <grep+0x99>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 290:	83 c7 01             	add    $0x1,%edi
+ 293:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 297:	74 37                	je     2d0 <grep+0xd0>
+    if(matchhere(re, text))
+ 299:	83 ec 08             	sub    $0x8,%esp
+ 29c:	57                   	push   %edi
+ 29d:	56                   	push   %esi
+ 29e:	e8 2d fe ff ff       	call   d0 <matchhere>
+ 2a3:	83 c4 10             	add    $0x10,%esp
+ 2a6:	85 c0                	test   %eax,%eax
+ 2a8:	74 e6                	je     290 <grep+0x90>
+        write(1, p, q+1 - p);
+ 2aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2ad:	89 da                	mov    %ebx,%edx
+ 2af:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2b2:	89 d8                	mov    %ebx,%eax
+ 2b4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2b7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2ba:	29 f8                	sub    %edi,%eax
+ 2bc:	50                   	push   %eax
+ 2bd:	57                   	push   %edi
+ 2be:	89 df                	mov    %ebx,%edi
+ 2c0:	6a 01                	push   $0x1
+ 2c2:	e8 82 04 00 00       	call   749 <write>
+ 2c7:	83 c4 10             	add    $0x10,%esp
+ 2ca:	eb 94                	jmp    260 <grep+0x60>
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2d3:	eb 8b                	jmp    260 <grep+0x60>
+ 2d5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2d8:	83 ec 08             	sub    $0x8,%esp
+ 2db:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2de:	57                   	push   %edi
+ 2df:	ff 75 dc             	push   -0x24(%ebp)
+ 2e2:	e8 e9 fd ff ff       	call   d0 <matchhere>
+        write(1, p, q+1 - p);
+ 2e7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2ea:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2ed:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2f0:	85 c0                	test   %eax,%eax
+ 2f2:	75 be                	jne    2b2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2f4:	89 df                	mov    %ebx,%edi
+ 2f6:	e9 65 ff ff ff       	jmp    260 <grep+0x60>
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+    if(p == buf)
+ 300:	89 f3                	mov    %esi,%ebx
+ 302:	81 ff a0 12 00 00    	cmp    $0x12a0,%edi
+ 308:	74 2f                	je     339 <grep+0x139>
+    if(m > 0){
+ 30a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 30d:	85 c0                	test   %eax,%eax
+ 30f:	0f 8e 0b ff ff ff    	jle    220 <grep+0x20>
+      m -= p - buf;
+ 315:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 317:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 31a:	2d a0 12 00 00       	sub    $0x12a0,%eax
+ 31f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 322:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 325:	51                   	push   %ecx
+ 326:	57                   	push   %edi
+ 327:	68 a0 12 00 00       	push   $0x12a0
+ 32c:	e8 8f 02 00 00       	call   5c0 <memmove>
+ 331:	83 c4 10             	add    $0x10,%esp
+ 334:	e9 e7 fe ff ff       	jmp    220 <grep+0x20>
+      m = 0;
+ 339:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 340:	e9 db fe ff ff       	jmp    220 <grep+0x20>
+}
+ 345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 348:	5b                   	pop    %ebx
+ 349:	5e                   	pop    %esi
+ 34a:	5f                   	pop    %edi
+ 34b:	5d                   	pop    %ebp
+ 34c:	c3                   	ret
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <matchstar>:
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	53                   	push   %ebx
+ 356:	83 ec 0c             	sub    $0xc,%esp
+ 359:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 35c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 35f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 362:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 368:	83 ec 08             	sub    $0x8,%esp
+ 36b:	57                   	push   %edi
+ 36c:	56                   	push   %esi
+ 36d:	e8 5e fd ff ff       	call   d0 <matchhere>
+ 372:	83 c4 10             	add    $0x10,%esp
+ 375:	85 c0                	test   %eax,%eax
+ 377:	75 1f                	jne    398 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 379:	0f be 17             	movsbl (%edi),%edx
+ 37c:	84 d2                	test   %dl,%dl
+ 37e:	74 0c                	je     38c <matchstar+0x3c>
+ 380:	83 c7 01             	add    $0x1,%edi
+ 383:	39 da                	cmp    %ebx,%edx
+ 385:	74 e1                	je     368 <matchstar+0x18>
+ 387:	83 fb 2e             	cmp    $0x2e,%ebx
+ 38a:	74 dc                	je     368 <matchstar+0x18>
+}
+ 38c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 38f:	5b                   	pop    %ebx
+ 390:	5e                   	pop    %esi
+ 391:	5f                   	pop    %edi
+ 392:	5d                   	pop    %ebp
+ 393:	c3                   	ret
+ 394:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 398:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 39b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 3a0:	5b                   	pop    %ebx
+ 3a1:	5e                   	pop    %esi
+ 3a2:	5f                   	pop    %edi
+ 3a3:	5d                   	pop    %ebp
+ 3a4:	c3                   	ret
+ 3a5:	66 90                	xchg   %ax,%ax
+ 3a7:	66 90                	xchg   %ax,%ax
+ 3a9:	66 90                	xchg   %ax,%ax
+ 3ab:	66 90                	xchg   %ax,%ax
+ 3ad:	66 90                	xchg   %ax,%ax
+ 3af:	90                   	nop
+
+000003b0 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3b1:	31 c0                	xor    %eax,%eax
+{
+ 3b3:	89 e5                	mov    %esp,%ebp
+ 3b5:	53                   	push   %ebx
+ 3b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3c7:	83 c0 01             	add    $0x1,%eax
+ 3ca:	84 d2                	test   %dl,%dl
+ 3cc:	75 f2                	jne    3c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d1:	89 c8                	mov    %ecx,%eax
+ 3d3:	c9                   	leave
+ 3d4:	c3                   	ret
+ 3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3ea:	0f b6 02             	movzbl (%edx),%eax
+ 3ed:	84 c0                	test   %al,%al
+ 3ef:	75 17                	jne    408 <strcmp+0x28>
+ 3f1:	eb 3a                	jmp    42d <strcmp+0x4d>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+ 3f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3fc:	83 c2 01             	add    $0x1,%edx
+ 3ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 402:	84 c0                	test   %al,%al
+ 404:	74 1a                	je     420 <strcmp+0x40>
+    p++, q++;
+ 406:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 408:	0f b6 19             	movzbl (%ecx),%ebx
+ 40b:	38 c3                	cmp    %al,%bl
+ 40d:	74 e9                	je     3f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 40f:	29 d8                	sub    %ebx,%eax
+}
+ 411:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 414:	c9                   	leave
+ 415:	c3                   	ret
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 420:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 424:	31 c0                	xor    %eax,%eax
+ 426:	29 d8                	sub    %ebx,%eax
+}
+ 428:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 42b:	c9                   	leave
+ 42c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 42d:	0f b6 19             	movzbl (%ecx),%ebx
+ 430:	31 c0                	xor    %eax,%eax
+ 432:	eb db                	jmp    40f <strcmp+0x2f>
+ 434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 446:	80 3a 00             	cmpb   $0x0,(%edx)
+ 449:	74 15                	je     460 <strlen+0x20>
+ 44b:	31 c0                	xor    %eax,%eax
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+ 450:	83 c0 01             	add    $0x1,%eax
+ 453:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 457:	89 c1                	mov    %eax,%ecx
+ 459:	75 f5                	jne    450 <strlen+0x10>
+    ;
+  return n;
+}
+ 45b:	89 c8                	mov    %ecx,%eax
+ 45d:	5d                   	pop    %ebp
+ 45e:	c3                   	ret
+ 45f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 460:	31 c9                	xor    %ecx,%ecx
+}
+ 462:	5d                   	pop    %ebp
+ 463:	89 c8                	mov    %ecx,%eax
+ 465:	c3                   	ret
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 477:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 47a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 47d:	89 d7                	mov    %edx,%edi
+ 47f:	fc                   	cld
+ 480:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 482:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 485:	89 d0                	mov    %edx,%eax
+ 487:	c9                   	leave
+ 488:	c3                   	ret
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 49a:	0f b6 10             	movzbl (%eax),%edx
+ 49d:	84 d2                	test   %dl,%dl
+ 49f:	75 12                	jne    4b3 <strchr+0x23>
+ 4a1:	eb 1d                	jmp    4c0 <strchr+0x30>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+ 4a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4ac:	83 c0 01             	add    $0x1,%eax
+ 4af:	84 d2                	test   %dl,%dl
+ 4b1:	74 0d                	je     4c0 <strchr+0x30>
+    if(*s == c)
+ 4b3:	38 d1                	cmp    %dl,%cl
+ 4b5:	75 f1                	jne    4a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4b7:	5d                   	pop    %ebp
+ 4b8:	c3                   	ret
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4c0:	31 c0                	xor    %eax,%eax
+}
+ 4c2:	5d                   	pop    %ebp
+ 4c3:	c3                   	ret
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4d9:	31 db                	xor    %ebx,%ebx
+{
+ 4db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4de:	eb 27                	jmp    507 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4e0:	83 ec 04             	sub    $0x4,%esp
+ 4e3:	6a 01                	push   $0x1
+ 4e5:	56                   	push   %esi
+ 4e6:	6a 00                	push   $0x0
+ 4e8:	e8 42 02 00 00       	call   72f <read>
+    if(cc < 1)
+ 4ed:	83 c4 10             	add    $0x10,%esp
+ 4f0:	85 c0                	test   %eax,%eax
+ 4f2:	7e 1d                	jle    511 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ff:	3c 0a                	cmp    $0xa,%al
+ 501:	74 10                	je     513 <gets+0x43>
+ 503:	3c 0d                	cmp    $0xd,%al
+ 505:	74 0c                	je     513 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 507:	89 df                	mov    %ebx,%edi
+ 509:	83 c3 01             	add    $0x1,%ebx
+ 50c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 50f:	7c cf                	jl     4e0 <gets+0x10>
+ 511:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 513:	8b 45 08             	mov    0x8(%ebp),%eax
+ 516:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 51a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51d:	5b                   	pop    %ebx
+ 51e:	5e                   	pop    %esi
+ 51f:	5f                   	pop    %edi
+ 520:	5d                   	pop    %ebp
+ 521:	c3                   	ret
+ 522:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	56                   	push   %esi
+ 534:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 535:	83 ec 08             	sub    $0x8,%esp
+ 538:	6a 00                	push   $0x0
+ 53a:	ff 75 08             	push   0x8(%ebp)
+ 53d:	e8 6f 02 00 00       	call   7b1 <open>
+  if(fd < 0)
+ 542:	83 c4 10             	add    $0x10,%esp
+ 545:	85 c0                	test   %eax,%eax
+ 547:	78 27                	js     570 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 549:	83 ec 08             	sub    $0x8,%esp
+ 54c:	ff 75 0c             	push   0xc(%ebp)
+ 54f:	89 c3                	mov    %eax,%ebx
+ 551:	50                   	push   %eax
+ 552:	e8 a8 02 00 00       	call   7ff <fstat>
+  close(fd);
+ 557:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 55a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 55c:	e8 02 02 00 00       	call   763 <close>
+  return r;
+ 561:	83 c4 10             	add    $0x10,%esp
+}
+ 564:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 567:	89 f0                	mov    %esi,%eax
+ 569:	5b                   	pop    %ebx
+ 56a:	5e                   	pop    %esi
+ 56b:	5d                   	pop    %ebp
+ 56c:	c3                   	ret
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 570:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 575:	eb ed                	jmp    564 <stat+0x34>
+ 577:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	53                   	push   %ebx
+ 584:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 587:	0f be 02             	movsbl (%edx),%eax
+ 58a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 58d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 590:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 595:	77 1e                	ja     5b5 <atoi+0x35>
+ 597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5a0:	83 c2 01             	add    $0x1,%edx
+ 5a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5aa:	0f be 02             	movsbl (%edx),%eax
+ 5ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5b0:	80 fb 09             	cmp    $0x9,%bl
+ 5b3:	76 eb                	jbe    5a0 <atoi+0x20>
+  return n;
+}
+ 5b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5b8:	89 c8                	mov    %ecx,%eax
+ 5ba:	c9                   	leave
+ 5bb:	c3                   	ret
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5ce:	85 c0                	test   %eax,%eax
+ 5d0:	7e 13                	jle    5e5 <memmove+0x25>
+ 5d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5d4:	89 d7                	mov    %edx,%edi
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5e1:	39 f8                	cmp    %edi,%eax
+ 5e3:	75 fb                	jne    5e0 <memmove+0x20>
+  return vdst;
+}
+ 5e5:	5e                   	pop    %esi
+ 5e6:	89 d0                	mov    %edx,%eax
+ 5e8:	5f                   	pop    %edi
+ 5e9:	5d                   	pop    %ebp
+ 5ea:	c3                   	ret
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+
+000005f0 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 5f9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 600:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 603:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 606:	50                   	push   %eax
+ 607:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 60a:	50                   	push   %eax
+ 60b:	6a 00                	push   $0x0
+ 60d:	e8 8d 03 00 00       	call   99f <setitimer>
+ 612:	83 c4 10             	add    $0x10,%esp
+ 615:	89 c2                	mov    %eax,%edx
+ 617:	31 c0                	xor    %eax,%eax
+ 619:	85 d2                	test   %edx,%edx
+ 61b:	78 03                	js     620 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 61d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 620:	c9                   	leave
+ 621:	c3                   	ret
+ 622:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 630:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 635:	c3                   	ret
+ 636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000640 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 640:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 645:	c3                   	ret
+ 646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000650 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 659:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 65d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 660:	75 5e                	jne    6c0 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 662:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 668:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 66a:	89 d3                	mov    %edx,%ebx
+ 66c:	89 c1                	mov    %eax,%ecx
+ 66e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 674:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 67a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 67d:	31 d2                	xor    %edx,%edx
+ 67f:	89 d8                	mov    %ebx,%eax
+ 681:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 684:	f7 f6                	div    %esi
+ 686:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 688:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 68b:	f7 f6                	div    %esi
+ 68d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 68f:	89 da                	mov    %ebx,%edx
+ 691:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 696:	f7 f3                	div    %ebx
+ 698:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 69a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 69f:	89 d3                	mov    %edx,%ebx
+ 6a1:	f7 e1                	mul    %ecx
+ 6a3:	f7 f6                	div    %esi
+ 6a5:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 6ab:	01 c3                	add    %eax,%ebx
+  return 0;
+ 6ad:	31 c0                	xor    %eax,%eax
+ 6af:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 6b2:	83 c4 0c             	add    $0xc,%esp
+ 6b5:	5b                   	pop    %ebx
+ 6b6:	5e                   	pop    %esi
+ 6b7:	5f                   	pop    %edi
+ 6b8:	5d                   	pop    %ebp
+ 6b9:	c3                   	ret
+ 6ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 6c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 6c5:	eb eb                	jmp    6b2 <clock_gettime+0x62>
+
+000006c7 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 6c7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6cc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6d3:	74 09                	je     6de <fork+0x17>
+ 6d5:	89 e1                	mov    %esp,%ecx
+ 6d7:	ba e0 06 00 00       	mov    $0x6e0,%edx
+ 6dc:	0f 34                	sysenter
+ 6de:	cd 40                	int    $0x40
+ 6e0:	c3                   	ret
+
+000006e1 <exit>:
+SYSCALL(exit)
+ 6e1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6e6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6ed:	74 09                	je     6f8 <exit+0x17>
+ 6ef:	89 e1                	mov    %esp,%ecx
+ 6f1:	ba fa 06 00 00       	mov    $0x6fa,%edx
+ 6f6:	0f 34                	sysenter
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <wait>:
+SYSCALL(wait)
+ 6fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 700:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 707:	74 09                	je     712 <wait+0x17>
+ 709:	89 e1                	mov    %esp,%ecx
+ 70b:	ba 14 07 00 00       	mov    $0x714,%edx
+ 710:	0f 34                	sysenter
+ 712:	cd 40                	int    $0x40
+ 714:	c3                   	ret
+
+00000715 <pipe>:
+SYSCALL(pipe)
+ 715:	b8 04 00 00 00       	mov    $0x4,%eax
+ 71a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 721:	74 09                	je     72c <pipe+0x17>
+ 723:	89 e1                	mov    %esp,%ecx
+ 725:	ba 2e 07 00 00       	mov    $0x72e,%edx
+ 72a:	0f 34                	sysenter
+ 72c:	cd 40                	int    $0x40
+ 72e:	c3                   	ret
+
+0000072f <read>:
+SYSCALL(read)
+ 72f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 734:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 73b:	74 09                	je     746 <read+0x17>
+ 73d:	89 e1                	mov    %esp,%ecx
+ 73f:	ba 48 07 00 00       	mov    $0x748,%edx
+ 744:	0f 34                	sysenter
+ 746:	cd 40                	int    $0x40
+ 748:	c3                   	ret
+
+00000749 <write>:
+SYSCALL(write)
+ 749:	b8 10 00 00 00       	mov    $0x10,%eax
+ 74e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 755:	74 09                	je     760 <write+0x17>
+ 757:	89 e1                	mov    %esp,%ecx
+ 759:	ba 62 07 00 00       	mov    $0x762,%edx
+ 75e:	0f 34                	sysenter
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <close>:
+SYSCALL(close)
+ 763:	b8 15 00 00 00       	mov    $0x15,%eax
+ 768:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 76f:	74 09                	je     77a <close+0x17>
+ 771:	89 e1                	mov    %esp,%ecx
+ 773:	ba 7c 07 00 00       	mov    $0x77c,%edx
+ 778:	0f 34                	sysenter
+ 77a:	cd 40                	int    $0x40
+ 77c:	c3                   	ret
+
+0000077d <kill>:
+SYSCALL(kill)
+ 77d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 782:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 789:	74 09                	je     794 <kill+0x17>
+ 78b:	89 e1                	mov    %esp,%ecx
+ 78d:	ba 96 07 00 00       	mov    $0x796,%edx
+ 792:	0f 34                	sysenter
+ 794:	cd 40                	int    $0x40
+ 796:	c3                   	ret
+
+00000797 <exec>:
+SYSCALL(exec)
+ 797:	b8 07 00 00 00       	mov    $0x7,%eax
+ 79c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7a3:	74 09                	je     7ae <exec+0x17>
+ 7a5:	89 e1                	mov    %esp,%ecx
+ 7a7:	ba b0 07 00 00       	mov    $0x7b0,%edx
+ 7ac:	0f 34                	sysenter
+ 7ae:	cd 40                	int    $0x40
+ 7b0:	c3                   	ret
+
+000007b1 <open>:
+SYSCALL(open)
+ 7b1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7b6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7bd:	74 09                	je     7c8 <open+0x17>
+ 7bf:	89 e1                	mov    %esp,%ecx
+ 7c1:	ba ca 07 00 00       	mov    $0x7ca,%edx
+ 7c6:	0f 34                	sysenter
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <mknod>:
+SYSCALL(mknod)
+ 7cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7d0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7d7:	74 09                	je     7e2 <mknod+0x17>
+ 7d9:	89 e1                	mov    %esp,%ecx
+ 7db:	ba e4 07 00 00       	mov    $0x7e4,%edx
+ 7e0:	0f 34                	sysenter
+ 7e2:	cd 40                	int    $0x40
+ 7e4:	c3                   	ret
+
+000007e5 <unlink>:
+SYSCALL(unlink)
+ 7e5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7ea:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7f1:	74 09                	je     7fc <unlink+0x17>
+ 7f3:	89 e1                	mov    %esp,%ecx
+ 7f5:	ba fe 07 00 00       	mov    $0x7fe,%edx
+ 7fa:	0f 34                	sysenter
+ 7fc:	cd 40                	int    $0x40
+ 7fe:	c3                   	ret
+
+000007ff <fstat>:
+SYSCALL(fstat)
+ 7ff:	b8 08 00 00 00       	mov    $0x8,%eax
+ 804:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 80b:	74 09                	je     816 <fstat+0x17>
+ 80d:	89 e1                	mov    %esp,%ecx
+ 80f:	ba 18 08 00 00       	mov    $0x818,%edx
+ 814:	0f 34                	sysenter
+ 816:	cd 40                	int    $0x40
+ 818:	c3                   	ret
+
+00000819 <link>:
+SYSCALL(link)
+ 819:	b8 13 00 00 00       	mov    $0x13,%eax
+ 81e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 825:	74 09                	je     830 <link+0x17>
+ 827:	89 e1                	mov    %esp,%ecx
+ 829:	ba 32 08 00 00       	mov    $0x832,%edx
+ 82e:	0f 34                	sysenter
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <mkdir>:
+SYSCALL(mkdir)
+ 833:	b8 14 00 00 00       	mov    $0x14,%eax
+ 838:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 83f:	74 09                	je     84a <mkdir+0x17>
+ 841:	89 e1                	mov    %esp,%ecx
+ 843:	ba 4c 08 00 00       	mov    $0x84c,%edx
+ 848:	0f 34                	sysenter
+ 84a:	cd 40                	int    $0x40
+ 84c:	c3                   	ret
+
+0000084d <chdir>:
+SYSCALL(chdir)
+ 84d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 852:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 859:	74 09                	je     864 <chdir+0x17>
+ 85b:	89 e1                	mov    %esp,%ecx
+ 85d:	ba 66 08 00 00       	mov    $0x866,%edx
+ 862:	0f 34                	sysenter
+ 864:	cd 40                	int    $0x40
+ 866:	c3                   	ret
+
+00000867 <dup>:
+SYSCALL(dup)
+ 867:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 86c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 873:	74 09                	je     87e <dup+0x17>
+ 875:	89 e1                	mov    %esp,%ecx
+ 877:	ba 80 08 00 00       	mov    $0x880,%edx
+ 87c:	0f 34                	sysenter
+ 87e:	cd 40                	int    $0x40
+ 880:	c3                   	ret
+
+00000881 <sbrk>:
+SYSCALL(sbrk)
+ 881:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 886:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 88d:	74 09                	je     898 <sbrk+0x17>
+ 88f:	89 e1                	mov    %esp,%ecx
+ 891:	ba 9a 08 00 00       	mov    $0x89a,%edx
+ 896:	0f 34                	sysenter
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <sleep>:
+SYSCALL(sleep)
+ 89b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8a0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8a7:	74 09                	je     8b2 <sleep+0x17>
+ 8a9:	89 e1                	mov    %esp,%ecx
+ 8ab:	ba b4 08 00 00       	mov    $0x8b4,%edx
+ 8b0:	0f 34                	sysenter
+ 8b2:	cd 40                	int    $0x40
+ 8b4:	c3                   	ret
+
+000008b5 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 8b5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8ba:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8c1:	74 09                	je     8cc <sigprocmask+0x17>
+ 8c3:	89 e1                	mov    %esp,%ecx
+ 8c5:	ba ce 08 00 00       	mov    $0x8ce,%edx
+ 8ca:	0f 34                	sysenter
+ 8cc:	cd 40                	int    $0x40
+ 8ce:	c3                   	ret
+
+000008cf <sigaction>:
+SYSCALL(sigaction)
+ 8cf:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8d4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8db:	74 09                	je     8e6 <sigaction+0x17>
+ 8dd:	89 e1                	mov    %esp,%ecx
+ 8df:	ba e8 08 00 00       	mov    $0x8e8,%edx
+ 8e4:	0f 34                	sysenter
+ 8e6:	cd 40                	int    $0x40
+ 8e8:	c3                   	ret
+
+000008e9 <sigret>:
+SYSCALL(sigret)
+ 8e9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8ee:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8f5:	74 09                	je     900 <sigret+0x17>
+ 8f7:	89 e1                	mov    %esp,%ecx
+ 8f9:	ba 02 09 00 00       	mov    $0x902,%edx
+ 8fe:	0f 34                	sysenter
+ 900:	cd 40                	int    $0x40
+ 902:	c3                   	ret
+
+00000903 <traceread>:
+SYSCALL(traceread)
+ 903:	b8 19 00 00 00       	mov    $0x19,%eax
+ 908:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 90f:	74 09                	je     91a <traceread+0x17>
+ 911:	89 e1                	mov    %esp,%ecx
+ 913:	ba 1c 09 00 00       	mov    $0x91c,%edx
+ 918:	0f 34                	sysenter
+ 91a:	cd 40                	int    $0x40
+ 91c:	c3                   	ret
+
+0000091d <sigqueue>:
+SYSCALL(sigqueue)
+ 91d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 922:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 929:	74 09                	je     934 <sigqueue+0x17>
+ 92b:	89 e1                	mov    %esp,%ecx
+ 92d:	ba 36 09 00 00       	mov    $0x936,%edx
+ 932:	0f 34                	sysenter
+ 934:	cd 40                	int    $0x40
+ 936:	c3                   	ret
+
+00000937 <signalfd>:
+SYSCALL(signalfd)
+ 937:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 93c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 943:	74 09                	je     94e <signalfd+0x17>
+ 945:	89 e1                	mov    %esp,%ecx
+ 947:	ba 50 09 00 00       	mov    $0x950,%edx
+ 94c:	0f 34                	sysenter
+ 94e:	cd 40                	int    $0x40
+ 950:	c3                   	ret
+
+00000951 <sigwait>:
+SYSCALL(sigwait)
+ 951:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 956:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 95d:	74 09                	je     968 <sigwait+0x17>
+ 95f:	89 e1                	mov    %esp,%ecx
+ 961:	ba 6a 09 00 00       	mov    $0x96a,%edx
+ 966:	0f 34                	sysenter
+ 968:	cd 40                	int    $0x40
+ 96a:	c3                   	ret
+
+0000096b <sigsuspend>:
+SYSCALL(sigsuspend)
+ 96b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 970:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 977:	74 09                	je     982 <sigsuspend+0x17>
+ 979:	89 e1                	mov    %esp,%ecx
+ 97b:	ba 84 09 00 00       	mov    $0x984,%edx
+ 980:	0f 34                	sysenter
+ 982:	cd 40                	int    $0x40
+ 984:	c3                   	ret
+
+00000985 <waitpid>:
+SYSCALL(waitpid)
+ 985:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 98a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 991:	74 09                	je     99c <waitpid+0x17>
+ 993:	89 e1                	mov    %esp,%ecx
+ 995:	ba 9e 09 00 00       	mov    $0x99e,%edx
+ 99a:	0f 34                	sysenter
+ 99c:	cd 40                	int    $0x40
+ 99e:	c3                   	ret
+
+0000099f <setitimer>:
+SYSCALL(setitimer)
+ 99f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 9a4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 9ab:	74 09                	je     9b6 <setitimer+0x17>
+ 9ad:	89 e1                	mov    %esp,%ecx
+ 9af:	ba b8 09 00 00       	mov    $0x9b8,%edx
+ 9b4:	0f 34                	sysenter
+ 9b6:	cd 40                	int    $0x40
+ 9b8:	c3                   	ret
+
+000009b9 <nanosleep>:
+SYSCALL(nanosleep)
+ 9b9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9be:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 9c5:	74 09                	je     9d0 <nanosleep+0x17>
+ 9c7:	89 e1                	mov    %esp,%ecx
+ 9c9:	ba d2 09 00 00       	mov    $0x9d2,%edx
+ 9ce:	0f 34                	sysenter
+ 9d0:	cd 40                	int    $0x40
+ 9d2:	c3                   	ret
+
+000009d3 <mmap>:
+SYSCALL(mmap)
+ 9d3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9d8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 9df:	74 09                	je     9ea <mmap+0x17>
+ 9e1:	89 e1                	mov    %esp,%ecx
+ 9e3:	ba ec 09 00 00       	mov    $0x9ec,%edx
+ 9e8:	0f 34                	sysenter
+ 9ea:	cd 40                	int    $0x40
+ 9ec:	c3                   	ret
+
+000009ed <munmap>:
+SYSCALL(munmap)
+ 9ed:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9f2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 9f9:	74 09                	je     a04 <munmap+0x17>
+ 9fb:	89 e1                	mov    %esp,%ecx
+ 9fd:	ba 06 0a 00 00       	mov    $0xa06,%edx
+ a02:	0f 34                	sysenter
+ a04:	cd 40                	int    $0x40
+ a06:	c3                   	ret
+
+00000a07 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ a07:	b8 0b 00 00 00       	mov    $0xb,%eax
+ a0c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ a13:	74 09                	je     a1e <getpid_syscall+0x17>
+ a15:	89 e1                	mov    %esp,%ecx
+ a17:	ba 20 0a 00 00       	mov    $0xa20,%edx
+ a1c:	0f 34                	sysenter
+ a1e:	cd 40                	int    $0x40
+ a20:	c3                   	ret
+
+00000a21 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ a21:	b8 0b 00 00 00       	mov    $0xb,%eax
+ a26:	cd 40                	int    $0x40
+ a28:	c3                   	ret
+ a29:	66 90                	xchg   %ax,%ax
+ a2b:	66 90                	xchg   %ax,%ax
+ a2d:	66 90                	xchg   %ax,%ax
+ a2f:	90                   	nop
+
+00000a30 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a38:	89 d1                	mov    %edx,%ecx
+{
+ a3a:	83 ec 3c             	sub    $0x3c,%esp
+ a3d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a40:	85 d2                	test   %edx,%edx
+ a42:	0f 89 80 00 00 00    	jns    ac8 <printint+0x98>
+ a48:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a4c:	74 7a                	je     ac8 <printint+0x98>
+    x = -xx;
+ a4e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a50:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a55:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a58:	31 f6                	xor    %esi,%esi
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a60:	89 c8                	mov    %ecx,%eax
+ a62:	31 d2                	xor    %edx,%edx
+ a64:	89 f7                	mov    %esi,%edi
+ a66:	f7 f3                	div    %ebx
+ a68:	8d 76 01             	lea    0x1(%esi),%esi
+ a6b:	0f b6 92 90 0e 00 00 	movzbl 0xe90(%edx),%edx
+ a72:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a76:	89 ca                	mov    %ecx,%edx
+ a78:	89 c1                	mov    %eax,%ecx
+ a7a:	39 da                	cmp    %ebx,%edx
+ a7c:	73 e2                	jae    a60 <printint+0x30>
+  if(neg)
+ a7e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a81:	85 c0                	test   %eax,%eax
+ a83:	74 07                	je     a8c <printint+0x5c>
+    buf[i++] = '-';
+ a85:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a8a:	89 f7                	mov    %esi,%edi
+ a8c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a8f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a92:	01 df                	add    %ebx,%edi
+ a94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a98:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a9b:	83 ec 04             	sub    $0x4,%esp
+ a9e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ aa1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ aa4:	6a 01                	push   $0x1
+ aa6:	50                   	push   %eax
+ aa7:	56                   	push   %esi
+ aa8:	e8 9c fc ff ff       	call   749 <write>
+  while(--i >= 0)
+ aad:	89 f8                	mov    %edi,%eax
+ aaf:	83 c4 10             	add    $0x10,%esp
+ ab2:	83 ef 01             	sub    $0x1,%edi
+ ab5:	39 d8                	cmp    %ebx,%eax
+ ab7:	75 df                	jne    a98 <printint+0x68>
+}
+ ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ abc:	5b                   	pop    %ebx
+ abd:	5e                   	pop    %esi
+ abe:	5f                   	pop    %edi
+ abf:	5d                   	pop    %ebp
+ ac0:	c3                   	ret
+ ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ ac8:	31 c0                	xor    %eax,%eax
+ aca:	eb 89                	jmp    a55 <printint+0x25>
+ acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ad0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ ad9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ adc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ adf:	0f b6 1e             	movzbl (%esi),%ebx
+ ae2:	83 c6 01             	add    $0x1,%esi
+ ae5:	84 db                	test   %bl,%bl
+ ae7:	74 67                	je     b50 <printf+0x80>
+ ae9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ aec:	31 d2                	xor    %edx,%edx
+ aee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ af1:	eb 34                	jmp    b27 <printf+0x57>
+ af3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ af7:	90                   	nop
+ af8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ afb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b00:	83 f8 25             	cmp    $0x25,%eax
+ b03:	74 18                	je     b1d <printf+0x4d>
+  write(fd, &c, 1);
+ b05:	83 ec 04             	sub    $0x4,%esp
+ b08:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b0b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b0e:	6a 01                	push   $0x1
+ b10:	50                   	push   %eax
+ b11:	57                   	push   %edi
+ b12:	e8 32 fc ff ff       	call   749 <write>
+ b17:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b1a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b1d:	0f b6 1e             	movzbl (%esi),%ebx
+ b20:	83 c6 01             	add    $0x1,%esi
+ b23:	84 db                	test   %bl,%bl
+ b25:	74 29                	je     b50 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b27:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b2a:	85 d2                	test   %edx,%edx
+ b2c:	74 ca                	je     af8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b2e:	83 fa 25             	cmp    $0x25,%edx
+ b31:	75 ea                	jne    b1d <printf+0x4d>
+      if(c == 'd'){
+ b33:	83 f8 25             	cmp    $0x25,%eax
+ b36:	0f 84 24 01 00 00    	je     c60 <printf+0x190>
+ b3c:	83 e8 63             	sub    $0x63,%eax
+ b3f:	83 f8 15             	cmp    $0x15,%eax
+ b42:	77 1c                	ja     b60 <printf+0x90>
+ b44:	ff 24 85 38 0e 00 00 	jmp    *0xe38(,%eax,4)
+ b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b53:	5b                   	pop    %ebx
+ b54:	5e                   	pop    %esi
+ b55:	5f                   	pop    %edi
+ b56:	5d                   	pop    %ebp
+ b57:	c3                   	ret
+ b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+  write(fd, &c, 1);
+ b60:	83 ec 04             	sub    $0x4,%esp
+ b63:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b66:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b6a:	6a 01                	push   $0x1
+ b6c:	52                   	push   %edx
+ b6d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b70:	57                   	push   %edi
+ b71:	e8 d3 fb ff ff       	call   749 <write>
+ b76:	83 c4 0c             	add    $0xc,%esp
+ b79:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b7c:	6a 01                	push   $0x1
+ b7e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b81:	52                   	push   %edx
+ b82:	57                   	push   %edi
+ b83:	e8 c1 fb ff ff       	call   749 <write>
+        putc(fd, c);
+ b88:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b8b:	31 d2                	xor    %edx,%edx
+ b8d:	eb 8e                	jmp    b1d <printf+0x4d>
+ b8f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b93:	83 ec 0c             	sub    $0xc,%esp
+ b96:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b9b:	8b 13                	mov    (%ebx),%edx
+ b9d:	6a 00                	push   $0x0
+ b9f:	89 f8                	mov    %edi,%eax
+        ap++;
+ ba1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ ba4:	e8 87 fe ff ff       	call   a30 <printint>
+        ap++;
+ ba9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ baf:	31 d2                	xor    %edx,%edx
+ bb1:	e9 67 ff ff ff       	jmp    b1d <printf+0x4d>
+ bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ bc0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ bc3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bc5:	83 c0 04             	add    $0x4,%eax
+ bc8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ bcb:	85 db                	test   %ebx,%ebx
+ bcd:	0f 84 9d 00 00 00    	je     c70 <printf+0x1a0>
+        while(*s != 0){
+ bd3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ bd6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ bd8:	84 c0                	test   %al,%al
+ bda:	0f 84 3d ff ff ff    	je     b1d <printf+0x4d>
+ be0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ be3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ be6:	89 de                	mov    %ebx,%esi
+ be8:	89 d3                	mov    %edx,%ebx
+ bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ bf0:	83 ec 04             	sub    $0x4,%esp
+ bf3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ bf6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ bf9:	6a 01                	push   $0x1
+ bfb:	53                   	push   %ebx
+ bfc:	57                   	push   %edi
+ bfd:	e8 47 fb ff ff       	call   749 <write>
+        while(*s != 0){
+ c02:	0f b6 06             	movzbl (%esi),%eax
+ c05:	83 c4 10             	add    $0x10,%esp
+ c08:	84 c0                	test   %al,%al
+ c0a:	75 e4                	jne    bf0 <printf+0x120>
+      state = 0;
+ c0c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c0f:	31 d2                	xor    %edx,%edx
+ c11:	e9 07 ff ff ff       	jmp    b1d <printf+0x4d>
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c23:	83 ec 0c             	sub    $0xc,%esp
+ c26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c2b:	8b 13                	mov    (%ebx),%edx
+ c2d:	6a 01                	push   $0x1
+ c2f:	e9 6b ff ff ff       	jmp    b9f <printf+0xcf>
+ c34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c38:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c3b:	83 ec 04             	sub    $0x4,%esp
+ c3e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c41:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c43:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c46:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c49:	6a 01                	push   $0x1
+ c4b:	52                   	push   %edx
+ c4c:	57                   	push   %edi
+ c4d:	e8 f7 fa ff ff       	call   749 <write>
+        ap++;
+ c52:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c55:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c58:	31 d2                	xor    %edx,%edx
+ c5a:	e9 be fe ff ff       	jmp    b1d <printf+0x4d>
+ c5f:	90                   	nop
+  write(fd, &c, 1);
+ c60:	83 ec 04             	sub    $0x4,%esp
+ c63:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c66:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c69:	6a 01                	push   $0x1
+ c6b:	e9 11 ff ff ff       	jmp    b81 <printf+0xb1>
+ c70:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c75:	bb 2e 0e 00 00       	mov    $0xe2e,%ebx
+ c7a:	e9 61 ff ff ff       	jmp    be0 <printf+0x110>
+ c7f:	90                   	nop
+
+00000c80 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c81:	a1 a0 16 00 00       	mov    0x16a0,%eax
+{
+ c86:	89 e5                	mov    %esp,%ebp
+ c88:	57                   	push   %edi
+ c89:	56                   	push   %esi
+ c8a:	53                   	push   %ebx
+ c8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c8e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c98:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c9a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c9c:	39 ca                	cmp    %ecx,%edx
+ c9e:	73 30                	jae    cd0 <free+0x50>
+ ca0:	39 c1                	cmp    %eax,%ecx
+ ca2:	72 04                	jb     ca8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ca4:	39 c2                	cmp    %eax,%edx
+ ca6:	72 f0                	jb     c98 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ca8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cae:	39 f8                	cmp    %edi,%eax
+ cb0:	74 2e                	je     ce0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cb2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cb5:	8b 42 04             	mov    0x4(%edx),%eax
+ cb8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cbb:	39 f1                	cmp    %esi,%ecx
+ cbd:	74 38                	je     cf7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cbf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cc1:	5b                   	pop    %ebx
+  freep = p;
+ cc2:	89 15 a0 16 00 00    	mov    %edx,0x16a0
+}
+ cc8:	5e                   	pop    %esi
+ cc9:	5f                   	pop    %edi
+ cca:	5d                   	pop    %ebp
+ ccb:	c3                   	ret
+ ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cd0:	39 c1                	cmp    %eax,%ecx
+ cd2:	72 d0                	jb     ca4 <free+0x24>
+ cd4:	eb c2                	jmp    c98 <free+0x18>
+ cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ce0:	03 70 04             	add    0x4(%eax),%esi
+ ce3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ce6:	8b 02                	mov    (%edx),%eax
+ ce8:	8b 00                	mov    (%eax),%eax
+ cea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ ced:	8b 42 04             	mov    0x4(%edx),%eax
+ cf0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cf3:	39 f1                	cmp    %esi,%ecx
+ cf5:	75 c8                	jne    cbf <free+0x3f>
+    p->s.size += bp->s.size;
+ cf7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cfa:	89 15 a0 16 00 00    	mov    %edx,0x16a0
+    p->s.size += bp->s.size;
+ d00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d06:	89 0a                	mov    %ecx,(%edx)
+}
+ d08:	5b                   	pop    %ebx
+ d09:	5e                   	pop    %esi
+ d0a:	5f                   	pop    %edi
+ d0b:	5d                   	pop    %ebp
+ d0c:	c3                   	ret
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	57                   	push   %edi
+ d14:	56                   	push   %esi
+ d15:	53                   	push   %ebx
+ d16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d1c:	8b 15 a0 16 00 00    	mov    0x16a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d22:	8d 78 07             	lea    0x7(%eax),%edi
+ d25:	c1 ef 03             	shr    $0x3,%edi
+ d28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d2b:	85 d2                	test   %edx,%edx
+ d2d:	0f 84 8d 00 00 00    	je     dc0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d35:	8b 48 04             	mov    0x4(%eax),%ecx
+ d38:	39 f9                	cmp    %edi,%ecx
+ d3a:	73 64                	jae    da0 <malloc+0x90>
+  if(nu < 4096)
+ d3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d41:	39 df                	cmp    %ebx,%edi
+ d43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d4d:	eb 0a                	jmp    d59 <malloc+0x49>
+ d4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d52:	8b 48 04             	mov    0x4(%eax),%ecx
+ d55:	39 f9                	cmp    %edi,%ecx
+ d57:	73 47                	jae    da0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d59:	89 c2                	mov    %eax,%edx
+ d5b:	39 05 a0 16 00 00    	cmp    %eax,0x16a0
+ d61:	75 ed                	jne    d50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d63:	83 ec 0c             	sub    $0xc,%esp
+ d66:	56                   	push   %esi
+ d67:	e8 15 fb ff ff       	call   881 <sbrk>
+  if(p == (char*)-1)
+ d6c:	83 c4 10             	add    $0x10,%esp
+ d6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d72:	74 1c                	je     d90 <malloc+0x80>
+  hp->s.size = nu;
+ d74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d77:	83 ec 0c             	sub    $0xc,%esp
+ d7a:	83 c0 08             	add    $0x8,%eax
+ d7d:	50                   	push   %eax
+ d7e:	e8 fd fe ff ff       	call   c80 <free>
+  return freep;
+ d83:	8b 15 a0 16 00 00    	mov    0x16a0,%edx
+      if((p = morecore(nunits)) == 0)
+ d89:	83 c4 10             	add    $0x10,%esp
+ d8c:	85 d2                	test   %edx,%edx
+ d8e:	75 c0                	jne    d50 <malloc+0x40>
+        return 0;
+  }
+}
+ d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d93:	31 c0                	xor    %eax,%eax
+}
+ d95:	5b                   	pop    %ebx
+ d96:	5e                   	pop    %esi
+ d97:	5f                   	pop    %edi
+ d98:	5d                   	pop    %ebp
+ d99:	c3                   	ret
+ d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ da0:	39 cf                	cmp    %ecx,%edi
+ da2:	74 4c                	je     df0 <malloc+0xe0>
+        p->s.size -= nunits;
+ da4:	29 f9                	sub    %edi,%ecx
+ da6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ da9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ dac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ daf:	89 15 a0 16 00 00    	mov    %edx,0x16a0
+}
+ db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ db8:	83 c0 08             	add    $0x8,%eax
+}
+ dbb:	5b                   	pop    %ebx
+ dbc:	5e                   	pop    %esi
+ dbd:	5f                   	pop    %edi
+ dbe:	5d                   	pop    %ebp
+ dbf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ dc0:	c7 05 a0 16 00 00 a4 	movl   $0x16a4,0x16a0
+ dc7:	16 00 00 
+    base.s.size = 0;
+ dca:	b8 a4 16 00 00       	mov    $0x16a4,%eax
+    base.s.ptr = freep = prevp = &base;
+ dcf:	c7 05 a4 16 00 00 a4 	movl   $0x16a4,0x16a4
+ dd6:	16 00 00 
+    base.s.size = 0;
+ dd9:	c7 05 a8 16 00 00 00 	movl   $0x0,0x16a8
+ de0:	00 00 00 
+    if(p->s.size >= nunits){
+ de3:	e9 54 ff ff ff       	jmp    d3c <malloc+0x2c>
+ de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ def:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ df0:	8b 08                	mov    (%eax),%ecx
+ df2:	89 0a                	mov    %ecx,(%edx)
+ df4:	eb b9                	jmp    daf <malloc+0x9f>
@@ -0,0 +1,1583 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 48 0b 00 00       	push   $0xb48
+  19:	e8 e3 04 00 00       	call   501 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 ad 00 00 00    	js     d6 <main+0xd6>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 84 05 00 00       	call   5b7 <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 78 05 00 00       	call   5b7 <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 50 0b 00 00       	push   $0xb50
+  50:	6a 01                	push   $0x1
+  52:	e8 c9 07 00 00       	call   820 <printf>
+    pid = fork();
+  57:	e8 bb 03 00 00       	call   417 <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit(1);
+    }
+    if(pid == 0){
+  65:	74 44                	je     ab <main+0xab>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit(1);
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 d6 03 00 00       	call   44b <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 8f 0b 00 00       	push   $0xb8f
+  85:	6a 01                	push   $0x1
+  87:	e8 94 07 00 00       	call   820 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 63 0b 00 00       	push   $0xb63
+  98:	6a 01                	push   $0x1
+  9a:	e8 81 07 00 00       	call   820 <printf>
+      exit(1);
+  9f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  a6:	e8 86 03 00 00       	call   431 <exit>
+      exec("sh", argv);
+  ab:	50                   	push   %eax
+  ac:	50                   	push   %eax
+  ad:	68 10 0f 00 00       	push   $0xf10
+  b2:	68 76 0b 00 00       	push   $0xb76
+  b7:	e8 2b 04 00 00       	call   4e7 <exec>
+      printf(1, "init: exec sh failed\n");
+  bc:	5a                   	pop    %edx
+  bd:	59                   	pop    %ecx
+  be:	68 79 0b 00 00       	push   $0xb79
+  c3:	6a 01                	push   $0x1
+  c5:	e8 56 07 00 00       	call   820 <printf>
+      exit(1);
+  ca:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  d1:	e8 5b 03 00 00       	call   431 <exit>
+    mknod("console", 1, 1);
+  d6:	50                   	push   %eax
+  d7:	6a 01                	push   $0x1
+  d9:	6a 01                	push   $0x1
+  db:	68 48 0b 00 00       	push   $0xb48
+  e0:	e8 36 04 00 00       	call   51b <mknod>
+    open("console", O_RDWR);
+  e5:	58                   	pop    %eax
+  e6:	5a                   	pop    %edx
+  e7:	6a 02                	push   $0x2
+  e9:	68 48 0b 00 00       	push   $0xb48
+  ee:	e8 0e 04 00 00       	call   501 <open>
+  f3:	83 c4 10             	add    $0x10,%esp
+  f6:	e9 2e ff ff ff       	jmp    29 <main+0x29>
+  fb:	66 90                	xchg   %ax,%ax
+  fd:	66 90                	xchg   %ax,%ax
+  ff:	90                   	nop
+
+00000100 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 100:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 101:	31 c0                	xor    %eax,%eax
+{
+ 103:	89 e5                	mov    %esp,%ebp
+ 105:	53                   	push   %ebx
+ 106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 109:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 10c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 110:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 114:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 117:	83 c0 01             	add    $0x1,%eax
+ 11a:	84 d2                	test   %dl,%dl
+ 11c:	75 f2                	jne    110 <strcpy+0x10>
+    ;
+  return os;
+}
+ 11e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 121:	89 c8                	mov    %ecx,%eax
+ 123:	c9                   	leave
+ 124:	c3                   	ret
+ 125:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000130 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	53                   	push   %ebx
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+ 137:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 13a:	0f b6 02             	movzbl (%edx),%eax
+ 13d:	84 c0                	test   %al,%al
+ 13f:	75 17                	jne    158 <strcmp+0x28>
+ 141:	eb 3a                	jmp    17d <strcmp+0x4d>
+ 143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 147:	90                   	nop
+ 148:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 14c:	83 c2 01             	add    $0x1,%edx
+ 14f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 152:	84 c0                	test   %al,%al
+ 154:	74 1a                	je     170 <strcmp+0x40>
+    p++, q++;
+ 156:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 158:	0f b6 19             	movzbl (%ecx),%ebx
+ 15b:	38 c3                	cmp    %al,%bl
+ 15d:	74 e9                	je     148 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 15f:	29 d8                	sub    %ebx,%eax
+}
+ 161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 170:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 174:	31 c0                	xor    %eax,%eax
+ 176:	29 d8                	sub    %ebx,%eax
+}
+ 178:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 17b:	c9                   	leave
+ 17c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 17d:	0f b6 19             	movzbl (%ecx),%ebx
+ 180:	31 c0                	xor    %eax,%eax
+ 182:	eb db                	jmp    15f <strcmp+0x2f>
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 196:	80 3a 00             	cmpb   $0x0,(%edx)
+ 199:	74 15                	je     1b0 <strlen+0x20>
+ 19b:	31 c0                	xor    %eax,%eax
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+ 1a0:	83 c0 01             	add    $0x1,%eax
+ 1a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1a7:	89 c1                	mov    %eax,%ecx
+ 1a9:	75 f5                	jne    1a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1ab:	89 c8                	mov    %ecx,%eax
+ 1ad:	5d                   	pop    %ebp
+ 1ae:	c3                   	ret
+ 1af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1b0:	31 c9                	xor    %ecx,%ecx
+}
+ 1b2:	5d                   	pop    %ebp
+ 1b3:	89 c8                	mov    %ecx,%eax
+ 1b5:	c3                   	ret
+ 1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	57                   	push   %edi
+ 1c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cd:	89 d7                	mov    %edx,%edi
+ 1cf:	fc                   	cld
+ 1d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1d5:	89 d0                	mov    %edx,%eax
+ 1d7:	c9                   	leave
+ 1d8:	c3                   	ret
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ea:	0f b6 10             	movzbl (%eax),%edx
+ 1ed:	84 d2                	test   %dl,%dl
+ 1ef:	75 12                	jne    203 <strchr+0x23>
+ 1f1:	eb 1d                	jmp    210 <strchr+0x30>
+ 1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1f7:	90                   	nop
+ 1f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1fc:	83 c0 01             	add    $0x1,%eax
+ 1ff:	84 d2                	test   %dl,%dl
+ 201:	74 0d                	je     210 <strchr+0x30>
+    if(*s == c)
+ 203:	38 d1                	cmp    %dl,%cl
+ 205:	75 f1                	jne    1f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 207:	5d                   	pop    %ebp
+ 208:	c3                   	ret
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 210:	31 c0                	xor    %eax,%eax
+}
+ 212:	5d                   	pop    %ebp
+ 213:	c3                   	ret
+ 214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 21f:	90                   	nop
+
+00000220 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	57                   	push   %edi
+ 224:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 225:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 228:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 229:	31 db                	xor    %ebx,%ebx
+{
+ 22b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 22e:	eb 27                	jmp    257 <gets+0x37>
+    cc = read(0, &c, 1);
+ 230:	83 ec 04             	sub    $0x4,%esp
+ 233:	6a 01                	push   $0x1
+ 235:	56                   	push   %esi
+ 236:	6a 00                	push   $0x0
+ 238:	e8 42 02 00 00       	call   47f <read>
+    if(cc < 1)
+ 23d:	83 c4 10             	add    $0x10,%esp
+ 240:	85 c0                	test   %eax,%eax
+ 242:	7e 1d                	jle    261 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 244:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 24f:	3c 0a                	cmp    $0xa,%al
+ 251:	74 10                	je     263 <gets+0x43>
+ 253:	3c 0d                	cmp    $0xd,%al
+ 255:	74 0c                	je     263 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 257:	89 df                	mov    %ebx,%edi
+ 259:	83 c3 01             	add    $0x1,%ebx
+ 25c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 25f:	7c cf                	jl     230 <gets+0x10>
+ 261:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 26a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 26d:	5b                   	pop    %ebx
+ 26e:	5e                   	pop    %esi
+ 26f:	5f                   	pop    %edi
+ 270:	5d                   	pop    %ebp
+ 271:	c3                   	ret
+ 272:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	56                   	push   %esi
+ 284:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 285:	83 ec 08             	sub    $0x8,%esp
+ 288:	6a 00                	push   $0x0
+ 28a:	ff 75 08             	push   0x8(%ebp)
+ 28d:	e8 6f 02 00 00       	call   501 <open>
+  if(fd < 0)
+ 292:	83 c4 10             	add    $0x10,%esp
+ 295:	85 c0                	test   %eax,%eax
+ 297:	78 27                	js     2c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 299:	83 ec 08             	sub    $0x8,%esp
+ 29c:	ff 75 0c             	push   0xc(%ebp)
+ 29f:	89 c3                	mov    %eax,%ebx
+ 2a1:	50                   	push   %eax
+ 2a2:	e8 a8 02 00 00       	call   54f <fstat>
+  close(fd);
+ 2a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2ac:	e8 02 02 00 00       	call   4b3 <close>
+  return r;
+ 2b1:	83 c4 10             	add    $0x10,%esp
+}
+ 2b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2b7:	89 f0                	mov    %esi,%eax
+ 2b9:	5b                   	pop    %ebx
+ 2ba:	5e                   	pop    %esi
+ 2bb:	5d                   	pop    %ebp
+ 2bc:	c3                   	ret
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2c5:	eb ed                	jmp    2b4 <stat+0x34>
+ 2c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ce:	66 90                	xchg   %ax,%ax
+
+000002d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	53                   	push   %ebx
+ 2d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2d7:	0f be 02             	movsbl (%edx),%eax
+ 2da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2e5:	77 1e                	ja     305 <atoi+0x35>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2f0:	83 c2 01             	add    $0x1,%edx
+ 2f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2fa:	0f be 02             	movsbl (%edx),%eax
+ 2fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 300:	80 fb 09             	cmp    $0x9,%bl
+ 303:	76 eb                	jbe    2f0 <atoi+0x20>
+  return n;
+}
+ 305:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 308:	89 c8                	mov    %ecx,%eax
+ 30a:	c9                   	leave
+ 30b:	c3                   	ret
+ 30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+ 315:	8b 45 10             	mov    0x10(%ebp),%eax
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 31e:	85 c0                	test   %eax,%eax
+ 320:	7e 13                	jle    335 <memmove+0x25>
+ 322:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 324:	89 d7                	mov    %edx,%edi
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 330:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 331:	39 f8                	cmp    %edi,%eax
+ 333:	75 fb                	jne    330 <memmove+0x20>
+  return vdst;
+}
+ 335:	5e                   	pop    %esi
+ 336:	89 d0                	mov    %edx,%eax
+ 338:	5f                   	pop    %edi
+ 339:	5d                   	pop    %ebp
+ 33a:	c3                   	ret
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 346:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 349:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 350:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 353:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 356:	50                   	push   %eax
+ 357:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 35a:	50                   	push   %eax
+ 35b:	6a 00                	push   $0x0
+ 35d:	e8 8d 03 00 00       	call   6ef <setitimer>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	89 c2                	mov    %eax,%edx
+ 367:	31 c0                	xor    %eax,%eax
+ 369:	85 d2                	test   %edx,%edx
+ 36b:	78 03                	js     370 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 36d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 370:	c9                   	leave
+ 371:	c3                   	ret
+ 372:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 380:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 385:	c3                   	ret
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 390:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+ 3a5:	53                   	push   %ebx
+ 3a6:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 3a9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 3ad:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 3b0:	75 5e                	jne    410 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 3b2:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 3b8:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 3ba:	89 d3                	mov    %edx,%ebx
+ 3bc:	89 c1                	mov    %eax,%ecx
+ 3be:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 3c4:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 3ca:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 3cd:	31 d2                	xor    %edx,%edx
+ 3cf:	89 d8                	mov    %ebx,%eax
+ 3d1:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 3d4:	f7 f6                	div    %esi
+ 3d6:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 3d8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3db:	f7 f6                	div    %esi
+ 3dd:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 3df:	89 da                	mov    %ebx,%edx
+ 3e1:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 3e6:	f7 f3                	div    %ebx
+ 3e8:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 3ea:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 3ef:	89 d3                	mov    %edx,%ebx
+ 3f1:	f7 e1                	mul    %ecx
+ 3f3:	f7 f6                	div    %esi
+ 3f5:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 3fb:	01 c3                	add    %eax,%ebx
+  return 0;
+ 3fd:	31 c0                	xor    %eax,%eax
+ 3ff:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 402:	83 c4 0c             	add    $0xc,%esp
+ 405:	5b                   	pop    %ebx
+ 406:	5e                   	pop    %esi
+ 407:	5f                   	pop    %edi
+ 408:	5d                   	pop    %ebp
+ 409:	c3                   	ret
+ 40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 410:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 415:	eb eb                	jmp    402 <clock_gettime+0x62>
+
+00000417 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 417:	b8 01 00 00 00       	mov    $0x1,%eax
+ 41c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 423:	74 09                	je     42e <fork+0x17>
+ 425:	89 e1                	mov    %esp,%ecx
+ 427:	ba 30 04 00 00       	mov    $0x430,%edx
+ 42c:	0f 34                	sysenter
+ 42e:	cd 40                	int    $0x40
+ 430:	c3                   	ret
+
+00000431 <exit>:
+SYSCALL(exit)
+ 431:	b8 02 00 00 00       	mov    $0x2,%eax
+ 436:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 43d:	74 09                	je     448 <exit+0x17>
+ 43f:	89 e1                	mov    %esp,%ecx
+ 441:	ba 4a 04 00 00       	mov    $0x44a,%edx
+ 446:	0f 34                	sysenter
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <wait>:
+SYSCALL(wait)
+ 44b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 450:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 457:	74 09                	je     462 <wait+0x17>
+ 459:	89 e1                	mov    %esp,%ecx
+ 45b:	ba 64 04 00 00       	mov    $0x464,%edx
+ 460:	0f 34                	sysenter
+ 462:	cd 40                	int    $0x40
+ 464:	c3                   	ret
+
+00000465 <pipe>:
+SYSCALL(pipe)
+ 465:	b8 04 00 00 00       	mov    $0x4,%eax
+ 46a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 471:	74 09                	je     47c <pipe+0x17>
+ 473:	89 e1                	mov    %esp,%ecx
+ 475:	ba 7e 04 00 00       	mov    $0x47e,%edx
+ 47a:	0f 34                	sysenter
+ 47c:	cd 40                	int    $0x40
+ 47e:	c3                   	ret
+
+0000047f <read>:
+SYSCALL(read)
+ 47f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 484:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 48b:	74 09                	je     496 <read+0x17>
+ 48d:	89 e1                	mov    %esp,%ecx
+ 48f:	ba 98 04 00 00       	mov    $0x498,%edx
+ 494:	0f 34                	sysenter
+ 496:	cd 40                	int    $0x40
+ 498:	c3                   	ret
+
+00000499 <write>:
+SYSCALL(write)
+ 499:	b8 10 00 00 00       	mov    $0x10,%eax
+ 49e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4a5:	74 09                	je     4b0 <write+0x17>
+ 4a7:	89 e1                	mov    %esp,%ecx
+ 4a9:	ba b2 04 00 00       	mov    $0x4b2,%edx
+ 4ae:	0f 34                	sysenter
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <close>:
+SYSCALL(close)
+ 4b3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4b8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4bf:	74 09                	je     4ca <close+0x17>
+ 4c1:	89 e1                	mov    %esp,%ecx
+ 4c3:	ba cc 04 00 00       	mov    $0x4cc,%edx
+ 4c8:	0f 34                	sysenter
+ 4ca:	cd 40                	int    $0x40
+ 4cc:	c3                   	ret
+
+000004cd <kill>:
+SYSCALL(kill)
+ 4cd:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4d2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4d9:	74 09                	je     4e4 <kill+0x17>
+ 4db:	89 e1                	mov    %esp,%ecx
+ 4dd:	ba e6 04 00 00       	mov    $0x4e6,%edx
+ 4e2:	0f 34                	sysenter
+ 4e4:	cd 40                	int    $0x40
+ 4e6:	c3                   	ret
+
+000004e7 <exec>:
+SYSCALL(exec)
+ 4e7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4ec:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4f3:	74 09                	je     4fe <exec+0x17>
+ 4f5:	89 e1                	mov    %esp,%ecx
+ 4f7:	ba 00 05 00 00       	mov    $0x500,%edx
+ 4fc:	0f 34                	sysenter
+ 4fe:	cd 40                	int    $0x40
+ 500:	c3                   	ret
+
+00000501 <open>:
+SYSCALL(open)
+ 501:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 506:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 50d:	74 09                	je     518 <open+0x17>
+ 50f:	89 e1                	mov    %esp,%ecx
+ 511:	ba 1a 05 00 00       	mov    $0x51a,%edx
+ 516:	0f 34                	sysenter
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <mknod>:
+SYSCALL(mknod)
+ 51b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 520:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 527:	74 09                	je     532 <mknod+0x17>
+ 529:	89 e1                	mov    %esp,%ecx
+ 52b:	ba 34 05 00 00       	mov    $0x534,%edx
+ 530:	0f 34                	sysenter
+ 532:	cd 40                	int    $0x40
+ 534:	c3                   	ret
+
+00000535 <unlink>:
+SYSCALL(unlink)
+ 535:	b8 12 00 00 00       	mov    $0x12,%eax
+ 53a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 541:	74 09                	je     54c <unlink+0x17>
+ 543:	89 e1                	mov    %esp,%ecx
+ 545:	ba 4e 05 00 00       	mov    $0x54e,%edx
+ 54a:	0f 34                	sysenter
+ 54c:	cd 40                	int    $0x40
+ 54e:	c3                   	ret
+
+0000054f <fstat>:
+SYSCALL(fstat)
+ 54f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 554:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 55b:	74 09                	je     566 <fstat+0x17>
+ 55d:	89 e1                	mov    %esp,%ecx
+ 55f:	ba 68 05 00 00       	mov    $0x568,%edx
+ 564:	0f 34                	sysenter
+ 566:	cd 40                	int    $0x40
+ 568:	c3                   	ret
+
+00000569 <link>:
+SYSCALL(link)
+ 569:	b8 13 00 00 00       	mov    $0x13,%eax
+ 56e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 575:	74 09                	je     580 <link+0x17>
+ 577:	89 e1                	mov    %esp,%ecx
+ 579:	ba 82 05 00 00       	mov    $0x582,%edx
+ 57e:	0f 34                	sysenter
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <mkdir>:
+SYSCALL(mkdir)
+ 583:	b8 14 00 00 00       	mov    $0x14,%eax
+ 588:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 58f:	74 09                	je     59a <mkdir+0x17>
+ 591:	89 e1                	mov    %esp,%ecx
+ 593:	ba 9c 05 00 00       	mov    $0x59c,%edx
+ 598:	0f 34                	sysenter
+ 59a:	cd 40                	int    $0x40
+ 59c:	c3                   	ret
+
+0000059d <chdir>:
+SYSCALL(chdir)
+ 59d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5a2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5a9:	74 09                	je     5b4 <chdir+0x17>
+ 5ab:	89 e1                	mov    %esp,%ecx
+ 5ad:	ba b6 05 00 00       	mov    $0x5b6,%edx
+ 5b2:	0f 34                	sysenter
+ 5b4:	cd 40                	int    $0x40
+ 5b6:	c3                   	ret
+
+000005b7 <dup>:
+SYSCALL(dup)
+ 5b7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5bc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5c3:	74 09                	je     5ce <dup+0x17>
+ 5c5:	89 e1                	mov    %esp,%ecx
+ 5c7:	ba d0 05 00 00       	mov    $0x5d0,%edx
+ 5cc:	0f 34                	sysenter
+ 5ce:	cd 40                	int    $0x40
+ 5d0:	c3                   	ret
+
+000005d1 <sbrk>:
+SYSCALL(sbrk)
+ 5d1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5d6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5dd:	74 09                	je     5e8 <sbrk+0x17>
+ 5df:	89 e1                	mov    %esp,%ecx
+ 5e1:	ba ea 05 00 00       	mov    $0x5ea,%edx
+ 5e6:	0f 34                	sysenter
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <sleep>:
+SYSCALL(sleep)
+ 5eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5f0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5f7:	74 09                	je     602 <sleep+0x17>
+ 5f9:	89 e1                	mov    %esp,%ecx
+ 5fb:	ba 04 06 00 00       	mov    $0x604,%edx
+ 600:	0f 34                	sysenter
+ 602:	cd 40                	int    $0x40
+ 604:	c3                   	ret
+
+00000605 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 605:	b8 16 00 00 00       	mov    $0x16,%eax
+ 60a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 611:	74 09                	je     61c <sigprocmask+0x17>
+ 613:	89 e1                	mov    %esp,%ecx
+ 615:	ba 1e 06 00 00       	mov    $0x61e,%edx
+ 61a:	0f 34                	sysenter
+ 61c:	cd 40                	int    $0x40
+ 61e:	c3                   	ret
+
+0000061f <sigaction>:
+SYSCALL(sigaction)
+ 61f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 624:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 62b:	74 09                	je     636 <sigaction+0x17>
+ 62d:	89 e1                	mov    %esp,%ecx
+ 62f:	ba 38 06 00 00       	mov    $0x638,%edx
+ 634:	0f 34                	sysenter
+ 636:	cd 40                	int    $0x40
+ 638:	c3                   	ret
+
+00000639 <sigret>:
+SYSCALL(sigret)
+ 639:	b8 18 00 00 00       	mov    $0x18,%eax
+ 63e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 645:	74 09                	je     650 <sigret+0x17>
+ 647:	89 e1                	mov    %esp,%ecx
+ 649:	ba 52 06 00 00       	mov    $0x652,%edx
+ 64e:	0f 34                	sysenter
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <traceread>:
+SYSCALL(traceread)
+ 653:	b8 19 00 00 00       	mov    $0x19,%eax
+ 658:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 65f:	74 09                	je     66a <traceread+0x17>
+ 661:	89 e1                	mov    %esp,%ecx
+ 663:	ba 6c 06 00 00       	mov    $0x66c,%edx
+ 668:	0f 34                	sysenter
+ 66a:	cd 40                	int    $0x40
+ 66c:	c3                   	ret
+
+0000066d <sigqueue>:
+SYSCALL(sigqueue)
+ 66d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 672:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 679:	74 09                	je     684 <sigqueue+0x17>
+ 67b:	89 e1                	mov    %esp,%ecx
+ 67d:	ba 86 06 00 00       	mov    $0x686,%edx
+ 682:	0f 34                	sysenter
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <signalfd>:
+SYSCALL(signalfd)
+ 687:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 68c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 693:	74 09                	je     69e <signalfd+0x17>
+ 695:	89 e1                	mov    %esp,%ecx
+ 697:	ba a0 06 00 00       	mov    $0x6a0,%edx
+ 69c:	0f 34                	sysenter
+ 69e:	cd 40                	int    $0x40
+ 6a0:	c3                   	ret
+
+000006a1 <sigwait>:
+SYSCALL(sigwait)
+ 6a1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6a6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6ad:	74 09                	je     6b8 <sigwait+0x17>
+ 6af:	89 e1                	mov    %esp,%ecx
+ 6b1:	ba ba 06 00 00       	mov    $0x6ba,%edx
+ 6b6:	0f 34                	sysenter
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <sigsuspend>:
+SYSCALL(sigsuspend)
+ 6bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6c0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6c7:	74 09                	je     6d2 <sigsuspend+0x17>
+ 6c9:	89 e1                	mov    %esp,%ecx
+ 6cb:	ba d4 06 00 00       	mov    $0x6d4,%edx
+ 6d0:	0f 34                	sysenter
+ 6d2:	cd 40                	int    $0x40
+ 6d4:	c3                   	ret
+
+000006d5 <waitpid>:
+SYSCALL(waitpid)
+ 6d5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6da:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6e1:	74 09                	je     6ec <waitpid+0x17>
+ 6e3:	89 e1                	mov    %esp,%ecx
+ 6e5:	ba ee 06 00 00       	mov    $0x6ee,%edx
+ 6ea:	0f 34                	sysenter
+ 6ec:	cd 40                	int    $0x40
+ 6ee:	c3                   	ret
+
+000006ef <setitimer>:
+SYSCALL(setitimer)
+ 6ef:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6f4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6fb:	74 09                	je     706 <setitimer+0x17>
+ 6fd:	89 e1                	mov    %esp,%ecx
+ 6ff:	ba 08 07 00 00       	mov    $0x708,%edx
+ 704:	0f 34                	sysenter
+ 706:	cd 40                	int    $0x40
+ 708:	c3                   	ret
+
+00000709 <nanosleep>:
+SYSCALL(nanosleep)
+ 709:	b8 21 00 00 00       	mov    $0x21,%eax
+ 70e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 715:	74 09                	je     720 <nanosleep+0x17>
+ 717:	89 e1                	mov    %esp,%ecx
+ 719:	ba 22 07 00 00       	mov    $0x722,%edx
+ 71e:	0f 34                	sysenter
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <mmap>:
+SYSCALL(mmap)
+ 723:	b8 22 00 00 00       	mov    $0x22,%eax
+ 728:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 72f:	74 09                	je     73a <mmap+0x17>
+ 731:	89 e1                	mov    %esp,%ecx
+ 733:	ba 3c 07 00 00       	mov    $0x73c,%edx
+ 738:	0f 34                	sysenter
+ 73a:	cd 40                	int    $0x40
+ 73c:	c3                   	ret
+
+0000073d <munmap>:
+SYSCALL(munmap)
+ 73d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 742:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 749:	74 09                	je     754 <munmap+0x17>
+ 74b:	89 e1                	mov    %esp,%ecx
+ 74d:	ba 56 07 00 00       	mov    $0x756,%edx
+ 752:	0f 34                	sysenter
+ 754:	cd 40                	int    $0x40
+ 756:	c3                   	ret
+
+00000757 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 757:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 75c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 763:	74 09                	je     76e <getpid_syscall+0x17>
+ 765:	89 e1                	mov    %esp,%ecx
+ 767:	ba 70 07 00 00       	mov    $0x770,%edx
+ 76c:	0f 34                	sysenter
+ 76e:	cd 40                	int    $0x40
+ 770:	c3                   	ret
+
+00000771 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 771:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 776:	cd 40                	int    $0x40
+ 778:	c3                   	ret
+ 779:	66 90                	xchg   %ax,%ax
+ 77b:	66 90                	xchg   %ax,%ax
+ 77d:	66 90                	xchg   %ax,%ax
+ 77f:	90                   	nop
+
+00000780 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	56                   	push   %esi
+ 785:	53                   	push   %ebx
+ 786:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 788:	89 d1                	mov    %edx,%ecx
+{
+ 78a:	83 ec 3c             	sub    $0x3c,%esp
+ 78d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 790:	85 d2                	test   %edx,%edx
+ 792:	0f 89 80 00 00 00    	jns    818 <printint+0x98>
+ 798:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 79c:	74 7a                	je     818 <printint+0x98>
+    x = -xx;
+ 79e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7a8:	31 f6                	xor    %esi,%esi
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7b0:	89 c8                	mov    %ecx,%eax
+ 7b2:	31 d2                	xor    %edx,%edx
+ 7b4:	89 f7                	mov    %esi,%edi
+ 7b6:	f7 f3                	div    %ebx
+ 7b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7bb:	0f b6 92 f8 0b 00 00 	movzbl 0xbf8(%edx),%edx
+ 7c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7c6:	89 ca                	mov    %ecx,%edx
+ 7c8:	89 c1                	mov    %eax,%ecx
+ 7ca:	39 da                	cmp    %ebx,%edx
+ 7cc:	73 e2                	jae    7b0 <printint+0x30>
+  if(neg)
+ 7ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7d1:	85 c0                	test   %eax,%eax
+ 7d3:	74 07                	je     7dc <printint+0x5c>
+    buf[i++] = '-';
+ 7d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7da:	89 f7                	mov    %esi,%edi
+ 7dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7e2:	01 df                	add    %ebx,%edi
+ 7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7eb:	83 ec 04             	sub    $0x4,%esp
+ 7ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7f4:	6a 01                	push   $0x1
+ 7f6:	50                   	push   %eax
+ 7f7:	56                   	push   %esi
+ 7f8:	e8 9c fc ff ff       	call   499 <write>
+  while(--i >= 0)
+ 7fd:	89 f8                	mov    %edi,%eax
+ 7ff:	83 c4 10             	add    $0x10,%esp
+ 802:	83 ef 01             	sub    $0x1,%edi
+ 805:	39 d8                	cmp    %ebx,%eax
+ 807:	75 df                	jne    7e8 <printint+0x68>
+}
+ 809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 80c:	5b                   	pop    %ebx
+ 80d:	5e                   	pop    %esi
+ 80e:	5f                   	pop    %edi
+ 80f:	5d                   	pop    %ebp
+ 810:	c3                   	ret
+ 811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 818:	31 c0                	xor    %eax,%eax
+ 81a:	eb 89                	jmp    7a5 <printint+0x25>
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 829:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 82c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 82f:	0f b6 1e             	movzbl (%esi),%ebx
+ 832:	83 c6 01             	add    $0x1,%esi
+ 835:	84 db                	test   %bl,%bl
+ 837:	74 67                	je     8a0 <printf+0x80>
+ 839:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 83c:	31 d2                	xor    %edx,%edx
+ 83e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 841:	eb 34                	jmp    877 <printf+0x57>
+ 843:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 847:	90                   	nop
+ 848:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 84b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 850:	83 f8 25             	cmp    $0x25,%eax
+ 853:	74 18                	je     86d <printf+0x4d>
+  write(fd, &c, 1);
+ 855:	83 ec 04             	sub    $0x4,%esp
+ 858:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 85b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85e:	6a 01                	push   $0x1
+ 860:	50                   	push   %eax
+ 861:	57                   	push   %edi
+ 862:	e8 32 fc ff ff       	call   499 <write>
+ 867:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 86a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 86d:	0f b6 1e             	movzbl (%esi),%ebx
+ 870:	83 c6 01             	add    $0x1,%esi
+ 873:	84 db                	test   %bl,%bl
+ 875:	74 29                	je     8a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 877:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 87a:	85 d2                	test   %edx,%edx
+ 87c:	74 ca                	je     848 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 87e:	83 fa 25             	cmp    $0x25,%edx
+ 881:	75 ea                	jne    86d <printf+0x4d>
+      if(c == 'd'){
+ 883:	83 f8 25             	cmp    $0x25,%eax
+ 886:	0f 84 24 01 00 00    	je     9b0 <printf+0x190>
+ 88c:	83 e8 63             	sub    $0x63,%eax
+ 88f:	83 f8 15             	cmp    $0x15,%eax
+ 892:	77 1c                	ja     8b0 <printf+0x90>
+ 894:	ff 24 85 a0 0b 00 00 	jmp    *0xba0(,%eax,4)
+ 89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8a3:	5b                   	pop    %ebx
+ 8a4:	5e                   	pop    %esi
+ 8a5:	5f                   	pop    %edi
+ 8a6:	5d                   	pop    %ebp
+ 8a7:	c3                   	ret
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+  write(fd, &c, 1);
+ 8b0:	83 ec 04             	sub    $0x4,%esp
+ 8b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ba:	6a 01                	push   $0x1
+ 8bc:	52                   	push   %edx
+ 8bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8c0:	57                   	push   %edi
+ 8c1:	e8 d3 fb ff ff       	call   499 <write>
+ 8c6:	83 c4 0c             	add    $0xc,%esp
+ 8c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8cc:	6a 01                	push   $0x1
+ 8ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8d1:	52                   	push   %edx
+ 8d2:	57                   	push   %edi
+ 8d3:	e8 c1 fb ff ff       	call   499 <write>
+        putc(fd, c);
+ 8d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8db:	31 d2                	xor    %edx,%edx
+ 8dd:	eb 8e                	jmp    86d <printf+0x4d>
+ 8df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8eb:	8b 13                	mov    (%ebx),%edx
+ 8ed:	6a 00                	push   $0x0
+ 8ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8f4:	e8 87 fe ff ff       	call   780 <printint>
+        ap++;
+ 8f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ff:	31 d2                	xor    %edx,%edx
+ 901:	e9 67 ff ff ff       	jmp    86d <printf+0x4d>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 910:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 913:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 915:	83 c0 04             	add    $0x4,%eax
+ 918:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 91b:	85 db                	test   %ebx,%ebx
+ 91d:	0f 84 9d 00 00 00    	je     9c0 <printf+0x1a0>
+        while(*s != 0){
+ 923:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 926:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 928:	84 c0                	test   %al,%al
+ 92a:	0f 84 3d ff ff ff    	je     86d <printf+0x4d>
+ 930:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 933:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 936:	89 de                	mov    %ebx,%esi
+ 938:	89 d3                	mov    %edx,%ebx
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 946:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 949:	6a 01                	push   $0x1
+ 94b:	53                   	push   %ebx
+ 94c:	57                   	push   %edi
+ 94d:	e8 47 fb ff ff       	call   499 <write>
+        while(*s != 0){
+ 952:	0f b6 06             	movzbl (%esi),%eax
+ 955:	83 c4 10             	add    $0x10,%esp
+ 958:	84 c0                	test   %al,%al
+ 95a:	75 e4                	jne    940 <printf+0x120>
+      state = 0;
+ 95c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 95f:	31 d2                	xor    %edx,%edx
+ 961:	e9 07 ff ff ff       	jmp    86d <printf+0x4d>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 970:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 97b:	8b 13                	mov    (%ebx),%edx
+ 97d:	6a 01                	push   $0x1
+ 97f:	e9 6b ff ff ff       	jmp    8ef <printf+0xcf>
+ 984:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 988:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 98b:	83 ec 04             	sub    $0x4,%esp
+ 98e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 991:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 993:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 996:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 999:	6a 01                	push   $0x1
+ 99b:	52                   	push   %edx
+ 99c:	57                   	push   %edi
+ 99d:	e8 f7 fa ff ff       	call   499 <write>
+        ap++;
+ 9a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9a8:	31 d2                	xor    %edx,%edx
+ 9aa:	e9 be fe ff ff       	jmp    86d <printf+0x4d>
+ 9af:	90                   	nop
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	e9 11 ff ff ff       	jmp    8d1 <printf+0xb1>
+ 9c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9c5:	bb 98 0b 00 00       	mov    $0xb98,%ebx
+ 9ca:	e9 61 ff ff ff       	jmp    930 <printf+0x110>
+ 9cf:	90                   	nop
+
+000009d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9d1:	a1 18 0f 00 00       	mov    0xf18,%eax
+{
+ 9d6:	89 e5                	mov    %esp,%ebp
+ 9d8:	57                   	push   %edi
+ 9d9:	56                   	push   %esi
+ 9da:	53                   	push   %ebx
+ 9db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ec:	39 ca                	cmp    %ecx,%edx
+ 9ee:	73 30                	jae    a20 <free+0x50>
+ 9f0:	39 c1                	cmp    %eax,%ecx
+ 9f2:	72 04                	jb     9f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9f4:	39 c2                	cmp    %eax,%edx
+ 9f6:	72 f0                	jb     9e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9fe:	39 f8                	cmp    %edi,%eax
+ a00:	74 2e                	je     a30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a05:	8b 42 04             	mov    0x4(%edx),%eax
+ a08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a0b:	39 f1                	cmp    %esi,%ecx
+ a0d:	74 38                	je     a47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a11:	5b                   	pop    %ebx
+  freep = p;
+ a12:	89 15 18 0f 00 00    	mov    %edx,0xf18
+}
+ a18:	5e                   	pop    %esi
+ a19:	5f                   	pop    %edi
+ a1a:	5d                   	pop    %ebp
+ a1b:	c3                   	ret
+ a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a20:	39 c1                	cmp    %eax,%ecx
+ a22:	72 d0                	jb     9f4 <free+0x24>
+ a24:	eb c2                	jmp    9e8 <free+0x18>
+ a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a30:	03 70 04             	add    0x4(%eax),%esi
+ a33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a36:	8b 02                	mov    (%edx),%eax
+ a38:	8b 00                	mov    (%eax),%eax
+ a3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a3d:	8b 42 04             	mov    0x4(%edx),%eax
+ a40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a43:	39 f1                	cmp    %esi,%ecx
+ a45:	75 c8                	jne    a0f <free+0x3f>
+    p->s.size += bp->s.size;
+ a47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a4a:	89 15 18 0f 00 00    	mov    %edx,0xf18
+    p->s.size += bp->s.size;
+ a50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a56:	89 0a                	mov    %ecx,(%edx)
+}
+ a58:	5b                   	pop    %ebx
+ a59:	5e                   	pop    %esi
+ a5a:	5f                   	pop    %edi
+ a5b:	5d                   	pop    %ebp
+ a5c:	c3                   	ret
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a6c:	8b 15 18 0f 00 00    	mov    0xf18,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a72:	8d 78 07             	lea    0x7(%eax),%edi
+ a75:	c1 ef 03             	shr    $0x3,%edi
+ a78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a7b:	85 d2                	test   %edx,%edx
+ a7d:	0f 84 8d 00 00 00    	je     b10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a85:	8b 48 04             	mov    0x4(%eax),%ecx
+ a88:	39 f9                	cmp    %edi,%ecx
+ a8a:	73 64                	jae    af0 <malloc+0x90>
+  if(nu < 4096)
+ a8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a91:	39 df                	cmp    %ebx,%edi
+ a93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a9d:	eb 0a                	jmp    aa9 <malloc+0x49>
+ a9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ aa2:	8b 48 04             	mov    0x4(%eax),%ecx
+ aa5:	39 f9                	cmp    %edi,%ecx
+ aa7:	73 47                	jae    af0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ aa9:	89 c2                	mov    %eax,%edx
+ aab:	39 05 18 0f 00 00    	cmp    %eax,0xf18
+ ab1:	75 ed                	jne    aa0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ab3:	83 ec 0c             	sub    $0xc,%esp
+ ab6:	56                   	push   %esi
+ ab7:	e8 15 fb ff ff       	call   5d1 <sbrk>
+  if(p == (char*)-1)
+ abc:	83 c4 10             	add    $0x10,%esp
+ abf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ac2:	74 1c                	je     ae0 <malloc+0x80>
+  hp->s.size = nu;
+ ac4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ac7:	83 ec 0c             	sub    $0xc,%esp
+ aca:	83 c0 08             	add    $0x8,%eax
+ acd:	50                   	push   %eax
+ ace:	e8 fd fe ff ff       	call   9d0 <free>
+  return freep;
+ ad3:	8b 15 18 0f 00 00    	mov    0xf18,%edx
+      if((p = morecore(nunits)) == 0)
+ ad9:	83 c4 10             	add    $0x10,%esp
+ adc:	85 d2                	test   %edx,%edx
+ ade:	75 c0                	jne    aa0 <malloc+0x40>
+        return 0;
+  }
+}
+ ae0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ae3:	31 c0                	xor    %eax,%eax
+}
+ ae5:	5b                   	pop    %ebx
+ ae6:	5e                   	pop    %esi
+ ae7:	5f                   	pop    %edi
+ ae8:	5d                   	pop    %ebp
+ ae9:	c3                   	ret
+ aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ af0:	39 cf                	cmp    %ecx,%edi
+ af2:	74 4c                	je     b40 <malloc+0xe0>
+        p->s.size -= nunits;
+ af4:	29 f9                	sub    %edi,%ecx
+ af6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ af9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ afc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ aff:	89 15 18 0f 00 00    	mov    %edx,0xf18
+}
+ b05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b08:	83 c0 08             	add    $0x8,%eax
+}
+ b0b:	5b                   	pop    %ebx
+ b0c:	5e                   	pop    %esi
+ b0d:	5f                   	pop    %edi
+ b0e:	5d                   	pop    %ebp
+ b0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b10:	c7 05 18 0f 00 00 1c 	movl   $0xf1c,0xf18
+ b17:	0f 00 00 
+    base.s.size = 0;
+ b1a:	b8 1c 0f 00 00       	mov    $0xf1c,%eax
+    base.s.ptr = freep = prevp = &base;
+ b1f:	c7 05 1c 0f 00 00 1c 	movl   $0xf1c,0xf1c
+ b26:	0f 00 00 
+    base.s.size = 0;
+ b29:	c7 05 20 0f 00 00 00 	movl   $0x0,0xf20
+ b30:	00 00 00 
+    if(p->s.size >= nunits){
+ b33:	e9 54 ff ff ff       	jmp    a8c <malloc+0x2c>
+ b38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b40:	8b 08                	mov    (%eax),%ecx
+ b42:	89 0a                	mov    %ecx,(%edx)
+ b44:	eb b9                	jmp    aff <malloc+0x9f>
@@ -1,6 +1,10 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
 // and pipe buffers. Allocates 4096-byte pages.
+// Each page has a reference count so that copy-on-write fork
+// (see copyuvm) can share user pages: kalloc() sets it to 1,
+// kref() adds a reference, and kfree() drops one and frees the
+// page when none are left.
 
 #include "types.h"
 #include "defs.h"
@@ -21,6 +25,7 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  ushort ref[PHYSTOP / PGSIZE];  // References to each physical page
 } kmem;
 
 // Initialization happens in two phases.
@@ -48,22 +53,39 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    kmem.ref[V2P(p) / PGSIZE] = 1;
     kfree(p);
+  }
 }
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
+// Drop a reference to the page of physical memory pointed
+// at by v, which normally should have been returned by a
+// call to kalloc(), and free it if that was the last one.
+// (The exception is when initializing the allocator; see
+// kinit above.)
 void
 kfree(char *v)
 {
   struct run *r;
+  ushort *ref;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  ref = &kmem.ref[V2P(v) / PGSIZE];
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(*ref == 0)
+    panic("kfree: free page");
+  if(--*ref > 0){
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return;
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
 
@@ -79,6 +101,8 @@ kfree(char *v)
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
+// When the free list is empty, program pages that only the page
+// cache holds (see pcache.c) are given back first.
 char*
 kalloc(void)
 {
@@ -87,10 +111,39 @@ kalloc(void)
   if(kmem.use_lock)
     acquire(&kmem.lock);
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.ref[V2P(r) / PGSIZE] = 1;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
+  if(r == 0 && kmem.use_lock && pcachereclaim() > 0)
+    return kalloc();
   return (char*)r;
 }
 
+// Add a reference to the allocated page pointed at by v.
+void
+kref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kref");
+  acquire(&kmem.lock);
+  if(kmem.ref[V2P(v) / PGSIZE] == 0)
+    panic("kref: free page");
+  kmem.ref[V2P(v) / PGSIZE]++;
+  release(&kmem.lock);
+}
+
+// Number of references to the page pointed at by v.
+int
+krefcount(char *v)
+{
+  int n;
+
+  acquire(&kmem.lock);
+  n = kmem.ref[V2P(v) / PGSIZE];
+  release(&kmem.lock);
+  return n;
+}
+
@@ -9,6 +9,8 @@
 #include "traps.h"
 #include "mmu.h"
 #include "x86.h"
+#include "proc.h"
+#include "vdso.h"
 
 // Local APIC registers, divided by 4 for use as uint[] indices.
 #define ID      (0x0020/4)   // ID
@@ -43,6 +45,16 @@
 
 volatile uint *lapic;  // Initialized in mp.c
 
+// Clock calibration, measured once by the boot CPU.
+uint tsckhz;    // TSC cycles per millisecond
+uint lapickhz;  // LAPIC timer counts per millisecond
+uint64 tsc0;    // TSC at calibration; CLOCK_MONOTONIC counts from here
+
+#define PIT_HZ  1193182      // 8253 PIT input clock
+#define PIT_CH2 0x42         // PIT channel 2 data port
+#define PIT_CMD 0x43         // PIT mode/command port
+#define PORTB   0x61         // Channel 2 gate (bit 0) and output (bit 5)
+
 //PAGEBREAK!
 static void
 lapicw(int index, int value)
@@ -51,6 +63,35 @@ lapicw(int index, int value)
   lapic[ID];  // wait for write to finish, by reading
 }
 
+// Measure the TSC and LAPIC timer rates against a 10 ms one-shot
+// countdown of PIT channel 2, whose input clock is fixed.
+static void
+calibrate(void)
+{
+  uint64 t0, t1;
+  uint l0, l1, latch;
+
+  latch = PIT_HZ / (1000 / TICKMS);
+  outb(PORTB, (inb(PORTB) & ~0x02) | 0x01);  // gate on, speaker off
+  outb(PIT_CMD, 0xB0);                       // channel 2, mode 0, lo/hi
+  outb(PIT_CH2, latch & 0xFF);
+  outb(PIT_CH2, latch >> 8);
+
+  lapicw(TDCR, X1);
+  lapicw(TIMER, MASKED);
+  lapicw(TICR, 0xFFFFFFFF);
+  l0 = lapic[TCCR];
+  t0 = rdtsc();
+  while((inb(PORTB) & 0x20) == 0)
+    ;
+  l1 = lapic[TCCR];
+  t1 = rdtsc();
+
+  tsckhz = divl(t1 - t0, TICKMS, 0);
+  lapickhz = (l0 - l1) / TICKMS;
+  tsc0 = t1;
+}
+
 void
 lapicinit(void)
 {
@@ -60,13 +101,16 @@ lapicinit(void)
   // Enable local APIC; set spurious interrupt vector.
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
-  // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // The timer counts down once at bus frequency from lapic[TICR]
+  // and then issues an interrupt. lapicarm() reloads it for the next
+  // tick, or sooner for an hrtimerset() deadline, so clock ticks are
+  // kept on TSC time rather than counted interrupts.
+  if(tsckhz == 0)
+    calibrate();
   lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  mycpu()->nexttick = rdtsc() + (uint64)tsckhz * TICKMS;
+  lapicw(TICR, lapickhz * TICKMS);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -113,6 +157,59 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Called on each LAPIC timer interrupt. Returns the number of clock
+// ticks that have come due on this CPU since the last call, which is
+// 0 when the interrupt was only for an hrtimerset() deadline.
+int
+lapictick(void)
+{
+  struct cpu *c = mycpu();
+  uint64 now;
+  int n;
+
+  now = rdtsc();
+  for(n = 0; now >= c->nexttick; n++)
+    c->nexttick += (uint64)tsckhz * TICKMS;
+  return n;
+}
+
+// Program this CPU's one-shot timer to fire at the next clock tick,
+// or at TSC value deadline if that is non-zero and sooner.
+void
+lapicarm(uint64 deadline)
+{
+  struct cpu *c = mycpu();
+  uint64 when, now;
+  uint n;
+
+  when = c->nexttick;
+  if(deadline && deadline < when)
+    when = deadline;
+  now = rdtsc();
+  n = 1;
+  if(when > now)
+    n = divl((when - now) * lapickhz, tsckhz, 0) + 1;
+  lapicw(TICR, n);
+}
+
+// Convert a TSC interval to seconds and nanoseconds.
+void
+tsc2ts(uint64 cycles, struct timespec *ts)
+{
+  vdso_tsc2ts(cycles, tsckhz, ts);
+}
+
+// Convert seconds and nanoseconds (below one second) to a TSC interval.
+uint64
+ts2tsc(struct timespec *ts)
+{
+  uint ms;
+
+  ms = ts->tv_nsec / 1000000;
+  return ((uint64)ts->tv_sec * 1000 + ms) * tsckhz +
+         divl((uint64)(ts->tv_nsec - ms * 1000000) * tsckhz, 1000000, 0);
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
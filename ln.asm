@@ -0,0 +1,1523 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 1a                	je     31 <main+0x31>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 b8 0a 00 00       	push   $0xab8
+  1e:	6a 02                	push   $0x2
+  20:	e8 6b 07 00 00       	call   790 <printf>
+    exit(1);
+  25:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  2c:	e8 70 03 00 00       	call   3a1 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0){
+  31:	50                   	push   %eax
+  32:	50                   	push   %eax
+  33:	ff 73 08             	push   0x8(%ebx)
+  36:	ff 73 04             	push   0x4(%ebx)
+  39:	e8 9b 04 00 00       	call   4d9 <link>
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	85 c0                	test   %eax,%eax
+  43:	78 0a                	js     4f <main+0x4f>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+    exit(1);
+  }
+  exit(0);
+  45:	83 ec 0c             	sub    $0xc,%esp
+  48:	6a 00                	push   $0x0
+  4a:	e8 52 03 00 00       	call   3a1 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  4f:	ff 73 08             	push   0x8(%ebx)
+  52:	ff 73 04             	push   0x4(%ebx)
+  55:	68 cb 0a 00 00       	push   $0xacb
+  5a:	6a 02                	push   $0x2
+  5c:	e8 2f 07 00 00       	call   790 <printf>
+    exit(1);
+  61:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  68:	e8 34 03 00 00       	call   3a1 <exit>
+  6d:	66 90                	xchg   %ax,%ax
+  6f:	90                   	nop
+
+00000070 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 42 02 00 00       	call   3ef <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 6f 02 00 00       	call   471 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 a8 02 00 00       	call   4bf <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 02 02 00 00       	call   423 <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 2b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 2b9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 2c0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 2c3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 2c6:	50                   	push   %eax
+ 2c7:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 2ca:	50                   	push   %eax
+ 2cb:	6a 00                	push   $0x0
+ 2cd:	e8 8d 03 00 00       	call   65f <setitimer>
+ 2d2:	83 c4 10             	add    $0x10,%esp
+ 2d5:	89 c2                	mov    %eax,%edx
+ 2d7:	31 c0                	xor    %eax,%eax
+ 2d9:	85 d2                	test   %edx,%edx
+ 2db:	78 03                	js     2e0 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 2dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2e0:	c9                   	leave
+ 2e1:	c3                   	ret
+ 2e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 2f0:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 2f5:	c3                   	ret
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000300 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 300:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+ 315:	53                   	push   %ebx
+ 316:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 319:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 31d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 320:	75 5e                	jne    380 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 322:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 328:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 32a:	89 d3                	mov    %edx,%ebx
+ 32c:	89 c1                	mov    %eax,%ecx
+ 32e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 334:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 33a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 33d:	31 d2                	xor    %edx,%edx
+ 33f:	89 d8                	mov    %ebx,%eax
+ 341:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 344:	f7 f6                	div    %esi
+ 346:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 348:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 34b:	f7 f6                	div    %esi
+ 34d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 34f:	89 da                	mov    %ebx,%edx
+ 351:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 356:	f7 f3                	div    %ebx
+ 358:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 35a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 35f:	89 d3                	mov    %edx,%ebx
+ 361:	f7 e1                	mul    %ecx
+ 363:	f7 f6                	div    %esi
+ 365:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 36b:	01 c3                	add    %eax,%ebx
+  return 0;
+ 36d:	31 c0                	xor    %eax,%eax
+ 36f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 372:	83 c4 0c             	add    $0xc,%esp
+ 375:	5b                   	pop    %ebx
+ 376:	5e                   	pop    %esi
+ 377:	5f                   	pop    %edi
+ 378:	5d                   	pop    %ebp
+ 379:	c3                   	ret
+ 37a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 380:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 385:	eb eb                	jmp    372 <clock_gettime+0x62>
+
+00000387 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 387:	b8 01 00 00 00       	mov    $0x1,%eax
+ 38c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 393:	74 09                	je     39e <fork+0x17>
+ 395:	89 e1                	mov    %esp,%ecx
+ 397:	ba a0 03 00 00       	mov    $0x3a0,%edx
+ 39c:	0f 34                	sysenter
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <exit>:
+SYSCALL(exit)
+ 3a1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3a6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3ad:	74 09                	je     3b8 <exit+0x17>
+ 3af:	89 e1                	mov    %esp,%ecx
+ 3b1:	ba ba 03 00 00       	mov    $0x3ba,%edx
+ 3b6:	0f 34                	sysenter
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <wait>:
+SYSCALL(wait)
+ 3bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3c0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3c7:	74 09                	je     3d2 <wait+0x17>
+ 3c9:	89 e1                	mov    %esp,%ecx
+ 3cb:	ba d4 03 00 00       	mov    $0x3d4,%edx
+ 3d0:	0f 34                	sysenter
+ 3d2:	cd 40                	int    $0x40
+ 3d4:	c3                   	ret
+
+000003d5 <pipe>:
+SYSCALL(pipe)
+ 3d5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3da:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3e1:	74 09                	je     3ec <pipe+0x17>
+ 3e3:	89 e1                	mov    %esp,%ecx
+ 3e5:	ba ee 03 00 00       	mov    $0x3ee,%edx
+ 3ea:	0f 34                	sysenter
+ 3ec:	cd 40                	int    $0x40
+ 3ee:	c3                   	ret
+
+000003ef <read>:
+SYSCALL(read)
+ 3ef:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3f4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3fb:	74 09                	je     406 <read+0x17>
+ 3fd:	89 e1                	mov    %esp,%ecx
+ 3ff:	ba 08 04 00 00       	mov    $0x408,%edx
+ 404:	0f 34                	sysenter
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <write>:
+SYSCALL(write)
+ 409:	b8 10 00 00 00       	mov    $0x10,%eax
+ 40e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 415:	74 09                	je     420 <write+0x17>
+ 417:	89 e1                	mov    %esp,%ecx
+ 419:	ba 22 04 00 00       	mov    $0x422,%edx
+ 41e:	0f 34                	sysenter
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <close>:
+SYSCALL(close)
+ 423:	b8 15 00 00 00       	mov    $0x15,%eax
+ 428:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 42f:	74 09                	je     43a <close+0x17>
+ 431:	89 e1                	mov    %esp,%ecx
+ 433:	ba 3c 04 00 00       	mov    $0x43c,%edx
+ 438:	0f 34                	sysenter
+ 43a:	cd 40                	int    $0x40
+ 43c:	c3                   	ret
+
+0000043d <kill>:
+SYSCALL(kill)
+ 43d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 442:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 449:	74 09                	je     454 <kill+0x17>
+ 44b:	89 e1                	mov    %esp,%ecx
+ 44d:	ba 56 04 00 00       	mov    $0x456,%edx
+ 452:	0f 34                	sysenter
+ 454:	cd 40                	int    $0x40
+ 456:	c3                   	ret
+
+00000457 <exec>:
+SYSCALL(exec)
+ 457:	b8 07 00 00 00       	mov    $0x7,%eax
+ 45c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 463:	74 09                	je     46e <exec+0x17>
+ 465:	89 e1                	mov    %esp,%ecx
+ 467:	ba 70 04 00 00       	mov    $0x470,%edx
+ 46c:	0f 34                	sysenter
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <open>:
+SYSCALL(open)
+ 471:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 476:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 47d:	74 09                	je     488 <open+0x17>
+ 47f:	89 e1                	mov    %esp,%ecx
+ 481:	ba 8a 04 00 00       	mov    $0x48a,%edx
+ 486:	0f 34                	sysenter
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <mknod>:
+SYSCALL(mknod)
+ 48b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 490:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 497:	74 09                	je     4a2 <mknod+0x17>
+ 499:	89 e1                	mov    %esp,%ecx
+ 49b:	ba a4 04 00 00       	mov    $0x4a4,%edx
+ 4a0:	0f 34                	sysenter
+ 4a2:	cd 40                	int    $0x40
+ 4a4:	c3                   	ret
+
+000004a5 <unlink>:
+SYSCALL(unlink)
+ 4a5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4aa:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4b1:	74 09                	je     4bc <unlink+0x17>
+ 4b3:	89 e1                	mov    %esp,%ecx
+ 4b5:	ba be 04 00 00       	mov    $0x4be,%edx
+ 4ba:	0f 34                	sysenter
+ 4bc:	cd 40                	int    $0x40
+ 4be:	c3                   	ret
+
+000004bf <fstat>:
+SYSCALL(fstat)
+ 4bf:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4c4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4cb:	74 09                	je     4d6 <fstat+0x17>
+ 4cd:	89 e1                	mov    %esp,%ecx
+ 4cf:	ba d8 04 00 00       	mov    $0x4d8,%edx
+ 4d4:	0f 34                	sysenter
+ 4d6:	cd 40                	int    $0x40
+ 4d8:	c3                   	ret
+
+000004d9 <link>:
+SYSCALL(link)
+ 4d9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4de:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4e5:	74 09                	je     4f0 <link+0x17>
+ 4e7:	89 e1                	mov    %esp,%ecx
+ 4e9:	ba f2 04 00 00       	mov    $0x4f2,%edx
+ 4ee:	0f 34                	sysenter
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <mkdir>:
+SYSCALL(mkdir)
+ 4f3:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4f8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4ff:	74 09                	je     50a <mkdir+0x17>
+ 501:	89 e1                	mov    %esp,%ecx
+ 503:	ba 0c 05 00 00       	mov    $0x50c,%edx
+ 508:	0f 34                	sysenter
+ 50a:	cd 40                	int    $0x40
+ 50c:	c3                   	ret
+
+0000050d <chdir>:
+SYSCALL(chdir)
+ 50d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 512:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 519:	74 09                	je     524 <chdir+0x17>
+ 51b:	89 e1                	mov    %esp,%ecx
+ 51d:	ba 26 05 00 00       	mov    $0x526,%edx
+ 522:	0f 34                	sysenter
+ 524:	cd 40                	int    $0x40
+ 526:	c3                   	ret
+
+00000527 <dup>:
+SYSCALL(dup)
+ 527:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 52c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 533:	74 09                	je     53e <dup+0x17>
+ 535:	89 e1                	mov    %esp,%ecx
+ 537:	ba 40 05 00 00       	mov    $0x540,%edx
+ 53c:	0f 34                	sysenter
+ 53e:	cd 40                	int    $0x40
+ 540:	c3                   	ret
+
+00000541 <sbrk>:
+SYSCALL(sbrk)
+ 541:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 546:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 54d:	74 09                	je     558 <sbrk+0x17>
+ 54f:	89 e1                	mov    %esp,%ecx
+ 551:	ba 5a 05 00 00       	mov    $0x55a,%edx
+ 556:	0f 34                	sysenter
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <sleep>:
+SYSCALL(sleep)
+ 55b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 560:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 567:	74 09                	je     572 <sleep+0x17>
+ 569:	89 e1                	mov    %esp,%ecx
+ 56b:	ba 74 05 00 00       	mov    $0x574,%edx
+ 570:	0f 34                	sysenter
+ 572:	cd 40                	int    $0x40
+ 574:	c3                   	ret
+
+00000575 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 575:	b8 16 00 00 00       	mov    $0x16,%eax
+ 57a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 581:	74 09                	je     58c <sigprocmask+0x17>
+ 583:	89 e1                	mov    %esp,%ecx
+ 585:	ba 8e 05 00 00       	mov    $0x58e,%edx
+ 58a:	0f 34                	sysenter
+ 58c:	cd 40                	int    $0x40
+ 58e:	c3                   	ret
+
+0000058f <sigaction>:
+SYSCALL(sigaction)
+ 58f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 594:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 59b:	74 09                	je     5a6 <sigaction+0x17>
+ 59d:	89 e1                	mov    %esp,%ecx
+ 59f:	ba a8 05 00 00       	mov    $0x5a8,%edx
+ 5a4:	0f 34                	sysenter
+ 5a6:	cd 40                	int    $0x40
+ 5a8:	c3                   	ret
+
+000005a9 <sigret>:
+SYSCALL(sigret)
+ 5a9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5ae:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5b5:	74 09                	je     5c0 <sigret+0x17>
+ 5b7:	89 e1                	mov    %esp,%ecx
+ 5b9:	ba c2 05 00 00       	mov    $0x5c2,%edx
+ 5be:	0f 34                	sysenter
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <traceread>:
+SYSCALL(traceread)
+ 5c3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5c8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5cf:	74 09                	je     5da <traceread+0x17>
+ 5d1:	89 e1                	mov    %esp,%ecx
+ 5d3:	ba dc 05 00 00       	mov    $0x5dc,%edx
+ 5d8:	0f 34                	sysenter
+ 5da:	cd 40                	int    $0x40
+ 5dc:	c3                   	ret
+
+000005dd <sigqueue>:
+SYSCALL(sigqueue)
+ 5dd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5e2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5e9:	74 09                	je     5f4 <sigqueue+0x17>
+ 5eb:	89 e1                	mov    %esp,%ecx
+ 5ed:	ba f6 05 00 00       	mov    $0x5f6,%edx
+ 5f2:	0f 34                	sysenter
+ 5f4:	cd 40                	int    $0x40
+ 5f6:	c3                   	ret
+
+000005f7 <signalfd>:
+SYSCALL(signalfd)
+ 5f7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5fc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 603:	74 09                	je     60e <signalfd+0x17>
+ 605:	89 e1                	mov    %esp,%ecx
+ 607:	ba 10 06 00 00       	mov    $0x610,%edx
+ 60c:	0f 34                	sysenter
+ 60e:	cd 40                	int    $0x40
+ 610:	c3                   	ret
+
+00000611 <sigwait>:
+SYSCALL(sigwait)
+ 611:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 616:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 61d:	74 09                	je     628 <sigwait+0x17>
+ 61f:	89 e1                	mov    %esp,%ecx
+ 621:	ba 2a 06 00 00       	mov    $0x62a,%edx
+ 626:	0f 34                	sysenter
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <sigsuspend>:
+SYSCALL(sigsuspend)
+ 62b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 630:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 637:	74 09                	je     642 <sigsuspend+0x17>
+ 639:	89 e1                	mov    %esp,%ecx
+ 63b:	ba 44 06 00 00       	mov    $0x644,%edx
+ 640:	0f 34                	sysenter
+ 642:	cd 40                	int    $0x40
+ 644:	c3                   	ret
+
+00000645 <waitpid>:
+SYSCALL(waitpid)
+ 645:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 64a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 651:	74 09                	je     65c <waitpid+0x17>
+ 653:	89 e1                	mov    %esp,%ecx
+ 655:	ba 5e 06 00 00       	mov    $0x65e,%edx
+ 65a:	0f 34                	sysenter
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <setitimer>:
+SYSCALL(setitimer)
+ 65f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 664:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 66b:	74 09                	je     676 <setitimer+0x17>
+ 66d:	89 e1                	mov    %esp,%ecx
+ 66f:	ba 78 06 00 00       	mov    $0x678,%edx
+ 674:	0f 34                	sysenter
+ 676:	cd 40                	int    $0x40
+ 678:	c3                   	ret
+
+00000679 <nanosleep>:
+SYSCALL(nanosleep)
+ 679:	b8 21 00 00 00       	mov    $0x21,%eax
+ 67e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 685:	74 09                	je     690 <nanosleep+0x17>
+ 687:	89 e1                	mov    %esp,%ecx
+ 689:	ba 92 06 00 00       	mov    $0x692,%edx
+ 68e:	0f 34                	sysenter
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <mmap>:
+SYSCALL(mmap)
+ 693:	b8 22 00 00 00       	mov    $0x22,%eax
+ 698:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 69f:	74 09                	je     6aa <mmap+0x17>
+ 6a1:	89 e1                	mov    %esp,%ecx
+ 6a3:	ba ac 06 00 00       	mov    $0x6ac,%edx
+ 6a8:	0f 34                	sysenter
+ 6aa:	cd 40                	int    $0x40
+ 6ac:	c3                   	ret
+
+000006ad <munmap>:
+SYSCALL(munmap)
+ 6ad:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6b2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6b9:	74 09                	je     6c4 <munmap+0x17>
+ 6bb:	89 e1                	mov    %esp,%ecx
+ 6bd:	ba c6 06 00 00       	mov    $0x6c6,%edx
+ 6c2:	0f 34                	sysenter
+ 6c4:	cd 40                	int    $0x40
+ 6c6:	c3                   	ret
+
+000006c7 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 6c7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6cc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6d3:	74 09                	je     6de <getpid_syscall+0x17>
+ 6d5:	89 e1                	mov    %esp,%ecx
+ 6d7:	ba e0 06 00 00       	mov    $0x6e0,%edx
+ 6dc:	0f 34                	sysenter
+ 6de:	cd 40                	int    $0x40
+ 6e0:	c3                   	ret
+
+000006e1 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 6e1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6e6:	cd 40                	int    $0x40
+ 6e8:	c3                   	ret
+ 6e9:	66 90                	xchg   %ax,%ax
+ 6eb:	66 90                	xchg   %ax,%ax
+ 6ed:	66 90                	xchg   %ax,%ax
+ 6ef:	90                   	nop
+
+000006f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	53                   	push   %ebx
+ 6f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6f8:	89 d1                	mov    %edx,%ecx
+{
+ 6fa:	83 ec 3c             	sub    $0x3c,%esp
+ 6fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 700:	85 d2                	test   %edx,%edx
+ 702:	0f 89 80 00 00 00    	jns    788 <printint+0x98>
+ 708:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 70c:	74 7a                	je     788 <printint+0x98>
+    x = -xx;
+ 70e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 710:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 715:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 718:	31 f6                	xor    %esi,%esi
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 720:	89 c8                	mov    %ecx,%eax
+ 722:	31 d2                	xor    %edx,%edx
+ 724:	89 f7                	mov    %esi,%edi
+ 726:	f7 f3                	div    %ebx
+ 728:	8d 76 01             	lea    0x1(%esi),%esi
+ 72b:	0f b6 92 40 0b 00 00 	movzbl 0xb40(%edx),%edx
+ 732:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 736:	89 ca                	mov    %ecx,%edx
+ 738:	89 c1                	mov    %eax,%ecx
+ 73a:	39 da                	cmp    %ebx,%edx
+ 73c:	73 e2                	jae    720 <printint+0x30>
+  if(neg)
+ 73e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 741:	85 c0                	test   %eax,%eax
+ 743:	74 07                	je     74c <printint+0x5c>
+    buf[i++] = '-';
+ 745:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 74a:	89 f7                	mov    %esi,%edi
+ 74c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 74f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 752:	01 df                	add    %ebx,%edi
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 758:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 761:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 764:	6a 01                	push   $0x1
+ 766:	50                   	push   %eax
+ 767:	56                   	push   %esi
+ 768:	e8 9c fc ff ff       	call   409 <write>
+  while(--i >= 0)
+ 76d:	89 f8                	mov    %edi,%eax
+ 76f:	83 c4 10             	add    $0x10,%esp
+ 772:	83 ef 01             	sub    $0x1,%edi
+ 775:	39 d8                	cmp    %ebx,%eax
+ 777:	75 df                	jne    758 <printint+0x68>
+}
+ 779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 77c:	5b                   	pop    %ebx
+ 77d:	5e                   	pop    %esi
+ 77e:	5f                   	pop    %edi
+ 77f:	5d                   	pop    %ebp
+ 780:	c3                   	ret
+ 781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 788:	31 c0                	xor    %eax,%eax
+ 78a:	eb 89                	jmp    715 <printint+0x25>
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 799:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 79c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 79f:	0f b6 1e             	movzbl (%esi),%ebx
+ 7a2:	83 c6 01             	add    $0x1,%esi
+ 7a5:	84 db                	test   %bl,%bl
+ 7a7:	74 67                	je     810 <printf+0x80>
+ 7a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7ac:	31 d2                	xor    %edx,%edx
+ 7ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7b1:	eb 34                	jmp    7e7 <printf+0x57>
+ 7b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7b7:	90                   	nop
+ 7b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7c0:	83 f8 25             	cmp    $0x25,%eax
+ 7c3:	74 18                	je     7dd <printf+0x4d>
+  write(fd, &c, 1);
+ 7c5:	83 ec 04             	sub    $0x4,%esp
+ 7c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ce:	6a 01                	push   $0x1
+ 7d0:	50                   	push   %eax
+ 7d1:	57                   	push   %edi
+ 7d2:	e8 32 fc ff ff       	call   409 <write>
+ 7d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 7e0:	83 c6 01             	add    $0x1,%esi
+ 7e3:	84 db                	test   %bl,%bl
+ 7e5:	74 29                	je     810 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ea:	85 d2                	test   %edx,%edx
+ 7ec:	74 ca                	je     7b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ee:	83 fa 25             	cmp    $0x25,%edx
+ 7f1:	75 ea                	jne    7dd <printf+0x4d>
+      if(c == 'd'){
+ 7f3:	83 f8 25             	cmp    $0x25,%eax
+ 7f6:	0f 84 24 01 00 00    	je     920 <printf+0x190>
+ 7fc:	83 e8 63             	sub    $0x63,%eax
+ 7ff:	83 f8 15             	cmp    $0x15,%eax
+ 802:	77 1c                	ja     820 <printf+0x90>
+ 804:	ff 24 85 e8 0a 00 00 	jmp    *0xae8(,%eax,4)
+ 80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 810:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 813:	5b                   	pop    %ebx
+ 814:	5e                   	pop    %esi
+ 815:	5f                   	pop    %edi
+ 816:	5d                   	pop    %ebp
+ 817:	c3                   	ret
+ 818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+  write(fd, &c, 1);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 826:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 82a:	6a 01                	push   $0x1
+ 82c:	52                   	push   %edx
+ 82d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 830:	57                   	push   %edi
+ 831:	e8 d3 fb ff ff       	call   409 <write>
+ 836:	83 c4 0c             	add    $0xc,%esp
+ 839:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 83c:	6a 01                	push   $0x1
+ 83e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 841:	52                   	push   %edx
+ 842:	57                   	push   %edi
+ 843:	e8 c1 fb ff ff       	call   409 <write>
+        putc(fd, c);
+ 848:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 84b:	31 d2                	xor    %edx,%edx
+ 84d:	eb 8e                	jmp    7dd <printf+0x4d>
+ 84f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 850:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 853:	83 ec 0c             	sub    $0xc,%esp
+ 856:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 85b:	8b 13                	mov    (%ebx),%edx
+ 85d:	6a 00                	push   $0x0
+ 85f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 861:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 864:	e8 87 fe ff ff       	call   6f0 <printint>
+        ap++;
+ 869:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 86c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86f:	31 d2                	xor    %edx,%edx
+ 871:	e9 67 ff ff ff       	jmp    7dd <printf+0x4d>
+ 876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 880:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 883:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 885:	83 c0 04             	add    $0x4,%eax
+ 888:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 88b:	85 db                	test   %ebx,%ebx
+ 88d:	0f 84 9d 00 00 00    	je     930 <printf+0x1a0>
+        while(*s != 0){
+ 893:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 896:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 898:	84 c0                	test   %al,%al
+ 89a:	0f 84 3d ff ff ff    	je     7dd <printf+0x4d>
+ 8a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8a6:	89 de                	mov    %ebx,%esi
+ 8a8:	89 d3                	mov    %edx,%ebx
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8b0:	83 ec 04             	sub    $0x4,%esp
+ 8b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8b9:	6a 01                	push   $0x1
+ 8bb:	53                   	push   %ebx
+ 8bc:	57                   	push   %edi
+ 8bd:	e8 47 fb ff ff       	call   409 <write>
+        while(*s != 0){
+ 8c2:	0f b6 06             	movzbl (%esi),%eax
+ 8c5:	83 c4 10             	add    $0x10,%esp
+ 8c8:	84 c0                	test   %al,%al
+ 8ca:	75 e4                	jne    8b0 <printf+0x120>
+      state = 0;
+ 8cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8cf:	31 d2                	xor    %edx,%edx
+ 8d1:	e9 07 ff ff ff       	jmp    7dd <printf+0x4d>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8eb:	8b 13                	mov    (%ebx),%edx
+ 8ed:	6a 01                	push   $0x1
+ 8ef:	e9 6b ff ff ff       	jmp    85f <printf+0xcf>
+ 8f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8fb:	83 ec 04             	sub    $0x4,%esp
+ 8fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 901:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 903:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 906:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 909:	6a 01                	push   $0x1
+ 90b:	52                   	push   %edx
+ 90c:	57                   	push   %edi
+ 90d:	e8 f7 fa ff ff       	call   409 <write>
+        ap++;
+ 912:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 915:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 918:	31 d2                	xor    %edx,%edx
+ 91a:	e9 be fe ff ff       	jmp    7dd <printf+0x4d>
+ 91f:	90                   	nop
+  write(fd, &c, 1);
+ 920:	83 ec 04             	sub    $0x4,%esp
+ 923:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 926:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 929:	6a 01                	push   $0x1
+ 92b:	e9 11 ff ff ff       	jmp    841 <printf+0xb1>
+ 930:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 935:	bb df 0a 00 00       	mov    $0xadf,%ebx
+ 93a:	e9 61 ff ff ff       	jmp    8a0 <printf+0x110>
+ 93f:	90                   	nop
+
+00000940 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 940:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 941:	a1 58 0e 00 00       	mov    0xe58,%eax
+{
+ 946:	89 e5                	mov    %esp,%ebp
+ 948:	57                   	push   %edi
+ 949:	56                   	push   %esi
+ 94a:	53                   	push   %ebx
+ 94b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 94e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 958:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 95a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 95c:	39 ca                	cmp    %ecx,%edx
+ 95e:	73 30                	jae    990 <free+0x50>
+ 960:	39 c1                	cmp    %eax,%ecx
+ 962:	72 04                	jb     968 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 964:	39 c2                	cmp    %eax,%edx
+ 966:	72 f0                	jb     958 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 968:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 96b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 96e:	39 f8                	cmp    %edi,%eax
+ 970:	74 2e                	je     9a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 972:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 975:	8b 42 04             	mov    0x4(%edx),%eax
+ 978:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 97b:	39 f1                	cmp    %esi,%ecx
+ 97d:	74 38                	je     9b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 97f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 981:	5b                   	pop    %ebx
+  freep = p;
+ 982:	89 15 58 0e 00 00    	mov    %edx,0xe58
+}
+ 988:	5e                   	pop    %esi
+ 989:	5f                   	pop    %edi
+ 98a:	5d                   	pop    %ebp
+ 98b:	c3                   	ret
+ 98c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 990:	39 c1                	cmp    %eax,%ecx
+ 992:	72 d0                	jb     964 <free+0x24>
+ 994:	eb c2                	jmp    958 <free+0x18>
+ 996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9a0:	03 70 04             	add    0x4(%eax),%esi
+ 9a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9a6:	8b 02                	mov    (%edx),%eax
+ 9a8:	8b 00                	mov    (%eax),%eax
+ 9aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 9b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9b3:	39 f1                	cmp    %esi,%ecx
+ 9b5:	75 c8                	jne    97f <free+0x3f>
+    p->s.size += bp->s.size;
+ 9b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9ba:	89 15 58 0e 00 00    	mov    %edx,0xe58
+    p->s.size += bp->s.size;
+ 9c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9c6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9c8:	5b                   	pop    %ebx
+ 9c9:	5e                   	pop    %esi
+ 9ca:	5f                   	pop    %edi
+ 9cb:	5d                   	pop    %ebp
+ 9cc:	c3                   	ret
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	57                   	push   %edi
+ 9d4:	56                   	push   %esi
+ 9d5:	53                   	push   %ebx
+ 9d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9dc:	8b 15 58 0e 00 00    	mov    0xe58,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9e2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9e5:	c1 ef 03             	shr    $0x3,%edi
+ 9e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9eb:	85 d2                	test   %edx,%edx
+ 9ed:	0f 84 8d 00 00 00    	je     a80 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9f5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9f8:	39 f9                	cmp    %edi,%ecx
+ 9fa:	73 64                	jae    a60 <malloc+0x90>
+  if(nu < 4096)
+ 9fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a01:	39 df                	cmp    %ebx,%edi
+ a03:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a06:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a0d:	eb 0a                	jmp    a19 <malloc+0x49>
+ a0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a10:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a12:	8b 48 04             	mov    0x4(%eax),%ecx
+ a15:	39 f9                	cmp    %edi,%ecx
+ a17:	73 47                	jae    a60 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a19:	89 c2                	mov    %eax,%edx
+ a1b:	39 05 58 0e 00 00    	cmp    %eax,0xe58
+ a21:	75 ed                	jne    a10 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a23:	83 ec 0c             	sub    $0xc,%esp
+ a26:	56                   	push   %esi
+ a27:	e8 15 fb ff ff       	call   541 <sbrk>
+  if(p == (char*)-1)
+ a2c:	83 c4 10             	add    $0x10,%esp
+ a2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a32:	74 1c                	je     a50 <malloc+0x80>
+  hp->s.size = nu;
+ a34:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a37:	83 ec 0c             	sub    $0xc,%esp
+ a3a:	83 c0 08             	add    $0x8,%eax
+ a3d:	50                   	push   %eax
+ a3e:	e8 fd fe ff ff       	call   940 <free>
+  return freep;
+ a43:	8b 15 58 0e 00 00    	mov    0xe58,%edx
+      if((p = morecore(nunits)) == 0)
+ a49:	83 c4 10             	add    $0x10,%esp
+ a4c:	85 d2                	test   %edx,%edx
+ a4e:	75 c0                	jne    a10 <malloc+0x40>
+        return 0;
+  }
+}
+ a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a53:	31 c0                	xor    %eax,%eax
+}
+ a55:	5b                   	pop    %ebx
+ a56:	5e                   	pop    %esi
+ a57:	5f                   	pop    %edi
+ a58:	5d                   	pop    %ebp
+ a59:	c3                   	ret
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a60:	39 cf                	cmp    %ecx,%edi
+ a62:	74 4c                	je     ab0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a64:	29 f9                	sub    %edi,%ecx
+ a66:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a69:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a6c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a6f:	89 15 58 0e 00 00    	mov    %edx,0xe58
+}
+ a75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a78:	83 c0 08             	add    $0x8,%eax
+}
+ a7b:	5b                   	pop    %ebx
+ a7c:	5e                   	pop    %esi
+ a7d:	5f                   	pop    %edi
+ a7e:	5d                   	pop    %ebp
+ a7f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a80:	c7 05 58 0e 00 00 5c 	movl   $0xe5c,0xe58
+ a87:	0e 00 00 
+    base.s.size = 0;
+ a8a:	b8 5c 0e 00 00       	mov    $0xe5c,%eax
+    base.s.ptr = freep = prevp = &base;
+ a8f:	c7 05 5c 0e 00 00 5c 	movl   $0xe5c,0xe5c
+ a96:	0e 00 00 
+    base.s.size = 0;
+ a99:	c7 05 60 0e 00 00 00 	movl   $0x0,0xe60
+ aa0:	00 00 00 
+    if(p->s.size >= nunits){
+ aa3:	e9 54 ff ff ff       	jmp    9fc <malloc+0x2c>
+ aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aaf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ab0:	8b 08                	mov    (%eax),%ecx
+ ab2:	89 0a                	mov    %ecx,(%edx)
+ ab4:	eb b9                	jmp    a6f <malloc+0x9f>
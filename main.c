@@ -18,17 +18,23 @@ int
 main(void)
 {
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
+  trampinit();     // signal return trampoline page
   kvmalloc();      // kernel page table
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
+  vdsoinit();      // clock page mapped into user space
   seginit();       // segment descriptors
   picinit();       // disable pic
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
   pinit();         // process table
+  traceinit();     // kernel event trace
+  timerinit();     // per-CPU timer wheels
   tvinit();        // trap vectors
   binit();         // buffer cache
+  pcacheinit();    // executable page cache
+  mmapinit();      // MAP_SHARED file pages
   fileinit();      // file table
   ideinit();       // disk 
   startothers();   // start other processors
@@ -53,6 +59,7 @@ mpmain(void)
 {
   cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
   idtinit();       // load idt register
+  sysenterinit();  // fast system call entry
   xchg(&(mycpu()->started), 1); // tell startothers() we're up
   scheduler();     // start running processes
 }
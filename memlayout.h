@@ -8,6 +8,13 @@
 #define KERNBASE 0x80000000         // First kernel virtual address
 #define KERNLINK (KERNBASE+EXTMEM)  // Address where kernel is linked
 
+// Pages the kernel maps at fixed addresses just below KERNBASE in
+// every user address space. User memory ends at USERTOP.
+#define TRAMPOLINE (KERNBASE-PGSIZE) // Signal return code (read-only)
+#define VDSO     (TRAMPOLINE-PGSIZE) // Shared struct vdso (read-only)
+#define VPROC    (VDSO-PGSIZE)      // Per-process struct vproc (read-only)
+#define USERTOP  VPROC              // End of user-allocatable memory
+
 #define V2P(a) (((uint) (a)) - KERNBASE)
 #define P2V(a) ((void *)(((char *) (a)) + KERNBASE))
 
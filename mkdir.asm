@@ -0,0 +1,1539 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 48                	jmp    70 <main+0x70>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit(1);
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 2c                	je     66 <main+0x66>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 cf 04 00 00       	call   513 <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 ef 0a 00 00       	push   $0xaef
+  53:	6a 02                	push   $0x2
+  55:	e8 56 07 00 00       	call   7b0 <printf>
+      exit(1);
+  5a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  61:	e8 5b 03 00 00       	call   3c1 <exit>
+    }
+  }
+
+  exit(0);
+  66:	83 ec 0c             	sub    $0xc,%esp
+  69:	6a 00                	push   $0x0
+  6b:	e8 51 03 00 00       	call   3c1 <exit>
+    printf(2, "Usage: mkdir files...\n");
+  70:	52                   	push   %edx
+  71:	52                   	push   %edx
+  72:	68 d8 0a 00 00       	push   $0xad8
+  77:	6a 02                	push   $0x2
+  79:	e8 32 07 00 00       	call   7b0 <printf>
+    exit(1);
+  7e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  85:	e8 37 03 00 00       	call   3c1 <exit>
+  8a:	66 90                	xchg   %ax,%ax
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  90:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  91:	31 c0                	xor    %eax,%eax
+{
+  93:	89 e5                	mov    %esp,%ebp
+  95:	53                   	push   %ebx
+  96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  99:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  a7:	83 c0 01             	add    $0x1,%eax
+  aa:	84 d2                	test   %dl,%dl
+  ac:	75 f2                	jne    a0 <strcpy+0x10>
+    ;
+  return os;
+}
+  ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b1:	89 c8                	mov    %ecx,%eax
+  b3:	c9                   	leave
+  b4:	c3                   	ret
+  b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	53                   	push   %ebx
+  c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ca:	0f b6 02             	movzbl (%edx),%eax
+  cd:	84 c0                	test   %al,%al
+  cf:	75 17                	jne    e8 <strcmp+0x28>
+  d1:	eb 3a                	jmp    10d <strcmp+0x4d>
+  d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  d7:	90                   	nop
+  d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  dc:	83 c2 01             	add    $0x1,%edx
+  df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  e2:	84 c0                	test   %al,%al
+  e4:	74 1a                	je     100 <strcmp+0x40>
+    p++, q++;
+  e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  e8:	0f b6 19             	movzbl (%ecx),%ebx
+  eb:	38 c3                	cmp    %al,%bl
+  ed:	74 e9                	je     d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  ef:	29 d8                	sub    %ebx,%eax
+}
+  f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  f4:	c9                   	leave
+  f5:	c3                   	ret
+  f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 100:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 104:	31 c0                	xor    %eax,%eax
+ 106:	29 d8                	sub    %ebx,%eax
+}
+ 108:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 10b:	c9                   	leave
+ 10c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 10d:	0f b6 19             	movzbl (%ecx),%ebx
+ 110:	31 c0                	xor    %eax,%eax
+ 112:	eb db                	jmp    ef <strcmp+0x2f>
+ 114:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+
+00000120 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 126:	80 3a 00             	cmpb   $0x0,(%edx)
+ 129:	74 15                	je     140 <strlen+0x20>
+ 12b:	31 c0                	xor    %eax,%eax
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+ 130:	83 c0 01             	add    $0x1,%eax
+ 133:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 137:	89 c1                	mov    %eax,%ecx
+ 139:	75 f5                	jne    130 <strlen+0x10>
+    ;
+  return n;
+}
+ 13b:	89 c8                	mov    %ecx,%eax
+ 13d:	5d                   	pop    %ebp
+ 13e:	c3                   	ret
+ 13f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 140:	31 c9                	xor    %ecx,%ecx
+}
+ 142:	5d                   	pop    %ebp
+ 143:	89 c8                	mov    %ecx,%eax
+ 145:	c3                   	ret
+ 146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000150 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 157:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 15a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 15d:	89 d7                	mov    %edx,%edi
+ 15f:	fc                   	cld
+ 160:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 162:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 165:	89 d0                	mov    %edx,%eax
+ 167:	c9                   	leave
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	8b 45 08             	mov    0x8(%ebp),%eax
+ 176:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 17a:	0f b6 10             	movzbl (%eax),%edx
+ 17d:	84 d2                	test   %dl,%dl
+ 17f:	75 12                	jne    193 <strchr+0x23>
+ 181:	eb 1d                	jmp    1a0 <strchr+0x30>
+ 183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 187:	90                   	nop
+ 188:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 18c:	83 c0 01             	add    $0x1,%eax
+ 18f:	84 d2                	test   %dl,%dl
+ 191:	74 0d                	je     1a0 <strchr+0x30>
+    if(*s == c)
+ 193:	38 d1                	cmp    %dl,%cl
+ 195:	75 f1                	jne    188 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 197:	5d                   	pop    %ebp
+ 198:	c3                   	ret
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1a0:	31 c0                	xor    %eax,%eax
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	c3                   	ret
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1b9:	31 db                	xor    %ebx,%ebx
+{
+ 1bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1be:	eb 27                	jmp    1e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1c0:	83 ec 04             	sub    $0x4,%esp
+ 1c3:	6a 01                	push   $0x1
+ 1c5:	56                   	push   %esi
+ 1c6:	6a 00                	push   $0x0
+ 1c8:	e8 42 02 00 00       	call   40f <read>
+    if(cc < 1)
+ 1cd:	83 c4 10             	add    $0x10,%esp
+ 1d0:	85 c0                	test   %eax,%eax
+ 1d2:	7e 1d                	jle    1f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1df:	3c 0a                	cmp    $0xa,%al
+ 1e1:	74 10                	je     1f3 <gets+0x43>
+ 1e3:	3c 0d                	cmp    $0xd,%al
+ 1e5:	74 0c                	je     1f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1e7:	89 df                	mov    %ebx,%edi
+ 1e9:	83 c3 01             	add    $0x1,%ebx
+ 1ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1ef:	7c cf                	jl     1c0 <gets+0x10>
+ 1f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1fd:	5b                   	pop    %ebx
+ 1fe:	5e                   	pop    %esi
+ 1ff:	5f                   	pop    %edi
+ 200:	5d                   	pop    %ebp
+ 201:	c3                   	ret
+ 202:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	56                   	push   %esi
+ 214:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 215:	83 ec 08             	sub    $0x8,%esp
+ 218:	6a 00                	push   $0x0
+ 21a:	ff 75 08             	push   0x8(%ebp)
+ 21d:	e8 6f 02 00 00       	call   491 <open>
+  if(fd < 0)
+ 222:	83 c4 10             	add    $0x10,%esp
+ 225:	85 c0                	test   %eax,%eax
+ 227:	78 27                	js     250 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 229:	83 ec 08             	sub    $0x8,%esp
+ 22c:	ff 75 0c             	push   0xc(%ebp)
+ 22f:	89 c3                	mov    %eax,%ebx
+ 231:	50                   	push   %eax
+ 232:	e8 a8 02 00 00       	call   4df <fstat>
+  close(fd);
+ 237:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 23a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 23c:	e8 02 02 00 00       	call   443 <close>
+  return r;
+ 241:	83 c4 10             	add    $0x10,%esp
+}
+ 244:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 247:	89 f0                	mov    %esi,%eax
+ 249:	5b                   	pop    %ebx
+ 24a:	5e                   	pop    %esi
+ 24b:	5d                   	pop    %ebp
+ 24c:	c3                   	ret
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 250:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 255:	eb ed                	jmp    244 <stat+0x34>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+
+00000260 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 267:	0f be 02             	movsbl (%edx),%eax
+ 26a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 26d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 270:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 275:	77 1e                	ja     295 <atoi+0x35>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 280:	83 c2 01             	add    $0x1,%edx
+ 283:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 286:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 28a:	0f be 02             	movsbl (%edx),%eax
+ 28d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 290:	80 fb 09             	cmp    $0x9,%bl
+ 293:	76 eb                	jbe    280 <atoi+0x20>
+  return n;
+}
+ 295:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 298:	89 c8                	mov    %ecx,%eax
+ 29a:	c9                   	leave
+ 29b:	c3                   	ret
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+ 2a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2ae:	85 c0                	test   %eax,%eax
+ 2b0:	7e 13                	jle    2c5 <memmove+0x25>
+ 2b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2b4:	89 d7                	mov    %edx,%edi
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2c1:	39 f8                	cmp    %edi,%eax
+ 2c3:	75 fb                	jne    2c0 <memmove+0x20>
+  return vdst;
+}
+ 2c5:	5e                   	pop    %esi
+ 2c6:	89 d0                	mov    %edx,%eax
+ 2c8:	5f                   	pop    %edi
+ 2c9:	5d                   	pop    %ebp
+ 2ca:	c3                   	ret
+ 2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+
+000002d0 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 2d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 2d9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 2e0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 2e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 2e6:	50                   	push   %eax
+ 2e7:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 2ea:	50                   	push   %eax
+ 2eb:	6a 00                	push   $0x0
+ 2ed:	e8 8d 03 00 00       	call   67f <setitimer>
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	89 c2                	mov    %eax,%edx
+ 2f7:	31 c0                	xor    %eax,%eax
+ 2f9:	85 d2                	test   %edx,%edx
+ 2fb:	78 03                	js     300 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 2fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 300:	c9                   	leave
+ 301:	c3                   	ret
+ 302:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 310:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 320:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	53                   	push   %ebx
+ 336:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 339:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 33d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 340:	75 5e                	jne    3a0 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 342:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 348:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 34a:	89 d3                	mov    %edx,%ebx
+ 34c:	89 c1                	mov    %eax,%ecx
+ 34e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 354:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 35a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 35d:	31 d2                	xor    %edx,%edx
+ 35f:	89 d8                	mov    %ebx,%eax
+ 361:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 364:	f7 f6                	div    %esi
+ 366:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 368:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 36b:	f7 f6                	div    %esi
+ 36d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 36f:	89 da                	mov    %ebx,%edx
+ 371:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 376:	f7 f3                	div    %ebx
+ 378:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 37a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 37f:	89 d3                	mov    %edx,%ebx
+ 381:	f7 e1                	mul    %ecx
+ 383:	f7 f6                	div    %esi
+ 385:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 38b:	01 c3                	add    %eax,%ebx
+  return 0;
+ 38d:	31 c0                	xor    %eax,%eax
+ 38f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 392:	83 c4 0c             	add    $0xc,%esp
+ 395:	5b                   	pop    %ebx
+ 396:	5e                   	pop    %esi
+ 397:	5f                   	pop    %edi
+ 398:	5d                   	pop    %ebp
+ 399:	c3                   	ret
+ 39a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 3a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3a5:	eb eb                	jmp    392 <clock_gettime+0x62>
+
+000003a7 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3a7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3ac:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3b3:	74 09                	je     3be <fork+0x17>
+ 3b5:	89 e1                	mov    %esp,%ecx
+ 3b7:	ba c0 03 00 00       	mov    $0x3c0,%edx
+ 3bc:	0f 34                	sysenter
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <exit>:
+SYSCALL(exit)
+ 3c1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3cd:	74 09                	je     3d8 <exit+0x17>
+ 3cf:	89 e1                	mov    %esp,%ecx
+ 3d1:	ba da 03 00 00       	mov    $0x3da,%edx
+ 3d6:	0f 34                	sysenter
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <wait>:
+SYSCALL(wait)
+ 3db:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3e0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3e7:	74 09                	je     3f2 <wait+0x17>
+ 3e9:	89 e1                	mov    %esp,%ecx
+ 3eb:	ba f4 03 00 00       	mov    $0x3f4,%edx
+ 3f0:	0f 34                	sysenter
+ 3f2:	cd 40                	int    $0x40
+ 3f4:	c3                   	ret
+
+000003f5 <pipe>:
+SYSCALL(pipe)
+ 3f5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3fa:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 401:	74 09                	je     40c <pipe+0x17>
+ 403:	89 e1                	mov    %esp,%ecx
+ 405:	ba 0e 04 00 00       	mov    $0x40e,%edx
+ 40a:	0f 34                	sysenter
+ 40c:	cd 40                	int    $0x40
+ 40e:	c3                   	ret
+
+0000040f <read>:
+SYSCALL(read)
+ 40f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 414:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 41b:	74 09                	je     426 <read+0x17>
+ 41d:	89 e1                	mov    %esp,%ecx
+ 41f:	ba 28 04 00 00       	mov    $0x428,%edx
+ 424:	0f 34                	sysenter
+ 426:	cd 40                	int    $0x40
+ 428:	c3                   	ret
+
+00000429 <write>:
+SYSCALL(write)
+ 429:	b8 10 00 00 00       	mov    $0x10,%eax
+ 42e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 435:	74 09                	je     440 <write+0x17>
+ 437:	89 e1                	mov    %esp,%ecx
+ 439:	ba 42 04 00 00       	mov    $0x442,%edx
+ 43e:	0f 34                	sysenter
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <close>:
+SYSCALL(close)
+ 443:	b8 15 00 00 00       	mov    $0x15,%eax
+ 448:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 44f:	74 09                	je     45a <close+0x17>
+ 451:	89 e1                	mov    %esp,%ecx
+ 453:	ba 5c 04 00 00       	mov    $0x45c,%edx
+ 458:	0f 34                	sysenter
+ 45a:	cd 40                	int    $0x40
+ 45c:	c3                   	ret
+
+0000045d <kill>:
+SYSCALL(kill)
+ 45d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 462:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 469:	74 09                	je     474 <kill+0x17>
+ 46b:	89 e1                	mov    %esp,%ecx
+ 46d:	ba 76 04 00 00       	mov    $0x476,%edx
+ 472:	0f 34                	sysenter
+ 474:	cd 40                	int    $0x40
+ 476:	c3                   	ret
+
+00000477 <exec>:
+SYSCALL(exec)
+ 477:	b8 07 00 00 00       	mov    $0x7,%eax
+ 47c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 483:	74 09                	je     48e <exec+0x17>
+ 485:	89 e1                	mov    %esp,%ecx
+ 487:	ba 90 04 00 00       	mov    $0x490,%edx
+ 48c:	0f 34                	sysenter
+ 48e:	cd 40                	int    $0x40
+ 490:	c3                   	ret
+
+00000491 <open>:
+SYSCALL(open)
+ 491:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 496:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 49d:	74 09                	je     4a8 <open+0x17>
+ 49f:	89 e1                	mov    %esp,%ecx
+ 4a1:	ba aa 04 00 00       	mov    $0x4aa,%edx
+ 4a6:	0f 34                	sysenter
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mknod>:
+SYSCALL(mknod)
+ 4ab:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4b7:	74 09                	je     4c2 <mknod+0x17>
+ 4b9:	89 e1                	mov    %esp,%ecx
+ 4bb:	ba c4 04 00 00       	mov    $0x4c4,%edx
+ 4c0:	0f 34                	sysenter
+ 4c2:	cd 40                	int    $0x40
+ 4c4:	c3                   	ret
+
+000004c5 <unlink>:
+SYSCALL(unlink)
+ 4c5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4ca:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4d1:	74 09                	je     4dc <unlink+0x17>
+ 4d3:	89 e1                	mov    %esp,%ecx
+ 4d5:	ba de 04 00 00       	mov    $0x4de,%edx
+ 4da:	0f 34                	sysenter
+ 4dc:	cd 40                	int    $0x40
+ 4de:	c3                   	ret
+
+000004df <fstat>:
+SYSCALL(fstat)
+ 4df:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4e4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4eb:	74 09                	je     4f6 <fstat+0x17>
+ 4ed:	89 e1                	mov    %esp,%ecx
+ 4ef:	ba f8 04 00 00       	mov    $0x4f8,%edx
+ 4f4:	0f 34                	sysenter
+ 4f6:	cd 40                	int    $0x40
+ 4f8:	c3                   	ret
+
+000004f9 <link>:
+SYSCALL(link)
+ 4f9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4fe:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 505:	74 09                	je     510 <link+0x17>
+ 507:	89 e1                	mov    %esp,%ecx
+ 509:	ba 12 05 00 00       	mov    $0x512,%edx
+ 50e:	0f 34                	sysenter
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <mkdir>:
+SYSCALL(mkdir)
+ 513:	b8 14 00 00 00       	mov    $0x14,%eax
+ 518:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 51f:	74 09                	je     52a <mkdir+0x17>
+ 521:	89 e1                	mov    %esp,%ecx
+ 523:	ba 2c 05 00 00       	mov    $0x52c,%edx
+ 528:	0f 34                	sysenter
+ 52a:	cd 40                	int    $0x40
+ 52c:	c3                   	ret
+
+0000052d <chdir>:
+SYSCALL(chdir)
+ 52d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 532:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 539:	74 09                	je     544 <chdir+0x17>
+ 53b:	89 e1                	mov    %esp,%ecx
+ 53d:	ba 46 05 00 00       	mov    $0x546,%edx
+ 542:	0f 34                	sysenter
+ 544:	cd 40                	int    $0x40
+ 546:	c3                   	ret
+
+00000547 <dup>:
+SYSCALL(dup)
+ 547:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 54c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 553:	74 09                	je     55e <dup+0x17>
+ 555:	89 e1                	mov    %esp,%ecx
+ 557:	ba 60 05 00 00       	mov    $0x560,%edx
+ 55c:	0f 34                	sysenter
+ 55e:	cd 40                	int    $0x40
+ 560:	c3                   	ret
+
+00000561 <sbrk>:
+SYSCALL(sbrk)
+ 561:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 566:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 56d:	74 09                	je     578 <sbrk+0x17>
+ 56f:	89 e1                	mov    %esp,%ecx
+ 571:	ba 7a 05 00 00       	mov    $0x57a,%edx
+ 576:	0f 34                	sysenter
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <sleep>:
+SYSCALL(sleep)
+ 57b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 580:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 587:	74 09                	je     592 <sleep+0x17>
+ 589:	89 e1                	mov    %esp,%ecx
+ 58b:	ba 94 05 00 00       	mov    $0x594,%edx
+ 590:	0f 34                	sysenter
+ 592:	cd 40                	int    $0x40
+ 594:	c3                   	ret
+
+00000595 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 595:	b8 16 00 00 00       	mov    $0x16,%eax
+ 59a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5a1:	74 09                	je     5ac <sigprocmask+0x17>
+ 5a3:	89 e1                	mov    %esp,%ecx
+ 5a5:	ba ae 05 00 00       	mov    $0x5ae,%edx
+ 5aa:	0f 34                	sysenter
+ 5ac:	cd 40                	int    $0x40
+ 5ae:	c3                   	ret
+
+000005af <sigaction>:
+SYSCALL(sigaction)
+ 5af:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5b4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5bb:	74 09                	je     5c6 <sigaction+0x17>
+ 5bd:	89 e1                	mov    %esp,%ecx
+ 5bf:	ba c8 05 00 00       	mov    $0x5c8,%edx
+ 5c4:	0f 34                	sysenter
+ 5c6:	cd 40                	int    $0x40
+ 5c8:	c3                   	ret
+
+000005c9 <sigret>:
+SYSCALL(sigret)
+ 5c9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5ce:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5d5:	74 09                	je     5e0 <sigret+0x17>
+ 5d7:	89 e1                	mov    %esp,%ecx
+ 5d9:	ba e2 05 00 00       	mov    $0x5e2,%edx
+ 5de:	0f 34                	sysenter
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <traceread>:
+SYSCALL(traceread)
+ 5e3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5e8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5ef:	74 09                	je     5fa <traceread+0x17>
+ 5f1:	89 e1                	mov    %esp,%ecx
+ 5f3:	ba fc 05 00 00       	mov    $0x5fc,%edx
+ 5f8:	0f 34                	sysenter
+ 5fa:	cd 40                	int    $0x40
+ 5fc:	c3                   	ret
+
+000005fd <sigqueue>:
+SYSCALL(sigqueue)
+ 5fd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 602:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 609:	74 09                	je     614 <sigqueue+0x17>
+ 60b:	89 e1                	mov    %esp,%ecx
+ 60d:	ba 16 06 00 00       	mov    $0x616,%edx
+ 612:	0f 34                	sysenter
+ 614:	cd 40                	int    $0x40
+ 616:	c3                   	ret
+
+00000617 <signalfd>:
+SYSCALL(signalfd)
+ 617:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 61c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 623:	74 09                	je     62e <signalfd+0x17>
+ 625:	89 e1                	mov    %esp,%ecx
+ 627:	ba 30 06 00 00       	mov    $0x630,%edx
+ 62c:	0f 34                	sysenter
+ 62e:	cd 40                	int    $0x40
+ 630:	c3                   	ret
+
+00000631 <sigwait>:
+SYSCALL(sigwait)
+ 631:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 636:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 63d:	74 09                	je     648 <sigwait+0x17>
+ 63f:	89 e1                	mov    %esp,%ecx
+ 641:	ba 4a 06 00 00       	mov    $0x64a,%edx
+ 646:	0f 34                	sysenter
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <sigsuspend>:
+SYSCALL(sigsuspend)
+ 64b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 650:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 657:	74 09                	je     662 <sigsuspend+0x17>
+ 659:	89 e1                	mov    %esp,%ecx
+ 65b:	ba 64 06 00 00       	mov    $0x664,%edx
+ 660:	0f 34                	sysenter
+ 662:	cd 40                	int    $0x40
+ 664:	c3                   	ret
+
+00000665 <waitpid>:
+SYSCALL(waitpid)
+ 665:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 66a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 671:	74 09                	je     67c <waitpid+0x17>
+ 673:	89 e1                	mov    %esp,%ecx
+ 675:	ba 7e 06 00 00       	mov    $0x67e,%edx
+ 67a:	0f 34                	sysenter
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <setitimer>:
+SYSCALL(setitimer)
+ 67f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 684:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 68b:	74 09                	je     696 <setitimer+0x17>
+ 68d:	89 e1                	mov    %esp,%ecx
+ 68f:	ba 98 06 00 00       	mov    $0x698,%edx
+ 694:	0f 34                	sysenter
+ 696:	cd 40                	int    $0x40
+ 698:	c3                   	ret
+
+00000699 <nanosleep>:
+SYSCALL(nanosleep)
+ 699:	b8 21 00 00 00       	mov    $0x21,%eax
+ 69e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6a5:	74 09                	je     6b0 <nanosleep+0x17>
+ 6a7:	89 e1                	mov    %esp,%ecx
+ 6a9:	ba b2 06 00 00       	mov    $0x6b2,%edx
+ 6ae:	0f 34                	sysenter
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <mmap>:
+SYSCALL(mmap)
+ 6b3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6b8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6bf:	74 09                	je     6ca <mmap+0x17>
+ 6c1:	89 e1                	mov    %esp,%ecx
+ 6c3:	ba cc 06 00 00       	mov    $0x6cc,%edx
+ 6c8:	0f 34                	sysenter
+ 6ca:	cd 40                	int    $0x40
+ 6cc:	c3                   	ret
+
+000006cd <munmap>:
+SYSCALL(munmap)
+ 6cd:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6d2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6d9:	74 09                	je     6e4 <munmap+0x17>
+ 6db:	89 e1                	mov    %esp,%ecx
+ 6dd:	ba e6 06 00 00       	mov    $0x6e6,%edx
+ 6e2:	0f 34                	sysenter
+ 6e4:	cd 40                	int    $0x40
+ 6e6:	c3                   	ret
+
+000006e7 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 6e7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6ec:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6f3:	74 09                	je     6fe <getpid_syscall+0x17>
+ 6f5:	89 e1                	mov    %esp,%ecx
+ 6f7:	ba 00 07 00 00       	mov    $0x700,%edx
+ 6fc:	0f 34                	sysenter
+ 6fe:	cd 40                	int    $0x40
+ 700:	c3                   	ret
+
+00000701 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 701:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 706:	cd 40                	int    $0x40
+ 708:	c3                   	ret
+ 709:	66 90                	xchg   %ax,%ax
+ 70b:	66 90                	xchg   %ax,%ax
+ 70d:	66 90                	xchg   %ax,%ax
+ 70f:	90                   	nop
+
+00000710 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 718:	89 d1                	mov    %edx,%ecx
+{
+ 71a:	83 ec 3c             	sub    $0x3c,%esp
+ 71d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 720:	85 d2                	test   %edx,%edx
+ 722:	0f 89 80 00 00 00    	jns    7a8 <printint+0x98>
+ 728:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 72c:	74 7a                	je     7a8 <printint+0x98>
+    x = -xx;
+ 72e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 730:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 735:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 738:	31 f6                	xor    %esi,%esi
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 740:	89 c8                	mov    %ecx,%eax
+ 742:	31 d2                	xor    %edx,%edx
+ 744:	89 f7                	mov    %esi,%edi
+ 746:	f7 f3                	div    %ebx
+ 748:	8d 76 01             	lea    0x1(%esi),%esi
+ 74b:	0f b6 92 6c 0b 00 00 	movzbl 0xb6c(%edx),%edx
+ 752:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 756:	89 ca                	mov    %ecx,%edx
+ 758:	89 c1                	mov    %eax,%ecx
+ 75a:	39 da                	cmp    %ebx,%edx
+ 75c:	73 e2                	jae    740 <printint+0x30>
+  if(neg)
+ 75e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 761:	85 c0                	test   %eax,%eax
+ 763:	74 07                	je     76c <printint+0x5c>
+    buf[i++] = '-';
+ 765:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 76a:	89 f7                	mov    %esi,%edi
+ 76c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 76f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 772:	01 df                	add    %ebx,%edi
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 778:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 77b:	83 ec 04             	sub    $0x4,%esp
+ 77e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 781:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 784:	6a 01                	push   $0x1
+ 786:	50                   	push   %eax
+ 787:	56                   	push   %esi
+ 788:	e8 9c fc ff ff       	call   429 <write>
+  while(--i >= 0)
+ 78d:	89 f8                	mov    %edi,%eax
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	83 ef 01             	sub    $0x1,%edi
+ 795:	39 d8                	cmp    %ebx,%eax
+ 797:	75 df                	jne    778 <printint+0x68>
+}
+ 799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 79c:	5b                   	pop    %ebx
+ 79d:	5e                   	pop    %esi
+ 79e:	5f                   	pop    %edi
+ 79f:	5d                   	pop    %ebp
+ 7a0:	c3                   	ret
+ 7a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7a8:	31 c0                	xor    %eax,%eax
+ 7aa:	eb 89                	jmp    735 <printint+0x25>
+ 7ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c2:	83 c6 01             	add    $0x1,%esi
+ 7c5:	84 db                	test   %bl,%bl
+ 7c7:	74 67                	je     830 <printf+0x80>
+ 7c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7cc:	31 d2                	xor    %edx,%edx
+ 7ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7d1:	eb 34                	jmp    807 <printf+0x57>
+ 7d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7d7:	90                   	nop
+ 7d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7e0:	83 f8 25             	cmp    $0x25,%eax
+ 7e3:	74 18                	je     7fd <printf+0x4d>
+  write(fd, &c, 1);
+ 7e5:	83 ec 04             	sub    $0x4,%esp
+ 7e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ee:	6a 01                	push   $0x1
+ 7f0:	50                   	push   %eax
+ 7f1:	57                   	push   %edi
+ 7f2:	e8 32 fc ff ff       	call   429 <write>
+ 7f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 800:	83 c6 01             	add    $0x1,%esi
+ 803:	84 db                	test   %bl,%bl
+ 805:	74 29                	je     830 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 807:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 80a:	85 d2                	test   %edx,%edx
+ 80c:	74 ca                	je     7d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 80e:	83 fa 25             	cmp    $0x25,%edx
+ 811:	75 ea                	jne    7fd <printf+0x4d>
+      if(c == 'd'){
+ 813:	83 f8 25             	cmp    $0x25,%eax
+ 816:	0f 84 24 01 00 00    	je     940 <printf+0x190>
+ 81c:	83 e8 63             	sub    $0x63,%eax
+ 81f:	83 f8 15             	cmp    $0x15,%eax
+ 822:	77 1c                	ja     840 <printf+0x90>
+ 824:	ff 24 85 14 0b 00 00 	jmp    *0xb14(,%eax,4)
+ 82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 833:	5b                   	pop    %ebx
+ 834:	5e                   	pop    %esi
+ 835:	5f                   	pop    %edi
+ 836:	5d                   	pop    %ebp
+ 837:	c3                   	ret
+ 838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 846:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 84a:	6a 01                	push   $0x1
+ 84c:	52                   	push   %edx
+ 84d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 850:	57                   	push   %edi
+ 851:	e8 d3 fb ff ff       	call   429 <write>
+ 856:	83 c4 0c             	add    $0xc,%esp
+ 859:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85c:	6a 01                	push   $0x1
+ 85e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 861:	52                   	push   %edx
+ 862:	57                   	push   %edi
+ 863:	e8 c1 fb ff ff       	call   429 <write>
+        putc(fd, c);
+ 868:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86b:	31 d2                	xor    %edx,%edx
+ 86d:	eb 8e                	jmp    7fd <printf+0x4d>
+ 86f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 870:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 87b:	8b 13                	mov    (%ebx),%edx
+ 87d:	6a 00                	push   $0x0
+ 87f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 881:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 884:	e8 87 fe ff ff       	call   710 <printint>
+        ap++;
+ 889:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 88c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88f:	31 d2                	xor    %edx,%edx
+ 891:	e9 67 ff ff ff       	jmp    7fd <printf+0x4d>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8a5:	83 c0 04             	add    $0x4,%eax
+ 8a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8ab:	85 db                	test   %ebx,%ebx
+ 8ad:	0f 84 9d 00 00 00    	je     950 <printf+0x1a0>
+        while(*s != 0){
+ 8b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8b8:	84 c0                	test   %al,%al
+ 8ba:	0f 84 3d ff ff ff    	je     7fd <printf+0x4d>
+ 8c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8c6:	89 de                	mov    %ebx,%esi
+ 8c8:	89 d3                	mov    %edx,%ebx
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8d9:	6a 01                	push   $0x1
+ 8db:	53                   	push   %ebx
+ 8dc:	57                   	push   %edi
+ 8dd:	e8 47 fb ff ff       	call   429 <write>
+        while(*s != 0){
+ 8e2:	0f b6 06             	movzbl (%esi),%eax
+ 8e5:	83 c4 10             	add    $0x10,%esp
+ 8e8:	84 c0                	test   %al,%al
+ 8ea:	75 e4                	jne    8d0 <printf+0x120>
+      state = 0;
+ 8ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 07 ff ff ff       	jmp    7fd <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 01                	push   $0x1
+ 90f:	e9 6b ff ff ff       	jmp    87f <printf+0xcf>
+ 914:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 918:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 91b:	83 ec 04             	sub    $0x4,%esp
+ 91e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 921:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 923:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 926:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 929:	6a 01                	push   $0x1
+ 92b:	52                   	push   %edx
+ 92c:	57                   	push   %edi
+ 92d:	e8 f7 fa ff ff       	call   429 <write>
+        ap++;
+ 932:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 935:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 938:	31 d2                	xor    %edx,%edx
+ 93a:	e9 be fe ff ff       	jmp    7fd <printf+0x4d>
+ 93f:	90                   	nop
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 946:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 949:	6a 01                	push   $0x1
+ 94b:	e9 11 ff ff ff       	jmp    861 <printf+0xb1>
+ 950:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 955:	bb 0b 0b 00 00       	mov    $0xb0b,%ebx
+ 95a:	e9 61 ff ff ff       	jmp    8c0 <printf+0x110>
+ 95f:	90                   	nop
+
+00000960 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 960:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 961:	a1 90 0e 00 00       	mov    0xe90,%eax
+{
+ 966:	89 e5                	mov    %esp,%ebp
+ 968:	57                   	push   %edi
+ 969:	56                   	push   %esi
+ 96a:	53                   	push   %ebx
+ 96b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 96e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 978:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 97a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 97c:	39 ca                	cmp    %ecx,%edx
+ 97e:	73 30                	jae    9b0 <free+0x50>
+ 980:	39 c1                	cmp    %eax,%ecx
+ 982:	72 04                	jb     988 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 984:	39 c2                	cmp    %eax,%edx
+ 986:	72 f0                	jb     978 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 988:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 98b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 98e:	39 f8                	cmp    %edi,%eax
+ 990:	74 2e                	je     9c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 992:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 995:	8b 42 04             	mov    0x4(%edx),%eax
+ 998:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 99b:	39 f1                	cmp    %esi,%ecx
+ 99d:	74 38                	je     9d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 99f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9a1:	5b                   	pop    %ebx
+  freep = p;
+ 9a2:	89 15 90 0e 00 00    	mov    %edx,0xe90
+}
+ 9a8:	5e                   	pop    %esi
+ 9a9:	5f                   	pop    %edi
+ 9aa:	5d                   	pop    %ebp
+ 9ab:	c3                   	ret
+ 9ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9b0:	39 c1                	cmp    %eax,%ecx
+ 9b2:	72 d0                	jb     984 <free+0x24>
+ 9b4:	eb c2                	jmp    978 <free+0x18>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9c0:	03 70 04             	add    0x4(%eax),%esi
+ 9c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9c6:	8b 02                	mov    (%edx),%eax
+ 9c8:	8b 00                	mov    (%eax),%eax
+ 9ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9d3:	39 f1                	cmp    %esi,%ecx
+ 9d5:	75 c8                	jne    99f <free+0x3f>
+    p->s.size += bp->s.size;
+ 9d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9da:	89 15 90 0e 00 00    	mov    %edx,0xe90
+    p->s.size += bp->s.size;
+ 9e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9e8:	5b                   	pop    %ebx
+ 9e9:	5e                   	pop    %esi
+ 9ea:	5f                   	pop    %edi
+ 9eb:	5d                   	pop    %ebp
+ 9ec:	c3                   	ret
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	53                   	push   %ebx
+ 9f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9fc:	8b 15 90 0e 00 00    	mov    0xe90,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a02:	8d 78 07             	lea    0x7(%eax),%edi
+ a05:	c1 ef 03             	shr    $0x3,%edi
+ a08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a0b:	85 d2                	test   %edx,%edx
+ a0d:	0f 84 8d 00 00 00    	je     aa0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a15:	8b 48 04             	mov    0x4(%eax),%ecx
+ a18:	39 f9                	cmp    %edi,%ecx
+ a1a:	73 64                	jae    a80 <malloc+0x90>
+  if(nu < 4096)
+ a1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a21:	39 df                	cmp    %ebx,%edi
+ a23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a2d:	eb 0a                	jmp    a39 <malloc+0x49>
+ a2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a32:	8b 48 04             	mov    0x4(%eax),%ecx
+ a35:	39 f9                	cmp    %edi,%ecx
+ a37:	73 47                	jae    a80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a39:	89 c2                	mov    %eax,%edx
+ a3b:	39 05 90 0e 00 00    	cmp    %eax,0xe90
+ a41:	75 ed                	jne    a30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a43:	83 ec 0c             	sub    $0xc,%esp
+ a46:	56                   	push   %esi
+ a47:	e8 15 fb ff ff       	call   561 <sbrk>
+  if(p == (char*)-1)
+ a4c:	83 c4 10             	add    $0x10,%esp
+ a4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a52:	74 1c                	je     a70 <malloc+0x80>
+  hp->s.size = nu;
+ a54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a57:	83 ec 0c             	sub    $0xc,%esp
+ a5a:	83 c0 08             	add    $0x8,%eax
+ a5d:	50                   	push   %eax
+ a5e:	e8 fd fe ff ff       	call   960 <free>
+  return freep;
+ a63:	8b 15 90 0e 00 00    	mov    0xe90,%edx
+      if((p = morecore(nunits)) == 0)
+ a69:	83 c4 10             	add    $0x10,%esp
+ a6c:	85 d2                	test   %edx,%edx
+ a6e:	75 c0                	jne    a30 <malloc+0x40>
+        return 0;
+  }
+}
+ a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a73:	31 c0                	xor    %eax,%eax
+}
+ a75:	5b                   	pop    %ebx
+ a76:	5e                   	pop    %esi
+ a77:	5f                   	pop    %edi
+ a78:	5d                   	pop    %ebp
+ a79:	c3                   	ret
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a80:	39 cf                	cmp    %ecx,%edi
+ a82:	74 4c                	je     ad0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a84:	29 f9                	sub    %edi,%ecx
+ a86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a8f:	89 15 90 0e 00 00    	mov    %edx,0xe90
+}
+ a95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a98:	83 c0 08             	add    $0x8,%eax
+}
+ a9b:	5b                   	pop    %ebx
+ a9c:	5e                   	pop    %esi
+ a9d:	5f                   	pop    %edi
+ a9e:	5d                   	pop    %ebp
+ a9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ aa0:	c7 05 90 0e 00 00 94 	movl   $0xe94,0xe90
+ aa7:	0e 00 00 
+    base.s.size = 0;
+ aaa:	b8 94 0e 00 00       	mov    $0xe94,%eax
+    base.s.ptr = freep = prevp = &base;
+ aaf:	c7 05 94 0e 00 00 94 	movl   $0xe94,0xe94
+ ab6:	0e 00 00 
+    base.s.size = 0;
+ ab9:	c7 05 98 0e 00 00 00 	movl   $0x0,0xe98
+ ac0:	00 00 00 
+    if(p->s.size >= nunits){
+ ac3:	e9 54 ff ff ff       	jmp    a1c <malloc+0x2c>
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ad0:	8b 08                	mov    (%eax),%ecx
+ ad2:	89 0a                	mov    %ecx,(%edx)
+ ad4:	eb b9                	jmp    a8f <malloc+0x9f>
@@ -6,6 +6,7 @@
 #include <assert.h>
 
 #define stat xv6_stat  // avoid clash with host struct stat
+#define timespec xv6_timespec  // and with host struct timespec
 #include "types.h"
 #include "fs.h"
 #include "stat.h"
@@ -0,0 +1,426 @@
+// Memory-mapped regions.
+//
+// Each process has up to NVMA regions made by mmap(), in p->vma,
+// placed top-down from USERTOP above the heap. Their pages are filled
+// in on first touch by vmafault() (vm.c).
+//
+// MAP_SHARED file pages are kept in shtab, keyed by (dev, inum,
+// file offset), so every mapping of a file page maps the same frame
+// and sees the others' writes. writei() copies what write() stores
+// into those frames too. The table holds one reference to each frame
+// (see kalloc.c). When the last mapping of a page goes away, in
+// munmap(), exec or exit, the page is written back to the file
+// through the log if any mapping wrote to it, and dropped. Until
+// then read() returns the file's contents without the mappings'
+// writes.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "stat.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "fcntl.h"
+
+// The region of p that va falls in, or 0.
+struct vma*
+vmafind(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// The lowest address of p's regions: how far the heap may grow.
+uint
+vmabase(struct proc *p)
+{
+  struct vma *v;
+  uint base;
+
+  base = USERTOP;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->start < v->end && v->start < base)
+      base = v->start;
+  return base;
+}
+
+struct shpage {
+  uint dev;
+  uint inum;
+  uint off;                  // File offset of the page
+  char *page;                // 0 if the entry is free
+  int dirty;                 // Written through a mapping since written back
+};
+
+struct {
+  struct spinlock lock;
+  struct shpage ent[NSHPAGE];
+} shtab;
+
+void
+mmapinit(void)
+{
+  initlock(&shtab.lock, "shtab");
+}
+
+// The entry for the page of ip at off, or 0.
+// shtab.lock must be held.
+static struct shpage*
+shfind(struct inode *ip, uint off)
+{
+  struct shpage *e;
+
+  for(e = shtab.ent; e < &shtab.ent[NSHPAGE]; e++)
+    if(e->page && e->dev == ip->dev && e->inum == ip->inum && e->off == off)
+      return e;
+  return 0;
+}
+
+// Return the shared frame holding the page of ip at off, reading
+// it in if no mapping has it yet, with a reference added for the
+// caller. Returns 0 if the table is full or out of memory.
+char*
+shget(struct inode *ip, uint off)
+{
+  struct shpage *e, *fe;
+  char *mem;
+  uint n;
+
+  // Holding ip->lock keeps two faults from both reading the page.
+  ilock(ip);
+  acquire(&shtab.lock);
+  if((e = shfind(ip, off)) != 0){
+    kref(e->page);
+    release(&shtab.lock);
+    iunlock(ip);
+    return e->page;
+  }
+  release(&shtab.lock);
+
+  // Past the end of the file the page is zero.
+  if((mem = kalloc()) == 0){
+    iunlock(ip);
+    return 0;
+  }
+  memset(mem, 0, PGSIZE);
+  n = 0;
+  if(off < ip->size)
+    n = ip->size - off < PGSIZE ? ip->size - off : PGSIZE;
+  if(readi(ip, mem, off, n) != n){
+    iunlock(ip);
+    kfree(mem);
+    return 0;
+  }
+
+  acquire(&shtab.lock);
+  for(fe = shtab.ent; fe < &shtab.ent[NSHPAGE] && fe->page; fe++)
+    ;
+  if(fe == &shtab.ent[NSHPAGE]){
+    release(&shtab.lock);
+    iunlock(ip);
+    kfree(mem);
+    return 0;
+  }
+  fe->dev = ip->dev;
+  fe->inum = ip->inum;
+  fe->off = off;
+  fe->page = mem;
+  fe->dirty = 0;
+  kref(mem);
+  ip->nshared++;
+  release(&shtab.lock);
+  iunlock(ip);
+  return mem;
+}
+
+// Copy n bytes that writei() just wrote to ip at off into the
+// shared frames of those bytes, so that mappings see them and a
+// later write back does not undo them. Caller must hold ip->lock.
+void
+shupdate(struct inode *ip, uint off, char *src, uint n)
+{
+  struct shpage *e;
+  uint lo, hi;
+
+  acquire(&shtab.lock);
+  for(e = shtab.ent; e < &shtab.ent[NSHPAGE]; e++){
+    if(e->page == 0 || e->dev != ip->dev || e->inum != ip->inum ||
+       e->off >= off + n || e->off + PGSIZE <= off)
+      continue;
+    lo = off > e->off ? off : e->off;
+    hi = off + n < e->off + PGSIZE ? off + n : e->off + PGSIZE;
+    memmove(e->page + (lo - e->off), src + (lo - off), hi - lo);
+  }
+  release(&shtab.lock);
+}
+
+// Write page, the page of ip at off, up to the end of the file,
+// back to the file. Each transaction writes a few blocks at most,
+// as in filewrite().
+static void
+writeback(struct inode *ip, uint off, char *page)
+{
+  uint n, i, m, max;
+
+  ilock(ip);
+  n = off < ip->size ? ip->size - off : 0;
+  iunlock(ip);
+  if(n > PGSIZE)
+    n = PGSIZE;
+  max = ((MAXOPBLOCKS-1-1-2) / 2) * BSIZE;
+  for(i = 0; i < n; i += m){
+    m = n - i < max ? n - i : max;
+    begin_op();
+    ilock(ip);
+    writei(ip, page + i, off + i, m);
+    iunlock(ip);
+    end_op();
+  }
+}
+
+// Note that a mapping of the page of ip at off is going away,
+// and had written to it if dirty is set.
+static void
+shdirty(struct inode *ip, uint off, int dirty)
+{
+  struct shpage *e;
+
+  acquire(&shtab.lock);
+  if(dirty && (e = shfind(ip, off)) != 0)
+    e->dirty = 1;
+  release(&shtab.lock);
+}
+
+// Drop the shared frame of ip at off if no mapping is left,
+// writing it back first if a mapping wrote to it. Like shget,
+// holds ip->lock while changing ip->nshared, which writei()
+// reads under it.
+static void
+shrelease(struct inode *ip, uint off)
+{
+  struct shpage *e;
+  char *page;
+
+  for(;;){
+    ilock(ip);
+    acquire(&shtab.lock);
+    if((e = shfind(ip, off)) == 0 || krefcount(e->page) > 1){
+      release(&shtab.lock);
+      iunlock(ip);
+      return;
+    }
+    if(!e->dirty)
+      break;
+    // Hold the frame while writing it back, so that a concurrent
+    // shrelease() leaves it alone; a fault may map it meanwhile.
+    e->dirty = 0;
+    page = e->page;
+    kref(page);
+    release(&shtab.lock);
+    iunlock(ip);
+    writeback(ip, off, page);
+    kfree(page);
+  }
+  kfree(e->page);
+  e->page = 0;
+  ip->nshared--;
+  release(&shtab.lock);
+  iunlock(ip);
+}
+
+// Remove [lo, hi) of region v from pgdir, p's current or old
+// page table. Shared file pages no other mapping has are written
+// back if dirty and dropped (see shrelease).
+// Returns -1 if v has to be split and p has no free region.
+static int
+vmaunmap(struct proc *p, pde_t *pgdir, struct vma *v, uint lo, uint hi)
+{
+  struct vma *nv;
+  int shared;
+  uint a;
+
+  nv = 0;
+  if(lo > v->start && hi < v->end){
+    for(nv = p->vma; nv < &p->vma[NVMA] && nv->start < nv->end; nv++)
+      ;
+    if(nv == &p->vma[NVMA])
+      return -1;
+  }
+
+  shared = v->f && (v->flags & MAP_SHARED);
+  if(shared)
+    for(a = lo; a < hi; a += PGSIZE)
+      if(uvmpage(pgdir, a, 0) != 0)
+        shdirty(v->f->ip, v->off + (a - v->start), uvmpage(pgdir, a, 1) != 0);
+  deallocuvm(pgdir, hi, lo);
+  if(pgdir == p->pgdir)
+    lcr3(V2P(pgdir));
+  if(shared)
+    for(a = lo; a < hi; a += PGSIZE)
+      shrelease(v->f->ip, v->off + (a - v->start));
+
+  if(nv){
+    // Punched a hole: the part above it becomes a region of its own.
+    *nv = *v;
+    nv->start = hi;
+    nv->off += hi - v->start;
+    if(nv->f)
+      filedup(nv->f);
+    v->end = lo;
+  } else if(lo == v->start && hi == v->end){
+    if(v->f)
+      fileclose(v->f);
+    v->f = 0;
+    v->start = v->end = 0;
+  } else if(lo == v->start){
+    v->off += hi - v->start;
+    v->start = hi;
+  } else
+    v->end = lo;
+  return 0;
+}
+
+// Map len bytes at a free address above the heap. f, if not 0,
+// is the file to map from offset off, and the mapping takes a
+// reference to it. Returns the address, or -1.
+int
+mmap(uint len, int prot, int flags, struct file *f, uint off)
+{
+  struct proc *p = myproc();
+  struct vma *v, *fv;
+  uint start, end;
+
+  len = PGROUNDUP(len);
+  if(len == 0 || len > USERTOP || off % PGSIZE != 0)
+    return -1;
+  if(prot == 0 || (prot & ~(PROT_READ|PROT_WRITE)) != 0)
+    return -1;
+  if((flags & (MAP_SHARED|MAP_PRIVATE)) == 0 ||
+     (flags & (MAP_SHARED|MAP_PRIVATE)) == (MAP_SHARED|MAP_PRIVATE))
+    return -1;
+  if(f){
+    if(f->type != FD_INODE || f->ip->type == T_DEV || !f->readable)
+      return -1;
+    if((flags & MAP_SHARED) && (prot & PROT_WRITE) &&
+       (!f->writable || f->ip->nexec > 0))
+      return -1;
+  }
+
+  fv = 0;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->start == v->end)
+      fv = v;
+  if(fv == 0)
+    return -1;
+
+  // Highest gap of len bytes: slide down past each region that
+  // overlaps until none does.
+  end = USERTOP;
+  for(;;){
+    if(end < len || end - len < PGROUNDUP(p->sz))
+      return -1;
+    start = end - len;
+    for(v = p->vma; v < &p->vma[NVMA]; v++)
+      if(v->start < v->end && v->start < end && v->end > start)
+        break;
+    if(v == &p->vma[NVMA])
+      break;
+    end = v->start;
+  }
+
+  fv->start = start;
+  fv->end = end;
+  fv->prot = prot;
+  fv->flags = flags;
+  fv->f = f ? filedup(f) : 0;
+  fv->off = off;
+  return start;
+}
+
+// Unmap the pages of [addr, addr+len) that lie in the current
+// process's regions. Returns -1 if addr is not page-aligned.
+int
+munmap(uint addr, uint len)
+{
+  struct proc *p = myproc();
+  struct vma *v;
+  uint lo, hi, end;
+
+  if(addr % PGSIZE != 0 || addr + len < addr)
+    return -1;
+  end = PGROUNDUP(addr + len);
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->start == v->end || v->end <= addr || v->start >= end)
+      continue;
+    lo = addr > v->start ? addr : v->start;
+    hi = end < v->end ? end : v->end;
+    if(vmaunmap(p, p->pgdir, v, lo, hi) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+// Give child np the regions of p, the current process, for fork.
+// Shared regions share their pages; private ones share them
+// copy-on-write.
+int
+vmacopy(struct proc *np, struct proc *p)
+{
+  struct vma *v;
+  uint a;
+  int i;
+
+  for(i = 0; i < NVMA; i++){
+    v = &p->vma[i];
+    np->vma[i] = *v;
+    np->vma[i].f = 0;
+    if(v->start == v->end)
+      continue;
+    // Both must see each other's writes to a shared anonymous
+    // region, so its pages cannot be filled in separately later.
+    // Shared file pages are found in shtab whenever they are.
+    if((v->flags & MAP_SHARED) && v->f == 0)
+      for(a = v->start; a < v->end; a += PGSIZE)
+        if(uvmpage(p->pgdir, a, 0) == 0 && pagefault(p, a, 0) < 0)
+          goto bad;
+    if(v->f)
+      np->vma[i].f = filedup(v->f);
+    if(sharerange(p->pgdir, np->pgdir, v->start, v->end,
+                  !(v->flags & MAP_SHARED)) < 0)
+      goto bad;
+  }
+  lcr3(V2P(p->pgdir));
+  return 0;
+
+bad:
+  lcr3(V2P(p->pgdir));
+  // Undo through vmaunmap() so shared file pages np took are
+  // released from shtab.
+  for(; i >= 0; i--)
+    if(np->vma[i].start < np->vma[i].end)
+      vmaunmap(np, np->pgdir, &np->vma[i], np->vma[i].start, np->vma[i].end);
+  memset(np->vma, 0, sizeof(np->vma));
+  return -1;
+}
+
+// Unmap all of p's regions from pgdir, p's current page table or
+// the one exec just replaced.
+void
+vmaclear(struct proc *p, pde_t *pgdir)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->start < v->end)
+      vmaunmap(p, pgdir, v, v->start, v->end);
+}
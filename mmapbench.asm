@@ -0,0 +1,1983 @@
+
+_mmapbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "mmapbench MAP_SHARED write ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 14 00 00 00       	mov    $0x14,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  int fd, i, n, lines;
+
+  n = argc > 1 ? atoi(argv[1]) : 20;
+  19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  n = argc > 1 ? atoi(argv[1]) : 20;
+  1f:	0f 8f bd 01 00 00    	jg     1e2 <main+0x1e2>
+    printf(2, "usage: mmapbench [passes]\n");
+    exit(1);
+  }
+
+  // 64-byte lines.
+  for(i = 0; i < sizeof(buf); i++)
+  25:	31 c9                	xor    %ecx,%ecx
+    buf[i] = i % 64 == 63 ? '\n' : 'a' + i % 26;
+  27:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+  2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  30:	89 ca                	mov    %ecx,%edx
+  32:	b8 0a 00 00 00       	mov    $0xa,%eax
+  37:	83 e2 3f             	and    $0x3f,%edx
+  3a:	83 fa 3f             	cmp    $0x3f,%edx
+  3d:	74 11                	je     50 <main+0x50>
+  3f:	89 c8                	mov    %ecx,%eax
+  41:	f7 e6                	mul    %esi
+  43:	89 c8                	mov    %ecx,%eax
+  45:	c1 ea 03             	shr    $0x3,%edx
+  48:	6b d2 1a             	imul   $0x1a,%edx,%edx
+  4b:	29 d0                	sub    %edx,%eax
+  4d:	83 c0 61             	add    $0x61,%eax
+  50:	88 81 80 14 00 00    	mov    %al,0x1480(%ecx)
+  for(i = 0; i < sizeof(buf); i++)
+  56:	83 c1 01             	add    $0x1,%ecx
+  59:	81 f9 00 02 00 00    	cmp    $0x200,%ecx
+  5f:	75 cf                	jne    30 <main+0x30>
+  if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+  61:	83 ec 08             	sub    $0x8,%esp
+  64:	be 80 00 00 00       	mov    $0x80,%esi
+  69:	68 02 02 00 00       	push   $0x202
+  6e:	68 08 0f 00 00       	push   $0xf08
+  73:	e8 49 08 00 00       	call   8c1 <open>
+  78:	83 c4 10             	add    $0x10,%esp
+  7b:	89 c7                	mov    %eax,%edi
+  7d:	85 c0                	test   %eax,%eax
+  7f:	0f 88 8f 01 00 00    	js     214 <main+0x214>
+  85:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "mmapbench: create failed\n");
+    exit(1);
+  }
+  for(i = 0; i < FILESIZE; i += sizeof(buf))
+    write(fd, buf, sizeof(buf));
+  88:	83 ec 04             	sub    $0x4,%esp
+  8b:	68 00 02 00 00       	push   $0x200
+  90:	68 80 14 00 00       	push   $0x1480
+  95:	57                   	push   %edi
+  96:	e8 be 07 00 00       	call   859 <write>
+  for(i = 0; i < FILESIZE; i += sizeof(buf))
+  9b:	83 c4 10             	add    $0x10,%esp
+  9e:	83 ee 01             	sub    $0x1,%esi
+  a1:	75 e5                	jne    88 <main+0x88>
+  close(fd);
+  a3:	83 ec 0c             	sub    $0xc,%esp
+  a6:	57                   	push   %edi
+  a7:	e8 c7 07 00 00       	call   873 <close>
+  lines = FILESIZE / 64;
+
+  run("read", scanread, n, lines);
+  ac:	89 d9                	mov    %ebx,%ecx
+  ae:	ba 80 03 00 00       	mov    $0x380,%edx
+  b3:	b8 98 0f 00 00       	mov    $0xf98,%eax
+  b8:	e8 53 03 00 00       	call   410 <run.constprop.0>
+  run("mmap", scanmmap, n, lines);
+  bd:	89 d9                	mov    %ebx,%ecx
+  bf:	ba d0 02 00 00       	mov    $0x2d0,%edx
+  c4:	b8 9d 0f 00 00       	mov    $0xf9d,%eax
+  c9:	e8 42 03 00 00       	call   410 <run.constprop.0>
+  if((fd = open(name, O_RDWR)) < 0){
+  ce:	58                   	pop    %eax
+  cf:	5a                   	pop    %edx
+  d0:	6a 02                	push   $0x2
+  d2:	68 08 0f 00 00       	push   $0xf08
+  d7:	e8 e5 07 00 00       	call   8c1 <open>
+  dc:	83 c4 10             	add    $0x10,%esp
+  df:	89 c3                	mov    %eax,%ebx
+  e1:	85 c0                	test   %eax,%eax
+  e3:	0f 88 ae 01 00 00    	js     297 <main+0x297>
+  p = mmap(0, FILESIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  e9:	50                   	push   %eax
+  ea:	50                   	push   %eax
+  eb:	6a 00                	push   $0x0
+  ed:	53                   	push   %ebx
+  ee:	6a 01                	push   $0x1
+  f0:	6a 03                	push   $0x3
+  f2:	68 00 00 01 00       	push   $0x10000
+  f7:	6a 00                	push   $0x0
+  f9:	e8 e5 09 00 00       	call   ae3 <mmap>
+  if(p == (char*)-1){
+  fe:	83 c4 20             	add    $0x20,%esp
+  p = mmap(0, FILESIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+ 101:	89 c6                	mov    %eax,%esi
+  if(p == (char*)-1){
+ 103:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 106:	0f 84 71 01 00 00    	je     27d <main+0x27d>
+  p[0] = 'X';
+ 10c:	c6 00 58             	movb   $0x58,(%eax)
+  if((pid = fork()) < 0){
+ 10f:	e8 c3 06 00 00       	call   7d7 <fork>
+ 114:	89 c7                	mov    %eax,%edi
+ 116:	85 c0                	test   %eax,%eax
+ 118:	0f 88 45 01 00 00    	js     263 <main+0x263>
+  if(pid == 0){
+ 11e:	0f 84 92 00 00 00    	je     1b6 <main+0x1b6>
+  if(waitpid(pid, &status, 0) != pid || status != 0 || p[1] != 'Y'){
+ 124:	50                   	push   %eax
+ 125:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 128:	6a 00                	push   $0x0
+ 12a:	50                   	push   %eax
+ 12b:	57                   	push   %edi
+ 12c:	e8 64 09 00 00       	call   a95 <waitpid>
+ 131:	83 c4 10             	add    $0x10,%esp
+ 134:	39 c7                	cmp    %eax,%edi
+ 136:	0f 85 75 01 00 00    	jne    2b1 <main+0x2b1>
+ 13c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 140:	0f 85 6b 01 00 00    	jne    2b1 <main+0x2b1>
+ 146:	80 7e 01 59          	cmpb   $0x59,0x1(%esi)
+ 14a:	0f 85 61 01 00 00    	jne    2b1 <main+0x2b1>
+  munmap(p, FILESIZE);
+ 150:	57                   	push   %edi
+ 151:	57                   	push   %edi
+ 152:	68 00 00 01 00       	push   $0x10000
+ 157:	56                   	push   %esi
+ 158:	e8 a0 09 00 00       	call   afd <munmap>
+  read(fd, buf, 2);
+ 15d:	83 c4 0c             	add    $0xc,%esp
+ 160:	6a 02                	push   $0x2
+ 162:	68 80 14 00 00       	push   $0x1480
+ 167:	53                   	push   %ebx
+ 168:	e8 d2 06 00 00       	call   83f <read>
+  close(fd);
+ 16d:	89 1c 24             	mov    %ebx,(%esp)
+ 170:	e8 fe 06 00 00       	call   873 <close>
+  if(buf[0] != 'X' || buf[1] != 'Y'){
+ 175:	83 c4 10             	add    $0x10,%esp
+ 178:	80 3d 80 14 00 00 58 	cmpb   $0x58,0x1480
+ 17f:	0f 85 c4 00 00 00    	jne    249 <main+0x249>
+ 185:	80 3d 81 14 00 00 59 	cmpb   $0x59,0x1481
+ 18c:	0f 85 b7 00 00 00    	jne    249 <main+0x249>
+  printf(1, "mmapbench MAP_SHARED write ok\n");
+ 192:	50                   	push   %eax
+ 193:	50                   	push   %eax
+ 194:	68 3c 10 00 00       	push   $0x103c
+ 199:	6a 01                	push   $0x1
+ 19b:	e8 40 0a 00 00       	call   be0 <printf>
+  shared();
+  unlink(name);
+ 1a0:	c7 04 24 08 0f 00 00 	movl   $0xf08,(%esp)
+ 1a7:	e8 49 07 00 00       	call   8f5 <unlink>
+  exit(0);
+ 1ac:	31 d2                	xor    %edx,%edx
+ 1ae:	89 14 24             	mov    %edx,(%esp)
+ 1b1:	e8 3b 06 00 00       	call   7f1 <exit>
+    q = mmap(0, FILESIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+ 1b6:	56                   	push   %esi
+ 1b7:	56                   	push   %esi
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	53                   	push   %ebx
+ 1bb:	6a 01                	push   $0x1
+ 1bd:	6a 03                	push   $0x3
+ 1bf:	68 00 00 01 00       	push   $0x10000
+ 1c4:	6a 00                	push   $0x0
+ 1c6:	e8 18 09 00 00       	call   ae3 <mmap>
+    if(q == (char*)-1 || q[0] != 'X')
+ 1cb:	83 c4 20             	add    $0x20,%esp
+ 1ce:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 1d1:	74 05                	je     1d8 <main+0x1d8>
+ 1d3:	80 38 58             	cmpb   $0x58,(%eax)
+ 1d6:	74 56                	je     22e <main+0x22e>
+      exit(1);
+ 1d8:	83 ec 0c             	sub    $0xc,%esp
+ 1db:	6a 01                	push   $0x1
+ 1dd:	e8 0f 06 00 00       	call   7f1 <exit>
+  n = argc > 1 ? atoi(argv[1]) : 20;
+ 1e2:	83 ec 0c             	sub    $0xc,%esp
+ 1e5:	ff 70 04             	push   0x4(%eax)
+ 1e8:	e8 a3 04 00 00       	call   690 <atoi>
+  if(n <= 0){
+ 1ed:	83 c4 10             	add    $0x10,%esp
+  n = argc > 1 ? atoi(argv[1]) : 20;
+ 1f0:	89 c3                	mov    %eax,%ebx
+  if(n <= 0){
+ 1f2:	85 c0                	test   %eax,%eax
+ 1f4:	0f 8f 2b fe ff ff    	jg     25 <main+0x25>
+    printf(2, "usage: mmapbench [passes]\n");
+ 1fa:	53                   	push   %ebx
+ 1fb:	53                   	push   %ebx
+ 1fc:	68 63 0f 00 00       	push   $0xf63
+ 201:	6a 02                	push   $0x2
+ 203:	e8 d8 09 00 00       	call   be0 <printf>
+    exit(1);
+ 208:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 20f:	e8 dd 05 00 00       	call   7f1 <exit>
+    printf(2, "mmapbench: create failed\n");
+ 214:	51                   	push   %ecx
+ 215:	51                   	push   %ecx
+ 216:	68 7e 0f 00 00       	push   $0xf7e
+ 21b:	6a 02                	push   $0x2
+ 21d:	e8 be 09 00 00       	call   be0 <printf>
+    exit(1);
+ 222:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 229:	e8 c3 05 00 00       	call   7f1 <exit>
+    q[1] = 'Y';
+ 22e:	c6 40 01 59          	movb   $0x59,0x1(%eax)
+    munmap(q, FILESIZE);
+ 232:	52                   	push   %edx
+ 233:	52                   	push   %edx
+ 234:	68 00 00 01 00       	push   $0x10000
+ 239:	50                   	push   %eax
+ 23a:	e8 be 08 00 00       	call   afd <munmap>
+    exit(0);
+ 23f:	31 c9                	xor    %ecx,%ecx
+ 241:	89 0c 24             	mov    %ecx,(%esp)
+ 244:	e8 a8 05 00 00       	call   7f1 <exit>
+    printf(2, "mmapbench: MAP_SHARED write was lost\n");
+ 249:	51                   	push   %ecx
+ 24a:	51                   	push   %ecx
+ 24b:	68 14 10 00 00       	push   $0x1014
+ 250:	6a 02                	push   $0x2
+ 252:	e8 89 09 00 00       	call   be0 <printf>
+    exit(1);
+ 257:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 25e:	e8 8e 05 00 00       	call   7f1 <exit>
+    printf(2, "mmapbench: fork failed\n");
+ 263:	57                   	push   %edi
+ 264:	57                   	push   %edi
+ 265:	68 a2 0f 00 00       	push   $0xfa2
+ 26a:	6a 02                	push   $0x2
+ 26c:	e8 6f 09 00 00       	call   be0 <printf>
+    exit(1);
+ 271:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 278:	e8 74 05 00 00       	call   7f1 <exit>
+    printf(2, "mmapbench: mmap failed\n");
+ 27d:	50                   	push   %eax
+ 27e:	50                   	push   %eax
+ 27f:	68 2e 0f 00 00       	push   $0xf2e
+ 284:	6a 02                	push   $0x2
+ 286:	e8 55 09 00 00       	call   be0 <printf>
+    exit(1);
+ 28b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 292:	e8 5a 05 00 00       	call   7f1 <exit>
+    printf(2, "mmapbench: open failed\n");
+ 297:	50                   	push   %eax
+ 298:	50                   	push   %eax
+ 299:	68 16 0f 00 00       	push   $0xf16
+ 29e:	6a 02                	push   $0x2
+ 2a0:	e8 3b 09 00 00       	call   be0 <printf>
+    exit(1);
+ 2a5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 2ac:	e8 40 05 00 00       	call   7f1 <exit>
+    printf(2, "mmapbench: MAP_SHARED mappings are not coherent\n");
+ 2b1:	50                   	push   %eax
+ 2b2:	50                   	push   %eax
+ 2b3:	68 e0 0f 00 00       	push   $0xfe0
+ 2b8:	6a 02                	push   $0x2
+ 2ba:	e8 21 09 00 00       	call   be0 <printf>
+    exit(1);
+ 2bf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 2c6:	e8 26 05 00 00       	call   7f1 <exit>
+ 2cb:	66 90                	xchg   %ax,%ax
+ 2cd:	66 90                	xchg   %ax,%ax
+ 2cf:	90                   	nop
+
+000002d0 <scanmmap>:
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	56                   	push   %esi
+ 2d4:	53                   	push   %ebx
+  if((fd = open(name, O_RDONLY)) < 0){
+ 2d5:	83 ec 08             	sub    $0x8,%esp
+ 2d8:	6a 00                	push   $0x0
+ 2da:	68 08 0f 00 00       	push   $0xf08
+ 2df:	e8 dd 05 00 00       	call   8c1 <open>
+ 2e4:	83 c4 10             	add    $0x10,%esp
+ 2e7:	85 c0                	test   %eax,%eax
+ 2e9:	78 5d                	js     348 <scanmmap+0x78>
+  p = mmap(0, FILESIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+ 2eb:	83 ec 08             	sub    $0x8,%esp
+ 2ee:	89 c3                	mov    %eax,%ebx
+ 2f0:	6a 00                	push   $0x0
+ 2f2:	50                   	push   %eax
+ 2f3:	6a 02                	push   $0x2
+ 2f5:	6a 01                	push   $0x1
+ 2f7:	68 00 00 01 00       	push   $0x10000
+ 2fc:	6a 00                	push   $0x0
+ 2fe:	e8 e0 07 00 00       	call   ae3 <mmap>
+  close(fd);
+ 303:	83 c4 14             	add    $0x14,%esp
+ 306:	53                   	push   %ebx
+  p = mmap(0, FILESIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+ 307:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 309:	e8 65 05 00 00       	call   873 <close>
+  if(p == (char*)-1){
+ 30e:	83 c4 10             	add    $0x10,%esp
+ 311:	83 fe ff             	cmp    $0xffffffff,%esi
+ 314:	74 4c                	je     362 <scanmmap+0x92>
+ 316:	89 f0                	mov    %esi,%eax
+ 318:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  lines = 0;
+ 31e:	31 db                	xor    %ebx,%ebx
+      lines++;
+ 320:	31 d2                	xor    %edx,%edx
+ 322:	80 38 0a             	cmpb   $0xa,(%eax)
+ 325:	0f 94 c2             	sete   %dl
+  for(i = 0; i < FILESIZE; i++)
+ 328:	83 c0 01             	add    $0x1,%eax
+      lines++;
+ 32b:	01 d3                	add    %edx,%ebx
+  for(i = 0; i < FILESIZE; i++)
+ 32d:	39 c1                	cmp    %eax,%ecx
+ 32f:	75 ef                	jne    320 <scanmmap+0x50>
+  munmap(p, FILESIZE);
+ 331:	83 ec 08             	sub    $0x8,%esp
+ 334:	68 00 00 01 00       	push   $0x10000
+ 339:	56                   	push   %esi
+ 33a:	e8 be 07 00 00       	call   afd <munmap>
+}
+ 33f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 342:	89 d8                	mov    %ebx,%eax
+ 344:	5b                   	pop    %ebx
+ 345:	5e                   	pop    %esi
+ 346:	5d                   	pop    %ebp
+ 347:	c3                   	ret
+    printf(2, "mmapbench: open failed\n");
+ 348:	52                   	push   %edx
+ 349:	52                   	push   %edx
+ 34a:	68 16 0f 00 00       	push   $0xf16
+ 34f:	6a 02                	push   $0x2
+ 351:	e8 8a 08 00 00       	call   be0 <printf>
+    exit(1);
+ 356:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 35d:	e8 8f 04 00 00       	call   7f1 <exit>
+    printf(2, "mmapbench: mmap failed\n");
+ 362:	50                   	push   %eax
+ 363:	50                   	push   %eax
+ 364:	68 2e 0f 00 00       	push   $0xf2e
+ 369:	6a 02                	push   $0x2
+ 36b:	e8 70 08 00 00       	call   be0 <printf>
+    exit(1);
+ 370:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 377:	e8 75 04 00 00       	call   7f1 <exit>
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <scanread>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	56                   	push   %esi
+ 384:	53                   	push   %ebx
+  if((fd = open(name, O_RDONLY)) < 0){
+ 385:	83 ec 08             	sub    $0x8,%esp
+ 388:	6a 00                	push   $0x0
+ 38a:	68 08 0f 00 00       	push   $0xf08
+ 38f:	e8 2d 05 00 00       	call   8c1 <open>
+ 394:	83 c4 10             	add    $0x10,%esp
+ 397:	85 c0                	test   %eax,%eax
+ 399:	78 4f                	js     3ea <scanread+0x6a>
+ 39b:	89 c3                	mov    %eax,%ebx
+  lines = 0;
+ 39d:	31 f6                	xor    %esi,%esi
+ 39f:	90                   	nop
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	68 00 02 00 00       	push   $0x200
+ 3a8:	68 80 14 00 00       	push   $0x1480
+ 3ad:	53                   	push   %ebx
+ 3ae:	e8 8c 04 00 00       	call   83f <read>
+ 3b3:	83 c4 10             	add    $0x10,%esp
+ 3b6:	85 c0                	test   %eax,%eax
+ 3b8:	7e 1e                	jle    3d8 <scanread+0x58>
+    for(i = 0; i < n; i++)
+ 3ba:	31 d2                	xor    %edx,%edx
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(buf[i] == '\n')
+ 3c0:	80 ba 80 14 00 00 0a 	cmpb   $0xa,0x1480(%edx)
+ 3c7:	75 03                	jne    3cc <scanread+0x4c>
+        lines++;
+ 3c9:	83 c6 01             	add    $0x1,%esi
+    for(i = 0; i < n; i++)
+ 3cc:	83 c2 01             	add    $0x1,%edx
+ 3cf:	39 d0                	cmp    %edx,%eax
+ 3d1:	75 ed                	jne    3c0 <scanread+0x40>
+ 3d3:	eb cb                	jmp    3a0 <scanread+0x20>
+ 3d5:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+ 3d8:	83 ec 0c             	sub    $0xc,%esp
+ 3db:	53                   	push   %ebx
+ 3dc:	e8 92 04 00 00       	call   873 <close>
+}
+ 3e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3e4:	89 f0                	mov    %esi,%eax
+ 3e6:	5b                   	pop    %ebx
+ 3e7:	5e                   	pop    %esi
+ 3e8:	5d                   	pop    %ebp
+ 3e9:	c3                   	ret
+    printf(2, "mmapbench: open failed\n");
+ 3ea:	50                   	push   %eax
+ 3eb:	50                   	push   %eax
+ 3ec:	68 16 0f 00 00       	push   $0xf16
+ 3f1:	6a 02                	push   $0x2
+ 3f3:	e8 e8 07 00 00       	call   be0 <printf>
+    exit(1);
+ 3f8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 3ff:	e8 ed 03 00 00       	call   7f1 <exit>
+ 404:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+
+00000410 <run.constprop.0>:
+run(char *what, int (*scan)(void), int n, int want)
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	89 d6                	mov    %edx,%esi
+ 417:	53                   	push   %ebx
+ 418:	89 cb                	mov    %ecx,%ebx
+ 41a:	83 ec 34             	sub    $0x34,%esp
+ 41d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+ 420:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 423:	50                   	push   %eax
+ 424:	6a 01                	push   $0x1
+ 426:	e8 35 03 00 00       	call   760 <clock_gettime>
+  for(i = 0; i < n; i++){
+ 42b:	83 c4 10             	add    $0x10,%esp
+ 42e:	85 db                	test   %ebx,%ebx
+ 430:	7e 16                	jle    448 <run.constprop.0+0x38>
+ 432:	31 ff                	xor    %edi,%edi
+ 434:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(scan() != want){
+ 438:	ff d6                	call   *%esi
+ 43a:	3d 00 04 00 00       	cmp    $0x400,%eax
+ 43f:	75 5f                	jne    4a0 <run.constprop.0+0x90>
+  for(i = 0; i < n; i++){
+ 441:	83 c7 01             	add    $0x1,%edi
+ 444:	39 df                	cmp    %ebx,%edi
+ 446:	75 f0                	jne    438 <run.constprop.0+0x28>
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+ 448:	83 ec 08             	sub    $0x8,%esp
+ 44b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 44e:	50                   	push   %eax
+ 44f:	6a 01                	push   $0x1
+ 451:	e8 0a 03 00 00       	call   760 <clock_gettime>
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 456:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 459:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+ 45e:	2b 75 dc             	sub    -0x24(%ebp),%esi
+ 461:	f7 ee                	imul   %esi
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 463:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 466:	2b 4d d8             	sub    -0x28(%ebp),%ecx
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 469:	c1 fe 1f             	sar    $0x1f,%esi
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 46c:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 472:	c1 fa 06             	sar    $0x6,%edx
+ 475:	29 f2                	sub    %esi,%edx
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 477:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+  printf(1, "mmapbench %s %d bytes %d us/pass\n", what, FILESIZE,
+ 47a:	31 d2                	xor    %edx,%edx
+ 47c:	f7 f3                	div    %ebx
+ 47e:	89 04 24             	mov    %eax,(%esp)
+ 481:	68 00 00 01 00       	push   $0x10000
+ 486:	ff 75 d4             	push   -0x2c(%ebp)
+ 489:	68 bc 0f 00 00       	push   $0xfbc
+ 48e:	6a 01                	push   $0x1
+ 490:	e8 4b 07 00 00       	call   be0 <printf>
+}
+ 495:	83 c4 20             	add    $0x20,%esp
+ 498:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49b:	5b                   	pop    %ebx
+ 49c:	5e                   	pop    %esi
+ 49d:	5f                   	pop    %edi
+ 49e:	5d                   	pop    %ebp
+ 49f:	c3                   	ret
+      printf(2, "mmapbench: %s counted wrong\n", what);
+ 4a0:	50                   	push   %eax
+ 4a1:	ff 75 d4             	push   -0x2c(%ebp)
+ 4a4:	68 46 0f 00 00       	push   $0xf46
+ 4a9:	6a 02                	push   $0x2
+ 4ab:	e8 30 07 00 00       	call   be0 <printf>
+      exit(1);
+ 4b0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 4b7:	e8 35 03 00 00       	call   7f1 <exit>
+ 4bc:	66 90                	xchg   %ax,%ax
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 4c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 4c1:	31 c0                	xor    %eax,%eax
+{
+ 4c3:	89 e5                	mov    %esp,%ebp
+ 4c5:	53                   	push   %ebx
+ 4c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 4d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 4d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 4d7:	83 c0 01             	add    $0x1,%eax
+ 4da:	84 d2                	test   %dl,%dl
+ 4dc:	75 f2                	jne    4d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 4de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4e1:	89 c8                	mov    %ecx,%eax
+ 4e3:	c9                   	leave
+ 4e4:	c3                   	ret
+ 4e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	53                   	push   %ebx
+ 4f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4fa:	0f b6 02             	movzbl (%edx),%eax
+ 4fd:	84 c0                	test   %al,%al
+ 4ff:	75 17                	jne    518 <strcmp+0x28>
+ 501:	eb 3a                	jmp    53d <strcmp+0x4d>
+ 503:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 507:	90                   	nop
+ 508:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 50c:	83 c2 01             	add    $0x1,%edx
+ 50f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 512:	84 c0                	test   %al,%al
+ 514:	74 1a                	je     530 <strcmp+0x40>
+    p++, q++;
+ 516:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 518:	0f b6 19             	movzbl (%ecx),%ebx
+ 51b:	38 c3                	cmp    %al,%bl
+ 51d:	74 e9                	je     508 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 51f:	29 d8                	sub    %ebx,%eax
+}
+ 521:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 524:	c9                   	leave
+ 525:	c3                   	ret
+ 526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 530:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 534:	31 c0                	xor    %eax,%eax
+ 536:	29 d8                	sub    %ebx,%eax
+}
+ 538:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 53b:	c9                   	leave
+ 53c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 53d:	0f b6 19             	movzbl (%ecx),%ebx
+ 540:	31 c0                	xor    %eax,%eax
+ 542:	eb db                	jmp    51f <strcmp+0x2f>
+ 544:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 54f:	90                   	nop
+
+00000550 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 556:	80 3a 00             	cmpb   $0x0,(%edx)
+ 559:	74 15                	je     570 <strlen+0x20>
+ 55b:	31 c0                	xor    %eax,%eax
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+ 560:	83 c0 01             	add    $0x1,%eax
+ 563:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 567:	89 c1                	mov    %eax,%ecx
+ 569:	75 f5                	jne    560 <strlen+0x10>
+    ;
+  return n;
+}
+ 56b:	89 c8                	mov    %ecx,%eax
+ 56d:	5d                   	pop    %ebp
+ 56e:	c3                   	ret
+ 56f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 570:	31 c9                	xor    %ecx,%ecx
+}
+ 572:	5d                   	pop    %ebp
+ 573:	89 c8                	mov    %ecx,%eax
+ 575:	c3                   	ret
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000580 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 587:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 58a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 58d:	89 d7                	mov    %edx,%edi
+ 58f:	fc                   	cld
+ 590:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 592:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 595:	89 d0                	mov    %edx,%eax
+ 597:	c9                   	leave
+ 598:	c3                   	ret
+ 599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 5aa:	0f b6 10             	movzbl (%eax),%edx
+ 5ad:	84 d2                	test   %dl,%dl
+ 5af:	75 12                	jne    5c3 <strchr+0x23>
+ 5b1:	eb 1d                	jmp    5d0 <strchr+0x30>
+ 5b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5b7:	90                   	nop
+ 5b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 5bc:	83 c0 01             	add    $0x1,%eax
+ 5bf:	84 d2                	test   %dl,%dl
+ 5c1:	74 0d                	je     5d0 <strchr+0x30>
+    if(*s == c)
+ 5c3:	38 d1                	cmp    %dl,%cl
+ 5c5:	75 f1                	jne    5b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 5c7:	5d                   	pop    %ebp
+ 5c8:	c3                   	ret
+ 5c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 5d0:	31 c0                	xor    %eax,%eax
+}
+ 5d2:	5d                   	pop    %ebp
+ 5d3:	c3                   	ret
+ 5d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+
+000005e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 5e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 5e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 5e9:	31 db                	xor    %ebx,%ebx
+{
+ 5eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 5ee:	eb 27                	jmp    617 <gets+0x37>
+    cc = read(0, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	6a 01                	push   $0x1
+ 5f5:	56                   	push   %esi
+ 5f6:	6a 00                	push   $0x0
+ 5f8:	e8 42 02 00 00       	call   83f <read>
+    if(cc < 1)
+ 5fd:	83 c4 10             	add    $0x10,%esp
+ 600:	85 c0                	test   %eax,%eax
+ 602:	7e 1d                	jle    621 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 604:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 608:	8b 55 08             	mov    0x8(%ebp),%edx
+ 60b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 60f:	3c 0a                	cmp    $0xa,%al
+ 611:	74 10                	je     623 <gets+0x43>
+ 613:	3c 0d                	cmp    $0xd,%al
+ 615:	74 0c                	je     623 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 617:	89 df                	mov    %ebx,%edi
+ 619:	83 c3 01             	add    $0x1,%ebx
+ 61c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 61f:	7c cf                	jl     5f0 <gets+0x10>
+ 621:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 623:	8b 45 08             	mov    0x8(%ebp),%eax
+ 626:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 62a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 62d:	5b                   	pop    %ebx
+ 62e:	5e                   	pop    %esi
+ 62f:	5f                   	pop    %edi
+ 630:	5d                   	pop    %ebp
+ 631:	c3                   	ret
+ 632:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	56                   	push   %esi
+ 644:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 645:	83 ec 08             	sub    $0x8,%esp
+ 648:	6a 00                	push   $0x0
+ 64a:	ff 75 08             	push   0x8(%ebp)
+ 64d:	e8 6f 02 00 00       	call   8c1 <open>
+  if(fd < 0)
+ 652:	83 c4 10             	add    $0x10,%esp
+ 655:	85 c0                	test   %eax,%eax
+ 657:	78 27                	js     680 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 659:	83 ec 08             	sub    $0x8,%esp
+ 65c:	ff 75 0c             	push   0xc(%ebp)
+ 65f:	89 c3                	mov    %eax,%ebx
+ 661:	50                   	push   %eax
+ 662:	e8 a8 02 00 00       	call   90f <fstat>
+  close(fd);
+ 667:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 66a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 66c:	e8 02 02 00 00       	call   873 <close>
+  return r;
+ 671:	83 c4 10             	add    $0x10,%esp
+}
+ 674:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 677:	89 f0                	mov    %esi,%eax
+ 679:	5b                   	pop    %ebx
+ 67a:	5e                   	pop    %esi
+ 67b:	5d                   	pop    %ebp
+ 67c:	c3                   	ret
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 680:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 685:	eb ed                	jmp    674 <stat+0x34>
+ 687:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68e:	66 90                	xchg   %ax,%ax
+
+00000690 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	53                   	push   %ebx
+ 694:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 697:	0f be 02             	movsbl (%edx),%eax
+ 69a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 69d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 6a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 6a5:	77 1e                	ja     6c5 <atoi+0x35>
+ 6a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 6b0:	83 c2 01             	add    $0x1,%edx
+ 6b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 6b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 6ba:	0f be 02             	movsbl (%edx),%eax
+ 6bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 6c0:	80 fb 09             	cmp    $0x9,%bl
+ 6c3:	76 eb                	jbe    6b0 <atoi+0x20>
+  return n;
+}
+ 6c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6c8:	89 c8                	mov    %ecx,%eax
+ 6ca:	c9                   	leave
+ 6cb:	c3                   	ret
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 6de:	85 c0                	test   %eax,%eax
+ 6e0:	7e 13                	jle    6f5 <memmove+0x25>
+ 6e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6e4:	89 d7                	mov    %edx,%edi
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6f1:	39 f8                	cmp    %edi,%eax
+ 6f3:	75 fb                	jne    6f0 <memmove+0x20>
+  return vdst;
+}
+ 6f5:	5e                   	pop    %esi
+ 6f6:	89 d0                	mov    %edx,%eax
+ 6f8:	5f                   	pop    %edi
+ 6f9:	5d                   	pop    %ebp
+ 6fa:	c3                   	ret
+ 6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+
+00000700 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 706:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 709:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 710:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 713:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 716:	50                   	push   %eax
+ 717:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 71a:	50                   	push   %eax
+ 71b:	6a 00                	push   $0x0
+ 71d:	e8 8d 03 00 00       	call   aaf <setitimer>
+ 722:	83 c4 10             	add    $0x10,%esp
+ 725:	89 c2                	mov    %eax,%edx
+ 727:	31 c0                	xor    %eax,%eax
+ 729:	85 d2                	test   %edx,%edx
+ 72b:	78 03                	js     730 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 72d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 730:	c9                   	leave
+ 731:	c3                   	ret
+ 732:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000740 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 740:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 745:	c3                   	ret
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000750 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 750:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 755:	c3                   	ret
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000760 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	57                   	push   %edi
+ 764:	56                   	push   %esi
+ 765:	53                   	push   %ebx
+ 766:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 769:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 76d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 770:	75 5e                	jne    7d0 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 772:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 778:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 77a:	89 d3                	mov    %edx,%ebx
+ 77c:	89 c1                	mov    %eax,%ecx
+ 77e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 784:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 78a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 78d:	31 d2                	xor    %edx,%edx
+ 78f:	89 d8                	mov    %ebx,%eax
+ 791:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 794:	f7 f6                	div    %esi
+ 796:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 798:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 79b:	f7 f6                	div    %esi
+ 79d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 79f:	89 da                	mov    %ebx,%edx
+ 7a1:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 7a6:	f7 f3                	div    %ebx
+ 7a8:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 7aa:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 7af:	89 d3                	mov    %edx,%ebx
+ 7b1:	f7 e1                	mul    %ecx
+ 7b3:	f7 f6                	div    %esi
+ 7b5:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 7bb:	01 c3                	add    %eax,%ebx
+  return 0;
+ 7bd:	31 c0                	xor    %eax,%eax
+ 7bf:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 7c2:	83 c4 0c             	add    $0xc,%esp
+ 7c5:	5b                   	pop    %ebx
+ 7c6:	5e                   	pop    %esi
+ 7c7:	5f                   	pop    %edi
+ 7c8:	5d                   	pop    %ebp
+ 7c9:	c3                   	ret
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 7d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 7d5:	eb eb                	jmp    7c2 <clock_gettime+0x62>
+
+000007d7 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 7d7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7dc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7e3:	74 09                	je     7ee <fork+0x17>
+ 7e5:	89 e1                	mov    %esp,%ecx
+ 7e7:	ba f0 07 00 00       	mov    $0x7f0,%edx
+ 7ec:	0f 34                	sysenter
+ 7ee:	cd 40                	int    $0x40
+ 7f0:	c3                   	ret
+
+000007f1 <exit>:
+SYSCALL(exit)
+ 7f1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7f6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7fd:	74 09                	je     808 <exit+0x17>
+ 7ff:	89 e1                	mov    %esp,%ecx
+ 801:	ba 0a 08 00 00       	mov    $0x80a,%edx
+ 806:	0f 34                	sysenter
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <wait>:
+SYSCALL(wait)
+ 80b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 810:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 817:	74 09                	je     822 <wait+0x17>
+ 819:	89 e1                	mov    %esp,%ecx
+ 81b:	ba 24 08 00 00       	mov    $0x824,%edx
+ 820:	0f 34                	sysenter
+ 822:	cd 40                	int    $0x40
+ 824:	c3                   	ret
+
+00000825 <pipe>:
+SYSCALL(pipe)
+ 825:	b8 04 00 00 00       	mov    $0x4,%eax
+ 82a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 831:	74 09                	je     83c <pipe+0x17>
+ 833:	89 e1                	mov    %esp,%ecx
+ 835:	ba 3e 08 00 00       	mov    $0x83e,%edx
+ 83a:	0f 34                	sysenter
+ 83c:	cd 40                	int    $0x40
+ 83e:	c3                   	ret
+
+0000083f <read>:
+SYSCALL(read)
+ 83f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 844:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 84b:	74 09                	je     856 <read+0x17>
+ 84d:	89 e1                	mov    %esp,%ecx
+ 84f:	ba 58 08 00 00       	mov    $0x858,%edx
+ 854:	0f 34                	sysenter
+ 856:	cd 40                	int    $0x40
+ 858:	c3                   	ret
+
+00000859 <write>:
+SYSCALL(write)
+ 859:	b8 10 00 00 00       	mov    $0x10,%eax
+ 85e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 865:	74 09                	je     870 <write+0x17>
+ 867:	89 e1                	mov    %esp,%ecx
+ 869:	ba 72 08 00 00       	mov    $0x872,%edx
+ 86e:	0f 34                	sysenter
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <close>:
+SYSCALL(close)
+ 873:	b8 15 00 00 00       	mov    $0x15,%eax
+ 878:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 87f:	74 09                	je     88a <close+0x17>
+ 881:	89 e1                	mov    %esp,%ecx
+ 883:	ba 8c 08 00 00       	mov    $0x88c,%edx
+ 888:	0f 34                	sysenter
+ 88a:	cd 40                	int    $0x40
+ 88c:	c3                   	ret
+
+0000088d <kill>:
+SYSCALL(kill)
+ 88d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 892:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 899:	74 09                	je     8a4 <kill+0x17>
+ 89b:	89 e1                	mov    %esp,%ecx
+ 89d:	ba a6 08 00 00       	mov    $0x8a6,%edx
+ 8a2:	0f 34                	sysenter
+ 8a4:	cd 40                	int    $0x40
+ 8a6:	c3                   	ret
+
+000008a7 <exec>:
+SYSCALL(exec)
+ 8a7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 8ac:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8b3:	74 09                	je     8be <exec+0x17>
+ 8b5:	89 e1                	mov    %esp,%ecx
+ 8b7:	ba c0 08 00 00       	mov    $0x8c0,%edx
+ 8bc:	0f 34                	sysenter
+ 8be:	cd 40                	int    $0x40
+ 8c0:	c3                   	ret
+
+000008c1 <open>:
+SYSCALL(open)
+ 8c1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 8c6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8cd:	74 09                	je     8d8 <open+0x17>
+ 8cf:	89 e1                	mov    %esp,%ecx
+ 8d1:	ba da 08 00 00       	mov    $0x8da,%edx
+ 8d6:	0f 34                	sysenter
+ 8d8:	cd 40                	int    $0x40
+ 8da:	c3                   	ret
+
+000008db <mknod>:
+SYSCALL(mknod)
+ 8db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 8e0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8e7:	74 09                	je     8f2 <mknod+0x17>
+ 8e9:	89 e1                	mov    %esp,%ecx
+ 8eb:	ba f4 08 00 00       	mov    $0x8f4,%edx
+ 8f0:	0f 34                	sysenter
+ 8f2:	cd 40                	int    $0x40
+ 8f4:	c3                   	ret
+
+000008f5 <unlink>:
+SYSCALL(unlink)
+ 8f5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8fa:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 901:	74 09                	je     90c <unlink+0x17>
+ 903:	89 e1                	mov    %esp,%ecx
+ 905:	ba 0e 09 00 00       	mov    $0x90e,%edx
+ 90a:	0f 34                	sysenter
+ 90c:	cd 40                	int    $0x40
+ 90e:	c3                   	ret
+
+0000090f <fstat>:
+SYSCALL(fstat)
+ 90f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 914:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 91b:	74 09                	je     926 <fstat+0x17>
+ 91d:	89 e1                	mov    %esp,%ecx
+ 91f:	ba 28 09 00 00       	mov    $0x928,%edx
+ 924:	0f 34                	sysenter
+ 926:	cd 40                	int    $0x40
+ 928:	c3                   	ret
+
+00000929 <link>:
+SYSCALL(link)
+ 929:	b8 13 00 00 00       	mov    $0x13,%eax
+ 92e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 935:	74 09                	je     940 <link+0x17>
+ 937:	89 e1                	mov    %esp,%ecx
+ 939:	ba 42 09 00 00       	mov    $0x942,%edx
+ 93e:	0f 34                	sysenter
+ 940:	cd 40                	int    $0x40
+ 942:	c3                   	ret
+
+00000943 <mkdir>:
+SYSCALL(mkdir)
+ 943:	b8 14 00 00 00       	mov    $0x14,%eax
+ 948:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 94f:	74 09                	je     95a <mkdir+0x17>
+ 951:	89 e1                	mov    %esp,%ecx
+ 953:	ba 5c 09 00 00       	mov    $0x95c,%edx
+ 958:	0f 34                	sysenter
+ 95a:	cd 40                	int    $0x40
+ 95c:	c3                   	ret
+
+0000095d <chdir>:
+SYSCALL(chdir)
+ 95d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 962:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 969:	74 09                	je     974 <chdir+0x17>
+ 96b:	89 e1                	mov    %esp,%ecx
+ 96d:	ba 76 09 00 00       	mov    $0x976,%edx
+ 972:	0f 34                	sysenter
+ 974:	cd 40                	int    $0x40
+ 976:	c3                   	ret
+
+00000977 <dup>:
+SYSCALL(dup)
+ 977:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 97c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 983:	74 09                	je     98e <dup+0x17>
+ 985:	89 e1                	mov    %esp,%ecx
+ 987:	ba 90 09 00 00       	mov    $0x990,%edx
+ 98c:	0f 34                	sysenter
+ 98e:	cd 40                	int    $0x40
+ 990:	c3                   	ret
+
+00000991 <sbrk>:
+SYSCALL(sbrk)
+ 991:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 996:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 99d:	74 09                	je     9a8 <sbrk+0x17>
+ 99f:	89 e1                	mov    %esp,%ecx
+ 9a1:	ba aa 09 00 00       	mov    $0x9aa,%edx
+ 9a6:	0f 34                	sysenter
+ 9a8:	cd 40                	int    $0x40
+ 9aa:	c3                   	ret
+
+000009ab <sleep>:
+SYSCALL(sleep)
+ 9ab:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 9b0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 9b7:	74 09                	je     9c2 <sleep+0x17>
+ 9b9:	89 e1                	mov    %esp,%ecx
+ 9bb:	ba c4 09 00 00       	mov    $0x9c4,%edx
+ 9c0:	0f 34                	sysenter
+ 9c2:	cd 40                	int    $0x40
+ 9c4:	c3                   	ret
+
+000009c5 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 9c5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 9ca:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 9d1:	74 09                	je     9dc <sigprocmask+0x17>
+ 9d3:	89 e1                	mov    %esp,%ecx
+ 9d5:	ba de 09 00 00       	mov    $0x9de,%edx
+ 9da:	0f 34                	sysenter
+ 9dc:	cd 40                	int    $0x40
+ 9de:	c3                   	ret
+
+000009df <sigaction>:
+SYSCALL(sigaction)
+ 9df:	b8 17 00 00 00       	mov    $0x17,%eax
+ 9e4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 9eb:	74 09                	je     9f6 <sigaction+0x17>
+ 9ed:	89 e1                	mov    %esp,%ecx
+ 9ef:	ba f8 09 00 00       	mov    $0x9f8,%edx
+ 9f4:	0f 34                	sysenter
+ 9f6:	cd 40                	int    $0x40
+ 9f8:	c3                   	ret
+
+000009f9 <sigret>:
+SYSCALL(sigret)
+ 9f9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 9fe:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ a05:	74 09                	je     a10 <sigret+0x17>
+ a07:	89 e1                	mov    %esp,%ecx
+ a09:	ba 12 0a 00 00       	mov    $0xa12,%edx
+ a0e:	0f 34                	sysenter
+ a10:	cd 40                	int    $0x40
+ a12:	c3                   	ret
+
+00000a13 <traceread>:
+SYSCALL(traceread)
+ a13:	b8 19 00 00 00       	mov    $0x19,%eax
+ a18:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ a1f:	74 09                	je     a2a <traceread+0x17>
+ a21:	89 e1                	mov    %esp,%ecx
+ a23:	ba 2c 0a 00 00       	mov    $0xa2c,%edx
+ a28:	0f 34                	sysenter
+ a2a:	cd 40                	int    $0x40
+ a2c:	c3                   	ret
+
+00000a2d <sigqueue>:
+SYSCALL(sigqueue)
+ a2d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ a32:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ a39:	74 09                	je     a44 <sigqueue+0x17>
+ a3b:	89 e1                	mov    %esp,%ecx
+ a3d:	ba 46 0a 00 00       	mov    $0xa46,%edx
+ a42:	0f 34                	sysenter
+ a44:	cd 40                	int    $0x40
+ a46:	c3                   	ret
+
+00000a47 <signalfd>:
+SYSCALL(signalfd)
+ a47:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ a4c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ a53:	74 09                	je     a5e <signalfd+0x17>
+ a55:	89 e1                	mov    %esp,%ecx
+ a57:	ba 60 0a 00 00       	mov    $0xa60,%edx
+ a5c:	0f 34                	sysenter
+ a5e:	cd 40                	int    $0x40
+ a60:	c3                   	ret
+
+00000a61 <sigwait>:
+SYSCALL(sigwait)
+ a61:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ a66:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ a6d:	74 09                	je     a78 <sigwait+0x17>
+ a6f:	89 e1                	mov    %esp,%ecx
+ a71:	ba 7a 0a 00 00       	mov    $0xa7a,%edx
+ a76:	0f 34                	sysenter
+ a78:	cd 40                	int    $0x40
+ a7a:	c3                   	ret
+
+00000a7b <sigsuspend>:
+SYSCALL(sigsuspend)
+ a7b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ a80:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ a87:	74 09                	je     a92 <sigsuspend+0x17>
+ a89:	89 e1                	mov    %esp,%ecx
+ a8b:	ba 94 0a 00 00       	mov    $0xa94,%edx
+ a90:	0f 34                	sysenter
+ a92:	cd 40                	int    $0x40
+ a94:	c3                   	ret
+
+00000a95 <waitpid>:
+SYSCALL(waitpid)
+ a95:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a9a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ aa1:	74 09                	je     aac <waitpid+0x17>
+ aa3:	89 e1                	mov    %esp,%ecx
+ aa5:	ba ae 0a 00 00       	mov    $0xaae,%edx
+ aaa:	0f 34                	sysenter
+ aac:	cd 40                	int    $0x40
+ aae:	c3                   	ret
+
+00000aaf <setitimer>:
+SYSCALL(setitimer)
+ aaf:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ ab4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ abb:	74 09                	je     ac6 <setitimer+0x17>
+ abd:	89 e1                	mov    %esp,%ecx
+ abf:	ba c8 0a 00 00       	mov    $0xac8,%edx
+ ac4:	0f 34                	sysenter
+ ac6:	cd 40                	int    $0x40
+ ac8:	c3                   	ret
+
+00000ac9 <nanosleep>:
+SYSCALL(nanosleep)
+ ac9:	b8 21 00 00 00       	mov    $0x21,%eax
+ ace:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ ad5:	74 09                	je     ae0 <nanosleep+0x17>
+ ad7:	89 e1                	mov    %esp,%ecx
+ ad9:	ba e2 0a 00 00       	mov    $0xae2,%edx
+ ade:	0f 34                	sysenter
+ ae0:	cd 40                	int    $0x40
+ ae2:	c3                   	ret
+
+00000ae3 <mmap>:
+SYSCALL(mmap)
+ ae3:	b8 22 00 00 00       	mov    $0x22,%eax
+ ae8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ aef:	74 09                	je     afa <mmap+0x17>
+ af1:	89 e1                	mov    %esp,%ecx
+ af3:	ba fc 0a 00 00       	mov    $0xafc,%edx
+ af8:	0f 34                	sysenter
+ afa:	cd 40                	int    $0x40
+ afc:	c3                   	ret
+
+00000afd <munmap>:
+SYSCALL(munmap)
+ afd:	b8 23 00 00 00       	mov    $0x23,%eax
+ b02:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ b09:	74 09                	je     b14 <munmap+0x17>
+ b0b:	89 e1                	mov    %esp,%ecx
+ b0d:	ba 16 0b 00 00       	mov    $0xb16,%edx
+ b12:	0f 34                	sysenter
+ b14:	cd 40                	int    $0x40
+ b16:	c3                   	ret
+
+00000b17 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ b17:	b8 0b 00 00 00       	mov    $0xb,%eax
+ b1c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ b23:	74 09                	je     b2e <getpid_syscall+0x17>
+ b25:	89 e1                	mov    %esp,%ecx
+ b27:	ba 30 0b 00 00       	mov    $0xb30,%edx
+ b2c:	0f 34                	sysenter
+ b2e:	cd 40                	int    $0x40
+ b30:	c3                   	ret
+
+00000b31 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ b31:	b8 0b 00 00 00       	mov    $0xb,%eax
+ b36:	cd 40                	int    $0x40
+ b38:	c3                   	ret
+ b39:	66 90                	xchg   %ax,%ax
+ b3b:	66 90                	xchg   %ax,%ax
+ b3d:	66 90                	xchg   %ax,%ax
+ b3f:	90                   	nop
+
+00000b40 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	57                   	push   %edi
+ b44:	56                   	push   %esi
+ b45:	53                   	push   %ebx
+ b46:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ b48:	89 d1                	mov    %edx,%ecx
+{
+ b4a:	83 ec 3c             	sub    $0x3c,%esp
+ b4d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ b50:	85 d2                	test   %edx,%edx
+ b52:	0f 89 80 00 00 00    	jns    bd8 <printint+0x98>
+ b58:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ b5c:	74 7a                	je     bd8 <printint+0x98>
+    x = -xx;
+ b5e:	f7 d9                	neg    %ecx
+    neg = 1;
+ b60:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ b65:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ b68:	31 f6                	xor    %esi,%esi
+ b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ b70:	89 c8                	mov    %ecx,%eax
+ b72:	31 d2                	xor    %edx,%edx
+ b74:	89 f7                	mov    %esi,%edi
+ b76:	f7 f3                	div    %ebx
+ b78:	8d 76 01             	lea    0x1(%esi),%esi
+ b7b:	0f b6 92 bc 10 00 00 	movzbl 0x10bc(%edx),%edx
+ b82:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ b86:	89 ca                	mov    %ecx,%edx
+ b88:	89 c1                	mov    %eax,%ecx
+ b8a:	39 da                	cmp    %ebx,%edx
+ b8c:	73 e2                	jae    b70 <printint+0x30>
+  if(neg)
+ b8e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b91:	85 c0                	test   %eax,%eax
+ b93:	74 07                	je     b9c <printint+0x5c>
+    buf[i++] = '-';
+ b95:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ b9a:	89 f7                	mov    %esi,%edi
+ b9c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ b9f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ ba2:	01 df                	add    %ebx,%edi
+ ba4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ ba8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ bab:	83 ec 04             	sub    $0x4,%esp
+ bae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ bb1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ bb4:	6a 01                	push   $0x1
+ bb6:	50                   	push   %eax
+ bb7:	56                   	push   %esi
+ bb8:	e8 9c fc ff ff       	call   859 <write>
+  while(--i >= 0)
+ bbd:	89 f8                	mov    %edi,%eax
+ bbf:	83 c4 10             	add    $0x10,%esp
+ bc2:	83 ef 01             	sub    $0x1,%edi
+ bc5:	39 d8                	cmp    %ebx,%eax
+ bc7:	75 df                	jne    ba8 <printint+0x68>
+}
+ bc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bcc:	5b                   	pop    %ebx
+ bcd:	5e                   	pop    %esi
+ bce:	5f                   	pop    %edi
+ bcf:	5d                   	pop    %ebp
+ bd0:	c3                   	ret
+ bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ bd8:	31 c0                	xor    %eax,%eax
+ bda:	eb 89                	jmp    b65 <printint+0x25>
+ bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000be0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	57                   	push   %edi
+ be4:	56                   	push   %esi
+ be5:	53                   	push   %ebx
+ be6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ be9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ bec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ bef:	0f b6 1e             	movzbl (%esi),%ebx
+ bf2:	83 c6 01             	add    $0x1,%esi
+ bf5:	84 db                	test   %bl,%bl
+ bf7:	74 67                	je     c60 <printf+0x80>
+ bf9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ bfc:	31 d2                	xor    %edx,%edx
+ bfe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ c01:	eb 34                	jmp    c37 <printf+0x57>
+ c03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c07:	90                   	nop
+ c08:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ c0b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ c10:	83 f8 25             	cmp    $0x25,%eax
+ c13:	74 18                	je     c2d <printf+0x4d>
+  write(fd, &c, 1);
+ c15:	83 ec 04             	sub    $0x4,%esp
+ c18:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ c1b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c1e:	6a 01                	push   $0x1
+ c20:	50                   	push   %eax
+ c21:	57                   	push   %edi
+ c22:	e8 32 fc ff ff       	call   859 <write>
+ c27:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ c2a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ c2d:	0f b6 1e             	movzbl (%esi),%ebx
+ c30:	83 c6 01             	add    $0x1,%esi
+ c33:	84 db                	test   %bl,%bl
+ c35:	74 29                	je     c60 <printf+0x80>
+    c = fmt[i] & 0xff;
+ c37:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ c3a:	85 d2                	test   %edx,%edx
+ c3c:	74 ca                	je     c08 <printf+0x28>
+      }
+    } else if(state == '%'){
+ c3e:	83 fa 25             	cmp    $0x25,%edx
+ c41:	75 ea                	jne    c2d <printf+0x4d>
+      if(c == 'd'){
+ c43:	83 f8 25             	cmp    $0x25,%eax
+ c46:	0f 84 24 01 00 00    	je     d70 <printf+0x190>
+ c4c:	83 e8 63             	sub    $0x63,%eax
+ c4f:	83 f8 15             	cmp    $0x15,%eax
+ c52:	77 1c                	ja     c70 <printf+0x90>
+ c54:	ff 24 85 64 10 00 00 	jmp    *0x1064(,%eax,4)
+ c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c5f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ c60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c63:	5b                   	pop    %ebx
+ c64:	5e                   	pop    %esi
+ c65:	5f                   	pop    %edi
+ c66:	5d                   	pop    %ebp
+ c67:	c3                   	ret
+ c68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c6f:	90                   	nop
+  write(fd, &c, 1);
+ c70:	83 ec 04             	sub    $0x4,%esp
+ c73:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c76:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ c7a:	6a 01                	push   $0x1
+ c7c:	52                   	push   %edx
+ c7d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ c80:	57                   	push   %edi
+ c81:	e8 d3 fb ff ff       	call   859 <write>
+ c86:	83 c4 0c             	add    $0xc,%esp
+ c89:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c8c:	6a 01                	push   $0x1
+ c8e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ c91:	52                   	push   %edx
+ c92:	57                   	push   %edi
+ c93:	e8 c1 fb ff ff       	call   859 <write>
+        putc(fd, c);
+ c98:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c9b:	31 d2                	xor    %edx,%edx
+ c9d:	eb 8e                	jmp    c2d <printf+0x4d>
+ c9f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ ca0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ca3:	83 ec 0c             	sub    $0xc,%esp
+ ca6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ cab:	8b 13                	mov    (%ebx),%edx
+ cad:	6a 00                	push   $0x0
+ caf:	89 f8                	mov    %edi,%eax
+        ap++;
+ cb1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ cb4:	e8 87 fe ff ff       	call   b40 <printint>
+        ap++;
+ cb9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ cbc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ cbf:	31 d2                	xor    %edx,%edx
+ cc1:	e9 67 ff ff ff       	jmp    c2d <printf+0x4d>
+ cc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ccd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ cd0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ cd3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ cd5:	83 c0 04             	add    $0x4,%eax
+ cd8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ cdb:	85 db                	test   %ebx,%ebx
+ cdd:	0f 84 9d 00 00 00    	je     d80 <printf+0x1a0>
+        while(*s != 0){
+ ce3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ ce6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ ce8:	84 c0                	test   %al,%al
+ cea:	0f 84 3d ff ff ff    	je     c2d <printf+0x4d>
+ cf0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ cf3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ cf6:	89 de                	mov    %ebx,%esi
+ cf8:	89 d3                	mov    %edx,%ebx
+ cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ d00:	83 ec 04             	sub    $0x4,%esp
+ d03:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ d06:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ d09:	6a 01                	push   $0x1
+ d0b:	53                   	push   %ebx
+ d0c:	57                   	push   %edi
+ d0d:	e8 47 fb ff ff       	call   859 <write>
+        while(*s != 0){
+ d12:	0f b6 06             	movzbl (%esi),%eax
+ d15:	83 c4 10             	add    $0x10,%esp
+ d18:	84 c0                	test   %al,%al
+ d1a:	75 e4                	jne    d00 <printf+0x120>
+      state = 0;
+ d1c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ d1f:	31 d2                	xor    %edx,%edx
+ d21:	e9 07 ff ff ff       	jmp    c2d <printf+0x4d>
+ d26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d2d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ d30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ d33:	83 ec 0c             	sub    $0xc,%esp
+ d36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ d3b:	8b 13                	mov    (%ebx),%edx
+ d3d:	6a 01                	push   $0x1
+ d3f:	e9 6b ff ff ff       	jmp    caf <printf+0xcf>
+ d44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ d48:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ d4b:	83 ec 04             	sub    $0x4,%esp
+ d4e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ d51:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ d53:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ d56:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ d59:	6a 01                	push   $0x1
+ d5b:	52                   	push   %edx
+ d5c:	57                   	push   %edi
+ d5d:	e8 f7 fa ff ff       	call   859 <write>
+        ap++;
+ d62:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ d65:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ d68:	31 d2                	xor    %edx,%edx
+ d6a:	e9 be fe ff ff       	jmp    c2d <printf+0x4d>
+ d6f:	90                   	nop
+  write(fd, &c, 1);
+ d70:	83 ec 04             	sub    $0x4,%esp
+ d73:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ d76:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ d79:	6a 01                	push   $0x1
+ d7b:	e9 11 ff ff ff       	jmp    c91 <printf+0xb1>
+ d80:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ d85:	bb 5b 10 00 00       	mov    $0x105b,%ebx
+ d8a:	e9 61 ff ff ff       	jmp    cf0 <printf+0x110>
+ d8f:	90                   	nop
+
+00000d90 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d90:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d91:	a1 80 16 00 00       	mov    0x1680,%eax
+{
+ d96:	89 e5                	mov    %esp,%ebp
+ d98:	57                   	push   %edi
+ d99:	56                   	push   %esi
+ d9a:	53                   	push   %ebx
+ d9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d9e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ da1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ da8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ daa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ dac:	39 ca                	cmp    %ecx,%edx
+ dae:	73 30                	jae    de0 <free+0x50>
+ db0:	39 c1                	cmp    %eax,%ecx
+ db2:	72 04                	jb     db8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ db4:	39 c2                	cmp    %eax,%edx
+ db6:	72 f0                	jb     da8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ db8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ dbb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ dbe:	39 f8                	cmp    %edi,%eax
+ dc0:	74 2e                	je     df0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ dc2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ dc5:	8b 42 04             	mov    0x4(%edx),%eax
+ dc8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ dcb:	39 f1                	cmp    %esi,%ecx
+ dcd:	74 38                	je     e07 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ dcf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ dd1:	5b                   	pop    %ebx
+  freep = p;
+ dd2:	89 15 80 16 00 00    	mov    %edx,0x1680
+}
+ dd8:	5e                   	pop    %esi
+ dd9:	5f                   	pop    %edi
+ dda:	5d                   	pop    %ebp
+ ddb:	c3                   	ret
+ ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ de0:	39 c1                	cmp    %eax,%ecx
+ de2:	72 d0                	jb     db4 <free+0x24>
+ de4:	eb c2                	jmp    da8 <free+0x18>
+ de6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ded:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ df0:	03 70 04             	add    0x4(%eax),%esi
+ df3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ df6:	8b 02                	mov    (%edx),%eax
+ df8:	8b 00                	mov    (%eax),%eax
+ dfa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ dfd:	8b 42 04             	mov    0x4(%edx),%eax
+ e00:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e03:	39 f1                	cmp    %esi,%ecx
+ e05:	75 c8                	jne    dcf <free+0x3f>
+    p->s.size += bp->s.size;
+ e07:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ e0a:	89 15 80 16 00 00    	mov    %edx,0x1680
+    p->s.size += bp->s.size;
+ e10:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ e13:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ e16:	89 0a                	mov    %ecx,(%edx)
+}
+ e18:	5b                   	pop    %ebx
+ e19:	5e                   	pop    %esi
+ e1a:	5f                   	pop    %edi
+ e1b:	5d                   	pop    %ebp
+ e1c:	c3                   	ret
+ e1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e20 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ e20:	55                   	push   %ebp
+ e21:	89 e5                	mov    %esp,%ebp
+ e23:	57                   	push   %edi
+ e24:	56                   	push   %esi
+ e25:	53                   	push   %ebx
+ e26:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e29:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ e2c:	8b 15 80 16 00 00    	mov    0x1680,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e32:	8d 78 07             	lea    0x7(%eax),%edi
+ e35:	c1 ef 03             	shr    $0x3,%edi
+ e38:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ e3b:	85 d2                	test   %edx,%edx
+ e3d:	0f 84 8d 00 00 00    	je     ed0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e43:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e45:	8b 48 04             	mov    0x4(%eax),%ecx
+ e48:	39 f9                	cmp    %edi,%ecx
+ e4a:	73 64                	jae    eb0 <malloc+0x90>
+  if(nu < 4096)
+ e4c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e51:	39 df                	cmp    %ebx,%edi
+ e53:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e56:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e5d:	eb 0a                	jmp    e69 <malloc+0x49>
+ e5f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e60:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e62:	8b 48 04             	mov    0x4(%eax),%ecx
+ e65:	39 f9                	cmp    %edi,%ecx
+ e67:	73 47                	jae    eb0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e69:	89 c2                	mov    %eax,%edx
+ e6b:	39 05 80 16 00 00    	cmp    %eax,0x1680
+ e71:	75 ed                	jne    e60 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ e73:	83 ec 0c             	sub    $0xc,%esp
+ e76:	56                   	push   %esi
+ e77:	e8 15 fb ff ff       	call   991 <sbrk>
+  if(p == (char*)-1)
+ e7c:	83 c4 10             	add    $0x10,%esp
+ e7f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e82:	74 1c                	je     ea0 <malloc+0x80>
+  hp->s.size = nu;
+ e84:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e87:	83 ec 0c             	sub    $0xc,%esp
+ e8a:	83 c0 08             	add    $0x8,%eax
+ e8d:	50                   	push   %eax
+ e8e:	e8 fd fe ff ff       	call   d90 <free>
+  return freep;
+ e93:	8b 15 80 16 00 00    	mov    0x1680,%edx
+      if((p = morecore(nunits)) == 0)
+ e99:	83 c4 10             	add    $0x10,%esp
+ e9c:	85 d2                	test   %edx,%edx
+ e9e:	75 c0                	jne    e60 <malloc+0x40>
+        return 0;
+  }
+}
+ ea0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ea3:	31 c0                	xor    %eax,%eax
+}
+ ea5:	5b                   	pop    %ebx
+ ea6:	5e                   	pop    %esi
+ ea7:	5f                   	pop    %edi
+ ea8:	5d                   	pop    %ebp
+ ea9:	c3                   	ret
+ eaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ eb0:	39 cf                	cmp    %ecx,%edi
+ eb2:	74 4c                	je     f00 <malloc+0xe0>
+        p->s.size -= nunits;
+ eb4:	29 f9                	sub    %edi,%ecx
+ eb6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ eb9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ ebc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ ebf:	89 15 80 16 00 00    	mov    %edx,0x1680
+}
+ ec5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ec8:	83 c0 08             	add    $0x8,%eax
+}
+ ecb:	5b                   	pop    %ebx
+ ecc:	5e                   	pop    %esi
+ ecd:	5f                   	pop    %edi
+ ece:	5d                   	pop    %ebp
+ ecf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ed0:	c7 05 80 16 00 00 84 	movl   $0x1684,0x1680
+ ed7:	16 00 00 
+    base.s.size = 0;
+ eda:	b8 84 16 00 00       	mov    $0x1684,%eax
+    base.s.ptr = freep = prevp = &base;
+ edf:	c7 05 84 16 00 00 84 	movl   $0x1684,0x1684
+ ee6:	16 00 00 
+    base.s.size = 0;
+ ee9:	c7 05 88 16 00 00 00 	movl   $0x0,0x1688
+ ef0:	00 00 00 
+    if(p->s.size >= nunits){
+ ef3:	e9 54 ff ff ff       	jmp    e4c <malloc+0x2c>
+ ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ eff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ f00:	8b 08                	mov    (%eax),%ecx
+ f02:	89 0a                	mov    %ecx,(%edx)
+ f04:	eb b9                	jmp    ebf <malloc+0x9f>
@@ -0,0 +1,160 @@
+// File scanning benchmark: read() versus mmap().
+// Writes a file of text lines, then counts its lines repeatedly,
+// reading it through a buffer with read() and through a private
+// read-only mapping, and reports microseconds per pass for each.
+// Also checks that separate MAP_SHARED mappings of the file see each
+// other's writes and that both reach the file.
+//   usage: mmapbench [passes]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define FILESIZE (64 * 1024)
+
+static char *name = "mmapbench.tmp";
+static char buf[512];
+
+// Microseconds from a to b.
+static uint
+usecs(struct timespec *a, struct timespec *b)
+{
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+}
+
+static int
+scanread(void)
+{
+  int fd, n, i, lines;
+
+  if((fd = open(name, O_RDONLY)) < 0){
+    printf(2, "mmapbench: open failed\n");
+    exit(1);
+  }
+  lines = 0;
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+    for(i = 0; i < n; i++)
+      if(buf[i] == '\n')
+        lines++;
+  close(fd);
+  return lines;
+}
+
+static int
+scanmmap(void)
+{
+  int fd, i, lines;
+  char *p;
+
+  if((fd = open(name, O_RDONLY)) < 0){
+    printf(2, "mmapbench: open failed\n");
+    exit(1);
+  }
+  p = mmap(0, FILESIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(p == (char*)-1){
+    printf(2, "mmapbench: mmap failed\n");
+    exit(1);
+  }
+  lines = 0;
+  for(i = 0; i < FILESIZE; i++)
+    if(p[i] == '\n')
+      lines++;
+  munmap(p, FILESIZE);
+  return lines;
+}
+
+static void
+run(char *what, int (*scan)(void), int n, int want)
+{
+  struct timespec t0, t1;
+  int i;
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  for(i = 0; i < n; i++){
+    if(scan() != want){
+      printf(2, "mmapbench: %s counted wrong\n", what);
+      exit(1);
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  printf(1, "mmapbench %s %d bytes %d us/pass\n", what, FILESIZE,
+         usecs(&t0, &t1) / n);
+}
+
+// Write through two shared mappings, one made by a child, and read
+// the result back.
+static void
+shared(void)
+{
+  int fd, pid, status;
+  char *p, *q;
+
+  if((fd = open(name, O_RDWR)) < 0){
+    printf(2, "mmapbench: open failed\n");
+    exit(1);
+  }
+  p = mmap(0, FILESIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == (char*)-1){
+    printf(2, "mmapbench: mmap failed\n");
+    exit(1);
+  }
+  p[0] = 'X';
+  if((pid = fork()) < 0){
+    printf(2, "mmapbench: fork failed\n");
+    exit(1);
+  }
+  if(pid == 0){
+    // A mapping of its own, not the one inherited from the parent.
+    q = mmap(0, FILESIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    if(q == (char*)-1 || q[0] != 'X')
+      exit(1);
+    q[1] = 'Y';
+    munmap(q, FILESIZE);
+    exit(0);
+  }
+  if(waitpid(pid, &status, 0) != pid || status != 0 || p[1] != 'Y'){
+    printf(2, "mmapbench: MAP_SHARED mappings are not coherent\n");
+    exit(1);
+  }
+  munmap(p, FILESIZE);
+  read(fd, buf, 2);
+  close(fd);
+  if(buf[0] != 'X' || buf[1] != 'Y'){
+    printf(2, "mmapbench: MAP_SHARED write was lost\n");
+    exit(1);
+  }
+  printf(1, "mmapbench MAP_SHARED write ok\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fd, i, n, lines;
+
+  n = argc > 1 ? atoi(argv[1]) : 20;
+  if(n <= 0){
+    printf(2, "usage: mmapbench [passes]\n");
+    exit(1);
+  }
+
+  // 64-byte lines.
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = i % 64 == 63 ? '\n' : 'a' + i % 26;
+  if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+    printf(2, "mmapbench: create failed\n");
+    exit(1);
+  }
+  for(i = 0; i < FILESIZE; i += sizeof(buf))
+    write(fd, buf, sizeof(buf));
+  close(fd);
+  lines = FILESIZE / 64;
+
+  run("read", scanread, n, lines);
+  run("mmap", scanmmap, n, lines);
+  shared();
+  unlink(name);
+  exit(0);
+}
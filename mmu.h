@@ -3,6 +3,7 @@
 
 // Eflags register
 #define FL_IF           0x00000200      // Interrupt Enable
+#define FL_USER         0x00000DD5      // Arithmetic flags, TF and DF: safe for user code to set
 
 // Control Register flags
 #define CR0_PE          0x00000001      // Protection Enable
@@ -11,6 +12,14 @@
 
 #define CR4_PSE         0x00000010      // Page size extension
 
+// Model-specific registers
+#define MSR_SYSENTER_CS  0x174          // SYSENTER %cs; %ss is the next GDT entry
+#define MSR_SYSENTER_ESP 0x175          // SYSENTER %esp
+#define MSR_SYSENTER_EIP 0x176          // SYSENTER %eip
+
+// CPUID leaf 1 %edx feature flags
+#define CPUID_SEP       0x00000800      // SYSENTER/SYSEXIT
+
 // various segment selectors.
 #define SEG_KCODE 1  // kernel code
 #define SEG_KDATA 2  // kernel data+stack
@@ -94,7 +103,14 @@ struct segdesc {
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
+#define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
+#define PTE_COW         0x200   // Copy-on-write (software; PTE_W is clear)
+
+// Page fault error code bits
+#define FEC_PR          0x1     // Protection violation (else not present)
+#define FEC_WR          0x2     // Caused by a write
+#define FEC_U           0x4     // Caused in user mode
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
@@ -0,0 +1,1565 @@
+
+_mytest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1,"hello");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+  // sigaction(3, &//benny, 0);
+  kill(getpid(), SIGSTOP);
+  for(int j = 0; j < 10; j++){
+   e:	31 db                	xor    %ebx,%ebx
+{
+  10:	51                   	push   %ecx
+  kill(getpid(), SIGSTOP);
+  11:	e8 1a 03 00 00       	call   330 <getpid>
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	6a 11                	push   $0x11
+  1b:	50                   	push   %eax
+  1c:	e8 5c 04 00 00       	call   47d <kill>
+  21:	83 c4 10             	add    $0x10,%esp
+  24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1,"%d\n", j);
+  28:	83 ec 04             	sub    $0x4,%esp
+  2b:	53                   	push   %ebx
+  for(int j = 0; j < 10; j++){
+  2c:	83 c3 01             	add    $0x1,%ebx
+      printf(1,"%d\n", j);
+  2f:	68 fe 0a 00 00       	push   $0xafe
+  34:	6a 01                	push   $0x1
+  36:	e8 95 07 00 00       	call   7d0 <printf>
+  for(int j = 0; j < 10; j++){
+  3b:	83 c4 10             	add    $0x10,%esp
+  3e:	83 fb 0a             	cmp    $0xa,%ebx
+  41:	75 e5                	jne    28 <main+0x28>
+  }
+  kill(getpid(), SIGCONT);
+  43:	e8 e8 02 00 00       	call   330 <getpid>
+  48:	83 ec 08             	sub    $0x8,%esp
+  for (int i = 0; i < 10; i++)
+  4b:	31 db                	xor    %ebx,%ebx
+  kill(getpid(), SIGCONT);
+  4d:	6a 13                	push   $0x13
+  4f:	50                   	push   %eax
+  50:	e8 28 04 00 00       	call   47d <kill>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5f:	90                   	nop
+  {
+      printf(1,"%d\n", i);
+  60:	83 ec 04             	sub    $0x4,%esp
+  63:	53                   	push   %ebx
+  for (int i = 0; i < 10; i++)
+  64:	83 c3 01             	add    $0x1,%ebx
+      printf(1,"%d\n", i);
+  67:	68 fe 0a 00 00       	push   $0xafe
+  6c:	6a 01                	push   $0x1
+  6e:	e8 5d 07 00 00       	call   7d0 <printf>
+  for (int i = 0; i < 10; i++)
+  73:	83 c4 10             	add    $0x10,%esp
+  76:	83 fb 0a             	cmp    $0xa,%ebx
+  79:	75 e5                	jne    60 <main+0x60>
+  }
+  
+
+  exit(0);
+  7b:	83 ec 0c             	sub    $0xc,%esp
+  7e:	6a 00                	push   $0x0
+  80:	e8 5c 03 00 00       	call   3e1 <exit>
+  85:	66 90                	xchg   %ax,%ax
+  87:	66 90                	xchg   %ax,%ax
+  89:	66 90                	xchg   %ax,%ax
+  8b:	66 90                	xchg   %ax,%ax
+  8d:	66 90                	xchg   %ax,%ax
+  8f:	90                   	nop
+
+00000090 <hello_world>:
+hello_world(){
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	83 ec 10             	sub    $0x10,%esp
+  printf(1,"hello");
+  96:	68 f8 0a 00 00       	push   $0xaf8
+  9b:	6a 01                	push   $0x1
+  9d:	e8 2e 07 00 00       	call   7d0 <printf>
+}
+  a2:	83 c4 10             	add    $0x10,%esp
+  a5:	c9                   	leave
+  a6:	c3                   	ret
+  a7:	66 90                	xchg   %ax,%ax
+  a9:	66 90                	xchg   %ax,%ax
+  ab:	66 90                	xchg   %ax,%ax
+  ad:	66 90                	xchg   %ax,%ax
+  af:	90                   	nop
+
+000000b0 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  b1:	31 c0                	xor    %eax,%eax
+{
+  b3:	89 e5                	mov    %esp,%ebp
+  b5:	53                   	push   %ebx
+  b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  c7:	83 c0 01             	add    $0x1,%eax
+  ca:	84 d2                	test   %dl,%dl
+  cc:	75 f2                	jne    c0 <strcpy+0x10>
+    ;
+  return os;
+}
+  ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d1:	89 c8                	mov    %ecx,%eax
+  d3:	c9                   	leave
+  d4:	c3                   	ret
+  d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	53                   	push   %ebx
+  e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ea:	0f b6 02             	movzbl (%edx),%eax
+  ed:	84 c0                	test   %al,%al
+  ef:	75 17                	jne    108 <strcmp+0x28>
+  f1:	eb 3a                	jmp    12d <strcmp+0x4d>
+  f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  f7:	90                   	nop
+  f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  fc:	83 c2 01             	add    $0x1,%edx
+  ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 102:	84 c0                	test   %al,%al
+ 104:	74 1a                	je     120 <strcmp+0x40>
+    p++, q++;
+ 106:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 108:	0f b6 19             	movzbl (%ecx),%ebx
+ 10b:	38 c3                	cmp    %al,%bl
+ 10d:	74 e9                	je     f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 10f:	29 d8                	sub    %ebx,%eax
+}
+ 111:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 114:	c9                   	leave
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 120:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 124:	31 c0                	xor    %eax,%eax
+ 126:	29 d8                	sub    %ebx,%eax
+}
+ 128:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 12b:	c9                   	leave
+ 12c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 12d:	0f b6 19             	movzbl (%ecx),%ebx
+ 130:	31 c0                	xor    %eax,%eax
+ 132:	eb db                	jmp    10f <strcmp+0x2f>
+ 134:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+
+00000140 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 146:	80 3a 00             	cmpb   $0x0,(%edx)
+ 149:	74 15                	je     160 <strlen+0x20>
+ 14b:	31 c0                	xor    %eax,%eax
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+ 150:	83 c0 01             	add    $0x1,%eax
+ 153:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 157:	89 c1                	mov    %eax,%ecx
+ 159:	75 f5                	jne    150 <strlen+0x10>
+    ;
+  return n;
+}
+ 15b:	89 c8                	mov    %ecx,%eax
+ 15d:	5d                   	pop    %ebp
+ 15e:	c3                   	ret
+ 15f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 160:	31 c9                	xor    %ecx,%ecx
+}
+ 162:	5d                   	pop    %ebp
+ 163:	89 c8                	mov    %ecx,%eax
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000170 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	57                   	push   %edi
+ 174:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 177:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 17a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 17d:	89 d7                	mov    %edx,%edi
+ 17f:	fc                   	cld
+ 180:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 182:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 185:	89 d0                	mov    %edx,%eax
+ 187:	c9                   	leave
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 19a:	0f b6 10             	movzbl (%eax),%edx
+ 19d:	84 d2                	test   %dl,%dl
+ 19f:	75 12                	jne    1b3 <strchr+0x23>
+ 1a1:	eb 1d                	jmp    1c0 <strchr+0x30>
+ 1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1a7:	90                   	nop
+ 1a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ac:	83 c0 01             	add    $0x1,%eax
+ 1af:	84 d2                	test   %dl,%dl
+ 1b1:	74 0d                	je     1c0 <strchr+0x30>
+    if(*s == c)
+ 1b3:	38 d1                	cmp    %dl,%cl
+ 1b5:	75 f1                	jne    1a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1b7:	5d                   	pop    %ebp
+ 1b8:	c3                   	ret
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1c0:	31 c0                	xor    %eax,%eax
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	c3                   	ret
+ 1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1d9:	31 db                	xor    %ebx,%ebx
+{
+ 1db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1de:	eb 27                	jmp    207 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1e0:	83 ec 04             	sub    $0x4,%esp
+ 1e3:	6a 01                	push   $0x1
+ 1e5:	56                   	push   %esi
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	e8 42 02 00 00       	call   42f <read>
+    if(cc < 1)
+ 1ed:	83 c4 10             	add    $0x10,%esp
+ 1f0:	85 c0                	test   %eax,%eax
+ 1f2:	7e 1d                	jle    211 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1ff:	3c 0a                	cmp    $0xa,%al
+ 201:	74 10                	je     213 <gets+0x43>
+ 203:	3c 0d                	cmp    $0xd,%al
+ 205:	74 0c                	je     213 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 207:	89 df                	mov    %ebx,%edi
+ 209:	83 c3 01             	add    $0x1,%ebx
+ 20c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 20f:	7c cf                	jl     1e0 <gets+0x10>
+ 211:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 21a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 21d:	5b                   	pop    %ebx
+ 21e:	5e                   	pop    %esi
+ 21f:	5f                   	pop    %edi
+ 220:	5d                   	pop    %ebp
+ 221:	c3                   	ret
+ 222:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	56                   	push   %esi
+ 234:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 235:	83 ec 08             	sub    $0x8,%esp
+ 238:	6a 00                	push   $0x0
+ 23a:	ff 75 08             	push   0x8(%ebp)
+ 23d:	e8 6f 02 00 00       	call   4b1 <open>
+  if(fd < 0)
+ 242:	83 c4 10             	add    $0x10,%esp
+ 245:	85 c0                	test   %eax,%eax
+ 247:	78 27                	js     270 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 249:	83 ec 08             	sub    $0x8,%esp
+ 24c:	ff 75 0c             	push   0xc(%ebp)
+ 24f:	89 c3                	mov    %eax,%ebx
+ 251:	50                   	push   %eax
+ 252:	e8 a8 02 00 00       	call   4ff <fstat>
+  close(fd);
+ 257:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 25a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 25c:	e8 02 02 00 00       	call   463 <close>
+  return r;
+ 261:	83 c4 10             	add    $0x10,%esp
+}
+ 264:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 267:	89 f0                	mov    %esi,%eax
+ 269:	5b                   	pop    %ebx
+ 26a:	5e                   	pop    %esi
+ 26b:	5d                   	pop    %ebp
+ 26c:	c3                   	ret
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 270:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 275:	eb ed                	jmp    264 <stat+0x34>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 287:	0f be 02             	movsbl (%edx),%eax
+ 28a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 28d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 290:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 295:	77 1e                	ja     2b5 <atoi+0x35>
+ 297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2a0:	83 c2 01             	add    $0x1,%edx
+ 2a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2aa:	0f be 02             	movsbl (%edx),%eax
+ 2ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2b0:	80 fb 09             	cmp    $0x9,%bl
+ 2b3:	76 eb                	jbe    2a0 <atoi+0x20>
+  return n;
+}
+ 2b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b8:	89 c8                	mov    %ecx,%eax
+ 2ba:	c9                   	leave
+ 2bb:	c3                   	ret
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+ 2c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2ce:	85 c0                	test   %eax,%eax
+ 2d0:	7e 13                	jle    2e5 <memmove+0x25>
+ 2d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2d4:	89 d7                	mov    %edx,%edi
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2e1:	39 f8                	cmp    %edi,%eax
+ 2e3:	75 fb                	jne    2e0 <memmove+0x20>
+  return vdst;
+}
+ 2e5:	5e                   	pop    %esi
+ 2e6:	89 d0                	mov    %edx,%eax
+ 2e8:	5f                   	pop    %edi
+ 2e9:	5d                   	pop    %ebp
+ 2ea:	c3                   	ret
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 2f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 2f9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 300:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 303:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 306:	50                   	push   %eax
+ 307:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 30a:	50                   	push   %eax
+ 30b:	6a 00                	push   $0x0
+ 30d:	e8 8d 03 00 00       	call   69f <setitimer>
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	89 c2                	mov    %eax,%edx
+ 317:	31 c0                	xor    %eax,%eax
+ 319:	85 d2                	test   %edx,%edx
+ 31b:	78 03                	js     320 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 31d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 320:	c9                   	leave
+ 321:	c3                   	ret
+ 322:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 330:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 340:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 345:	c3                   	ret
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	53                   	push   %ebx
+ 356:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 359:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 35d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 360:	75 5e                	jne    3c0 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 362:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 368:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 36a:	89 d3                	mov    %edx,%ebx
+ 36c:	89 c1                	mov    %eax,%ecx
+ 36e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 374:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 37a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 37d:	31 d2                	xor    %edx,%edx
+ 37f:	89 d8                	mov    %ebx,%eax
+ 381:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 384:	f7 f6                	div    %esi
+ 386:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 388:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 38b:	f7 f6                	div    %esi
+ 38d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 38f:	89 da                	mov    %ebx,%edx
+ 391:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 396:	f7 f3                	div    %ebx
+ 398:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 39a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 39f:	89 d3                	mov    %edx,%ebx
+ 3a1:	f7 e1                	mul    %ecx
+ 3a3:	f7 f6                	div    %esi
+ 3a5:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 3ab:	01 c3                	add    %eax,%ebx
+  return 0;
+ 3ad:	31 c0                	xor    %eax,%eax
+ 3af:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 3b2:	83 c4 0c             	add    $0xc,%esp
+ 3b5:	5b                   	pop    %ebx
+ 3b6:	5e                   	pop    %esi
+ 3b7:	5f                   	pop    %edi
+ 3b8:	5d                   	pop    %ebp
+ 3b9:	c3                   	ret
+ 3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 3c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3c5:	eb eb                	jmp    3b2 <clock_gettime+0x62>
+
+000003c7 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3c7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3cc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3d3:	74 09                	je     3de <fork+0x17>
+ 3d5:	89 e1                	mov    %esp,%ecx
+ 3d7:	ba e0 03 00 00       	mov    $0x3e0,%edx
+ 3dc:	0f 34                	sysenter
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <exit>:
+SYSCALL(exit)
+ 3e1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3e6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3ed:	74 09                	je     3f8 <exit+0x17>
+ 3ef:	89 e1                	mov    %esp,%ecx
+ 3f1:	ba fa 03 00 00       	mov    $0x3fa,%edx
+ 3f6:	0f 34                	sysenter
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <wait>:
+SYSCALL(wait)
+ 3fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 400:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 407:	74 09                	je     412 <wait+0x17>
+ 409:	89 e1                	mov    %esp,%ecx
+ 40b:	ba 14 04 00 00       	mov    $0x414,%edx
+ 410:	0f 34                	sysenter
+ 412:	cd 40                	int    $0x40
+ 414:	c3                   	ret
+
+00000415 <pipe>:
+SYSCALL(pipe)
+ 415:	b8 04 00 00 00       	mov    $0x4,%eax
+ 41a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 421:	74 09                	je     42c <pipe+0x17>
+ 423:	89 e1                	mov    %esp,%ecx
+ 425:	ba 2e 04 00 00       	mov    $0x42e,%edx
+ 42a:	0f 34                	sysenter
+ 42c:	cd 40                	int    $0x40
+ 42e:	c3                   	ret
+
+0000042f <read>:
+SYSCALL(read)
+ 42f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 434:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 43b:	74 09                	je     446 <read+0x17>
+ 43d:	89 e1                	mov    %esp,%ecx
+ 43f:	ba 48 04 00 00       	mov    $0x448,%edx
+ 444:	0f 34                	sysenter
+ 446:	cd 40                	int    $0x40
+ 448:	c3                   	ret
+
+00000449 <write>:
+SYSCALL(write)
+ 449:	b8 10 00 00 00       	mov    $0x10,%eax
+ 44e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 455:	74 09                	je     460 <write+0x17>
+ 457:	89 e1                	mov    %esp,%ecx
+ 459:	ba 62 04 00 00       	mov    $0x462,%edx
+ 45e:	0f 34                	sysenter
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <close>:
+SYSCALL(close)
+ 463:	b8 15 00 00 00       	mov    $0x15,%eax
+ 468:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 46f:	74 09                	je     47a <close+0x17>
+ 471:	89 e1                	mov    %esp,%ecx
+ 473:	ba 7c 04 00 00       	mov    $0x47c,%edx
+ 478:	0f 34                	sysenter
+ 47a:	cd 40                	int    $0x40
+ 47c:	c3                   	ret
+
+0000047d <kill>:
+SYSCALL(kill)
+ 47d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 482:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 489:	74 09                	je     494 <kill+0x17>
+ 48b:	89 e1                	mov    %esp,%ecx
+ 48d:	ba 96 04 00 00       	mov    $0x496,%edx
+ 492:	0f 34                	sysenter
+ 494:	cd 40                	int    $0x40
+ 496:	c3                   	ret
+
+00000497 <exec>:
+SYSCALL(exec)
+ 497:	b8 07 00 00 00       	mov    $0x7,%eax
+ 49c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4a3:	74 09                	je     4ae <exec+0x17>
+ 4a5:	89 e1                	mov    %esp,%ecx
+ 4a7:	ba b0 04 00 00       	mov    $0x4b0,%edx
+ 4ac:	0f 34                	sysenter
+ 4ae:	cd 40                	int    $0x40
+ 4b0:	c3                   	ret
+
+000004b1 <open>:
+SYSCALL(open)
+ 4b1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4b6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4bd:	74 09                	je     4c8 <open+0x17>
+ 4bf:	89 e1                	mov    %esp,%ecx
+ 4c1:	ba ca 04 00 00       	mov    $0x4ca,%edx
+ 4c6:	0f 34                	sysenter
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <mknod>:
+SYSCALL(mknod)
+ 4cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4d0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4d7:	74 09                	je     4e2 <mknod+0x17>
+ 4d9:	89 e1                	mov    %esp,%ecx
+ 4db:	ba e4 04 00 00       	mov    $0x4e4,%edx
+ 4e0:	0f 34                	sysenter
+ 4e2:	cd 40                	int    $0x40
+ 4e4:	c3                   	ret
+
+000004e5 <unlink>:
+SYSCALL(unlink)
+ 4e5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4ea:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4f1:	74 09                	je     4fc <unlink+0x17>
+ 4f3:	89 e1                	mov    %esp,%ecx
+ 4f5:	ba fe 04 00 00       	mov    $0x4fe,%edx
+ 4fa:	0f 34                	sysenter
+ 4fc:	cd 40                	int    $0x40
+ 4fe:	c3                   	ret
+
+000004ff <fstat>:
+SYSCALL(fstat)
+ 4ff:	b8 08 00 00 00       	mov    $0x8,%eax
+ 504:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 50b:	74 09                	je     516 <fstat+0x17>
+ 50d:	89 e1                	mov    %esp,%ecx
+ 50f:	ba 18 05 00 00       	mov    $0x518,%edx
+ 514:	0f 34                	sysenter
+ 516:	cd 40                	int    $0x40
+ 518:	c3                   	ret
+
+00000519 <link>:
+SYSCALL(link)
+ 519:	b8 13 00 00 00       	mov    $0x13,%eax
+ 51e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 525:	74 09                	je     530 <link+0x17>
+ 527:	89 e1                	mov    %esp,%ecx
+ 529:	ba 32 05 00 00       	mov    $0x532,%edx
+ 52e:	0f 34                	sysenter
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <mkdir>:
+SYSCALL(mkdir)
+ 533:	b8 14 00 00 00       	mov    $0x14,%eax
+ 538:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 53f:	74 09                	je     54a <mkdir+0x17>
+ 541:	89 e1                	mov    %esp,%ecx
+ 543:	ba 4c 05 00 00       	mov    $0x54c,%edx
+ 548:	0f 34                	sysenter
+ 54a:	cd 40                	int    $0x40
+ 54c:	c3                   	ret
+
+0000054d <chdir>:
+SYSCALL(chdir)
+ 54d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 552:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 559:	74 09                	je     564 <chdir+0x17>
+ 55b:	89 e1                	mov    %esp,%ecx
+ 55d:	ba 66 05 00 00       	mov    $0x566,%edx
+ 562:	0f 34                	sysenter
+ 564:	cd 40                	int    $0x40
+ 566:	c3                   	ret
+
+00000567 <dup>:
+SYSCALL(dup)
+ 567:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 56c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 573:	74 09                	je     57e <dup+0x17>
+ 575:	89 e1                	mov    %esp,%ecx
+ 577:	ba 80 05 00 00       	mov    $0x580,%edx
+ 57c:	0f 34                	sysenter
+ 57e:	cd 40                	int    $0x40
+ 580:	c3                   	ret
+
+00000581 <sbrk>:
+SYSCALL(sbrk)
+ 581:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 586:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 58d:	74 09                	je     598 <sbrk+0x17>
+ 58f:	89 e1                	mov    %esp,%ecx
+ 591:	ba 9a 05 00 00       	mov    $0x59a,%edx
+ 596:	0f 34                	sysenter
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <sleep>:
+SYSCALL(sleep)
+ 59b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5a0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5a7:	74 09                	je     5b2 <sleep+0x17>
+ 5a9:	89 e1                	mov    %esp,%ecx
+ 5ab:	ba b4 05 00 00       	mov    $0x5b4,%edx
+ 5b0:	0f 34                	sysenter
+ 5b2:	cd 40                	int    $0x40
+ 5b4:	c3                   	ret
+
+000005b5 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 5b5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5ba:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5c1:	74 09                	je     5cc <sigprocmask+0x17>
+ 5c3:	89 e1                	mov    %esp,%ecx
+ 5c5:	ba ce 05 00 00       	mov    $0x5ce,%edx
+ 5ca:	0f 34                	sysenter
+ 5cc:	cd 40                	int    $0x40
+ 5ce:	c3                   	ret
+
+000005cf <sigaction>:
+SYSCALL(sigaction)
+ 5cf:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5d4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5db:	74 09                	je     5e6 <sigaction+0x17>
+ 5dd:	89 e1                	mov    %esp,%ecx
+ 5df:	ba e8 05 00 00       	mov    $0x5e8,%edx
+ 5e4:	0f 34                	sysenter
+ 5e6:	cd 40                	int    $0x40
+ 5e8:	c3                   	ret
+
+000005e9 <sigret>:
+SYSCALL(sigret)
+ 5e9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5ee:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5f5:	74 09                	je     600 <sigret+0x17>
+ 5f7:	89 e1                	mov    %esp,%ecx
+ 5f9:	ba 02 06 00 00       	mov    $0x602,%edx
+ 5fe:	0f 34                	sysenter
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <traceread>:
+SYSCALL(traceread)
+ 603:	b8 19 00 00 00       	mov    $0x19,%eax
+ 608:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 60f:	74 09                	je     61a <traceread+0x17>
+ 611:	89 e1                	mov    %esp,%ecx
+ 613:	ba 1c 06 00 00       	mov    $0x61c,%edx
+ 618:	0f 34                	sysenter
+ 61a:	cd 40                	int    $0x40
+ 61c:	c3                   	ret
+
+0000061d <sigqueue>:
+SYSCALL(sigqueue)
+ 61d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 622:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 629:	74 09                	je     634 <sigqueue+0x17>
+ 62b:	89 e1                	mov    %esp,%ecx
+ 62d:	ba 36 06 00 00       	mov    $0x636,%edx
+ 632:	0f 34                	sysenter
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <signalfd>:
+SYSCALL(signalfd)
+ 637:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 63c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 643:	74 09                	je     64e <signalfd+0x17>
+ 645:	89 e1                	mov    %esp,%ecx
+ 647:	ba 50 06 00 00       	mov    $0x650,%edx
+ 64c:	0f 34                	sysenter
+ 64e:	cd 40                	int    $0x40
+ 650:	c3                   	ret
+
+00000651 <sigwait>:
+SYSCALL(sigwait)
+ 651:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 656:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 65d:	74 09                	je     668 <sigwait+0x17>
+ 65f:	89 e1                	mov    %esp,%ecx
+ 661:	ba 6a 06 00 00       	mov    $0x66a,%edx
+ 666:	0f 34                	sysenter
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <sigsuspend>:
+SYSCALL(sigsuspend)
+ 66b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 670:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 677:	74 09                	je     682 <sigsuspend+0x17>
+ 679:	89 e1                	mov    %esp,%ecx
+ 67b:	ba 84 06 00 00       	mov    $0x684,%edx
+ 680:	0f 34                	sysenter
+ 682:	cd 40                	int    $0x40
+ 684:	c3                   	ret
+
+00000685 <waitpid>:
+SYSCALL(waitpid)
+ 685:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 68a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 691:	74 09                	je     69c <waitpid+0x17>
+ 693:	89 e1                	mov    %esp,%ecx
+ 695:	ba 9e 06 00 00       	mov    $0x69e,%edx
+ 69a:	0f 34                	sysenter
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <setitimer>:
+SYSCALL(setitimer)
+ 69f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6a4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6ab:	74 09                	je     6b6 <setitimer+0x17>
+ 6ad:	89 e1                	mov    %esp,%ecx
+ 6af:	ba b8 06 00 00       	mov    $0x6b8,%edx
+ 6b4:	0f 34                	sysenter
+ 6b6:	cd 40                	int    $0x40
+ 6b8:	c3                   	ret
+
+000006b9 <nanosleep>:
+SYSCALL(nanosleep)
+ 6b9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6be:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6c5:	74 09                	je     6d0 <nanosleep+0x17>
+ 6c7:	89 e1                	mov    %esp,%ecx
+ 6c9:	ba d2 06 00 00       	mov    $0x6d2,%edx
+ 6ce:	0f 34                	sysenter
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <mmap>:
+SYSCALL(mmap)
+ 6d3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6d8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6df:	74 09                	je     6ea <mmap+0x17>
+ 6e1:	89 e1                	mov    %esp,%ecx
+ 6e3:	ba ec 06 00 00       	mov    $0x6ec,%edx
+ 6e8:	0f 34                	sysenter
+ 6ea:	cd 40                	int    $0x40
+ 6ec:	c3                   	ret
+
+000006ed <munmap>:
+SYSCALL(munmap)
+ 6ed:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6f2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6f9:	74 09                	je     704 <munmap+0x17>
+ 6fb:	89 e1                	mov    %esp,%ecx
+ 6fd:	ba 06 07 00 00       	mov    $0x706,%edx
+ 702:	0f 34                	sysenter
+ 704:	cd 40                	int    $0x40
+ 706:	c3                   	ret
+
+00000707 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 707:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 70c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 713:	74 09                	je     71e <getpid_syscall+0x17>
+ 715:	89 e1                	mov    %esp,%ecx
+ 717:	ba 20 07 00 00       	mov    $0x720,%edx
+ 71c:	0f 34                	sysenter
+ 71e:	cd 40                	int    $0x40
+ 720:	c3                   	ret
+
+00000721 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 721:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 726:	cd 40                	int    $0x40
+ 728:	c3                   	ret
+ 729:	66 90                	xchg   %ax,%ax
+ 72b:	66 90                	xchg   %ax,%ax
+ 72d:	66 90                	xchg   %ax,%ax
+ 72f:	90                   	nop
+
+00000730 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	53                   	push   %ebx
+ 736:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 738:	89 d1                	mov    %edx,%ecx
+{
+ 73a:	83 ec 3c             	sub    $0x3c,%esp
+ 73d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 740:	85 d2                	test   %edx,%edx
+ 742:	0f 89 80 00 00 00    	jns    7c8 <printint+0x98>
+ 748:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 74c:	74 7a                	je     7c8 <printint+0x98>
+    x = -xx;
+ 74e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 750:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 755:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 758:	31 f6                	xor    %esi,%esi
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 760:	89 c8                	mov    %ecx,%eax
+ 762:	31 d2                	xor    %edx,%edx
+ 764:	89 f7                	mov    %esi,%edi
+ 766:	f7 f3                	div    %ebx
+ 768:	8d 76 01             	lea    0x1(%esi),%esi
+ 76b:	0f b6 92 64 0b 00 00 	movzbl 0xb64(%edx),%edx
+ 772:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 776:	89 ca                	mov    %ecx,%edx
+ 778:	89 c1                	mov    %eax,%ecx
+ 77a:	39 da                	cmp    %ebx,%edx
+ 77c:	73 e2                	jae    760 <printint+0x30>
+  if(neg)
+ 77e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 781:	85 c0                	test   %eax,%eax
+ 783:	74 07                	je     78c <printint+0x5c>
+    buf[i++] = '-';
+ 785:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 78a:	89 f7                	mov    %esi,%edi
+ 78c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 78f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 792:	01 df                	add    %ebx,%edi
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 798:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7a4:	6a 01                	push   $0x1
+ 7a6:	50                   	push   %eax
+ 7a7:	56                   	push   %esi
+ 7a8:	e8 9c fc ff ff       	call   449 <write>
+  while(--i >= 0)
+ 7ad:	89 f8                	mov    %edi,%eax
+ 7af:	83 c4 10             	add    $0x10,%esp
+ 7b2:	83 ef 01             	sub    $0x1,%edi
+ 7b5:	39 d8                	cmp    %ebx,%eax
+ 7b7:	75 df                	jne    798 <printint+0x68>
+}
+ 7b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7bc:	5b                   	pop    %ebx
+ 7bd:	5e                   	pop    %esi
+ 7be:	5f                   	pop    %edi
+ 7bf:	5d                   	pop    %ebp
+ 7c0:	c3                   	ret
+ 7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7c8:	31 c0                	xor    %eax,%eax
+ 7ca:	eb 89                	jmp    755 <printint+0x25>
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7df:	0f b6 1e             	movzbl (%esi),%ebx
+ 7e2:	83 c6 01             	add    $0x1,%esi
+ 7e5:	84 db                	test   %bl,%bl
+ 7e7:	74 67                	je     850 <printf+0x80>
+ 7e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7ec:	31 d2                	xor    %edx,%edx
+ 7ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7f1:	eb 34                	jmp    827 <printf+0x57>
+ 7f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7f7:	90                   	nop
+ 7f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 800:	83 f8 25             	cmp    $0x25,%eax
+ 803:	74 18                	je     81d <printf+0x4d>
+  write(fd, &c, 1);
+ 805:	83 ec 04             	sub    $0x4,%esp
+ 808:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 80b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 80e:	6a 01                	push   $0x1
+ 810:	50                   	push   %eax
+ 811:	57                   	push   %edi
+ 812:	e8 32 fc ff ff       	call   449 <write>
+ 817:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 81a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 81d:	0f b6 1e             	movzbl (%esi),%ebx
+ 820:	83 c6 01             	add    $0x1,%esi
+ 823:	84 db                	test   %bl,%bl
+ 825:	74 29                	je     850 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 827:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 82a:	85 d2                	test   %edx,%edx
+ 82c:	74 ca                	je     7f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 82e:	83 fa 25             	cmp    $0x25,%edx
+ 831:	75 ea                	jne    81d <printf+0x4d>
+      if(c == 'd'){
+ 833:	83 f8 25             	cmp    $0x25,%eax
+ 836:	0f 84 24 01 00 00    	je     960 <printf+0x190>
+ 83c:	83 e8 63             	sub    $0x63,%eax
+ 83f:	83 f8 15             	cmp    $0x15,%eax
+ 842:	77 1c                	ja     860 <printf+0x90>
+ 844:	ff 24 85 0c 0b 00 00 	jmp    *0xb0c(,%eax,4)
+ 84b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 853:	5b                   	pop    %ebx
+ 854:	5e                   	pop    %esi
+ 855:	5f                   	pop    %edi
+ 856:	5d                   	pop    %ebp
+ 857:	c3                   	ret
+ 858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85f:	90                   	nop
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 866:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 86a:	6a 01                	push   $0x1
+ 86c:	52                   	push   %edx
+ 86d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 870:	57                   	push   %edi
+ 871:	e8 d3 fb ff ff       	call   449 <write>
+ 876:	83 c4 0c             	add    $0xc,%esp
+ 879:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 87c:	6a 01                	push   $0x1
+ 87e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 881:	52                   	push   %edx
+ 882:	57                   	push   %edi
+ 883:	e8 c1 fb ff ff       	call   449 <write>
+        putc(fd, c);
+ 888:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88b:	31 d2                	xor    %edx,%edx
+ 88d:	eb 8e                	jmp    81d <printf+0x4d>
+ 88f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 890:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 89b:	8b 13                	mov    (%ebx),%edx
+ 89d:	6a 00                	push   $0x0
+ 89f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8a4:	e8 87 fe ff ff       	call   730 <printint>
+        ap++;
+ 8a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 67 ff ff ff       	jmp    81d <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8c5:	83 c0 04             	add    $0x4,%eax
+ 8c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8cb:	85 db                	test   %ebx,%ebx
+ 8cd:	0f 84 9d 00 00 00    	je     970 <printf+0x1a0>
+        while(*s != 0){
+ 8d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8d8:	84 c0                	test   %al,%al
+ 8da:	0f 84 3d ff ff ff    	je     81d <printf+0x4d>
+ 8e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8e6:	89 de                	mov    %ebx,%esi
+ 8e8:	89 d3                	mov    %edx,%ebx
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8f0:	83 ec 04             	sub    $0x4,%esp
+ 8f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8f9:	6a 01                	push   $0x1
+ 8fb:	53                   	push   %ebx
+ 8fc:	57                   	push   %edi
+ 8fd:	e8 47 fb ff ff       	call   449 <write>
+        while(*s != 0){
+ 902:	0f b6 06             	movzbl (%esi),%eax
+ 905:	83 c4 10             	add    $0x10,%esp
+ 908:	84 c0                	test   %al,%al
+ 90a:	75 e4                	jne    8f0 <printf+0x120>
+      state = 0;
+ 90c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 90f:	31 d2                	xor    %edx,%edx
+ 911:	e9 07 ff ff ff       	jmp    81d <printf+0x4d>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 920:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 923:	83 ec 0c             	sub    $0xc,%esp
+ 926:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 92b:	8b 13                	mov    (%ebx),%edx
+ 92d:	6a 01                	push   $0x1
+ 92f:	e9 6b ff ff ff       	jmp    89f <printf+0xcf>
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 938:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 941:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 943:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 946:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 949:	6a 01                	push   $0x1
+ 94b:	52                   	push   %edx
+ 94c:	57                   	push   %edi
+ 94d:	e8 f7 fa ff ff       	call   449 <write>
+        ap++;
+ 952:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 955:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 958:	31 d2                	xor    %edx,%edx
+ 95a:	e9 be fe ff ff       	jmp    81d <printf+0x4d>
+ 95f:	90                   	nop
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 966:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 969:	6a 01                	push   $0x1
+ 96b:	e9 11 ff ff ff       	jmp    881 <printf+0xb1>
+ 970:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 975:	bb 02 0b 00 00       	mov    $0xb02,%ebx
+ 97a:	e9 61 ff ff ff       	jmp    8e0 <printf+0x110>
+ 97f:	90                   	nop
+
+00000980 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 980:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 981:	a1 9c 0e 00 00       	mov    0xe9c,%eax
+{
+ 986:	89 e5                	mov    %esp,%ebp
+ 988:	57                   	push   %edi
+ 989:	56                   	push   %esi
+ 98a:	53                   	push   %ebx
+ 98b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 98e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 998:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 99a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 99c:	39 ca                	cmp    %ecx,%edx
+ 99e:	73 30                	jae    9d0 <free+0x50>
+ 9a0:	39 c1                	cmp    %eax,%ecx
+ 9a2:	72 04                	jb     9a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9a4:	39 c2                	cmp    %eax,%edx
+ 9a6:	72 f0                	jb     998 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9ae:	39 f8                	cmp    %edi,%eax
+ 9b0:	74 2e                	je     9e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9bb:	39 f1                	cmp    %esi,%ecx
+ 9bd:	74 38                	je     9f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9c1:	5b                   	pop    %ebx
+  freep = p;
+ 9c2:	89 15 9c 0e 00 00    	mov    %edx,0xe9c
+}
+ 9c8:	5e                   	pop    %esi
+ 9c9:	5f                   	pop    %edi
+ 9ca:	5d                   	pop    %ebp
+ 9cb:	c3                   	ret
+ 9cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9d0:	39 c1                	cmp    %eax,%ecx
+ 9d2:	72 d0                	jb     9a4 <free+0x24>
+ 9d4:	eb c2                	jmp    998 <free+0x18>
+ 9d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9e0:	03 70 04             	add    0x4(%eax),%esi
+ 9e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9e6:	8b 02                	mov    (%edx),%eax
+ 9e8:	8b 00                	mov    (%eax),%eax
+ 9ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 9f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9f3:	39 f1                	cmp    %esi,%ecx
+ 9f5:	75 c8                	jne    9bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 9f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9fa:	89 15 9c 0e 00 00    	mov    %edx,0xe9c
+    p->s.size += bp->s.size;
+ a00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a06:	89 0a                	mov    %ecx,(%edx)
+}
+ a08:	5b                   	pop    %ebx
+ a09:	5e                   	pop    %esi
+ a0a:	5f                   	pop    %edi
+ a0b:	5d                   	pop    %ebp
+ a0c:	c3                   	ret
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	57                   	push   %edi
+ a14:	56                   	push   %esi
+ a15:	53                   	push   %ebx
+ a16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a1c:	8b 15 9c 0e 00 00    	mov    0xe9c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a22:	8d 78 07             	lea    0x7(%eax),%edi
+ a25:	c1 ef 03             	shr    $0x3,%edi
+ a28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a2b:	85 d2                	test   %edx,%edx
+ a2d:	0f 84 8d 00 00 00    	je     ac0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a35:	8b 48 04             	mov    0x4(%eax),%ecx
+ a38:	39 f9                	cmp    %edi,%ecx
+ a3a:	73 64                	jae    aa0 <malloc+0x90>
+  if(nu < 4096)
+ a3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a41:	39 df                	cmp    %ebx,%edi
+ a43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a4d:	eb 0a                	jmp    a59 <malloc+0x49>
+ a4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a52:	8b 48 04             	mov    0x4(%eax),%ecx
+ a55:	39 f9                	cmp    %edi,%ecx
+ a57:	73 47                	jae    aa0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a59:	89 c2                	mov    %eax,%edx
+ a5b:	39 05 9c 0e 00 00    	cmp    %eax,0xe9c
+ a61:	75 ed                	jne    a50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	56                   	push   %esi
+ a67:	e8 15 fb ff ff       	call   581 <sbrk>
+  if(p == (char*)-1)
+ a6c:	83 c4 10             	add    $0x10,%esp
+ a6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a72:	74 1c                	je     a90 <malloc+0x80>
+  hp->s.size = nu;
+ a74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a77:	83 ec 0c             	sub    $0xc,%esp
+ a7a:	83 c0 08             	add    $0x8,%eax
+ a7d:	50                   	push   %eax
+ a7e:	e8 fd fe ff ff       	call   980 <free>
+  return freep;
+ a83:	8b 15 9c 0e 00 00    	mov    0xe9c,%edx
+      if((p = morecore(nunits)) == 0)
+ a89:	83 c4 10             	add    $0x10,%esp
+ a8c:	85 d2                	test   %edx,%edx
+ a8e:	75 c0                	jne    a50 <malloc+0x40>
+        return 0;
+  }
+}
+ a90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a93:	31 c0                	xor    %eax,%eax
+}
+ a95:	5b                   	pop    %ebx
+ a96:	5e                   	pop    %esi
+ a97:	5f                   	pop    %edi
+ a98:	5d                   	pop    %ebp
+ a99:	c3                   	ret
+ a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ aa0:	39 cf                	cmp    %ecx,%edi
+ aa2:	74 4c                	je     af0 <malloc+0xe0>
+        p->s.size -= nunits;
+ aa4:	29 f9                	sub    %edi,%ecx
+ aa6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ aa9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ aac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ aaf:	89 15 9c 0e 00 00    	mov    %edx,0xe9c
+}
+ ab5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ab8:	83 c0 08             	add    $0x8,%eax
+}
+ abb:	5b                   	pop    %ebx
+ abc:	5e                   	pop    %esi
+ abd:	5f                   	pop    %edi
+ abe:	5d                   	pop    %ebp
+ abf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ac0:	c7 05 9c 0e 00 00 a0 	movl   $0xea0,0xe9c
+ ac7:	0e 00 00 
+    base.s.size = 0;
+ aca:	b8 a0 0e 00 00       	mov    $0xea0,%eax
+    base.s.ptr = freep = prevp = &base;
+ acf:	c7 05 a0 0e 00 00 a0 	movl   $0xea0,0xea0
+ ad6:	0e 00 00 
+    base.s.size = 0;
+ ad9:	c7 05 a4 0e 00 00 00 	movl   $0x0,0xea4
+ ae0:	00 00 00 
+    if(p->s.size >= nunits){
+ ae3:	e9 54 ff ff ff       	jmp    a3c <malloc+0x2c>
+ ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ af0:	8b 08                	mov    (%eax),%ecx
+ af2:	89 0a                	mov    %ecx,(%edx)
+ af4:	eb b9                	jmp    aaf <malloc+0x9f>
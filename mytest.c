@@ -22,6 +22,6 @@ main(int argc, char *argv[])
   }
   
 
-  exit();
+  exit(0);
 
 }
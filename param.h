@@ -1,4 +1,6 @@
 #define NPROC        64  // maximum number of processes
+#define NPIDHASH     64  // buckets in the pid -> proc hash
+#define NSLEEPQ      64  // buckets in the wait channel -> sleepers hash
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
@@ -7,8 +9,15 @@
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define NSEG          4  // max loadable ELF segments per program
+#define NVMA         16  // mmap() regions per process
+#define NPCACHE     512  // pages in the executable page cache
+#define NSHPAGE     256  // file pages mapped MAP_SHARED, system-wide
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define FSSIZE       2000  // size of file system in blocks
+#define NTRACE       256  // trace records kept per CPU
+#define NSIGQUEUE     32  // signals queued by sigqueue() per process
+#define TICKMS        10  // clock tick period in milliseconds
 
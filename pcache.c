@@ -0,0 +1,172 @@
+// Executable page cache.
+//
+// pagefault() loads program pages from the executable (see exec).
+// Pages it reads are kept here, keyed by (dev, inum, file offset),
+// and mapped copy-on-write into every process that runs the same
+// file, so running a program many times costs memory once for the
+// pages nobody writes to. The cache holds one reference to each page
+// (see kalloc.c); a page only the cache references can be reused
+// for another entry, or freed by pcachereclaim() when kalloc()
+// runs out of memory.
+//
+// Writing or truncating a file drops its pages. Each bucket counts
+// the drops in gen, so a page read from a file that changed while
+// being read is not cached.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NPCBUCKET 31
+#define PCHASH(dev, inum) (((dev) * 31 + (inum)) % NPCBUCKET)
+
+struct pcpage {
+  uint dev;
+  uint inum;
+  uint off;                  // File offset of the page
+  uint n;                    // Bytes read from the file; the rest is zero
+  char *page;                // 0 if the entry is free
+  struct pcpage *next;       // Next entry in the same bucket
+};
+
+struct {
+  struct spinlock lock;
+  struct pcpage ent[NPCACHE];
+  struct pcpage *bucket[NPCBUCKET];  // Hashed by (dev, inum)
+  uint gen[NPCBUCKET];
+  int hand;                  // Where the search for a free entry resumes
+} pcache;
+
+void
+pcacheinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Take e off its bucket and drop the cache's reference to its page.
+// pcache.lock must be held.
+static void
+evict(struct pcpage *e)
+{
+  struct pcpage **pp;
+
+  for(pp = &pcache.bucket[PCHASH(e->dev, e->inum)]; *pp != e; pp = &(*pp)->next)
+    ;
+  *pp = e->next;
+  kfree(e->page);
+  e->page = 0;
+}
+
+// Return the cached page holding n bytes of ip at off, with a
+// reference added for the caller, or 0. Either way sets *gen for
+// a later pcacheput().
+char*
+pcacheget(struct inode *ip, uint off, uint n, uint *gen)
+{
+  struct pcpage *e;
+  int h;
+
+  h = PCHASH(ip->dev, ip->inum);
+  acquire(&pcache.lock);
+  *gen = pcache.gen[h];
+  for(e = pcache.bucket[h]; e; e = e->next){
+    if(e->dev == ip->dev && e->inum == ip->inum && e->off == off && e->n == n){
+      kref(e->page);
+      release(&pcache.lock);
+      return e->page;
+    }
+  }
+  release(&pcache.lock);
+  return 0;
+}
+
+// Cache page, just read from n bytes of ip at off, unless ip has
+// changed since pcacheget() set gen or there is no room. Returns 1
+// if the cache took a reference to page.
+int
+pcacheput(struct inode *ip, uint off, uint n, char *page, uint gen)
+{
+  struct pcpage *e;
+  int h, i;
+
+  h = PCHASH(ip->dev, ip->inum);
+  acquire(&pcache.lock);
+  if(pcache.gen[h] != gen){
+    release(&pcache.lock);
+    return 0;
+  }
+  for(e = pcache.bucket[h]; e; e = e->next){
+    if(e->dev == ip->dev && e->inum == ip->inum && e->off == off){
+      // Another process read the same page first.
+      release(&pcache.lock);
+      return 0;
+    }
+  }
+  // Use a free entry, or reuse one whose page no process maps.
+  for(i = 0; i < NPCACHE; i++){
+    e = &pcache.ent[pcache.hand];
+    pcache.hand = (pcache.hand + 1) % NPCACHE;
+    if(e->page == 0)
+      break;
+    if(krefcount(e->page) == 1){
+      evict(e);
+      break;
+    }
+  }
+  if(i == NPCACHE){
+    release(&pcache.lock);
+    return 0;
+  }
+  e->dev = ip->dev;
+  e->inum = ip->inum;
+  e->off = off;
+  e->n = n;
+  e->page = page;
+  kref(page);
+  e->next = pcache.bucket[h];
+  pcache.bucket[h] = e;
+  release(&pcache.lock);
+  return 1;
+}
+
+// Free the pages only the cache references, for kalloc() to
+// reuse when it runs out. Returns the number of pages freed.
+int
+pcachereclaim(void)
+{
+  struct pcpage *e;
+  int n;
+
+  n = 0;
+  acquire(&pcache.lock);
+  for(e = pcache.ent; e < &pcache.ent[NPCACHE]; e++){
+    if(e->page && krefcount(e->page) == 1){
+      evict(e);
+      n++;
+    }
+  }
+  release(&pcache.lock);
+  return n;
+}
+
+// Drop every cached page of ip, whose contents are changing.
+void
+pcacheinval(struct inode *ip)
+{
+  struct pcpage *e, *next;
+  int h;
+
+  h = PCHASH(ip->dev, ip->inum);
+  acquire(&pcache.lock);
+  pcache.gen[h]++;
+  for(e = pcache.bucket[h]; e; e = next){
+    next = e->next;
+    if(e->dev == ip->dev && e->inum == ip->inum)
+      evict(e);
+  }
+  release(&pcache.lock);
+}
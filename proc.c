@@ -6,6 +6,8 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "trace.h"
+#include "vdso.h"
 
 struct
 {
@@ -13,6 +15,35 @@ struct
   struct proc proc[NPROC];
 } ptable;
 
+// pid -> proc index. Has its own lock so that kill() can find
+// its target without ptable.lock. A proc is inserted once its pid
+// is assigned and removed (under ptable.lock as well) before its
+// slot is freed. Lock order: ptable.lock, then pidhash.lock.
+struct
+{
+  struct spinlock lock;
+  struct proc *bucket[NPIDHASH];
+} pidhash;
+
+#define PIDHASH(pid) ((uint)(pid) % NPIDHASH)
+
+// Protects every process's sigq/nsigq. Ordered after pidhash.lock.
+static struct spinlock sigqlock;
+
+// Sleeping processes, hashed by wait channel so that wakeup()
+// only looks at processes that may be sleeping on its channel.
+// Protected by ptable.lock.
+static struct proc *sleepq[NSLEEPQ];
+
+#define CHANHASH(chan) ((((uint)(chan) >> 3) ^ ((uint)(chan) >> 11)) % NSLEEPQ)
+
+// One lock per CPU run queue (cpu->runq, runqtail, nrunq), so that
+// picking, stealing and queueing processes need not take ptable.lock.
+// Lock order: ptable.lock, then a run-queue lock. A CPU never holds
+// two run-queue locks: stealing takes only the victim's, and the
+// stolen process runs on the thief without being queued there.
+static struct spinlock runqlock[NCPU];
+
 static struct proc *initproc;
 
 int nextpid = 1;
@@ -20,10 +51,61 @@ extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static void wakeproc(struct proc *p);
+static void setrunnable(struct proc *p);
+static int sigtake(struct proc *p, int signum);
+static void sigpost(struct proc *p, int signum);
+static void itreal_expire(struct timer *t);
+static void sleeptimer_expire(struct timer *t);
 
 void pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+  initlock(&pidhash.lock, "pidhash");
+  initlock(&sigqlock, "sigq");
+  for (int i = 0; i < NCPU; i++)
+    initlock(&runqlock[i], "runq");
+}
+
+static void
+pidhash_insert(struct proc *p)
+{
+  struct proc **b = &pidhash.bucket[PIDHASH(p->pid)];
+
+  acquire(&pidhash.lock);
+  p->pidnext = *b;
+  *b = p;
+  release(&pidhash.lock);
+}
+
+static void
+pidhash_remove(struct proc *p)
+{
+  struct proc **pp;
+
+  acquire(&pidhash.lock);
+  for (pp = &pidhash.bucket[PIDHASH(p->pid)]; *pp; pp = &(*pp)->pidnext)
+  {
+    if (*pp == p)
+    {
+      *pp = p->pidnext;
+      break;
+    }
+  }
+  p->pidnext = 0;
+  release(&pidhash.lock);
+}
+
+// Find the process with the given pid. Caller must hold pidhash.lock.
+static struct proc *
+pidhash_lookup(int pid)
+{
+  struct proc *p;
+
+  for (p = pidhash.bucket[PIDHASH(pid)]; p; p = p->pidnext)
+    if (p->pid == pid)
+      return p;
+  return 0;
 }
 
 // Must be called with interrupts disabled
@@ -67,6 +149,50 @@ myproc(void)
   return p;
 }
 
+// Children lists. Each process keeps its live children and its
+// unreaped zombies on two doubly-linked lists so that exit() and
+// wait() touch only the caller's own children. ptable.lock must be held.
+static void
+sib_push(struct proc **list, struct proc *p)
+{
+  p->sibprev = 0;
+  p->sibnext = *list;
+  if (*list)
+    (*list)->sibprev = p;
+  *list = p;
+}
+
+static void
+sib_unlink(struct proc **list, struct proc *p)
+{
+  if (p->sibprev)
+    p->sibprev->sibnext = p->sibnext;
+  else
+    *list = p->sibnext;
+  if (p->sibnext)
+    p->sibnext->sibprev = p->sibprev;
+  p->sibnext = p->sibprev = 0;
+}
+
+// Hand every process on list to parent, prepending them to *dst.
+static void
+sib_adopt(struct proc **dst, struct proc *list, struct proc *parent)
+{
+  struct proc *p, *tail;
+
+  if (list == 0)
+    return;
+  for (p = list; p; p = p->sibnext)
+  {
+    p->parent = parent;
+    tail = p;
+  }
+  tail->sibnext = *dst;
+  if (*dst)
+    (*dst)->sibprev = tail;
+  *dst = list;
+}
+
 int allocpid(void)
 {
   int pid;
@@ -98,16 +224,48 @@ allocproc(void)
 
 found:
   p->state = EMBRYO;
+  // Clear before the new pid is published so a racing kill() that
+  // already matches it cannot be wiped out.
+  p->pending_signals = 0;
+  p->nsigq = 0;
+  p->insuspend = 0;
+  p->children = p->zombies = 0;
+  p->sibnext = p->sibprev = 0;
+  p->exe = 0;
+  p->nseg = 0;
+  memset(p->vma, 0, sizeof(p->vma));
+  p->cpu = -1;
+  p->itreal.cpu = -1;
+  p->itreal.interval = 0;
+  p->itreal.fn = itreal_expire;
+  p->itreal.arg = p;
+  p->itvirt = p->itvirt_interval = 0;
+  p->sleeptimer.cpu = -1;
+  p->sleeptimer.interval = 0;
+  p->sleeptimer.fn = sleeptimer_expire;
+  p->sleeptimer.arg = p;
   release(&ptable.lock);
 
   p->pid = allocpid();
+  pidhash_insert(p);
 
-  // Allocate kernel stack.
+  // Allocate kernel stack and the page user code reads its pid from.
   if ((p->kstack = kalloc()) == 0)
   {
+    pidhash_remove(p);
     p->state = UNUSED;
     return 0;
   }
+  if ((p->vproc = kalloc()) == 0)
+  {
+    kfree(p->kstack);
+    p->kstack = 0;
+    pidhash_remove(p);
+    p->state = UNUSED;
+    return 0;
+  }
+  memset(p->vproc, 0, PGSIZE);
+  ((struct vproc *)p->vproc)->pid = p->pid;
   sp = p->kstack + KSTACKSIZE;
 
   // Leave room for trap frame.
@@ -130,8 +288,6 @@ found:
   {
     p->signal_handlers[i] = (void *)SIG_DFL;
   }
-
-  p->pending_signals = 0;
   /**********************************************/
 
   return p;
@@ -147,7 +303,7 @@ void userinit(void)
   p = allocproc();
 
   initproc = p;
-  if ((p->pgdir = setupkvm()) == 0)
+  if ((p->pgdir = setupkvm()) == 0 || mapvproc(p->pgdir, p->vproc) < 0)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   p->sz = PGSIZE;
@@ -169,7 +325,7 @@ void userinit(void)
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
 
-  p->state = RUNNABLE;
+  setrunnable(p);
 
   release(&ptable.lock);
 }
@@ -184,8 +340,11 @@ int growproc(int n)
   sz = curproc->sz;
   if (n > 0)
   {
-    if ((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Only reserve the addresses; pagefault() allocates each page
+    // on first touch.
+    if (sz + n > vmabase(curproc) || sz + n < sz)
       return -1;
+    sz += n;
   }
   else if (n < 0)
   {
@@ -222,10 +381,17 @@ int fork(void)
   /**********************************************/
 
   // Copy process state from proc.
-  if ((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0)
+  if ((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0 ||
+      mapvproc(np->pgdir, np->vproc) < 0 ||
+      vmacopy(np, curproc) < 0)
   {
+    if (np->pgdir)
+      freevm(np->pgdir);
+    pidhash_remove(np);
     kfree(np->kstack);
     np->kstack = 0;
+    kfree(np->vproc);
+    np->vproc = 0;
     np->state = UNUSED;
     return -1;
   }
@@ -240,6 +406,10 @@ int fork(void)
     if (curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  if (curproc->exe)
+    np->exe = iexec(curproc->exe);
+  memmove(np->seg, curproc->seg, sizeof(curproc->seg));
+  np->nseg = curproc->nseg;
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -247,25 +417,33 @@ int fork(void)
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
+  sib_push(&curproc->children, np);
+  setrunnable(np);
 
   release(&ptable.lock);
 
   return pid;
 }
 
-// Exit the current process.  Does not return.
+// Exit the current process with the given status.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
-void exit(void)
+void exit(int status)
 {
   struct proc *curproc = myproc();
-  struct proc *p;
+  struct proc *parent;
   int fd;
 
   if (curproc == initproc)
     panic("init exiting");
 
+  // After this the wheels no longer refer to curproc.
+  timercancel(&curproc->itreal);
+  timercancel(&curproc->sleeptimer);
+
+  // Write back and drop mmap() regions.
+  vmaclear(curproc, curproc->pgdir);
+
   // Close all open files.
   for (fd = 0; fd < NOFILE; fd++)
   {
@@ -278,24 +456,38 @@ void exit(void)
 
   begin_op();
   iput(curproc->cwd);
+  if (curproc->exe)
+    iputexec(curproc->exe);
   end_op();
   curproc->cwd = 0;
+  curproc->exe = 0;
 
   acquire(&ptable.lock);
 
+  curproc->xstatus = status;
+  parent = curproc->parent;
+
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  wakeup1(parent);
+
+  // Post SIGCHLD. ptable.lock keeps parent in place, which sigsend()
+  // cannot be relied on for here, so post and wake directly.
+  trace(TR_SIGPOST, parent->pid, SIGCHLD);
+  sigpost(parent, SIGCHLD);
+  if (parent->state == SLEEPING && parent->chan == &parent->sigwaiting &&
+      (parent->sigwaiting & (1 << SIGCHLD)))
+    wakeproc(parent);
 
   // Pass abandoned children to init.
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-  {
-    if (p->parent == curproc)
-    {
-      p->parent = initproc;
-      if (p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
-  }
+  sib_adopt(&initproc->children, curproc->children, initproc);
+  if (curproc->zombies)
+    wakeup1(initproc);
+  sib_adopt(&initproc->zombies, curproc->zombies, initproc);
+  curproc->children = curproc->zombies = 0;
+
+  // Move to the parent's list of children to reap.
+  sib_unlink(&parent->children, curproc);
+  sib_push(&parent->zombies, curproc);
 
   // Jump into the scheduler, never to return.
   curproc->state = ZOMBIE;
@@ -306,44 +498,69 @@ void exit(void)
 // Wait for a child process to exit and return its pid.
 // Return -1 if this process has no children.
 int wait(void)
+{
+  return waitpid(-1, 0, 0);
+}
+
+// Wait for the child with the given pid, or for any child if pid is
+// -1, to exit. Stores its exit status in *status if status is non-zero
+// and returns its pid. With WNOHANG, returns 0 instead of sleeping when
+// the child is still running. Returns -1 if there is no such child.
+int waitpid(int pid, int *status, int options)
 {
   struct proc *p;
-  int havekids, pid;
   struct proc *curproc = myproc();
+  int xstatus;
 
   acquire(&ptable.lock);
   for (;;)
   {
-    // Scan through table looking for exited children.
-    havekids = 0;
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    // Exited children are kept on their own list.
+    for (p = curproc->zombies; p; p = p->sibnext)
+      if (pid == -1 || p->pid == pid)
+        break;
+    if (p != 0)
     {
-      if (p->parent != curproc)
-        continue;
-      havekids = 1;
-      if (p->state == ZOMBIE)
-      {
-        // Found one.
-        pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
-        release(&ptable.lock);
-        return pid;
-      }
+      // Found one.
+      sib_unlink(&curproc->zombies, p);
+      pid = p->pid;
+      xstatus = p->xstatus;
+      pidhash_remove(p);
+      kfree(p->kstack);
+      p->kstack = 0;
+      kfree(p->vproc);
+      p->vproc = 0;
+      freevm(p->pgdir);
+      p->pid = 0;
+      p->parent = 0;
+      p->name[0] = 0;
+      p->killed = 0;
+      p->state = UNUSED;
+      release(&ptable.lock);
+      // The store may fault (a copy-on-write or untouched page),
+      // which must not happen with ptable.lock held.
+      if (status && copyout(curproc->pgdir, (uint)status, &xstatus, sizeof(xstatus)) < 0)
+        return -1;
+      return pid;
     }
 
-    // No point waiting if we don't have any children.
-    if (!havekids || curproc->killed)
+    // No point waiting if we don't have such a child.
+    if (pid == -1)
+      p = curproc->children;
+    else
+      for (p = curproc->children; p; p = p->sibnext)
+        if (p->pid == pid)
+          break;
+    if (p == 0 || curproc->killed)
     {
       release(&ptable.lock);
       return -1;
     }
+    if (options & WNOHANG)
+    {
+      release(&ptable.lock);
+      return 0;
+    }
 
     // Wait for children to exit.  (See wakeup1 call in proc_exit.)
     sleep(curproc, &ptable.lock); //DOC: wait-sleep
@@ -351,10 +568,85 @@ int wait(void)
 }
 
 //PAGEBREAK: 42
+// Run queues. Every RUNNABLE process sits on exactly one CPU's
+// run queue, normally the one it last ran on. Each queue has its
+// own lock (runqlock), so CPUs pick and steal work without
+// touching ptable.lock; keeping them per CPU gives affinity and
+// makes picking the next process O(1) instead of a table scan.
+// ptable.lock still covers the state changes themselves.
+
+// Mark p RUNNABLE and append it to its CPU's run queue.
+// The ptable lock must be held.
+static void
+setrunnable(struct proc *p)
+{
+  struct cpu *c;
+  struct spinlock *lk;
+
+  if (p->cpu < 0)
+    p->cpu = cpuid();
+  c = &cpus[p->cpu];
+  lk = &runqlock[p->cpu];
+  p->state = RUNNABLE;
+  p->rqnext = 0;
+  acquire(lk);
+  if (c->runqtail)
+    c->runqtail->rqnext = p;
+  else
+    c->runq = p;
+  c->runqtail = p;
+  c->nrunq++;
+  release(lk);
+}
+
+// Remove and return the first process on c's run queue, or 0.
+static struct proc *
+runq_pop(struct cpu *c)
+{
+  struct spinlock *lk = &runqlock[c - cpus];
+  struct proc *p;
+
+  // Unlocked peek so that an idle CPU does not bounce the lock.
+  if (c->nrunq == 0)
+    return 0;
+  acquire(lk);
+  if ((p = c->runq) != 0)
+  {
+    c->runq = p->rqnext;
+    if (c->runq == 0)
+      c->runqtail = 0;
+    c->nrunq--;
+    p->rqnext = 0;
+  }
+  release(lk);
+  return p;
+}
+
+// Take a process from the CPU with the longest run queue and
+// move it to c. Queue lengths are read without locks; only the
+// victim's queue is locked, by runq_pop(). Returns 0 if every run
+// queue is empty.
+static struct proc *
+runq_steal(struct cpu *c)
+{
+  struct cpu *v, *busiest;
+  struct proc *p;
+
+  busiest = 0;
+  for (v = cpus; v < cpus + ncpu; v++)
+    if (v != c && v->nrunq > 0 && (busiest == 0 || v->nrunq > busiest->nrunq))
+      busiest = v;
+  if (busiest == 0 || (p = runq_pop(busiest)) == 0)
+    return 0;
+  p->cpu = c - cpus;
+  return p;
+}
+
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
-//  - choose a process to run
+//  - take a process from this CPU's run queue, or steal
+//      one from the busiest other CPU
 //  - swtch to start running that process
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
@@ -369,53 +661,23 @@ void scheduler(void)
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
+    if ((p = runq_pop(c)) == 0 && (p = runq_steal(c)) == 0)
+      continue;
+
+    // p is off every queue, so no other CPU can pick it. It may
+    // still be on its way out of sched() on the CPU that queued
+    // it, which holds ptable.lock until it is off p's stack.
     acquire(&ptable.lock);
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    {
-      if (p->state != RUNNABLE)
-        continue;
 
-      // F.A.Q.8 -  In order to make SIGCONT and SIGSTOP work correctly, one must modify also the scheduler code.
-      if (p->freeze)
-      {
-        int sig_cont_bits = 1;
-        sig_cont_bits = sig_cont_bits << SIGCONT;
-        int is_sig_cont_pending = p->pending_signals & sig_cont_bits;
-        if (is_sig_cont_pending && p->signal_handlers[SIGCONT] == (void *)SIG_DFL) //nobody changed the SIGCONT handler
-        {
-          SIGCONT_handler();
-          p->pending_signals ^= (1 << SIGCONT); // Remove the signal from the pending_signals
-        }
-        else
-        {
-          for (int i = 0; i < 32; i++)
-          {
-            if (i == SIGKILL || i == SIGSTOP)
-            {
-              continue;
-            }
-            int is_sig_i_pending = p->pending_signals & (1 << i);
-            if (is_sig_i_pending && p->signal_handlers[i] == SIGCONT_handler)
-            {
-              SIGCONT_handler();
-              p->pending_signals ^= (1 << SIGCONT); // Remove the signal from the pending_signals
-              break;
-            }
-          }
-        }
-      }
-    
-    if (p->freeze)
-    {
-      continue;
-    }
+    // F.A.Q.8 -  Stopped processes are never on a run queue: SIGSTOP
+    // takes them off in SIGSTOP_handler() and kill() puts them back.
     // Switch to chosen process.  It is the process's job
     // to release ptable.lock and then reacquire it
     // before jumping back to us.
     c->proc = p;
     switchuvm(p);
     p->state = RUNNING;
+    trace(TR_SCHED, p->pid, 0);
 
     swtch(&(c->scheduler), p->context);
     switchkvm();
@@ -423,12 +685,10 @@ void scheduler(void)
     // Process is done running for now.
     // It should have changed its p->state before coming back.
     c->proc = 0;
+    release(&ptable.lock);
   }
-  release(&ptable.lock);
-}
 }
 
-
 // Enter scheduler.  Must hold only ptable.lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
@@ -458,7 +718,7 @@ void sched(void)
 void yield(void)
 {
   acquire(&ptable.lock); //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  setrunnable(myproc());
   sched();
   release(&ptable.lock);
 }
@@ -510,6 +770,11 @@ void sleep(void *chan, struct spinlock *lk)
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
+  p->chprev = 0;
+  p->chnext = sleepq[CHANHASH(chan)];
+  if (p->chnext)
+    p->chnext->chprev = p;
+  sleepq[CHANHASH(chan)] = p;
 
   sched();
 
@@ -524,17 +789,113 @@ void sleep(void *chan, struct spinlock *lk)
   }
 }
 
+// The timer of a sleepticks() caller went off; the wheel has already
+// marked it disarmed. Runs from the timer interrupt.
+static void
+sleeptimer_expire(struct timer *t)
+{
+  wakeup(t);
+}
+
+// Sleep until p->sleeptimer, already armed, goes off. Returns 0, or
+// -1 if the process was killed first.
+static int
+sleeptimer_wait(struct proc *p)
+{
+  struct timer *t = &p->sleeptimer;
+  int r;
+
+  r = 0;
+  acquire(&ptable.lock);
+  // The wheel sets t->cpu to -1 before sleeptimer_expire() takes
+  // ptable.lock, so the wakeup cannot be missed.
+  while (t->cpu >= 0)
+  {
+    // kill() wakes us for SIGKILL before the runner sets killed.
+    if (p->killed || (p->pending_signals & (1 << SIGKILL)))
+    {
+      r = -1;
+      break;
+    }
+    sleep(t, &ptable.lock);
+  }
+  release(&ptable.lock);
+  timercancel(t);
+  return r;
+}
+
+// Sleep for n clock ticks. Only this process is woken, once, when its
+// timer expires, rather than every sleeper on every tick. Returns 0,
+// or -1 if the process was killed first.
+int sleepticks(int n)
+{
+  if (n <= 0)
+    return 0;
+  timerset(&myproc()->sleeptimer, n);
+  return sleeptimer_wait(myproc());
+}
+
+// Longest wheel sleep nanosleep() asks for at once, well inside what
+// the wheel can hold (see timer.c).
+#define MAXSLEEPTICKS (1 << 24)
+
+// Sleep for the interval in *ts with TSC precision. Whole ticks are
+// slept on the timer wheel; the rest on an hrtimerset() deadline,
+// which brings this CPU's one-shot LAPIC timer forward. Returns 0, or
+// -1 if the process was killed first.
+int nanosleep(struct timespec *ts)
+{
+  struct proc *p = myproc();
+  uint64 deadline, n;
+  uint m;
+
+  deadline = rdtsc() + ts2tsc(ts);
+  n = (uint64)ts->tv_sec * (1000 / TICKMS) + ts->tv_nsec / (TICKMS * 1000000);
+  // A wheel timer fires on a tick boundary, so sleep one tick short
+  // there and finish on the deadline. Long intervals are slept in
+  // pieces, so the deadline is left with at most a tick or so.
+  while (n > 1)
+  {
+    m = n - 1 > MAXSLEEPTICKS ? MAXSLEEPTICKS : n - 1;
+    if (sleepticks(m) < 0)
+      return -1;
+    n -= m;
+  }
+  if (rdtsc() >= deadline)
+    return 0;
+  hrtimerset(&p->sleeptimer, deadline);
+  return sleeptimer_wait(p);
+}
+
 //PAGEBREAK!
+// Take a SLEEPING process off its sleep queue and make it runnable.
+// The ptable lock must be held.
+static void
+wakeproc(struct proc *p)
+{
+  if (p->chprev)
+    p->chprev->chnext = p->chnext;
+  else
+    sleepq[CHANHASH(p->chan)] = p->chnext;
+  if (p->chnext)
+    p->chnext->chprev = p->chprev;
+  p->chnext = p->chprev = 0;
+  setrunnable(p);
+}
+
 // Wake up all processes sleeping on chan.
 // The ptable lock must be held.
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
+  struct proc *p, *next;
 
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if (p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  for (p = sleepq[CHANHASH(chan)]; p; p = next)
+  {
+    next = p->chnext;
+    if (p->chan == chan)
+      wakeproc(p);
+  }
 }
 
 // Wake up all processes sleeping on chan.
@@ -545,38 +906,318 @@ void wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Atomically mark signum pending in p.
+static void
+sigpost(struct proc *p, int signum)
+{
+  atomic_or(&p->pending_signals, 1 << signum);
+}
+
+// Atomically clear signum from p's pending set.
+// Returns 1 if it was pending, 0 if another consumer got it first.
+static int
+sigtake(struct proc *p, int signum)
+{
+  uint old;
+
+  do
+  {
+    old = p->pending_signals;
+    if (!(old & (1 << signum)))
+      return 0;
+  } while (cmpxchg(&p->pending_signals, old, old & ~(1 << signum)) != old);
+  return 1;
+}
+
+// Remove the oldest queued record for signum from p into *info.
+// If none is queued (a plain kill()), fill in a bare record. If more
+// records for signum remain, signum is marked pending again so that
+// none are lost.
+static void
+sigdequeue(struct proc *p, int signum, struct siginfo *info)
+{
+  int i, more;
+
+  info->si_signo = signum;
+  info->si_pid = 0;
+  info->si_value = 0;
+  more = 0;
+  acquire(&sigqlock);
+  for (i = 0; i < p->nsigq; i++)
+    if (p->sigq[i].si_signo == signum)
+      break;
+  if (i < p->nsigq)
+  {
+    *info = p->sigq[i];
+    p->nsigq--;
+    memmove(&p->sigq[i], &p->sigq[i + 1], (p->nsigq - i) * sizeof(p->sigq[0]));
+    for (; i < p->nsigq; i++)
+      if (p->sigq[i].si_signo == signum)
+        more = 1;
+  }
+  if (more)
+    sigpost(p, signum);
+  release(&sigqlock);
+}
+
+// Withdraw a pending signum from p along with any records queued for
+// it, so a later instance neither finds the queue full nor delivers
+// a stale si_value.
+static void
+sigcancel(struct proc *p, int signum)
+{
+  int i, j;
+
+  acquire(&sigqlock);
+  sigtake(p, signum);
+  for (i = j = 0; i < p->nsigq; i++)
+    if (p->sigq[i].si_signo != signum)
+      p->sigq[j++] = p->sigq[i];
+  p->nsigq = j;
+  release(&sigqlock);
+}
+
+// Post signum to the process with the given pid. If info is non-zero
+// the record is also queued, so repeated signals are not merged.
+// Posting the signal does not take ptable.lock; the lock is only
+// needed to wake a sleeping or stopped target.
+static int
+sigsend(int pid, int signum, struct siginfo *info)
+{
+  struct proc *p;
+  int wake;
+
+  if (signum < 0 || signum > 31)
+  {
+    return -1;
+  }
+
+  acquire(&pidhash.lock);
+  if ((p = pidhash_lookup(pid)) == 0)
+  {
+    release(&pidhash.lock);
+    return -1;
+  }
+  if (info)
+  {
+    acquire(&sigqlock);
+    if (p->nsigq == NSIGQUEUE)
+    {
+      // Refuse rather than drop: the sender can retry.
+      release(&sigqlock);
+      release(&pidhash.lock);
+      return -1;
+    }
+    p->sigq[p->nsigq++] = *info;
+    release(&sigqlock);
+  }
+  /***************** TASK-2.2.1 *****************/
+  trace(TR_SIGPOST, pid, signum);
+  // A stop and a continue cancel each other's pending instance.
+  if (signum == SIGSTOP)
+    sigcancel(p, SIGCONT);
+  else if (sig_continues(p, signum))
+    sigcancel(p, SIGSTOP);
+  sigpost(p, signum);
+  /**********************************************/
+  // F.A.Q.2 - Should I wake a SLEEPING process on receiving a signal? Only on SIGKILL.
+  // A STOPPED process is resumed by SIGKILL or a continuing signal. The
+  // target may be about to stop (see SIGSTOP_handler), so settle that
+  // under ptable.lock rather than trusting the state read here.
+  // A process blocked in sigread() waits on &p->sigwaiting.
+  wake = signum == SIGKILL || sig_continues(p, signum) ||
+         (p->sigwaiting & (1 << signum));
+  release(&pidhash.lock);
+
+  // Wake process from sleep if necessary.
+  // Look it up again under ptable.lock: it may have been reaped since.
+  if (wake)
+  {
+    acquire(&ptable.lock);
+    acquire(&pidhash.lock);
+    p = pidhash_lookup(pid);
+    release(&pidhash.lock);
+    if (p && p->state == SLEEPING &&
+        (signum == SIGKILL || p->chan == &p->sigwaiting))
+      wakeproc(p);
+    else if (p && p->state == STOPPED)
+      setrunnable(p);
+    release(&ptable.lock);
+  }
+  return 0;
+}
+
 // Send signal to the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
 int kill(int pid, int signum)
 {
-  if (signum < 0 || signum > 31)
+  return sigsend(pid, signum, 0);
+}
+
+// Queue signum for the process with the given pid, carrying value.
+// Fails if the target already has NSIGQUEUE records queued.
+int sigqueue(int pid, int signum, int value)
+{
+  struct siginfo info;
+
+  // SIGKILL and SIGSTOP are acted on by the kernel and never reach a
+  // handler, so there is nobody to receive the value.
+  if (signum == SIGKILL || signum == SIGSTOP)
+    return kill(pid, signum);
+  info.si_signo = signum;
+  info.si_pid = myproc()->pid;
+  info.si_value = value;
+  return sigsend(pid, signum, &info);
+}
+
+// Sleep on p->sigwaiting until a signal in set is pending. Returns 0
+// then, or -1 if the process is killed or SIGKILL/SIGSTOP is pending.
+// Caller holds ptable.lock.
+static int
+sigblock(struct proc *p, uint set)
+{
+  while ((p->pending_signals & set) == 0)
+  {
+    if (p->killed || (p->pending_signals & SIG_UNBLOCKABLE))
+      return -1;
+    // Publish what we wait for before the final check; xchg orders the
+    // two, and kill() posts before it reads sigwaiting.
+    xchg(&p->sigwaiting, set);
+    if ((p->pending_signals & set) == 0)
+      sleep(&p->sigwaiting, &ptable.lock);
+    p->sigwaiting = 0;
+  }
+  return 0;
+}
+
+// Take up to n of the calling process's pending signals in set, oldest
+// record first, into info[] without running their handlers. Blocks
+// until at least one is pending. Returns the number of records, or -1
+// if the process is killed or stopped while waiting.
+int sigread(uint set, struct siginfo *info, int n)
+{
+  struct proc *p = myproc();
+  struct siginfo si;
+  uint ready;
+  int i, got;
+
+  set &= ~SIG_UNBLOCKABLE;
+  acquire(&ptable.lock);
+  if (sigblock(p, set) < 0)
   {
+    release(&ptable.lock);
     return -1;
   }
+  release(&ptable.lock);
 
-  struct proc *p;
+  got = 0;
+  while (got < n && (ready = p->pending_signals & set) != 0)
+  {
+    i = bsf(ready);
+    if (!sigtake(p, i))
+      continue;
+    sigdequeue(p, i, &si);
+    trace(TR_SIGDELIVER, p->pid, i);
+    info[got++] = si;
+  }
+  return got;
+}
+
+// Wait for one signal in set and consume it without running its
+// handler. Returns the signal number, or -1 as for sigread().
+int sigwait(uint set)
+{
+  struct siginfo si;
+
+  if (sigread(set, &si, 1) != 1)
+    return -1;
+  return si.si_signo;
+}
+
+// Replace the signal mask with mask and sleep until a signal it does
+// not block is pending. The handlers then run with mask in force and
+// sig_handler_runner puts the old mask back in the outermost frame, so
+// it returns when the last handler does. Always returns -1.
+int sigsuspend(uint mask)
+{
+  struct proc *p = myproc();
 
   acquire(&ptable.lock);
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  p->old_signal_mask = p->signal_mask;
+  p->signal_mask = mask;
+  p->insuspend = 1;
+  if (sigblock(p, ~mask) < 0 && (p->pending_signals & ~mask) == 0)
   {
-    if (p->pid == pid)
-    {
-      /***************** TASK-2.2.1 *****************/
-      cprintf("Signsl recieved:%d\n", signum);
-      p->pending_signals = p->pending_signals | (1 << signum);
-      /**********************************************/
-      // Wake process from sleep if necessary.
-      if (p->state == SLEEPING && signum == SIGKILL) // F.A.Q.2 - Should I wake a SLEEPING process on receiving a signal? Only on SIGKILL.
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+    // Nothing for the runner to deliver under mask.
+    p->signal_mask = p->old_signal_mask;
+    p->insuspend = 0;
   }
   release(&ptable.lock);
   return -1;
 }
 
+// ITIMER_REAL expired: post SIGALRM. Runs from the timer interrupt.
+static void
+itreal_expire(struct timer *t)
+{
+  kill(((struct proc *)t->arg)->pid, SIGALRM);
+}
+
+// Charge one tick of user time to the current process's
+// ITIMER_VIRTUAL. Called from the timer interrupt when it hit
+// user mode.
+void itimertick(void)
+{
+  struct proc *p = myproc();
+
+  if (p == 0 || p->itvirt == 0)
+    return;
+  if (--p->itvirt == 0)
+  {
+    p->itvirt = p->itvirt_interval;
+    kill(p->pid, SIGVTALRM);
+  }
+}
+
+// Arm or, if value->it_value is 0, disarm the calling process's timer
+// which. Stores the previous setting in *ovalue if ovalue is non-zero.
+// Either pointer may be 0. Returns 0, or -1 for an unknown timer.
+int setitimer(int which, struct itimerval *value, struct itimerval *ovalue)
+{
+  struct proc *p = myproc();
+  struct itimerval old;
+
+  if (which == ITIMER_REAL)
+  {
+    old.it_interval = p->itreal.interval;
+    old.it_value = timercancel(&p->itreal);
+    if (value)
+    {
+      p->itreal.interval = value->it_interval;
+      if (value->it_value)
+        timerset(&p->itreal, value->it_value);
+    }
+    else if (old.it_value)
+      timerset(&p->itreal, old.it_value);
+  }
+  else if (which == ITIMER_VIRTUAL)
+  {
+    old.it_interval = p->itvirt_interval;
+    old.it_value = p->itvirt;
+    if (value)
+    {
+      p->itvirt_interval = value->it_interval;
+      p->itvirt = value->it_value;
+    }
+  }
+  else
+    return -1;
+  if (ovalue)
+    *ovalue = old;
+  return 0;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -589,6 +1230,7 @@ void procdump(void)
       [SLEEPING] "sleep ",
       [RUNNABLE] "runble",
       [RUNNING] "run   ",
+      [STOPPED] "stop  ",
       [ZOMBIE] "zombie"};
   int i;
   struct proc *p;
@@ -647,108 +1289,232 @@ int sigaction(int signum, const struct sigaction *act, struct sigaction *oldact)
 /**********************************************/
 
 /***************** TASK-2.1.5 ******************/
+// What sig_handler_runner pushes on the user stack for a handler.
+// Frames for a burst of signals are stacked one below the other; each
+// tf holds the state of the frame above it (the previous handler's
+// entry), and the outermost one holds the interrupted user state.
+struct sigframe
+{
+  uint ret;              // Handler return address: TRAMPOLINE
+  int signum;            // Handler arguments:
+  struct siginfo *infop; //   (signum, &info)
+  struct siginfo info;
+  struct trapframe tf;   // User state for sigret to restore
+  uint mask;             // Signal mask to restore (F.A.Q.15)
+};
+
 /*           The sigret system call           */
-void sigret()
+// Restore the user state saved by sig_handler_runner. The handler's
+// ret popped frame.ret and the trampoline traps without a call, so the
+// frame starts one word below the trapping %esp. The frame lives in
+// user memory, so only the registers user code could have set itself
+// are taken from it. Returns the restored %eax, which syscall() stores
+// back into the trap frame.
+int sigret()
 {
   struct proc *curr_proc = myproc();
-  memmove(curr_proc->tf, curr_proc->user_trap_fram_backup, sizeof(struct trapframe));
-  curr_proc->tf->esp += sizeof(struct trapframe);
+  struct trapframe *tf = curr_proc->tf;
+  struct trapframe saved;
+  uint b = tf->esp - 4 + ((uint)&((struct sigframe *)0)->tf);
+  uint mask;
+
+  if (tf->esp < 4 || !validrange(b, sizeof(saved) + sizeof(mask), 0) ||
+      pagein(curr_proc, b, sizeof(saved) + sizeof(mask), 0) < 0)
+  {
+    SIGKILL_handler();
+    return -1;
+  }
+  memmove(&saved, (void *)b, sizeof(saved));
+  memmove(&mask, (void *)(b + sizeof(saved)), sizeof(mask));
+  curr_proc->signal_mask = mask;
+
+  saved.cs = tf->cs;
+  saved.ds = tf->ds;
+  saved.es = tf->es;
+  saved.fs = tf->fs;
+  saved.gs = tf->gs;
+  saved.ss = tf->ss;
+  saved.trapno = tf->trapno;
+  saved.eflags = (saved.eflags & FL_USER) | FL_IF;
+  *tf = saved;
+  return tf->eax;
 }
 /**********************************************/
 
 /***************** TASK-2.3 ******************/
+// Does signum resume p when p is STOPPED? SIGCONT does unless the
+// process installed its own handler; F.A.Q.7 - any signal whose
+// handler is SIGCONT_handler behaves the same.
+int sig_continues(struct proc *p, int signum)
+{
+  void *h = p->signal_handlers[signum];
+
+  return (signum == SIGCONT && h == (void *)SIG_DFL) || h == (void *)SIGCONT_handler;
+}
+
 void SIGKILL_handler()
 {
-  cprintf("Killed\n");
+  trace(TR_KILLED, myproc()->pid, 0);
   myproc()->killed = 1;
 }
+// Stop the current process until kill() delivers SIGKILL or a
+// continuing signal. A STOPPED process is off every run queue.
 void SIGSTOP_handler()
 {
-  if (myproc()->state == SLEEPING)
-    return;
-  myproc()->freeze = 1;
+  struct proc *p = myproc();
+  int i;
+
+  acquire(&ptable.lock);
+  // Checked under ptable.lock so that a continuing signal posted before
+  // we stop is not missed (kill() takes the lock to resume us).
+  for (i = 0; i < 32; i++)
+    if ((p->pending_signals & (1 << i)) && (i == SIGKILL || sig_continues(p, i)))
+      break;
+  if (i == 32)
+  {
+    p->state = STOPPED;
+    sched();
+  }
+  release(&ptable.lock);
 }
 void SIGCONT_handler()
 {
-  myproc()->freeze = 0;
+  // kill() already made the process runnable again; nothing left to do.
 }
 /**********************************************/
 
-void sig_handler_runner(struct trapframe *tf)
+// Return the set of pending signals that sig_handler_runner would act on
+// when returning to user space through tf, or 0 if there is nothing to do.
+// trap() hands this to trapret so the common case skips the runner.
+uint sig_pending(struct trapframe *tf)
 {
-  if ((tf->cs & 3) != DPL_USER) // Make sure we in kernel mode
-    return;
-
-  int sig;
   struct proc *p = myproc();
 
-  for (int i = 0; i < 32; i++)
-  {
-    sig = p->pending_signals & (1 << i); // Check whether the i's signal is turnd-on
-    if (sig)
-    {
-      cprintf("Execute (if not block) signal number %d...\n", i);
-      p->pending_signals ^= (1 << i); // Remove the signal from the pending_signals
-
-      // Execute SIGSTOP and SIDKILL immediatly, regardless of the process-signal-mask
-      if (i == SIGSTOP)
-      {
-        SIGSTOP_handler();
-        continue;
-      }
-      if (i == SIGKILL)
-      {
-        SIGKILL_handler();
-        continue;
-      }
-
-      if (!(p->signal_mask & sig)) // Execute signal handler if the signal does not blocked by the process-signal-mask
-      {
+  if (p == 0 || (tf->cs & 3) != DPL_USER)
+    return 0;
+  return p->pending_signals & (~p->signal_mask | SIG_UNBLOCKABLE);
+}
 
-        if (i == SIGCONT && p->signal_handlers[i] == (void *)SIG_DFL)
-        {
-            cprintf("bennuy\n");
-            SIGCONT_handler(); // TODO - We might want to change this in case the user changed the SIGCONT_handler to be user-space handler.
-            continue;
-        }
-        if (p->signal_handlers[i] == (void *)SIG_DFL)
-        {
-          SIGKILL_handler();
-          continue;
-        }
-        if (p->signal_handlers[i] == (void *)SIG_IGN)
-        {
-          continue;
-        }
+// Push a frame on p's user stack that runs the handler for signum
+// with info, and redirect tf to it. mask is restored by its sigret.
+// Returns -1 if the frame does not fit.
+static int sigpush(struct proc *p, int signum, struct siginfo *info, uint mask)
+{
+  struct sigframe frame;
+  uint sp;
+
+  // Build the handler's frame on the user stack: the return address
+  // (the shared trampoline, which calls sigret), the handler's
+  // arguments, and the trap frame sigret will restore. If a frame was
+  // already pushed in this pass, the new one saves that handler's entry
+  // state, so the handlers run one after the other, each sigret
+  // resuming the next, before the interrupted code.
+  sp = (p->tf->esp - sizeof(frame)) & ~3;
+  frame.ret = TRAMPOLINE;
+  frame.signum = signum;
+  frame.infop = (struct siginfo *)(sp + ((uint)&frame.info - (uint)&frame));
+  frame.info = *info;
+  frame.tf = *p->tf;
+  frame.mask = mask;
+  if (copyout(p->pgdir, sp, &frame, sizeof(frame)) < 0)
+    return -1;
 
-        // F.A.Q.5 -  Including SIGKILL and SIGSTOP bits in the blocked masks (either in sigaction, or in sigprocmask) is ok, but the blocked bit for those signals will be ignored.  - What about SIGCONT?
+  p->tf->esp = sp;
+  p->tf->eip = (uint)p->signal_handlers[signum];
+  return 0;
+}
 
-        // F.A.Q.7 -  If a different signal has its handler as SIGSTOP, then by all definitions, he will act the same, e.g. the process will become frozen, and SIGCONT should awake it up, this is also true for the other case, where you can give a random signal the SIGCONT handler, and it will behave appropriately.
+void sig_handler_runner(struct trapframe *tf)
+{
+  struct siginfo info[NSIGQUEUE + 1];
+  uint due;
+  int i, n;
+  struct proc *p = myproc();
+  int pushed = 0;
 
-        // F.A.Q.10 -  The trapframe should be backed up before creating the artificial trapframe (that is, when handling pending signals, just before returning to user space) for handling user-space signals. It will be restored upon the sigret syscall.
+  // Visit only the deliverable bits. Blocked signals stay pending until
+  // the mask is lifted. The frame pushed last runs first, so go from
+  // the highest signal down to have the lowest handled first.
+  due = sig_pending(tf);
+  while (due)
+  {
+    i = bsr(due);
+    due &= ~(1 << i);
 
-        cprintf("before backup\n", i);
+    if (!sigtake(p, i)) // Remove the signal from the pending_signals
+      continue;
+    sigdequeue(p, i, &info[0]);
+    trace(TR_SIGDELIVER, p->pid, i);
 
-        p->tf->esp -= sizeof(struct trapframe);
-        memmove((void *)(p->tf->esp), p->tf, sizeof(struct trapframe));
-        p->user_trap_fram_backup = (void *)(p->tf->esp);
+    // Execute SIGSTOP and SIDKILL immediatly, regardless of the process-signal-mask
+    if (i == SIGSTOP)
+    {
+      SIGSTOP_handler();
+      // Signals may have arrived while we were stopped.
+      due = sig_pending(tf);
+      continue;
+    }
+    if (i == SIGKILL)
+    {
+      SIGKILL_handler();
+      continue;
+    }
 
-        uint size = (uint)&done_implicit_sigret - (uint)&start_implicit_sigret;
-        p->tf->esp -= size;
-        memmove((void *)(p->tf->esp), start_implicit_sigret, size);
+    if (sig_continues(p, i))
+    {
+      SIGCONT_handler();
+      continue;
+    }
+    if (p->signal_handlers[i] == (void *)SIGSTOP_handler)
+    {
+      SIGSTOP_handler();
+      due = sig_pending(tf);
+      continue;
+    }
+    if (p->signal_handlers[i] == (void *)SIG_DFL && i != SIGCHLD)
+    {
+      SIGKILL_handler();
+      continue;
+    }
+    if (p->signal_handlers[i] == (void *)SIG_IGN ||
+        p->signal_handlers[i] == (void *)SIG_DFL) // SIGCHLD
+    {
+      continue;
+    }
 
-        *((int *)(p->tf->esp - 4)) = i; //TODO: understand
-        *((int *)(p->tf->esp - 8)) = p->tf->esp;
-        p->tf->esp -= 8;
-        //p->old_signal_mask = p->signal_mask;   //TODO: check signal mask, when neet to restore it????
+    // F.A.Q.5 -  Including SIGKILL and SIGSTOP bits in the blocked masks (either in sigaction, or in sigprocmask) is ok, but the blocked bit for those signals will be ignored.  - What about SIGCONT?
 
-        p->tf->eip = (uint)p->signal_handlers[i];
+    // F.A.Q.7 -  If a different signal has its handler as SIGSTOP, then by all definitions, he will act the same, e.g. the process will become frozen, and SIGCONT should awake it up, this is also true for the other case, where you can give a random signal the SIGCONT handler, and it will behave appropriately.
 
-        //p->signal_mask = p->old_signal_mask;
-        cprintf("after backup\n", i);
+    // F.A.Q.10 -  The trapframe should be backed up before creating the artificial trapframe (that is, when handling pending signals, just before returning to user space) for handling user-space signals. It will be restored upon the sigret syscall.
 
-        // break; // F.A.Q.6 - You can checking the pending array from the start, or continue from where you left off, whatever is more comfortable for you. (To break or not to break)
+    // Every record still queued for i is delivered in this pass too,
+    // pushed newest first so that the oldest runs first.
+    n = 1;
+    while (n < NELEM(info) && sigtake(p, i))
+      sigdequeue(p, i, &info[n++]);
+    while (n > 0)
+    {
+      // The outermost frame of a sigsuspend() wakeup restores the mask
+      // from before the call.
+      if (sigpush(p, i, &info[--n],
+                  (p->insuspend && !pushed) ? p->old_signal_mask : p->signal_mask) < 0)
+      {
+        // No room on the user stack.
+        SIGKILL_handler();
+        break;
       }
+      pushed = 1;
     }
+
+    // break; // F.A.Q.6 - You can checking the pending array from the start, or continue from where you left off, whatever is more comfortable for you. (To break or not to break)
   }
-}
\ No newline at end of file
+
+  // A sigsuspend() woken by a signal that ran no handler returns now.
+  if (p->insuspend)
+  {
+    if (!pushed)
+      p->signal_mask = p->old_signal_mask;
+    p->insuspend = 0;
+  }
+}
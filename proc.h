@@ -8,6 +8,11 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  struct proc *runq;           // Head of this CPU's run queue (runqlock, proc.c)
+  struct proc *runqtail;       // Tail of this CPU's run queue
+  volatile int nrunq;          // Number of processes on the run queue; also
+                               //   read without the lock as a hint
+  uint64 nexttick;             // TSC value at which the next tick is due
 };
 
 extern struct cpu cpus[NCPU];
@@ -32,33 +37,90 @@ struct context {
   uint eip;
 };
 
-enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
+// A timer on a per-CPU timer wheel (see timer.c).
+struct timer {
+  struct timer *next;          // Next/previous timer in the same
+  struct timer *prev;          //   wheel slot
+  struct timer **slot;         // Head of that slot
+  uint expires;                // Wheel tick at which fn runs
+  uint64 deadline;             // Or TSC value, for hrtimerset()
+  uint interval;               // Re-arm period in ticks, or 0
+  int cpu;                     // Wheel t is armed on, or -1
+  void (*fn)(struct timer*);   // Called from the timer interrupt
+  void *arg;                   // For fn
+};
+
+// A loadable program segment. pagefault() reads its pages from the
+// process's executable the first time they are touched.
+struct seg {
+  uint va;                     // Start; page-aligned
+  uint filesz;                 // Bytes read from the file
+  uint memsz;                  // Bytes in memory; the rest is zero
+  uint off;                    // File offset of va
+};
+
+// An mmap() region. Its pages are filled in by vmafault() when
+// first touched.
+struct vma {
+  uint start;                  // Page-aligned; start == end if unused
+  uint end;
+  int prot;                    // PROT_READ, PROT_WRITE
+  int flags;                   // MAP_SHARED or MAP_PRIVATE, MAP_ANONYMOUS
+  struct file *f;              // Mapped file, or 0 if anonymous
+  uint off;                    // File offset of start
+};
+
+// Signals whose delivery ignores the process signal mask.
+#define SIG_UNBLOCKABLE ((1 << SIGKILL) | (1 << SIGSTOP))
+
+enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, STOPPED, ZOMBIE };
 
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
+  char *vproc;                 // Page mapped read-only at VPROC (vdso.h)
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *children;       // Live children, linked through sibnext
+  struct proc *zombies;        // Exited children not yet reaped by wait()
+  struct proc *sibnext;        // Next/previous entry in parent's children
+  struct proc *sibprev;        //   or zombies list (ptable.lock)
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *chnext;         // Next/previous sleeper in chan's
+  struct proc *chprev;         //   sleep queue bucket (ptable.lock)
+  struct proc *rqnext;         // Next RUNNABLE proc on the same run queue
+  int cpu;                     // Run queue to use, or -1 if none yet
   int killed;                  // If non-zero, have been killed
+  int xstatus;                 // Exit status, for waitpid()
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
+  struct inode *exe;           // Program file the segments come from
+  struct seg seg[NSEG];        // Its loadable segments
+  int nseg;                    // Number of entries in seg
+  struct vma vma[NVMA];        // mmap() regions, above sz
   char name[16];               // Process name (debugging)
+  struct proc *pidnext;        // Next proc in the same pidhash bucket
 
   /***************** TASK-2.1.1 *****************/
-  uint pending_signals;
+  volatile uint pending_signals; // Updated with atomic ops only (see sigpost/sigtake)
   uint signal_mask;
   void* signal_handlers[32]; // F.A.Q.1 - Change to sigaction* instead of void*?
-  struct trapframe* user_trap_fram_backup;
+  struct siginfo sigq[NSIGQUEUE]; // sigqueue() records, oldest first (sigqlock)
+  int nsigq;                   // Number of records in sigq
+  uint sigwaiting;             // Signals a sigread() sleeper waits for
   /**********************************************/
-  int freeze;
    // F.A.Q.15 -  In order to restore the original sigprocmask when resuming after handling a signal, you can create a field in proc struct in order to hold it, or you could put the older mask inside the artificial trapframe. 
   uint old_signal_mask;
+  int insuspend;               // In sigsuspend(); old_signal_mask is live
+  struct timer itreal;         // ITIMER_REAL; posts SIGALRM
+  struct timer sleeptimer;     // Wakes sleepticks()
+  uint itvirt;                 // ITIMER_VIRTUAL: user ticks left, or 0
+  uint itvirt_interval;        //   and reload value
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -66,3 +128,5 @@ struct proc {
 //   original data and bss
 //   fixed-size stack
 //   expandable heap
+//   (gap)
+//   mmap() regions, allocated downward from USERTOP
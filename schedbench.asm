@@ -0,0 +1,1688 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#define UNIT 10000  // loop iterations per work unit
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  int nchild, n, i, j, start, fds[2];
+  uint units, total;
+  volatile uint x;
+
+  nchild = argc > 1 ? atoi(argv[1]) : 8;
+  n = argc > 2 ? atoi(argv[2]) : 300;
+   f:	be 2c 01 00 00       	mov    $0x12c,%esi
+{
+  14:	53                   	push   %ebx
+  15:	bb 08 00 00 00       	mov    $0x8,%ebx
+  1a:	51                   	push   %ecx
+  1b:	83 ec 28             	sub    $0x28,%esp
+  1e:	8b 39                	mov    (%ecx),%edi
+  20:	8b 51 04             	mov    0x4(%ecx),%edx
+  nchild = argc > 1 ? atoi(argv[1]) : 8;
+  23:	83 ff 01             	cmp    $0x1,%edi
+  26:	0f 8f b7 00 00 00    	jg     e3 <main+0xe3>
+  if(nchild <= 0 || n <= 0){
+    printf(2, "usage: schedbench [nchild [ticks]]\n");
+    exit(1);
+  }
+  if(pipe(fds) < 0){
+  2c:	83 ec 0c             	sub    $0xc,%esp
+  2f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  32:	50                   	push   %eax
+  33:	e8 dd 04 00 00       	call   515 <pipe>
+  38:	83 c4 10             	add    $0x10,%esp
+  3b:	85 c0                	test   %eax,%eax
+  3d:	0f 88 86 00 00 00    	js     c9 <main+0xc9>
+    printf(2, "schedbench: pipe failed\n");
+    exit(1);
+  }
+
+  start = uptime();
+  43:	e8 f8 03 00 00       	call   440 <uptime>
+  for(i = 0; i < nchild; i++){
+  48:	31 ff                	xor    %edi,%edi
+  start = uptime();
+  4a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < nchild; i++){
+  4d:	eb 0c                	jmp    5b <main+0x5b>
+  4f:	90                   	nop
+  50:	83 c7 01             	add    $0x1,%edi
+  53:	39 df                	cmp    %ebx,%edi
+  55:	0f 84 d9 00 00 00    	je     134 <main+0x134>
+    if(fork() == 0){
+  5b:	e8 67 04 00 00       	call   4c7 <fork>
+  60:	85 c0                	test   %eax,%eax
+  62:	75 ec                	jne    50 <main+0x50>
+      close(fds[0]);
+  64:	83 ec 0c             	sub    $0xc,%esp
+  67:	ff 75 e0             	push   -0x20(%ebp)
+      units = 0;
+      x = 0;
+  6a:	31 ff                	xor    %edi,%edi
+      close(fds[0]);
+  6c:	e8 f2 04 00 00       	call   563 <close>
+      while(uptime() - start < n){
+  71:	83 c4 10             	add    $0x10,%esp
+      x = 0;
+  74:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  77:	89 7d dc             	mov    %edi,-0x24(%ebp)
+      while(uptime() - start < n){
+  7a:	e8 c1 03 00 00       	call   440 <uptime>
+  7f:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  82:	29 d8                	sub    %ebx,%eax
+  84:	39 f0                	cmp    %esi,%eax
+  86:	7d 28                	jge    b0 <main+0xb0>
+  88:	ba 10 27 00 00       	mov    $0x2710,%edx
+  8d:	8d 76 00             	lea    0x0(%esi),%esi
+        for(j = 0; j < UNIT; j++)
+          x++;
+  90:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  93:	83 c0 01             	add    $0x1,%eax
+  96:	89 45 dc             	mov    %eax,-0x24(%ebp)
+        for(j = 0; j < UNIT; j++)
+  99:	83 ea 01             	sub    $0x1,%edx
+  9c:	75 f2                	jne    90 <main+0x90>
+        units++;
+  9e:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+      while(uptime() - start < n){
+  a2:	e8 99 03 00 00       	call   440 <uptime>
+  a7:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  aa:	29 d8                	sub    %ebx,%eax
+  ac:	39 f0                	cmp    %esi,%eax
+  ae:	7c d8                	jl     88 <main+0x88>
+      }
+      write(fds[1], &units, sizeof(units));
+  b0:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  b3:	51                   	push   %ecx
+      exit(0);
+  b4:	31 db                	xor    %ebx,%ebx
+      write(fds[1], &units, sizeof(units));
+  b6:	6a 04                	push   $0x4
+  b8:	50                   	push   %eax
+  b9:	ff 75 e4             	push   -0x1c(%ebp)
+  bc:	e8 88 04 00 00       	call   549 <write>
+      exit(0);
+  c1:	89 1c 24             	mov    %ebx,(%esp)
+  c4:	e8 18 04 00 00       	call   4e1 <exit>
+    printf(2, "schedbench: pipe failed\n");
+  c9:	50                   	push   %eax
+  ca:	50                   	push   %eax
+  cb:	68 51 0c 00 00       	push   $0xc51
+  d0:	6a 02                	push   $0x2
+  d2:	e8 f9 07 00 00       	call   8d0 <printf>
+    exit(1);
+  d7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  de:	e8 fe 03 00 00       	call   4e1 <exit>
+  nchild = argc > 1 ? atoi(argv[1]) : 8;
+  e3:	83 ec 0c             	sub    $0xc,%esp
+  e6:	ff 72 04             	push   0x4(%edx)
+  e9:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  ec:	e8 8f 02 00 00       	call   380 <atoi>
+  n = argc > 2 ? atoi(argv[2]) : 300;
+  f1:	83 c4 10             	add    $0x10,%esp
+  nchild = argc > 1 ? atoi(argv[1]) : 8;
+  f4:	89 c3                	mov    %eax,%ebx
+  n = argc > 2 ? atoi(argv[2]) : 300;
+  f6:	83 ff 02             	cmp    $0x2,%edi
+  f9:	74 13                	je     10e <main+0x10e>
+  fb:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  fe:	83 ec 0c             	sub    $0xc,%esp
+ 101:	ff 72 08             	push   0x8(%edx)
+ 104:	e8 77 02 00 00       	call   380 <atoi>
+ 109:	83 c4 10             	add    $0x10,%esp
+ 10c:	89 c6                	mov    %eax,%esi
+  if(nchild <= 0 || n <= 0){
+ 10e:	85 db                	test   %ebx,%ebx
+ 110:	7e 08                	jle    11a <main+0x11a>
+ 112:	85 f6                	test   %esi,%esi
+ 114:	0f 8f 12 ff ff ff    	jg     2c <main+0x2c>
+    printf(2, "usage: schedbench [nchild [ticks]]\n");
+ 11a:	50                   	push   %eax
+ 11b:	50                   	push   %eax
+ 11c:	68 f8 0b 00 00       	push   $0xbf8
+ 121:	6a 02                	push   $0x2
+ 123:	e8 a8 07 00 00       	call   8d0 <printf>
+    exit(1);
+ 128:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 12f:	e8 ad 03 00 00       	call   4e1 <exit>
+    }
+  }
+  close(fds[1]);
+ 134:	83 ec 0c             	sub    $0xc,%esp
+ 137:	ff 75 e4             	push   -0x1c(%ebp)
+ 13a:	8d 7d d8             	lea    -0x28(%ebp),%edi
+ 13d:	e8 21 04 00 00       	call   563 <close>
+
+  total = 0;
+ 142:	31 d2                	xor    %edx,%edx
+  while(read(fds[0], &units, sizeof(units)) == sizeof(units))
+ 144:	83 c4 10             	add    $0x10,%esp
+  total = 0;
+ 147:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  while(read(fds[0], &units, sizeof(units)) == sizeof(units))
+ 14a:	eb 0a                	jmp    156 <main+0x156>
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    total += units;
+ 150:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+ 153:	01 4d d4             	add    %ecx,-0x2c(%ebp)
+  while(read(fds[0], &units, sizeof(units)) == sizeof(units))
+ 156:	83 ec 04             	sub    $0x4,%esp
+ 159:	6a 04                	push   $0x4
+ 15b:	57                   	push   %edi
+ 15c:	ff 75 e0             	push   -0x20(%ebp)
+ 15f:	e8 cb 03 00 00       	call   52f <read>
+ 164:	83 c4 10             	add    $0x10,%esp
+ 167:	83 f8 04             	cmp    $0x4,%eax
+ 16a:	74 e4                	je     150 <main+0x150>
+  for(i = 0; i < nchild; i++)
+ 16c:	31 ff                	xor    %edi,%edi
+ 16e:	66 90                	xchg   %ax,%ax
+    wait();
+ 170:	e8 86 03 00 00       	call   4fb <wait>
+  for(i = 0; i < nchild; i++)
+ 175:	83 c7 01             	add    $0x1,%edi
+ 178:	39 df                	cmp    %ebx,%edi
+ 17a:	75 f4                	jne    170 <main+0x170>
+
+  printf(1, "schedbench children %d ticks %d units %d units/s %d\n",
+ 17c:	50                   	push   %eax
+         nchild, n, total, total / n * 100);
+ 17d:	31 d2                	xor    %edx,%edx
+  printf(1, "schedbench children %d ticks %d units %d units/s %d\n",
+ 17f:	50                   	push   %eax
+         nchild, n, total, total / n * 100);
+ 180:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 183:	f7 f6                	div    %esi
+  printf(1, "schedbench children %d ticks %d units %d units/s %d\n",
+ 185:	6b c0 64             	imul   $0x64,%eax,%eax
+ 188:	50                   	push   %eax
+ 189:	ff 75 d4             	push   -0x2c(%ebp)
+ 18c:	56                   	push   %esi
+ 18d:	57                   	push   %edi
+ 18e:	68 1c 0c 00 00       	push   $0xc1c
+ 193:	6a 01                	push   $0x1
+ 195:	e8 36 07 00 00       	call   8d0 <printf>
+  exit(0);
+ 19a:	83 c4 14             	add    $0x14,%esp
+ 19d:	6a 00                	push   $0x0
+ 19f:	e8 3d 03 00 00       	call   4e1 <exit>
+ 1a4:	66 90                	xchg   %ax,%ax
+ 1a6:	66 90                	xchg   %ax,%ax
+ 1a8:	66 90                	xchg   %ax,%ax
+ 1aa:	66 90                	xchg   %ax,%ax
+ 1ac:	66 90                	xchg   %ax,%ax
+ 1ae:	66 90                	xchg   %ax,%ax
+
+000001b0 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1b1:	31 c0                	xor    %eax,%eax
+{
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	53                   	push   %ebx
+ 1b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1c7:	83 c0 01             	add    $0x1,%eax
+ 1ca:	84 d2                	test   %dl,%dl
+ 1cc:	75 f2                	jne    1c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1d1:	89 c8                	mov    %ecx,%eax
+ 1d3:	c9                   	leave
+ 1d4:	c3                   	ret
+ 1d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	53                   	push   %ebx
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ea:	0f b6 02             	movzbl (%edx),%eax
+ 1ed:	84 c0                	test   %al,%al
+ 1ef:	75 17                	jne    208 <strcmp+0x28>
+ 1f1:	eb 3a                	jmp    22d <strcmp+0x4d>
+ 1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1f7:	90                   	nop
+ 1f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1fc:	83 c2 01             	add    $0x1,%edx
+ 1ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 202:	84 c0                	test   %al,%al
+ 204:	74 1a                	je     220 <strcmp+0x40>
+    p++, q++;
+ 206:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 208:	0f b6 19             	movzbl (%ecx),%ebx
+ 20b:	38 c3                	cmp    %al,%bl
+ 20d:	74 e9                	je     1f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 20f:	29 d8                	sub    %ebx,%eax
+}
+ 211:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 214:	c9                   	leave
+ 215:	c3                   	ret
+ 216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 220:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 224:	31 c0                	xor    %eax,%eax
+ 226:	29 d8                	sub    %ebx,%eax
+}
+ 228:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 22b:	c9                   	leave
+ 22c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 22d:	0f b6 19             	movzbl (%ecx),%ebx
+ 230:	31 c0                	xor    %eax,%eax
+ 232:	eb db                	jmp    20f <strcmp+0x2f>
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 246:	80 3a 00             	cmpb   $0x0,(%edx)
+ 249:	74 15                	je     260 <strlen+0x20>
+ 24b:	31 c0                	xor    %eax,%eax
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+ 250:	83 c0 01             	add    $0x1,%eax
+ 253:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 257:	89 c1                	mov    %eax,%ecx
+ 259:	75 f5                	jne    250 <strlen+0x10>
+    ;
+  return n;
+}
+ 25b:	89 c8                	mov    %ecx,%eax
+ 25d:	5d                   	pop    %ebp
+ 25e:	c3                   	ret
+ 25f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 260:	31 c9                	xor    %ecx,%ecx
+}
+ 262:	5d                   	pop    %ebp
+ 263:	89 c8                	mov    %ecx,%eax
+ 265:	c3                   	ret
+ 266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000270 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 277:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 27a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 27d:	89 d7                	mov    %edx,%edi
+ 27f:	fc                   	cld
+ 280:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 282:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 285:	89 d0                	mov    %edx,%eax
+ 287:	c9                   	leave
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 29a:	0f b6 10             	movzbl (%eax),%edx
+ 29d:	84 d2                	test   %dl,%dl
+ 29f:	75 12                	jne    2b3 <strchr+0x23>
+ 2a1:	eb 1d                	jmp    2c0 <strchr+0x30>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+ 2a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ac:	83 c0 01             	add    $0x1,%eax
+ 2af:	84 d2                	test   %dl,%dl
+ 2b1:	74 0d                	je     2c0 <strchr+0x30>
+    if(*s == c)
+ 2b3:	38 d1                	cmp    %dl,%cl
+ 2b5:	75 f1                	jne    2a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2b7:	5d                   	pop    %ebp
+ 2b8:	c3                   	ret
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2c0:	31 c0                	xor    %eax,%eax
+}
+ 2c2:	5d                   	pop    %ebp
+ 2c3:	c3                   	ret
+ 2c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+
+000002d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2d9:	31 db                	xor    %ebx,%ebx
+{
+ 2db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2de:	eb 27                	jmp    307 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2e0:	83 ec 04             	sub    $0x4,%esp
+ 2e3:	6a 01                	push   $0x1
+ 2e5:	56                   	push   %esi
+ 2e6:	6a 00                	push   $0x0
+ 2e8:	e8 42 02 00 00       	call   52f <read>
+    if(cc < 1)
+ 2ed:	83 c4 10             	add    $0x10,%esp
+ 2f0:	85 c0                	test   %eax,%eax
+ 2f2:	7e 1d                	jle    311 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ff:	3c 0a                	cmp    $0xa,%al
+ 301:	74 10                	je     313 <gets+0x43>
+ 303:	3c 0d                	cmp    $0xd,%al
+ 305:	74 0c                	je     313 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 307:	89 df                	mov    %ebx,%edi
+ 309:	83 c3 01             	add    $0x1,%ebx
+ 30c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 30f:	7c cf                	jl     2e0 <gets+0x10>
+ 311:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 31a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31d:	5b                   	pop    %ebx
+ 31e:	5e                   	pop    %esi
+ 31f:	5f                   	pop    %edi
+ 320:	5d                   	pop    %ebp
+ 321:	c3                   	ret
+ 322:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	56                   	push   %esi
+ 334:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 335:	83 ec 08             	sub    $0x8,%esp
+ 338:	6a 00                	push   $0x0
+ 33a:	ff 75 08             	push   0x8(%ebp)
+ 33d:	e8 6f 02 00 00       	call   5b1 <open>
+  if(fd < 0)
+ 342:	83 c4 10             	add    $0x10,%esp
+ 345:	85 c0                	test   %eax,%eax
+ 347:	78 27                	js     370 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 349:	83 ec 08             	sub    $0x8,%esp
+ 34c:	ff 75 0c             	push   0xc(%ebp)
+ 34f:	89 c3                	mov    %eax,%ebx
+ 351:	50                   	push   %eax
+ 352:	e8 a8 02 00 00       	call   5ff <fstat>
+  close(fd);
+ 357:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 35a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 35c:	e8 02 02 00 00       	call   563 <close>
+  return r;
+ 361:	83 c4 10             	add    $0x10,%esp
+}
+ 364:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 367:	89 f0                	mov    %esi,%eax
+ 369:	5b                   	pop    %ebx
+ 36a:	5e                   	pop    %esi
+ 36b:	5d                   	pop    %ebp
+ 36c:	c3                   	ret
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 370:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 375:	eb ed                	jmp    364 <stat+0x34>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 387:	0f be 02             	movsbl (%edx),%eax
+ 38a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 38d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 390:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 395:	77 1e                	ja     3b5 <atoi+0x35>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3a0:	83 c2 01             	add    $0x1,%edx
+ 3a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3aa:	0f be 02             	movsbl (%edx),%eax
+ 3ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3b0:	80 fb 09             	cmp    $0x9,%bl
+ 3b3:	76 eb                	jbe    3a0 <atoi+0x20>
+  return n;
+}
+ 3b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b8:	89 c8                	mov    %ecx,%eax
+ 3ba:	c9                   	leave
+ 3bb:	c3                   	ret
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ce:	85 c0                	test   %eax,%eax
+ 3d0:	7e 13                	jle    3e5 <memmove+0x25>
+ 3d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3d4:	89 d7                	mov    %edx,%edi
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3e1:	39 f8                	cmp    %edi,%eax
+ 3e3:	75 fb                	jne    3e0 <memmove+0x20>
+  return vdst;
+}
+ 3e5:	5e                   	pop    %esi
+ 3e6:	89 d0                	mov    %edx,%eax
+ 3e8:	5f                   	pop    %edi
+ 3e9:	5d                   	pop    %ebp
+ 3ea:	c3                   	ret
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 3f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 3f9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 400:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 403:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 406:	50                   	push   %eax
+ 407:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 40a:	50                   	push   %eax
+ 40b:	6a 00                	push   $0x0
+ 40d:	e8 8d 03 00 00       	call   79f <setitimer>
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	89 c2                	mov    %eax,%edx
+ 417:	31 c0                	xor    %eax,%eax
+ 419:	85 d2                	test   %edx,%edx
+ 41b:	78 03                	js     420 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 41d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 420:	c9                   	leave
+ 421:	c3                   	ret
+ 422:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 430:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 435:	c3                   	ret
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 440:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 445:	c3                   	ret
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000450 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 459:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 45d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 460:	75 5e                	jne    4c0 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 462:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 468:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 46a:	89 d3                	mov    %edx,%ebx
+ 46c:	89 c1                	mov    %eax,%ecx
+ 46e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 474:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 47a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 47d:	31 d2                	xor    %edx,%edx
+ 47f:	89 d8                	mov    %ebx,%eax
+ 481:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 484:	f7 f6                	div    %esi
+ 486:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 488:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 48b:	f7 f6                	div    %esi
+ 48d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 48f:	89 da                	mov    %ebx,%edx
+ 491:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 496:	f7 f3                	div    %ebx
+ 498:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 49a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 49f:	89 d3                	mov    %edx,%ebx
+ 4a1:	f7 e1                	mul    %ecx
+ 4a3:	f7 f6                	div    %esi
+ 4a5:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 4ab:	01 c3                	add    %eax,%ebx
+  return 0;
+ 4ad:	31 c0                	xor    %eax,%eax
+ 4af:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 4b2:	83 c4 0c             	add    $0xc,%esp
+ 4b5:	5b                   	pop    %ebx
+ 4b6:	5e                   	pop    %esi
+ 4b7:	5f                   	pop    %edi
+ 4b8:	5d                   	pop    %ebp
+ 4b9:	c3                   	ret
+ 4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 4c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4c5:	eb eb                	jmp    4b2 <clock_gettime+0x62>
+
+000004c7 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4c7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4cc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4d3:	74 09                	je     4de <fork+0x17>
+ 4d5:	89 e1                	mov    %esp,%ecx
+ 4d7:	ba e0 04 00 00       	mov    $0x4e0,%edx
+ 4dc:	0f 34                	sysenter
+ 4de:	cd 40                	int    $0x40
+ 4e0:	c3                   	ret
+
+000004e1 <exit>:
+SYSCALL(exit)
+ 4e1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4e6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4ed:	74 09                	je     4f8 <exit+0x17>
+ 4ef:	89 e1                	mov    %esp,%ecx
+ 4f1:	ba fa 04 00 00       	mov    $0x4fa,%edx
+ 4f6:	0f 34                	sysenter
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <wait>:
+SYSCALL(wait)
+ 4fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 500:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 507:	74 09                	je     512 <wait+0x17>
+ 509:	89 e1                	mov    %esp,%ecx
+ 50b:	ba 14 05 00 00       	mov    $0x514,%edx
+ 510:	0f 34                	sysenter
+ 512:	cd 40                	int    $0x40
+ 514:	c3                   	ret
+
+00000515 <pipe>:
+SYSCALL(pipe)
+ 515:	b8 04 00 00 00       	mov    $0x4,%eax
+ 51a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 521:	74 09                	je     52c <pipe+0x17>
+ 523:	89 e1                	mov    %esp,%ecx
+ 525:	ba 2e 05 00 00       	mov    $0x52e,%edx
+ 52a:	0f 34                	sysenter
+ 52c:	cd 40                	int    $0x40
+ 52e:	c3                   	ret
+
+0000052f <read>:
+SYSCALL(read)
+ 52f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 534:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 53b:	74 09                	je     546 <read+0x17>
+ 53d:	89 e1                	mov    %esp,%ecx
+ 53f:	ba 48 05 00 00       	mov    $0x548,%edx
+ 544:	0f 34                	sysenter
+ 546:	cd 40                	int    $0x40
+ 548:	c3                   	ret
+
+00000549 <write>:
+SYSCALL(write)
+ 549:	b8 10 00 00 00       	mov    $0x10,%eax
+ 54e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 555:	74 09                	je     560 <write+0x17>
+ 557:	89 e1                	mov    %esp,%ecx
+ 559:	ba 62 05 00 00       	mov    $0x562,%edx
+ 55e:	0f 34                	sysenter
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <close>:
+SYSCALL(close)
+ 563:	b8 15 00 00 00       	mov    $0x15,%eax
+ 568:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 56f:	74 09                	je     57a <close+0x17>
+ 571:	89 e1                	mov    %esp,%ecx
+ 573:	ba 7c 05 00 00       	mov    $0x57c,%edx
+ 578:	0f 34                	sysenter
+ 57a:	cd 40                	int    $0x40
+ 57c:	c3                   	ret
+
+0000057d <kill>:
+SYSCALL(kill)
+ 57d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 582:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 589:	74 09                	je     594 <kill+0x17>
+ 58b:	89 e1                	mov    %esp,%ecx
+ 58d:	ba 96 05 00 00       	mov    $0x596,%edx
+ 592:	0f 34                	sysenter
+ 594:	cd 40                	int    $0x40
+ 596:	c3                   	ret
+
+00000597 <exec>:
+SYSCALL(exec)
+ 597:	b8 07 00 00 00       	mov    $0x7,%eax
+ 59c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5a3:	74 09                	je     5ae <exec+0x17>
+ 5a5:	89 e1                	mov    %esp,%ecx
+ 5a7:	ba b0 05 00 00       	mov    $0x5b0,%edx
+ 5ac:	0f 34                	sysenter
+ 5ae:	cd 40                	int    $0x40
+ 5b0:	c3                   	ret
+
+000005b1 <open>:
+SYSCALL(open)
+ 5b1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5b6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5bd:	74 09                	je     5c8 <open+0x17>
+ 5bf:	89 e1                	mov    %esp,%ecx
+ 5c1:	ba ca 05 00 00       	mov    $0x5ca,%edx
+ 5c6:	0f 34                	sysenter
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <mknod>:
+SYSCALL(mknod)
+ 5cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5d0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5d7:	74 09                	je     5e2 <mknod+0x17>
+ 5d9:	89 e1                	mov    %esp,%ecx
+ 5db:	ba e4 05 00 00       	mov    $0x5e4,%edx
+ 5e0:	0f 34                	sysenter
+ 5e2:	cd 40                	int    $0x40
+ 5e4:	c3                   	ret
+
+000005e5 <unlink>:
+SYSCALL(unlink)
+ 5e5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5ea:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5f1:	74 09                	je     5fc <unlink+0x17>
+ 5f3:	89 e1                	mov    %esp,%ecx
+ 5f5:	ba fe 05 00 00       	mov    $0x5fe,%edx
+ 5fa:	0f 34                	sysenter
+ 5fc:	cd 40                	int    $0x40
+ 5fe:	c3                   	ret
+
+000005ff <fstat>:
+SYSCALL(fstat)
+ 5ff:	b8 08 00 00 00       	mov    $0x8,%eax
+ 604:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 60b:	74 09                	je     616 <fstat+0x17>
+ 60d:	89 e1                	mov    %esp,%ecx
+ 60f:	ba 18 06 00 00       	mov    $0x618,%edx
+ 614:	0f 34                	sysenter
+ 616:	cd 40                	int    $0x40
+ 618:	c3                   	ret
+
+00000619 <link>:
+SYSCALL(link)
+ 619:	b8 13 00 00 00       	mov    $0x13,%eax
+ 61e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 625:	74 09                	je     630 <link+0x17>
+ 627:	89 e1                	mov    %esp,%ecx
+ 629:	ba 32 06 00 00       	mov    $0x632,%edx
+ 62e:	0f 34                	sysenter
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <mkdir>:
+SYSCALL(mkdir)
+ 633:	b8 14 00 00 00       	mov    $0x14,%eax
+ 638:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 63f:	74 09                	je     64a <mkdir+0x17>
+ 641:	89 e1                	mov    %esp,%ecx
+ 643:	ba 4c 06 00 00       	mov    $0x64c,%edx
+ 648:	0f 34                	sysenter
+ 64a:	cd 40                	int    $0x40
+ 64c:	c3                   	ret
+
+0000064d <chdir>:
+SYSCALL(chdir)
+ 64d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 652:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 659:	74 09                	je     664 <chdir+0x17>
+ 65b:	89 e1                	mov    %esp,%ecx
+ 65d:	ba 66 06 00 00       	mov    $0x666,%edx
+ 662:	0f 34                	sysenter
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <dup>:
+SYSCALL(dup)
+ 667:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 66c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 673:	74 09                	je     67e <dup+0x17>
+ 675:	89 e1                	mov    %esp,%ecx
+ 677:	ba 80 06 00 00       	mov    $0x680,%edx
+ 67c:	0f 34                	sysenter
+ 67e:	cd 40                	int    $0x40
+ 680:	c3                   	ret
+
+00000681 <sbrk>:
+SYSCALL(sbrk)
+ 681:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 686:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 68d:	74 09                	je     698 <sbrk+0x17>
+ 68f:	89 e1                	mov    %esp,%ecx
+ 691:	ba 9a 06 00 00       	mov    $0x69a,%edx
+ 696:	0f 34                	sysenter
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <sleep>:
+SYSCALL(sleep)
+ 69b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6a0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6a7:	74 09                	je     6b2 <sleep+0x17>
+ 6a9:	89 e1                	mov    %esp,%ecx
+ 6ab:	ba b4 06 00 00       	mov    $0x6b4,%edx
+ 6b0:	0f 34                	sysenter
+ 6b2:	cd 40                	int    $0x40
+ 6b4:	c3                   	ret
+
+000006b5 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 6b5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6ba:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6c1:	74 09                	je     6cc <sigprocmask+0x17>
+ 6c3:	89 e1                	mov    %esp,%ecx
+ 6c5:	ba ce 06 00 00       	mov    $0x6ce,%edx
+ 6ca:	0f 34                	sysenter
+ 6cc:	cd 40                	int    $0x40
+ 6ce:	c3                   	ret
+
+000006cf <sigaction>:
+SYSCALL(sigaction)
+ 6cf:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6d4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6db:	74 09                	je     6e6 <sigaction+0x17>
+ 6dd:	89 e1                	mov    %esp,%ecx
+ 6df:	ba e8 06 00 00       	mov    $0x6e8,%edx
+ 6e4:	0f 34                	sysenter
+ 6e6:	cd 40                	int    $0x40
+ 6e8:	c3                   	ret
+
+000006e9 <sigret>:
+SYSCALL(sigret)
+ 6e9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6ee:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6f5:	74 09                	je     700 <sigret+0x17>
+ 6f7:	89 e1                	mov    %esp,%ecx
+ 6f9:	ba 02 07 00 00       	mov    $0x702,%edx
+ 6fe:	0f 34                	sysenter
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <traceread>:
+SYSCALL(traceread)
+ 703:	b8 19 00 00 00       	mov    $0x19,%eax
+ 708:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 70f:	74 09                	je     71a <traceread+0x17>
+ 711:	89 e1                	mov    %esp,%ecx
+ 713:	ba 1c 07 00 00       	mov    $0x71c,%edx
+ 718:	0f 34                	sysenter
+ 71a:	cd 40                	int    $0x40
+ 71c:	c3                   	ret
+
+0000071d <sigqueue>:
+SYSCALL(sigqueue)
+ 71d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 722:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 729:	74 09                	je     734 <sigqueue+0x17>
+ 72b:	89 e1                	mov    %esp,%ecx
+ 72d:	ba 36 07 00 00       	mov    $0x736,%edx
+ 732:	0f 34                	sysenter
+ 734:	cd 40                	int    $0x40
+ 736:	c3                   	ret
+
+00000737 <signalfd>:
+SYSCALL(signalfd)
+ 737:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 73c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 743:	74 09                	je     74e <signalfd+0x17>
+ 745:	89 e1                	mov    %esp,%ecx
+ 747:	ba 50 07 00 00       	mov    $0x750,%edx
+ 74c:	0f 34                	sysenter
+ 74e:	cd 40                	int    $0x40
+ 750:	c3                   	ret
+
+00000751 <sigwait>:
+SYSCALL(sigwait)
+ 751:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 756:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 75d:	74 09                	je     768 <sigwait+0x17>
+ 75f:	89 e1                	mov    %esp,%ecx
+ 761:	ba 6a 07 00 00       	mov    $0x76a,%edx
+ 766:	0f 34                	sysenter
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <sigsuspend>:
+SYSCALL(sigsuspend)
+ 76b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 770:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 777:	74 09                	je     782 <sigsuspend+0x17>
+ 779:	89 e1                	mov    %esp,%ecx
+ 77b:	ba 84 07 00 00       	mov    $0x784,%edx
+ 780:	0f 34                	sysenter
+ 782:	cd 40                	int    $0x40
+ 784:	c3                   	ret
+
+00000785 <waitpid>:
+SYSCALL(waitpid)
+ 785:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 78a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 791:	74 09                	je     79c <waitpid+0x17>
+ 793:	89 e1                	mov    %esp,%ecx
+ 795:	ba 9e 07 00 00       	mov    $0x79e,%edx
+ 79a:	0f 34                	sysenter
+ 79c:	cd 40                	int    $0x40
+ 79e:	c3                   	ret
+
+0000079f <setitimer>:
+SYSCALL(setitimer)
+ 79f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7a4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7ab:	74 09                	je     7b6 <setitimer+0x17>
+ 7ad:	89 e1                	mov    %esp,%ecx
+ 7af:	ba b8 07 00 00       	mov    $0x7b8,%edx
+ 7b4:	0f 34                	sysenter
+ 7b6:	cd 40                	int    $0x40
+ 7b8:	c3                   	ret
+
+000007b9 <nanosleep>:
+SYSCALL(nanosleep)
+ 7b9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7be:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7c5:	74 09                	je     7d0 <nanosleep+0x17>
+ 7c7:	89 e1                	mov    %esp,%ecx
+ 7c9:	ba d2 07 00 00       	mov    $0x7d2,%edx
+ 7ce:	0f 34                	sysenter
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <mmap>:
+SYSCALL(mmap)
+ 7d3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7d8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7df:	74 09                	je     7ea <mmap+0x17>
+ 7e1:	89 e1                	mov    %esp,%ecx
+ 7e3:	ba ec 07 00 00       	mov    $0x7ec,%edx
+ 7e8:	0f 34                	sysenter
+ 7ea:	cd 40                	int    $0x40
+ 7ec:	c3                   	ret
+
+000007ed <munmap>:
+SYSCALL(munmap)
+ 7ed:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7f2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7f9:	74 09                	je     804 <munmap+0x17>
+ 7fb:	89 e1                	mov    %esp,%ecx
+ 7fd:	ba 06 08 00 00       	mov    $0x806,%edx
+ 802:	0f 34                	sysenter
+ 804:	cd 40                	int    $0x40
+ 806:	c3                   	ret
+
+00000807 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 807:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 80c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 813:	74 09                	je     81e <getpid_syscall+0x17>
+ 815:	89 e1                	mov    %esp,%ecx
+ 817:	ba 20 08 00 00       	mov    $0x820,%edx
+ 81c:	0f 34                	sysenter
+ 81e:	cd 40                	int    $0x40
+ 820:	c3                   	ret
+
+00000821 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 821:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 826:	cd 40                	int    $0x40
+ 828:	c3                   	ret
+ 829:	66 90                	xchg   %ax,%ax
+ 82b:	66 90                	xchg   %ax,%ax
+ 82d:	66 90                	xchg   %ax,%ax
+ 82f:	90                   	nop
+
+00000830 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 838:	89 d1                	mov    %edx,%ecx
+{
+ 83a:	83 ec 3c             	sub    $0x3c,%esp
+ 83d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 840:	85 d2                	test   %edx,%edx
+ 842:	0f 89 80 00 00 00    	jns    8c8 <printint+0x98>
+ 848:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 84c:	74 7a                	je     8c8 <printint+0x98>
+    x = -xx;
+ 84e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 850:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 855:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 858:	31 f6                	xor    %esi,%esi
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 860:	89 c8                	mov    %ecx,%eax
+ 862:	31 d2                	xor    %edx,%edx
+ 864:	89 f7                	mov    %esi,%edi
+ 866:	f7 f3                	div    %ebx
+ 868:	8d 76 01             	lea    0x1(%esi),%esi
+ 86b:	0f b6 92 cc 0c 00 00 	movzbl 0xccc(%edx),%edx
+ 872:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 876:	89 ca                	mov    %ecx,%edx
+ 878:	89 c1                	mov    %eax,%ecx
+ 87a:	39 da                	cmp    %ebx,%edx
+ 87c:	73 e2                	jae    860 <printint+0x30>
+  if(neg)
+ 87e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 881:	85 c0                	test   %eax,%eax
+ 883:	74 07                	je     88c <printint+0x5c>
+    buf[i++] = '-';
+ 885:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 88a:	89 f7                	mov    %esi,%edi
+ 88c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 88f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 892:	01 df                	add    %ebx,%edi
+ 894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 898:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 89b:	83 ec 04             	sub    $0x4,%esp
+ 89e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8a4:	6a 01                	push   $0x1
+ 8a6:	50                   	push   %eax
+ 8a7:	56                   	push   %esi
+ 8a8:	e8 9c fc ff ff       	call   549 <write>
+  while(--i >= 0)
+ 8ad:	89 f8                	mov    %edi,%eax
+ 8af:	83 c4 10             	add    $0x10,%esp
+ 8b2:	83 ef 01             	sub    $0x1,%edi
+ 8b5:	39 d8                	cmp    %ebx,%eax
+ 8b7:	75 df                	jne    898 <printint+0x68>
+}
+ 8b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8bc:	5b                   	pop    %ebx
+ 8bd:	5e                   	pop    %esi
+ 8be:	5f                   	pop    %edi
+ 8bf:	5d                   	pop    %ebp
+ 8c0:	c3                   	ret
+ 8c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8c8:	31 c0                	xor    %eax,%eax
+ 8ca:	eb 89                	jmp    855 <printint+0x25>
+ 8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8df:	0f b6 1e             	movzbl (%esi),%ebx
+ 8e2:	83 c6 01             	add    $0x1,%esi
+ 8e5:	84 db                	test   %bl,%bl
+ 8e7:	74 67                	je     950 <printf+0x80>
+ 8e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8ec:	31 d2                	xor    %edx,%edx
+ 8ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8f1:	eb 34                	jmp    927 <printf+0x57>
+ 8f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8f7:	90                   	nop
+ 8f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 900:	83 f8 25             	cmp    $0x25,%eax
+ 903:	74 18                	je     91d <printf+0x4d>
+  write(fd, &c, 1);
+ 905:	83 ec 04             	sub    $0x4,%esp
+ 908:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 90b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 90e:	6a 01                	push   $0x1
+ 910:	50                   	push   %eax
+ 911:	57                   	push   %edi
+ 912:	e8 32 fc ff ff       	call   549 <write>
+ 917:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 91a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 91d:	0f b6 1e             	movzbl (%esi),%ebx
+ 920:	83 c6 01             	add    $0x1,%esi
+ 923:	84 db                	test   %bl,%bl
+ 925:	74 29                	je     950 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 927:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 92a:	85 d2                	test   %edx,%edx
+ 92c:	74 ca                	je     8f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 92e:	83 fa 25             	cmp    $0x25,%edx
+ 931:	75 ea                	jne    91d <printf+0x4d>
+      if(c == 'd'){
+ 933:	83 f8 25             	cmp    $0x25,%eax
+ 936:	0f 84 24 01 00 00    	je     a60 <printf+0x190>
+ 93c:	83 e8 63             	sub    $0x63,%eax
+ 93f:	83 f8 15             	cmp    $0x15,%eax
+ 942:	77 1c                	ja     960 <printf+0x90>
+ 944:	ff 24 85 74 0c 00 00 	jmp    *0xc74(,%eax,4)
+ 94b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 950:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 953:	5b                   	pop    %ebx
+ 954:	5e                   	pop    %esi
+ 955:	5f                   	pop    %edi
+ 956:	5d                   	pop    %ebp
+ 957:	c3                   	ret
+ 958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 966:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 96a:	6a 01                	push   $0x1
+ 96c:	52                   	push   %edx
+ 96d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 970:	57                   	push   %edi
+ 971:	e8 d3 fb ff ff       	call   549 <write>
+ 976:	83 c4 0c             	add    $0xc,%esp
+ 979:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 97c:	6a 01                	push   $0x1
+ 97e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 981:	52                   	push   %edx
+ 982:	57                   	push   %edi
+ 983:	e8 c1 fb ff ff       	call   549 <write>
+        putc(fd, c);
+ 988:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 98b:	31 d2                	xor    %edx,%edx
+ 98d:	eb 8e                	jmp    91d <printf+0x4d>
+ 98f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 990:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 99b:	8b 13                	mov    (%ebx),%edx
+ 99d:	6a 00                	push   $0x0
+ 99f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9a4:	e8 87 fe ff ff       	call   830 <printint>
+        ap++;
+ 9a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9af:	31 d2                	xor    %edx,%edx
+ 9b1:	e9 67 ff ff ff       	jmp    91d <printf+0x4d>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9c5:	83 c0 04             	add    $0x4,%eax
+ 9c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9cb:	85 db                	test   %ebx,%ebx
+ 9cd:	0f 84 9d 00 00 00    	je     a70 <printf+0x1a0>
+        while(*s != 0){
+ 9d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9d8:	84 c0                	test   %al,%al
+ 9da:	0f 84 3d ff ff ff    	je     91d <printf+0x4d>
+ 9e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9e6:	89 de                	mov    %ebx,%esi
+ 9e8:	89 d3                	mov    %edx,%ebx
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9f0:	83 ec 04             	sub    $0x4,%esp
+ 9f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9f9:	6a 01                	push   $0x1
+ 9fb:	53                   	push   %ebx
+ 9fc:	57                   	push   %edi
+ 9fd:	e8 47 fb ff ff       	call   549 <write>
+        while(*s != 0){
+ a02:	0f b6 06             	movzbl (%esi),%eax
+ a05:	83 c4 10             	add    $0x10,%esp
+ a08:	84 c0                	test   %al,%al
+ a0a:	75 e4                	jne    9f0 <printf+0x120>
+      state = 0;
+ a0c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a0f:	31 d2                	xor    %edx,%edx
+ a11:	e9 07 ff ff ff       	jmp    91d <printf+0x4d>
+ a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a23:	83 ec 0c             	sub    $0xc,%esp
+ a26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a2b:	8b 13                	mov    (%ebx),%edx
+ a2d:	6a 01                	push   $0x1
+ a2f:	e9 6b ff ff ff       	jmp    99f <printf+0xcf>
+ a34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a38:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a3b:	83 ec 04             	sub    $0x4,%esp
+ a3e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a41:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a43:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a46:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a49:	6a 01                	push   $0x1
+ a4b:	52                   	push   %edx
+ a4c:	57                   	push   %edi
+ a4d:	e8 f7 fa ff ff       	call   549 <write>
+        ap++;
+ a52:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a55:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a58:	31 d2                	xor    %edx,%edx
+ a5a:	e9 be fe ff ff       	jmp    91d <printf+0x4d>
+ a5f:	90                   	nop
+  write(fd, &c, 1);
+ a60:	83 ec 04             	sub    $0x4,%esp
+ a63:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a66:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a69:	6a 01                	push   $0x1
+ a6b:	e9 11 ff ff ff       	jmp    981 <printf+0xb1>
+ a70:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a75:	bb 6a 0c 00 00       	mov    $0xc6a,%ebx
+ a7a:	e9 61 ff ff ff       	jmp    9e0 <printf+0x110>
+ a7f:	90                   	nop
+
+00000a80 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a81:	a1 f0 0f 00 00       	mov    0xff0,%eax
+{
+ a86:	89 e5                	mov    %esp,%ebp
+ a88:	57                   	push   %edi
+ a89:	56                   	push   %esi
+ a8a:	53                   	push   %ebx
+ a8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a8e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a98:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a9a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a9c:	39 ca                	cmp    %ecx,%edx
+ a9e:	73 30                	jae    ad0 <free+0x50>
+ aa0:	39 c1                	cmp    %eax,%ecx
+ aa2:	72 04                	jb     aa8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aa4:	39 c2                	cmp    %eax,%edx
+ aa6:	72 f0                	jb     a98 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ aa8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ aab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ aae:	39 f8                	cmp    %edi,%eax
+ ab0:	74 2e                	je     ae0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ab2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ab5:	8b 42 04             	mov    0x4(%edx),%eax
+ ab8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ abb:	39 f1                	cmp    %esi,%ecx
+ abd:	74 38                	je     af7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ abf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ac1:	5b                   	pop    %ebx
+  freep = p;
+ ac2:	89 15 f0 0f 00 00    	mov    %edx,0xff0
+}
+ ac8:	5e                   	pop    %esi
+ ac9:	5f                   	pop    %edi
+ aca:	5d                   	pop    %ebp
+ acb:	c3                   	ret
+ acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ad0:	39 c1                	cmp    %eax,%ecx
+ ad2:	72 d0                	jb     aa4 <free+0x24>
+ ad4:	eb c2                	jmp    a98 <free+0x18>
+ ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ add:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ae0:	03 70 04             	add    0x4(%eax),%esi
+ ae3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ae6:	8b 02                	mov    (%edx),%eax
+ ae8:	8b 00                	mov    (%eax),%eax
+ aea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ aed:	8b 42 04             	mov    0x4(%edx),%eax
+ af0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ af3:	39 f1                	cmp    %esi,%ecx
+ af5:	75 c8                	jne    abf <free+0x3f>
+    p->s.size += bp->s.size;
+ af7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ afa:	89 15 f0 0f 00 00    	mov    %edx,0xff0
+    p->s.size += bp->s.size;
+ b00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b06:	89 0a                	mov    %ecx,(%edx)
+}
+ b08:	5b                   	pop    %ebx
+ b09:	5e                   	pop    %esi
+ b0a:	5f                   	pop    %edi
+ b0b:	5d                   	pop    %ebp
+ b0c:	c3                   	ret
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	57                   	push   %edi
+ b14:	56                   	push   %esi
+ b15:	53                   	push   %ebx
+ b16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b1c:	8b 15 f0 0f 00 00    	mov    0xff0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b22:	8d 78 07             	lea    0x7(%eax),%edi
+ b25:	c1 ef 03             	shr    $0x3,%edi
+ b28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b2b:	85 d2                	test   %edx,%edx
+ b2d:	0f 84 8d 00 00 00    	je     bc0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b35:	8b 48 04             	mov    0x4(%eax),%ecx
+ b38:	39 f9                	cmp    %edi,%ecx
+ b3a:	73 64                	jae    ba0 <malloc+0x90>
+  if(nu < 4096)
+ b3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b41:	39 df                	cmp    %ebx,%edi
+ b43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b4d:	eb 0a                	jmp    b59 <malloc+0x49>
+ b4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b52:	8b 48 04             	mov    0x4(%eax),%ecx
+ b55:	39 f9                	cmp    %edi,%ecx
+ b57:	73 47                	jae    ba0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b59:	89 c2                	mov    %eax,%edx
+ b5b:	39 05 f0 0f 00 00    	cmp    %eax,0xff0
+ b61:	75 ed                	jne    b50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b63:	83 ec 0c             	sub    $0xc,%esp
+ b66:	56                   	push   %esi
+ b67:	e8 15 fb ff ff       	call   681 <sbrk>
+  if(p == (char*)-1)
+ b6c:	83 c4 10             	add    $0x10,%esp
+ b6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b72:	74 1c                	je     b90 <malloc+0x80>
+  hp->s.size = nu;
+ b74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b77:	83 ec 0c             	sub    $0xc,%esp
+ b7a:	83 c0 08             	add    $0x8,%eax
+ b7d:	50                   	push   %eax
+ b7e:	e8 fd fe ff ff       	call   a80 <free>
+  return freep;
+ b83:	8b 15 f0 0f 00 00    	mov    0xff0,%edx
+      if((p = morecore(nunits)) == 0)
+ b89:	83 c4 10             	add    $0x10,%esp
+ b8c:	85 d2                	test   %edx,%edx
+ b8e:	75 c0                	jne    b50 <malloc+0x40>
+        return 0;
+  }
+}
+ b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b93:	31 c0                	xor    %eax,%eax
+}
+ b95:	5b                   	pop    %ebx
+ b96:	5e                   	pop    %esi
+ b97:	5f                   	pop    %edi
+ b98:	5d                   	pop    %ebp
+ b99:	c3                   	ret
+ b9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ba0:	39 cf                	cmp    %ecx,%edi
+ ba2:	74 4c                	je     bf0 <malloc+0xe0>
+        p->s.size -= nunits;
+ ba4:	29 f9                	sub    %edi,%ecx
+ ba6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ba9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ baf:	89 15 f0 0f 00 00    	mov    %edx,0xff0
+}
+ bb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ bb8:	83 c0 08             	add    $0x8,%eax
+}
+ bbb:	5b                   	pop    %ebx
+ bbc:	5e                   	pop    %esi
+ bbd:	5f                   	pop    %edi
+ bbe:	5d                   	pop    %ebp
+ bbf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ bc0:	c7 05 f0 0f 00 00 f4 	movl   $0xff4,0xff0
+ bc7:	0f 00 00 
+    base.s.size = 0;
+ bca:	b8 f4 0f 00 00       	mov    $0xff4,%eax
+    base.s.ptr = freep = prevp = &base;
+ bcf:	c7 05 f4 0f 00 00 f4 	movl   $0xff4,0xff4
+ bd6:	0f 00 00 
+    base.s.size = 0;
+ bd9:	c7 05 f8 0f 00 00 00 	movl   $0x0,0xff8
+ be0:	00 00 00 
+    if(p->s.size >= nunits){
+ be3:	e9 54 ff ff ff       	jmp    b3c <malloc+0x2c>
+ be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bf0:	8b 08                	mov    (%eax),%ecx
+ bf2:	89 0a                	mov    %ecx,(%edx)
+ bf4:	eb b9                	jmp    baf <malloc+0x9f>
@@ -0,0 +1,58 @@
+// Scheduler scalability benchmark.
+// Runs nchild CPU-bound children for a fixed number of ticks and
+// reports the aggregate number of work units they completed.
+// Compare runs booted with different CPUS= (see schedbench-scale
+// in the Makefile).
+//   usage: schedbench [nchild [ticks]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define UNIT 10000  // loop iterations per work unit
+
+int
+main(int argc, char *argv[])
+{
+  int nchild, n, i, j, start, fds[2];
+  uint units, total;
+  volatile uint x;
+
+  nchild = argc > 1 ? atoi(argv[1]) : 8;
+  n = argc > 2 ? atoi(argv[2]) : 300;
+  if(nchild <= 0 || n <= 0){
+    printf(2, "usage: schedbench [nchild [ticks]]\n");
+    exit(1);
+  }
+  if(pipe(fds) < 0){
+    printf(2, "schedbench: pipe failed\n");
+    exit(1);
+  }
+
+  start = uptime();
+  for(i = 0; i < nchild; i++){
+    if(fork() == 0){
+      close(fds[0]);
+      units = 0;
+      x = 0;
+      while(uptime() - start < n){
+        for(j = 0; j < UNIT; j++)
+          x++;
+        units++;
+      }
+      write(fds[1], &units, sizeof(units));
+      exit(0);
+    }
+  }
+  close(fds[1]);
+
+  total = 0;
+  while(read(fds[0], &units, sizeof(units)) == sizeof(units))
+    total += units;
+  for(i = 0; i < nchild; i++)
+    wait();
+
+  printf(1, "schedbench children %d ticks %d units %d units/s %d\n",
+         nchild, n, total, total / n * 100);
+  exit(0);
+}
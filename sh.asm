@@ -0,0 +1,3066 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+      11:	eb 0e                	jmp    21 <main+0x21>
+      13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      17:	90                   	nop
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 9b 00 00 00    	jg     bc <main+0xbc>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 e9 16 00 00       	push   $0x16e9
+      2b:	e8 d1 0f 00 00       	call   1001 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	eb 2e                	jmp    67 <main+0x67>
+      39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      40:	80 3d e2 1d 00 00 20 	cmpb   $0x20,0x1de2
+      47:	0f 84 92 00 00 00    	je     df <main+0xdf>
+      4d:	8d 76 00             	lea    0x0(%esi),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      50:	e8 c2 0e 00 00       	call   f17 <fork>
+  if(pid == -1)
+      55:	83 f8 ff             	cmp    $0xffffffff,%eax
+      58:	0f 84 c6 00 00 00    	je     124 <main+0x124>
+    if(fork1() == 0)
+      5e:	85 c0                	test   %eax,%eax
+      60:	74 68                	je     ca <main+0xca>
+    wait();
+      62:	e8 e4 0e 00 00       	call   f4b <wait>
+  printf(2, "$ ");
+      67:	83 ec 08             	sub    $0x8,%esp
+      6a:	68 48 16 00 00       	push   $0x1648
+      6f:	6a 02                	push   $0x2
+      71:	e8 aa 12 00 00       	call   1320 <printf>
+  memset(buf, 0, nbuf);
+      76:	83 c4 0c             	add    $0xc,%esp
+      79:	6a 64                	push   $0x64
+      7b:	6a 00                	push   $0x0
+      7d:	68 e0 1d 00 00       	push   $0x1de0
+      82:	e8 39 0c 00 00       	call   cc0 <memset>
+  gets(buf, nbuf);
+      87:	58                   	pop    %eax
+      88:	5a                   	pop    %edx
+      89:	6a 64                	push   $0x64
+      8b:	68 e0 1d 00 00       	push   $0x1de0
+      90:	e8 8b 0c 00 00       	call   d20 <gets>
+  if(buf[0] == 0) // EOF
+      95:	0f b6 05 e0 1d 00 00 	movzbl 0x1de0,%eax
+      9c:	83 c4 10             	add    $0x10,%esp
+      9f:	84 c0                	test   %al,%al
+      a1:	74 0f                	je     b2 <main+0xb2>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      a3:	3c 63                	cmp    $0x63,%al
+      a5:	75 a9                	jne    50 <main+0x50>
+      a7:	80 3d e1 1d 00 00 64 	cmpb   $0x64,0x1de1
+      ae:	75 a0                	jne    50 <main+0x50>
+      b0:	eb 8e                	jmp    40 <main+0x40>
+  exit(0);
+      b2:	83 ec 0c             	sub    $0xc,%esp
+      b5:	6a 00                	push   $0x0
+      b7:	e8 75 0e 00 00       	call   f31 <exit>
+      close(fd);
+      bc:	83 ec 0c             	sub    $0xc,%esp
+      bf:	50                   	push   %eax
+      c0:	e8 ee 0e 00 00       	call   fb3 <close>
+      break;
+      c5:	83 c4 10             	add    $0x10,%esp
+      c8:	eb 9d                	jmp    67 <main+0x67>
+      runcmd(parsecmd(buf));
+      ca:	83 ec 0c             	sub    $0xc,%esp
+      cd:	68 e0 1d 00 00       	push   $0x1de0
+      d2:	e8 b9 0a 00 00       	call   b90 <parsecmd>
+      d7:	89 04 24             	mov    %eax,(%esp)
+      da:	e8 f1 00 00 00       	call   1d0 <runcmd>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      df:	83 ec 0c             	sub    $0xc,%esp
+      e2:	68 e0 1d 00 00       	push   $0x1de0
+      e7:	e8 a4 0b 00 00       	call   c90 <strlen>
+      if(chdir(buf+3) < 0)
+      ec:	c7 04 24 e3 1d 00 00 	movl   $0x1de3,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      f3:	c6 80 df 1d 00 00 00 	movb   $0x0,0x1ddf(%eax)
+      if(chdir(buf+3) < 0)
+      fa:	e8 9e 0f 00 00       	call   109d <chdir>
+      ff:	83 c4 10             	add    $0x10,%esp
+     102:	85 c0                	test   %eax,%eax
+     104:	0f 89 5d ff ff ff    	jns    67 <main+0x67>
+        printf(2, "cannot cd %s\n", buf+3);
+     10a:	51                   	push   %ecx
+     10b:	68 e3 1d 00 00       	push   $0x1de3
+     110:	68 f1 16 00 00       	push   $0x16f1
+     115:	6a 02                	push   $0x2
+     117:	e8 04 12 00 00       	call   1320 <printf>
+     11c:	83 c4 10             	add    $0x10,%esp
+     11f:	e9 43 ff ff ff       	jmp    67 <main+0x67>
+    panic("fork");
+     124:	83 ec 0c             	sub    $0xc,%esp
+     127:	68 4b 16 00 00       	push   $0x164b
+     12c:	e8 4f 00 00 00       	call   180 <panic>
+     131:	66 90                	xchg   %ax,%ax
+     133:	66 90                	xchg   %ax,%ax
+     135:	66 90                	xchg   %ax,%ax
+     137:	66 90                	xchg   %ax,%ax
+     139:	66 90                	xchg   %ax,%ax
+     13b:	66 90                	xchg   %ax,%ax
+     13d:	66 90                	xchg   %ax,%ax
+     13f:	90                   	nop
+
+00000140 <getcmd>:
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	56                   	push   %esi
+     144:	53                   	push   %ebx
+     145:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     148:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     14b:	83 ec 08             	sub    $0x8,%esp
+     14e:	68 48 16 00 00       	push   $0x1648
+     153:	6a 02                	push   $0x2
+     155:	e8 c6 11 00 00       	call   1320 <printf>
+  memset(buf, 0, nbuf);
+     15a:	83 c4 0c             	add    $0xc,%esp
+     15d:	56                   	push   %esi
+     15e:	6a 00                	push   $0x0
+     160:	53                   	push   %ebx
+     161:	e8 5a 0b 00 00       	call   cc0 <memset>
+  gets(buf, nbuf);
+     166:	58                   	pop    %eax
+     167:	5a                   	pop    %edx
+     168:	56                   	push   %esi
+     169:	53                   	push   %ebx
+     16a:	e8 b1 0b 00 00       	call   d20 <gets>
+  if(buf[0] == 0) // EOF
+     16f:	83 c4 10             	add    $0x10,%esp
+     172:	80 3b 01             	cmpb   $0x1,(%ebx)
+     175:	19 c0                	sbb    %eax,%eax
+}
+     177:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     17a:	5b                   	pop    %ebx
+     17b:	5e                   	pop    %esi
+     17c:	5d                   	pop    %ebp
+     17d:	c3                   	ret
+     17e:	66 90                	xchg   %ax,%ax
+
+00000180 <panic>:
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     186:	ff 75 08             	push   0x8(%ebp)
+     189:	68 e5 16 00 00       	push   $0x16e5
+     18e:	6a 02                	push   $0x2
+     190:	e8 8b 11 00 00       	call   1320 <printf>
+  exit(1);
+     195:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     19c:	e8 90 0d 00 00       	call   f31 <exit>
+     1a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1af:	90                   	nop
+
+000001b0 <fork1>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     1b6:	e8 5c 0d 00 00       	call   f17 <fork>
+  if(pid == -1)
+     1bb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     1be:	74 02                	je     1c2 <fork1+0x12>
+  return pid;
+}
+     1c0:	c9                   	leave
+     1c1:	c3                   	ret
+    panic("fork");
+     1c2:	83 ec 0c             	sub    $0xc,%esp
+     1c5:	68 4b 16 00 00       	push   $0x164b
+     1ca:	e8 b1 ff ff ff       	call   180 <panic>
+     1cf:	90                   	nop
+
+000001d0 <runcmd>:
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	53                   	push   %ebx
+     1d4:	83 ec 14             	sub    $0x14,%esp
+     1d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     1da:	85 db                	test   %ebx,%ebx
+     1dc:	74 1f                	je     1fd <runcmd+0x2d>
+  switch(cmd->type){
+     1de:	83 3b 05             	cmpl   $0x5,(%ebx)
+     1e1:	0f 87 eb 00 00 00    	ja     2d2 <runcmd+0x102>
+     1e7:	8b 03                	mov    (%ebx),%eax
+     1e9:	ff 24 85 00 17 00 00 	jmp    *0x1700(,%eax,4)
+    if(fork1() == 0)
+     1f0:	e8 bb ff ff ff       	call   1b0 <fork1>
+     1f5:	85 c0                	test   %eax,%eax
+     1f7:	0f 84 ca 00 00 00    	je     2c7 <runcmd+0xf7>
+    exit(0);
+     1fd:	83 ec 0c             	sub    $0xc,%esp
+     200:	6a 00                	push   $0x0
+     202:	e8 2a 0d 00 00       	call   f31 <exit>
+    if(ecmd->argv[0] == 0)
+     207:	8b 43 04             	mov    0x4(%ebx),%eax
+     20a:	85 c0                	test   %eax,%eax
+     20c:	74 ef                	je     1fd <runcmd+0x2d>
+    exec(ecmd->argv[0], ecmd->argv);
+     20e:	8d 53 04             	lea    0x4(%ebx),%edx
+     211:	51                   	push   %ecx
+     212:	51                   	push   %ecx
+     213:	52                   	push   %edx
+     214:	50                   	push   %eax
+     215:	e8 cd 0d 00 00       	call   fe7 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     21a:	83 c4 0c             	add    $0xc,%esp
+     21d:	ff 73 04             	push   0x4(%ebx)
+     220:	68 57 16 00 00       	push   $0x1657
+     225:	6a 02                	push   $0x2
+     227:	e8 f4 10 00 00       	call   1320 <printf>
+    exit(1);
+     22c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     233:	e8 f9 0c 00 00       	call   f31 <exit>
+    if(pipe(p) < 0)
+     238:	83 ec 0c             	sub    $0xc,%esp
+     23b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     23e:	50                   	push   %eax
+     23f:	e8 21 0d 00 00       	call   f65 <pipe>
+     244:	83 c4 10             	add    $0x10,%esp
+     247:	85 c0                	test   %eax,%eax
+     249:	0f 88 ac 00 00 00    	js     2fb <runcmd+0x12b>
+    if(fork1() == 0){
+     24f:	e8 5c ff ff ff       	call   1b0 <fork1>
+     254:	85 c0                	test   %eax,%eax
+     256:	0f 84 ac 00 00 00    	je     308 <runcmd+0x138>
+    if(fork1() == 0){
+     25c:	e8 4f ff ff ff       	call   1b0 <fork1>
+     261:	85 c0                	test   %eax,%eax
+     263:	0f 84 cd 00 00 00    	je     336 <runcmd+0x166>
+    close(p[0]);
+     269:	83 ec 0c             	sub    $0xc,%esp
+     26c:	ff 75 f0             	push   -0x10(%ebp)
+     26f:	e8 3f 0d 00 00       	call   fb3 <close>
+    close(p[1]);
+     274:	58                   	pop    %eax
+     275:	ff 75 f4             	push   -0xc(%ebp)
+     278:	e8 36 0d 00 00       	call   fb3 <close>
+    wait();
+     27d:	e8 c9 0c 00 00       	call   f4b <wait>
+    wait();
+     282:	e8 c4 0c 00 00       	call   f4b <wait>
+    break;
+     287:	83 c4 10             	add    $0x10,%esp
+     28a:	e9 6e ff ff ff       	jmp    1fd <runcmd+0x2d>
+    if(fork1() == 0)
+     28f:	e8 1c ff ff ff       	call   1b0 <fork1>
+     294:	85 c0                	test   %eax,%eax
+     296:	74 2f                	je     2c7 <runcmd+0xf7>
+    wait();
+     298:	e8 ae 0c 00 00       	call   f4b <wait>
+    runcmd(lcmd->right);
+     29d:	83 ec 0c             	sub    $0xc,%esp
+     2a0:	ff 73 08             	push   0x8(%ebx)
+     2a3:	e8 28 ff ff ff       	call   1d0 <runcmd>
+    close(rcmd->fd);
+     2a8:	83 ec 0c             	sub    $0xc,%esp
+     2ab:	ff 73 14             	push   0x14(%ebx)
+     2ae:	e8 00 0d 00 00       	call   fb3 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     2b3:	58                   	pop    %eax
+     2b4:	5a                   	pop    %edx
+     2b5:	ff 73 10             	push   0x10(%ebx)
+     2b8:	ff 73 08             	push   0x8(%ebx)
+     2bb:	e8 41 0d 00 00       	call   1001 <open>
+     2c0:	83 c4 10             	add    $0x10,%esp
+     2c3:	85 c0                	test   %eax,%eax
+     2c5:	78 18                	js     2df <runcmd+0x10f>
+      runcmd(bcmd->cmd);
+     2c7:	83 ec 0c             	sub    $0xc,%esp
+     2ca:	ff 73 04             	push   0x4(%ebx)
+     2cd:	e8 fe fe ff ff       	call   1d0 <runcmd>
+    panic("runcmd");
+     2d2:	83 ec 0c             	sub    $0xc,%esp
+     2d5:	68 50 16 00 00       	push   $0x1650
+     2da:	e8 a1 fe ff ff       	call   180 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     2df:	51                   	push   %ecx
+     2e0:	ff 73 08             	push   0x8(%ebx)
+     2e3:	68 67 16 00 00       	push   $0x1667
+     2e8:	6a 02                	push   $0x2
+     2ea:	e8 31 10 00 00       	call   1320 <printf>
+      exit(1);
+     2ef:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     2f6:	e8 36 0c 00 00       	call   f31 <exit>
+      panic("pipe");
+     2fb:	83 ec 0c             	sub    $0xc,%esp
+     2fe:	68 77 16 00 00       	push   $0x1677
+     303:	e8 78 fe ff ff       	call   180 <panic>
+      close(1);
+     308:	83 ec 0c             	sub    $0xc,%esp
+     30b:	6a 01                	push   $0x1
+     30d:	e8 a1 0c 00 00       	call   fb3 <close>
+      dup(p[1]);
+     312:	58                   	pop    %eax
+     313:	ff 75 f4             	push   -0xc(%ebp)
+     316:	e8 9c 0d 00 00       	call   10b7 <dup>
+      close(p[0]);
+     31b:	58                   	pop    %eax
+     31c:	ff 75 f0             	push   -0x10(%ebp)
+     31f:	e8 8f 0c 00 00       	call   fb3 <close>
+      close(p[1]);
+     324:	58                   	pop    %eax
+     325:	ff 75 f4             	push   -0xc(%ebp)
+     328:	e8 86 0c 00 00       	call   fb3 <close>
+      runcmd(pcmd->left);
+     32d:	5a                   	pop    %edx
+     32e:	ff 73 04             	push   0x4(%ebx)
+     331:	e8 9a fe ff ff       	call   1d0 <runcmd>
+      close(0);
+     336:	83 ec 0c             	sub    $0xc,%esp
+     339:	6a 00                	push   $0x0
+     33b:	e8 73 0c 00 00       	call   fb3 <close>
+      dup(p[0]);
+     340:	5a                   	pop    %edx
+     341:	ff 75 f0             	push   -0x10(%ebp)
+     344:	e8 6e 0d 00 00       	call   10b7 <dup>
+      close(p[0]);
+     349:	59                   	pop    %ecx
+     34a:	ff 75 f0             	push   -0x10(%ebp)
+     34d:	e8 61 0c 00 00       	call   fb3 <close>
+      close(p[1]);
+     352:	58                   	pop    %eax
+     353:	ff 75 f4             	push   -0xc(%ebp)
+     356:	e8 58 0c 00 00       	call   fb3 <close>
+      runcmd(pcmd->right);
+     35b:	58                   	pop    %eax
+     35c:	ff 73 08             	push   0x8(%ebx)
+     35f:	e8 6c fe ff ff       	call   1d0 <runcmd>
+     364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     36f:	90                   	nop
+
+00000370 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	53                   	push   %ebx
+     374:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     377:	6a 54                	push   $0x54
+     379:	e8 e2 11 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     37e:	83 c4 0c             	add    $0xc,%esp
+     381:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     383:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     385:	6a 00                	push   $0x0
+     387:	50                   	push   %eax
+     388:	e8 33 09 00 00       	call   cc0 <memset>
+  cmd->type = EXEC;
+     38d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     393:	89 d8                	mov    %ebx,%eax
+     395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     398:	c9                   	leave
+     399:	c3                   	ret
+     39a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003a0 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     3a0:	55                   	push   %ebp
+     3a1:	89 e5                	mov    %esp,%ebp
+     3a3:	53                   	push   %ebx
+     3a4:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3a7:	6a 18                	push   $0x18
+     3a9:	e8 b2 11 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3ae:	83 c4 0c             	add    $0xc,%esp
+     3b1:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     3b3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     3b5:	6a 00                	push   $0x0
+     3b7:	50                   	push   %eax
+     3b8:	e8 03 09 00 00       	call   cc0 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     3bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     3c0:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     3c6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     3c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3cc:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     3cf:	8b 45 10             	mov    0x10(%ebp),%eax
+     3d2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     3d5:	8b 45 14             	mov    0x14(%ebp),%eax
+     3d8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     3db:	8b 45 18             	mov    0x18(%ebp),%eax
+     3de:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     3e1:	89 d8                	mov    %ebx,%eax
+     3e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3e6:	c9                   	leave
+     3e7:	c3                   	ret
+     3e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ef:	90                   	nop
+
+000003f0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	53                   	push   %ebx
+     3f4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3f7:	6a 0c                	push   $0xc
+     3f9:	e8 62 11 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3fe:	83 c4 0c             	add    $0xc,%esp
+     401:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     403:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     405:	6a 00                	push   $0x0
+     407:	50                   	push   %eax
+     408:	e8 b3 08 00 00       	call   cc0 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     40d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     410:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     416:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     419:	8b 45 0c             	mov    0xc(%ebp),%eax
+     41c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     41f:	89 d8                	mov    %ebx,%eax
+     421:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     424:	c9                   	leave
+     425:	c3                   	ret
+     426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	53                   	push   %ebx
+     434:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     437:	6a 0c                	push   $0xc
+     439:	e8 22 11 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     43e:	83 c4 0c             	add    $0xc,%esp
+     441:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     443:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     445:	6a 00                	push   $0x0
+     447:	50                   	push   %eax
+     448:	e8 73 08 00 00       	call   cc0 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     44d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     450:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     456:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     459:	8b 45 0c             	mov    0xc(%ebp),%eax
+     45c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     45f:	89 d8                	mov    %ebx,%eax
+     461:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     464:	c9                   	leave
+     465:	c3                   	ret
+     466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	53                   	push   %ebx
+     474:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     477:	6a 08                	push   $0x8
+     479:	e8 e2 10 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     47e:	83 c4 0c             	add    $0xc,%esp
+     481:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     483:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     485:	6a 00                	push   $0x0
+     487:	50                   	push   %eax
+     488:	e8 33 08 00 00       	call   cc0 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     48d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     490:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     496:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     499:	89 d8                	mov    %ebx,%eax
+     49b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     49e:	c9                   	leave
+     49f:	c3                   	ret
+
+000004a0 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	57                   	push   %edi
+     4a4:	56                   	push   %esi
+     4a5:	53                   	push   %ebx
+     4a6:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     4a9:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     4ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     4af:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     4b2:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     4b4:	39 df                	cmp    %ebx,%edi
+     4b6:	72 0f                	jb     4c7 <gettoken+0x27>
+     4b8:	eb 25                	jmp    4df <gettoken+0x3f>
+     4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     4c0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     4c3:	39 fb                	cmp    %edi,%ebx
+     4c5:	74 18                	je     4df <gettoken+0x3f>
+     4c7:	0f be 07             	movsbl (%edi),%eax
+     4ca:	83 ec 08             	sub    $0x8,%esp
+     4cd:	50                   	push   %eax
+     4ce:	68 c0 1d 00 00       	push   $0x1dc0
+     4d3:	e8 08 08 00 00       	call   ce0 <strchr>
+     4d8:	83 c4 10             	add    $0x10,%esp
+     4db:	85 c0                	test   %eax,%eax
+     4dd:	75 e1                	jne    4c0 <gettoken+0x20>
+  if(q)
+     4df:	85 f6                	test   %esi,%esi
+     4e1:	74 02                	je     4e5 <gettoken+0x45>
+    *q = s;
+     4e3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     4e5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     4e8:	3c 3c                	cmp    $0x3c,%al
+     4ea:	0f 8f d0 00 00 00    	jg     5c0 <gettoken+0x120>
+     4f0:	3c 3a                	cmp    $0x3a,%al
+     4f2:	0f 8f bc 00 00 00    	jg     5b4 <gettoken+0x114>
+     4f8:	84 c0                	test   %al,%al
+     4fa:	75 44                	jne    540 <gettoken+0xa0>
+     4fc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     4fe:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     501:	85 c9                	test   %ecx,%ecx
+     503:	74 05                	je     50a <gettoken+0x6a>
+    *eq = s;
+     505:	8b 45 14             	mov    0x14(%ebp),%eax
+     508:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     50a:	39 df                	cmp    %ebx,%edi
+     50c:	72 09                	jb     517 <gettoken+0x77>
+     50e:	eb 1f                	jmp    52f <gettoken+0x8f>
+    s++;
+     510:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     513:	39 fb                	cmp    %edi,%ebx
+     515:	74 18                	je     52f <gettoken+0x8f>
+     517:	0f be 07             	movsbl (%edi),%eax
+     51a:	83 ec 08             	sub    $0x8,%esp
+     51d:	50                   	push   %eax
+     51e:	68 c0 1d 00 00       	push   $0x1dc0
+     523:	e8 b8 07 00 00       	call   ce0 <strchr>
+     528:	83 c4 10             	add    $0x10,%esp
+     52b:	85 c0                	test   %eax,%eax
+     52d:	75 e1                	jne    510 <gettoken+0x70>
+  *ps = s;
+     52f:	8b 45 08             	mov    0x8(%ebp),%eax
+     532:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     534:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     537:	89 f0                	mov    %esi,%eax
+     539:	5b                   	pop    %ebx
+     53a:	5e                   	pop    %esi
+     53b:	5f                   	pop    %edi
+     53c:	5d                   	pop    %ebp
+     53d:	c3                   	ret
+     53e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     540:	79 66                	jns    5a8 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     542:	39 df                	cmp    %ebx,%edi
+     544:	72 39                	jb     57f <gettoken+0xdf>
+  if(eq)
+     546:	8b 55 14             	mov    0x14(%ebp),%edx
+     549:	85 d2                	test   %edx,%edx
+     54b:	0f 84 b3 00 00 00    	je     604 <gettoken+0x164>
+    *eq = s;
+     551:	8b 45 14             	mov    0x14(%ebp),%eax
+     554:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     556:	e9 a9 00 00 00       	jmp    604 <gettoken+0x164>
+     55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     55f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     560:	0f be 07             	movsbl (%edi),%eax
+     563:	83 ec 08             	sub    $0x8,%esp
+     566:	50                   	push   %eax
+     567:	68 b8 1d 00 00       	push   $0x1db8
+     56c:	e8 6f 07 00 00       	call   ce0 <strchr>
+     571:	83 c4 10             	add    $0x10,%esp
+     574:	85 c0                	test   %eax,%eax
+     576:	75 1f                	jne    597 <gettoken+0xf7>
+      s++;
+     578:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     57b:	39 fb                	cmp    %edi,%ebx
+     57d:	74 77                	je     5f6 <gettoken+0x156>
+     57f:	0f be 07             	movsbl (%edi),%eax
+     582:	83 ec 08             	sub    $0x8,%esp
+     585:	50                   	push   %eax
+     586:	68 c0 1d 00 00       	push   $0x1dc0
+     58b:	e8 50 07 00 00       	call   ce0 <strchr>
+     590:	83 c4 10             	add    $0x10,%esp
+     593:	85 c0                	test   %eax,%eax
+     595:	74 c9                	je     560 <gettoken+0xc0>
+    ret = 'a';
+     597:	be 61 00 00 00       	mov    $0x61,%esi
+     59c:	e9 5d ff ff ff       	jmp    4fe <gettoken+0x5e>
+     5a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     5a8:	3c 26                	cmp    $0x26,%al
+     5aa:	74 08                	je     5b4 <gettoken+0x114>
+     5ac:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     5af:	80 f9 01             	cmp    $0x1,%cl
+     5b2:	77 8e                	ja     542 <gettoken+0xa2>
+  ret = *s;
+     5b4:	0f be f0             	movsbl %al,%esi
+    s++;
+     5b7:	83 c7 01             	add    $0x1,%edi
+    break;
+     5ba:	e9 3f ff ff ff       	jmp    4fe <gettoken+0x5e>
+     5bf:	90                   	nop
+  switch(*s){
+     5c0:	3c 3e                	cmp    $0x3e,%al
+     5c2:	75 1c                	jne    5e0 <gettoken+0x140>
+    if(*s == '>'){
+     5c4:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     5c8:	74 1f                	je     5e9 <gettoken+0x149>
+    s++;
+     5ca:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     5cd:	be 3e 00 00 00       	mov    $0x3e,%esi
+     5d2:	e9 27 ff ff ff       	jmp    4fe <gettoken+0x5e>
+     5d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5de:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     5e0:	3c 7c                	cmp    $0x7c,%al
+     5e2:	74 d0                	je     5b4 <gettoken+0x114>
+     5e4:	e9 59 ff ff ff       	jmp    542 <gettoken+0xa2>
+      s++;
+     5e9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     5ec:	be 2b 00 00 00       	mov    $0x2b,%esi
+     5f1:	e9 08 ff ff ff       	jmp    4fe <gettoken+0x5e>
+  if(eq)
+     5f6:	8b 45 14             	mov    0x14(%ebp),%eax
+     5f9:	85 c0                	test   %eax,%eax
+     5fb:	74 05                	je     602 <gettoken+0x162>
+    *eq = s;
+     5fd:	8b 45 14             	mov    0x14(%ebp),%eax
+     600:	89 18                	mov    %ebx,(%eax)
+      s++;
+     602:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     604:	be 61 00 00 00       	mov    $0x61,%esi
+     609:	e9 21 ff ff ff       	jmp    52f <gettoken+0x8f>
+     60e:	66 90                	xchg   %ax,%ax
+
+00000610 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	57                   	push   %edi
+     614:	56                   	push   %esi
+     615:	53                   	push   %ebx
+     616:	83 ec 0c             	sub    $0xc,%esp
+     619:	8b 7d 08             	mov    0x8(%ebp),%edi
+     61c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     61f:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     621:	39 f3                	cmp    %esi,%ebx
+     623:	72 12                	jb     637 <peek+0x27>
+     625:	eb 28                	jmp    64f <peek+0x3f>
+     627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     62e:	66 90                	xchg   %ax,%ax
+    s++;
+     630:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     633:	39 de                	cmp    %ebx,%esi
+     635:	74 18                	je     64f <peek+0x3f>
+     637:	0f be 03             	movsbl (%ebx),%eax
+     63a:	83 ec 08             	sub    $0x8,%esp
+     63d:	50                   	push   %eax
+     63e:	68 c0 1d 00 00       	push   $0x1dc0
+     643:	e8 98 06 00 00       	call   ce0 <strchr>
+     648:	83 c4 10             	add    $0x10,%esp
+     64b:	85 c0                	test   %eax,%eax
+     64d:	75 e1                	jne    630 <peek+0x20>
+  *ps = s;
+     64f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     651:	0f be 03             	movsbl (%ebx),%eax
+     654:	31 d2                	xor    %edx,%edx
+     656:	84 c0                	test   %al,%al
+     658:	75 0e                	jne    668 <peek+0x58>
+}
+     65a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     65d:	89 d0                	mov    %edx,%eax
+     65f:	5b                   	pop    %ebx
+     660:	5e                   	pop    %esi
+     661:	5f                   	pop    %edi
+     662:	5d                   	pop    %ebp
+     663:	c3                   	ret
+     664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     668:	83 ec 08             	sub    $0x8,%esp
+     66b:	50                   	push   %eax
+     66c:	ff 75 10             	push   0x10(%ebp)
+     66f:	e8 6c 06 00 00       	call   ce0 <strchr>
+     674:	83 c4 10             	add    $0x10,%esp
+     677:	31 d2                	xor    %edx,%edx
+     679:	85 c0                	test   %eax,%eax
+     67b:	0f 95 c2             	setne  %dl
+}
+     67e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     681:	5b                   	pop    %ebx
+     682:	89 d0                	mov    %edx,%eax
+     684:	5e                   	pop    %esi
+     685:	5f                   	pop    %edi
+     686:	5d                   	pop    %ebp
+     687:	c3                   	ret
+     688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68f:	90                   	nop
+
+00000690 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	57                   	push   %edi
+     694:	56                   	push   %esi
+     695:	53                   	push   %ebx
+     696:	83 ec 2c             	sub    $0x2c,%esp
+     699:	8b 75 0c             	mov    0xc(%ebp),%esi
+     69c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     69f:	90                   	nop
+     6a0:	83 ec 04             	sub    $0x4,%esp
+     6a3:	68 99 16 00 00       	push   $0x1699
+     6a8:	53                   	push   %ebx
+     6a9:	56                   	push   %esi
+     6aa:	e8 61 ff ff ff       	call   610 <peek>
+     6af:	83 c4 10             	add    $0x10,%esp
+     6b2:	85 c0                	test   %eax,%eax
+     6b4:	0f 84 f6 00 00 00    	je     7b0 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     6ba:	6a 00                	push   $0x0
+     6bc:	6a 00                	push   $0x0
+     6be:	53                   	push   %ebx
+     6bf:	56                   	push   %esi
+     6c0:	e8 db fd ff ff       	call   4a0 <gettoken>
+     6c5:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     6c7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     6ca:	50                   	push   %eax
+     6cb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     6ce:	50                   	push   %eax
+     6cf:	53                   	push   %ebx
+     6d0:	56                   	push   %esi
+     6d1:	e8 ca fd ff ff       	call   4a0 <gettoken>
+     6d6:	83 c4 20             	add    $0x20,%esp
+     6d9:	83 f8 61             	cmp    $0x61,%eax
+     6dc:	0f 85 d9 00 00 00    	jne    7bb <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     6e2:	83 ff 3c             	cmp    $0x3c,%edi
+     6e5:	74 69                	je     750 <parseredirs+0xc0>
+     6e7:	83 ff 3e             	cmp    $0x3e,%edi
+     6ea:	74 05                	je     6f1 <parseredirs+0x61>
+     6ec:	83 ff 2b             	cmp    $0x2b,%edi
+     6ef:	75 af                	jne    6a0 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6f1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     6f4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     6f7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6fa:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     6fd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     700:	6a 18                	push   $0x18
+     702:	e8 59 0e 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     707:	83 c4 0c             	add    $0xc,%esp
+     70a:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     70c:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     70e:	6a 00                	push   $0x0
+     710:	50                   	push   %eax
+     711:	e8 aa 05 00 00       	call   cc0 <memset>
+  cmd->type = REDIR;
+     716:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     71c:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     71f:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     722:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     725:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     728:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     72b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     72e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     735:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     738:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     73f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     742:	e9 59 ff ff ff       	jmp    6a0 <parseredirs+0x10>
+     747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     750:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     753:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     756:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     759:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     75c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     75f:	6a 18                	push   $0x18
+     761:	e8 fa 0d 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     766:	83 c4 0c             	add    $0xc,%esp
+     769:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     76b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     76d:	6a 00                	push   $0x0
+     76f:	50                   	push   %eax
+     770:	e8 4b 05 00 00       	call   cc0 <memset>
+  cmd->cmd = subcmd;
+     775:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     778:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     77b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     77e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     781:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     787:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     78a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     78d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     790:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     793:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     79a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     7a1:	e9 fa fe ff ff       	jmp    6a0 <parseredirs+0x10>
+     7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ad:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     7b0:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7b6:	5b                   	pop    %ebx
+     7b7:	5e                   	pop    %esi
+     7b8:	5f                   	pop    %edi
+     7b9:	5d                   	pop    %ebp
+     7ba:	c3                   	ret
+      panic("missing file for redirection");
+     7bb:	83 ec 0c             	sub    $0xc,%esp
+     7be:	68 7c 16 00 00       	push   $0x167c
+     7c3:	e8 b8 f9 ff ff       	call   180 <panic>
+     7c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7cf:	90                   	nop
+
+000007d0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	57                   	push   %edi
+     7d4:	56                   	push   %esi
+     7d5:	53                   	push   %ebx
+     7d6:	83 ec 30             	sub    $0x30,%esp
+     7d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     7df:	68 9c 16 00 00       	push   $0x169c
+     7e4:	56                   	push   %esi
+     7e5:	53                   	push   %ebx
+     7e6:	e8 25 fe ff ff       	call   610 <peek>
+     7eb:	83 c4 10             	add    $0x10,%esp
+     7ee:	85 c0                	test   %eax,%eax
+     7f0:	0f 85 aa 00 00 00    	jne    8a0 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     7f6:	83 ec 0c             	sub    $0xc,%esp
+     7f9:	89 c7                	mov    %eax,%edi
+     7fb:	6a 54                	push   $0x54
+     7fd:	e8 5e 0d 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     802:	83 c4 0c             	add    $0xc,%esp
+     805:	6a 54                	push   $0x54
+     807:	6a 00                	push   $0x0
+     809:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     80c:	50                   	push   %eax
+     80d:	e8 ae 04 00 00       	call   cc0 <memset>
+  cmd->type = EXEC;
+     812:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     815:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     818:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     81e:	56                   	push   %esi
+     81f:	53                   	push   %ebx
+     820:	50                   	push   %eax
+     821:	e8 6a fe ff ff       	call   690 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     826:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     829:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     82c:	eb 15                	jmp    843 <parseexec+0x73>
+     82e:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     830:	83 ec 04             	sub    $0x4,%esp
+     833:	56                   	push   %esi
+     834:	53                   	push   %ebx
+     835:	ff 75 d4             	push   -0x2c(%ebp)
+     838:	e8 53 fe ff ff       	call   690 <parseredirs>
+     83d:	83 c4 10             	add    $0x10,%esp
+     840:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     843:	83 ec 04             	sub    $0x4,%esp
+     846:	68 b3 16 00 00       	push   $0x16b3
+     84b:	56                   	push   %esi
+     84c:	53                   	push   %ebx
+     84d:	e8 be fd ff ff       	call   610 <peek>
+     852:	83 c4 10             	add    $0x10,%esp
+     855:	85 c0                	test   %eax,%eax
+     857:	75 5f                	jne    8b8 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     859:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     85c:	50                   	push   %eax
+     85d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     860:	50                   	push   %eax
+     861:	56                   	push   %esi
+     862:	53                   	push   %ebx
+     863:	e8 38 fc ff ff       	call   4a0 <gettoken>
+     868:	83 c4 10             	add    $0x10,%esp
+     86b:	85 c0                	test   %eax,%eax
+     86d:	74 49                	je     8b8 <parseexec+0xe8>
+    if(tok != 'a')
+     86f:	83 f8 61             	cmp    $0x61,%eax
+     872:	75 62                	jne    8d6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     874:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     877:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     87a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     87e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     881:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     885:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     888:	83 ff 0a             	cmp    $0xa,%edi
+     88b:	75 a3                	jne    830 <parseexec+0x60>
+      panic("too many args");
+     88d:	83 ec 0c             	sub    $0xc,%esp
+     890:	68 a5 16 00 00       	push   $0x16a5
+     895:	e8 e6 f8 ff ff       	call   180 <panic>
+     89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     8a0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     8a3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     8a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8a9:	5b                   	pop    %ebx
+     8aa:	5e                   	pop    %esi
+     8ab:	5f                   	pop    %edi
+     8ac:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     8ad:	e9 ae 01 00 00       	jmp    a60 <parseblock>
+     8b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     8b8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     8bb:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     8c2:	00 
+  cmd->eargv[argc] = 0;
+     8c3:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     8ca:	00 
+}
+     8cb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     8ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8d1:	5b                   	pop    %ebx
+     8d2:	5e                   	pop    %esi
+     8d3:	5f                   	pop    %edi
+     8d4:	5d                   	pop    %ebp
+     8d5:	c3                   	ret
+      panic("syntax");
+     8d6:	83 ec 0c             	sub    $0xc,%esp
+     8d9:	68 9e 16 00 00       	push   $0x169e
+     8de:	e8 9d f8 ff ff       	call   180 <panic>
+     8e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008f0 <parsepipe>:
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	57                   	push   %edi
+     8f4:	56                   	push   %esi
+     8f5:	53                   	push   %ebx
+     8f6:	83 ec 14             	sub    $0x14,%esp
+     8f9:	8b 75 08             	mov    0x8(%ebp),%esi
+     8fc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     8ff:	57                   	push   %edi
+     900:	56                   	push   %esi
+     901:	e8 ca fe ff ff       	call   7d0 <parseexec>
+  if(peek(ps, es, "|")){
+     906:	83 c4 0c             	add    $0xc,%esp
+     909:	68 b8 16 00 00       	push   $0x16b8
+  cmd = parseexec(ps, es);
+     90e:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     910:	57                   	push   %edi
+     911:	56                   	push   %esi
+     912:	e8 f9 fc ff ff       	call   610 <peek>
+     917:	83 c4 10             	add    $0x10,%esp
+     91a:	85 c0                	test   %eax,%eax
+     91c:	75 12                	jne    930 <parsepipe+0x40>
+}
+     91e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     921:	89 d8                	mov    %ebx,%eax
+     923:	5b                   	pop    %ebx
+     924:	5e                   	pop    %esi
+     925:	5f                   	pop    %edi
+     926:	5d                   	pop    %ebp
+     927:	c3                   	ret
+     928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     930:	6a 00                	push   $0x0
+     932:	6a 00                	push   $0x0
+     934:	57                   	push   %edi
+     935:	56                   	push   %esi
+     936:	e8 65 fb ff ff       	call   4a0 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     93b:	58                   	pop    %eax
+     93c:	5a                   	pop    %edx
+     93d:	57                   	push   %edi
+     93e:	56                   	push   %esi
+     93f:	e8 ac ff ff ff       	call   8f0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     944:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     94b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     94d:	e8 0e 0c 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     952:	83 c4 0c             	add    $0xc,%esp
+     955:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     957:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     959:	6a 00                	push   $0x0
+     95b:	50                   	push   %eax
+     95c:	e8 5f 03 00 00       	call   cc0 <memset>
+  cmd->left = left;
+     961:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     964:	83 c4 10             	add    $0x10,%esp
+     967:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     969:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     96f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     971:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     974:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     977:	5b                   	pop    %ebx
+     978:	5e                   	pop    %esi
+     979:	5f                   	pop    %edi
+     97a:	5d                   	pop    %ebp
+     97b:	c3                   	ret
+     97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000980 <parseline>:
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	57                   	push   %edi
+     984:	56                   	push   %esi
+     985:	53                   	push   %ebx
+     986:	83 ec 24             	sub    $0x24,%esp
+     989:	8b 75 08             	mov    0x8(%ebp),%esi
+     98c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     98f:	57                   	push   %edi
+     990:	56                   	push   %esi
+     991:	e8 5a ff ff ff       	call   8f0 <parsepipe>
+  while(peek(ps, es, "&")){
+     996:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     999:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     99b:	eb 3b                	jmp    9d8 <parseline+0x58>
+     99d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     9a0:	6a 00                	push   $0x0
+     9a2:	6a 00                	push   $0x0
+     9a4:	57                   	push   %edi
+     9a5:	56                   	push   %esi
+     9a6:	e8 f5 fa ff ff       	call   4a0 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     9ab:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     9b2:	e8 a9 0b 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     9b7:	83 c4 0c             	add    $0xc,%esp
+     9ba:	6a 08                	push   $0x8
+     9bc:	6a 00                	push   $0x0
+     9be:	50                   	push   %eax
+     9bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     9c2:	e8 f9 02 00 00       	call   cc0 <memset>
+  cmd->type = BACK;
+     9c7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     9ca:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     9cd:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     9d3:	89 5a 04             	mov    %ebx,0x4(%edx)
+     9d6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     9d8:	83 ec 04             	sub    $0x4,%esp
+     9db:	68 ba 16 00 00       	push   $0x16ba
+     9e0:	57                   	push   %edi
+     9e1:	56                   	push   %esi
+     9e2:	e8 29 fc ff ff       	call   610 <peek>
+     9e7:	83 c4 10             	add    $0x10,%esp
+     9ea:	85 c0                	test   %eax,%eax
+     9ec:	75 b2                	jne    9a0 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     9ee:	83 ec 04             	sub    $0x4,%esp
+     9f1:	68 b6 16 00 00       	push   $0x16b6
+     9f6:	57                   	push   %edi
+     9f7:	56                   	push   %esi
+     9f8:	e8 13 fc ff ff       	call   610 <peek>
+     9fd:	83 c4 10             	add    $0x10,%esp
+     a00:	85 c0                	test   %eax,%eax
+     a02:	75 0c                	jne    a10 <parseline+0x90>
+}
+     a04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a07:	89 d8                	mov    %ebx,%eax
+     a09:	5b                   	pop    %ebx
+     a0a:	5e                   	pop    %esi
+     a0b:	5f                   	pop    %edi
+     a0c:	5d                   	pop    %ebp
+     a0d:	c3                   	ret
+     a0e:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     a10:	6a 00                	push   $0x0
+     a12:	6a 00                	push   $0x0
+     a14:	57                   	push   %edi
+     a15:	56                   	push   %esi
+     a16:	e8 85 fa ff ff       	call   4a0 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     a1b:	58                   	pop    %eax
+     a1c:	5a                   	pop    %edx
+     a1d:	57                   	push   %edi
+     a1e:	56                   	push   %esi
+     a1f:	e8 5c ff ff ff       	call   980 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     a24:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     a2b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     a2d:	e8 2e 0b 00 00       	call   1560 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a32:	83 c4 0c             	add    $0xc,%esp
+     a35:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     a37:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     a39:	6a 00                	push   $0x0
+     a3b:	50                   	push   %eax
+     a3c:	e8 7f 02 00 00       	call   cc0 <memset>
+  cmd->left = left;
+     a41:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     a44:	83 c4 10             	add    $0x10,%esp
+     a47:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     a49:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     a4f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     a51:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     a54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a57:	5b                   	pop    %ebx
+     a58:	5e                   	pop    %esi
+     a59:	5f                   	pop    %edi
+     a5a:	5d                   	pop    %ebp
+     a5b:	c3                   	ret
+     a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a60 <parseblock>:
+{
+     a60:	55                   	push   %ebp
+     a61:	89 e5                	mov    %esp,%ebp
+     a63:	57                   	push   %edi
+     a64:	56                   	push   %esi
+     a65:	53                   	push   %ebx
+     a66:	83 ec 10             	sub    $0x10,%esp
+     a69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a6c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     a6f:	68 9c 16 00 00       	push   $0x169c
+     a74:	56                   	push   %esi
+     a75:	53                   	push   %ebx
+     a76:	e8 95 fb ff ff       	call   610 <peek>
+     a7b:	83 c4 10             	add    $0x10,%esp
+     a7e:	85 c0                	test   %eax,%eax
+     a80:	74 4a                	je     acc <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     a82:	6a 00                	push   $0x0
+     a84:	6a 00                	push   $0x0
+     a86:	56                   	push   %esi
+     a87:	53                   	push   %ebx
+     a88:	e8 13 fa ff ff       	call   4a0 <gettoken>
+  cmd = parseline(ps, es);
+     a8d:	58                   	pop    %eax
+     a8e:	5a                   	pop    %edx
+     a8f:	56                   	push   %esi
+     a90:	53                   	push   %ebx
+     a91:	e8 ea fe ff ff       	call   980 <parseline>
+  if(!peek(ps, es, ")"))
+     a96:	83 c4 0c             	add    $0xc,%esp
+     a99:	68 d8 16 00 00       	push   $0x16d8
+  cmd = parseline(ps, es);
+     a9e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     aa0:	56                   	push   %esi
+     aa1:	53                   	push   %ebx
+     aa2:	e8 69 fb ff ff       	call   610 <peek>
+     aa7:	83 c4 10             	add    $0x10,%esp
+     aaa:	85 c0                	test   %eax,%eax
+     aac:	74 2b                	je     ad9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     aae:	6a 00                	push   $0x0
+     ab0:	6a 00                	push   $0x0
+     ab2:	56                   	push   %esi
+     ab3:	53                   	push   %ebx
+     ab4:	e8 e7 f9 ff ff       	call   4a0 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     ab9:	83 c4 0c             	add    $0xc,%esp
+     abc:	56                   	push   %esi
+     abd:	53                   	push   %ebx
+     abe:	57                   	push   %edi
+     abf:	e8 cc fb ff ff       	call   690 <parseredirs>
+}
+     ac4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ac7:	5b                   	pop    %ebx
+     ac8:	5e                   	pop    %esi
+     ac9:	5f                   	pop    %edi
+     aca:	5d                   	pop    %ebp
+     acb:	c3                   	ret
+    panic("parseblock");
+     acc:	83 ec 0c             	sub    $0xc,%esp
+     acf:	68 bc 16 00 00       	push   $0x16bc
+     ad4:	e8 a7 f6 ff ff       	call   180 <panic>
+    panic("syntax - missing )");
+     ad9:	83 ec 0c             	sub    $0xc,%esp
+     adc:	68 c7 16 00 00       	push   $0x16c7
+     ae1:	e8 9a f6 ff ff       	call   180 <panic>
+     ae6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000af0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     af0:	55                   	push   %ebp
+     af1:	89 e5                	mov    %esp,%ebp
+     af3:	53                   	push   %ebx
+     af4:	83 ec 04             	sub    $0x4,%esp
+     af7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     afa:	85 db                	test   %ebx,%ebx
+     afc:	0f 84 7e 00 00 00    	je     b80 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     b02:	83 3b 05             	cmpl   $0x5,(%ebx)
+     b05:	77 20                	ja     b27 <nulterminate+0x37>
+     b07:	8b 03                	mov    (%ebx),%eax
+     b09:	ff 24 85 18 17 00 00 	jmp    *0x1718(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     b10:	83 ec 0c             	sub    $0xc,%esp
+     b13:	ff 73 04             	push   0x4(%ebx)
+     b16:	e8 d5 ff ff ff       	call   af0 <nulterminate>
+    nulterminate(lcmd->right);
+     b1b:	58                   	pop    %eax
+     b1c:	ff 73 08             	push   0x8(%ebx)
+     b1f:	e8 cc ff ff ff       	call   af0 <nulterminate>
+    break;
+     b24:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     b27:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     b29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b2c:	c9                   	leave
+     b2d:	c3                   	ret
+     b2e:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     b30:	83 ec 0c             	sub    $0xc,%esp
+     b33:	ff 73 04             	push   0x4(%ebx)
+     b36:	e8 b5 ff ff ff       	call   af0 <nulterminate>
+    break;
+     b3b:	83 c4 10             	add    $0x10,%esp
+     b3e:	eb e7                	jmp    b27 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     b40:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     b43:	8d 43 08             	lea    0x8(%ebx),%eax
+     b46:	85 c9                	test   %ecx,%ecx
+     b48:	74 dd                	je     b27 <nulterminate+0x37>
+     b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     b50:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     b53:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     b56:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     b59:	8b 50 fc             	mov    -0x4(%eax),%edx
+     b5c:	85 d2                	test   %edx,%edx
+     b5e:	75 f0                	jne    b50 <nulterminate+0x60>
+     b60:	eb c5                	jmp    b27 <nulterminate+0x37>
+     b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     b68:	83 ec 0c             	sub    $0xc,%esp
+     b6b:	ff 73 04             	push   0x4(%ebx)
+     b6e:	e8 7d ff ff ff       	call   af0 <nulterminate>
+    *rcmd->efile = 0;
+     b73:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     b76:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     b79:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     b7c:	eb a9                	jmp    b27 <nulterminate+0x37>
+     b7e:	66 90                	xchg   %ax,%ax
+    return 0;
+     b80:	31 c0                	xor    %eax,%eax
+     b82:	eb a5                	jmp    b29 <nulterminate+0x39>
+     b84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b8f:	90                   	nop
+
+00000b90 <parsecmd>:
+{
+     b90:	55                   	push   %ebp
+     b91:	89 e5                	mov    %esp,%ebp
+     b93:	57                   	push   %edi
+     b94:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     b95:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     b98:	53                   	push   %ebx
+     b99:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     b9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b9f:	53                   	push   %ebx
+     ba0:	e8 eb 00 00 00       	call   c90 <strlen>
+  cmd = parseline(&s, es);
+     ba5:	59                   	pop    %ecx
+     ba6:	5e                   	pop    %esi
+  es = s + strlen(s);
+     ba7:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     ba9:	53                   	push   %ebx
+     baa:	57                   	push   %edi
+     bab:	e8 d0 fd ff ff       	call   980 <parseline>
+  peek(&s, es, "");
+     bb0:	83 c4 0c             	add    $0xc,%esp
+     bb3:	68 66 16 00 00       	push   $0x1666
+  cmd = parseline(&s, es);
+     bb8:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     bba:	53                   	push   %ebx
+     bbb:	57                   	push   %edi
+     bbc:	e8 4f fa ff ff       	call   610 <peek>
+  if(s != es){
+     bc1:	8b 45 08             	mov    0x8(%ebp),%eax
+     bc4:	83 c4 10             	add    $0x10,%esp
+     bc7:	39 d8                	cmp    %ebx,%eax
+     bc9:	75 13                	jne    bde <parsecmd+0x4e>
+  nulterminate(cmd);
+     bcb:	83 ec 0c             	sub    $0xc,%esp
+     bce:	56                   	push   %esi
+     bcf:	e8 1c ff ff ff       	call   af0 <nulterminate>
+}
+     bd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bd7:	89 f0                	mov    %esi,%eax
+     bd9:	5b                   	pop    %ebx
+     bda:	5e                   	pop    %esi
+     bdb:	5f                   	pop    %edi
+     bdc:	5d                   	pop    %ebp
+     bdd:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     bde:	52                   	push   %edx
+     bdf:	50                   	push   %eax
+     be0:	68 da 16 00 00       	push   $0x16da
+     be5:	6a 02                	push   $0x2
+     be7:	e8 34 07 00 00       	call   1320 <printf>
+    panic("syntax");
+     bec:	c7 04 24 9e 16 00 00 	movl   $0x169e,(%esp)
+     bf3:	e8 88 f5 ff ff       	call   180 <panic>
+     bf8:	66 90                	xchg   %ax,%ax
+     bfa:	66 90                	xchg   %ax,%ax
+     bfc:	66 90                	xchg   %ax,%ax
+     bfe:	66 90                	xchg   %ax,%ax
+
+00000c00 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     c00:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     c01:	31 c0                	xor    %eax,%eax
+{
+     c03:	89 e5                	mov    %esp,%ebp
+     c05:	53                   	push   %ebx
+     c06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     c0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     c10:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     c14:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     c17:	83 c0 01             	add    $0x1,%eax
+     c1a:	84 d2                	test   %dl,%dl
+     c1c:	75 f2                	jne    c10 <strcpy+0x10>
+    ;
+  return os;
+}
+     c1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c21:	89 c8                	mov    %ecx,%eax
+     c23:	c9                   	leave
+     c24:	c3                   	ret
+     c25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c30 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     c30:	55                   	push   %ebp
+     c31:	89 e5                	mov    %esp,%ebp
+     c33:	53                   	push   %ebx
+     c34:	8b 55 08             	mov    0x8(%ebp),%edx
+     c37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     c3a:	0f b6 02             	movzbl (%edx),%eax
+     c3d:	84 c0                	test   %al,%al
+     c3f:	75 17                	jne    c58 <strcmp+0x28>
+     c41:	eb 3a                	jmp    c7d <strcmp+0x4d>
+     c43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c47:	90                   	nop
+     c48:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     c4c:	83 c2 01             	add    $0x1,%edx
+     c4f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     c52:	84 c0                	test   %al,%al
+     c54:	74 1a                	je     c70 <strcmp+0x40>
+    p++, q++;
+     c56:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     c58:	0f b6 19             	movzbl (%ecx),%ebx
+     c5b:	38 c3                	cmp    %al,%bl
+     c5d:	74 e9                	je     c48 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     c5f:	29 d8                	sub    %ebx,%eax
+}
+     c61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c64:	c9                   	leave
+     c65:	c3                   	ret
+     c66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c6d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     c70:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     c74:	31 c0                	xor    %eax,%eax
+     c76:	29 d8                	sub    %ebx,%eax
+}
+     c78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c7b:	c9                   	leave
+     c7c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     c7d:	0f b6 19             	movzbl (%ecx),%ebx
+     c80:	31 c0                	xor    %eax,%eax
+     c82:	eb db                	jmp    c5f <strcmp+0x2f>
+     c84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c8f:	90                   	nop
+
+00000c90 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     c96:	80 3a 00             	cmpb   $0x0,(%edx)
+     c99:	74 15                	je     cb0 <strlen+0x20>
+     c9b:	31 c0                	xor    %eax,%eax
+     c9d:	8d 76 00             	lea    0x0(%esi),%esi
+     ca0:	83 c0 01             	add    $0x1,%eax
+     ca3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     ca7:	89 c1                	mov    %eax,%ecx
+     ca9:	75 f5                	jne    ca0 <strlen+0x10>
+    ;
+  return n;
+}
+     cab:	89 c8                	mov    %ecx,%eax
+     cad:	5d                   	pop    %ebp
+     cae:	c3                   	ret
+     caf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     cb0:	31 c9                	xor    %ecx,%ecx
+}
+     cb2:	5d                   	pop    %ebp
+     cb3:	89 c8                	mov    %ecx,%eax
+     cb5:	c3                   	ret
+     cb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cc0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     cc0:	55                   	push   %ebp
+     cc1:	89 e5                	mov    %esp,%ebp
+     cc3:	57                   	push   %edi
+     cc4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     cc7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     cca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ccd:	89 d7                	mov    %edx,%edi
+     ccf:	fc                   	cld
+     cd0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     cd2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     cd5:	89 d0                	mov    %edx,%eax
+     cd7:	c9                   	leave
+     cd8:	c3                   	ret
+     cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ce0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ce6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     cea:	0f b6 10             	movzbl (%eax),%edx
+     ced:	84 d2                	test   %dl,%dl
+     cef:	75 12                	jne    d03 <strchr+0x23>
+     cf1:	eb 1d                	jmp    d10 <strchr+0x30>
+     cf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cf7:	90                   	nop
+     cf8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     cfc:	83 c0 01             	add    $0x1,%eax
+     cff:	84 d2                	test   %dl,%dl
+     d01:	74 0d                	je     d10 <strchr+0x30>
+    if(*s == c)
+     d03:	38 d1                	cmp    %dl,%cl
+     d05:	75 f1                	jne    cf8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     d07:	5d                   	pop    %ebp
+     d08:	c3                   	ret
+     d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     d10:	31 c0                	xor    %eax,%eax
+}
+     d12:	5d                   	pop    %ebp
+     d13:	c3                   	ret
+     d14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d1f:	90                   	nop
+
+00000d20 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	57                   	push   %edi
+     d24:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     d25:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     d28:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     d29:	31 db                	xor    %ebx,%ebx
+{
+     d2b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     d2e:	eb 27                	jmp    d57 <gets+0x37>
+    cc = read(0, &c, 1);
+     d30:	83 ec 04             	sub    $0x4,%esp
+     d33:	6a 01                	push   $0x1
+     d35:	56                   	push   %esi
+     d36:	6a 00                	push   $0x0
+     d38:	e8 42 02 00 00       	call   f7f <read>
+    if(cc < 1)
+     d3d:	83 c4 10             	add    $0x10,%esp
+     d40:	85 c0                	test   %eax,%eax
+     d42:	7e 1d                	jle    d61 <gets+0x41>
+      break;
+    buf[i++] = c;
+     d44:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     d48:	8b 55 08             	mov    0x8(%ebp),%edx
+     d4b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     d4f:	3c 0a                	cmp    $0xa,%al
+     d51:	74 10                	je     d63 <gets+0x43>
+     d53:	3c 0d                	cmp    $0xd,%al
+     d55:	74 0c                	je     d63 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     d57:	89 df                	mov    %ebx,%edi
+     d59:	83 c3 01             	add    $0x1,%ebx
+     d5c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     d5f:	7c cf                	jl     d30 <gets+0x10>
+     d61:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     d63:	8b 45 08             	mov    0x8(%ebp),%eax
+     d66:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     d6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d6d:	5b                   	pop    %ebx
+     d6e:	5e                   	pop    %esi
+     d6f:	5f                   	pop    %edi
+     d70:	5d                   	pop    %ebp
+     d71:	c3                   	ret
+     d72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d80 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     d80:	55                   	push   %ebp
+     d81:	89 e5                	mov    %esp,%ebp
+     d83:	56                   	push   %esi
+     d84:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d85:	83 ec 08             	sub    $0x8,%esp
+     d88:	6a 00                	push   $0x0
+     d8a:	ff 75 08             	push   0x8(%ebp)
+     d8d:	e8 6f 02 00 00       	call   1001 <open>
+  if(fd < 0)
+     d92:	83 c4 10             	add    $0x10,%esp
+     d95:	85 c0                	test   %eax,%eax
+     d97:	78 27                	js     dc0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     d99:	83 ec 08             	sub    $0x8,%esp
+     d9c:	ff 75 0c             	push   0xc(%ebp)
+     d9f:	89 c3                	mov    %eax,%ebx
+     da1:	50                   	push   %eax
+     da2:	e8 a8 02 00 00       	call   104f <fstat>
+  close(fd);
+     da7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     daa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     dac:	e8 02 02 00 00       	call   fb3 <close>
+  return r;
+     db1:	83 c4 10             	add    $0x10,%esp
+}
+     db4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     db7:	89 f0                	mov    %esi,%eax
+     db9:	5b                   	pop    %ebx
+     dba:	5e                   	pop    %esi
+     dbb:	5d                   	pop    %ebp
+     dbc:	c3                   	ret
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     dc0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     dc5:	eb ed                	jmp    db4 <stat+0x34>
+     dc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dce:	66 90                	xchg   %ax,%ax
+
+00000dd0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	53                   	push   %ebx
+     dd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     dd7:	0f be 02             	movsbl (%edx),%eax
+     dda:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     ddd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     de0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     de5:	77 1e                	ja     e05 <atoi+0x35>
+     de7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     df0:	83 c2 01             	add    $0x1,%edx
+     df3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     df6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     dfa:	0f be 02             	movsbl (%edx),%eax
+     dfd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     e00:	80 fb 09             	cmp    $0x9,%bl
+     e03:	76 eb                	jbe    df0 <atoi+0x20>
+  return n;
+}
+     e05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e08:	89 c8                	mov    %ecx,%eax
+     e0a:	c9                   	leave
+     e0b:	c3                   	ret
+     e0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e10 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	57                   	push   %edi
+     e14:	56                   	push   %esi
+     e15:	8b 45 10             	mov    0x10(%ebp),%eax
+     e18:	8b 55 08             	mov    0x8(%ebp),%edx
+     e1b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     e1e:	85 c0                	test   %eax,%eax
+     e20:	7e 13                	jle    e35 <memmove+0x25>
+     e22:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     e24:	89 d7                	mov    %edx,%edi
+     e26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     e30:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     e31:	39 f8                	cmp    %edi,%eax
+     e33:	75 fb                	jne    e30 <memmove+0x20>
+  return vdst;
+}
+     e35:	5e                   	pop    %esi
+     e36:	89 d0                	mov    %edx,%eax
+     e38:	5f                   	pop    %edi
+     e39:	5d                   	pop    %ebp
+     e3a:	c3                   	ret
+     e3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e3f:	90                   	nop
+
+00000e40 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+     e46:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+     e49:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+     e50:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+     e53:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     e56:	50                   	push   %eax
+     e57:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     e5a:	50                   	push   %eax
+     e5b:	6a 00                	push   $0x0
+     e5d:	e8 8d 03 00 00       	call   11ef <setitimer>
+     e62:	83 c4 10             	add    $0x10,%esp
+     e65:	89 c2                	mov    %eax,%edx
+     e67:	31 c0                	xor    %eax,%eax
+     e69:	85 d2                	test   %edx,%edx
+     e6b:	78 03                	js     e70 <alarm+0x30>
+    return 0;
+  return old.it_value;
+     e6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     e70:	c9                   	leave
+     e71:	c3                   	ret
+     e72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e80 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+     e80:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+     e85:	c3                   	ret
+     e86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e90 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     e90:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+     e95:	c3                   	ret
+     e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ea0 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	57                   	push   %edi
+     ea4:	56                   	push   %esi
+     ea5:	53                   	push   %ebx
+     ea6:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+     ea9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+     ead:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+     eb0:	75 5e                	jne    f10 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+     eb2:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     eb8:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+     eba:	89 d3                	mov    %edx,%ebx
+     ebc:	89 c1                	mov    %eax,%ecx
+     ebe:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+     ec4:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+     eca:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+     ecd:	31 d2                	xor    %edx,%edx
+     ecf:	89 d8                	mov    %ebx,%eax
+     ed1:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+     ed4:	f7 f6                	div    %esi
+     ed6:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+     ed8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     edb:	f7 f6                	div    %esi
+     edd:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+     edf:	89 da                	mov    %ebx,%edx
+     ee1:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+     ee6:	f7 f3                	div    %ebx
+     ee8:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+     eea:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+     eef:	89 d3                	mov    %edx,%ebx
+     ef1:	f7 e1                	mul    %ecx
+     ef3:	f7 f6                	div    %esi
+     ef5:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+     efb:	01 c3                	add    %eax,%ebx
+  return 0;
+     efd:	31 c0                	xor    %eax,%eax
+     eff:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+     f02:	83 c4 0c             	add    $0xc,%esp
+     f05:	5b                   	pop    %ebx
+     f06:	5e                   	pop    %esi
+     f07:	5f                   	pop    %edi
+     f08:	5d                   	pop    %ebp
+     f09:	c3                   	ret
+     f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+     f10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     f15:	eb eb                	jmp    f02 <clock_gettime+0x62>
+
+00000f17 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     f17:	b8 01 00 00 00       	mov    $0x1,%eax
+     f1c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f23:	74 09                	je     f2e <fork+0x17>
+     f25:	89 e1                	mov    %esp,%ecx
+     f27:	ba 30 0f 00 00       	mov    $0xf30,%edx
+     f2c:	0f 34                	sysenter
+     f2e:	cd 40                	int    $0x40
+     f30:	c3                   	ret
+
+00000f31 <exit>:
+SYSCALL(exit)
+     f31:	b8 02 00 00 00       	mov    $0x2,%eax
+     f36:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f3d:	74 09                	je     f48 <exit+0x17>
+     f3f:	89 e1                	mov    %esp,%ecx
+     f41:	ba 4a 0f 00 00       	mov    $0xf4a,%edx
+     f46:	0f 34                	sysenter
+     f48:	cd 40                	int    $0x40
+     f4a:	c3                   	ret
+
+00000f4b <wait>:
+SYSCALL(wait)
+     f4b:	b8 03 00 00 00       	mov    $0x3,%eax
+     f50:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f57:	74 09                	je     f62 <wait+0x17>
+     f59:	89 e1                	mov    %esp,%ecx
+     f5b:	ba 64 0f 00 00       	mov    $0xf64,%edx
+     f60:	0f 34                	sysenter
+     f62:	cd 40                	int    $0x40
+     f64:	c3                   	ret
+
+00000f65 <pipe>:
+SYSCALL(pipe)
+     f65:	b8 04 00 00 00       	mov    $0x4,%eax
+     f6a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f71:	74 09                	je     f7c <pipe+0x17>
+     f73:	89 e1                	mov    %esp,%ecx
+     f75:	ba 7e 0f 00 00       	mov    $0xf7e,%edx
+     f7a:	0f 34                	sysenter
+     f7c:	cd 40                	int    $0x40
+     f7e:	c3                   	ret
+
+00000f7f <read>:
+SYSCALL(read)
+     f7f:	b8 05 00 00 00       	mov    $0x5,%eax
+     f84:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f8b:	74 09                	je     f96 <read+0x17>
+     f8d:	89 e1                	mov    %esp,%ecx
+     f8f:	ba 98 0f 00 00       	mov    $0xf98,%edx
+     f94:	0f 34                	sysenter
+     f96:	cd 40                	int    $0x40
+     f98:	c3                   	ret
+
+00000f99 <write>:
+SYSCALL(write)
+     f99:	b8 10 00 00 00       	mov    $0x10,%eax
+     f9e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     fa5:	74 09                	je     fb0 <write+0x17>
+     fa7:	89 e1                	mov    %esp,%ecx
+     fa9:	ba b2 0f 00 00       	mov    $0xfb2,%edx
+     fae:	0f 34                	sysenter
+     fb0:	cd 40                	int    $0x40
+     fb2:	c3                   	ret
+
+00000fb3 <close>:
+SYSCALL(close)
+     fb3:	b8 15 00 00 00       	mov    $0x15,%eax
+     fb8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     fbf:	74 09                	je     fca <close+0x17>
+     fc1:	89 e1                	mov    %esp,%ecx
+     fc3:	ba cc 0f 00 00       	mov    $0xfcc,%edx
+     fc8:	0f 34                	sysenter
+     fca:	cd 40                	int    $0x40
+     fcc:	c3                   	ret
+
+00000fcd <kill>:
+SYSCALL(kill)
+     fcd:	b8 06 00 00 00       	mov    $0x6,%eax
+     fd2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     fd9:	74 09                	je     fe4 <kill+0x17>
+     fdb:	89 e1                	mov    %esp,%ecx
+     fdd:	ba e6 0f 00 00       	mov    $0xfe6,%edx
+     fe2:	0f 34                	sysenter
+     fe4:	cd 40                	int    $0x40
+     fe6:	c3                   	ret
+
+00000fe7 <exec>:
+SYSCALL(exec)
+     fe7:	b8 07 00 00 00       	mov    $0x7,%eax
+     fec:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     ff3:	74 09                	je     ffe <exec+0x17>
+     ff5:	89 e1                	mov    %esp,%ecx
+     ff7:	ba 00 10 00 00       	mov    $0x1000,%edx
+     ffc:	0f 34                	sysenter
+     ffe:	cd 40                	int    $0x40
+    1000:	c3                   	ret
+
+00001001 <open>:
+SYSCALL(open)
+    1001:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1006:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    100d:	74 09                	je     1018 <open+0x17>
+    100f:	89 e1                	mov    %esp,%ecx
+    1011:	ba 1a 10 00 00       	mov    $0x101a,%edx
+    1016:	0f 34                	sysenter
+    1018:	cd 40                	int    $0x40
+    101a:	c3                   	ret
+
+0000101b <mknod>:
+SYSCALL(mknod)
+    101b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1020:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    1027:	74 09                	je     1032 <mknod+0x17>
+    1029:	89 e1                	mov    %esp,%ecx
+    102b:	ba 34 10 00 00       	mov    $0x1034,%edx
+    1030:	0f 34                	sysenter
+    1032:	cd 40                	int    $0x40
+    1034:	c3                   	ret
+
+00001035 <unlink>:
+SYSCALL(unlink)
+    1035:	b8 12 00 00 00       	mov    $0x12,%eax
+    103a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    1041:	74 09                	je     104c <unlink+0x17>
+    1043:	89 e1                	mov    %esp,%ecx
+    1045:	ba 4e 10 00 00       	mov    $0x104e,%edx
+    104a:	0f 34                	sysenter
+    104c:	cd 40                	int    $0x40
+    104e:	c3                   	ret
+
+0000104f <fstat>:
+SYSCALL(fstat)
+    104f:	b8 08 00 00 00       	mov    $0x8,%eax
+    1054:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    105b:	74 09                	je     1066 <fstat+0x17>
+    105d:	89 e1                	mov    %esp,%ecx
+    105f:	ba 68 10 00 00       	mov    $0x1068,%edx
+    1064:	0f 34                	sysenter
+    1066:	cd 40                	int    $0x40
+    1068:	c3                   	ret
+
+00001069 <link>:
+SYSCALL(link)
+    1069:	b8 13 00 00 00       	mov    $0x13,%eax
+    106e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    1075:	74 09                	je     1080 <link+0x17>
+    1077:	89 e1                	mov    %esp,%ecx
+    1079:	ba 82 10 00 00       	mov    $0x1082,%edx
+    107e:	0f 34                	sysenter
+    1080:	cd 40                	int    $0x40
+    1082:	c3                   	ret
+
+00001083 <mkdir>:
+SYSCALL(mkdir)
+    1083:	b8 14 00 00 00       	mov    $0x14,%eax
+    1088:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    108f:	74 09                	je     109a <mkdir+0x17>
+    1091:	89 e1                	mov    %esp,%ecx
+    1093:	ba 9c 10 00 00       	mov    $0x109c,%edx
+    1098:	0f 34                	sysenter
+    109a:	cd 40                	int    $0x40
+    109c:	c3                   	ret
+
+0000109d <chdir>:
+SYSCALL(chdir)
+    109d:	b8 09 00 00 00       	mov    $0x9,%eax
+    10a2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    10a9:	74 09                	je     10b4 <chdir+0x17>
+    10ab:	89 e1                	mov    %esp,%ecx
+    10ad:	ba b6 10 00 00       	mov    $0x10b6,%edx
+    10b2:	0f 34                	sysenter
+    10b4:	cd 40                	int    $0x40
+    10b6:	c3                   	ret
+
+000010b7 <dup>:
+SYSCALL(dup)
+    10b7:	b8 0a 00 00 00       	mov    $0xa,%eax
+    10bc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    10c3:	74 09                	je     10ce <dup+0x17>
+    10c5:	89 e1                	mov    %esp,%ecx
+    10c7:	ba d0 10 00 00       	mov    $0x10d0,%edx
+    10cc:	0f 34                	sysenter
+    10ce:	cd 40                	int    $0x40
+    10d0:	c3                   	ret
+
+000010d1 <sbrk>:
+SYSCALL(sbrk)
+    10d1:	b8 0c 00 00 00       	mov    $0xc,%eax
+    10d6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    10dd:	74 09                	je     10e8 <sbrk+0x17>
+    10df:	89 e1                	mov    %esp,%ecx
+    10e1:	ba ea 10 00 00       	mov    $0x10ea,%edx
+    10e6:	0f 34                	sysenter
+    10e8:	cd 40                	int    $0x40
+    10ea:	c3                   	ret
+
+000010eb <sleep>:
+SYSCALL(sleep)
+    10eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+    10f0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    10f7:	74 09                	je     1102 <sleep+0x17>
+    10f9:	89 e1                	mov    %esp,%ecx
+    10fb:	ba 04 11 00 00       	mov    $0x1104,%edx
+    1100:	0f 34                	sysenter
+    1102:	cd 40                	int    $0x40
+    1104:	c3                   	ret
+
+00001105 <sigprocmask>:
+SYSCALL(sigprocmask)
+    1105:	b8 16 00 00 00       	mov    $0x16,%eax
+    110a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    1111:	74 09                	je     111c <sigprocmask+0x17>
+    1113:	89 e1                	mov    %esp,%ecx
+    1115:	ba 1e 11 00 00       	mov    $0x111e,%edx
+    111a:	0f 34                	sysenter
+    111c:	cd 40                	int    $0x40
+    111e:	c3                   	ret
+
+0000111f <sigaction>:
+SYSCALL(sigaction)
+    111f:	b8 17 00 00 00       	mov    $0x17,%eax
+    1124:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    112b:	74 09                	je     1136 <sigaction+0x17>
+    112d:	89 e1                	mov    %esp,%ecx
+    112f:	ba 38 11 00 00       	mov    $0x1138,%edx
+    1134:	0f 34                	sysenter
+    1136:	cd 40                	int    $0x40
+    1138:	c3                   	ret
+
+00001139 <sigret>:
+SYSCALL(sigret)
+    1139:	b8 18 00 00 00       	mov    $0x18,%eax
+    113e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    1145:	74 09                	je     1150 <sigret+0x17>
+    1147:	89 e1                	mov    %esp,%ecx
+    1149:	ba 52 11 00 00       	mov    $0x1152,%edx
+    114e:	0f 34                	sysenter
+    1150:	cd 40                	int    $0x40
+    1152:	c3                   	ret
+
+00001153 <traceread>:
+SYSCALL(traceread)
+    1153:	b8 19 00 00 00       	mov    $0x19,%eax
+    1158:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    115f:	74 09                	je     116a <traceread+0x17>
+    1161:	89 e1                	mov    %esp,%ecx
+    1163:	ba 6c 11 00 00       	mov    $0x116c,%edx
+    1168:	0f 34                	sysenter
+    116a:	cd 40                	int    $0x40
+    116c:	c3                   	ret
+
+0000116d <sigqueue>:
+SYSCALL(sigqueue)
+    116d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1172:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    1179:	74 09                	je     1184 <sigqueue+0x17>
+    117b:	89 e1                	mov    %esp,%ecx
+    117d:	ba 86 11 00 00       	mov    $0x1186,%edx
+    1182:	0f 34                	sysenter
+    1184:	cd 40                	int    $0x40
+    1186:	c3                   	ret
+
+00001187 <signalfd>:
+SYSCALL(signalfd)
+    1187:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    118c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    1193:	74 09                	je     119e <signalfd+0x17>
+    1195:	89 e1                	mov    %esp,%ecx
+    1197:	ba a0 11 00 00       	mov    $0x11a0,%edx
+    119c:	0f 34                	sysenter
+    119e:	cd 40                	int    $0x40
+    11a0:	c3                   	ret
+
+000011a1 <sigwait>:
+SYSCALL(sigwait)
+    11a1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    11a6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    11ad:	74 09                	je     11b8 <sigwait+0x17>
+    11af:	89 e1                	mov    %esp,%ecx
+    11b1:	ba ba 11 00 00       	mov    $0x11ba,%edx
+    11b6:	0f 34                	sysenter
+    11b8:	cd 40                	int    $0x40
+    11ba:	c3                   	ret
+
+000011bb <sigsuspend>:
+SYSCALL(sigsuspend)
+    11bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    11c0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    11c7:	74 09                	je     11d2 <sigsuspend+0x17>
+    11c9:	89 e1                	mov    %esp,%ecx
+    11cb:	ba d4 11 00 00       	mov    $0x11d4,%edx
+    11d0:	0f 34                	sysenter
+    11d2:	cd 40                	int    $0x40
+    11d4:	c3                   	ret
+
+000011d5 <waitpid>:
+SYSCALL(waitpid)
+    11d5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    11da:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    11e1:	74 09                	je     11ec <waitpid+0x17>
+    11e3:	89 e1                	mov    %esp,%ecx
+    11e5:	ba ee 11 00 00       	mov    $0x11ee,%edx
+    11ea:	0f 34                	sysenter
+    11ec:	cd 40                	int    $0x40
+    11ee:	c3                   	ret
+
+000011ef <setitimer>:
+SYSCALL(setitimer)
+    11ef:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    11f4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    11fb:	74 09                	je     1206 <setitimer+0x17>
+    11fd:	89 e1                	mov    %esp,%ecx
+    11ff:	ba 08 12 00 00       	mov    $0x1208,%edx
+    1204:	0f 34                	sysenter
+    1206:	cd 40                	int    $0x40
+    1208:	c3                   	ret
+
+00001209 <nanosleep>:
+SYSCALL(nanosleep)
+    1209:	b8 21 00 00 00       	mov    $0x21,%eax
+    120e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    1215:	74 09                	je     1220 <nanosleep+0x17>
+    1217:	89 e1                	mov    %esp,%ecx
+    1219:	ba 22 12 00 00       	mov    $0x1222,%edx
+    121e:	0f 34                	sysenter
+    1220:	cd 40                	int    $0x40
+    1222:	c3                   	ret
+
+00001223 <mmap>:
+SYSCALL(mmap)
+    1223:	b8 22 00 00 00       	mov    $0x22,%eax
+    1228:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    122f:	74 09                	je     123a <mmap+0x17>
+    1231:	89 e1                	mov    %esp,%ecx
+    1233:	ba 3c 12 00 00       	mov    $0x123c,%edx
+    1238:	0f 34                	sysenter
+    123a:	cd 40                	int    $0x40
+    123c:	c3                   	ret
+
+0000123d <munmap>:
+SYSCALL(munmap)
+    123d:	b8 23 00 00 00       	mov    $0x23,%eax
+    1242:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    1249:	74 09                	je     1254 <munmap+0x17>
+    124b:	89 e1                	mov    %esp,%ecx
+    124d:	ba 56 12 00 00       	mov    $0x1256,%edx
+    1252:	0f 34                	sysenter
+    1254:	cd 40                	int    $0x40
+    1256:	c3                   	ret
+
+00001257 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+    1257:	b8 0b 00 00 00       	mov    $0xb,%eax
+    125c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    1263:	74 09                	je     126e <getpid_syscall+0x17>
+    1265:	89 e1                	mov    %esp,%ecx
+    1267:	ba 70 12 00 00       	mov    $0x1270,%edx
+    126c:	0f 34                	sysenter
+    126e:	cd 40                	int    $0x40
+    1270:	c3                   	ret
+
+00001271 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+    1271:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1276:	cd 40                	int    $0x40
+    1278:	c3                   	ret
+    1279:	66 90                	xchg   %ax,%ax
+    127b:	66 90                	xchg   %ax,%ax
+    127d:	66 90                	xchg   %ax,%ax
+    127f:	90                   	nop
+
+00001280 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	57                   	push   %edi
+    1284:	56                   	push   %esi
+    1285:	53                   	push   %ebx
+    1286:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1288:	89 d1                	mov    %edx,%ecx
+{
+    128a:	83 ec 3c             	sub    $0x3c,%esp
+    128d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1290:	85 d2                	test   %edx,%edx
+    1292:	0f 89 80 00 00 00    	jns    1318 <printint+0x98>
+    1298:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    129c:	74 7a                	je     1318 <printint+0x98>
+    x = -xx;
+    129e:	f7 d9                	neg    %ecx
+    neg = 1;
+    12a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    12a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    12a8:	31 f6                	xor    %esi,%esi
+    12aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    12b0:	89 c8                	mov    %ecx,%eax
+    12b2:	31 d2                	xor    %edx,%edx
+    12b4:	89 f7                	mov    %esi,%edi
+    12b6:	f7 f3                	div    %ebx
+    12b8:	8d 76 01             	lea    0x1(%esi),%esi
+    12bb:	0f b6 92 90 17 00 00 	movzbl 0x1790(%edx),%edx
+    12c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    12c6:	89 ca                	mov    %ecx,%edx
+    12c8:	89 c1                	mov    %eax,%ecx
+    12ca:	39 da                	cmp    %ebx,%edx
+    12cc:	73 e2                	jae    12b0 <printint+0x30>
+  if(neg)
+    12ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    12d1:	85 c0                	test   %eax,%eax
+    12d3:	74 07                	je     12dc <printint+0x5c>
+    buf[i++] = '-';
+    12d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    12da:	89 f7                	mov    %esi,%edi
+    12dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    12df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    12e2:	01 df                	add    %ebx,%edi
+    12e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    12e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    12eb:	83 ec 04             	sub    $0x4,%esp
+    12ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+    12f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    12f4:	6a 01                	push   $0x1
+    12f6:	50                   	push   %eax
+    12f7:	56                   	push   %esi
+    12f8:	e8 9c fc ff ff       	call   f99 <write>
+  while(--i >= 0)
+    12fd:	89 f8                	mov    %edi,%eax
+    12ff:	83 c4 10             	add    $0x10,%esp
+    1302:	83 ef 01             	sub    $0x1,%edi
+    1305:	39 d8                	cmp    %ebx,%eax
+    1307:	75 df                	jne    12e8 <printint+0x68>
+}
+    1309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    130c:	5b                   	pop    %ebx
+    130d:	5e                   	pop    %esi
+    130e:	5f                   	pop    %edi
+    130f:	5d                   	pop    %ebp
+    1310:	c3                   	ret
+    1311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1318:	31 c0                	xor    %eax,%eax
+    131a:	eb 89                	jmp    12a5 <printint+0x25>
+    131c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001320 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1320:	55                   	push   %ebp
+    1321:	89 e5                	mov    %esp,%ebp
+    1323:	57                   	push   %edi
+    1324:	56                   	push   %esi
+    1325:	53                   	push   %ebx
+    1326:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1329:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    132c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    132f:	0f b6 1e             	movzbl (%esi),%ebx
+    1332:	83 c6 01             	add    $0x1,%esi
+    1335:	84 db                	test   %bl,%bl
+    1337:	74 67                	je     13a0 <printf+0x80>
+    1339:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    133c:	31 d2                	xor    %edx,%edx
+    133e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1341:	eb 34                	jmp    1377 <printf+0x57>
+    1343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1347:	90                   	nop
+    1348:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    134b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1350:	83 f8 25             	cmp    $0x25,%eax
+    1353:	74 18                	je     136d <printf+0x4d>
+  write(fd, &c, 1);
+    1355:	83 ec 04             	sub    $0x4,%esp
+    1358:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    135b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    135e:	6a 01                	push   $0x1
+    1360:	50                   	push   %eax
+    1361:	57                   	push   %edi
+    1362:	e8 32 fc ff ff       	call   f99 <write>
+    1367:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    136a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    136d:	0f b6 1e             	movzbl (%esi),%ebx
+    1370:	83 c6 01             	add    $0x1,%esi
+    1373:	84 db                	test   %bl,%bl
+    1375:	74 29                	je     13a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1377:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    137a:	85 d2                	test   %edx,%edx
+    137c:	74 ca                	je     1348 <printf+0x28>
+      }
+    } else if(state == '%'){
+    137e:	83 fa 25             	cmp    $0x25,%edx
+    1381:	75 ea                	jne    136d <printf+0x4d>
+      if(c == 'd'){
+    1383:	83 f8 25             	cmp    $0x25,%eax
+    1386:	0f 84 24 01 00 00    	je     14b0 <printf+0x190>
+    138c:	83 e8 63             	sub    $0x63,%eax
+    138f:	83 f8 15             	cmp    $0x15,%eax
+    1392:	77 1c                	ja     13b0 <printf+0x90>
+    1394:	ff 24 85 38 17 00 00 	jmp    *0x1738(,%eax,4)
+    139b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    139f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    13a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13a3:	5b                   	pop    %ebx
+    13a4:	5e                   	pop    %esi
+    13a5:	5f                   	pop    %edi
+    13a6:	5d                   	pop    %ebp
+    13a7:	c3                   	ret
+    13a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13af:	90                   	nop
+  write(fd, &c, 1);
+    13b0:	83 ec 04             	sub    $0x4,%esp
+    13b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    13b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    13ba:	6a 01                	push   $0x1
+    13bc:	52                   	push   %edx
+    13bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    13c0:	57                   	push   %edi
+    13c1:	e8 d3 fb ff ff       	call   f99 <write>
+    13c6:	83 c4 0c             	add    $0xc,%esp
+    13c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    13cc:	6a 01                	push   $0x1
+    13ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    13d1:	52                   	push   %edx
+    13d2:	57                   	push   %edi
+    13d3:	e8 c1 fb ff ff       	call   f99 <write>
+        putc(fd, c);
+    13d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13db:	31 d2                	xor    %edx,%edx
+    13dd:	eb 8e                	jmp    136d <printf+0x4d>
+    13df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    13e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    13e3:	83 ec 0c             	sub    $0xc,%esp
+    13e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    13eb:	8b 13                	mov    (%ebx),%edx
+    13ed:	6a 00                	push   $0x0
+    13ef:	89 f8                	mov    %edi,%eax
+        ap++;
+    13f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    13f4:	e8 87 fe ff ff       	call   1280 <printint>
+        ap++;
+    13f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    13fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13ff:	31 d2                	xor    %edx,%edx
+    1401:	e9 67 ff ff ff       	jmp    136d <printf+0x4d>
+    1406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    140d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1410:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1413:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1415:	83 c0 04             	add    $0x4,%eax
+    1418:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    141b:	85 db                	test   %ebx,%ebx
+    141d:	0f 84 9d 00 00 00    	je     14c0 <printf+0x1a0>
+        while(*s != 0){
+    1423:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1426:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1428:	84 c0                	test   %al,%al
+    142a:	0f 84 3d ff ff ff    	je     136d <printf+0x4d>
+    1430:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1433:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1436:	89 de                	mov    %ebx,%esi
+    1438:	89 d3                	mov    %edx,%ebx
+    143a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1440:	83 ec 04             	sub    $0x4,%esp
+    1443:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1446:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1449:	6a 01                	push   $0x1
+    144b:	53                   	push   %ebx
+    144c:	57                   	push   %edi
+    144d:	e8 47 fb ff ff       	call   f99 <write>
+        while(*s != 0){
+    1452:	0f b6 06             	movzbl (%esi),%eax
+    1455:	83 c4 10             	add    $0x10,%esp
+    1458:	84 c0                	test   %al,%al
+    145a:	75 e4                	jne    1440 <printf+0x120>
+      state = 0;
+    145c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    145f:	31 d2                	xor    %edx,%edx
+    1461:	e9 07 ff ff ff       	jmp    136d <printf+0x4d>
+    1466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    146d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1470:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1473:	83 ec 0c             	sub    $0xc,%esp
+    1476:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    147b:	8b 13                	mov    (%ebx),%edx
+    147d:	6a 01                	push   $0x1
+    147f:	e9 6b ff ff ff       	jmp    13ef <printf+0xcf>
+    1484:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1488:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    148b:	83 ec 04             	sub    $0x4,%esp
+    148e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1491:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1493:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1496:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1499:	6a 01                	push   $0x1
+    149b:	52                   	push   %edx
+    149c:	57                   	push   %edi
+    149d:	e8 f7 fa ff ff       	call   f99 <write>
+        ap++;
+    14a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    14a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    14a8:	31 d2                	xor    %edx,%edx
+    14aa:	e9 be fe ff ff       	jmp    136d <printf+0x4d>
+    14af:	90                   	nop
+  write(fd, &c, 1);
+    14b0:	83 ec 04             	sub    $0x4,%esp
+    14b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    14b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    14b9:	6a 01                	push   $0x1
+    14bb:	e9 11 ff ff ff       	jmp    13d1 <printf+0xb1>
+    14c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    14c5:	bb 30 17 00 00       	mov    $0x1730,%ebx
+    14ca:	e9 61 ff ff ff       	jmp    1430 <printf+0x110>
+    14cf:	90                   	nop
+
+000014d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    14d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14d1:	a1 44 1e 00 00       	mov    0x1e44,%eax
+{
+    14d6:	89 e5                	mov    %esp,%ebp
+    14d8:	57                   	push   %edi
+    14d9:	56                   	push   %esi
+    14da:	53                   	push   %ebx
+    14db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    14de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    14ec:	39 ca                	cmp    %ecx,%edx
+    14ee:	73 30                	jae    1520 <free+0x50>
+    14f0:	39 c1                	cmp    %eax,%ecx
+    14f2:	72 04                	jb     14f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14f4:	39 c2                	cmp    %eax,%edx
+    14f6:	72 f0                	jb     14e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    14f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    14fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    14fe:	39 f8                	cmp    %edi,%eax
+    1500:	74 2e                	je     1530 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1502:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1505:	8b 42 04             	mov    0x4(%edx),%eax
+    1508:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    150b:	39 f1                	cmp    %esi,%ecx
+    150d:	74 38                	je     1547 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    150f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1511:	5b                   	pop    %ebx
+  freep = p;
+    1512:	89 15 44 1e 00 00    	mov    %edx,0x1e44
+}
+    1518:	5e                   	pop    %esi
+    1519:	5f                   	pop    %edi
+    151a:	5d                   	pop    %ebp
+    151b:	c3                   	ret
+    151c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1520:	39 c1                	cmp    %eax,%ecx
+    1522:	72 d0                	jb     14f4 <free+0x24>
+    1524:	eb c2                	jmp    14e8 <free+0x18>
+    1526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    152d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1530:	03 70 04             	add    0x4(%eax),%esi
+    1533:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1536:	8b 02                	mov    (%edx),%eax
+    1538:	8b 00                	mov    (%eax),%eax
+    153a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    153d:	8b 42 04             	mov    0x4(%edx),%eax
+    1540:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1543:	39 f1                	cmp    %esi,%ecx
+    1545:	75 c8                	jne    150f <free+0x3f>
+    p->s.size += bp->s.size;
+    1547:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    154a:	89 15 44 1e 00 00    	mov    %edx,0x1e44
+    p->s.size += bp->s.size;
+    1550:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1553:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1556:	89 0a                	mov    %ecx,(%edx)
+}
+    1558:	5b                   	pop    %ebx
+    1559:	5e                   	pop    %esi
+    155a:	5f                   	pop    %edi
+    155b:	5d                   	pop    %ebp
+    155c:	c3                   	ret
+    155d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001560 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1560:	55                   	push   %ebp
+    1561:	89 e5                	mov    %esp,%ebp
+    1563:	57                   	push   %edi
+    1564:	56                   	push   %esi
+    1565:	53                   	push   %ebx
+    1566:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1569:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    156c:	8b 15 44 1e 00 00    	mov    0x1e44,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1572:	8d 78 07             	lea    0x7(%eax),%edi
+    1575:	c1 ef 03             	shr    $0x3,%edi
+    1578:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    157b:	85 d2                	test   %edx,%edx
+    157d:	0f 84 8d 00 00 00    	je     1610 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1583:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1585:	8b 48 04             	mov    0x4(%eax),%ecx
+    1588:	39 f9                	cmp    %edi,%ecx
+    158a:	73 64                	jae    15f0 <malloc+0x90>
+  if(nu < 4096)
+    158c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1591:	39 df                	cmp    %ebx,%edi
+    1593:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1596:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    159d:	eb 0a                	jmp    15a9 <malloc+0x49>
+    159f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    15a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    15a2:	8b 48 04             	mov    0x4(%eax),%ecx
+    15a5:	39 f9                	cmp    %edi,%ecx
+    15a7:	73 47                	jae    15f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    15a9:	89 c2                	mov    %eax,%edx
+    15ab:	39 05 44 1e 00 00    	cmp    %eax,0x1e44
+    15b1:	75 ed                	jne    15a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    15b3:	83 ec 0c             	sub    $0xc,%esp
+    15b6:	56                   	push   %esi
+    15b7:	e8 15 fb ff ff       	call   10d1 <sbrk>
+  if(p == (char*)-1)
+    15bc:	83 c4 10             	add    $0x10,%esp
+    15bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15c2:	74 1c                	je     15e0 <malloc+0x80>
+  hp->s.size = nu;
+    15c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    15c7:	83 ec 0c             	sub    $0xc,%esp
+    15ca:	83 c0 08             	add    $0x8,%eax
+    15cd:	50                   	push   %eax
+    15ce:	e8 fd fe ff ff       	call   14d0 <free>
+  return freep;
+    15d3:	8b 15 44 1e 00 00    	mov    0x1e44,%edx
+      if((p = morecore(nunits)) == 0)
+    15d9:	83 c4 10             	add    $0x10,%esp
+    15dc:	85 d2                	test   %edx,%edx
+    15de:	75 c0                	jne    15a0 <malloc+0x40>
+        return 0;
+  }
+}
+    15e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    15e3:	31 c0                	xor    %eax,%eax
+}
+    15e5:	5b                   	pop    %ebx
+    15e6:	5e                   	pop    %esi
+    15e7:	5f                   	pop    %edi
+    15e8:	5d                   	pop    %ebp
+    15e9:	c3                   	ret
+    15ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    15f0:	39 cf                	cmp    %ecx,%edi
+    15f2:	74 4c                	je     1640 <malloc+0xe0>
+        p->s.size -= nunits;
+    15f4:	29 f9                	sub    %edi,%ecx
+    15f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    15f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    15fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    15ff:	89 15 44 1e 00 00    	mov    %edx,0x1e44
+}
+    1605:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1608:	83 c0 08             	add    $0x8,%eax
+}
+    160b:	5b                   	pop    %ebx
+    160c:	5e                   	pop    %esi
+    160d:	5f                   	pop    %edi
+    160e:	5d                   	pop    %ebp
+    160f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1610:	c7 05 44 1e 00 00 48 	movl   $0x1e48,0x1e44
+    1617:	1e 00 00 
+    base.s.size = 0;
+    161a:	b8 48 1e 00 00       	mov    $0x1e48,%eax
+    base.s.ptr = freep = prevp = &base;
+    161f:	c7 05 48 1e 00 00 48 	movl   $0x1e48,0x1e48
+    1626:	1e 00 00 
+    base.s.size = 0;
+    1629:	c7 05 4c 1e 00 00 00 	movl   $0x0,0x1e4c
+    1630:	00 00 00 
+    if(p->s.size >= nunits){
+    1633:	e9 54 ff ff ff       	jmp    158c <malloc+0x2c>
+    1638:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    163f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1640:	8b 08                	mov    (%eax),%ecx
+    1642:	89 0a                	mov    %ecx,(%edx)
+    1644:	eb b9                	jmp    15ff <malloc+0x9f>
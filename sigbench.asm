@@ -0,0 +1,2479 @@
+
+_sigbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "sigbench sigprocmask %d cycles\n", div64(t1 - t0, rounds));
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 68             	sub    $0x68,%esp
+  int rounds;
+
+  rounds = argc > 1 ? atoi(argv[1]) : 1000;
+      14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      17:	8b 41 04             	mov    0x4(%ecx),%eax
+  rounds = argc > 1 ? atoi(argv[1]) : 1000;
+      1a:	0f 8e 26 06 00 00    	jle    646 <main+0x646>
+      20:	83 ec 0c             	sub    $0xc,%esp
+      23:	ff 70 04             	push   0x4(%eax)
+      26:	e8 d5 0a 00 00       	call   b00 <atoi>
+  if(rounds <= 0){
+      2b:	83 c4 10             	add    $0x10,%esp
+  rounds = argc > 1 ? atoi(argv[1]) : 1000;
+      2e:	89 45 a8             	mov    %eax,-0x58(%ebp)
+  if(rounds <= 0){
+      31:	85 c0                	test   %eax,%eax
+      33:	0f 8e 52 06 00 00    	jle    68b <main+0x68b>
+  install(SIGUSR1);
+      39:	e8 a2 08 00 00       	call   8e0 <install.constprop.0>
+  for(i = 0; i < rounds; i++){
+      3e:	31 db                	xor    %ebx,%ebx
+  total = 0;
+      40:	31 f6                	xor    %esi,%esi
+      42:	31 ff                	xor    %edi,%edi
+      44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    got = 0;
+      48:	c7 05 d4 19 00 00 00 	movl   $0x0,0x19d4
+      4f:	00 00 00 
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+      52:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+      54:	89 55 bc             	mov    %edx,-0x44(%ebp)
+      57:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    kill(getpid(), SIGUSR1);
+      5a:	e8 51 0b 00 00       	call   bb0 <getpid>
+      5f:	83 ec 08             	sub    $0x8,%esp
+      62:	6a 0a                	push   $0xa
+      64:	50                   	push   %eax
+      65:	e8 93 0c 00 00       	call   cfd <kill>
+    while(!got)
+      6a:	83 c4 10             	add    $0x10,%esp
+      6d:	8d 76 00             	lea    0x0(%esi),%esi
+      70:	a1 d4 19 00 00       	mov    0x19d4,%eax
+      75:	85 c0                	test   %eax,%eax
+      77:	74 f7                	je     70 <main+0x70>
+    total += handled_at - t0;
+      79:	a1 d8 19 00 00       	mov    0x19d8,%eax
+      7e:	2b 45 b8             	sub    -0x48(%ebp),%eax
+      81:	8b 15 dc 19 00 00    	mov    0x19dc,%edx
+      87:	1b 55 bc             	sbb    -0x44(%ebp),%edx
+      8a:	01 c6                	add    %eax,%esi
+  for(i = 0; i < rounds; i++){
+      8c:	8d 43 01             	lea    0x1(%ebx),%eax
+    total += handled_at - t0;
+      8f:	11 d7                	adc    %edx,%edi
+  for(i = 0; i < rounds; i++){
+      91:	39 45 a8             	cmp    %eax,-0x58(%ebp)
+      94:	74 04                	je     9a <main+0x9a>
+      96:	89 c3                	mov    %eax,%ebx
+      98:	eb ae                	jmp    48 <main+0x48>
+  printf(1, "sigbench kill_to_handler %d cycles\n", div64(total, rounds));
+      9a:	8b 4d a8             	mov    -0x58(%ebp),%ecx
+      9d:	89 fa                	mov    %edi,%edx
+      9f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+      a2:	89 f0                	mov    %esi,%eax
+      a4:	89 5d b8             	mov    %ebx,-0x48(%ebp)
+      a7:	e8 44 07 00 00       	call   7f0 <div64>
+      ac:	83 ec 04             	sub    $0x4,%esp
+      af:	50                   	push   %eax
+      b0:	68 0c 14 00 00       	push   $0x140c
+      b5:	6a 01                	push   $0x1
+      b7:	e8 94 0f 00 00       	call   1050 <printf>
+  install(SIGUSR1);
+      bc:	e8 1f 08 00 00       	call   8e0 <install.constprop.0>
+  parent = getpid();
+      c1:	e8 ea 0a 00 00       	call   bb0 <getpid>
+  got = 0;
+      c6:	c7 05 d4 19 00 00 00 	movl   $0x0,0x19d4
+      cd:	00 00 00 
+  parent = getpid();
+      d0:	89 c6                	mov    %eax,%esi
+  if((child = fork()) == 0){
+      d2:	e8 70 0b 00 00       	call   c47 <fork>
+      d7:	83 c4 10             	add    $0x10,%esp
+      da:	89 c3                	mov    %eax,%ebx
+      dc:	85 c0                	test   %eax,%eax
+      de:	0f 84 e5 05 00 00    	je     6c9 <main+0x6c9>
+  start = uptime();
+      e4:	e8 d7 0a 00 00       	call   bc0 <uptime>
+  for(i = 0; i < rounds; i++){
+      e9:	31 ff                	xor    %edi,%edi
+      eb:	89 45 b0             	mov    %eax,-0x50(%ebp)
+      ee:	89 fe                	mov    %edi,%esi
+      f0:	8b 7d b8             	mov    -0x48(%ebp),%edi
+      f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      f7:	90                   	nop
+    kill(child, SIGUSR1);
+      f8:	83 ec 08             	sub    $0x8,%esp
+      fb:	6a 0a                	push   $0xa
+      fd:	53                   	push   %ebx
+      fe:	e8 fa 0b 00 00       	call   cfd <kill>
+    while(!got)
+     103:	83 c4 10             	add    $0x10,%esp
+     106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     10d:	8d 76 00             	lea    0x0(%esi),%esi
+     110:	a1 d4 19 00 00       	mov    0x19d4,%eax
+     115:	85 c0                	test   %eax,%eax
+     117:	74 f7                	je     110 <main+0x110>
+    got = 0;
+     119:	c7 05 d4 19 00 00 00 	movl   $0x0,0x19d4
+     120:	00 00 00 
+  for(i = 0; i < rounds; i++){
+     123:	8d 46 01             	lea    0x1(%esi),%eax
+     126:	39 fe                	cmp    %edi,%esi
+     128:	74 04                	je     12e <main+0x12e>
+     12a:	89 c6                	mov    %eax,%esi
+     12c:	eb ca                	jmp    f8 <main+0xf8>
+  end = uptime();
+     12e:	8b 75 b0             	mov    -0x50(%ebp),%esi
+     131:	e8 8a 0a 00 00       	call   bc0 <uptime>
+     136:	89 c3                	mov    %eax,%ebx
+  wait();
+     138:	e8 3e 0b 00 00       	call   c7b <wait>
+    end++;
+     13d:	39 de                	cmp    %ebx,%esi
+     13f:	8d 46 01             	lea    0x1(%esi),%eax
+     142:	0f 44 d8             	cmove  %eax,%ebx
+         rounds * 100 / (end - start));
+     145:	6b 45 a0 64          	imul   $0x64,-0x60(%ebp),%eax
+  printf(1, "sigbench pingpong_rate %d roundtrips/s\n",
+     149:	83 ec 04             	sub    $0x4,%esp
+         rounds * 100 / (end - start));
+     14c:	29 f3                	sub    %esi,%ebx
+  printf(1, "sigbench pingpong_rate %d roundtrips/s\n",
+     14e:	99                   	cltd
+         rounds * 100 / (end - start));
+     14f:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  printf(1, "sigbench pingpong_rate %d roundtrips/s\n",
+     152:	f7 fb                	idiv   %ebx
+     154:	50                   	push   %eax
+     155:	68 30 14 00 00       	push   $0x1430
+     15a:	6a 01                	push   $0x1
+     15c:	e8 ef 0e 00 00       	call   1050 <printf>
+  sigprocmask(set);
+     161:	c7 04 24 00 04 00 00 	movl   $0x400,(%esp)
+     168:	e8 c8 0c 00 00       	call   e35 <sigprocmask>
+  parent = getpid();
+     16d:	e8 3e 0a 00 00       	call   bb0 <getpid>
+     172:	89 c6                	mov    %eax,%esi
+  if((child = fork()) == 0){
+     174:	e8 ce 0a 00 00       	call   c47 <fork>
+     179:	83 c4 10             	add    $0x10,%esp
+     17c:	89 c3                	mov    %eax,%ebx
+     17e:	85 c0                	test   %eax,%eax
+     180:	0f 84 ab 05 00 00    	je     731 <main+0x731>
+  start = uptime();
+     186:	e8 35 0a 00 00       	call   bc0 <uptime>
+  for(i = 0; i < rounds; i++){
+     18b:	31 f6                	xor    %esi,%esi
+     18d:	89 45 ac             	mov    %eax,-0x54(%ebp)
+     190:	89 f7                	mov    %esi,%edi
+     192:	8b 75 b8             	mov    -0x48(%ebp),%esi
+     195:	8d 76 00             	lea    0x0(%esi),%esi
+    kill(child, SIGUSR1);
+     198:	83 ec 08             	sub    $0x8,%esp
+     19b:	6a 0a                	push   $0xa
+     19d:	53                   	push   %ebx
+     19e:	e8 5a 0b 00 00       	call   cfd <kill>
+    sigwait(set);
+     1a3:	c7 04 24 00 04 00 00 	movl   $0x400,(%esp)
+     1aa:	e8 22 0d 00 00       	call   ed1 <sigwait>
+  for(i = 0; i < rounds; i++){
+     1af:	89 f8                	mov    %edi,%eax
+     1b1:	83 c4 10             	add    $0x10,%esp
+     1b4:	83 c7 01             	add    $0x1,%edi
+     1b7:	39 f0                	cmp    %esi,%eax
+     1b9:	75 dd                	jne    198 <main+0x198>
+  end = uptime();
+     1bb:	8b 7d ac             	mov    -0x54(%ebp),%edi
+     1be:	e8 fd 09 00 00       	call   bc0 <uptime>
+     1c3:	89 c3                	mov    %eax,%ebx
+  wait();
+     1c5:	e8 b1 0a 00 00       	call   c7b <wait>
+  sigprocmask(0);
+     1ca:	83 ec 0c             	sub    $0xc,%esp
+     1cd:	6a 00                	push   $0x0
+     1cf:	e8 61 0c 00 00       	call   e35 <sigprocmask>
+  if(end == start)
+     1d4:	83 c4 0c             	add    $0xc,%esp
+    end++;
+     1d7:	8d 47 01             	lea    0x1(%edi),%eax
+     1da:	39 fb                	cmp    %edi,%ebx
+     1dc:	0f 44 d8             	cmove  %eax,%ebx
+  printf(1, "sigbench sigwait_pingpong_rate %d roundtrips/s\n",
+     1df:	8b 45 b0             	mov    -0x50(%ebp),%eax
+         rounds * 100 / (end - start));
+     1e2:	89 d9                	mov    %ebx,%ecx
+  printf(1, "sigbench sigwait_pingpong_rate %d roundtrips/s\n",
+     1e4:	99                   	cltd
+         rounds * 100 / (end - start));
+     1e5:	29 f9                	sub    %edi,%ecx
+  printf(1, "sigbench sigwait_pingpong_rate %d roundtrips/s\n",
+     1e7:	f7 f9                	idiv   %ecx
+     1e9:	50                   	push   %eax
+     1ea:	68 58 14 00 00       	push   $0x1458
+     1ef:	6a 01                	push   $0x1
+     1f1:	e8 5a 0e 00 00       	call   1050 <printf>
+  }
+
+  self_latency(rounds);
+  pingpong(rounds);
+  waitpingpong(rounds);
+  resume_latency(rounds < 50 ? rounds : 50);
+     1f6:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+     1f9:	b8 32 00 00 00       	mov    $0x32,%eax
+     1fe:	39 c1                	cmp    %eax,%ecx
+     200:	0f 4e c1             	cmovle %ecx,%eax
+     203:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  if(pipe(fds) < 0){
+     206:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     209:	89 04 24             	mov    %eax,(%esp)
+     20c:	e8 84 0a 00 00       	call   c95 <pipe>
+     211:	83 c4 10             	add    $0x10,%esp
+     214:	85 c0                	test   %eax,%eax
+     216:	0f 88 45 05 00 00    	js     761 <main+0x761>
+  if((child = fork()) == 0){
+     21c:	e8 26 0a 00 00       	call   c47 <fork>
+     221:	89 45 b0             	mov    %eax,-0x50(%ebp)
+     224:	85 c0                	test   %eax,%eax
+     226:	0f 84 4f 05 00 00    	je     77b <main+0x77b>
+  close(fds[1]);
+     22c:	83 ec 0c             	sub    $0xc,%esp
+     22f:	ff 75 e4             	push   -0x1c(%ebp)
+  for(i = 0; i < rounds; i++){
+     232:	31 db                	xor    %ebx,%ebx
+  total = 0;
+     234:	31 f6                	xor    %esi,%esi
+     236:	31 ff                	xor    %edi,%edi
+  close(fds[1]);
+     238:	e8 a6 0a 00 00       	call   ce3 <close>
+  for(i = 0; i < rounds; i++){
+     23d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  close(fds[1]);
+     240:	83 c4 10             	add    $0x10,%esp
+     243:	89 45 ac             	mov    %eax,-0x54(%ebp)
+     246:	eb 24                	jmp    26c <main+0x26c>
+     248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24f:	90                   	nop
+    total += t1 - t0;
+     250:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     253:	2b 45 c0             	sub    -0x40(%ebp),%eax
+     256:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     259:	1b 55 c4             	sbb    -0x3c(%ebp),%edx
+     25c:	01 c6                	add    %eax,%esi
+     25e:	11 d7                	adc    %edx,%edi
+  for(i = 0; i < rounds; i++){
+     260:	83 c3 01             	add    $0x1,%ebx
+     263:	39 5d a4             	cmp    %ebx,-0x5c(%ebp)
+     266:	0f 84 eb 03 00 00    	je     657 <main+0x657>
+    sleep(1);  // let the child reach SIGSTOP
+     26c:	83 ec 0c             	sub    $0xc,%esp
+     26f:	6a 01                	push   $0x1
+     271:	e8 a5 0b 00 00       	call   e1b <sleep>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     276:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+     278:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     27b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    kill(child, SIGCONT);
+     27e:	59                   	pop    %ecx
+     27f:	58                   	pop    %eax
+     280:	6a 13                	push   $0x13
+     282:	ff 75 b0             	push   -0x50(%ebp)
+     285:	e8 73 0a 00 00       	call   cfd <kill>
+    if(read(fds[0], &t1, sizeof(t1)) != sizeof(t1))
+     28a:	83 c4 0c             	add    $0xc,%esp
+     28d:	6a 08                	push   $0x8
+     28f:	ff 75 ac             	push   -0x54(%ebp)
+     292:	ff 75 e0             	push   -0x20(%ebp)
+     295:	e8 15 0a 00 00       	call   caf <read>
+     29a:	83 c4 10             	add    $0x10,%esp
+     29d:	83 f8 08             	cmp    $0x8,%eax
+     2a0:	74 ae                	je     250 <main+0x250>
+  close(fds[0]);
+     2a2:	83 ec 0c             	sub    $0xc,%esp
+     2a5:	ff 75 e0             	push   -0x20(%ebp)
+     2a8:	e8 36 0a 00 00       	call   ce3 <close>
+  wait();
+     2ad:	e8 c9 09 00 00       	call   c7b <wait>
+  if(i > 0)
+     2b2:	83 c4 10             	add    $0x10,%esp
+     2b5:	85 db                	test   %ebx,%ebx
+     2b7:	0f 85 ad 03 00 00    	jne    66a <main+0x66a>
+  act.sa_handler = (void (*)(int))ordered;
+     2bd:	c7 45 e0 a0 08 00 00 	movl   $0x8a0,-0x20(%ebp)
+  mask = 0;
+     2c4:	31 ff                	xor    %edi,%edi
+  for(j = 0; j < n; j++){
+     2c6:	31 f6                	xor    %esi,%esi
+  act.sigmask = 0;
+     2c8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  for(j = 0; j < n; j++){
+     2cf:	90                   	nop
+    sigaction(sigs[j], &act, 0);
+     2d0:	8b 1c b5 88 15 00 00 	mov    0x1588(,%esi,4),%ebx
+     2d7:	83 ec 04             	sub    $0x4,%esp
+     2da:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  for(j = 0; j < n; j++){
+     2dd:	83 c6 01             	add    $0x1,%esi
+    sigaction(sigs[j], &act, 0);
+     2e0:	6a 00                	push   $0x0
+     2e2:	50                   	push   %eax
+     2e3:	53                   	push   %ebx
+     2e4:	e8 66 0b 00 00       	call   e4f <sigaction>
+    mask |= 1 << sigs[j];
+     2e9:	b8 01 00 00 00       	mov    $0x1,%eax
+     2ee:	89 d9                	mov    %ebx,%ecx
+  for(j = 0; j < n; j++){
+     2f0:	83 c4 10             	add    $0x10,%esp
+    mask |= 1 << sigs[j];
+     2f3:	d3 e0                	shl    %cl,%eax
+     2f5:	09 c7                	or     %eax,%edi
+  for(j = 0; j < n; j++){
+     2f7:	83 fe 05             	cmp    $0x5,%esi
+     2fa:	75 d4                	jne    2d0 <main+0x2d0>
+  for(i = 0; i < rounds; i++){
+     2fc:	31 f6                	xor    %esi,%esi
+  total = 0;
+     2fe:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%ebp)
+     305:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+     30c:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     30f:	90                   	nop
+    sigprocmask(mask);
+     310:	83 ec 0c             	sub    $0xc,%esp
+    for(j = n - 1; j > 0; j--)
+     313:	bb 04 00 00 00       	mov    $0x4,%ebx
+    sigprocmask(mask);
+     318:	57                   	push   %edi
+     319:	e8 17 0b 00 00       	call   e35 <sigprocmask>
+    sigqueue(getpid(), SIGUSR1, 1);
+     31e:	e8 8d 08 00 00       	call   bb0 <getpid>
+     323:	83 c4 0c             	add    $0xc,%esp
+     326:	6a 01                	push   $0x1
+     328:	6a 0a                	push   $0xa
+     32a:	50                   	push   %eax
+     32b:	e8 6d 0b 00 00       	call   e9d <sigqueue>
+    sigqueue(getpid(), SIGUSR1, 2);
+     330:	e8 7b 08 00 00       	call   bb0 <getpid>
+     335:	83 c4 0c             	add    $0xc,%esp
+     338:	6a 02                	push   $0x2
+     33a:	6a 0a                	push   $0xa
+     33c:	50                   	push   %eax
+     33d:	e8 5b 0b 00 00       	call   e9d <sigqueue>
+     342:	83 c4 10             	add    $0x10,%esp
+      kill(getpid(), sigs[j]);
+     345:	8b 34 9d 88 15 00 00 	mov    0x1588(,%ebx,4),%esi
+     34c:	e8 5f 08 00 00       	call   bb0 <getpid>
+     351:	83 ec 08             	sub    $0x8,%esp
+     354:	56                   	push   %esi
+     355:	50                   	push   %eax
+     356:	e8 a2 09 00 00       	call   cfd <kill>
+    for(j = n - 1; j > 0; j--)
+     35b:	83 c4 10             	add    $0x10,%esp
+     35e:	83 eb 01             	sub    $0x1,%ebx
+     361:	75 e2                	jne    345 <main+0x345>
+    count = 0;
+     363:	c7 05 d0 19 00 00 00 	movl   $0x0,0x19d0
+     36a:	00 00 00 
+    lastkey = 0;
+     36d:	c7 05 cc 19 00 00 00 	movl   $0x0,0x19cc
+     374:	00 00 00 
+    inorder = 1;
+     377:	c7 05 c8 19 00 00 01 	movl   $0x1,0x19c8
+     37e:	00 00 00 
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     381:	0f 31                	rdtsc
+    sigprocmask(0);
+     383:	83 ec 0c             	sub    $0xc,%esp
+  return ((uint64)hi << 32) | lo;
+     386:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     389:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     38c:	6a 00                	push   $0x0
+     38e:	e8 a2 0a 00 00       	call   e35 <sigprocmask>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     393:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+     395:	89 55 cc             	mov    %edx,-0x34(%ebp)
+    total += rdtsc() - t0;
+     398:	8b 55 cc             	mov    -0x34(%ebp),%edx
+     39b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     39e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     3a1:	2b 45 d0             	sub    -0x30(%ebp),%eax
+     3a4:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+     3a7:	01 45 b0             	add    %eax,-0x50(%ebp)
+    if(count != n + 1 || !inorder){
+     3aa:	a1 d0 19 00 00       	mov    0x19d0,%eax
+    total += rdtsc() - t0;
+     3af:	11 55 b4             	adc    %edx,-0x4c(%ebp)
+    if(count != n + 1 || !inorder){
+     3b2:	83 c4 10             	add    $0x10,%esp
+     3b5:	83 f8 06             	cmp    $0x6,%eax
+     3b8:	0f 85 33 03 00 00    	jne    6f1 <main+0x6f1>
+     3be:	a1 c8 19 00 00       	mov    0x19c8,%eax
+     3c3:	85 c0                	test   %eax,%eax
+     3c5:	0f 84 26 03 00 00    	je     6f1 <main+0x6f1>
+  for(i = 0; i < rounds; i++){
+     3cb:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+     3ce:	8b 55 b8             	mov    -0x48(%ebp),%edx
+     3d1:	8d 41 01             	lea    0x1(%ecx),%eax
+     3d4:	39 d1                	cmp    %edx,%ecx
+     3d6:	74 08                	je     3e0 <main+0x3e0>
+     3d8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     3db:	e9 30 ff ff ff       	jmp    310 <main+0x310>
+  printf(1, "sigbench burst%d %d cycles\n", n, div64(total, rounds));
+     3e0:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+     3e3:	8b 4d a8             	mov    -0x58(%ebp),%ecx
+     3e6:	8b 45 b0             	mov    -0x50(%ebp),%eax
+     3e9:	e8 02 04 00 00       	call   7f0 <div64>
+     3ee:	50                   	push   %eax
+     3ef:	6a 05                	push   $0x5
+     3f1:	68 d3 13 00 00       	push   $0x13d3
+     3f6:	6a 01                	push   $0x1
+     3f8:	e8 53 0c 00 00       	call   1050 <printf>
+  burst(rounds);
+  reaper(rounds < 200 ? rounds : 200);
+     3fd:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+     400:	b8 c8 00 00 00       	mov    $0xc8,%eax
+     405:	39 c1                	cmp    %eax,%ecx
+     407:	0f 4e c1             	cmovle %ecx,%eax
+  for(i = 0; i < n; i++){
+     40a:	31 f6                	xor    %esi,%esi
+  reaper(rounds < 200 ? rounds : 200);
+     40c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     40f:	89 c7                	mov    %eax,%edi
+  sigprocmask(set);
+     411:	c7 04 24 00 00 10 00 	movl   $0x100000,(%esp)
+     418:	e8 18 0a 00 00       	call   e35 <sigprocmask>
+  start = uptime();
+     41d:	e8 9e 07 00 00       	call   bc0 <uptime>
+     422:	83 c4 10             	add    $0x10,%esp
+     425:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  for(i = 0; i < n; i++){
+     428:	eb 13                	jmp    43d <main+0x43d>
+     42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+     430:	0f 84 f2 02 00 00    	je     728 <main+0x728>
+  for(i = 0; i < n; i++){
+     436:	83 c6 01             	add    $0x1,%esi
+     439:	39 f7                	cmp    %esi,%edi
+     43b:	74 14                	je     451 <main+0x451>
+    if((pid = fork()) < 0)
+     43d:	e8 05 08 00 00       	call   c47 <fork>
+     442:	85 c0                	test   %eax,%eax
+     444:	79 ea                	jns    430 <main+0x430>
+  while(left > 0){
+     446:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     449:	85 f6                	test   %esi,%esi
+     44b:	0f 84 83 02 00 00    	je     6d4 <main+0x6d4>
+     451:	31 ff                	xor    %edi,%edi
+     453:	eb 09                	jmp    45e <main+0x45e>
+     455:	8d 76 00             	lea    0x0(%esi),%esi
+      sum += status;
+     458:	03 7d e0             	add    -0x20(%ebp),%edi
+      left--;
+     45b:	83 ee 01             	sub    $0x1,%esi
+    while((pid = waitpid(-1, &status, WNOHANG)) > 0){
+     45e:	83 ec 04             	sub    $0x4,%esp
+     461:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     464:	6a 01                	push   $0x1
+     466:	50                   	push   %eax
+     467:	6a ff                	push   $0xffffffff
+     469:	e8 97 0a 00 00       	call   f05 <waitpid>
+     46e:	83 c4 10             	add    $0x10,%esp
+     471:	85 c0                	test   %eax,%eax
+     473:	7f e3                	jg     458 <main+0x458>
+    if(pid < 0 || left == 0)
+     475:	78 49                	js     4c0 <main+0x4c0>
+     477:	85 f6                	test   %esi,%esi
+     479:	74 45                	je     4c0 <main+0x4c0>
+    sigwait(set);
+     47b:	83 ec 0c             	sub    $0xc,%esp
+     47e:	68 00 00 10 00       	push   $0x100000
+     483:	e8 49 0a 00 00       	call   ed1 <sigwait>
+  while(left > 0){
+     488:	83 c4 10             	add    $0x10,%esp
+     48b:	85 f6                	test   %esi,%esi
+     48d:	7f cf                	jg     45e <main+0x45e>
+  end = uptime();
+     48f:	e8 2c 07 00 00       	call   bc0 <uptime>
+  sigprocmask(0);
+     494:	83 ec 0c             	sub    $0xc,%esp
+     497:	6a 00                	push   $0x0
+     499:	e8 97 09 00 00       	call   e35 <sigprocmask>
+     49e:	83 c4 10             	add    $0x10,%esp
+    printf(2, "sigbench: reaper lost children (%d left)\n", left);
+     4a1:	50                   	push   %eax
+     4a2:	56                   	push   %esi
+     4a3:	68 d8 14 00 00       	push   $0x14d8
+     4a8:	6a 02                	push   $0x2
+     4aa:	e8 a1 0b 00 00       	call   1050 <printf>
+    exit(1);
+     4af:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     4b6:	e8 a6 07 00 00       	call   c61 <exit>
+     4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+  end = uptime();
+     4c0:	e8 fb 06 00 00       	call   bc0 <uptime>
+  sigprocmask(0);
+     4c5:	83 ec 0c             	sub    $0xc,%esp
+  end = uptime();
+     4c8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  sigprocmask(0);
+     4cb:	6a 00                	push   $0x0
+     4cd:	e8 63 09 00 00       	call   e35 <sigprocmask>
+  if(left != 0 || sum != n * (n - 1) / 2){
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	85 f6                	test   %esi,%esi
+     4d7:	75 c8                	jne    4a1 <main+0x4a1>
+     4d9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     4dc:	8d 41 ff             	lea    -0x1(%ecx),%eax
+     4df:	0f af c1             	imul   %ecx,%eax
+     4e2:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+     4e5:	d1 f8                	sar    %eax
+     4e7:	39 c7                	cmp    %eax,%edi
+     4e9:	75 b6                	jne    4a1 <main+0x4a1>
+    end++;
+     4eb:	8b 55 c8             	mov    -0x38(%ebp),%edx
+     4ee:	39 ca                	cmp    %ecx,%edx
+     4f0:	8d 42 01             	lea    0x1(%edx),%eax
+     4f3:	0f 44 c8             	cmove  %eax,%ecx
+         n * 100 / (end - start));
+     4f6:	6b 45 d0 64          	imul   $0x64,-0x30(%ebp),%eax
+  printf(1, "sigbench sigchld_reap_rate %d children/s\n",
+     4fa:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 2; i++){
+     4fd:	31 ff                	xor    %edi,%edi
+         n * 100 / (end - start));
+     4ff:	29 d1                	sub    %edx,%ecx
+  printf(1, "sigbench sigchld_reap_rate %d children/s\n",
+     501:	99                   	cltd
+     502:	f7 f9                	idiv   %ecx
+     504:	50                   	push   %eax
+     505:	68 04 15 00 00       	push   $0x1504
+     50a:	6a 01                	push   $0x1
+     50c:	e8 3f 0b 00 00       	call   1050 <printf>
+  act.sa_handler = counter;
+     511:	c7 45 d8 90 08 00 00 	movl   $0x890,-0x28(%ebp)
+  act.sigmask = 0;
+     518:	83 c4 10             	add    $0x10,%esp
+     51b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  for(i = 0; i < 2; i++){
+     522:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    sigaction(sigs[i], &act, 0);
+     525:	83 ec 04             	sub    $0x4,%esp
+     528:	6a 00                	push   $0x0
+     52a:	ff 75 ac             	push   -0x54(%ebp)
+     52d:	ff 34 bd 80 15 00 00 	push   0x1580(,%edi,4)
+     534:	e8 16 09 00 00       	call   e4f <sigaction>
+    setitimer(which[i], &v, 0);
+     539:	8b 34 bd 78 15 00 00 	mov    0x1578(,%edi,4),%esi
+     540:	83 c4 0c             	add    $0xc,%esp
+     543:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    v.it_interval = 2;
+     546:	c7 45 e0 02 00 00 00 	movl   $0x2,-0x20(%ebp)
+    v.it_value = 2;
+     54d:	c7 45 e4 02 00 00 00 	movl   $0x2,-0x1c(%ebp)
+    setitimer(which[i], &v, 0);
+     554:	6a 00                	push   $0x0
+     556:	50                   	push   %eax
+     557:	56                   	push   %esi
+    count = 0;
+     558:	c7 05 d0 19 00 00 00 	movl   $0x0,0x19d0
+     55f:	00 00 00 
+    setitimer(which[i], &v, 0);
+     562:	e8 b8 09 00 00       	call   f1f <setitimer>
+    start = uptime();
+     567:	e8 54 06 00 00       	call   bc0 <uptime>
+    while(uptime() - start < ticks)
+     56c:	83 c4 10             	add    $0x10,%esp
+    start = uptime();
+     56f:	89 c3                	mov    %eax,%ebx
+    while(uptime() - start < ticks)
+     571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     578:	e8 43 06 00 00       	call   bc0 <uptime>
+     57d:	29 d8                	sub    %ebx,%eax
+     57f:	83 f8 63             	cmp    $0x63,%eax
+     582:	7e f4                	jle    578 <main+0x578>
+    setitimer(which[i], &v, 0);
+     584:	83 ec 04             	sub    $0x4,%esp
+     587:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    v.it_interval = v.it_value = 0;
+     58a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+     591:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    setitimer(which[i], &v, 0);
+     598:	6a 00                	push   $0x0
+     59a:	50                   	push   %eax
+     59b:	56                   	push   %esi
+     59c:	e8 7e 09 00 00       	call   f1f <setitimer>
+    printf(1, "sigbench %s %d of %d expiries\n", names[i], count, ticks / 2);
+     5a1:	a1 d0 19 00 00       	mov    0x19d0,%eax
+     5a6:	c7 04 24 32 00 00 00 	movl   $0x32,(%esp)
+     5ad:	50                   	push   %eax
+     5ae:	ff 34 bd 70 15 00 00 	push   0x1570(,%edi,4)
+     5b5:	68 30 15 00 00       	push   $0x1530
+     5ba:	6a 01                	push   $0x1
+     5bc:	e8 8f 0a 00 00       	call   1050 <printf>
+  for(i = 0; i < 2; i++){
+     5c1:	83 c4 20             	add    $0x20,%esp
+     5c4:	85 ff                	test   %edi,%edi
+     5c6:	75 0a                	jne    5d2 <main+0x5d2>
+     5c8:	bf 01 00 00 00       	mov    $0x1,%edi
+     5cd:	e9 53 ff ff ff       	jmp    525 <main+0x525>
+  itimers(100);
+  mask_cost(rounds * 10);
+     5d2:	8b 45 a0             	mov    -0x60(%ebp),%eax
+     5d5:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     5d8:	8d 34 80             	lea    (%eax,%eax,4),%esi
+     5db:	01 f6                	add    %esi,%esi
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     5dd:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+     5df:	89 55 9c             	mov    %edx,-0x64(%ebp)
+     5e2:	89 45 98             	mov    %eax,-0x68(%ebp)
+  for(i = 0; i < rounds; i++)
+     5e5:	8d 76 00             	lea    0x0(%esi),%esi
+    sigprocmask(i & 1 ? (1 << SIGUSR2) : 0);
+     5e8:	89 d8                	mov    %ebx,%eax
+     5ea:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < rounds; i++)
+     5ed:	83 c3 01             	add    $0x1,%ebx
+    sigprocmask(i & 1 ? (1 << SIGUSR2) : 0);
+     5f0:	c1 e0 0c             	shl    $0xc,%eax
+     5f3:	25 00 10 00 00       	and    $0x1000,%eax
+     5f8:	50                   	push   %eax
+     5f9:	e8 37 08 00 00       	call   e35 <sigprocmask>
+  for(i = 0; i < rounds; i++)
+     5fe:	83 c4 10             	add    $0x10,%esp
+     601:	39 de                	cmp    %ebx,%esi
+     603:	75 e3                	jne    5e8 <main+0x5e8>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     605:	0f 31                	rdtsc
+  sigprocmask(0);
+     607:	83 ec 0c             	sub    $0xc,%esp
+  return ((uint64)hi << 32) | lo;
+     60a:	89 55 94             	mov    %edx,-0x6c(%ebp)
+     60d:	89 45 90             	mov    %eax,-0x70(%ebp)
+     610:	6a 00                	push   $0x0
+     612:	e8 1e 08 00 00       	call   e35 <sigprocmask>
+  printf(1, "sigbench sigprocmask %d cycles\n", div64(t1 - t0, rounds));
+     617:	8b 45 90             	mov    -0x70(%ebp),%eax
+     61a:	8b 55 94             	mov    -0x6c(%ebp),%edx
+     61d:	89 f1                	mov    %esi,%ecx
+     61f:	2b 45 98             	sub    -0x68(%ebp),%eax
+     622:	1b 55 9c             	sbb    -0x64(%ebp),%edx
+     625:	e8 c6 01 00 00       	call   7f0 <div64>
+     62a:	83 c4 0c             	add    $0xc,%esp
+     62d:	50                   	push   %eax
+     62e:	68 50 15 00 00       	push   $0x1550
+     633:	6a 01                	push   $0x1
+     635:	e8 16 0a 00 00       	call   1050 <printf>
+  exit(0);
+     63a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     641:	e8 1b 06 00 00       	call   c61 <exit>
+  install(SIGUSR1);
+     646:	e8 95 02 00 00       	call   8e0 <install.constprop.0>
+  rounds = argc > 1 ? atoi(argv[1]) : 1000;
+     64b:	c7 45 a8 e8 03 00 00 	movl   $0x3e8,-0x58(%ebp)
+     652:	e9 e7 f9 ff ff       	jmp    3e <main+0x3e>
+  close(fds[0]);
+     657:	83 ec 0c             	sub    $0xc,%esp
+     65a:	ff 75 e0             	push   -0x20(%ebp)
+     65d:	e8 81 06 00 00       	call   ce3 <close>
+  wait();
+     662:	e8 14 06 00 00       	call   c7b <wait>
+     667:	83 c4 10             	add    $0x10,%esp
+    printf(1, "sigbench stop_to_cont %d cycles\n", div64(total, i));
+     66a:	89 fa                	mov    %edi,%edx
+     66c:	89 d9                	mov    %ebx,%ecx
+     66e:	89 f0                	mov    %esi,%eax
+     670:	e8 7b 01 00 00       	call   7f0 <div64>
+     675:	52                   	push   %edx
+     676:	50                   	push   %eax
+     677:	68 88 14 00 00       	push   $0x1488
+     67c:	6a 01                	push   $0x1
+     67e:	e8 cd 09 00 00       	call   1050 <printf>
+     683:	83 c4 10             	add    $0x10,%esp
+     686:	e9 32 fc ff ff       	jmp    2bd <main+0x2bd>
+    printf(2, "usage: sigbench [rounds]\n");
+     68b:	50                   	push   %eax
+     68c:	50                   	push   %eax
+     68d:	68 a2 13 00 00       	push   $0x13a2
+     692:	6a 02                	push   $0x2
+     694:	e8 b7 09 00 00       	call   1050 <printf>
+    exit(1);
+     699:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     6a0:	e8 bc 05 00 00       	call   c61 <exit>
+      got = 0;
+     6a5:	31 c0                	xor    %eax,%eax
+     6a7:	a3 d4 19 00 00       	mov    %eax,0x19d4
+      kill(parent, SIGUSR1);
+     6ac:	50                   	push   %eax
+     6ad:	50                   	push   %eax
+     6ae:	6a 0a                	push   $0xa
+     6b0:	56                   	push   %esi
+     6b1:	e8 47 06 00 00       	call   cfd <kill>
+    for(i = 0; i < rounds; i++){
+     6b6:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+     6b9:	8d 43 01             	lea    0x1(%ebx),%eax
+     6bc:	83 c4 10             	add    $0x10,%esp
+     6bf:	39 cb                	cmp    %ecx,%ebx
+     6c1:	0f 84 90 00 00 00    	je     757 <main+0x757>
+     6c7:	89 c3                	mov    %eax,%ebx
+      while(!got)
+     6c9:	a1 d4 19 00 00       	mov    0x19d4,%eax
+     6ce:	85 c0                	test   %eax,%eax
+     6d0:	74 f7                	je     6c9 <main+0x6c9>
+     6d2:	eb d1                	jmp    6a5 <main+0x6a5>
+  end = uptime();
+     6d4:	e8 e7 04 00 00       	call   bc0 <uptime>
+  sigprocmask(0);
+     6d9:	83 ec 0c             	sub    $0xc,%esp
+  end = uptime();
+     6dc:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  sigprocmask(0);
+     6df:	6a 00                	push   $0x0
+     6e1:	e8 4f 07 00 00       	call   e35 <sigprocmask>
+  if(left != 0 || sum != n * (n - 1) / 2){
+     6e6:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+  sigprocmask(0);
+     6e9:	83 c4 10             	add    $0x10,%esp
+     6ec:	e9 fa fd ff ff       	jmp    4eb <main+0x4eb>
+             inorder ? "" : " out of order");
+     6f1:	a1 c8 19 00 00       	mov    0x19c8,%eax
+      printf(2, "sigbench: burst ran %d of %d handlers%s\n", count, n + 1,
+     6f6:	ba bb 13 00 00       	mov    $0x13bb,%edx
+     6fb:	85 c0                	test   %eax,%eax
+     6fd:	b8 94 13 00 00       	mov    $0x1394,%eax
+     702:	0f 45 c2             	cmovne %edx,%eax
+     705:	8b 15 d0 19 00 00    	mov    0x19d0,%edx
+     70b:	83 ec 0c             	sub    $0xc,%esp
+     70e:	50                   	push   %eax
+     70f:	6a 06                	push   $0x6
+     711:	52                   	push   %edx
+     712:	68 ac 14 00 00       	push   $0x14ac
+     717:	6a 02                	push   $0x2
+     719:	e8 32 09 00 00       	call   1050 <printf>
+      exit(1);
+     71e:	83 c4 14             	add    $0x14,%esp
+     721:	6a 01                	push   $0x1
+     723:	e8 39 05 00 00       	call   c61 <exit>
+      exit(i);
+     728:	83 ec 0c             	sub    $0xc,%esp
+     72b:	56                   	push   %esi
+     72c:	e8 30 05 00 00       	call   c61 <exit>
+      sigwait(set);
+     731:	83 ec 0c             	sub    $0xc,%esp
+     734:	68 00 04 00 00       	push   $0x400
+     739:	e8 93 07 00 00       	call   ed1 <sigwait>
+      kill(parent, SIGUSR1);
+     73e:	5f                   	pop    %edi
+     73f:	58                   	pop    %eax
+     740:	6a 0a                	push   $0xa
+     742:	56                   	push   %esi
+     743:	e8 b5 05 00 00       	call   cfd <kill>
+    for(i = 0; i < rounds; i++){
+     748:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+     74b:	89 d8                	mov    %ebx,%eax
+     74d:	83 c4 10             	add    $0x10,%esp
+     750:	83 c3 01             	add    $0x1,%ebx
+     753:	39 c8                	cmp    %ecx,%eax
+     755:	75 da                	jne    731 <main+0x731>
+    exit(0);
+     757:	83 ec 0c             	sub    $0xc,%esp
+     75a:	6a 00                	push   $0x0
+     75c:	e8 00 05 00 00       	call   c61 <exit>
+    printf(2, "sigbench: pipe failed\n");
+     761:	51                   	push   %ecx
+     762:	51                   	push   %ecx
+     763:	68 bc 13 00 00       	push   $0x13bc
+     768:	6a 02                	push   $0x2
+     76a:	e8 e1 08 00 00       	call   1050 <printf>
+    exit(1);
+     76f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     776:	e8 e6 04 00 00       	call   c61 <exit>
+    close(fds[0]);
+     77b:	83 ec 0c             	sub    $0xc,%esp
+     77e:	ff 75 e0             	push   -0x20(%ebp)
+     781:	e8 5d 05 00 00       	call   ce3 <close>
+    for(i = 0; i < rounds; i++){
+     786:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     789:	8b 5d b0             	mov    -0x50(%ebp),%ebx
+    close(fds[0]);
+     78c:	83 c4 10             	add    $0x10,%esp
+     78f:	89 45 ac             	mov    %eax,-0x54(%ebp)
+      kill(getpid(), SIGSTOP);
+     792:	e8 19 04 00 00       	call   bb0 <getpid>
+     797:	52                   	push   %edx
+     798:	52                   	push   %edx
+     799:	6a 11                	push   $0x11
+     79b:	50                   	push   %eax
+     79c:	e8 5c 05 00 00       	call   cfd <kill>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     7a1:	0f 31                	rdtsc
+      write(fds[1], &t1, sizeof(t1));
+     7a3:	83 c4 0c             	add    $0xc,%esp
+  return ((uint64)hi << 32) | lo;
+     7a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    for(i = 0; i < rounds; i++){
+     7a9:	83 c3 01             	add    $0x1,%ebx
+     7ac:	89 55 dc             	mov    %edx,-0x24(%ebp)
+      write(fds[1], &t1, sizeof(t1));
+     7af:	6a 08                	push   $0x8
+     7b1:	ff 75 ac             	push   -0x54(%ebp)
+     7b4:	ff 75 e4             	push   -0x1c(%ebp)
+     7b7:	e8 0d 05 00 00       	call   cc9 <write>
+    for(i = 0; i < rounds; i++){
+     7bc:	83 c4 10             	add    $0x10,%esp
+     7bf:	39 5d a4             	cmp    %ebx,-0x5c(%ebp)
+     7c2:	75 ce                	jne    792 <main+0x792>
+     7c4:	eb 91                	jmp    757 <main+0x757>
+     7c6:	66 90                	xchg   %ax,%ax
+     7c8:	66 90                	xchg   %ax,%ax
+     7ca:	66 90                	xchg   %ax,%ax
+     7cc:	66 90                	xchg   %ax,%ax
+     7ce:	66 90                	xchg   %ax,%ax
+
+000007d0 <stamp>:
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	53                   	push   %ebx
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     7d4:	0f 31                	rdtsc
+  handled_at = rdtsc();
+     7d6:	a3 d8 19 00 00       	mov    %eax,0x19d8
+     7db:	89 15 dc 19 00 00    	mov    %edx,0x19dc
+  got = 1;
+     7e1:	c7 05 d4 19 00 00 01 	movl   $0x1,0x19d4
+     7e8:	00 00 00 
+}
+     7eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7ee:	c9                   	leave
+     7ef:	c3                   	ret
+
+000007f0 <div64>:
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	57                   	push   %edi
+  q = r = 0;
+     7f4:	31 ff                	xor    %edi,%edi
+{
+     7f6:	56                   	push   %esi
+  q = r = 0;
+     7f7:	31 f6                	xor    %esi,%esi
+{
+     7f9:	53                   	push   %ebx
+     7fa:	83 ec 24             	sub    $0x24,%esp
+    if(r >= d){
+     7fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+{
+     804:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  q = r = 0;
+     807:	31 c0                	xor    %eax,%eax
+{
+     809:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  q = r = 0;
+     80c:	31 d2                	xor    %edx,%edx
+    if(r >= d){
+     80e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  for(i = 63; i >= 0; i--){
+     811:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+     816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     81d:	8d 76 00             	lea    0x0(%esi),%esi
+    r = (r << 1) | ((n >> i) & 1);
+     820:	0f a4 f7 01          	shld   $0x1,%esi,%edi
+     824:	01 f6                	add    %esi,%esi
+     826:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     829:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     830:	89 75 d8             	mov    %esi,-0x28(%ebp)
+     833:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     836:	89 7d dc             	mov    %edi,-0x24(%ebp)
+     839:	0f ad f3             	shrd   %cl,%esi,%ebx
+     83c:	d3 ee                	shr    %cl,%esi
+     83e:	f6 c1 20             	test   $0x20,%cl
+     841:	0f 45 de             	cmovne %esi,%ebx
+     844:	8b 75 ec             	mov    -0x14(%ebp),%esi
+     847:	0b 75 dc             	or     -0x24(%ebp),%esi
+    q <<= 1;
+     84a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+     84e:	01 c0                	add    %eax,%eax
+    r = (r << 1) | ((n >> i) & 1);
+     850:	89 df                	mov    %ebx,%edi
+     852:	83 e7 01             	and    $0x1,%edi
+     855:	89 7d e8             	mov    %edi,-0x18(%ebp)
+     858:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+     85b:	89 f7                	mov    %esi,%edi
+     85d:	0b 5d d8             	or     -0x28(%ebp),%ebx
+     860:	89 de                	mov    %ebx,%esi
+    if(r >= d){
+     862:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+     865:	39 de                	cmp    %ebx,%esi
+     867:	89 fb                	mov    %edi,%ebx
+     869:	1b 5d e4             	sbb    -0x1c(%ebp),%ebx
+     86c:	72 09                	jb     877 <div64+0x87>
+      r -= d;
+     86e:	2b 75 e0             	sub    -0x20(%ebp),%esi
+     871:	1b 7d e4             	sbb    -0x1c(%ebp),%edi
+      q |= 1;
+     874:	83 c8 01             	or     $0x1,%eax
+  for(i = 63; i >= 0; i--){
+     877:	83 e9 01             	sub    $0x1,%ecx
+     87a:	73 a4                	jae    820 <div64+0x30>
+}
+     87c:	83 c4 24             	add    $0x24,%esp
+     87f:	5b                   	pop    %ebx
+     880:	5e                   	pop    %esi
+     881:	5f                   	pop    %edi
+     882:	5d                   	pop    %ebp
+     883:	c3                   	ret
+     884:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     88f:	90                   	nop
+
+00000890 <counter>:
+  count++;
+     890:	a1 d0 19 00 00       	mov    0x19d0,%eax
+     895:	83 c0 01             	add    $0x1,%eax
+     898:	a3 d0 19 00 00       	mov    %eax,0x19d0
+}
+     89d:	c3                   	ret
+     89e:	66 90                	xchg   %ax,%ax
+
+000008a0 <ordered>:
+{
+     8a0:	55                   	push   %ebp
+     8a1:	89 e5                	mov    %esp,%ebp
+  key = signum * 256 + info->si_value;
+     8a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+     8a6:	8b 45 08             	mov    0x8(%ebp),%eax
+     8a9:	c1 e0 08             	shl    $0x8,%eax
+     8ac:	03 42 08             	add    0x8(%edx),%eax
+  if(key <= lastkey)
+     8af:	8b 15 cc 19 00 00    	mov    0x19cc,%edx
+     8b5:	39 c2                	cmp    %eax,%edx
+     8b7:	7c 0a                	jl     8c3 <ordered+0x23>
+    inorder = 0;
+     8b9:	c7 05 c8 19 00 00 00 	movl   $0x0,0x19c8
+     8c0:	00 00 00 
+  lastkey = key;
+     8c3:	a3 cc 19 00 00       	mov    %eax,0x19cc
+  count++;
+     8c8:	a1 d0 19 00 00       	mov    0x19d0,%eax
+}
+     8cd:	5d                   	pop    %ebp
+  count++;
+     8ce:	83 c0 01             	add    $0x1,%eax
+     8d1:	a3 d0 19 00 00       	mov    %eax,0x19d0
+}
+     8d6:	c3                   	ret
+     8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8de:	66 90                	xchg   %ax,%ax
+
+000008e0 <install.constprop.0>:
+install(int signum)
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	83 ec 1c             	sub    $0x1c,%esp
+  if(sigaction(signum, &act, 0) < 0){
+     8e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  act.sa_handler = stamp;
+     8e9:	c7 45 f0 d0 07 00 00 	movl   $0x7d0,-0x10(%ebp)
+  act.sigmask = 0;
+     8f0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(sigaction(signum, &act, 0) < 0){
+     8f7:	6a 00                	push   $0x0
+     8f9:	50                   	push   %eax
+     8fa:	6a 0a                	push   $0xa
+     8fc:	e8 4e 05 00 00       	call   e4f <sigaction>
+     901:	83 c4 10             	add    $0x10,%esp
+     904:	85 c0                	test   %eax,%eax
+     906:	78 02                	js     90a <install.constprop.0+0x2a>
+}
+     908:	c9                   	leave
+     909:	c3                   	ret
+    printf(2, "sigbench: sigaction failed\n");
+     90a:	50                   	push   %eax
+     90b:	50                   	push   %eax
+     90c:	68 78 13 00 00       	push   $0x1378
+     911:	6a 02                	push   $0x2
+     913:	e8 38 07 00 00       	call   1050 <printf>
+    exit(1);
+     918:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     91f:	e8 3d 03 00 00       	call   c61 <exit>
+     924:	66 90                	xchg   %ax,%ax
+     926:	66 90                	xchg   %ax,%ax
+     928:	66 90                	xchg   %ax,%ax
+     92a:	66 90                	xchg   %ax,%ax
+     92c:	66 90                	xchg   %ax,%ax
+     92e:	66 90                	xchg   %ax,%ax
+
+00000930 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     930:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     931:	31 c0                	xor    %eax,%eax
+{
+     933:	89 e5                	mov    %esp,%ebp
+     935:	53                   	push   %ebx
+     936:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     939:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     940:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     944:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     947:	83 c0 01             	add    $0x1,%eax
+     94a:	84 d2                	test   %dl,%dl
+     94c:	75 f2                	jne    940 <strcpy+0x10>
+    ;
+  return os;
+}
+     94e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     951:	89 c8                	mov    %ecx,%eax
+     953:	c9                   	leave
+     954:	c3                   	ret
+     955:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     95c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000960 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     960:	55                   	push   %ebp
+     961:	89 e5                	mov    %esp,%ebp
+     963:	53                   	push   %ebx
+     964:	8b 55 08             	mov    0x8(%ebp),%edx
+     967:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     96a:	0f b6 02             	movzbl (%edx),%eax
+     96d:	84 c0                	test   %al,%al
+     96f:	75 17                	jne    988 <strcmp+0x28>
+     971:	eb 3a                	jmp    9ad <strcmp+0x4d>
+     973:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     977:	90                   	nop
+     978:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     97c:	83 c2 01             	add    $0x1,%edx
+     97f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     982:	84 c0                	test   %al,%al
+     984:	74 1a                	je     9a0 <strcmp+0x40>
+    p++, q++;
+     986:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     988:	0f b6 19             	movzbl (%ecx),%ebx
+     98b:	38 c3                	cmp    %al,%bl
+     98d:	74 e9                	je     978 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     98f:	29 d8                	sub    %ebx,%eax
+}
+     991:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     994:	c9                   	leave
+     995:	c3                   	ret
+     996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     99d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     9a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     9a4:	31 c0                	xor    %eax,%eax
+     9a6:	29 d8                	sub    %ebx,%eax
+}
+     9a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9ab:	c9                   	leave
+     9ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     9ad:	0f b6 19             	movzbl (%ecx),%ebx
+     9b0:	31 c0                	xor    %eax,%eax
+     9b2:	eb db                	jmp    98f <strcmp+0x2f>
+     9b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9bf:	90                   	nop
+
+000009c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     9c6:	80 3a 00             	cmpb   $0x0,(%edx)
+     9c9:	74 15                	je     9e0 <strlen+0x20>
+     9cb:	31 c0                	xor    %eax,%eax
+     9cd:	8d 76 00             	lea    0x0(%esi),%esi
+     9d0:	83 c0 01             	add    $0x1,%eax
+     9d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     9d7:	89 c1                	mov    %eax,%ecx
+     9d9:	75 f5                	jne    9d0 <strlen+0x10>
+    ;
+  return n;
+}
+     9db:	89 c8                	mov    %ecx,%eax
+     9dd:	5d                   	pop    %ebp
+     9de:	c3                   	ret
+     9df:	90                   	nop
+  for(n = 0; s[n]; n++)
+     9e0:	31 c9                	xor    %ecx,%ecx
+}
+     9e2:	5d                   	pop    %ebp
+     9e3:	89 c8                	mov    %ecx,%eax
+     9e5:	c3                   	ret
+     9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	57                   	push   %edi
+     9f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("cld; rep stosb" :
+     9f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     9fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9fd:	89 d7                	mov    %edx,%edi
+     9ff:	fc                   	cld
+     a00:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     a02:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     a05:	89 d0                	mov    %edx,%eax
+     a07:	c9                   	leave
+     a08:	c3                   	ret
+     a09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a10 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     a10:	55                   	push   %ebp
+     a11:	89 e5                	mov    %esp,%ebp
+     a13:	8b 45 08             	mov    0x8(%ebp),%eax
+     a16:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     a1a:	0f b6 10             	movzbl (%eax),%edx
+     a1d:	84 d2                	test   %dl,%dl
+     a1f:	75 12                	jne    a33 <strchr+0x23>
+     a21:	eb 1d                	jmp    a40 <strchr+0x30>
+     a23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a27:	90                   	nop
+     a28:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     a2c:	83 c0 01             	add    $0x1,%eax
+     a2f:	84 d2                	test   %dl,%dl
+     a31:	74 0d                	je     a40 <strchr+0x30>
+    if(*s == c)
+     a33:	38 d1                	cmp    %dl,%cl
+     a35:	75 f1                	jne    a28 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     a37:	5d                   	pop    %ebp
+     a38:	c3                   	ret
+     a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     a40:	31 c0                	xor    %eax,%eax
+}
+     a42:	5d                   	pop    %ebp
+     a43:	c3                   	ret
+     a44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a4f:	90                   	nop
+
+00000a50 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     a50:	55                   	push   %ebp
+     a51:	89 e5                	mov    %esp,%ebp
+     a53:	57                   	push   %edi
+     a54:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     a55:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     a58:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     a59:	31 db                	xor    %ebx,%ebx
+{
+     a5b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     a5e:	eb 27                	jmp    a87 <gets+0x37>
+    cc = read(0, &c, 1);
+     a60:	83 ec 04             	sub    $0x4,%esp
+     a63:	6a 01                	push   $0x1
+     a65:	56                   	push   %esi
+     a66:	6a 00                	push   $0x0
+     a68:	e8 42 02 00 00       	call   caf <read>
+    if(cc < 1)
+     a6d:	83 c4 10             	add    $0x10,%esp
+     a70:	85 c0                	test   %eax,%eax
+     a72:	7e 1d                	jle    a91 <gets+0x41>
+      break;
+    buf[i++] = c;
+     a74:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     a78:	8b 55 08             	mov    0x8(%ebp),%edx
+     a7b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     a7f:	3c 0a                	cmp    $0xa,%al
+     a81:	74 10                	je     a93 <gets+0x43>
+     a83:	3c 0d                	cmp    $0xd,%al
+     a85:	74 0c                	je     a93 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     a87:	89 df                	mov    %ebx,%edi
+     a89:	83 c3 01             	add    $0x1,%ebx
+     a8c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     a8f:	7c cf                	jl     a60 <gets+0x10>
+     a91:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     a93:	8b 45 08             	mov    0x8(%ebp),%eax
+     a96:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     a9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a9d:	5b                   	pop    %ebx
+     a9e:	5e                   	pop    %esi
+     a9f:	5f                   	pop    %edi
+     aa0:	5d                   	pop    %ebp
+     aa1:	c3                   	ret
+     aa2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ab0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     ab0:	55                   	push   %ebp
+     ab1:	89 e5                	mov    %esp,%ebp
+     ab3:	56                   	push   %esi
+     ab4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     ab5:	83 ec 08             	sub    $0x8,%esp
+     ab8:	6a 00                	push   $0x0
+     aba:	ff 75 08             	push   0x8(%ebp)
+     abd:	e8 6f 02 00 00       	call   d31 <open>
+  if(fd < 0)
+     ac2:	83 c4 10             	add    $0x10,%esp
+     ac5:	85 c0                	test   %eax,%eax
+     ac7:	78 27                	js     af0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     ac9:	83 ec 08             	sub    $0x8,%esp
+     acc:	ff 75 0c             	push   0xc(%ebp)
+     acf:	89 c3                	mov    %eax,%ebx
+     ad1:	50                   	push   %eax
+     ad2:	e8 a8 02 00 00       	call   d7f <fstat>
+  close(fd);
+     ad7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     ada:	89 c6                	mov    %eax,%esi
+  close(fd);
+     adc:	e8 02 02 00 00       	call   ce3 <close>
+  return r;
+     ae1:	83 c4 10             	add    $0x10,%esp
+}
+     ae4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ae7:	89 f0                	mov    %esi,%eax
+     ae9:	5b                   	pop    %ebx
+     aea:	5e                   	pop    %esi
+     aeb:	5d                   	pop    %ebp
+     aec:	c3                   	ret
+     aed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     af0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     af5:	eb ed                	jmp    ae4 <stat+0x34>
+     af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     afe:	66 90                	xchg   %ax,%ax
+
+00000b00 <atoi>:
+
+int
+atoi(const char *s)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	53                   	push   %ebx
+     b04:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     b07:	0f be 02             	movsbl (%edx),%eax
+     b0a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     b0d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     b10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     b15:	77 1e                	ja     b35 <atoi+0x35>
+     b17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     b20:	83 c2 01             	add    $0x1,%edx
+     b23:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     b26:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     b2a:	0f be 02             	movsbl (%edx),%eax
+     b2d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     b30:	80 fb 09             	cmp    $0x9,%bl
+     b33:	76 eb                	jbe    b20 <atoi+0x20>
+  return n;
+}
+     b35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b38:	89 c8                	mov    %ecx,%eax
+     b3a:	c9                   	leave
+     b3b:	c3                   	ret
+     b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b40 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     b40:	55                   	push   %ebp
+     b41:	89 e5                	mov    %esp,%ebp
+     b43:	57                   	push   %edi
+     b44:	56                   	push   %esi
+     b45:	8b 45 10             	mov    0x10(%ebp),%eax
+     b48:	8b 55 08             	mov    0x8(%ebp),%edx
+     b4b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     b4e:	85 c0                	test   %eax,%eax
+     b50:	7e 13                	jle    b65 <memmove+0x25>
+     b52:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     b54:	89 d7                	mov    %edx,%edi
+     b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     b60:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     b61:	39 f8                	cmp    %edi,%eax
+     b63:	75 fb                	jne    b60 <memmove+0x20>
+  return vdst;
+}
+     b65:	5e                   	pop    %esi
+     b66:	89 d0                	mov    %edx,%eax
+     b68:	5f                   	pop    %edi
+     b69:	5d                   	pop    %ebp
+     b6a:	c3                   	ret
+     b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b6f:	90                   	nop
+
+00000b70 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+     b70:	55                   	push   %ebp
+     b71:	89 e5                	mov    %esp,%ebp
+     b73:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+     b76:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+     b79:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+     b80:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+     b83:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     b86:	50                   	push   %eax
+     b87:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     b8a:	50                   	push   %eax
+     b8b:	6a 00                	push   $0x0
+     b8d:	e8 8d 03 00 00       	call   f1f <setitimer>
+     b92:	83 c4 10             	add    $0x10,%esp
+     b95:	89 c2                	mov    %eax,%edx
+     b97:	31 c0                	xor    %eax,%eax
+     b99:	85 d2                	test   %edx,%edx
+     b9b:	78 03                	js     ba0 <alarm+0x30>
+    return 0;
+  return old.it_value;
+     b9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     ba0:	c9                   	leave
+     ba1:	c3                   	ret
+     ba2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ba9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bb0 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+     bb0:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+     bb5:	c3                   	ret
+     bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bc0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     bc0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+     bc5:	c3                   	ret
+     bc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bd0 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	57                   	push   %edi
+     bd4:	56                   	push   %esi
+     bd5:	53                   	push   %ebx
+     bd6:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+     bd9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+     bdd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+     be0:	75 5e                	jne    c40 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+     be2:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+     be8:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+     bea:	89 d3                	mov    %edx,%ebx
+     bec:	89 c1                	mov    %eax,%ecx
+     bee:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+     bf4:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+     bfa:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+     bfd:	31 d2                	xor    %edx,%edx
+     bff:	89 d8                	mov    %ebx,%eax
+     c01:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+     c04:	f7 f6                	div    %esi
+     c06:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+     c08:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c0b:	f7 f6                	div    %esi
+     c0d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+     c0f:	89 da                	mov    %ebx,%edx
+     c11:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+     c16:	f7 f3                	div    %ebx
+     c18:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+     c1a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+     c1f:	89 d3                	mov    %edx,%ebx
+     c21:	f7 e1                	mul    %ecx
+     c23:	f7 f6                	div    %esi
+     c25:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+     c2b:	01 c3                	add    %eax,%ebx
+  return 0;
+     c2d:	31 c0                	xor    %eax,%eax
+     c2f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+     c32:	83 c4 0c             	add    $0xc,%esp
+     c35:	5b                   	pop    %ebx
+     c36:	5e                   	pop    %esi
+     c37:	5f                   	pop    %edi
+     c38:	5d                   	pop    %ebp
+     c39:	c3                   	ret
+     c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+     c40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c45:	eb eb                	jmp    c32 <clock_gettime+0x62>
+
+00000c47 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     c47:	b8 01 00 00 00       	mov    $0x1,%eax
+     c4c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     c53:	74 09                	je     c5e <fork+0x17>
+     c55:	89 e1                	mov    %esp,%ecx
+     c57:	ba 60 0c 00 00       	mov    $0xc60,%edx
+     c5c:	0f 34                	sysenter
+     c5e:	cd 40                	int    $0x40
+     c60:	c3                   	ret
+
+00000c61 <exit>:
+SYSCALL(exit)
+     c61:	b8 02 00 00 00       	mov    $0x2,%eax
+     c66:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     c6d:	74 09                	je     c78 <exit+0x17>
+     c6f:	89 e1                	mov    %esp,%ecx
+     c71:	ba 7a 0c 00 00       	mov    $0xc7a,%edx
+     c76:	0f 34                	sysenter
+     c78:	cd 40                	int    $0x40
+     c7a:	c3                   	ret
+
+00000c7b <wait>:
+SYSCALL(wait)
+     c7b:	b8 03 00 00 00       	mov    $0x3,%eax
+     c80:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     c87:	74 09                	je     c92 <wait+0x17>
+     c89:	89 e1                	mov    %esp,%ecx
+     c8b:	ba 94 0c 00 00       	mov    $0xc94,%edx
+     c90:	0f 34                	sysenter
+     c92:	cd 40                	int    $0x40
+     c94:	c3                   	ret
+
+00000c95 <pipe>:
+SYSCALL(pipe)
+     c95:	b8 04 00 00 00       	mov    $0x4,%eax
+     c9a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     ca1:	74 09                	je     cac <pipe+0x17>
+     ca3:	89 e1                	mov    %esp,%ecx
+     ca5:	ba ae 0c 00 00       	mov    $0xcae,%edx
+     caa:	0f 34                	sysenter
+     cac:	cd 40                	int    $0x40
+     cae:	c3                   	ret
+
+00000caf <read>:
+SYSCALL(read)
+     caf:	b8 05 00 00 00       	mov    $0x5,%eax
+     cb4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     cbb:	74 09                	je     cc6 <read+0x17>
+     cbd:	89 e1                	mov    %esp,%ecx
+     cbf:	ba c8 0c 00 00       	mov    $0xcc8,%edx
+     cc4:	0f 34                	sysenter
+     cc6:	cd 40                	int    $0x40
+     cc8:	c3                   	ret
+
+00000cc9 <write>:
+SYSCALL(write)
+     cc9:	b8 10 00 00 00       	mov    $0x10,%eax
+     cce:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     cd5:	74 09                	je     ce0 <write+0x17>
+     cd7:	89 e1                	mov    %esp,%ecx
+     cd9:	ba e2 0c 00 00       	mov    $0xce2,%edx
+     cde:	0f 34                	sysenter
+     ce0:	cd 40                	int    $0x40
+     ce2:	c3                   	ret
+
+00000ce3 <close>:
+SYSCALL(close)
+     ce3:	b8 15 00 00 00       	mov    $0x15,%eax
+     ce8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     cef:	74 09                	je     cfa <close+0x17>
+     cf1:	89 e1                	mov    %esp,%ecx
+     cf3:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+     cf8:	0f 34                	sysenter
+     cfa:	cd 40                	int    $0x40
+     cfc:	c3                   	ret
+
+00000cfd <kill>:
+SYSCALL(kill)
+     cfd:	b8 06 00 00 00       	mov    $0x6,%eax
+     d02:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     d09:	74 09                	je     d14 <kill+0x17>
+     d0b:	89 e1                	mov    %esp,%ecx
+     d0d:	ba 16 0d 00 00       	mov    $0xd16,%edx
+     d12:	0f 34                	sysenter
+     d14:	cd 40                	int    $0x40
+     d16:	c3                   	ret
+
+00000d17 <exec>:
+SYSCALL(exec)
+     d17:	b8 07 00 00 00       	mov    $0x7,%eax
+     d1c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     d23:	74 09                	je     d2e <exec+0x17>
+     d25:	89 e1                	mov    %esp,%ecx
+     d27:	ba 30 0d 00 00       	mov    $0xd30,%edx
+     d2c:	0f 34                	sysenter
+     d2e:	cd 40                	int    $0x40
+     d30:	c3                   	ret
+
+00000d31 <open>:
+SYSCALL(open)
+     d31:	b8 0f 00 00 00       	mov    $0xf,%eax
+     d36:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     d3d:	74 09                	je     d48 <open+0x17>
+     d3f:	89 e1                	mov    %esp,%ecx
+     d41:	ba 4a 0d 00 00       	mov    $0xd4a,%edx
+     d46:	0f 34                	sysenter
+     d48:	cd 40                	int    $0x40
+     d4a:	c3                   	ret
+
+00000d4b <mknod>:
+SYSCALL(mknod)
+     d4b:	b8 11 00 00 00       	mov    $0x11,%eax
+     d50:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     d57:	74 09                	je     d62 <mknod+0x17>
+     d59:	89 e1                	mov    %esp,%ecx
+     d5b:	ba 64 0d 00 00       	mov    $0xd64,%edx
+     d60:	0f 34                	sysenter
+     d62:	cd 40                	int    $0x40
+     d64:	c3                   	ret
+
+00000d65 <unlink>:
+SYSCALL(unlink)
+     d65:	b8 12 00 00 00       	mov    $0x12,%eax
+     d6a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     d71:	74 09                	je     d7c <unlink+0x17>
+     d73:	89 e1                	mov    %esp,%ecx
+     d75:	ba 7e 0d 00 00       	mov    $0xd7e,%edx
+     d7a:	0f 34                	sysenter
+     d7c:	cd 40                	int    $0x40
+     d7e:	c3                   	ret
+
+00000d7f <fstat>:
+SYSCALL(fstat)
+     d7f:	b8 08 00 00 00       	mov    $0x8,%eax
+     d84:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     d8b:	74 09                	je     d96 <fstat+0x17>
+     d8d:	89 e1                	mov    %esp,%ecx
+     d8f:	ba 98 0d 00 00       	mov    $0xd98,%edx
+     d94:	0f 34                	sysenter
+     d96:	cd 40                	int    $0x40
+     d98:	c3                   	ret
+
+00000d99 <link>:
+SYSCALL(link)
+     d99:	b8 13 00 00 00       	mov    $0x13,%eax
+     d9e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     da5:	74 09                	je     db0 <link+0x17>
+     da7:	89 e1                	mov    %esp,%ecx
+     da9:	ba b2 0d 00 00       	mov    $0xdb2,%edx
+     dae:	0f 34                	sysenter
+     db0:	cd 40                	int    $0x40
+     db2:	c3                   	ret
+
+00000db3 <mkdir>:
+SYSCALL(mkdir)
+     db3:	b8 14 00 00 00       	mov    $0x14,%eax
+     db8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     dbf:	74 09                	je     dca <mkdir+0x17>
+     dc1:	89 e1                	mov    %esp,%ecx
+     dc3:	ba cc 0d 00 00       	mov    $0xdcc,%edx
+     dc8:	0f 34                	sysenter
+     dca:	cd 40                	int    $0x40
+     dcc:	c3                   	ret
+
+00000dcd <chdir>:
+SYSCALL(chdir)
+     dcd:	b8 09 00 00 00       	mov    $0x9,%eax
+     dd2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     dd9:	74 09                	je     de4 <chdir+0x17>
+     ddb:	89 e1                	mov    %esp,%ecx
+     ddd:	ba e6 0d 00 00       	mov    $0xde6,%edx
+     de2:	0f 34                	sysenter
+     de4:	cd 40                	int    $0x40
+     de6:	c3                   	ret
+
+00000de7 <dup>:
+SYSCALL(dup)
+     de7:	b8 0a 00 00 00       	mov    $0xa,%eax
+     dec:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     df3:	74 09                	je     dfe <dup+0x17>
+     df5:	89 e1                	mov    %esp,%ecx
+     df7:	ba 00 0e 00 00       	mov    $0xe00,%edx
+     dfc:	0f 34                	sysenter
+     dfe:	cd 40                	int    $0x40
+     e00:	c3                   	ret
+
+00000e01 <sbrk>:
+SYSCALL(sbrk)
+     e01:	b8 0c 00 00 00       	mov    $0xc,%eax
+     e06:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     e0d:	74 09                	je     e18 <sbrk+0x17>
+     e0f:	89 e1                	mov    %esp,%ecx
+     e11:	ba 1a 0e 00 00       	mov    $0xe1a,%edx
+     e16:	0f 34                	sysenter
+     e18:	cd 40                	int    $0x40
+     e1a:	c3                   	ret
+
+00000e1b <sleep>:
+SYSCALL(sleep)
+     e1b:	b8 0d 00 00 00       	mov    $0xd,%eax
+     e20:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     e27:	74 09                	je     e32 <sleep+0x17>
+     e29:	89 e1                	mov    %esp,%ecx
+     e2b:	ba 34 0e 00 00       	mov    $0xe34,%edx
+     e30:	0f 34                	sysenter
+     e32:	cd 40                	int    $0x40
+     e34:	c3                   	ret
+
+00000e35 <sigprocmask>:
+SYSCALL(sigprocmask)
+     e35:	b8 16 00 00 00       	mov    $0x16,%eax
+     e3a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     e41:	74 09                	je     e4c <sigprocmask+0x17>
+     e43:	89 e1                	mov    %esp,%ecx
+     e45:	ba 4e 0e 00 00       	mov    $0xe4e,%edx
+     e4a:	0f 34                	sysenter
+     e4c:	cd 40                	int    $0x40
+     e4e:	c3                   	ret
+
+00000e4f <sigaction>:
+SYSCALL(sigaction)
+     e4f:	b8 17 00 00 00       	mov    $0x17,%eax
+     e54:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     e5b:	74 09                	je     e66 <sigaction+0x17>
+     e5d:	89 e1                	mov    %esp,%ecx
+     e5f:	ba 68 0e 00 00       	mov    $0xe68,%edx
+     e64:	0f 34                	sysenter
+     e66:	cd 40                	int    $0x40
+     e68:	c3                   	ret
+
+00000e69 <sigret>:
+SYSCALL(sigret)
+     e69:	b8 18 00 00 00       	mov    $0x18,%eax
+     e6e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     e75:	74 09                	je     e80 <sigret+0x17>
+     e77:	89 e1                	mov    %esp,%ecx
+     e79:	ba 82 0e 00 00       	mov    $0xe82,%edx
+     e7e:	0f 34                	sysenter
+     e80:	cd 40                	int    $0x40
+     e82:	c3                   	ret
+
+00000e83 <traceread>:
+SYSCALL(traceread)
+     e83:	b8 19 00 00 00       	mov    $0x19,%eax
+     e88:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     e8f:	74 09                	je     e9a <traceread+0x17>
+     e91:	89 e1                	mov    %esp,%ecx
+     e93:	ba 9c 0e 00 00       	mov    $0xe9c,%edx
+     e98:	0f 34                	sysenter
+     e9a:	cd 40                	int    $0x40
+     e9c:	c3                   	ret
+
+00000e9d <sigqueue>:
+SYSCALL(sigqueue)
+     e9d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     ea2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     ea9:	74 09                	je     eb4 <sigqueue+0x17>
+     eab:	89 e1                	mov    %esp,%ecx
+     ead:	ba b6 0e 00 00       	mov    $0xeb6,%edx
+     eb2:	0f 34                	sysenter
+     eb4:	cd 40                	int    $0x40
+     eb6:	c3                   	ret
+
+00000eb7 <signalfd>:
+SYSCALL(signalfd)
+     eb7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ebc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     ec3:	74 09                	je     ece <signalfd+0x17>
+     ec5:	89 e1                	mov    %esp,%ecx
+     ec7:	ba d0 0e 00 00       	mov    $0xed0,%edx
+     ecc:	0f 34                	sysenter
+     ece:	cd 40                	int    $0x40
+     ed0:	c3                   	ret
+
+00000ed1 <sigwait>:
+SYSCALL(sigwait)
+     ed1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     ed6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     edd:	74 09                	je     ee8 <sigwait+0x17>
+     edf:	89 e1                	mov    %esp,%ecx
+     ee1:	ba ea 0e 00 00       	mov    $0xeea,%edx
+     ee6:	0f 34                	sysenter
+     ee8:	cd 40                	int    $0x40
+     eea:	c3                   	ret
+
+00000eeb <sigsuspend>:
+SYSCALL(sigsuspend)
+     eeb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ef0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     ef7:	74 09                	je     f02 <sigsuspend+0x17>
+     ef9:	89 e1                	mov    %esp,%ecx
+     efb:	ba 04 0f 00 00       	mov    $0xf04,%edx
+     f00:	0f 34                	sysenter
+     f02:	cd 40                	int    $0x40
+     f04:	c3                   	ret
+
+00000f05 <waitpid>:
+SYSCALL(waitpid)
+     f05:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     f0a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f11:	74 09                	je     f1c <waitpid+0x17>
+     f13:	89 e1                	mov    %esp,%ecx
+     f15:	ba 1e 0f 00 00       	mov    $0xf1e,%edx
+     f1a:	0f 34                	sysenter
+     f1c:	cd 40                	int    $0x40
+     f1e:	c3                   	ret
+
+00000f1f <setitimer>:
+SYSCALL(setitimer)
+     f1f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f24:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f2b:	74 09                	je     f36 <setitimer+0x17>
+     f2d:	89 e1                	mov    %esp,%ecx
+     f2f:	ba 38 0f 00 00       	mov    $0xf38,%edx
+     f34:	0f 34                	sysenter
+     f36:	cd 40                	int    $0x40
+     f38:	c3                   	ret
+
+00000f39 <nanosleep>:
+SYSCALL(nanosleep)
+     f39:	b8 21 00 00 00       	mov    $0x21,%eax
+     f3e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f45:	74 09                	je     f50 <nanosleep+0x17>
+     f47:	89 e1                	mov    %esp,%ecx
+     f49:	ba 52 0f 00 00       	mov    $0xf52,%edx
+     f4e:	0f 34                	sysenter
+     f50:	cd 40                	int    $0x40
+     f52:	c3                   	ret
+
+00000f53 <mmap>:
+SYSCALL(mmap)
+     f53:	b8 22 00 00 00       	mov    $0x22,%eax
+     f58:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f5f:	74 09                	je     f6a <mmap+0x17>
+     f61:	89 e1                	mov    %esp,%ecx
+     f63:	ba 6c 0f 00 00       	mov    $0xf6c,%edx
+     f68:	0f 34                	sysenter
+     f6a:	cd 40                	int    $0x40
+     f6c:	c3                   	ret
+
+00000f6d <munmap>:
+SYSCALL(munmap)
+     f6d:	b8 23 00 00 00       	mov    $0x23,%eax
+     f72:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f79:	74 09                	je     f84 <munmap+0x17>
+     f7b:	89 e1                	mov    %esp,%ecx
+     f7d:	ba 86 0f 00 00       	mov    $0xf86,%edx
+     f82:	0f 34                	sysenter
+     f84:	cd 40                	int    $0x40
+     f86:	c3                   	ret
+
+00000f87 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+     f87:	b8 0b 00 00 00       	mov    $0xb,%eax
+     f8c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+     f93:	74 09                	je     f9e <getpid_syscall+0x17>
+     f95:	89 e1                	mov    %esp,%ecx
+     f97:	ba a0 0f 00 00       	mov    $0xfa0,%edx
+     f9c:	0f 34                	sysenter
+     f9e:	cd 40                	int    $0x40
+     fa0:	c3                   	ret
+
+00000fa1 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+     fa1:	b8 0b 00 00 00       	mov    $0xb,%eax
+     fa6:	cd 40                	int    $0x40
+     fa8:	c3                   	ret
+     fa9:	66 90                	xchg   %ax,%ax
+     fab:	66 90                	xchg   %ax,%ax
+     fad:	66 90                	xchg   %ax,%ax
+     faf:	90                   	nop
+
+00000fb0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	57                   	push   %edi
+     fb4:	56                   	push   %esi
+     fb5:	53                   	push   %ebx
+     fb6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     fb8:	89 d1                	mov    %edx,%ecx
+{
+     fba:	83 ec 3c             	sub    $0x3c,%esp
+     fbd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     fc0:	85 d2                	test   %edx,%edx
+     fc2:	0f 89 80 00 00 00    	jns    1048 <printint+0x98>
+     fc8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     fcc:	74 7a                	je     1048 <printint+0x98>
+    x = -xx;
+     fce:	f7 d9                	neg    %ecx
+    neg = 1;
+     fd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     fd5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     fd8:	31 f6                	xor    %esi,%esi
+     fda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     fe0:	89 c8                	mov    %ecx,%eax
+     fe2:	31 d2                	xor    %edx,%edx
+     fe4:	89 f7                	mov    %esi,%edi
+     fe6:	f7 f3                	div    %ebx
+     fe8:	8d 76 01             	lea    0x1(%esi),%esi
+     feb:	0f b6 92 fc 15 00 00 	movzbl 0x15fc(%edx),%edx
+     ff2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     ff6:	89 ca                	mov    %ecx,%edx
+     ff8:	89 c1                	mov    %eax,%ecx
+     ffa:	39 da                	cmp    %ebx,%edx
+     ffc:	73 e2                	jae    fe0 <printint+0x30>
+  if(neg)
+     ffe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1001:	85 c0                	test   %eax,%eax
+    1003:	74 07                	je     100c <printint+0x5c>
+    buf[i++] = '-';
+    1005:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    100a:	89 f7                	mov    %esi,%edi
+    100c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    100f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1012:	01 df                	add    %ebx,%edi
+    1014:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1018:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    101b:	83 ec 04             	sub    $0x4,%esp
+    101e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1021:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1024:	6a 01                	push   $0x1
+    1026:	50                   	push   %eax
+    1027:	56                   	push   %esi
+    1028:	e8 9c fc ff ff       	call   cc9 <write>
+  while(--i >= 0)
+    102d:	89 f8                	mov    %edi,%eax
+    102f:	83 c4 10             	add    $0x10,%esp
+    1032:	83 ef 01             	sub    $0x1,%edi
+    1035:	39 d8                	cmp    %ebx,%eax
+    1037:	75 df                	jne    1018 <printint+0x68>
+}
+    1039:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    103c:	5b                   	pop    %ebx
+    103d:	5e                   	pop    %esi
+    103e:	5f                   	pop    %edi
+    103f:	5d                   	pop    %ebp
+    1040:	c3                   	ret
+    1041:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1048:	31 c0                	xor    %eax,%eax
+    104a:	eb 89                	jmp    fd5 <printint+0x25>
+    104c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001050 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1050:	55                   	push   %ebp
+    1051:	89 e5                	mov    %esp,%ebp
+    1053:	57                   	push   %edi
+    1054:	56                   	push   %esi
+    1055:	53                   	push   %ebx
+    1056:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1059:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    105c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    105f:	0f b6 1e             	movzbl (%esi),%ebx
+    1062:	83 c6 01             	add    $0x1,%esi
+    1065:	84 db                	test   %bl,%bl
+    1067:	74 67                	je     10d0 <printf+0x80>
+    1069:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    106c:	31 d2                	xor    %edx,%edx
+    106e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1071:	eb 34                	jmp    10a7 <printf+0x57>
+    1073:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1077:	90                   	nop
+    1078:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    107b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1080:	83 f8 25             	cmp    $0x25,%eax
+    1083:	74 18                	je     109d <printf+0x4d>
+  write(fd, &c, 1);
+    1085:	83 ec 04             	sub    $0x4,%esp
+    1088:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    108b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    108e:	6a 01                	push   $0x1
+    1090:	50                   	push   %eax
+    1091:	57                   	push   %edi
+    1092:	e8 32 fc ff ff       	call   cc9 <write>
+    1097:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    109a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    109d:	0f b6 1e             	movzbl (%esi),%ebx
+    10a0:	83 c6 01             	add    $0x1,%esi
+    10a3:	84 db                	test   %bl,%bl
+    10a5:	74 29                	je     10d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    10a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    10aa:	85 d2                	test   %edx,%edx
+    10ac:	74 ca                	je     1078 <printf+0x28>
+      }
+    } else if(state == '%'){
+    10ae:	83 fa 25             	cmp    $0x25,%edx
+    10b1:	75 ea                	jne    109d <printf+0x4d>
+      if(c == 'd'){
+    10b3:	83 f8 25             	cmp    $0x25,%eax
+    10b6:	0f 84 24 01 00 00    	je     11e0 <printf+0x190>
+    10bc:	83 e8 63             	sub    $0x63,%eax
+    10bf:	83 f8 15             	cmp    $0x15,%eax
+    10c2:	77 1c                	ja     10e0 <printf+0x90>
+    10c4:	ff 24 85 a4 15 00 00 	jmp    *0x15a4(,%eax,4)
+    10cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    10d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10d3:	5b                   	pop    %ebx
+    10d4:	5e                   	pop    %esi
+    10d5:	5f                   	pop    %edi
+    10d6:	5d                   	pop    %ebp
+    10d7:	c3                   	ret
+    10d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10df:	90                   	nop
+  write(fd, &c, 1);
+    10e0:	83 ec 04             	sub    $0x4,%esp
+    10e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    10e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    10ea:	6a 01                	push   $0x1
+    10ec:	52                   	push   %edx
+    10ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    10f0:	57                   	push   %edi
+    10f1:	e8 d3 fb ff ff       	call   cc9 <write>
+    10f6:	83 c4 0c             	add    $0xc,%esp
+    10f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    10fc:	6a 01                	push   $0x1
+    10fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1101:	52                   	push   %edx
+    1102:	57                   	push   %edi
+    1103:	e8 c1 fb ff ff       	call   cc9 <write>
+        putc(fd, c);
+    1108:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    110b:	31 d2                	xor    %edx,%edx
+    110d:	eb 8e                	jmp    109d <printf+0x4d>
+    110f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1110:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1113:	83 ec 0c             	sub    $0xc,%esp
+    1116:	b9 10 00 00 00       	mov    $0x10,%ecx
+    111b:	8b 13                	mov    (%ebx),%edx
+    111d:	6a 00                	push   $0x0
+    111f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1121:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1124:	e8 87 fe ff ff       	call   fb0 <printint>
+        ap++;
+    1129:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    112c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    112f:	31 d2                	xor    %edx,%edx
+    1131:	e9 67 ff ff ff       	jmp    109d <printf+0x4d>
+    1136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    113d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1140:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1143:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1145:	83 c0 04             	add    $0x4,%eax
+    1148:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    114b:	85 db                	test   %ebx,%ebx
+    114d:	0f 84 9d 00 00 00    	je     11f0 <printf+0x1a0>
+        while(*s != 0){
+    1153:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1156:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1158:	84 c0                	test   %al,%al
+    115a:	0f 84 3d ff ff ff    	je     109d <printf+0x4d>
+    1160:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1163:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1166:	89 de                	mov    %ebx,%esi
+    1168:	89 d3                	mov    %edx,%ebx
+    116a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1170:	83 ec 04             	sub    $0x4,%esp
+    1173:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1176:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1179:	6a 01                	push   $0x1
+    117b:	53                   	push   %ebx
+    117c:	57                   	push   %edi
+    117d:	e8 47 fb ff ff       	call   cc9 <write>
+        while(*s != 0){
+    1182:	0f b6 06             	movzbl (%esi),%eax
+    1185:	83 c4 10             	add    $0x10,%esp
+    1188:	84 c0                	test   %al,%al
+    118a:	75 e4                	jne    1170 <printf+0x120>
+      state = 0;
+    118c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    118f:	31 d2                	xor    %edx,%edx
+    1191:	e9 07 ff ff ff       	jmp    109d <printf+0x4d>
+    1196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    11a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    11a3:	83 ec 0c             	sub    $0xc,%esp
+    11a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    11ab:	8b 13                	mov    (%ebx),%edx
+    11ad:	6a 01                	push   $0x1
+    11af:	e9 6b ff ff ff       	jmp    111f <printf+0xcf>
+    11b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    11b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    11bb:	83 ec 04             	sub    $0x4,%esp
+    11be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    11c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    11c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    11c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    11c9:	6a 01                	push   $0x1
+    11cb:	52                   	push   %edx
+    11cc:	57                   	push   %edi
+    11cd:	e8 f7 fa ff ff       	call   cc9 <write>
+        ap++;
+    11d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    11d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11d8:	31 d2                	xor    %edx,%edx
+    11da:	e9 be fe ff ff       	jmp    109d <printf+0x4d>
+    11df:	90                   	nop
+  write(fd, &c, 1);
+    11e0:	83 ec 04             	sub    $0x4,%esp
+    11e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    11e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    11e9:	6a 01                	push   $0x1
+    11eb:	e9 11 ff ff ff       	jmp    1101 <printf+0xb1>
+    11f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    11f5:	bb 9c 15 00 00       	mov    $0x159c,%ebx
+    11fa:	e9 61 ff ff ff       	jmp    1160 <printf+0x110>
+    11ff:	90                   	nop
+
+00001200 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1200:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1201:	a1 e0 19 00 00       	mov    0x19e0,%eax
+{
+    1206:	89 e5                	mov    %esp,%ebp
+    1208:	57                   	push   %edi
+    1209:	56                   	push   %esi
+    120a:	53                   	push   %ebx
+    120b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    120e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1211:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1218:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    121a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    121c:	39 ca                	cmp    %ecx,%edx
+    121e:	73 30                	jae    1250 <free+0x50>
+    1220:	39 c1                	cmp    %eax,%ecx
+    1222:	72 04                	jb     1228 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1224:	39 c2                	cmp    %eax,%edx
+    1226:	72 f0                	jb     1218 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1228:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    122b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    122e:	39 f8                	cmp    %edi,%eax
+    1230:	74 2e                	je     1260 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1232:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1235:	8b 42 04             	mov    0x4(%edx),%eax
+    1238:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    123b:	39 f1                	cmp    %esi,%ecx
+    123d:	74 38                	je     1277 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    123f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1241:	5b                   	pop    %ebx
+  freep = p;
+    1242:	89 15 e0 19 00 00    	mov    %edx,0x19e0
+}
+    1248:	5e                   	pop    %esi
+    1249:	5f                   	pop    %edi
+    124a:	5d                   	pop    %ebp
+    124b:	c3                   	ret
+    124c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1250:	39 c1                	cmp    %eax,%ecx
+    1252:	72 d0                	jb     1224 <free+0x24>
+    1254:	eb c2                	jmp    1218 <free+0x18>
+    1256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1260:	03 70 04             	add    0x4(%eax),%esi
+    1263:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1266:	8b 02                	mov    (%edx),%eax
+    1268:	8b 00                	mov    (%eax),%eax
+    126a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    126d:	8b 42 04             	mov    0x4(%edx),%eax
+    1270:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1273:	39 f1                	cmp    %esi,%ecx
+    1275:	75 c8                	jne    123f <free+0x3f>
+    p->s.size += bp->s.size;
+    1277:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    127a:	89 15 e0 19 00 00    	mov    %edx,0x19e0
+    p->s.size += bp->s.size;
+    1280:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1283:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1286:	89 0a                	mov    %ecx,(%edx)
+}
+    1288:	5b                   	pop    %ebx
+    1289:	5e                   	pop    %esi
+    128a:	5f                   	pop    %edi
+    128b:	5d                   	pop    %ebp
+    128c:	c3                   	ret
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001290 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	57                   	push   %edi
+    1294:	56                   	push   %esi
+    1295:	53                   	push   %ebx
+    1296:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1299:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    129c:	8b 15 e0 19 00 00    	mov    0x19e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    12a2:	8d 78 07             	lea    0x7(%eax),%edi
+    12a5:	c1 ef 03             	shr    $0x3,%edi
+    12a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    12ab:	85 d2                	test   %edx,%edx
+    12ad:	0f 84 8d 00 00 00    	je     1340 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    12b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    12b5:	8b 48 04             	mov    0x4(%eax),%ecx
+    12b8:	39 f9                	cmp    %edi,%ecx
+    12ba:	73 64                	jae    1320 <malloc+0x90>
+  if(nu < 4096)
+    12bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    12c1:	39 df                	cmp    %ebx,%edi
+    12c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    12c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    12cd:	eb 0a                	jmp    12d9 <malloc+0x49>
+    12cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    12d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    12d2:	8b 48 04             	mov    0x4(%eax),%ecx
+    12d5:	39 f9                	cmp    %edi,%ecx
+    12d7:	73 47                	jae    1320 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    12d9:	89 c2                	mov    %eax,%edx
+    12db:	39 05 e0 19 00 00    	cmp    %eax,0x19e0
+    12e1:	75 ed                	jne    12d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    12e3:	83 ec 0c             	sub    $0xc,%esp
+    12e6:	56                   	push   %esi
+    12e7:	e8 15 fb ff ff       	call   e01 <sbrk>
+  if(p == (char*)-1)
+    12ec:	83 c4 10             	add    $0x10,%esp
+    12ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+    12f2:	74 1c                	je     1310 <malloc+0x80>
+  hp->s.size = nu;
+    12f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    12f7:	83 ec 0c             	sub    $0xc,%esp
+    12fa:	83 c0 08             	add    $0x8,%eax
+    12fd:	50                   	push   %eax
+    12fe:	e8 fd fe ff ff       	call   1200 <free>
+  return freep;
+    1303:	8b 15 e0 19 00 00    	mov    0x19e0,%edx
+      if((p = morecore(nunits)) == 0)
+    1309:	83 c4 10             	add    $0x10,%esp
+    130c:	85 d2                	test   %edx,%edx
+    130e:	75 c0                	jne    12d0 <malloc+0x40>
+        return 0;
+  }
+}
+    1310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1313:	31 c0                	xor    %eax,%eax
+}
+    1315:	5b                   	pop    %ebx
+    1316:	5e                   	pop    %esi
+    1317:	5f                   	pop    %edi
+    1318:	5d                   	pop    %ebp
+    1319:	c3                   	ret
+    131a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1320:	39 cf                	cmp    %ecx,%edi
+    1322:	74 4c                	je     1370 <malloc+0xe0>
+        p->s.size -= nunits;
+    1324:	29 f9                	sub    %edi,%ecx
+    1326:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1329:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    132c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    132f:	89 15 e0 19 00 00    	mov    %edx,0x19e0
+}
+    1335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1338:	83 c0 08             	add    $0x8,%eax
+}
+    133b:	5b                   	pop    %ebx
+    133c:	5e                   	pop    %esi
+    133d:	5f                   	pop    %edi
+    133e:	5d                   	pop    %ebp
+    133f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1340:	c7 05 e0 19 00 00 e4 	movl   $0x19e4,0x19e0
+    1347:	19 00 00 
+    base.s.size = 0;
+    134a:	b8 e4 19 00 00       	mov    $0x19e4,%eax
+    base.s.ptr = freep = prevp = &base;
+    134f:	c7 05 e4 19 00 00 e4 	movl   $0x19e4,0x19e4
+    1356:	19 00 00 
+    base.s.size = 0;
+    1359:	c7 05 e8 19 00 00 00 	movl   $0x0,0x19e8
+    1360:	00 00 00 
+    if(p->s.size >= nunits){
+    1363:	e9 54 ff ff ff       	jmp    12bc <malloc+0x2c>
+    1368:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1370:	8b 08                	mov    (%eax),%ecx
+    1372:	89 0a                	mov    %ecx,(%edx)
+    1374:	eb b9                	jmp    132f <malloc+0x9f>
@@ -0,0 +1,350 @@
+// Signal delivery benchmarks.
+// Prints one line per measurement:
+//   sigbench <name> <value> <unit>
+// Cycle counts come from rdtsc; rates are per second of uptime.
+//   usage: sigbench [rounds]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+
+static volatile uint64 handled_at;
+static volatile int got;
+static volatile int count;
+
+static void
+stamp(int signum)
+{
+  handled_at = rdtsc();
+  got = 1;
+}
+
+// n / d without the libgcc 64-bit division helpers.
+static uint
+div64(uint64 n, uint d)
+{
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+  for(i = 63; i >= 0; i--){
+    r = (r << 1) | ((n >> i) & 1);
+    q <<= 1;
+    if(r >= d){
+      r -= d;
+      q |= 1;
+    }
+  }
+  return (uint)q;
+}
+
+static void
+counter(int signum)
+{
+  count++;
+}
+
+// Counts like counter(), and clears inorder if handlers run out of
+// order: lower signals first, and a signal's records oldest first.
+static volatile int lastkey, inorder;
+
+static void
+ordered(int signum, struct siginfo *info)
+{
+  int key;
+
+  key = signum * 256 + info->si_value;
+  if(key <= lastkey)
+    inorder = 0;
+  lastkey = key;
+  count++;
+}
+
+static void
+install(int signum)
+{
+  struct sigaction act;
+
+  act.sa_handler = stamp;
+  act.sigmask = 0;
+  if(sigaction(signum, &act, 0) < 0){
+    printf(2, "sigbench: sigaction failed\n");
+    exit(1);
+  }
+}
+
+// kill() of the calling process until its handler runs.
+static void
+self_latency(int rounds)
+{
+  uint64 t0, total;
+  int i;
+
+  install(SIGUSR1);
+  total = 0;
+  for(i = 0; i < rounds; i++){
+    got = 0;
+    t0 = rdtsc();
+    kill(getpid(), SIGUSR1);
+    while(!got)
+      ;
+    total += handled_at - t0;
+  }
+  printf(1, "sigbench kill_to_handler %d cycles\n", div64(total, rounds));
+}
+
+// Two processes bouncing SIGUSR1 between their handlers.
+static void
+pingpong(int rounds)
+{
+  int parent, child, i, start, end;
+
+  install(SIGUSR1);
+  parent = getpid();
+  got = 0;
+  if((child = fork()) == 0){
+    for(i = 0; i < rounds; i++){
+      while(!got)
+        ;
+      got = 0;
+      kill(parent, SIGUSR1);
+    }
+    exit(0);
+  }
+
+  start = uptime();
+  for(i = 0; i < rounds; i++){
+    kill(child, SIGUSR1);
+    while(!got)
+      ;
+    got = 0;
+  }
+  end = uptime();
+  wait();
+  if(end == start)
+    end++;
+  printf(1, "sigbench pingpong_rate %d roundtrips/s\n",
+         rounds * 100 / (end - start));
+}
+
+// The same exchange with both sides blocked in sigwait() instead of
+// spinning on a handler flag.
+static void
+waitpingpong(int rounds)
+{
+  int parent, child, i, start, end;
+  uint set;
+
+  set = 1 << SIGUSR1;
+  sigprocmask(set);
+  parent = getpid();
+  if((child = fork()) == 0){
+    for(i = 0; i < rounds; i++){
+      sigwait(set);
+      kill(parent, SIGUSR1);
+    }
+    exit(0);
+  }
+
+  start = uptime();
+  for(i = 0; i < rounds; i++){
+    kill(child, SIGUSR1);
+    sigwait(set);
+  }
+  end = uptime();
+  wait();
+  sigprocmask(0);
+  if(end == start)
+    end++;
+  printf(1, "sigbench sigwait_pingpong_rate %d roundtrips/s\n",
+         rounds * 100 / (end - start));
+}
+
+// SIGCONT sent by the parent until the stopped child runs again.
+static void
+resume_latency(int rounds)
+{
+  int child, i, fds[2];
+  uint64 t0, t1, total;
+
+  if(pipe(fds) < 0){
+    printf(2, "sigbench: pipe failed\n");
+    exit(1);
+  }
+  if((child = fork()) == 0){
+    close(fds[0]);
+    for(i = 0; i < rounds; i++){
+      kill(getpid(), SIGSTOP);
+      t1 = rdtsc();
+      write(fds[1], &t1, sizeof(t1));
+    }
+    exit(0);
+  }
+  close(fds[1]);
+
+  total = 0;
+  for(i = 0; i < rounds; i++){
+    sleep(1);  // let the child reach SIGSTOP
+    t0 = rdtsc();
+    kill(child, SIGCONT);
+    if(read(fds[0], &t1, sizeof(t1)) != sizeof(t1))
+      break;
+    total += t1 - t0;
+  }
+  close(fds[0]);
+  wait();
+  if(i > 0)
+    printf(1, "sigbench stop_to_cont %d cycles\n", div64(total, i));
+}
+
+// Signals blocked, posted, then released by one sigprocmask(): all
+// handlers run on that single return to user space, lowest signal
+// first. SIGUSR1 is queued twice with sigqueue() and runs twice.
+static void
+burst(int rounds)
+{
+  static int sigs[] = { SIGUSR1, SIGUSR2, 13, 15, 16 };
+  struct sigaction act;
+  uint64 t0, total;
+  uint mask;
+  int i, j, n;
+
+  n = sizeof(sigs) / sizeof(sigs[0]);
+  act.sa_handler = (void (*)(int))ordered;
+  act.sigmask = 0;
+  mask = 0;
+  for(j = 0; j < n; j++){
+    sigaction(sigs[j], &act, 0);
+    mask |= 1 << sigs[j];
+  }
+
+  total = 0;
+  for(i = 0; i < rounds; i++){
+    sigprocmask(mask);
+    sigqueue(getpid(), SIGUSR1, 1);
+    sigqueue(getpid(), SIGUSR1, 2);
+    for(j = n - 1; j > 0; j--)
+      kill(getpid(), sigs[j]);
+    count = 0;
+    lastkey = 0;
+    inorder = 1;
+    t0 = rdtsc();
+    sigprocmask(0);
+    total += rdtsc() - t0;
+    if(count != n + 1 || !inorder){
+      printf(2, "sigbench: burst ran %d of %d handlers%s\n", count, n + 1,
+             inorder ? "" : " out of order");
+      exit(1);
+    }
+  }
+  printf(1, "sigbench burst%d %d cycles\n", n, div64(total, rounds));
+}
+
+// Children reaped from SIGCHLD: the parent sleeps in sigwait() and
+// collects whatever has exited with waitpid(WNOHANG), instead of one
+// blocking wait() per child. Checks every exit status arrives.
+static void
+reaper(int n)
+{
+  int i, pid, status, left, sum, start, end;
+  uint set;
+
+  set = 1 << SIGCHLD;
+  sigprocmask(set);
+  start = uptime();
+  for(i = 0; i < n; i++){
+    if((pid = fork()) < 0)
+      break;
+    if(pid == 0)
+      exit(i);
+  }
+  n = i;
+
+  left = n;
+  sum = 0;
+  while(left > 0){
+    while((pid = waitpid(-1, &status, WNOHANG)) > 0){
+      sum += status;
+      left--;
+    }
+    if(pid < 0 || left == 0)
+      break;
+    sigwait(set);
+  }
+  end = uptime();
+  sigprocmask(0);
+  if(left != 0 || sum != n * (n - 1) / 2){
+    printf(2, "sigbench: reaper lost children (%d left)\n", left);
+    exit(1);
+  }
+  if(end == start)
+    end++;
+  printf(1, "sigbench sigchld_reap_rate %d children/s\n",
+         n * 100 / (end - start));
+}
+
+// Periodic ITIMER_REAL and ITIMER_VIRTUAL while spinning in user
+// mode: both should fire about once per interval.
+static void
+itimers(int ticks)
+{
+  static int which[] = { ITIMER_REAL, ITIMER_VIRTUAL };
+  static int sigs[] = { SIGALRM, SIGVTALRM };
+  static char *names[] = { "itimer_real", "itimer_virtual" };
+  struct sigaction act;
+  struct itimerval v;
+  int i, start;
+
+  act.sa_handler = counter;
+  act.sigmask = 0;
+  for(i = 0; i < 2; i++){
+    sigaction(sigs[i], &act, 0);
+    count = 0;
+    v.it_interval = 2;
+    v.it_value = 2;
+    setitimer(which[i], &v, 0);
+    start = uptime();
+    while(uptime() - start < ticks)
+      ;
+    v.it_interval = v.it_value = 0;
+    setitimer(which[i], &v, 0);
+    printf(1, "sigbench %s %d of %d expiries\n", names[i], count, ticks / 2);
+  }
+}
+
+static void
+mask_cost(int rounds)
+{
+  uint64 t0, t1;
+  int i;
+
+  t0 = rdtsc();
+  for(i = 0; i < rounds; i++)
+    sigprocmask(i & 1 ? (1 << SIGUSR2) : 0);
+  t1 = rdtsc();
+  sigprocmask(0);
+  printf(1, "sigbench sigprocmask %d cycles\n", div64(t1 - t0, rounds));
+}
+
+int
+main(int argc, char *argv[])
+{
+  int rounds;
+
+  rounds = argc > 1 ? atoi(argv[1]) : 1000;
+  if(rounds <= 0){
+    printf(2, "usage: sigbench [rounds]\n");
+    exit(1);
+  }
+
+  self_latency(rounds);
+  pingpong(rounds);
+  waitpingpong(rounds);
+  resume_latency(rounds < 50 ? rounds : 50);
+  burst(rounds);
+  reaper(rounds < 200 ? rounds : 200);
+  itimers(100);
+  mask_cost(rounds * 10);
+  exit(0);
+}
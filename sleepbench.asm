@@ -0,0 +1,1824 @@
+
+_sleepbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 28 01 00 00    	sub    $0x128,%esp
+  17:	8b 19                	mov    (%ecx),%ebx
+  19:	8b 79 04             	mov    0x4(%ecx),%edi
+  int nsleep, n, i, pid, pids[MAXSLEEP];
+  uint alone, loaded;
+
+  nsleep = argc > 1 ? atoi(argv[1]) : MAXSLEEP;
+  1c:	83 fb 01             	cmp    $0x1,%ebx
+  1f:	0f 8f fe 01 00 00    	jg     223 <main+0x223>
+  if(nsleep < 0 || nsleep > MAXSLEEP || n <= 0){
+    printf(2, "usage: sleepbench [nsleep [ticks]]\n");
+    exit(1);
+  }
+
+  alone = spin(n);
+  25:	b8 2c 01 00 00       	mov    $0x12c,%eax
+  nsleep = argc > 1 ? atoi(argv[1]) : MAXSLEEP;
+  2a:	be 3c 00 00 00       	mov    $0x3c,%esi
+  alone = spin(n);
+  2f:	e8 ac 02 00 00       	call   2e0 <spin>
+  n = argc > 2 ? atoi(argv[2]) : 300;
+  34:	c7 85 d4 fe ff ff 2c 	movl   $0x12c,-0x12c(%ebp)
+  3b:	01 00 00 
+  alone = spin(n);
+  3e:	89 85 cc fe ff ff    	mov    %eax,-0x134(%ebp)
+
+  for(i = 0; i < nsleep; i++){
+  44:	31 ff                	xor    %edi,%edi
+  46:	eb 22                	jmp    6a <main+0x6a>
+  48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  4f:	90                   	nop
+    if((pid = fork()) < 0)
+      break;
+    if(pid == 0){
+  50:	0f 84 ab 01 00 00    	je     201 <main+0x201>
+      for(;;)
+        sleep(100000);
+    }
+    pids[i] = pid;
+  56:	8d 9d f8 fe ff ff    	lea    -0x108(%ebp),%ebx
+  5c:	89 04 bb             	mov    %eax,(%ebx,%edi,4)
+  for(i = 0; i < nsleep; i++){
+  5f:	83 c7 01             	add    $0x1,%edi
+  62:	39 f7                	cmp    %esi,%edi
+  64:	0f 8d 14 02 00 00    	jge    27e <main+0x27e>
+    if((pid = fork()) < 0)
+  6a:	e8 e8 05 00 00       	call   657 <fork>
+  6f:	85 c0                	test   %eax,%eax
+  71:	79 dd                	jns    50 <main+0x50>
+  }
+  nsleep = i;
+  sleep(10);  // let the sleepers get to sleep
+  73:	83 ec 0c             	sub    $0xc,%esp
+  76:	6a 0a                	push   $0xa
+  78:	e8 ae 07 00 00       	call   82b <sleep>
+
+  loaded = spin(n);
+  7d:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+  83:	e8 58 02 00 00       	call   2e0 <spin>
+
+  for(i = 0; i < nsleep; i++)
+  88:	83 c4 10             	add    $0x10,%esp
+  loaded = spin(n);
+  8b:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+  for(i = 0; i < nsleep; i++)
+  91:	85 ff                	test   %edi,%edi
+  93:	0f 84 3f 02 00 00    	je     2d8 <main+0x2d8>
+  99:	8d 9d f8 fe ff ff    	lea    -0x108(%ebp),%ebx
+  9f:	89 de                	mov    %ebx,%esi
+  a1:	8d 1c bb             	lea    (%ebx,%edi,4),%ebx
+  a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    kill(pids[i], SIGKILL);
+  a8:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < nsleep; i++)
+  ab:	83 c6 04             	add    $0x4,%esi
+    kill(pids[i], SIGKILL);
+  ae:	6a 09                	push   $0x9
+  b0:	ff 76 fc             	push   -0x4(%esi)
+  b3:	e8 55 06 00 00       	call   70d <kill>
+  for(i = 0; i < nsleep; i++)
+  b8:	83 c4 10             	add    $0x10,%esp
+  bb:	39 de                	cmp    %ebx,%esi
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  for(i = 0; i < nsleep; i++)
+  bf:	31 db                	xor    %ebx,%ebx
+  c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+  c8:	e8 be 05 00 00       	call   68b <wait>
+  for(i = 0; i < nsleep; i++)
+  cd:	83 c3 01             	add    $0x1,%ebx
+  d0:	39 fb                	cmp    %edi,%ebx
+  d2:	75 f4                	jne    c8 <main+0xc8>
+
+  if(alone == 0)
+  d4:	8b 85 cc fe ff ff    	mov    -0x134(%ebp),%eax
+  da:	bb 01 00 00 00       	mov    $0x1,%ebx
+    alone = 1;
+  printf(1, "sleepbench sleepers %d ticks %d alone %d loaded %d loss %d%%\n",
+  df:	8b b5 d0 fe ff ff    	mov    -0x130(%ebp),%esi
+  e5:	85 c0                	test   %eax,%eax
+  e7:	0f 45 d8             	cmovne %eax,%ebx
+  ea:	31 c0                	xor    %eax,%eax
+  ec:	39 de                	cmp    %ebx,%esi
+  ee:	73 0b                	jae    fb <main+0xfb>
+         nsleep, n, alone, loaded,
+         loaded < alone ? (alone - loaded) * 100 / alone : 0);
+  f0:	89 d8                	mov    %ebx,%eax
+  printf(1, "sleepbench sleepers %d ticks %d alone %d loaded %d loss %d%%\n",
+  f2:	31 d2                	xor    %edx,%edx
+         loaded < alone ? (alone - loaded) * 100 / alone : 0);
+  f4:	29 f0                	sub    %esi,%eax
+  f6:	6b c0 64             	imul   $0x64,%eax,%eax
+  printf(1, "sleepbench sleepers %d ticks %d alone %d loaded %d loss %d%%\n",
+  f9:	f7 f3                	div    %ebx
+  fb:	51                   	push   %ecx
+  fc:	50                   	push   %eax
+  fd:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+ 103:	53                   	push   %ebx
+ 104:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+ 10a:	57                   	push   %edi
+ 10b:	68 ac 0d 00 00       	push   $0xdac
+ 110:	6a 01                	push   $0x1
+  for(i = 0; i < sizeof(us) / sizeof(us[0]); i++){
+ 112:	31 db                	xor    %ebx,%ebx
+  printf(1, "sleepbench sleepers %d ticks %d alone %d loaded %d loss %d%%\n",
+ 114:	e8 47 09 00 00       	call   a60 <printf>
+ 119:	83 c4 20             	add    $0x20,%esp
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    req.tv_nsec = us[i] * 1000;
+ 120:	8b 04 9d 14 0e 00 00 	mov    0xe14(,%ebx,4),%eax
+    late = 0;
+ 127:	89 9d d0 fe ff ff    	mov    %ebx,-0x130(%ebp)
+    req.tv_nsec = us[i] * 1000;
+ 12d:	be 14 00 00 00       	mov    $0x14,%esi
+    late = 0;
+ 132:	31 ff                	xor    %edi,%edi
+    req.tv_sec = 0;
+ 134:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%ebp)
+ 13b:	00 00 00 
+    req.tv_nsec = us[i] * 1000;
+ 13e:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+ 144:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+ 14a:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+ 150:	83 ec 08             	sub    $0x8,%esp
+ 153:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+ 159:	50                   	push   %eax
+ 15a:	6a 01                	push   $0x1
+ 15c:	e8 7f 04 00 00       	call   5e0 <clock_gettime>
+      nanosleep(&req);
+ 161:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+ 167:	89 04 24             	mov    %eax,(%esp)
+ 16a:	e8 da 07 00 00       	call   949 <nanosleep>
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+ 16f:	58                   	pop    %eax
+ 170:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+ 176:	5a                   	pop    %edx
+ 177:	50                   	push   %eax
+ 178:	6a 01                	push   $0x1
+ 17a:	e8 61 04 00 00       	call   5e0 <clock_gettime>
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 17f:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+ 184:	8b 9d f4 fe ff ff    	mov    -0x10c(%ebp),%ebx
+    for(j = 0; j < 20; j++){
+ 18a:	83 c4 10             	add    $0x10,%esp
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 18d:	2b 9d ec fe ff ff    	sub    -0x114(%ebp),%ebx
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 193:	8b 8d f0 fe ff ff    	mov    -0x110(%ebp),%ecx
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 199:	f7 eb                	imul   %ebx
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 19b:	2b 8d e8 fe ff ff    	sub    -0x118(%ebp),%ecx
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 1a1:	c1 fb 1f             	sar    $0x1f,%ebx
+      late += usecs(&t0, &t1) - us[i];
+ 1a4:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 1aa:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+ 1b0:	c1 fa 06             	sar    $0x6,%edx
+ 1b3:	29 da                	sub    %ebx,%edx
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+ 1b5:	01 d1                	add    %edx,%ecx
+      late += usecs(&t0, &t1) - us[i];
+ 1b7:	29 c1                	sub    %eax,%ecx
+ 1b9:	01 cf                	add    %ecx,%edi
+    for(j = 0; j < 20; j++){
+ 1bb:	83 ee 01             	sub    $0x1,%esi
+ 1be:	75 90                	jne    150 <main+0x150>
+    printf(1, "sleepbench nanosleep %d us late %d us\n", us[i], late / 20);
+ 1c0:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ 1c5:	8b 9d d0 fe ff ff    	mov    -0x130(%ebp),%ebx
+ 1cb:	f7 ef                	imul   %edi
+ 1cd:	c1 ff 1f             	sar    $0x1f,%edi
+  for(i = 0; i < sizeof(us) / sizeof(us[0]); i++){
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "sleepbench nanosleep %d us late %d us\n", us[i], late / 20);
+ 1d3:	c1 fa 03             	sar    $0x3,%edx
+ 1d6:	29 fa                	sub    %edi,%edx
+ 1d8:	52                   	push   %edx
+ 1d9:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+ 1df:	68 ec 0d 00 00       	push   $0xdec
+ 1e4:	6a 01                	push   $0x1
+ 1e6:	e8 75 08 00 00       	call   a60 <printf>
+  for(i = 0; i < sizeof(us) / sizeof(us[0]); i++){
+ 1eb:	83 c4 10             	add    $0x10,%esp
+ 1ee:	83 fb 05             	cmp    $0x5,%ebx
+ 1f1:	0f 85 29 ff ff ff    	jne    120 <main+0x120>
+  oversleep();
+  exit(0);
+ 1f7:	83 ec 0c             	sub    $0xc,%esp
+ 1fa:	6a 00                	push   $0x0
+ 1fc:	e8 70 04 00 00       	call   671 <exit>
+        sleep(100000);
+ 201:	83 ec 0c             	sub    $0xc,%esp
+ 204:	68 a0 86 01 00       	push   $0x186a0
+ 209:	e8 1d 06 00 00       	call   82b <sleep>
+ 20e:	83 c4 10             	add    $0x10,%esp
+ 211:	83 ec 0c             	sub    $0xc,%esp
+ 214:	68 a0 86 01 00       	push   $0x186a0
+ 219:	e8 0d 06 00 00       	call   82b <sleep>
+ 21e:	83 c4 10             	add    $0x10,%esp
+ 221:	eb de                	jmp    201 <main+0x201>
+  nsleep = argc > 1 ? atoi(argv[1]) : MAXSLEEP;
+ 223:	83 ec 0c             	sub    $0xc,%esp
+ 226:	ff 77 04             	push   0x4(%edi)
+ 229:	e8 e2 02 00 00       	call   510 <atoi>
+  n = argc > 2 ? atoi(argv[2]) : 300;
+ 22e:	83 c4 10             	add    $0x10,%esp
+ 231:	c7 85 d4 fe ff ff 2c 	movl   $0x12c,-0x12c(%ebp)
+ 238:	01 00 00 
+  nsleep = argc > 1 ? atoi(argv[1]) : MAXSLEEP;
+ 23b:	89 c6                	mov    %eax,%esi
+  n = argc > 2 ? atoi(argv[2]) : 300;
+ 23d:	83 fb 02             	cmp    $0x2,%ebx
+ 240:	74 14                	je     256 <main+0x256>
+ 242:	83 ec 0c             	sub    $0xc,%esp
+ 245:	ff 77 08             	push   0x8(%edi)
+ 248:	e8 c3 02 00 00       	call   510 <atoi>
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  if(nsleep < 0 || nsleep > MAXSLEEP || n <= 0){
+ 256:	83 fe 3c             	cmp    $0x3c,%esi
+ 259:	77 09                	ja     264 <main+0x264>
+ 25b:	83 bd d4 fe ff ff 00 	cmpl   $0x0,-0x12c(%ebp)
+ 262:	7f 3d                	jg     2a1 <main+0x2a1>
+    printf(2, "usage: sleepbench [nsleep [ticks]]\n");
+ 264:	53                   	push   %ebx
+ 265:	53                   	push   %ebx
+ 266:	68 88 0d 00 00       	push   $0xd88
+ 26b:	6a 02                	push   $0x2
+ 26d:	e8 ee 07 00 00       	call   a60 <printf>
+    exit(1);
+ 272:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 279:	e8 f3 03 00 00       	call   671 <exit>
+  sleep(10);  // let the sleepers get to sleep
+ 27e:	83 ec 0c             	sub    $0xc,%esp
+ 281:	6a 0a                	push   $0xa
+ 283:	e8 a3 05 00 00       	call   82b <sleep>
+  loaded = spin(n);
+ 288:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+ 28e:	e8 4d 00 00 00       	call   2e0 <spin>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+  for(i = 0; i < nsleep; i++)
+ 29c:	e9 fe fd ff ff       	jmp    9f <main+0x9f>
+  alone = spin(n);
+ 2a1:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+ 2a7:	e8 34 00 00 00       	call   2e0 <spin>
+ 2ac:	89 85 cc fe ff ff    	mov    %eax,-0x134(%ebp)
+  for(i = 0; i < nsleep; i++){
+ 2b2:	85 f6                	test   %esi,%esi
+ 2b4:	0f 85 8a fd ff ff    	jne    44 <main+0x44>
+  sleep(10);  // let the sleepers get to sleep
+ 2ba:	83 ec 0c             	sub    $0xc,%esp
+ 2bd:	6a 0a                	push   $0xa
+ 2bf:	e8 67 05 00 00       	call   82b <sleep>
+  loaded = spin(n);
+ 2c4:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+ 2ca:	e8 11 00 00 00       	call   2e0 <spin>
+ 2cf:	83 c4 10             	add    $0x10,%esp
+ 2d2:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+  for(i = 0; i < nsleep; i++)
+ 2d8:	31 ff                	xor    %edi,%edi
+ 2da:	e9 f5 fd ff ff       	jmp    d4 <main+0xd4>
+ 2df:	90                   	nop
+
+000002e0 <spin>:
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	89 c7                	mov    %eax,%edi
+ 2e6:	56                   	push   %esi
+ 2e7:	53                   	push   %ebx
+  units = 0;
+ 2e8:	31 db                	xor    %ebx,%ebx
+{
+ 2ea:	83 ec 1c             	sub    $0x1c,%esp
+  start = uptime();
+ 2ed:	e8 de 02 00 00       	call   5d0 <uptime>
+  x = 0;
+ 2f2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  start = uptime();
+ 2f9:	89 c6                	mov    %eax,%esi
+  while(uptime() - start < n){
+ 2fb:	e8 d0 02 00 00       	call   5d0 <uptime>
+ 300:	29 f0                	sub    %esi,%eax
+ 302:	39 f8                	cmp    %edi,%eax
+ 304:	7d 26                	jge    32c <spin+0x4c>
+ 306:	ba 10 27 00 00       	mov    $0x2710,%edx
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+      x++;
+ 310:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 313:	83 c0 01             	add    $0x1,%eax
+ 316:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(j = 0; j < UNIT; j++)
+ 319:	83 ea 01             	sub    $0x1,%edx
+ 31c:	75 f2                	jne    310 <spin+0x30>
+  while(uptime() - start < n){
+ 31e:	e8 ad 02 00 00       	call   5d0 <uptime>
+    units++;
+ 323:	83 c3 01             	add    $0x1,%ebx
+  while(uptime() - start < n){
+ 326:	29 f0                	sub    %esi,%eax
+ 328:	39 f8                	cmp    %edi,%eax
+ 32a:	7c da                	jl     306 <spin+0x26>
+}
+ 32c:	83 c4 1c             	add    $0x1c,%esp
+ 32f:	89 d8                	mov    %ebx,%eax
+ 331:	5b                   	pop    %ebx
+ 332:	5e                   	pop    %esi
+ 333:	5f                   	pop    %edi
+ 334:	5d                   	pop    %ebp
+ 335:	c3                   	ret
+ 336:	66 90                	xchg   %ax,%ax
+ 338:	66 90                	xchg   %ax,%ax
+ 33a:	66 90                	xchg   %ax,%ax
+ 33c:	66 90                	xchg   %ax,%ax
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+ 377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 37a:	0f b6 02             	movzbl (%edx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 17                	jne    398 <strcmp+0x28>
+ 381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 38c:	83 c2 01             	add    $0x1,%edx
+ 38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 392:	84 c0                	test   %al,%al
+ 394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+ 396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 398:	0f b6 19             	movzbl (%ecx),%ebx
+ 39b:	38 c3                	cmp    %al,%bl
+ 39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 39f:	29 d8                	sub    %ebx,%eax
+}
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3b4:	31 c0                	xor    %eax,%eax
+ 3b6:	29 d8                	sub    %ebx,%eax
+}
+ 3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3c0:	31 c0                	xor    %eax,%eax
+ 3c2:	eb db                	jmp    39f <strcmp+0x2f>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 42 02 00 00       	call   6bf <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 6f 02 00 00       	call   741 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 a8 02 00 00       	call   78f <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 02 02 00 00       	call   6f3 <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 517:	0f be 02             	movsbl (%edx),%eax
+ 51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 525:	77 1e                	ja     545 <atoi+0x35>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 530:	83 c2 01             	add    $0x1,%edx
+ 533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 53a:	0f be 02             	movsbl (%edx),%eax
+ 53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 540:	80 fb 09             	cmp    $0x9,%bl
+ 543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+ 545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 548:	89 c8                	mov    %ecx,%eax
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	8b 45 10             	mov    0x10(%ebp),%eax
+ 558:	8b 55 08             	mov    0x8(%ebp),%edx
+ 55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 55e:	85 c0                	test   %eax,%eax
+ 560:	7e 13                	jle    575 <memmove+0x25>
+ 562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 571:	39 f8                	cmp    %edi,%eax
+ 573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+ 575:	5e                   	pop    %esi
+ 576:	89 d0                	mov    %edx,%eax
+ 578:	5f                   	pop    %edi
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+
+00000580 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 586:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 589:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 590:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 593:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 596:	50                   	push   %eax
+ 597:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 59a:	50                   	push   %eax
+ 59b:	6a 00                	push   $0x0
+ 59d:	e8 8d 03 00 00       	call   92f <setitimer>
+ 5a2:	83 c4 10             	add    $0x10,%esp
+ 5a5:	89 c2                	mov    %eax,%edx
+ 5a7:	31 c0                	xor    %eax,%eax
+ 5a9:	85 d2                	test   %edx,%edx
+ 5ab:	78 03                	js     5b0 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 5ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 5b0:	c9                   	leave
+ 5b1:	c3                   	ret
+ 5b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 5c0:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 5c5:	c3                   	ret
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005d0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 5d0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 5d5:	c3                   	ret
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005e0 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	53                   	push   %ebx
+ 5e6:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 5e9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 5ed:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 5f0:	75 5e                	jne    650 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 5f2:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 5f8:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 5fa:	89 d3                	mov    %edx,%ebx
+ 5fc:	89 c1                	mov    %eax,%ecx
+ 5fe:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 604:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 60a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 60d:	31 d2                	xor    %edx,%edx
+ 60f:	89 d8                	mov    %ebx,%eax
+ 611:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 614:	f7 f6                	div    %esi
+ 616:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 618:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 61b:	f7 f6                	div    %esi
+ 61d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 61f:	89 da                	mov    %ebx,%edx
+ 621:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 626:	f7 f3                	div    %ebx
+ 628:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 62a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 62f:	89 d3                	mov    %edx,%ebx
+ 631:	f7 e1                	mul    %ecx
+ 633:	f7 f6                	div    %esi
+ 635:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 63b:	01 c3                	add    %eax,%ebx
+  return 0;
+ 63d:	31 c0                	xor    %eax,%eax
+ 63f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 642:	83 c4 0c             	add    $0xc,%esp
+ 645:	5b                   	pop    %ebx
+ 646:	5e                   	pop    %esi
+ 647:	5f                   	pop    %edi
+ 648:	5d                   	pop    %ebp
+ 649:	c3                   	ret
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 650:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 655:	eb eb                	jmp    642 <clock_gettime+0x62>
+
+00000657 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 657:	b8 01 00 00 00       	mov    $0x1,%eax
+ 65c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 663:	74 09                	je     66e <fork+0x17>
+ 665:	89 e1                	mov    %esp,%ecx
+ 667:	ba 70 06 00 00       	mov    $0x670,%edx
+ 66c:	0f 34                	sysenter
+ 66e:	cd 40                	int    $0x40
+ 670:	c3                   	ret
+
+00000671 <exit>:
+SYSCALL(exit)
+ 671:	b8 02 00 00 00       	mov    $0x2,%eax
+ 676:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 67d:	74 09                	je     688 <exit+0x17>
+ 67f:	89 e1                	mov    %esp,%ecx
+ 681:	ba 8a 06 00 00       	mov    $0x68a,%edx
+ 686:	0f 34                	sysenter
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <wait>:
+SYSCALL(wait)
+ 68b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 690:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 697:	74 09                	je     6a2 <wait+0x17>
+ 699:	89 e1                	mov    %esp,%ecx
+ 69b:	ba a4 06 00 00       	mov    $0x6a4,%edx
+ 6a0:	0f 34                	sysenter
+ 6a2:	cd 40                	int    $0x40
+ 6a4:	c3                   	ret
+
+000006a5 <pipe>:
+SYSCALL(pipe)
+ 6a5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6aa:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6b1:	74 09                	je     6bc <pipe+0x17>
+ 6b3:	89 e1                	mov    %esp,%ecx
+ 6b5:	ba be 06 00 00       	mov    $0x6be,%edx
+ 6ba:	0f 34                	sysenter
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <read>:
+SYSCALL(read)
+ 6bf:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6c4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6cb:	74 09                	je     6d6 <read+0x17>
+ 6cd:	89 e1                	mov    %esp,%ecx
+ 6cf:	ba d8 06 00 00       	mov    $0x6d8,%edx
+ 6d4:	0f 34                	sysenter
+ 6d6:	cd 40                	int    $0x40
+ 6d8:	c3                   	ret
+
+000006d9 <write>:
+SYSCALL(write)
+ 6d9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6de:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6e5:	74 09                	je     6f0 <write+0x17>
+ 6e7:	89 e1                	mov    %esp,%ecx
+ 6e9:	ba f2 06 00 00       	mov    $0x6f2,%edx
+ 6ee:	0f 34                	sysenter
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <close>:
+SYSCALL(close)
+ 6f3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6f8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6ff:	74 09                	je     70a <close+0x17>
+ 701:	89 e1                	mov    %esp,%ecx
+ 703:	ba 0c 07 00 00       	mov    $0x70c,%edx
+ 708:	0f 34                	sysenter
+ 70a:	cd 40                	int    $0x40
+ 70c:	c3                   	ret
+
+0000070d <kill>:
+SYSCALL(kill)
+ 70d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 712:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 719:	74 09                	je     724 <kill+0x17>
+ 71b:	89 e1                	mov    %esp,%ecx
+ 71d:	ba 26 07 00 00       	mov    $0x726,%edx
+ 722:	0f 34                	sysenter
+ 724:	cd 40                	int    $0x40
+ 726:	c3                   	ret
+
+00000727 <exec>:
+SYSCALL(exec)
+ 727:	b8 07 00 00 00       	mov    $0x7,%eax
+ 72c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 733:	74 09                	je     73e <exec+0x17>
+ 735:	89 e1                	mov    %esp,%ecx
+ 737:	ba 40 07 00 00       	mov    $0x740,%edx
+ 73c:	0f 34                	sysenter
+ 73e:	cd 40                	int    $0x40
+ 740:	c3                   	ret
+
+00000741 <open>:
+SYSCALL(open)
+ 741:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 746:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 74d:	74 09                	je     758 <open+0x17>
+ 74f:	89 e1                	mov    %esp,%ecx
+ 751:	ba 5a 07 00 00       	mov    $0x75a,%edx
+ 756:	0f 34                	sysenter
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <mknod>:
+SYSCALL(mknod)
+ 75b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 760:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 767:	74 09                	je     772 <mknod+0x17>
+ 769:	89 e1                	mov    %esp,%ecx
+ 76b:	ba 74 07 00 00       	mov    $0x774,%edx
+ 770:	0f 34                	sysenter
+ 772:	cd 40                	int    $0x40
+ 774:	c3                   	ret
+
+00000775 <unlink>:
+SYSCALL(unlink)
+ 775:	b8 12 00 00 00       	mov    $0x12,%eax
+ 77a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 781:	74 09                	je     78c <unlink+0x17>
+ 783:	89 e1                	mov    %esp,%ecx
+ 785:	ba 8e 07 00 00       	mov    $0x78e,%edx
+ 78a:	0f 34                	sysenter
+ 78c:	cd 40                	int    $0x40
+ 78e:	c3                   	ret
+
+0000078f <fstat>:
+SYSCALL(fstat)
+ 78f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 794:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 79b:	74 09                	je     7a6 <fstat+0x17>
+ 79d:	89 e1                	mov    %esp,%ecx
+ 79f:	ba a8 07 00 00       	mov    $0x7a8,%edx
+ 7a4:	0f 34                	sysenter
+ 7a6:	cd 40                	int    $0x40
+ 7a8:	c3                   	ret
+
+000007a9 <link>:
+SYSCALL(link)
+ 7a9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7ae:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7b5:	74 09                	je     7c0 <link+0x17>
+ 7b7:	89 e1                	mov    %esp,%ecx
+ 7b9:	ba c2 07 00 00       	mov    $0x7c2,%edx
+ 7be:	0f 34                	sysenter
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <mkdir>:
+SYSCALL(mkdir)
+ 7c3:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7c8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7cf:	74 09                	je     7da <mkdir+0x17>
+ 7d1:	89 e1                	mov    %esp,%ecx
+ 7d3:	ba dc 07 00 00       	mov    $0x7dc,%edx
+ 7d8:	0f 34                	sysenter
+ 7da:	cd 40                	int    $0x40
+ 7dc:	c3                   	ret
+
+000007dd <chdir>:
+SYSCALL(chdir)
+ 7dd:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7e2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7e9:	74 09                	je     7f4 <chdir+0x17>
+ 7eb:	89 e1                	mov    %esp,%ecx
+ 7ed:	ba f6 07 00 00       	mov    $0x7f6,%edx
+ 7f2:	0f 34                	sysenter
+ 7f4:	cd 40                	int    $0x40
+ 7f6:	c3                   	ret
+
+000007f7 <dup>:
+SYSCALL(dup)
+ 7f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7fc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 803:	74 09                	je     80e <dup+0x17>
+ 805:	89 e1                	mov    %esp,%ecx
+ 807:	ba 10 08 00 00       	mov    $0x810,%edx
+ 80c:	0f 34                	sysenter
+ 80e:	cd 40                	int    $0x40
+ 810:	c3                   	ret
+
+00000811 <sbrk>:
+SYSCALL(sbrk)
+ 811:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 816:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 81d:	74 09                	je     828 <sbrk+0x17>
+ 81f:	89 e1                	mov    %esp,%ecx
+ 821:	ba 2a 08 00 00       	mov    $0x82a,%edx
+ 826:	0f 34                	sysenter
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <sleep>:
+SYSCALL(sleep)
+ 82b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 830:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 837:	74 09                	je     842 <sleep+0x17>
+ 839:	89 e1                	mov    %esp,%ecx
+ 83b:	ba 44 08 00 00       	mov    $0x844,%edx
+ 840:	0f 34                	sysenter
+ 842:	cd 40                	int    $0x40
+ 844:	c3                   	ret
+
+00000845 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 845:	b8 16 00 00 00       	mov    $0x16,%eax
+ 84a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 851:	74 09                	je     85c <sigprocmask+0x17>
+ 853:	89 e1                	mov    %esp,%ecx
+ 855:	ba 5e 08 00 00       	mov    $0x85e,%edx
+ 85a:	0f 34                	sysenter
+ 85c:	cd 40                	int    $0x40
+ 85e:	c3                   	ret
+
+0000085f <sigaction>:
+SYSCALL(sigaction)
+ 85f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 864:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 86b:	74 09                	je     876 <sigaction+0x17>
+ 86d:	89 e1                	mov    %esp,%ecx
+ 86f:	ba 78 08 00 00       	mov    $0x878,%edx
+ 874:	0f 34                	sysenter
+ 876:	cd 40                	int    $0x40
+ 878:	c3                   	ret
+
+00000879 <sigret>:
+SYSCALL(sigret)
+ 879:	b8 18 00 00 00       	mov    $0x18,%eax
+ 87e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 885:	74 09                	je     890 <sigret+0x17>
+ 887:	89 e1                	mov    %esp,%ecx
+ 889:	ba 92 08 00 00       	mov    $0x892,%edx
+ 88e:	0f 34                	sysenter
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <traceread>:
+SYSCALL(traceread)
+ 893:	b8 19 00 00 00       	mov    $0x19,%eax
+ 898:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 89f:	74 09                	je     8aa <traceread+0x17>
+ 8a1:	89 e1                	mov    %esp,%ecx
+ 8a3:	ba ac 08 00 00       	mov    $0x8ac,%edx
+ 8a8:	0f 34                	sysenter
+ 8aa:	cd 40                	int    $0x40
+ 8ac:	c3                   	ret
+
+000008ad <sigqueue>:
+SYSCALL(sigqueue)
+ 8ad:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8b2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8b9:	74 09                	je     8c4 <sigqueue+0x17>
+ 8bb:	89 e1                	mov    %esp,%ecx
+ 8bd:	ba c6 08 00 00       	mov    $0x8c6,%edx
+ 8c2:	0f 34                	sysenter
+ 8c4:	cd 40                	int    $0x40
+ 8c6:	c3                   	ret
+
+000008c7 <signalfd>:
+SYSCALL(signalfd)
+ 8c7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8cc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8d3:	74 09                	je     8de <signalfd+0x17>
+ 8d5:	89 e1                	mov    %esp,%ecx
+ 8d7:	ba e0 08 00 00       	mov    $0x8e0,%edx
+ 8dc:	0f 34                	sysenter
+ 8de:	cd 40                	int    $0x40
+ 8e0:	c3                   	ret
+
+000008e1 <sigwait>:
+SYSCALL(sigwait)
+ 8e1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8e6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 8ed:	74 09                	je     8f8 <sigwait+0x17>
+ 8ef:	89 e1                	mov    %esp,%ecx
+ 8f1:	ba fa 08 00 00       	mov    $0x8fa,%edx
+ 8f6:	0f 34                	sysenter
+ 8f8:	cd 40                	int    $0x40
+ 8fa:	c3                   	ret
+
+000008fb <sigsuspend>:
+SYSCALL(sigsuspend)
+ 8fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 900:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 907:	74 09                	je     912 <sigsuspend+0x17>
+ 909:	89 e1                	mov    %esp,%ecx
+ 90b:	ba 14 09 00 00       	mov    $0x914,%edx
+ 910:	0f 34                	sysenter
+ 912:	cd 40                	int    $0x40
+ 914:	c3                   	ret
+
+00000915 <waitpid>:
+SYSCALL(waitpid)
+ 915:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 91a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 921:	74 09                	je     92c <waitpid+0x17>
+ 923:	89 e1                	mov    %esp,%ecx
+ 925:	ba 2e 09 00 00       	mov    $0x92e,%edx
+ 92a:	0f 34                	sysenter
+ 92c:	cd 40                	int    $0x40
+ 92e:	c3                   	ret
+
+0000092f <setitimer>:
+SYSCALL(setitimer)
+ 92f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 934:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 93b:	74 09                	je     946 <setitimer+0x17>
+ 93d:	89 e1                	mov    %esp,%ecx
+ 93f:	ba 48 09 00 00       	mov    $0x948,%edx
+ 944:	0f 34                	sysenter
+ 946:	cd 40                	int    $0x40
+ 948:	c3                   	ret
+
+00000949 <nanosleep>:
+SYSCALL(nanosleep)
+ 949:	b8 21 00 00 00       	mov    $0x21,%eax
+ 94e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 955:	74 09                	je     960 <nanosleep+0x17>
+ 957:	89 e1                	mov    %esp,%ecx
+ 959:	ba 62 09 00 00       	mov    $0x962,%edx
+ 95e:	0f 34                	sysenter
+ 960:	cd 40                	int    $0x40
+ 962:	c3                   	ret
+
+00000963 <mmap>:
+SYSCALL(mmap)
+ 963:	b8 22 00 00 00       	mov    $0x22,%eax
+ 968:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 96f:	74 09                	je     97a <mmap+0x17>
+ 971:	89 e1                	mov    %esp,%ecx
+ 973:	ba 7c 09 00 00       	mov    $0x97c,%edx
+ 978:	0f 34                	sysenter
+ 97a:	cd 40                	int    $0x40
+ 97c:	c3                   	ret
+
+0000097d <munmap>:
+SYSCALL(munmap)
+ 97d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 982:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 989:	74 09                	je     994 <munmap+0x17>
+ 98b:	89 e1                	mov    %esp,%ecx
+ 98d:	ba 96 09 00 00       	mov    $0x996,%edx
+ 992:	0f 34                	sysenter
+ 994:	cd 40                	int    $0x40
+ 996:	c3                   	ret
+
+00000997 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 997:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 99c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 9a3:	74 09                	je     9ae <getpid_syscall+0x17>
+ 9a5:	89 e1                	mov    %esp,%ecx
+ 9a7:	ba b0 09 00 00       	mov    $0x9b0,%edx
+ 9ac:	0f 34                	sysenter
+ 9ae:	cd 40                	int    $0x40
+ 9b0:	c3                   	ret
+
+000009b1 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 9b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 9b6:	cd 40                	int    $0x40
+ 9b8:	c3                   	ret
+ 9b9:	66 90                	xchg   %ax,%ax
+ 9bb:	66 90                	xchg   %ax,%ax
+ 9bd:	66 90                	xchg   %ax,%ax
+ 9bf:	90                   	nop
+
+000009c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+ 9c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9c8:	89 d1                	mov    %edx,%ecx
+{
+ 9ca:	83 ec 3c             	sub    $0x3c,%esp
+ 9cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9d0:	85 d2                	test   %edx,%edx
+ 9d2:	0f 89 80 00 00 00    	jns    a58 <printint+0x98>
+ 9d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9dc:	74 7a                	je     a58 <printint+0x98>
+    x = -xx;
+ 9de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9e8:	31 f6                	xor    %esi,%esi
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9f0:	89 c8                	mov    %ecx,%eax
+ 9f2:	31 d2                	xor    %edx,%edx
+ 9f4:	89 f7                	mov    %esi,%edi
+ 9f6:	f7 f3                	div    %ebx
+ 9f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9fb:	0f b6 92 88 0e 00 00 	movzbl 0xe88(%edx),%edx
+ a02:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a06:	89 ca                	mov    %ecx,%edx
+ a08:	89 c1                	mov    %eax,%ecx
+ a0a:	39 da                	cmp    %ebx,%edx
+ a0c:	73 e2                	jae    9f0 <printint+0x30>
+  if(neg)
+ a0e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a11:	85 c0                	test   %eax,%eax
+ a13:	74 07                	je     a1c <printint+0x5c>
+    buf[i++] = '-';
+ a15:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a1a:	89 f7                	mov    %esi,%edi
+ a1c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a1f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a22:	01 df                	add    %ebx,%edi
+ a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a28:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a2b:	83 ec 04             	sub    $0x4,%esp
+ a2e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a31:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a34:	6a 01                	push   $0x1
+ a36:	50                   	push   %eax
+ a37:	56                   	push   %esi
+ a38:	e8 9c fc ff ff       	call   6d9 <write>
+  while(--i >= 0)
+ a3d:	89 f8                	mov    %edi,%eax
+ a3f:	83 c4 10             	add    $0x10,%esp
+ a42:	83 ef 01             	sub    $0x1,%edi
+ a45:	39 d8                	cmp    %ebx,%eax
+ a47:	75 df                	jne    a28 <printint+0x68>
+}
+ a49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a4c:	5b                   	pop    %ebx
+ a4d:	5e                   	pop    %esi
+ a4e:	5f                   	pop    %edi
+ a4f:	5d                   	pop    %ebp
+ a50:	c3                   	ret
+ a51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a58:	31 c0                	xor    %eax,%eax
+ a5a:	eb 89                	jmp    9e5 <printint+0x25>
+ a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a60 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a69:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a6f:	0f b6 1e             	movzbl (%esi),%ebx
+ a72:	83 c6 01             	add    $0x1,%esi
+ a75:	84 db                	test   %bl,%bl
+ a77:	74 67                	je     ae0 <printf+0x80>
+ a79:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a7c:	31 d2                	xor    %edx,%edx
+ a7e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a81:	eb 34                	jmp    ab7 <printf+0x57>
+ a83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a87:	90                   	nop
+ a88:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a8b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a90:	83 f8 25             	cmp    $0x25,%eax
+ a93:	74 18                	je     aad <printf+0x4d>
+  write(fd, &c, 1);
+ a95:	83 ec 04             	sub    $0x4,%esp
+ a98:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a9b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a9e:	6a 01                	push   $0x1
+ aa0:	50                   	push   %eax
+ aa1:	57                   	push   %edi
+ aa2:	e8 32 fc ff ff       	call   6d9 <write>
+ aa7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ aaa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ aad:	0f b6 1e             	movzbl (%esi),%ebx
+ ab0:	83 c6 01             	add    $0x1,%esi
+ ab3:	84 db                	test   %bl,%bl
+ ab5:	74 29                	je     ae0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ ab7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ aba:	85 d2                	test   %edx,%edx
+ abc:	74 ca                	je     a88 <printf+0x28>
+      }
+    } else if(state == '%'){
+ abe:	83 fa 25             	cmp    $0x25,%edx
+ ac1:	75 ea                	jne    aad <printf+0x4d>
+      if(c == 'd'){
+ ac3:	83 f8 25             	cmp    $0x25,%eax
+ ac6:	0f 84 24 01 00 00    	je     bf0 <printf+0x190>
+ acc:	83 e8 63             	sub    $0x63,%eax
+ acf:	83 f8 15             	cmp    $0x15,%eax
+ ad2:	77 1c                	ja     af0 <printf+0x90>
+ ad4:	ff 24 85 30 0e 00 00 	jmp    *0xe30(,%eax,4)
+ adb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ ae0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ae3:	5b                   	pop    %ebx
+ ae4:	5e                   	pop    %esi
+ ae5:	5f                   	pop    %edi
+ ae6:	5d                   	pop    %ebp
+ ae7:	c3                   	ret
+ ae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+  write(fd, &c, 1);
+ af0:	83 ec 04             	sub    $0x4,%esp
+ af3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ af6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ afa:	6a 01                	push   $0x1
+ afc:	52                   	push   %edx
+ afd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b00:	57                   	push   %edi
+ b01:	e8 d3 fb ff ff       	call   6d9 <write>
+ b06:	83 c4 0c             	add    $0xc,%esp
+ b09:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b0c:	6a 01                	push   $0x1
+ b0e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b11:	52                   	push   %edx
+ b12:	57                   	push   %edi
+ b13:	e8 c1 fb ff ff       	call   6d9 <write>
+        putc(fd, c);
+ b18:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b1b:	31 d2                	xor    %edx,%edx
+ b1d:	eb 8e                	jmp    aad <printf+0x4d>
+ b1f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b23:	83 ec 0c             	sub    $0xc,%esp
+ b26:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b2b:	8b 13                	mov    (%ebx),%edx
+ b2d:	6a 00                	push   $0x0
+ b2f:	89 f8                	mov    %edi,%eax
+        ap++;
+ b31:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b34:	e8 87 fe ff ff       	call   9c0 <printint>
+        ap++;
+ b39:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b3c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b3f:	31 d2                	xor    %edx,%edx
+ b41:	e9 67 ff ff ff       	jmp    aad <printf+0x4d>
+ b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b50:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b53:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b55:	83 c0 04             	add    $0x4,%eax
+ b58:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b5b:	85 db                	test   %ebx,%ebx
+ b5d:	0f 84 9d 00 00 00    	je     c00 <printf+0x1a0>
+        while(*s != 0){
+ b63:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b66:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b68:	84 c0                	test   %al,%al
+ b6a:	0f 84 3d ff ff ff    	je     aad <printf+0x4d>
+ b70:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b73:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b76:	89 de                	mov    %ebx,%esi
+ b78:	89 d3                	mov    %edx,%ebx
+ b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b80:	83 ec 04             	sub    $0x4,%esp
+ b83:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b86:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b89:	6a 01                	push   $0x1
+ b8b:	53                   	push   %ebx
+ b8c:	57                   	push   %edi
+ b8d:	e8 47 fb ff ff       	call   6d9 <write>
+        while(*s != 0){
+ b92:	0f b6 06             	movzbl (%esi),%eax
+ b95:	83 c4 10             	add    $0x10,%esp
+ b98:	84 c0                	test   %al,%al
+ b9a:	75 e4                	jne    b80 <printf+0x120>
+      state = 0;
+ b9c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b9f:	31 d2                	xor    %edx,%edx
+ ba1:	e9 07 ff ff ff       	jmp    aad <printf+0x4d>
+ ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ bb0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bb3:	83 ec 0c             	sub    $0xc,%esp
+ bb6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bbb:	8b 13                	mov    (%ebx),%edx
+ bbd:	6a 01                	push   $0x1
+ bbf:	e9 6b ff ff ff       	jmp    b2f <printf+0xcf>
+ bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ bc8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ bcb:	83 ec 04             	sub    $0x4,%esp
+ bce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ bd1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ bd3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ bd6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ bd9:	6a 01                	push   $0x1
+ bdb:	52                   	push   %edx
+ bdc:	57                   	push   %edi
+ bdd:	e8 f7 fa ff ff       	call   6d9 <write>
+        ap++;
+ be2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ be5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ be8:	31 d2                	xor    %edx,%edx
+ bea:	e9 be fe ff ff       	jmp    aad <printf+0x4d>
+ bef:	90                   	nop
+  write(fd, &c, 1);
+ bf0:	83 ec 04             	sub    $0x4,%esp
+ bf3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bf6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bf9:	6a 01                	push   $0x1
+ bfb:	e9 11 ff ff ff       	jmp    b11 <printf+0xb1>
+ c00:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c05:	bb 28 0e 00 00       	mov    $0xe28,%ebx
+ c0a:	e9 61 ff ff ff       	jmp    b70 <printf+0x110>
+ c0f:	90                   	nop
+
+00000c10 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c10:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c11:	a1 d8 11 00 00       	mov    0x11d8,%eax
+{
+ c16:	89 e5                	mov    %esp,%ebp
+ c18:	57                   	push   %edi
+ c19:	56                   	push   %esi
+ c1a:	53                   	push   %ebx
+ c1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c1e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c28:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c2a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c2c:	39 ca                	cmp    %ecx,%edx
+ c2e:	73 30                	jae    c60 <free+0x50>
+ c30:	39 c1                	cmp    %eax,%ecx
+ c32:	72 04                	jb     c38 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c34:	39 c2                	cmp    %eax,%edx
+ c36:	72 f0                	jb     c28 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c38:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c3b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c3e:	39 f8                	cmp    %edi,%eax
+ c40:	74 2e                	je     c70 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c42:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c45:	8b 42 04             	mov    0x4(%edx),%eax
+ c48:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c4b:	39 f1                	cmp    %esi,%ecx
+ c4d:	74 38                	je     c87 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c4f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c51:	5b                   	pop    %ebx
+  freep = p;
+ c52:	89 15 d8 11 00 00    	mov    %edx,0x11d8
+}
+ c58:	5e                   	pop    %esi
+ c59:	5f                   	pop    %edi
+ c5a:	5d                   	pop    %ebp
+ c5b:	c3                   	ret
+ c5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c60:	39 c1                	cmp    %eax,%ecx
+ c62:	72 d0                	jb     c34 <free+0x24>
+ c64:	eb c2                	jmp    c28 <free+0x18>
+ c66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c6d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c70:	03 70 04             	add    0x4(%eax),%esi
+ c73:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c76:	8b 02                	mov    (%edx),%eax
+ c78:	8b 00                	mov    (%eax),%eax
+ c7a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c7d:	8b 42 04             	mov    0x4(%edx),%eax
+ c80:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c83:	39 f1                	cmp    %esi,%ecx
+ c85:	75 c8                	jne    c4f <free+0x3f>
+    p->s.size += bp->s.size;
+ c87:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c8a:	89 15 d8 11 00 00    	mov    %edx,0x11d8
+    p->s.size += bp->s.size;
+ c90:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c93:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c96:	89 0a                	mov    %ecx,(%edx)
+}
+ c98:	5b                   	pop    %ebx
+ c99:	5e                   	pop    %esi
+ c9a:	5f                   	pop    %edi
+ c9b:	5d                   	pop    %ebp
+ c9c:	c3                   	ret
+ c9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ca0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ca0:	55                   	push   %ebp
+ ca1:	89 e5                	mov    %esp,%ebp
+ ca3:	57                   	push   %edi
+ ca4:	56                   	push   %esi
+ ca5:	53                   	push   %ebx
+ ca6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ cac:	8b 15 d8 11 00 00    	mov    0x11d8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cb2:	8d 78 07             	lea    0x7(%eax),%edi
+ cb5:	c1 ef 03             	shr    $0x3,%edi
+ cb8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ cbb:	85 d2                	test   %edx,%edx
+ cbd:	0f 84 8d 00 00 00    	je     d50 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cc3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cc5:	8b 48 04             	mov    0x4(%eax),%ecx
+ cc8:	39 f9                	cmp    %edi,%ecx
+ cca:	73 64                	jae    d30 <malloc+0x90>
+  if(nu < 4096)
+ ccc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ cd1:	39 df                	cmp    %ebx,%edi
+ cd3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ cd6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ cdd:	eb 0a                	jmp    ce9 <malloc+0x49>
+ cdf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ce0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ce2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ce5:	39 f9                	cmp    %edi,%ecx
+ ce7:	73 47                	jae    d30 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ce9:	89 c2                	mov    %eax,%edx
+ ceb:	39 05 d8 11 00 00    	cmp    %eax,0x11d8
+ cf1:	75 ed                	jne    ce0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ cf3:	83 ec 0c             	sub    $0xc,%esp
+ cf6:	56                   	push   %esi
+ cf7:	e8 15 fb ff ff       	call   811 <sbrk>
+  if(p == (char*)-1)
+ cfc:	83 c4 10             	add    $0x10,%esp
+ cff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d02:	74 1c                	je     d20 <malloc+0x80>
+  hp->s.size = nu;
+ d04:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d07:	83 ec 0c             	sub    $0xc,%esp
+ d0a:	83 c0 08             	add    $0x8,%eax
+ d0d:	50                   	push   %eax
+ d0e:	e8 fd fe ff ff       	call   c10 <free>
+  return freep;
+ d13:	8b 15 d8 11 00 00    	mov    0x11d8,%edx
+      if((p = morecore(nunits)) == 0)
+ d19:	83 c4 10             	add    $0x10,%esp
+ d1c:	85 d2                	test   %edx,%edx
+ d1e:	75 c0                	jne    ce0 <malloc+0x40>
+        return 0;
+  }
+}
+ d20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d23:	31 c0                	xor    %eax,%eax
+}
+ d25:	5b                   	pop    %ebx
+ d26:	5e                   	pop    %esi
+ d27:	5f                   	pop    %edi
+ d28:	5d                   	pop    %ebp
+ d29:	c3                   	ret
+ d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d30:	39 cf                	cmp    %ecx,%edi
+ d32:	74 4c                	je     d80 <malloc+0xe0>
+        p->s.size -= nunits;
+ d34:	29 f9                	sub    %edi,%ecx
+ d36:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d39:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d3c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d3f:	89 15 d8 11 00 00    	mov    %edx,0x11d8
+}
+ d45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d48:	83 c0 08             	add    $0x8,%eax
+}
+ d4b:	5b                   	pop    %ebx
+ d4c:	5e                   	pop    %esi
+ d4d:	5f                   	pop    %edi
+ d4e:	5d                   	pop    %ebp
+ d4f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d50:	c7 05 d8 11 00 00 dc 	movl   $0x11dc,0x11d8
+ d57:	11 00 00 
+    base.s.size = 0;
+ d5a:	b8 dc 11 00 00       	mov    $0x11dc,%eax
+    base.s.ptr = freep = prevp = &base;
+ d5f:	c7 05 dc 11 00 00 dc 	movl   $0x11dc,0x11dc
+ d66:	11 00 00 
+    base.s.size = 0;
+ d69:	c7 05 e0 11 00 00 00 	movl   $0x0,0x11e0
+ d70:	00 00 00 
+    if(p->s.size >= nunits){
+ d73:	e9 54 ff ff ff       	jmp    ccc <malloc+0x2c>
+ d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d7f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d80:	8b 08                	mov    (%eax),%ecx
+ d82:	89 0a                	mov    %ecx,(%edx)
+ d84:	eb b9                	jmp    d3f <malloc+0x9f>
@@ -0,0 +1,103 @@
+// Sleeper interference benchmark.
+// Runs a CPU-bound loop for a fixed number of ticks, first alone and
+// then with nsleep processes blocked in long sleep() calls, and
+// reports how much throughput the loop lost to the sleepers. Also
+// reports how late nanosleep() wakes up for sub-tick intervals.
+//   usage: sleepbench [nsleep [ticks]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define UNIT 10000  // loop iterations per work unit
+#define MAXSLEEP 60 // leaves room in NPROC for init, sh and us
+
+static uint
+spin(int n)
+{
+  int j, start;
+  uint units;
+  volatile uint x;
+
+  start = uptime();
+  units = 0;
+  x = 0;
+  while(uptime() - start < n){
+    for(j = 0; j < UNIT; j++)
+      x++;
+    units++;
+  }
+  return units;
+}
+
+// Microseconds from a to b.
+static int
+usecs(struct timespec *a, struct timespec *b)
+{
+  return (b->tv_sec - a->tv_sec) * 1000000 +
+         ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+}
+
+static void
+oversleep(void)
+{
+  static int us[] = { 50, 200, 1000, 5000, 25000 };
+  struct timespec req, t0, t1;
+  int i, j, late;
+
+  for(i = 0; i < sizeof(us) / sizeof(us[0]); i++){
+    req.tv_sec = 0;
+    req.tv_nsec = us[i] * 1000;
+    late = 0;
+    for(j = 0; j < 20; j++){
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      nanosleep(&req);
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+      late += usecs(&t0, &t1) - us[i];
+    }
+    printf(1, "sleepbench nanosleep %d us late %d us\n", us[i], late / 20);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nsleep, n, i, pid, pids[MAXSLEEP];
+  uint alone, loaded;
+
+  nsleep = argc > 1 ? atoi(argv[1]) : MAXSLEEP;
+  n = argc > 2 ? atoi(argv[2]) : 300;
+  if(nsleep < 0 || nsleep > MAXSLEEP || n <= 0){
+    printf(2, "usage: sleepbench [nsleep [ticks]]\n");
+    exit(1);
+  }
+
+  alone = spin(n);
+
+  for(i = 0; i < nsleep; i++){
+    if((pid = fork()) < 0)
+      break;
+    if(pid == 0){
+      for(;;)
+        sleep(100000);
+    }
+    pids[i] = pid;
+  }
+  nsleep = i;
+  sleep(10);  // let the sleepers get to sleep
+
+  loaded = spin(n);
+
+  for(i = 0; i < nsleep; i++)
+    kill(pids[i], SIGKILL);
+  for(i = 0; i < nsleep; i++)
+    wait();
+
+  if(alone == 0)
+    alone = 1;
+  printf(1, "sleepbench sleepers %d ticks %d alone %d loaded %d loss %d%%\n",
+         nsleep, n, alone, loaded,
+         loaded < alone ? (alone - loaded) * 100 / alone : 0);
+  oversleep();
+  exit(0);
+}
@@ -0,0 +1,1608 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 78 0b 00 00       	push   $0xb78
+  44:	6a 01                	push   $0x1
+  46:	e8 05 08 00 00       	call   850 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 95 01 00 00       	call   1f0 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 e4 03 00 00       	call   447 <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 8b 0b 00 00       	push   $0xb8b
+  78:	6a 01                	push   $0x1
+  7a:	e8 d1 07 00 00       	call   850 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 94 04 00 00       	call   531 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 12 04 00 00       	call   4c9 <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 1b 04 00 00       	call   4e3 <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 95 0b 00 00       	push   $0xb95
+  cf:	6a 01                	push   $0x1
+  d1:	e8 7a 07 00 00       	call   850 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 46 04 00 00       	call   531 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 b0 03 00 00       	call   4af <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 d3 03 00 00       	call   4e3 <close>
+
+  wait();
+ 110:	e8 66 03 00 00       	call   47b <wait>
+
+  exit(0);
+ 115:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 11c:	e8 40 03 00 00       	call   461 <exit>
+ 121:	66 90                	xchg   %ax,%ax
+ 123:	66 90                	xchg   %ax,%ax
+ 125:	66 90                	xchg   %ax,%ax
+ 127:	66 90                	xchg   %ax,%ax
+ 129:	66 90                	xchg   %ax,%ax
+ 12b:	66 90                	xchg   %ax,%ax
+ 12d:	66 90                	xchg   %ax,%ax
+ 12f:	90                   	nop
+
+00000130 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 130:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 131:	31 c0                	xor    %eax,%eax
+{
+ 133:	89 e5                	mov    %esp,%ebp
+ 135:	53                   	push   %ebx
+ 136:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 139:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 140:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 144:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 147:	83 c0 01             	add    $0x1,%eax
+ 14a:	84 d2                	test   %dl,%dl
+ 14c:	75 f2                	jne    140 <strcpy+0x10>
+    ;
+  return os;
+}
+ 14e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 151:	89 c8                	mov    %ecx,%eax
+ 153:	c9                   	leave
+ 154:	c3                   	ret
+ 155:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	53                   	push   %ebx
+ 164:	8b 55 08             	mov    0x8(%ebp),%edx
+ 167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 16a:	0f b6 02             	movzbl (%edx),%eax
+ 16d:	84 c0                	test   %al,%al
+ 16f:	75 17                	jne    188 <strcmp+0x28>
+ 171:	eb 3a                	jmp    1ad <strcmp+0x4d>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 17c:	83 c2 01             	add    $0x1,%edx
+ 17f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 182:	84 c0                	test   %al,%al
+ 184:	74 1a                	je     1a0 <strcmp+0x40>
+    p++, q++;
+ 186:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 188:	0f b6 19             	movzbl (%ecx),%ebx
+ 18b:	38 c3                	cmp    %al,%bl
+ 18d:	74 e9                	je     178 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 18f:	29 d8                	sub    %ebx,%eax
+}
+ 191:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 194:	c9                   	leave
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1a4:	31 c0                	xor    %eax,%eax
+ 1a6:	29 d8                	sub    %ebx,%eax
+}
+ 1a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1ab:	c9                   	leave
+ 1ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 1b0:	31 c0                	xor    %eax,%eax
+ 1b2:	eb db                	jmp    18f <strcmp+0x2f>
+ 1b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+
+000001c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1c9:	74 15                	je     1e0 <strlen+0x20>
+ 1cb:	31 c0                	xor    %eax,%eax
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1d0:	83 c0 01             	add    $0x1,%eax
+ 1d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1d7:	89 c1                	mov    %eax,%ecx
+ 1d9:	75 f5                	jne    1d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1db:	89 c8                	mov    %ecx,%eax
+ 1dd:	5d                   	pop    %ebp
+ 1de:	c3                   	ret
+ 1df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1e0:	31 c9                	xor    %ecx,%ecx
+}
+ 1e2:	5d                   	pop    %ebp
+ 1e3:	89 c8                	mov    %ecx,%eax
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fd:	89 d7                	mov    %edx,%edi
+ 1ff:	fc                   	cld
+ 200:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 202:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 205:	89 d0                	mov    %edx,%eax
+ 207:	c9                   	leave
+ 208:	c3                   	ret
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 21a:	0f b6 10             	movzbl (%eax),%edx
+ 21d:	84 d2                	test   %dl,%dl
+ 21f:	75 12                	jne    233 <strchr+0x23>
+ 221:	eb 1d                	jmp    240 <strchr+0x30>
+ 223:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 227:	90                   	nop
+ 228:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 22c:	83 c0 01             	add    $0x1,%eax
+ 22f:	84 d2                	test   %dl,%dl
+ 231:	74 0d                	je     240 <strchr+0x30>
+    if(*s == c)
+ 233:	38 d1                	cmp    %dl,%cl
+ 235:	75 f1                	jne    228 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 237:	5d                   	pop    %ebp
+ 238:	c3                   	ret
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 240:	31 c0                	xor    %eax,%eax
+}
+ 242:	5d                   	pop    %ebp
+ 243:	c3                   	ret
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 255:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 258:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 259:	31 db                	xor    %ebx,%ebx
+{
+ 25b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 25e:	eb 27                	jmp    287 <gets+0x37>
+    cc = read(0, &c, 1);
+ 260:	83 ec 04             	sub    $0x4,%esp
+ 263:	6a 01                	push   $0x1
+ 265:	56                   	push   %esi
+ 266:	6a 00                	push   $0x0
+ 268:	e8 42 02 00 00       	call   4af <read>
+    if(cc < 1)
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	85 c0                	test   %eax,%eax
+ 272:	7e 1d                	jle    291 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 274:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 27f:	3c 0a                	cmp    $0xa,%al
+ 281:	74 10                	je     293 <gets+0x43>
+ 283:	3c 0d                	cmp    $0xd,%al
+ 285:	74 0c                	je     293 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 287:	89 df                	mov    %ebx,%edi
+ 289:	83 c3 01             	add    $0x1,%ebx
+ 28c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 28f:	7c cf                	jl     260 <gets+0x10>
+ 291:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 29a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 29d:	5b                   	pop    %ebx
+ 29e:	5e                   	pop    %esi
+ 29f:	5f                   	pop    %edi
+ 2a0:	5d                   	pop    %ebp
+ 2a1:	c3                   	ret
+ 2a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	56                   	push   %esi
+ 2b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2b5:	83 ec 08             	sub    $0x8,%esp
+ 2b8:	6a 00                	push   $0x0
+ 2ba:	ff 75 08             	push   0x8(%ebp)
+ 2bd:	e8 6f 02 00 00       	call   531 <open>
+  if(fd < 0)
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	85 c0                	test   %eax,%eax
+ 2c7:	78 27                	js     2f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2c9:	83 ec 08             	sub    $0x8,%esp
+ 2cc:	ff 75 0c             	push   0xc(%ebp)
+ 2cf:	89 c3                	mov    %eax,%ebx
+ 2d1:	50                   	push   %eax
+ 2d2:	e8 a8 02 00 00       	call   57f <fstat>
+  close(fd);
+ 2d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2dc:	e8 02 02 00 00       	call   4e3 <close>
+  return r;
+ 2e1:	83 c4 10             	add    $0x10,%esp
+}
+ 2e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2e7:	89 f0                	mov    %esi,%eax
+ 2e9:	5b                   	pop    %ebx
+ 2ea:	5e                   	pop    %esi
+ 2eb:	5d                   	pop    %ebp
+ 2ec:	c3                   	ret
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2f5:	eb ed                	jmp    2e4 <stat+0x34>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 307:	0f be 02             	movsbl (%edx),%eax
+ 30a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 30d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 310:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 315:	77 1e                	ja     335 <atoi+0x35>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 320:	83 c2 01             	add    $0x1,%edx
+ 323:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 326:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 32a:	0f be 02             	movsbl (%edx),%eax
+ 32d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 330:	80 fb 09             	cmp    $0x9,%bl
+ 333:	76 eb                	jbe    320 <atoi+0x20>
+  return n;
+}
+ 335:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 338:	89 c8                	mov    %ecx,%eax
+ 33a:	c9                   	leave
+ 33b:	c3                   	ret
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	8b 45 10             	mov    0x10(%ebp),%eax
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 34e:	85 c0                	test   %eax,%eax
+ 350:	7e 13                	jle    365 <memmove+0x25>
+ 352:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 354:	89 d7                	mov    %edx,%edi
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 360:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 361:	39 f8                	cmp    %edi,%eax
+ 363:	75 fb                	jne    360 <memmove+0x20>
+  return vdst;
+}
+ 365:	5e                   	pop    %esi
+ 366:	89 d0                	mov    %edx,%eax
+ 368:	5f                   	pop    %edi
+ 369:	5d                   	pop    %ebp
+ 36a:	c3                   	ret
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 376:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 379:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 380:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 383:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 386:	50                   	push   %eax
+ 387:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 38a:	50                   	push   %eax
+ 38b:	6a 00                	push   $0x0
+ 38d:	e8 8d 03 00 00       	call   71f <setitimer>
+ 392:	83 c4 10             	add    $0x10,%esp
+ 395:	89 c2                	mov    %eax,%edx
+ 397:	31 c0                	xor    %eax,%eax
+ 399:	85 d2                	test   %edx,%edx
+ 39b:	78 03                	js     3a0 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 39d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 3a0:	c9                   	leave
+ 3a1:	c3                   	ret
+ 3a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 3b0:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 3c0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 3c5:	c3                   	ret
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	53                   	push   %ebx
+ 3d6:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 3d9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 3dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 3e0:	75 5e                	jne    440 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 3e2:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 3e8:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 3ea:	89 d3                	mov    %edx,%ebx
+ 3ec:	89 c1                	mov    %eax,%ecx
+ 3ee:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 3f4:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 3fa:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 3fd:	31 d2                	xor    %edx,%edx
+ 3ff:	89 d8                	mov    %ebx,%eax
+ 401:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 404:	f7 f6                	div    %esi
+ 406:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 408:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 40b:	f7 f6                	div    %esi
+ 40d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 40f:	89 da                	mov    %ebx,%edx
+ 411:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 416:	f7 f3                	div    %ebx
+ 418:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 41a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 41f:	89 d3                	mov    %edx,%ebx
+ 421:	f7 e1                	mul    %ecx
+ 423:	f7 f6                	div    %esi
+ 425:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 42b:	01 c3                	add    %eax,%ebx
+  return 0;
+ 42d:	31 c0                	xor    %eax,%eax
+ 42f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 432:	83 c4 0c             	add    $0xc,%esp
+ 435:	5b                   	pop    %ebx
+ 436:	5e                   	pop    %esi
+ 437:	5f                   	pop    %edi
+ 438:	5d                   	pop    %ebp
+ 439:	c3                   	ret
+ 43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 440:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 445:	eb eb                	jmp    432 <clock_gettime+0x62>
+
+00000447 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 447:	b8 01 00 00 00       	mov    $0x1,%eax
+ 44c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 453:	74 09                	je     45e <fork+0x17>
+ 455:	89 e1                	mov    %esp,%ecx
+ 457:	ba 60 04 00 00       	mov    $0x460,%edx
+ 45c:	0f 34                	sysenter
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <exit>:
+SYSCALL(exit)
+ 461:	b8 02 00 00 00       	mov    $0x2,%eax
+ 466:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 46d:	74 09                	je     478 <exit+0x17>
+ 46f:	89 e1                	mov    %esp,%ecx
+ 471:	ba 7a 04 00 00       	mov    $0x47a,%edx
+ 476:	0f 34                	sysenter
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <wait>:
+SYSCALL(wait)
+ 47b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 480:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 487:	74 09                	je     492 <wait+0x17>
+ 489:	89 e1                	mov    %esp,%ecx
+ 48b:	ba 94 04 00 00       	mov    $0x494,%edx
+ 490:	0f 34                	sysenter
+ 492:	cd 40                	int    $0x40
+ 494:	c3                   	ret
+
+00000495 <pipe>:
+SYSCALL(pipe)
+ 495:	b8 04 00 00 00       	mov    $0x4,%eax
+ 49a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4a1:	74 09                	je     4ac <pipe+0x17>
+ 4a3:	89 e1                	mov    %esp,%ecx
+ 4a5:	ba ae 04 00 00       	mov    $0x4ae,%edx
+ 4aa:	0f 34                	sysenter
+ 4ac:	cd 40                	int    $0x40
+ 4ae:	c3                   	ret
+
+000004af <read>:
+SYSCALL(read)
+ 4af:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4b4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4bb:	74 09                	je     4c6 <read+0x17>
+ 4bd:	89 e1                	mov    %esp,%ecx
+ 4bf:	ba c8 04 00 00       	mov    $0x4c8,%edx
+ 4c4:	0f 34                	sysenter
+ 4c6:	cd 40                	int    $0x40
+ 4c8:	c3                   	ret
+
+000004c9 <write>:
+SYSCALL(write)
+ 4c9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ce:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4d5:	74 09                	je     4e0 <write+0x17>
+ 4d7:	89 e1                	mov    %esp,%ecx
+ 4d9:	ba e2 04 00 00       	mov    $0x4e2,%edx
+ 4de:	0f 34                	sysenter
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <close>:
+SYSCALL(close)
+ 4e3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4e8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4ef:	74 09                	je     4fa <close+0x17>
+ 4f1:	89 e1                	mov    %esp,%ecx
+ 4f3:	ba fc 04 00 00       	mov    $0x4fc,%edx
+ 4f8:	0f 34                	sysenter
+ 4fa:	cd 40                	int    $0x40
+ 4fc:	c3                   	ret
+
+000004fd <kill>:
+SYSCALL(kill)
+ 4fd:	b8 06 00 00 00       	mov    $0x6,%eax
+ 502:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 509:	74 09                	je     514 <kill+0x17>
+ 50b:	89 e1                	mov    %esp,%ecx
+ 50d:	ba 16 05 00 00       	mov    $0x516,%edx
+ 512:	0f 34                	sysenter
+ 514:	cd 40                	int    $0x40
+ 516:	c3                   	ret
+
+00000517 <exec>:
+SYSCALL(exec)
+ 517:	b8 07 00 00 00       	mov    $0x7,%eax
+ 51c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 523:	74 09                	je     52e <exec+0x17>
+ 525:	89 e1                	mov    %esp,%ecx
+ 527:	ba 30 05 00 00       	mov    $0x530,%edx
+ 52c:	0f 34                	sysenter
+ 52e:	cd 40                	int    $0x40
+ 530:	c3                   	ret
+
+00000531 <open>:
+SYSCALL(open)
+ 531:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 536:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 53d:	74 09                	je     548 <open+0x17>
+ 53f:	89 e1                	mov    %esp,%ecx
+ 541:	ba 4a 05 00 00       	mov    $0x54a,%edx
+ 546:	0f 34                	sysenter
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <mknod>:
+SYSCALL(mknod)
+ 54b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 550:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 557:	74 09                	je     562 <mknod+0x17>
+ 559:	89 e1                	mov    %esp,%ecx
+ 55b:	ba 64 05 00 00       	mov    $0x564,%edx
+ 560:	0f 34                	sysenter
+ 562:	cd 40                	int    $0x40
+ 564:	c3                   	ret
+
+00000565 <unlink>:
+SYSCALL(unlink)
+ 565:	b8 12 00 00 00       	mov    $0x12,%eax
+ 56a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 571:	74 09                	je     57c <unlink+0x17>
+ 573:	89 e1                	mov    %esp,%ecx
+ 575:	ba 7e 05 00 00       	mov    $0x57e,%edx
+ 57a:	0f 34                	sysenter
+ 57c:	cd 40                	int    $0x40
+ 57e:	c3                   	ret
+
+0000057f <fstat>:
+SYSCALL(fstat)
+ 57f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 584:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 58b:	74 09                	je     596 <fstat+0x17>
+ 58d:	89 e1                	mov    %esp,%ecx
+ 58f:	ba 98 05 00 00       	mov    $0x598,%edx
+ 594:	0f 34                	sysenter
+ 596:	cd 40                	int    $0x40
+ 598:	c3                   	ret
+
+00000599 <link>:
+SYSCALL(link)
+ 599:	b8 13 00 00 00       	mov    $0x13,%eax
+ 59e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5a5:	74 09                	je     5b0 <link+0x17>
+ 5a7:	89 e1                	mov    %esp,%ecx
+ 5a9:	ba b2 05 00 00       	mov    $0x5b2,%edx
+ 5ae:	0f 34                	sysenter
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <mkdir>:
+SYSCALL(mkdir)
+ 5b3:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5b8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5bf:	74 09                	je     5ca <mkdir+0x17>
+ 5c1:	89 e1                	mov    %esp,%ecx
+ 5c3:	ba cc 05 00 00       	mov    $0x5cc,%edx
+ 5c8:	0f 34                	sysenter
+ 5ca:	cd 40                	int    $0x40
+ 5cc:	c3                   	ret
+
+000005cd <chdir>:
+SYSCALL(chdir)
+ 5cd:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5d2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5d9:	74 09                	je     5e4 <chdir+0x17>
+ 5db:	89 e1                	mov    %esp,%ecx
+ 5dd:	ba e6 05 00 00       	mov    $0x5e6,%edx
+ 5e2:	0f 34                	sysenter
+ 5e4:	cd 40                	int    $0x40
+ 5e6:	c3                   	ret
+
+000005e7 <dup>:
+SYSCALL(dup)
+ 5e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5ec:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5f3:	74 09                	je     5fe <dup+0x17>
+ 5f5:	89 e1                	mov    %esp,%ecx
+ 5f7:	ba 00 06 00 00       	mov    $0x600,%edx
+ 5fc:	0f 34                	sysenter
+ 5fe:	cd 40                	int    $0x40
+ 600:	c3                   	ret
+
+00000601 <sbrk>:
+SYSCALL(sbrk)
+ 601:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 606:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 60d:	74 09                	je     618 <sbrk+0x17>
+ 60f:	89 e1                	mov    %esp,%ecx
+ 611:	ba 1a 06 00 00       	mov    $0x61a,%edx
+ 616:	0f 34                	sysenter
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <sleep>:
+SYSCALL(sleep)
+ 61b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 620:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 627:	74 09                	je     632 <sleep+0x17>
+ 629:	89 e1                	mov    %esp,%ecx
+ 62b:	ba 34 06 00 00       	mov    $0x634,%edx
+ 630:	0f 34                	sysenter
+ 632:	cd 40                	int    $0x40
+ 634:	c3                   	ret
+
+00000635 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 635:	b8 16 00 00 00       	mov    $0x16,%eax
+ 63a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 641:	74 09                	je     64c <sigprocmask+0x17>
+ 643:	89 e1                	mov    %esp,%ecx
+ 645:	ba 4e 06 00 00       	mov    $0x64e,%edx
+ 64a:	0f 34                	sysenter
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <sigaction>:
+SYSCALL(sigaction)
+ 64f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 654:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 65b:	74 09                	je     666 <sigaction+0x17>
+ 65d:	89 e1                	mov    %esp,%ecx
+ 65f:	ba 68 06 00 00       	mov    $0x668,%edx
+ 664:	0f 34                	sysenter
+ 666:	cd 40                	int    $0x40
+ 668:	c3                   	ret
+
+00000669 <sigret>:
+SYSCALL(sigret)
+ 669:	b8 18 00 00 00       	mov    $0x18,%eax
+ 66e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 675:	74 09                	je     680 <sigret+0x17>
+ 677:	89 e1                	mov    %esp,%ecx
+ 679:	ba 82 06 00 00       	mov    $0x682,%edx
+ 67e:	0f 34                	sysenter
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <traceread>:
+SYSCALL(traceread)
+ 683:	b8 19 00 00 00       	mov    $0x19,%eax
+ 688:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 68f:	74 09                	je     69a <traceread+0x17>
+ 691:	89 e1                	mov    %esp,%ecx
+ 693:	ba 9c 06 00 00       	mov    $0x69c,%edx
+ 698:	0f 34                	sysenter
+ 69a:	cd 40                	int    $0x40
+ 69c:	c3                   	ret
+
+0000069d <sigqueue>:
+SYSCALL(sigqueue)
+ 69d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6a2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6a9:	74 09                	je     6b4 <sigqueue+0x17>
+ 6ab:	89 e1                	mov    %esp,%ecx
+ 6ad:	ba b6 06 00 00       	mov    $0x6b6,%edx
+ 6b2:	0f 34                	sysenter
+ 6b4:	cd 40                	int    $0x40
+ 6b6:	c3                   	ret
+
+000006b7 <signalfd>:
+SYSCALL(signalfd)
+ 6b7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6bc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6c3:	74 09                	je     6ce <signalfd+0x17>
+ 6c5:	89 e1                	mov    %esp,%ecx
+ 6c7:	ba d0 06 00 00       	mov    $0x6d0,%edx
+ 6cc:	0f 34                	sysenter
+ 6ce:	cd 40                	int    $0x40
+ 6d0:	c3                   	ret
+
+000006d1 <sigwait>:
+SYSCALL(sigwait)
+ 6d1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6d6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6dd:	74 09                	je     6e8 <sigwait+0x17>
+ 6df:	89 e1                	mov    %esp,%ecx
+ 6e1:	ba ea 06 00 00       	mov    $0x6ea,%edx
+ 6e6:	0f 34                	sysenter
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <sigsuspend>:
+SYSCALL(sigsuspend)
+ 6eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6f0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6f7:	74 09                	je     702 <sigsuspend+0x17>
+ 6f9:	89 e1                	mov    %esp,%ecx
+ 6fb:	ba 04 07 00 00       	mov    $0x704,%edx
+ 700:	0f 34                	sysenter
+ 702:	cd 40                	int    $0x40
+ 704:	c3                   	ret
+
+00000705 <waitpid>:
+SYSCALL(waitpid)
+ 705:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 70a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 711:	74 09                	je     71c <waitpid+0x17>
+ 713:	89 e1                	mov    %esp,%ecx
+ 715:	ba 1e 07 00 00       	mov    $0x71e,%edx
+ 71a:	0f 34                	sysenter
+ 71c:	cd 40                	int    $0x40
+ 71e:	c3                   	ret
+
+0000071f <setitimer>:
+SYSCALL(setitimer)
+ 71f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 724:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 72b:	74 09                	je     736 <setitimer+0x17>
+ 72d:	89 e1                	mov    %esp,%ecx
+ 72f:	ba 38 07 00 00       	mov    $0x738,%edx
+ 734:	0f 34                	sysenter
+ 736:	cd 40                	int    $0x40
+ 738:	c3                   	ret
+
+00000739 <nanosleep>:
+SYSCALL(nanosleep)
+ 739:	b8 21 00 00 00       	mov    $0x21,%eax
+ 73e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 745:	74 09                	je     750 <nanosleep+0x17>
+ 747:	89 e1                	mov    %esp,%ecx
+ 749:	ba 52 07 00 00       	mov    $0x752,%edx
+ 74e:	0f 34                	sysenter
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <mmap>:
+SYSCALL(mmap)
+ 753:	b8 22 00 00 00       	mov    $0x22,%eax
+ 758:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 75f:	74 09                	je     76a <mmap+0x17>
+ 761:	89 e1                	mov    %esp,%ecx
+ 763:	ba 6c 07 00 00       	mov    $0x76c,%edx
+ 768:	0f 34                	sysenter
+ 76a:	cd 40                	int    $0x40
+ 76c:	c3                   	ret
+
+0000076d <munmap>:
+SYSCALL(munmap)
+ 76d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 772:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 779:	74 09                	je     784 <munmap+0x17>
+ 77b:	89 e1                	mov    %esp,%ecx
+ 77d:	ba 86 07 00 00       	mov    $0x786,%edx
+ 782:	0f 34                	sysenter
+ 784:	cd 40                	int    $0x40
+ 786:	c3                   	ret
+
+00000787 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 787:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 78c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 793:	74 09                	je     79e <getpid_syscall+0x17>
+ 795:	89 e1                	mov    %esp,%ecx
+ 797:	ba a0 07 00 00       	mov    $0x7a0,%edx
+ 79c:	0f 34                	sysenter
+ 79e:	cd 40                	int    $0x40
+ 7a0:	c3                   	ret
+
+000007a1 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 7a1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7a6:	cd 40                	int    $0x40
+ 7a8:	c3                   	ret
+ 7a9:	66 90                	xchg   %ax,%ax
+ 7ab:	66 90                	xchg   %ax,%ax
+ 7ad:	66 90                	xchg   %ax,%ax
+ 7af:	90                   	nop
+
+000007b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7b8:	89 d1                	mov    %edx,%ecx
+{
+ 7ba:	83 ec 3c             	sub    $0x3c,%esp
+ 7bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7c0:	85 d2                	test   %edx,%edx
+ 7c2:	0f 89 80 00 00 00    	jns    848 <printint+0x98>
+ 7c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7cc:	74 7a                	je     848 <printint+0x98>
+    x = -xx;
+ 7ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7d8:	31 f6                	xor    %esi,%esi
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7e0:	89 c8                	mov    %ecx,%eax
+ 7e2:	31 d2                	xor    %edx,%edx
+ 7e4:	89 f7                	mov    %esi,%edi
+ 7e6:	f7 f3                	div    %ebx
+ 7e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7eb:	0f b6 92 fc 0b 00 00 	movzbl 0xbfc(%edx),%edx
+ 7f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7f6:	89 ca                	mov    %ecx,%edx
+ 7f8:	89 c1                	mov    %eax,%ecx
+ 7fa:	39 da                	cmp    %ebx,%edx
+ 7fc:	73 e2                	jae    7e0 <printint+0x30>
+  if(neg)
+ 7fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 801:	85 c0                	test   %eax,%eax
+ 803:	74 07                	je     80c <printint+0x5c>
+    buf[i++] = '-';
+ 805:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 80a:	89 f7                	mov    %esi,%edi
+ 80c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 80f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 812:	01 df                	add    %ebx,%edi
+ 814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 818:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 81b:	83 ec 04             	sub    $0x4,%esp
+ 81e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 821:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 824:	6a 01                	push   $0x1
+ 826:	50                   	push   %eax
+ 827:	56                   	push   %esi
+ 828:	e8 9c fc ff ff       	call   4c9 <write>
+  while(--i >= 0)
+ 82d:	89 f8                	mov    %edi,%eax
+ 82f:	83 c4 10             	add    $0x10,%esp
+ 832:	83 ef 01             	sub    $0x1,%edi
+ 835:	39 d8                	cmp    %ebx,%eax
+ 837:	75 df                	jne    818 <printint+0x68>
+}
+ 839:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 83c:	5b                   	pop    %ebx
+ 83d:	5e                   	pop    %esi
+ 83e:	5f                   	pop    %edi
+ 83f:	5d                   	pop    %ebp
+ 840:	c3                   	ret
+ 841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 848:	31 c0                	xor    %eax,%eax
+ 84a:	eb 89                	jmp    7d5 <printint+0x25>
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	57                   	push   %edi
+ 854:	56                   	push   %esi
+ 855:	53                   	push   %ebx
+ 856:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 859:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 85c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 85f:	0f b6 1e             	movzbl (%esi),%ebx
+ 862:	83 c6 01             	add    $0x1,%esi
+ 865:	84 db                	test   %bl,%bl
+ 867:	74 67                	je     8d0 <printf+0x80>
+ 869:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 86c:	31 d2                	xor    %edx,%edx
+ 86e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 871:	eb 34                	jmp    8a7 <printf+0x57>
+ 873:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 877:	90                   	nop
+ 878:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 87b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 880:	83 f8 25             	cmp    $0x25,%eax
+ 883:	74 18                	je     89d <printf+0x4d>
+  write(fd, &c, 1);
+ 885:	83 ec 04             	sub    $0x4,%esp
+ 888:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 88b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 88e:	6a 01                	push   $0x1
+ 890:	50                   	push   %eax
+ 891:	57                   	push   %edi
+ 892:	e8 32 fc ff ff       	call   4c9 <write>
+ 897:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 89a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 89d:	0f b6 1e             	movzbl (%esi),%ebx
+ 8a0:	83 c6 01             	add    $0x1,%esi
+ 8a3:	84 db                	test   %bl,%bl
+ 8a5:	74 29                	je     8d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8aa:	85 d2                	test   %edx,%edx
+ 8ac:	74 ca                	je     878 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8ae:	83 fa 25             	cmp    $0x25,%edx
+ 8b1:	75 ea                	jne    89d <printf+0x4d>
+      if(c == 'd'){
+ 8b3:	83 f8 25             	cmp    $0x25,%eax
+ 8b6:	0f 84 24 01 00 00    	je     9e0 <printf+0x190>
+ 8bc:	83 e8 63             	sub    $0x63,%eax
+ 8bf:	83 f8 15             	cmp    $0x15,%eax
+ 8c2:	77 1c                	ja     8e0 <printf+0x90>
+ 8c4:	ff 24 85 a4 0b 00 00 	jmp    *0xba4(,%eax,4)
+ 8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8d3:	5b                   	pop    %ebx
+ 8d4:	5e                   	pop    %esi
+ 8d5:	5f                   	pop    %edi
+ 8d6:	5d                   	pop    %ebp
+ 8d7:	c3                   	ret
+ 8d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8df:	90                   	nop
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ea:	6a 01                	push   $0x1
+ 8ec:	52                   	push   %edx
+ 8ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8f0:	57                   	push   %edi
+ 8f1:	e8 d3 fb ff ff       	call   4c9 <write>
+ 8f6:	83 c4 0c             	add    $0xc,%esp
+ 8f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8fc:	6a 01                	push   $0x1
+ 8fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 901:	52                   	push   %edx
+ 902:	57                   	push   %edi
+ 903:	e8 c1 fb ff ff       	call   4c9 <write>
+        putc(fd, c);
+ 908:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 90b:	31 d2                	xor    %edx,%edx
+ 90d:	eb 8e                	jmp    89d <printf+0x4d>
+ 90f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 910:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 91b:	8b 13                	mov    (%ebx),%edx
+ 91d:	6a 00                	push   $0x0
+ 91f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 921:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 924:	e8 87 fe ff ff       	call   7b0 <printint>
+        ap++;
+ 929:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 92c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 92f:	31 d2                	xor    %edx,%edx
+ 931:	e9 67 ff ff ff       	jmp    89d <printf+0x4d>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 940:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 943:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 945:	83 c0 04             	add    $0x4,%eax
+ 948:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 94b:	85 db                	test   %ebx,%ebx
+ 94d:	0f 84 9d 00 00 00    	je     9f0 <printf+0x1a0>
+        while(*s != 0){
+ 953:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 956:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 958:	84 c0                	test   %al,%al
+ 95a:	0f 84 3d ff ff ff    	je     89d <printf+0x4d>
+ 960:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 963:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 966:	89 de                	mov    %ebx,%esi
+ 968:	89 d3                	mov    %edx,%ebx
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 970:	83 ec 04             	sub    $0x4,%esp
+ 973:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 976:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 979:	6a 01                	push   $0x1
+ 97b:	53                   	push   %ebx
+ 97c:	57                   	push   %edi
+ 97d:	e8 47 fb ff ff       	call   4c9 <write>
+        while(*s != 0){
+ 982:	0f b6 06             	movzbl (%esi),%eax
+ 985:	83 c4 10             	add    $0x10,%esp
+ 988:	84 c0                	test   %al,%al
+ 98a:	75 e4                	jne    970 <printf+0x120>
+      state = 0;
+ 98c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 98f:	31 d2                	xor    %edx,%edx
+ 991:	e9 07 ff ff ff       	jmp    89d <printf+0x4d>
+ 996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9ab:	8b 13                	mov    (%ebx),%edx
+ 9ad:	6a 01                	push   $0x1
+ 9af:	e9 6b ff ff ff       	jmp    91f <printf+0xcf>
+ 9b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9bb:	83 ec 04             	sub    $0x4,%esp
+ 9be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9c9:	6a 01                	push   $0x1
+ 9cb:	52                   	push   %edx
+ 9cc:	57                   	push   %edi
+ 9cd:	e8 f7 fa ff ff       	call   4c9 <write>
+        ap++;
+ 9d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9d8:	31 d2                	xor    %edx,%edx
+ 9da:	e9 be fe ff ff       	jmp    89d <printf+0x4d>
+ 9df:	90                   	nop
+  write(fd, &c, 1);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9e9:	6a 01                	push   $0x1
+ 9eb:	e9 11 ff ff ff       	jmp    901 <printf+0xb1>
+ 9f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9f5:	bb 9b 0b 00 00       	mov    $0xb9b,%ebx
+ 9fa:	e9 61 ff ff ff       	jmp    960 <printf+0x110>
+ 9ff:	90                   	nop
+
+00000a00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a01:	a1 20 0f 00 00       	mov    0xf20,%eax
+{
+ a06:	89 e5                	mov    %esp,%ebp
+ a08:	57                   	push   %edi
+ a09:	56                   	push   %esi
+ a0a:	53                   	push   %ebx
+ a0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a1c:	39 ca                	cmp    %ecx,%edx
+ a1e:	73 30                	jae    a50 <free+0x50>
+ a20:	39 c1                	cmp    %eax,%ecx
+ a22:	72 04                	jb     a28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a24:	39 c2                	cmp    %eax,%edx
+ a26:	72 f0                	jb     a18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a2e:	39 f8                	cmp    %edi,%eax
+ a30:	74 2e                	je     a60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a35:	8b 42 04             	mov    0x4(%edx),%eax
+ a38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a3b:	39 f1                	cmp    %esi,%ecx
+ a3d:	74 38                	je     a77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a41:	5b                   	pop    %ebx
+  freep = p;
+ a42:	89 15 20 0f 00 00    	mov    %edx,0xf20
+}
+ a48:	5e                   	pop    %esi
+ a49:	5f                   	pop    %edi
+ a4a:	5d                   	pop    %ebp
+ a4b:	c3                   	ret
+ a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a50:	39 c1                	cmp    %eax,%ecx
+ a52:	72 d0                	jb     a24 <free+0x24>
+ a54:	eb c2                	jmp    a18 <free+0x18>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a60:	03 70 04             	add    0x4(%eax),%esi
+ a63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a66:	8b 02                	mov    (%edx),%eax
+ a68:	8b 00                	mov    (%eax),%eax
+ a6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a6d:	8b 42 04             	mov    0x4(%edx),%eax
+ a70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a73:	39 f1                	cmp    %esi,%ecx
+ a75:	75 c8                	jne    a3f <free+0x3f>
+    p->s.size += bp->s.size;
+ a77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a7a:	89 15 20 0f 00 00    	mov    %edx,0xf20
+    p->s.size += bp->s.size;
+ a80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a86:	89 0a                	mov    %ecx,(%edx)
+}
+ a88:	5b                   	pop    %ebx
+ a89:	5e                   	pop    %esi
+ a8a:	5f                   	pop    %edi
+ a8b:	5d                   	pop    %ebp
+ a8c:	c3                   	ret
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	53                   	push   %ebx
+ a96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a9c:	8b 15 20 0f 00 00    	mov    0xf20,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ aa2:	8d 78 07             	lea    0x7(%eax),%edi
+ aa5:	c1 ef 03             	shr    $0x3,%edi
+ aa8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ aab:	85 d2                	test   %edx,%edx
+ aad:	0f 84 8d 00 00 00    	je     b40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ab3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ab5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ab8:	39 f9                	cmp    %edi,%ecx
+ aba:	73 64                	jae    b20 <malloc+0x90>
+  if(nu < 4096)
+ abc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ac1:	39 df                	cmp    %ebx,%edi
+ ac3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ac6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ acd:	eb 0a                	jmp    ad9 <malloc+0x49>
+ acf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ad0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ad2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ad5:	39 f9                	cmp    %edi,%ecx
+ ad7:	73 47                	jae    b20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ad9:	89 c2                	mov    %eax,%edx
+ adb:	39 05 20 0f 00 00    	cmp    %eax,0xf20
+ ae1:	75 ed                	jne    ad0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ae3:	83 ec 0c             	sub    $0xc,%esp
+ ae6:	56                   	push   %esi
+ ae7:	e8 15 fb ff ff       	call   601 <sbrk>
+  if(p == (char*)-1)
+ aec:	83 c4 10             	add    $0x10,%esp
+ aef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ af2:	74 1c                	je     b10 <malloc+0x80>
+  hp->s.size = nu;
+ af4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ af7:	83 ec 0c             	sub    $0xc,%esp
+ afa:	83 c0 08             	add    $0x8,%eax
+ afd:	50                   	push   %eax
+ afe:	e8 fd fe ff ff       	call   a00 <free>
+  return freep;
+ b03:	8b 15 20 0f 00 00    	mov    0xf20,%edx
+      if((p = morecore(nunits)) == 0)
+ b09:	83 c4 10             	add    $0x10,%esp
+ b0c:	85 d2                	test   %edx,%edx
+ b0e:	75 c0                	jne    ad0 <malloc+0x40>
+        return 0;
+  }
+}
+ b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b13:	31 c0                	xor    %eax,%eax
+}
+ b15:	5b                   	pop    %ebx
+ b16:	5e                   	pop    %esi
+ b17:	5f                   	pop    %edi
+ b18:	5d                   	pop    %ebp
+ b19:	c3                   	ret
+ b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b20:	39 cf                	cmp    %ecx,%edi
+ b22:	74 4c                	je     b70 <malloc+0xe0>
+        p->s.size -= nunits;
+ b24:	29 f9                	sub    %edi,%ecx
+ b26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b2f:	89 15 20 0f 00 00    	mov    %edx,0xf20
+}
+ b35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b38:	83 c0 08             	add    $0x8,%eax
+}
+ b3b:	5b                   	pop    %ebx
+ b3c:	5e                   	pop    %esi
+ b3d:	5f                   	pop    %edi
+ b3e:	5d                   	pop    %ebp
+ b3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b40:	c7 05 20 0f 00 00 24 	movl   $0xf24,0xf20
+ b47:	0f 00 00 
+    base.s.size = 0;
+ b4a:	b8 24 0f 00 00       	mov    $0xf24,%eax
+    base.s.ptr = freep = prevp = &base;
+ b4f:	c7 05 24 0f 00 00 24 	movl   $0xf24,0xf24
+ b56:	0f 00 00 
+    base.s.size = 0;
+ b59:	c7 05 28 0f 00 00 00 	movl   $0x0,0xf28
+ b60:	00 00 00 
+    if(p->s.size >= nunits){
+ b63:	e9 54 ff ff ff       	jmp    abc <malloc+0x2c>
+ b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b70:	8b 08                	mov    (%eax),%ecx
+ b72:	89 0a                	mov    %ecx,(%edx)
+ b74:	eb b9                	jmp    b2f <malloc+0x9f>
@@ -6,6 +6,8 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "trace.h"
+#include "fcntl.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -13,13 +15,29 @@
 // library system call function. The saved user %esp points
 // to a saved program counter, and then the first argument.
 
-// Fetch the int at addr from the current process.
+// Whether [addr, addr+n) is memory of the current process: below
+// sz, or in one mmap() region, which must be writable if write is
+// set.
 int
-fetchint(uint addr, int *ip)
+validrange(uint addr, uint n, int write)
 {
   struct proc *curproc = myproc();
+  struct vma *v;
 
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  if(addr + n < addr)
+    return 0;
+  if(addr < curproc->sz)
+    return addr + n <= curproc->sz;
+  if((v = vmafind(curproc, addr)) == 0)
+    return 0;
+  return addr + n <= v->end && (!write || (v->prot & PROT_WRITE));
+}
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+  if(!validrange(addr, 4, 0) || pagein(myproc(), addr, 4, 0) < 0)
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -28,17 +46,27 @@ fetchint(uint addr, int *ip)
 // Fetch the nul-terminated string at addr from the current process.
 // Doesn't actually copy the string - just sets *pp to point at it.
 // Returns length of string, not including nul.
+// Strings in MAP_SHARED regions are refused: another process could
+// clear the nul after this check, and the kernel would run off the
+// end of the region.
 int
 fetchstr(uint addr, char **pp)
 {
   char *s, *ep;
   struct proc *curproc = myproc();
+  struct vma *v;
 
-  if(addr >= curproc->sz)
+  if(addr < curproc->sz)
+    ep = (char*)curproc->sz;
+  else if((v = vmafind(curproc, addr)) != 0 && !(v->flags & MAP_SHARED))
+    ep = (char*)v->end;
+  else
     return -1;
   *pp = (char*)addr;
-  ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+       pagein(curproc, (uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
   }
@@ -53,17 +81,32 @@ argint(int n, int *ip)
 }
 
 // Fetch the nth word-sized system call argument as a pointer
-// to a block of memory of size bytes.  Check that the pointer
-// lies within the process address space.
+// to a block of memory of size bytes, which the kernel may
+// write.  Check that the pointer lies within the process
+// address space, and fill in its pages (see pagein).
 int
 argptr(int n, char **pp, int size)
 {
   int i;
-  struct proc *curproc = myproc();
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || !validrange(i, size, 1) || pagein(myproc(), i, size, 1) < 0)
+    return -1;
+  *pp = (char*)i;
+  return 0;
+}
+
+// Like argptr, for a block the kernel only reads, which may also
+// be in a read-only mmap() region.
+int
+argrdptr(int n, char **pp, int size)
+{
+  int i;
+ 
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || !validrange(i, size, 0) || pagein(myproc(), i, size, 0) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
@@ -71,8 +114,8 @@ argptr(int n, char **pp, int size)
 
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
+// (The string is in private memory (see fetchstr), so it can't
+// change between this check and being used by the kernel.)
 int
 argstr(int n, char **pp)
 {
@@ -106,6 +149,17 @@ extern int sys_uptime(void);
 extern int sys_sigprocmask(void); // Task-2.1.3
 extern int sys_sigaction(void); // Task-2.1.4
 extern int sys_sigret(void); // Task-2.1.5
+extern int sys_traceread(void);
+extern int sys_sigqueue(void);
+extern int sys_signalfd(void);
+extern int sys_sigwait(void);
+extern int sys_sigsuspend(void);
+extern int sys_waitpid(void);
+extern int sys_setitimer(void);
+extern int sys_clock_gettime(void);
+extern int sys_nanosleep(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -132,6 +186,17 @@ static int (*syscalls[])(void) = {
 [SYS_sigprocmask]   sys_sigprocmask, // Task-2.1.3
 [SYS_sigaction]   sys_sigaction, // Task-2.1.4
 [SYS_sigret]   sys_sigret, // Task-2.1.5
+[SYS_traceread] sys_traceread,
+[SYS_sigqueue] sys_sigqueue,
+[SYS_signalfd] sys_signalfd,
+[SYS_sigwait] sys_sigwait,
+[SYS_sigsuspend] sys_sigsuspend,
+[SYS_waitpid] sys_waitpid,
+[SYS_setitimer] sys_setitimer,
+[SYS_clock_gettime] sys_clock_gettime,
+[SYS_nanosleep] sys_nanosleep,
+[SYS_mmap] sys_mmap,
+[SYS_munmap] sys_munmap,
 };
 
 void
@@ -141,6 +206,7 @@ syscall(void)
   struct proc *curproc = myproc();
 
   num = curproc->tf->eax;
+  trace(TR_SYSCALL, curproc->pid, num);
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
     curproc->tf->eax = syscalls[num]();
   } else {
@@ -23,3 +23,14 @@
 #define SYS_sigprocmask  22 // Task-2.1.3
 #define SYS_sigaction  23 // Task-2.1.4
 #define SYS_sigret  24 // Task-2.1.5
+#define SYS_traceread 25
+#define SYS_sigqueue 26
+#define SYS_signalfd 27
+#define SYS_sigwait 28
+#define SYS_sigsuspend 29
+#define SYS_waitpid 30
+#define SYS_setitimer 31
+#define SYS_clock_gettime 32
+#define SYS_nanosleep 33
+#define SYS_mmap 34
+#define SYS_munmap 35
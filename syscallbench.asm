@@ -0,0 +1,1612 @@
+
+_syscallbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         name, calls / (end - start) * 100, calls, end - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int n;
+
+  n = 100;
+  if(argc > 1)
+   f:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  12:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  15:	7e 51                	jle    68 <main+0x68>
+    n = atoi(argv[1]);
+  17:	83 ec 0c             	sub    $0xc,%esp
+  1a:	ff 70 04             	push   0x4(%eax)
+  1d:	e8 be 02 00 00       	call   2e0 <atoi>
+  if(n <= 0){
+  22:	83 c4 10             	add    $0x10,%esp
+    n = atoi(argv[1]);
+  25:	89 c3                	mov    %eax,%ebx
+  if(n <= 0){
+  27:	85 c0                	test   %eax,%eax
+  29:	7e 44                	jle    6f <main+0x6f>
+    printf(2, "usage: syscallbench [ticks]\n");
+    exit(1);
+  }
+
+  run("getpid_int", getpid_int, n);
+  2b:	89 d9                	mov    %ebx,%ecx
+  2d:	ba 81 07 00 00       	mov    $0x781,%edx
+  32:	b8 a8 0b 00 00       	mov    $0xba8,%eax
+  37:	e8 54 00 00 00       	call   90 <run>
+  run("getpid_sysenter", getpid_syscall, n);
+  3c:	89 d9                	mov    %ebx,%ecx
+  3e:	ba 67 07 00 00       	mov    $0x767,%edx
+  43:	b8 b3 0b 00 00       	mov    $0xbb3,%eax
+  48:	e8 43 00 00 00       	call   90 <run>
+  run("getpid_vdso", getpid, n);
+  4d:	89 d9                	mov    %ebx,%ecx
+  4f:	ba 90 03 00 00       	mov    $0x390,%edx
+  54:	b8 c3 0b 00 00       	mov    $0xbc3,%eax
+  59:	e8 32 00 00 00       	call   90 <run>
+  exit(0);
+  5e:	83 ec 0c             	sub    $0xc,%esp
+  61:	6a 00                	push   $0x0
+  63:	e8 d9 03 00 00       	call   441 <exit>
+  n = 100;
+  68:	bb 64 00 00 00       	mov    $0x64,%ebx
+  6d:	eb bc                	jmp    2b <main+0x2b>
+    printf(2, "usage: syscallbench [ticks]\n");
+  6f:	50                   	push   %eax
+  70:	50                   	push   %eax
+  71:	68 8b 0b 00 00       	push   $0xb8b
+  76:	6a 02                	push   $0x2
+  78:	e8 b3 07 00 00       	call   830 <printf>
+    exit(1);
+  7d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  84:	e8 b8 03 00 00       	call   441 <exit>
+  89:	66 90                	xchg   %ax,%ax
+  8b:	66 90                	xchg   %ax,%ax
+  8d:	66 90                	xchg   %ax,%ax
+  8f:	90                   	nop
+
+00000090 <run>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	56                   	push   %esi
+  95:	89 d6                	mov    %edx,%esi
+  97:	53                   	push   %ebx
+  98:	83 ec 1c             	sub    $0x1c,%esp
+  9b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  9e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  start = uptime();
+  a1:	e8 fa 02 00 00       	call   3a0 <uptime>
+  a6:	89 c3                	mov    %eax,%ebx
+  while(uptime() == start)
+  a8:	e8 f3 02 00 00       	call   3a0 <uptime>
+  ad:	39 d8                	cmp    %ebx,%eax
+  af:	74 f7                	je     a8 <run+0x18>
+  start = uptime();
+  b1:	e8 ea 02 00 00       	call   3a0 <uptime>
+  calls = 0;
+  b6:	31 ff                	xor    %edi,%edi
+  start = uptime();
+  b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  calls = 0;
+  bb:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+      fn();
+  c0:	ff d6                	call   *%esi
+    for(i = 0; i < BATCH; i++)
+  c2:	83 eb 01             	sub    $0x1,%ebx
+  c5:	75 f9                	jne    c0 <run+0x30>
+    end = uptime();
+  c7:	e8 d4 02 00 00       	call   3a0 <uptime>
+  } while(end - start < n);
+  cc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    calls += BATCH;
+  d2:	81 c7 e8 03 00 00    	add    $0x3e8,%edi
+  } while(end - start < n);
+  d8:	29 d0                	sub    %edx,%eax
+  da:	39 c8                	cmp    %ecx,%eax
+  dc:	7c dd                	jl     bb <run+0x2b>
+  printf(1, "syscallbench %s %d calls/s (%d calls in %d ticks)\n",
+  de:	83 ec 08             	sub    $0x8,%esp
+  e1:	89 c1                	mov    %eax,%ecx
+         name, calls / (end - start) * 100, calls, end - start);
+  e3:	31 d2                	xor    %edx,%edx
+  printf(1, "syscallbench %s %d calls/s (%d calls in %d ticks)\n",
+  e5:	50                   	push   %eax
+         name, calls / (end - start) * 100, calls, end - start);
+  e6:	89 f8                	mov    %edi,%eax
+  e8:	f7 f1                	div    %ecx
+  printf(1, "syscallbench %s %d calls/s (%d calls in %d ticks)\n",
+  ea:	57                   	push   %edi
+  eb:	6b c0 64             	imul   $0x64,%eax,%eax
+  ee:	50                   	push   %eax
+  ef:	ff 75 dc             	push   -0x24(%ebp)
+  f2:	68 58 0b 00 00       	push   $0xb58
+  f7:	6a 01                	push   $0x1
+  f9:	e8 32 07 00 00       	call   830 <printf>
+}
+  fe:	83 c4 20             	add    $0x20,%esp
+ 101:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 104:	5b                   	pop    %ebx
+ 105:	5e                   	pop    %esi
+ 106:	5f                   	pop    %edi
+ 107:	5d                   	pop    %ebp
+ 108:	c3                   	ret
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 42 02 00 00       	call   48f <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 6f 02 00 00       	call   511 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 a8 02 00 00       	call   55f <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 02 02 00 00       	call   4c3 <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 356:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 359:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 360:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 363:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 366:	50                   	push   %eax
+ 367:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 36a:	50                   	push   %eax
+ 36b:	6a 00                	push   $0x0
+ 36d:	e8 8d 03 00 00       	call   6ff <setitimer>
+ 372:	83 c4 10             	add    $0x10,%esp
+ 375:	89 c2                	mov    %eax,%edx
+ 377:	31 c0                	xor    %eax,%eax
+ 379:	85 d2                	test   %edx,%edx
+ 37b:	78 03                	js     380 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 37d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 380:	c9                   	leave
+ 381:	c3                   	ret
+ 382:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 390:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 395:	c3                   	ret
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003a0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 3a0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003b0 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	53                   	push   %ebx
+ 3b6:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 3b9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 3bd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 3c0:	75 5e                	jne    420 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 3c2:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 3c8:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 3ca:	89 d3                	mov    %edx,%ebx
+ 3cc:	89 c1                	mov    %eax,%ecx
+ 3ce:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 3d4:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 3da:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 3dd:	31 d2                	xor    %edx,%edx
+ 3df:	89 d8                	mov    %ebx,%eax
+ 3e1:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 3e4:	f7 f6                	div    %esi
+ 3e6:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 3e8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3eb:	f7 f6                	div    %esi
+ 3ed:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 3ef:	89 da                	mov    %ebx,%edx
+ 3f1:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 3f6:	f7 f3                	div    %ebx
+ 3f8:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 3fa:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 3ff:	89 d3                	mov    %edx,%ebx
+ 401:	f7 e1                	mul    %ecx
+ 403:	f7 f6                	div    %esi
+ 405:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 40b:	01 c3                	add    %eax,%ebx
+  return 0;
+ 40d:	31 c0                	xor    %eax,%eax
+ 40f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 412:	83 c4 0c             	add    $0xc,%esp
+ 415:	5b                   	pop    %ebx
+ 416:	5e                   	pop    %esi
+ 417:	5f                   	pop    %edi
+ 418:	5d                   	pop    %ebp
+ 419:	c3                   	ret
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 420:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 425:	eb eb                	jmp    412 <clock_gettime+0x62>
+
+00000427 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 427:	b8 01 00 00 00       	mov    $0x1,%eax
+ 42c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 433:	74 09                	je     43e <fork+0x17>
+ 435:	89 e1                	mov    %esp,%ecx
+ 437:	ba 40 04 00 00       	mov    $0x440,%edx
+ 43c:	0f 34                	sysenter
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <exit>:
+SYSCALL(exit)
+ 441:	b8 02 00 00 00       	mov    $0x2,%eax
+ 446:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 44d:	74 09                	je     458 <exit+0x17>
+ 44f:	89 e1                	mov    %esp,%ecx
+ 451:	ba 5a 04 00 00       	mov    $0x45a,%edx
+ 456:	0f 34                	sysenter
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <wait>:
+SYSCALL(wait)
+ 45b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 460:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 467:	74 09                	je     472 <wait+0x17>
+ 469:	89 e1                	mov    %esp,%ecx
+ 46b:	ba 74 04 00 00       	mov    $0x474,%edx
+ 470:	0f 34                	sysenter
+ 472:	cd 40                	int    $0x40
+ 474:	c3                   	ret
+
+00000475 <pipe>:
+SYSCALL(pipe)
+ 475:	b8 04 00 00 00       	mov    $0x4,%eax
+ 47a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 481:	74 09                	je     48c <pipe+0x17>
+ 483:	89 e1                	mov    %esp,%ecx
+ 485:	ba 8e 04 00 00       	mov    $0x48e,%edx
+ 48a:	0f 34                	sysenter
+ 48c:	cd 40                	int    $0x40
+ 48e:	c3                   	ret
+
+0000048f <read>:
+SYSCALL(read)
+ 48f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 494:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 49b:	74 09                	je     4a6 <read+0x17>
+ 49d:	89 e1                	mov    %esp,%ecx
+ 49f:	ba a8 04 00 00       	mov    $0x4a8,%edx
+ 4a4:	0f 34                	sysenter
+ 4a6:	cd 40                	int    $0x40
+ 4a8:	c3                   	ret
+
+000004a9 <write>:
+SYSCALL(write)
+ 4a9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ae:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4b5:	74 09                	je     4c0 <write+0x17>
+ 4b7:	89 e1                	mov    %esp,%ecx
+ 4b9:	ba c2 04 00 00       	mov    $0x4c2,%edx
+ 4be:	0f 34                	sysenter
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <close>:
+SYSCALL(close)
+ 4c3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4c8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4cf:	74 09                	je     4da <close+0x17>
+ 4d1:	89 e1                	mov    %esp,%ecx
+ 4d3:	ba dc 04 00 00       	mov    $0x4dc,%edx
+ 4d8:	0f 34                	sysenter
+ 4da:	cd 40                	int    $0x40
+ 4dc:	c3                   	ret
+
+000004dd <kill>:
+SYSCALL(kill)
+ 4dd:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4e2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4e9:	74 09                	je     4f4 <kill+0x17>
+ 4eb:	89 e1                	mov    %esp,%ecx
+ 4ed:	ba f6 04 00 00       	mov    $0x4f6,%edx
+ 4f2:	0f 34                	sysenter
+ 4f4:	cd 40                	int    $0x40
+ 4f6:	c3                   	ret
+
+000004f7 <exec>:
+SYSCALL(exec)
+ 4f7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4fc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 503:	74 09                	je     50e <exec+0x17>
+ 505:	89 e1                	mov    %esp,%ecx
+ 507:	ba 10 05 00 00       	mov    $0x510,%edx
+ 50c:	0f 34                	sysenter
+ 50e:	cd 40                	int    $0x40
+ 510:	c3                   	ret
+
+00000511 <open>:
+SYSCALL(open)
+ 511:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 516:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 51d:	74 09                	je     528 <open+0x17>
+ 51f:	89 e1                	mov    %esp,%ecx
+ 521:	ba 2a 05 00 00       	mov    $0x52a,%edx
+ 526:	0f 34                	sysenter
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mknod>:
+SYSCALL(mknod)
+ 52b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 530:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 537:	74 09                	je     542 <mknod+0x17>
+ 539:	89 e1                	mov    %esp,%ecx
+ 53b:	ba 44 05 00 00       	mov    $0x544,%edx
+ 540:	0f 34                	sysenter
+ 542:	cd 40                	int    $0x40
+ 544:	c3                   	ret
+
+00000545 <unlink>:
+SYSCALL(unlink)
+ 545:	b8 12 00 00 00       	mov    $0x12,%eax
+ 54a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 551:	74 09                	je     55c <unlink+0x17>
+ 553:	89 e1                	mov    %esp,%ecx
+ 555:	ba 5e 05 00 00       	mov    $0x55e,%edx
+ 55a:	0f 34                	sysenter
+ 55c:	cd 40                	int    $0x40
+ 55e:	c3                   	ret
+
+0000055f <fstat>:
+SYSCALL(fstat)
+ 55f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 564:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 56b:	74 09                	je     576 <fstat+0x17>
+ 56d:	89 e1                	mov    %esp,%ecx
+ 56f:	ba 78 05 00 00       	mov    $0x578,%edx
+ 574:	0f 34                	sysenter
+ 576:	cd 40                	int    $0x40
+ 578:	c3                   	ret
+
+00000579 <link>:
+SYSCALL(link)
+ 579:	b8 13 00 00 00       	mov    $0x13,%eax
+ 57e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 585:	74 09                	je     590 <link+0x17>
+ 587:	89 e1                	mov    %esp,%ecx
+ 589:	ba 92 05 00 00       	mov    $0x592,%edx
+ 58e:	0f 34                	sysenter
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <mkdir>:
+SYSCALL(mkdir)
+ 593:	b8 14 00 00 00       	mov    $0x14,%eax
+ 598:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 59f:	74 09                	je     5aa <mkdir+0x17>
+ 5a1:	89 e1                	mov    %esp,%ecx
+ 5a3:	ba ac 05 00 00       	mov    $0x5ac,%edx
+ 5a8:	0f 34                	sysenter
+ 5aa:	cd 40                	int    $0x40
+ 5ac:	c3                   	ret
+
+000005ad <chdir>:
+SYSCALL(chdir)
+ 5ad:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5b2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5b9:	74 09                	je     5c4 <chdir+0x17>
+ 5bb:	89 e1                	mov    %esp,%ecx
+ 5bd:	ba c6 05 00 00       	mov    $0x5c6,%edx
+ 5c2:	0f 34                	sysenter
+ 5c4:	cd 40                	int    $0x40
+ 5c6:	c3                   	ret
+
+000005c7 <dup>:
+SYSCALL(dup)
+ 5c7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5cc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5d3:	74 09                	je     5de <dup+0x17>
+ 5d5:	89 e1                	mov    %esp,%ecx
+ 5d7:	ba e0 05 00 00       	mov    $0x5e0,%edx
+ 5dc:	0f 34                	sysenter
+ 5de:	cd 40                	int    $0x40
+ 5e0:	c3                   	ret
+
+000005e1 <sbrk>:
+SYSCALL(sbrk)
+ 5e1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5e6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5ed:	74 09                	je     5f8 <sbrk+0x17>
+ 5ef:	89 e1                	mov    %esp,%ecx
+ 5f1:	ba fa 05 00 00       	mov    $0x5fa,%edx
+ 5f6:	0f 34                	sysenter
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <sleep>:
+SYSCALL(sleep)
+ 5fb:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 600:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 607:	74 09                	je     612 <sleep+0x17>
+ 609:	89 e1                	mov    %esp,%ecx
+ 60b:	ba 14 06 00 00       	mov    $0x614,%edx
+ 610:	0f 34                	sysenter
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 615:	b8 16 00 00 00       	mov    $0x16,%eax
+ 61a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 621:	74 09                	je     62c <sigprocmask+0x17>
+ 623:	89 e1                	mov    %esp,%ecx
+ 625:	ba 2e 06 00 00       	mov    $0x62e,%edx
+ 62a:	0f 34                	sysenter
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <sigaction>:
+SYSCALL(sigaction)
+ 62f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 634:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 63b:	74 09                	je     646 <sigaction+0x17>
+ 63d:	89 e1                	mov    %esp,%ecx
+ 63f:	ba 48 06 00 00       	mov    $0x648,%edx
+ 644:	0f 34                	sysenter
+ 646:	cd 40                	int    $0x40
+ 648:	c3                   	ret
+
+00000649 <sigret>:
+SYSCALL(sigret)
+ 649:	b8 18 00 00 00       	mov    $0x18,%eax
+ 64e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 655:	74 09                	je     660 <sigret+0x17>
+ 657:	89 e1                	mov    %esp,%ecx
+ 659:	ba 62 06 00 00       	mov    $0x662,%edx
+ 65e:	0f 34                	sysenter
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <traceread>:
+SYSCALL(traceread)
+ 663:	b8 19 00 00 00       	mov    $0x19,%eax
+ 668:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 66f:	74 09                	je     67a <traceread+0x17>
+ 671:	89 e1                	mov    %esp,%ecx
+ 673:	ba 7c 06 00 00       	mov    $0x67c,%edx
+ 678:	0f 34                	sysenter
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <sigqueue>:
+SYSCALL(sigqueue)
+ 67d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 682:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 689:	74 09                	je     694 <sigqueue+0x17>
+ 68b:	89 e1                	mov    %esp,%ecx
+ 68d:	ba 96 06 00 00       	mov    $0x696,%edx
+ 692:	0f 34                	sysenter
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <signalfd>:
+SYSCALL(signalfd)
+ 697:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 69c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6a3:	74 09                	je     6ae <signalfd+0x17>
+ 6a5:	89 e1                	mov    %esp,%ecx
+ 6a7:	ba b0 06 00 00       	mov    $0x6b0,%edx
+ 6ac:	0f 34                	sysenter
+ 6ae:	cd 40                	int    $0x40
+ 6b0:	c3                   	ret
+
+000006b1 <sigwait>:
+SYSCALL(sigwait)
+ 6b1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6b6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6bd:	74 09                	je     6c8 <sigwait+0x17>
+ 6bf:	89 e1                	mov    %esp,%ecx
+ 6c1:	ba ca 06 00 00       	mov    $0x6ca,%edx
+ 6c6:	0f 34                	sysenter
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <sigsuspend>:
+SYSCALL(sigsuspend)
+ 6cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6d0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6d7:	74 09                	je     6e2 <sigsuspend+0x17>
+ 6d9:	89 e1                	mov    %esp,%ecx
+ 6db:	ba e4 06 00 00       	mov    $0x6e4,%edx
+ 6e0:	0f 34                	sysenter
+ 6e2:	cd 40                	int    $0x40
+ 6e4:	c3                   	ret
+
+000006e5 <waitpid>:
+SYSCALL(waitpid)
+ 6e5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6ea:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6f1:	74 09                	je     6fc <waitpid+0x17>
+ 6f3:	89 e1                	mov    %esp,%ecx
+ 6f5:	ba fe 06 00 00       	mov    $0x6fe,%edx
+ 6fa:	0f 34                	sysenter
+ 6fc:	cd 40                	int    $0x40
+ 6fe:	c3                   	ret
+
+000006ff <setitimer>:
+SYSCALL(setitimer)
+ 6ff:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 704:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 70b:	74 09                	je     716 <setitimer+0x17>
+ 70d:	89 e1                	mov    %esp,%ecx
+ 70f:	ba 18 07 00 00       	mov    $0x718,%edx
+ 714:	0f 34                	sysenter
+ 716:	cd 40                	int    $0x40
+ 718:	c3                   	ret
+
+00000719 <nanosleep>:
+SYSCALL(nanosleep)
+ 719:	b8 21 00 00 00       	mov    $0x21,%eax
+ 71e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 725:	74 09                	je     730 <nanosleep+0x17>
+ 727:	89 e1                	mov    %esp,%ecx
+ 729:	ba 32 07 00 00       	mov    $0x732,%edx
+ 72e:	0f 34                	sysenter
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <mmap>:
+SYSCALL(mmap)
+ 733:	b8 22 00 00 00       	mov    $0x22,%eax
+ 738:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 73f:	74 09                	je     74a <mmap+0x17>
+ 741:	89 e1                	mov    %esp,%ecx
+ 743:	ba 4c 07 00 00       	mov    $0x74c,%edx
+ 748:	0f 34                	sysenter
+ 74a:	cd 40                	int    $0x40
+ 74c:	c3                   	ret
+
+0000074d <munmap>:
+SYSCALL(munmap)
+ 74d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 752:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 759:	74 09                	je     764 <munmap+0x17>
+ 75b:	89 e1                	mov    %esp,%ecx
+ 75d:	ba 66 07 00 00       	mov    $0x766,%edx
+ 762:	0f 34                	sysenter
+ 764:	cd 40                	int    $0x40
+ 766:	c3                   	ret
+
+00000767 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 767:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 76c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 773:	74 09                	je     77e <getpid_syscall+0x17>
+ 775:	89 e1                	mov    %esp,%ecx
+ 777:	ba 80 07 00 00       	mov    $0x780,%edx
+ 77c:	0f 34                	sysenter
+ 77e:	cd 40                	int    $0x40
+ 780:	c3                   	ret
+
+00000781 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 781:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 786:	cd 40                	int    $0x40
+ 788:	c3                   	ret
+ 789:	66 90                	xchg   %ax,%ax
+ 78b:	66 90                	xchg   %ax,%ax
+ 78d:	66 90                	xchg   %ax,%ax
+ 78f:	90                   	nop
+
+00000790 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 798:	89 d1                	mov    %edx,%ecx
+{
+ 79a:	83 ec 3c             	sub    $0x3c,%esp
+ 79d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7a0:	85 d2                	test   %edx,%edx
+ 7a2:	0f 89 80 00 00 00    	jns    828 <printint+0x98>
+ 7a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7ac:	74 7a                	je     828 <printint+0x98>
+    x = -xx;
+ 7ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7b8:	31 f6                	xor    %esi,%esi
+ 7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7c0:	89 c8                	mov    %ecx,%eax
+ 7c2:	31 d2                	xor    %edx,%edx
+ 7c4:	89 f7                	mov    %esi,%edi
+ 7c6:	f7 f3                	div    %ebx
+ 7c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7cb:	0f b6 92 30 0c 00 00 	movzbl 0xc30(%edx),%edx
+ 7d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7d6:	89 ca                	mov    %ecx,%edx
+ 7d8:	89 c1                	mov    %eax,%ecx
+ 7da:	39 da                	cmp    %ebx,%edx
+ 7dc:	73 e2                	jae    7c0 <printint+0x30>
+  if(neg)
+ 7de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7e1:	85 c0                	test   %eax,%eax
+ 7e3:	74 07                	je     7ec <printint+0x5c>
+    buf[i++] = '-';
+ 7e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ea:	89 f7                	mov    %esi,%edi
+ 7ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7f2:	01 df                	add    %ebx,%edi
+ 7f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7fb:	83 ec 04             	sub    $0x4,%esp
+ 7fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 801:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 804:	6a 01                	push   $0x1
+ 806:	50                   	push   %eax
+ 807:	56                   	push   %esi
+ 808:	e8 9c fc ff ff       	call   4a9 <write>
+  while(--i >= 0)
+ 80d:	89 f8                	mov    %edi,%eax
+ 80f:	83 c4 10             	add    $0x10,%esp
+ 812:	83 ef 01             	sub    $0x1,%edi
+ 815:	39 d8                	cmp    %ebx,%eax
+ 817:	75 df                	jne    7f8 <printint+0x68>
+}
+ 819:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 81c:	5b                   	pop    %ebx
+ 81d:	5e                   	pop    %esi
+ 81e:	5f                   	pop    %edi
+ 81f:	5d                   	pop    %ebp
+ 820:	c3                   	ret
+ 821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 828:	31 c0                	xor    %eax,%eax
+ 82a:	eb 89                	jmp    7b5 <printint+0x25>
+ 82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000830 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 839:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 83c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 83f:	0f b6 1e             	movzbl (%esi),%ebx
+ 842:	83 c6 01             	add    $0x1,%esi
+ 845:	84 db                	test   %bl,%bl
+ 847:	74 67                	je     8b0 <printf+0x80>
+ 849:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 84c:	31 d2                	xor    %edx,%edx
+ 84e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 851:	eb 34                	jmp    887 <printf+0x57>
+ 853:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 857:	90                   	nop
+ 858:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 85b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 860:	83 f8 25             	cmp    $0x25,%eax
+ 863:	74 18                	je     87d <printf+0x4d>
+  write(fd, &c, 1);
+ 865:	83 ec 04             	sub    $0x4,%esp
+ 868:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 86b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 86e:	6a 01                	push   $0x1
+ 870:	50                   	push   %eax
+ 871:	57                   	push   %edi
+ 872:	e8 32 fc ff ff       	call   4a9 <write>
+ 877:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 87a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 87d:	0f b6 1e             	movzbl (%esi),%ebx
+ 880:	83 c6 01             	add    $0x1,%esi
+ 883:	84 db                	test   %bl,%bl
+ 885:	74 29                	je     8b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 887:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 88a:	85 d2                	test   %edx,%edx
+ 88c:	74 ca                	je     858 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 88e:	83 fa 25             	cmp    $0x25,%edx
+ 891:	75 ea                	jne    87d <printf+0x4d>
+      if(c == 'd'){
+ 893:	83 f8 25             	cmp    $0x25,%eax
+ 896:	0f 84 24 01 00 00    	je     9c0 <printf+0x190>
+ 89c:	83 e8 63             	sub    $0x63,%eax
+ 89f:	83 f8 15             	cmp    $0x15,%eax
+ 8a2:	77 1c                	ja     8c0 <printf+0x90>
+ 8a4:	ff 24 85 d8 0b 00 00 	jmp    *0xbd8(,%eax,4)
+ 8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8b3:	5b                   	pop    %ebx
+ 8b4:	5e                   	pop    %esi
+ 8b5:	5f                   	pop    %edi
+ 8b6:	5d                   	pop    %ebp
+ 8b7:	c3                   	ret
+ 8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+  write(fd, &c, 1);
+ 8c0:	83 ec 04             	sub    $0x4,%esp
+ 8c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ca:	6a 01                	push   $0x1
+ 8cc:	52                   	push   %edx
+ 8cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8d0:	57                   	push   %edi
+ 8d1:	e8 d3 fb ff ff       	call   4a9 <write>
+ 8d6:	83 c4 0c             	add    $0xc,%esp
+ 8d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8dc:	6a 01                	push   $0x1
+ 8de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8e1:	52                   	push   %edx
+ 8e2:	57                   	push   %edi
+ 8e3:	e8 c1 fb ff ff       	call   4a9 <write>
+        putc(fd, c);
+ 8e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8eb:	31 d2                	xor    %edx,%edx
+ 8ed:	eb 8e                	jmp    87d <printf+0x4d>
+ 8ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8fb:	8b 13                	mov    (%ebx),%edx
+ 8fd:	6a 00                	push   $0x0
+ 8ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 901:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 904:	e8 87 fe ff ff       	call   790 <printint>
+        ap++;
+ 909:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 90c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 90f:	31 d2                	xor    %edx,%edx
+ 911:	e9 67 ff ff ff       	jmp    87d <printf+0x4d>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 920:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 923:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 925:	83 c0 04             	add    $0x4,%eax
+ 928:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 92b:	85 db                	test   %ebx,%ebx
+ 92d:	0f 84 9d 00 00 00    	je     9d0 <printf+0x1a0>
+        while(*s != 0){
+ 933:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 936:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 938:	84 c0                	test   %al,%al
+ 93a:	0f 84 3d ff ff ff    	je     87d <printf+0x4d>
+ 940:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 943:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 946:	89 de                	mov    %ebx,%esi
+ 948:	89 d3                	mov    %edx,%ebx
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 956:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 959:	6a 01                	push   $0x1
+ 95b:	53                   	push   %ebx
+ 95c:	57                   	push   %edi
+ 95d:	e8 47 fb ff ff       	call   4a9 <write>
+        while(*s != 0){
+ 962:	0f b6 06             	movzbl (%esi),%eax
+ 965:	83 c4 10             	add    $0x10,%esp
+ 968:	84 c0                	test   %al,%al
+ 96a:	75 e4                	jne    950 <printf+0x120>
+      state = 0;
+ 96c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 96f:	31 d2                	xor    %edx,%edx
+ 971:	e9 07 ff ff ff       	jmp    87d <printf+0x4d>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 980:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 98b:	8b 13                	mov    (%ebx),%edx
+ 98d:	6a 01                	push   $0x1
+ 98f:	e9 6b ff ff ff       	jmp    8ff <printf+0xcf>
+ 994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 998:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 99b:	83 ec 04             	sub    $0x4,%esp
+ 99e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	52                   	push   %edx
+ 9ac:	57                   	push   %edi
+ 9ad:	e8 f7 fa ff ff       	call   4a9 <write>
+        ap++;
+ 9b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9b8:	31 d2                	xor    %edx,%edx
+ 9ba:	e9 be fe ff ff       	jmp    87d <printf+0x4d>
+ 9bf:	90                   	nop
+  write(fd, &c, 1);
+ 9c0:	83 ec 04             	sub    $0x4,%esp
+ 9c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9c9:	6a 01                	push   $0x1
+ 9cb:	e9 11 ff ff ff       	jmp    8e1 <printf+0xb1>
+ 9d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9d5:	bb cf 0b 00 00       	mov    $0xbcf,%ebx
+ 9da:	e9 61 ff ff ff       	jmp    940 <printf+0x110>
+ 9df:	90                   	nop
+
+000009e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e1:	a1 78 0f 00 00       	mov    0xf78,%eax
+{
+ 9e6:	89 e5                	mov    %esp,%ebp
+ 9e8:	57                   	push   %edi
+ 9e9:	56                   	push   %esi
+ 9ea:	53                   	push   %ebx
+ 9eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9fc:	39 ca                	cmp    %ecx,%edx
+ 9fe:	73 30                	jae    a30 <free+0x50>
+ a00:	39 c1                	cmp    %eax,%ecx
+ a02:	72 04                	jb     a08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a04:	39 c2                	cmp    %eax,%edx
+ a06:	72 f0                	jb     9f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a0e:	39 f8                	cmp    %edi,%eax
+ a10:	74 2e                	je     a40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a15:	8b 42 04             	mov    0x4(%edx),%eax
+ a18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a1b:	39 f1                	cmp    %esi,%ecx
+ a1d:	74 38                	je     a57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a21:	5b                   	pop    %ebx
+  freep = p;
+ a22:	89 15 78 0f 00 00    	mov    %edx,0xf78
+}
+ a28:	5e                   	pop    %esi
+ a29:	5f                   	pop    %edi
+ a2a:	5d                   	pop    %ebp
+ a2b:	c3                   	ret
+ a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a30:	39 c1                	cmp    %eax,%ecx
+ a32:	72 d0                	jb     a04 <free+0x24>
+ a34:	eb c2                	jmp    9f8 <free+0x18>
+ a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a40:	03 70 04             	add    0x4(%eax),%esi
+ a43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a46:	8b 02                	mov    (%edx),%eax
+ a48:	8b 00                	mov    (%eax),%eax
+ a4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a4d:	8b 42 04             	mov    0x4(%edx),%eax
+ a50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a53:	39 f1                	cmp    %esi,%ecx
+ a55:	75 c8                	jne    a1f <free+0x3f>
+    p->s.size += bp->s.size;
+ a57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a5a:	89 15 78 0f 00 00    	mov    %edx,0xf78
+    p->s.size += bp->s.size;
+ a60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a66:	89 0a                	mov    %ecx,(%edx)
+}
+ a68:	5b                   	pop    %ebx
+ a69:	5e                   	pop    %esi
+ a6a:	5f                   	pop    %edi
+ a6b:	5d                   	pop    %ebp
+ a6c:	c3                   	ret
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	57                   	push   %edi
+ a74:	56                   	push   %esi
+ a75:	53                   	push   %ebx
+ a76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a7c:	8b 15 78 0f 00 00    	mov    0xf78,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a82:	8d 78 07             	lea    0x7(%eax),%edi
+ a85:	c1 ef 03             	shr    $0x3,%edi
+ a88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a8b:	85 d2                	test   %edx,%edx
+ a8d:	0f 84 8d 00 00 00    	je     b20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a95:	8b 48 04             	mov    0x4(%eax),%ecx
+ a98:	39 f9                	cmp    %edi,%ecx
+ a9a:	73 64                	jae    b00 <malloc+0x90>
+  if(nu < 4096)
+ a9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ aa1:	39 df                	cmp    %ebx,%edi
+ aa3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ aa6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ aad:	eb 0a                	jmp    ab9 <malloc+0x49>
+ aaf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ab0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ab2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ab5:	39 f9                	cmp    %edi,%ecx
+ ab7:	73 47                	jae    b00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ab9:	89 c2                	mov    %eax,%edx
+ abb:	39 05 78 0f 00 00    	cmp    %eax,0xf78
+ ac1:	75 ed                	jne    ab0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	56                   	push   %esi
+ ac7:	e8 15 fb ff ff       	call   5e1 <sbrk>
+  if(p == (char*)-1)
+ acc:	83 c4 10             	add    $0x10,%esp
+ acf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ad2:	74 1c                	je     af0 <malloc+0x80>
+  hp->s.size = nu;
+ ad4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ad7:	83 ec 0c             	sub    $0xc,%esp
+ ada:	83 c0 08             	add    $0x8,%eax
+ add:	50                   	push   %eax
+ ade:	e8 fd fe ff ff       	call   9e0 <free>
+  return freep;
+ ae3:	8b 15 78 0f 00 00    	mov    0xf78,%edx
+      if((p = morecore(nunits)) == 0)
+ ae9:	83 c4 10             	add    $0x10,%esp
+ aec:	85 d2                	test   %edx,%edx
+ aee:	75 c0                	jne    ab0 <malloc+0x40>
+        return 0;
+  }
+}
+ af0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ af3:	31 c0                	xor    %eax,%eax
+}
+ af5:	5b                   	pop    %ebx
+ af6:	5e                   	pop    %esi
+ af7:	5f                   	pop    %edi
+ af8:	5d                   	pop    %ebp
+ af9:	c3                   	ret
+ afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b00:	39 cf                	cmp    %ecx,%edi
+ b02:	74 4c                	je     b50 <malloc+0xe0>
+        p->s.size -= nunits;
+ b04:	29 f9                	sub    %edi,%ecx
+ b06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b0f:	89 15 78 0f 00 00    	mov    %edx,0xf78
+}
+ b15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b18:	83 c0 08             	add    $0x8,%eax
+}
+ b1b:	5b                   	pop    %ebx
+ b1c:	5e                   	pop    %esi
+ b1d:	5f                   	pop    %edi
+ b1e:	5d                   	pop    %ebp
+ b1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b20:	c7 05 78 0f 00 00 7c 	movl   $0xf7c,0xf78
+ b27:	0f 00 00 
+    base.s.size = 0;
+ b2a:	b8 7c 0f 00 00       	mov    $0xf7c,%eax
+    base.s.ptr = freep = prevp = &base;
+ b2f:	c7 05 7c 0f 00 00 7c 	movl   $0xf7c,0xf7c
+ b36:	0f 00 00 
+    base.s.size = 0;
+ b39:	c7 05 80 0f 00 00 00 	movl   $0x0,0xf80
+ b40:	00 00 00 
+    if(p->s.size >= nunits){
+ b43:	e9 54 ff ff ff       	jmp    a9c <malloc+0x2c>
+ b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b50:	8b 08                	mov    (%eax),%ecx
+ b52:	89 0a                	mov    %ecx,(%edx)
+ b54:	eb b9                	jmp    b0f <malloc+0x9f>
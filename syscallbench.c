@@ -0,0 +1,56 @@
+// Null system call round-trip rate.
+// Calls getpid through int $T_SYSCALL, through SYSENTER (when the
+// kernel enables it; otherwise the same stub falls back to int), and
+// then as ulib reads it from the VPROC page, in batches for a fixed
+// number of clock ticks and reports calls per second for each.
+//   usage: syscallbench [ticks]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define BATCH 1000
+
+static void
+run(char *name, int (*fn)(void), int n)
+{
+  int i, start, end;
+  uint calls;
+
+  // Start on a tick boundary.
+  start = uptime();
+  while(uptime() == start)
+    ;
+  start = uptime();
+
+  calls = 0;
+  do {
+    for(i = 0; i < BATCH; i++)
+      fn();
+    calls += BATCH;
+    end = uptime();
+  } while(end - start < n);
+
+  // 100 ticks per second.
+  printf(1, "syscallbench %s %d calls/s (%d calls in %d ticks)\n",
+         name, calls / (end - start) * 100, calls, end - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n;
+
+  n = 100;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(n <= 0){
+    printf(2, "usage: syscallbench [ticks]\n");
+    exit(1);
+  }
+
+  run("getpid_int", getpid_int, n);
+  run("getpid_sysenter", getpid_syscall, n);
+  run("getpid_vdso", getpid, n);
+  exit(0);
+}
@@ -85,7 +85,7 @@ sys_write(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argrdptr(1, &p, n) < 0)
     return -1;
   return filewrite(f, p, n);
 }
@@ -314,6 +314,13 @@ sys_open(void)
     }
   }
 
+  // A program being run cannot be written (see iexec).
+  if(ip->nexec > 0 && (omode & (O_WRONLY|O_RDWR))){
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+
   if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
     if(f)
       fileclose(f);
@@ -442,3 +449,58 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+// Create a file descriptor from which read() returns the caller's
+// pending signals in mask as struct siginfo records, instead of
+// running their handlers. The signals should also be blocked with
+// sigprocmask() so they are not delivered before they are read.
+int
+sys_signalfd(void)
+{
+  int fd, mask;
+  struct file *f;
+
+  if(argint(0, &mask) < 0)
+    return -1;
+  if((f = filealloc()) == 0)
+    return -1;
+  f->type = FD_SIGNAL;
+  f->readable = 1;
+  f->writable = 0;
+  f->sigmask = mask;
+  if((fd = fdalloc(f)) < 0){
+    fileclose(f);
+    return -1;
+  }
+  return fd;
+}
+
+// Map len bytes of the file open as fd, from offset off, or of
+// zero-filled memory if flags has MAP_ANONYMOUS. addr is only a
+// hint, and is ignored. Returns the address of the mapping.
+int
+sys_mmap(void)
+{
+  int addr, len, prot, flags, off;
+  struct file *f;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || argint(2, &prot) < 0 ||
+     argint(3, &flags) < 0 || argint(5, &off) < 0)
+    return -1;
+  f = 0;
+  if(!(flags & MAP_ANONYMOUS) && argfd(4, 0, &f) < 0)
+    return -1;
+  if(len <= 0 || off < 0)
+    return -1;
+  return mmap(len, prot, flags, f, off);
+}
+
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || len < 0)
+    return -1;
+  return munmap(addr, len);
+}
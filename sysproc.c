@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "trace.h"
 
 int
 sys_fork(void)
@@ -16,7 +17,11 @@ sys_fork(void)
 int
 sys_exit(void)
 {
-  exit();
+  int status;
+
+  if(argint(0, &status) < 0)
+    return -1;
+  exit(status);
   return 0;  // not reached
 }
 
@@ -26,6 +31,21 @@ sys_wait(void)
   return wait();
 }
 
+int
+sys_waitpid(void)
+{
+  int pid, options;
+  int *status;
+
+  if(argint(0, &pid) < 0 || argint(1, (int*)&status) < 0 ||
+     argint(2, &options) < 0)
+    return -1;
+  // A null status pointer means the caller does not want it.
+  if(status && argptr(1, (char**)&status, sizeof(*status)) < 0)
+    return -1;
+  return waitpid(pid, status, options);
+}
+
 int
 sys_kill(void)
 {
@@ -35,6 +55,53 @@ sys_kill(void)
   return kill(pid, signum);
 }
 
+int
+sys_sigqueue(void)
+{
+  int pid, signum, value;
+
+  if(argint(0, &pid) < 0 || argint(1, &signum) < 0 || argint(2, &value) < 0)
+    return -1;
+  return sigqueue(pid, signum, value);
+}
+
+int
+sys_sigwait(void)
+{
+  int set;
+
+  if(argint(0, &set) < 0)
+    return -1;
+  return sigwait(set);
+}
+
+int
+sys_sigsuspend(void)
+{
+  int mask;
+
+  if(argint(0, &mask) < 0)
+    return -1;
+  return sigsuspend(mask);
+}
+
+int
+sys_setitimer(void)
+{
+  int which;
+  struct itimerval *value, *ovalue;
+
+  if(argint(0, &which) < 0 || argint(1, (int*)&value) < 0 ||
+     argint(2, (int*)&ovalue) < 0)
+    return -1;
+  // Either pointer may be null.
+  if(value && argptr(1, (char**)&value, sizeof(*value)) < 0)
+    return -1;
+  if(ovalue && argptr(2, (char**)&ovalue, sizeof(*ovalue)) < 0)
+    return -1;
+  return setitimer(which, value, ovalue);
+}
+
 int
 sys_getpid(void)
 {
@@ -59,20 +126,34 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
+  return sleepticks(n);
+}
+
+int
+sys_nanosleep(void)
+{
+  struct timespec *ts;
+
+  if(argptr(0, (char**)&ts, sizeof(*ts)) < 0 || ts->tv_nsec >= 1000000000)
+    return -1;
+  return nanosleep(ts);
+}
+
+// Time since boot from the TSC, for CLOCK_MONOTONIC.
+int
+sys_clock_gettime(void)
+{
+  int clock;
+  struct timespec *ts;
+
+  if(argint(0, &clock) < 0 || argptr(1, (char**)&ts, sizeof(*ts)) < 0)
+    return -1;
+  if(clock != CLOCK_MONOTONIC)
+    return -1;
+  tsc2ts(rdtsc() - tsc0, ts);
   return 0;
 }
 
@@ -125,8 +206,19 @@ int sys_sigaction(void){
 /***************** TASK-2.1.5******************/
 /*           The sigret system call           */
 int sys_sigret(void){
-  sigret();
- return 0;
+  return sigret();
 }
 /**********************************************/
 
+// Copy unread kernel trace records (see trace.c) to user space.
+int
+sys_traceread(void)
+{
+  struct traceent *buf;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 ||
+     argptr(0, (char**)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return traceread(buf, n);
+}
@@ -0,0 +1,247 @@
+// Per-CPU hierarchical timer wheels.
+//
+// Each CPU advances its own wheel from its timer interrupt, so
+// arming, cancelling and expiring timers only contend with other CPUs
+// touching the same wheel. Timers due within TVR_SIZE ticks sit in
+// tv1, one slot per tick; later ones sit in coarser levels and are
+// cascaded down a level each time the level below wraps around.
+// Expiry callbacks run from the interrupt with the wheel locked, so a
+// timer cannot fire once timercancel() has returned. Lock order: a
+// wheel lock, then pidhash.lock and ptable.lock (see proc.c).
+//
+// Timers armed with hrtimerset() for a TSC deadline instead sit on
+// the wheel's hr list, soonest first, and the CPU's one-shot LAPIC
+// timer is brought forward to fire for the first of them.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define TVR_BITS 8
+#define TVN_BITS 6
+#define TVR_SIZE (1 << TVR_BITS)
+#define TVN_SIZE (1 << TVN_BITS)
+#define TVR_MASK (TVR_SIZE - 1)
+#define TVN_MASK (TVN_SIZE - 1)
+#define NTVN     3                                  // Levels above tv1
+#define MAXDELAY ((1 << (TVR_BITS + NTVN * TVN_BITS)) - 1)
+
+// Slot in level n (0 = first level above tv1) that tick t falls in.
+#define TVINDEX(t, n) (((t) >> (TVR_BITS + (n) * TVN_BITS)) & TVN_MASK)
+
+struct wheel {
+  struct spinlock lock;
+  uint now;                          // Ticks this wheel has run
+  struct timer *tv1[TVR_SIZE];
+  struct timer *tvn[NTVN][TVN_SIZE];
+  struct timer *hr;                  // hrtimerset() timers, soonest first
+};
+
+static struct wheel wheels[NCPU];
+
+void
+timerinit(void)
+{
+  struct wheel *w;
+
+  for(w = wheels; w < &wheels[NCPU]; w++)
+    initlock(&w->lock, "timer");
+}
+
+// Put t on the slot of w that covers t->expires. w->lock must be held.
+static void
+enqueue(struct wheel *w, struct timer *t)
+{
+  uint idx, n;
+  struct timer **slot;
+
+  idx = t->expires - w->now;
+  if((int)idx < 0){
+    // Already due: run on the next tick.
+    t->expires = w->now;
+    idx = 0;
+  }
+  if(idx > MAXDELAY){
+    t->expires = w->now + MAXDELAY;
+    idx = MAXDELAY;
+  }
+  if(idx < TVR_SIZE)
+    slot = &w->tv1[t->expires & TVR_MASK];
+  else {
+    for(n = 0; idx >= (1 << (TVR_BITS + (n + 1) * TVN_BITS)); n++)
+      ;
+    slot = &w->tvn[n][TVINDEX(t->expires, n)];
+  }
+  t->slot = slot;
+  t->prev = 0;
+  t->next = *slot;
+  if(*slot)
+    (*slot)->prev = t;
+  *slot = t;
+}
+
+// Take t off its slot. The lock of t's wheel must be held.
+static void
+dequeue(struct timer *t)
+{
+  if(t->prev)
+    t->prev->next = t->next;
+  else
+    *t->slot = t->next;
+  if(t->next)
+    t->next->prev = t->prev;
+  t->next = t->prev = 0;
+  t->slot = 0;
+}
+
+// Re-file every timer in slot idx of level n one level down.
+// Returns idx, so the caller cascades the next level when it is 0.
+static int
+cascade(struct wheel *w, int n, int idx)
+{
+  struct timer *t, *next;
+
+  t = w->tvn[n][idx];
+  w->tvn[n][idx] = 0;
+  for(; t; t = next){
+    next = t->next;
+    enqueue(w, t);
+  }
+  return idx;
+}
+
+// Cancel t if it is armed. Returns the ticks it had left, or 0.
+uint
+timercancel(struct timer *t)
+{
+  struct wheel *w;
+  uint left;
+  int cpu;
+
+  // t may move between wheels until we hold the one it is on.
+  while((cpu = t->cpu) >= 0){
+    w = &wheels[cpu];
+    acquire(&w->lock);
+    if(t->cpu == cpu){
+      left = t->expires - w->now + 1;
+      dequeue(t);
+      t->cpu = -1;
+      release(&w->lock);
+      return left;
+    }
+    release(&w->lock);
+  }
+  return 0;
+}
+
+// Arm t to call t->fn(t) after delay ticks (at least 1) on this CPU's
+// wheel, then every t->interval ticks if that is non-zero. Cancels
+// any earlier arming first.
+void
+timerset(struct timer *t, uint delay)
+{
+  struct wheel *w;
+
+  timercancel(t);
+  if(delay == 0)
+    delay = 1;
+  pushcli();
+  w = &wheels[cpuid()];
+  acquire(&w->lock);
+  t->expires = w->now + delay - 1;
+  t->cpu = w - wheels;
+  enqueue(w, t);
+  release(&w->lock);
+  popcli();
+}
+
+// Arm t to call t->fn(t) from the first timer interrupt on this CPU
+// at or after TSC value deadline. Cancels any earlier arming first.
+void
+hrtimerset(struct timer *t, uint64 deadline)
+{
+  struct wheel *w;
+  struct timer **pp, *prev;
+
+  timercancel(t);
+  pushcli();
+  w = &wheels[cpuid()];
+  acquire(&w->lock);
+  t->deadline = deadline;
+  t->cpu = w - wheels;
+  t->slot = &w->hr;
+  prev = 0;
+  for(pp = &w->hr; *pp && (*pp)->deadline <= deadline; pp = &(*pp)->next)
+    prev = *pp;
+  t->prev = prev;
+  t->next = *pp;
+  if(*pp)
+    (*pp)->prev = t;
+  *pp = t;
+  if(w->hr == t)
+    lapicarm(deadline);
+  release(&w->lock);
+  popcli();
+}
+
+// Fire this CPU's hrtimerset() timers whose deadline has passed, then
+// program its LAPIC timer for the next tick or the next deadline.
+// Called from the timer interrupt.
+void
+hrtick(void)
+{
+  struct wheel *w;
+  struct timer *t;
+  uint64 now;
+
+  w = &wheels[cpuid()];
+  acquire(&w->lock);
+  now = rdtsc();
+  while((t = w->hr) != 0 && t->deadline <= now){
+    dequeue(t);
+    t->cpu = -1;
+    t->fn(t);
+  }
+  lapicarm(w->hr ? w->hr->deadline : 0);
+  release(&w->lock);
+}
+
+// Advance this CPU's wheel by one tick and fire the timers that are
+// due. Called from the timer interrupt.
+void
+timertick(void)
+{
+  struct wheel *w;
+  struct timer *t, *next;
+  int idx;
+
+  w = &wheels[cpuid()];
+  acquire(&w->lock);
+  idx = w->now & TVR_MASK;
+  if(idx == 0 &&
+     cascade(w, 0, TVINDEX(w->now, 0)) == 0 &&
+     cascade(w, 1, TVINDEX(w->now, 1)) == 0)
+    cascade(w, 2, TVINDEX(w->now, 2));
+  w->now++;
+
+  t = w->tv1[idx];
+  w->tv1[idx] = 0;
+  for(; t; t = next){
+    next = t->next;
+    t->next = t->prev = 0;
+    t->slot = 0;
+    t->cpu = -1;
+    if(t->interval){
+      t->expires = w->now + t->interval - 1;
+      t->cpu = w - wheels;
+      enqueue(w, t);
+    }
+    t->fn(t);
+  }
+  release(&w->lock);
+}
@@ -0,0 +1,84 @@
+// Per-CPU kernel event trace.
+//
+// Each CPU appends to its own ring of NTRACE records with interrupts
+// off, so recording takes no lock and never waits for the console.
+// traceread() copies out the records written since the previous call,
+// dropping any that were overwritten before they could be read.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "trace.h"
+
+struct tracering {
+  struct traceent ent[NTRACE];
+  volatile uint head;  // Number of records ever written
+  uint tail;           // Next record traceread() will return
+};
+
+static struct tracering rings[NCPU];
+static struct spinlock readlock;  // Serializes readers (tail)
+
+void
+traceinit(void)
+{
+  initlock(&readlock, "trace");
+}
+
+// Record an event on this CPU's ring.
+void
+trace(int event, int pid, uint arg)
+{
+  struct tracering *r;
+  struct traceent *e;
+
+  pushcli();
+  r = &rings[cpuid()];
+  e = &r->ent[r->head % NTRACE];
+  e->tsc = rdtsc();
+  e->cpu = cpuid();
+  e->event = event;
+  e->pid = pid;
+  e->arg = arg;
+  r->head++;
+  popcli();
+}
+
+// Copy up to n unread records into dst, one CPU after another.
+// Returns the number of records copied.
+int
+traceread(struct traceent *dst, int n)
+{
+  struct tracering *r;
+  uint head, start, i, lost;
+  int got, first;
+
+  got = 0;
+  acquire(&readlock);
+  for(r = rings; r < &rings[NCPU] && got < n; r++){
+    head = r->head;
+    if(head - r->tail > NTRACE)
+      r->tail = head - NTRACE;
+    start = r->tail;
+    first = got;
+    for(i = start; i != head && got < n; i++)
+      dst[got++] = r->ent[i % NTRACE];
+    r->tail = i;
+
+    // The writer may have lapped us while we copied. Drop every
+    // record whose slot has been (or is being) reused since.
+    head = r->head + 1;
+    if(head - start > NTRACE){
+      lost = head - start - NTRACE;
+      if(lost > i - start)
+        lost = i - start;
+      memmove(&dst[first], &dst[first + lost],
+              (got - first - lost) * sizeof(*dst));
+      got -= lost;
+    }
+  }
+  release(&readlock);
+  return got;
+}
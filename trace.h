@@ -0,0 +1,15 @@
+// Kernel event trace records, as returned by the traceread system call.
+
+#define TR_SYSCALL    1   // system call entry; arg = syscall number
+#define TR_SCHED      2   // scheduler switched to pid
+#define TR_SIGPOST    3   // kill() posted a signal to pid; arg = signum
+#define TR_SIGDELIVER 4   // sig_handler_runner acted on a signal; arg = signum
+#define TR_KILLED     5   // SIGKILL_handler marked pid killed
+
+struct traceent {
+  uint64 tsc;     // Time-stamp counter when recorded
+  ushort cpu;     // CPU that recorded the event
+  ushort event;   // TR_*
+  int pid;        // Process the event is about
+  uint arg;       // Event-specific argument
+};
@@ -0,0 +1,1542 @@
+
+_tracedump:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+[TR_KILLED]     "killed",
+};
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 10             	sub    $0x10,%esp
+  static struct traceent buf[N];
+  struct traceent *e;
+  int n;
+
+  n = traceread(buf, N);
+  14:	68 00 08 00 00       	push   $0x800
+  19:	68 c0 0e 00 00       	push   $0xec0
+  1e:	e8 d0 05 00 00       	call   5f3 <traceread>
+  for(e = buf; e < buf + n; e++){
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  29:	8d 34 85 c0 0e 00 00 	lea    0xec0(,%eax,4),%esi
+  30:	81 fe c0 0e 00 00    	cmp    $0xec0,%esi
+  36:	76 54                	jbe    8c <main+0x8c>
+  38:	bb c0 0e 00 00       	mov    $0xec0,%ebx
+    printf(1, "%d %x %x %d %s %d\n", e->cpu, (uint)(e->tsc >> 32),
+  3d:	bf e8 0a 00 00       	mov    $0xae8,%edi
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+           (uint)e->tsc, e->pid,
+           e->event < sizeof(names)/sizeof(names[0]) && names[e->event] ?
+  48:	0f b7 53 0a          	movzwl 0xa(%ebx),%edx
+    printf(1, "%d %x %x %d %s %d\n", e->cpu, (uint)(e->tsc >> 32),
+  4c:	8b 4b 10             	mov    0x10(%ebx),%ecx
+  4f:	b8 e8 0a 00 00       	mov    $0xae8,%eax
+  54:	66 83 fa 05          	cmp    $0x5,%dx
+  58:	77 0c                	ja     66 <main+0x66>
+           e->event < sizeof(names)/sizeof(names[0]) && names[e->event] ?
+  5a:	8b 04 95 28 0b 00 00 	mov    0xb28(,%edx,4),%eax
+    printf(1, "%d %x %x %d %s %d\n", e->cpu, (uint)(e->tsc >> 32),
+  61:	85 c0                	test   %eax,%eax
+  63:	0f 44 c7             	cmove  %edi,%eax
+  66:	51                   	push   %ecx
+  for(e = buf; e < buf + n; e++){
+  67:	83 c3 14             	add    $0x14,%ebx
+    printf(1, "%d %x %x %d %s %d\n", e->cpu, (uint)(e->tsc >> 32),
+  6a:	50                   	push   %eax
+  6b:	0f b7 43 f4          	movzwl -0xc(%ebx),%eax
+  6f:	ff 73 f8             	push   -0x8(%ebx)
+  72:	ff 73 ec             	push   -0x14(%ebx)
+  75:	ff 73 f0             	push   -0x10(%ebx)
+  78:	50                   	push   %eax
+  79:	68 ea 0a 00 00       	push   $0xaea
+  7e:	6a 01                	push   $0x1
+  80:	e8 3b 07 00 00       	call   7c0 <printf>
+  for(e = buf; e < buf + n; e++){
+  85:	83 c4 20             	add    $0x20,%esp
+  88:	39 f3                	cmp    %esi,%ebx
+  8a:	72 bc                	jb     48 <main+0x48>
+           names[e->event] : "?", e->arg);
+  }
+  exit(0);
+  8c:	83 ec 0c             	sub    $0xc,%esp
+  8f:	6a 00                	push   $0x0
+  91:	e8 3b 03 00 00       	call   3d1 <exit>
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  a1:	31 c0                	xor    %eax,%eax
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	53                   	push   %ebx
+  a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  b7:	83 c0 01             	add    $0x1,%eax
+  ba:	84 d2                	test   %dl,%dl
+  bc:	75 f2                	jne    b0 <strcpy+0x10>
+    ;
+  return os;
+}
+  be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c1:	89 c8                	mov    %ecx,%eax
+  c3:	c9                   	leave
+  c4:	c3                   	ret
+  c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	53                   	push   %ebx
+  d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  da:	0f b6 02             	movzbl (%edx),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 17                	jne    f8 <strcmp+0x28>
+  e1:	eb 3a                	jmp    11d <strcmp+0x4d>
+  e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  e7:	90                   	nop
+  e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ec:	83 c2 01             	add    $0x1,%edx
+  ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  f2:	84 c0                	test   %al,%al
+  f4:	74 1a                	je     110 <strcmp+0x40>
+    p++, q++;
+  f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  f8:	0f b6 19             	movzbl (%ecx),%ebx
+  fb:	38 c3                	cmp    %al,%bl
+  fd:	74 e9                	je     e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  ff:	29 d8                	sub    %ebx,%eax
+}
+ 101:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 104:	c9                   	leave
+ 105:	c3                   	ret
+ 106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 110:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 114:	31 c0                	xor    %eax,%eax
+ 116:	29 d8                	sub    %ebx,%eax
+}
+ 118:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 11b:	c9                   	leave
+ 11c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 11d:	0f b6 19             	movzbl (%ecx),%ebx
+ 120:	31 c0                	xor    %eax,%eax
+ 122:	eb db                	jmp    ff <strcmp+0x2f>
+ 124:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 12f:	90                   	nop
+
+00000130 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 136:	80 3a 00             	cmpb   $0x0,(%edx)
+ 139:	74 15                	je     150 <strlen+0x20>
+ 13b:	31 c0                	xor    %eax,%eax
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+ 140:	83 c0 01             	add    $0x1,%eax
+ 143:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 147:	89 c1                	mov    %eax,%ecx
+ 149:	75 f5                	jne    140 <strlen+0x10>
+    ;
+  return n;
+}
+ 14b:	89 c8                	mov    %ecx,%eax
+ 14d:	5d                   	pop    %ebp
+ 14e:	c3                   	ret
+ 14f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 150:	31 c9                	xor    %ecx,%ecx
+}
+ 152:	5d                   	pop    %ebp
+ 153:	89 c8                	mov    %ecx,%eax
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000160 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 167:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 16a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16d:	89 d7                	mov    %edx,%edi
+ 16f:	fc                   	cld
+ 170:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 172:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 175:	89 d0                	mov    %edx,%eax
+ 177:	c9                   	leave
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 45 08             	mov    0x8(%ebp),%eax
+ 186:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 18a:	0f b6 10             	movzbl (%eax),%edx
+ 18d:	84 d2                	test   %dl,%dl
+ 18f:	75 12                	jne    1a3 <strchr+0x23>
+ 191:	eb 1d                	jmp    1b0 <strchr+0x30>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+ 198:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 19c:	83 c0 01             	add    $0x1,%eax
+ 19f:	84 d2                	test   %dl,%dl
+ 1a1:	74 0d                	je     1b0 <strchr+0x30>
+    if(*s == c)
+ 1a3:	38 d1                	cmp    %dl,%cl
+ 1a5:	75 f1                	jne    198 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1a7:	5d                   	pop    %ebp
+ 1a8:	c3                   	ret
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1b0:	31 c0                	xor    %eax,%eax
+}
+ 1b2:	5d                   	pop    %ebp
+ 1b3:	c3                   	ret
+ 1b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+
+000001c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	57                   	push   %edi
+ 1c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1c9:	31 db                	xor    %ebx,%ebx
+{
+ 1cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ce:	eb 27                	jmp    1f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1d0:	83 ec 04             	sub    $0x4,%esp
+ 1d3:	6a 01                	push   $0x1
+ 1d5:	56                   	push   %esi
+ 1d6:	6a 00                	push   $0x0
+ 1d8:	e8 42 02 00 00       	call   41f <read>
+    if(cc < 1)
+ 1dd:	83 c4 10             	add    $0x10,%esp
+ 1e0:	85 c0                	test   %eax,%eax
+ 1e2:	7e 1d                	jle    201 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1ef:	3c 0a                	cmp    $0xa,%al
+ 1f1:	74 10                	je     203 <gets+0x43>
+ 1f3:	3c 0d                	cmp    $0xd,%al
+ 1f5:	74 0c                	je     203 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1f7:	89 df                	mov    %ebx,%edi
+ 1f9:	83 c3 01             	add    $0x1,%ebx
+ 1fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1ff:	7c cf                	jl     1d0 <gets+0x10>
+ 201:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 20a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 20d:	5b                   	pop    %ebx
+ 20e:	5e                   	pop    %esi
+ 20f:	5f                   	pop    %edi
+ 210:	5d                   	pop    %ebp
+ 211:	c3                   	ret
+ 212:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	56                   	push   %esi
+ 224:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 225:	83 ec 08             	sub    $0x8,%esp
+ 228:	6a 00                	push   $0x0
+ 22a:	ff 75 08             	push   0x8(%ebp)
+ 22d:	e8 6f 02 00 00       	call   4a1 <open>
+  if(fd < 0)
+ 232:	83 c4 10             	add    $0x10,%esp
+ 235:	85 c0                	test   %eax,%eax
+ 237:	78 27                	js     260 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 239:	83 ec 08             	sub    $0x8,%esp
+ 23c:	ff 75 0c             	push   0xc(%ebp)
+ 23f:	89 c3                	mov    %eax,%ebx
+ 241:	50                   	push   %eax
+ 242:	e8 a8 02 00 00       	call   4ef <fstat>
+  close(fd);
+ 247:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 24a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 24c:	e8 02 02 00 00       	call   453 <close>
+  return r;
+ 251:	83 c4 10             	add    $0x10,%esp
+}
+ 254:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 257:	89 f0                	mov    %esi,%eax
+ 259:	5b                   	pop    %ebx
+ 25a:	5e                   	pop    %esi
+ 25b:	5d                   	pop    %ebp
+ 25c:	c3                   	ret
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 260:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 265:	eb ed                	jmp    254 <stat+0x34>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+
+00000270 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	53                   	push   %ebx
+ 274:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 277:	0f be 02             	movsbl (%edx),%eax
+ 27a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 27d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 280:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 285:	77 1e                	ja     2a5 <atoi+0x35>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 290:	83 c2 01             	add    $0x1,%edx
+ 293:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 296:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 29a:	0f be 02             	movsbl (%edx),%eax
+ 29d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2a0:	80 fb 09             	cmp    $0x9,%bl
+ 2a3:	76 eb                	jbe    290 <atoi+0x20>
+  return n;
+}
+ 2a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a8:	89 c8                	mov    %ecx,%eax
+ 2aa:	c9                   	leave
+ 2ab:	c3                   	ret
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	56                   	push   %esi
+ 2b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2be:	85 c0                	test   %eax,%eax
+ 2c0:	7e 13                	jle    2d5 <memmove+0x25>
+ 2c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2c4:	89 d7                	mov    %edx,%edi
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2d1:	39 f8                	cmp    %edi,%eax
+ 2d3:	75 fb                	jne    2d0 <memmove+0x20>
+  return vdst;
+}
+ 2d5:	5e                   	pop    %esi
+ 2d6:	89 d0                	mov    %edx,%eax
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 2e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 2e9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 2f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 2f3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 2f6:	50                   	push   %eax
+ 2f7:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 2fa:	50                   	push   %eax
+ 2fb:	6a 00                	push   $0x0
+ 2fd:	e8 8d 03 00 00       	call   68f <setitimer>
+ 302:	83 c4 10             	add    $0x10,%esp
+ 305:	89 c2                	mov    %eax,%edx
+ 307:	31 c0                	xor    %eax,%eax
+ 309:	85 d2                	test   %edx,%edx
+ 30b:	78 03                	js     310 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 30d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 310:	c9                   	leave
+ 311:	c3                   	ret
+ 312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 320:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 330:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 349:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 34d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 350:	75 5e                	jne    3b0 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 352:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 358:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 35a:	89 d3                	mov    %edx,%ebx
+ 35c:	89 c1                	mov    %eax,%ecx
+ 35e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 364:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 36a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 36d:	31 d2                	xor    %edx,%edx
+ 36f:	89 d8                	mov    %ebx,%eax
+ 371:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 374:	f7 f6                	div    %esi
+ 376:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 378:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 37b:	f7 f6                	div    %esi
+ 37d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 37f:	89 da                	mov    %ebx,%edx
+ 381:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 386:	f7 f3                	div    %ebx
+ 388:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 38a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 38f:	89 d3                	mov    %edx,%ebx
+ 391:	f7 e1                	mul    %ecx
+ 393:	f7 f6                	div    %esi
+ 395:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 39b:	01 c3                	add    %eax,%ebx
+  return 0;
+ 39d:	31 c0                	xor    %eax,%eax
+ 39f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 3a2:	83 c4 0c             	add    $0xc,%esp
+ 3a5:	5b                   	pop    %ebx
+ 3a6:	5e                   	pop    %esi
+ 3a7:	5f                   	pop    %edi
+ 3a8:	5d                   	pop    %ebp
+ 3a9:	c3                   	ret
+ 3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 3b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3b5:	eb eb                	jmp    3a2 <clock_gettime+0x62>
+
+000003b7 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3b7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3bc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3c3:	74 09                	je     3ce <fork+0x17>
+ 3c5:	89 e1                	mov    %esp,%ecx
+ 3c7:	ba d0 03 00 00       	mov    $0x3d0,%edx
+ 3cc:	0f 34                	sysenter
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <exit>:
+SYSCALL(exit)
+ 3d1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3d6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3dd:	74 09                	je     3e8 <exit+0x17>
+ 3df:	89 e1                	mov    %esp,%ecx
+ 3e1:	ba ea 03 00 00       	mov    $0x3ea,%edx
+ 3e6:	0f 34                	sysenter
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <wait>:
+SYSCALL(wait)
+ 3eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3f0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3f7:	74 09                	je     402 <wait+0x17>
+ 3f9:	89 e1                	mov    %esp,%ecx
+ 3fb:	ba 04 04 00 00       	mov    $0x404,%edx
+ 400:	0f 34                	sysenter
+ 402:	cd 40                	int    $0x40
+ 404:	c3                   	ret
+
+00000405 <pipe>:
+SYSCALL(pipe)
+ 405:	b8 04 00 00 00       	mov    $0x4,%eax
+ 40a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 411:	74 09                	je     41c <pipe+0x17>
+ 413:	89 e1                	mov    %esp,%ecx
+ 415:	ba 1e 04 00 00       	mov    $0x41e,%edx
+ 41a:	0f 34                	sysenter
+ 41c:	cd 40                	int    $0x40
+ 41e:	c3                   	ret
+
+0000041f <read>:
+SYSCALL(read)
+ 41f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 424:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 42b:	74 09                	je     436 <read+0x17>
+ 42d:	89 e1                	mov    %esp,%ecx
+ 42f:	ba 38 04 00 00       	mov    $0x438,%edx
+ 434:	0f 34                	sysenter
+ 436:	cd 40                	int    $0x40
+ 438:	c3                   	ret
+
+00000439 <write>:
+SYSCALL(write)
+ 439:	b8 10 00 00 00       	mov    $0x10,%eax
+ 43e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 445:	74 09                	je     450 <write+0x17>
+ 447:	89 e1                	mov    %esp,%ecx
+ 449:	ba 52 04 00 00       	mov    $0x452,%edx
+ 44e:	0f 34                	sysenter
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <close>:
+SYSCALL(close)
+ 453:	b8 15 00 00 00       	mov    $0x15,%eax
+ 458:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 45f:	74 09                	je     46a <close+0x17>
+ 461:	89 e1                	mov    %esp,%ecx
+ 463:	ba 6c 04 00 00       	mov    $0x46c,%edx
+ 468:	0f 34                	sysenter
+ 46a:	cd 40                	int    $0x40
+ 46c:	c3                   	ret
+
+0000046d <kill>:
+SYSCALL(kill)
+ 46d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 472:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 479:	74 09                	je     484 <kill+0x17>
+ 47b:	89 e1                	mov    %esp,%ecx
+ 47d:	ba 86 04 00 00       	mov    $0x486,%edx
+ 482:	0f 34                	sysenter
+ 484:	cd 40                	int    $0x40
+ 486:	c3                   	ret
+
+00000487 <exec>:
+SYSCALL(exec)
+ 487:	b8 07 00 00 00       	mov    $0x7,%eax
+ 48c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 493:	74 09                	je     49e <exec+0x17>
+ 495:	89 e1                	mov    %esp,%ecx
+ 497:	ba a0 04 00 00       	mov    $0x4a0,%edx
+ 49c:	0f 34                	sysenter
+ 49e:	cd 40                	int    $0x40
+ 4a0:	c3                   	ret
+
+000004a1 <open>:
+SYSCALL(open)
+ 4a1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4a6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4ad:	74 09                	je     4b8 <open+0x17>
+ 4af:	89 e1                	mov    %esp,%ecx
+ 4b1:	ba ba 04 00 00       	mov    $0x4ba,%edx
+ 4b6:	0f 34                	sysenter
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <mknod>:
+SYSCALL(mknod)
+ 4bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4c0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4c7:	74 09                	je     4d2 <mknod+0x17>
+ 4c9:	89 e1                	mov    %esp,%ecx
+ 4cb:	ba d4 04 00 00       	mov    $0x4d4,%edx
+ 4d0:	0f 34                	sysenter
+ 4d2:	cd 40                	int    $0x40
+ 4d4:	c3                   	ret
+
+000004d5 <unlink>:
+SYSCALL(unlink)
+ 4d5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4da:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4e1:	74 09                	je     4ec <unlink+0x17>
+ 4e3:	89 e1                	mov    %esp,%ecx
+ 4e5:	ba ee 04 00 00       	mov    $0x4ee,%edx
+ 4ea:	0f 34                	sysenter
+ 4ec:	cd 40                	int    $0x40
+ 4ee:	c3                   	ret
+
+000004ef <fstat>:
+SYSCALL(fstat)
+ 4ef:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4f4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4fb:	74 09                	je     506 <fstat+0x17>
+ 4fd:	89 e1                	mov    %esp,%ecx
+ 4ff:	ba 08 05 00 00       	mov    $0x508,%edx
+ 504:	0f 34                	sysenter
+ 506:	cd 40                	int    $0x40
+ 508:	c3                   	ret
+
+00000509 <link>:
+SYSCALL(link)
+ 509:	b8 13 00 00 00       	mov    $0x13,%eax
+ 50e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 515:	74 09                	je     520 <link+0x17>
+ 517:	89 e1                	mov    %esp,%ecx
+ 519:	ba 22 05 00 00       	mov    $0x522,%edx
+ 51e:	0f 34                	sysenter
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <mkdir>:
+SYSCALL(mkdir)
+ 523:	b8 14 00 00 00       	mov    $0x14,%eax
+ 528:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 52f:	74 09                	je     53a <mkdir+0x17>
+ 531:	89 e1                	mov    %esp,%ecx
+ 533:	ba 3c 05 00 00       	mov    $0x53c,%edx
+ 538:	0f 34                	sysenter
+ 53a:	cd 40                	int    $0x40
+ 53c:	c3                   	ret
+
+0000053d <chdir>:
+SYSCALL(chdir)
+ 53d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 542:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 549:	74 09                	je     554 <chdir+0x17>
+ 54b:	89 e1                	mov    %esp,%ecx
+ 54d:	ba 56 05 00 00       	mov    $0x556,%edx
+ 552:	0f 34                	sysenter
+ 554:	cd 40                	int    $0x40
+ 556:	c3                   	ret
+
+00000557 <dup>:
+SYSCALL(dup)
+ 557:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 55c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 563:	74 09                	je     56e <dup+0x17>
+ 565:	89 e1                	mov    %esp,%ecx
+ 567:	ba 70 05 00 00       	mov    $0x570,%edx
+ 56c:	0f 34                	sysenter
+ 56e:	cd 40                	int    $0x40
+ 570:	c3                   	ret
+
+00000571 <sbrk>:
+SYSCALL(sbrk)
+ 571:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 576:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 57d:	74 09                	je     588 <sbrk+0x17>
+ 57f:	89 e1                	mov    %esp,%ecx
+ 581:	ba 8a 05 00 00       	mov    $0x58a,%edx
+ 586:	0f 34                	sysenter
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <sleep>:
+SYSCALL(sleep)
+ 58b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 590:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 597:	74 09                	je     5a2 <sleep+0x17>
+ 599:	89 e1                	mov    %esp,%ecx
+ 59b:	ba a4 05 00 00       	mov    $0x5a4,%edx
+ 5a0:	0f 34                	sysenter
+ 5a2:	cd 40                	int    $0x40
+ 5a4:	c3                   	ret
+
+000005a5 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 5a5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5aa:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5b1:	74 09                	je     5bc <sigprocmask+0x17>
+ 5b3:	89 e1                	mov    %esp,%ecx
+ 5b5:	ba be 05 00 00       	mov    $0x5be,%edx
+ 5ba:	0f 34                	sysenter
+ 5bc:	cd 40                	int    $0x40
+ 5be:	c3                   	ret
+
+000005bf <sigaction>:
+SYSCALL(sigaction)
+ 5bf:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5c4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5cb:	74 09                	je     5d6 <sigaction+0x17>
+ 5cd:	89 e1                	mov    %esp,%ecx
+ 5cf:	ba d8 05 00 00       	mov    $0x5d8,%edx
+ 5d4:	0f 34                	sysenter
+ 5d6:	cd 40                	int    $0x40
+ 5d8:	c3                   	ret
+
+000005d9 <sigret>:
+SYSCALL(sigret)
+ 5d9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5de:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5e5:	74 09                	je     5f0 <sigret+0x17>
+ 5e7:	89 e1                	mov    %esp,%ecx
+ 5e9:	ba f2 05 00 00       	mov    $0x5f2,%edx
+ 5ee:	0f 34                	sysenter
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <traceread>:
+SYSCALL(traceread)
+ 5f3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5f8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5ff:	74 09                	je     60a <traceread+0x17>
+ 601:	89 e1                	mov    %esp,%ecx
+ 603:	ba 0c 06 00 00       	mov    $0x60c,%edx
+ 608:	0f 34                	sysenter
+ 60a:	cd 40                	int    $0x40
+ 60c:	c3                   	ret
+
+0000060d <sigqueue>:
+SYSCALL(sigqueue)
+ 60d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 612:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 619:	74 09                	je     624 <sigqueue+0x17>
+ 61b:	89 e1                	mov    %esp,%ecx
+ 61d:	ba 26 06 00 00       	mov    $0x626,%edx
+ 622:	0f 34                	sysenter
+ 624:	cd 40                	int    $0x40
+ 626:	c3                   	ret
+
+00000627 <signalfd>:
+SYSCALL(signalfd)
+ 627:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 62c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 633:	74 09                	je     63e <signalfd+0x17>
+ 635:	89 e1                	mov    %esp,%ecx
+ 637:	ba 40 06 00 00       	mov    $0x640,%edx
+ 63c:	0f 34                	sysenter
+ 63e:	cd 40                	int    $0x40
+ 640:	c3                   	ret
+
+00000641 <sigwait>:
+SYSCALL(sigwait)
+ 641:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 646:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 64d:	74 09                	je     658 <sigwait+0x17>
+ 64f:	89 e1                	mov    %esp,%ecx
+ 651:	ba 5a 06 00 00       	mov    $0x65a,%edx
+ 656:	0f 34                	sysenter
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <sigsuspend>:
+SYSCALL(sigsuspend)
+ 65b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 660:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 667:	74 09                	je     672 <sigsuspend+0x17>
+ 669:	89 e1                	mov    %esp,%ecx
+ 66b:	ba 74 06 00 00       	mov    $0x674,%edx
+ 670:	0f 34                	sysenter
+ 672:	cd 40                	int    $0x40
+ 674:	c3                   	ret
+
+00000675 <waitpid>:
+SYSCALL(waitpid)
+ 675:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 67a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 681:	74 09                	je     68c <waitpid+0x17>
+ 683:	89 e1                	mov    %esp,%ecx
+ 685:	ba 8e 06 00 00       	mov    $0x68e,%edx
+ 68a:	0f 34                	sysenter
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <setitimer>:
+SYSCALL(setitimer)
+ 68f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 694:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 69b:	74 09                	je     6a6 <setitimer+0x17>
+ 69d:	89 e1                	mov    %esp,%ecx
+ 69f:	ba a8 06 00 00       	mov    $0x6a8,%edx
+ 6a4:	0f 34                	sysenter
+ 6a6:	cd 40                	int    $0x40
+ 6a8:	c3                   	ret
+
+000006a9 <nanosleep>:
+SYSCALL(nanosleep)
+ 6a9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6ae:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6b5:	74 09                	je     6c0 <nanosleep+0x17>
+ 6b7:	89 e1                	mov    %esp,%ecx
+ 6b9:	ba c2 06 00 00       	mov    $0x6c2,%edx
+ 6be:	0f 34                	sysenter
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <mmap>:
+SYSCALL(mmap)
+ 6c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6c8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6cf:	74 09                	je     6da <mmap+0x17>
+ 6d1:	89 e1                	mov    %esp,%ecx
+ 6d3:	ba dc 06 00 00       	mov    $0x6dc,%edx
+ 6d8:	0f 34                	sysenter
+ 6da:	cd 40                	int    $0x40
+ 6dc:	c3                   	ret
+
+000006dd <munmap>:
+SYSCALL(munmap)
+ 6dd:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6e2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6e9:	74 09                	je     6f4 <munmap+0x17>
+ 6eb:	89 e1                	mov    %esp,%ecx
+ 6ed:	ba f6 06 00 00       	mov    $0x6f6,%edx
+ 6f2:	0f 34                	sysenter
+ 6f4:	cd 40                	int    $0x40
+ 6f6:	c3                   	ret
+
+000006f7 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 6f7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6fc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 703:	74 09                	je     70e <getpid_syscall+0x17>
+ 705:	89 e1                	mov    %esp,%ecx
+ 707:	ba 10 07 00 00       	mov    $0x710,%edx
+ 70c:	0f 34                	sysenter
+ 70e:	cd 40                	int    $0x40
+ 710:	c3                   	ret
+
+00000711 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 711:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 716:	cd 40                	int    $0x40
+ 718:	c3                   	ret
+ 719:	66 90                	xchg   %ax,%ax
+ 71b:	66 90                	xchg   %ax,%ax
+ 71d:	66 90                	xchg   %ax,%ax
+ 71f:	90                   	nop
+
+00000720 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 728:	89 d1                	mov    %edx,%ecx
+{
+ 72a:	83 ec 3c             	sub    $0x3c,%esp
+ 72d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 730:	85 d2                	test   %edx,%edx
+ 732:	0f 89 80 00 00 00    	jns    7b8 <printint+0x98>
+ 738:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 73c:	74 7a                	je     7b8 <printint+0x98>
+    x = -xx;
+ 73e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 740:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 745:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 748:	31 f6                	xor    %esi,%esi
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 750:	89 c8                	mov    %ecx,%eax
+ 752:	31 d2                	xor    %edx,%edx
+ 754:	89 f7                	mov    %esi,%edi
+ 756:	f7 f3                	div    %ebx
+ 758:	8d 76 01             	lea    0x1(%esi),%esi
+ 75b:	0f b6 92 a0 0b 00 00 	movzbl 0xba0(%edx),%edx
+ 762:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 766:	89 ca                	mov    %ecx,%edx
+ 768:	89 c1                	mov    %eax,%ecx
+ 76a:	39 da                	cmp    %ebx,%edx
+ 76c:	73 e2                	jae    750 <printint+0x30>
+  if(neg)
+ 76e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 771:	85 c0                	test   %eax,%eax
+ 773:	74 07                	je     77c <printint+0x5c>
+    buf[i++] = '-';
+ 775:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 77a:	89 f7                	mov    %esi,%edi
+ 77c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 77f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 782:	01 df                	add    %ebx,%edi
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 788:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 791:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 794:	6a 01                	push   $0x1
+ 796:	50                   	push   %eax
+ 797:	56                   	push   %esi
+ 798:	e8 9c fc ff ff       	call   439 <write>
+  while(--i >= 0)
+ 79d:	89 f8                	mov    %edi,%eax
+ 79f:	83 c4 10             	add    $0x10,%esp
+ 7a2:	83 ef 01             	sub    $0x1,%edi
+ 7a5:	39 d8                	cmp    %ebx,%eax
+ 7a7:	75 df                	jne    788 <printint+0x68>
+}
+ 7a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ac:	5b                   	pop    %ebx
+ 7ad:	5e                   	pop    %esi
+ 7ae:	5f                   	pop    %edi
+ 7af:	5d                   	pop    %ebp
+ 7b0:	c3                   	ret
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7b8:	31 c0                	xor    %eax,%eax
+ 7ba:	eb 89                	jmp    745 <printint+0x25>
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	53                   	push   %ebx
+ 7c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7d2:	83 c6 01             	add    $0x1,%esi
+ 7d5:	84 db                	test   %bl,%bl
+ 7d7:	74 67                	je     840 <printf+0x80>
+ 7d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7dc:	31 d2                	xor    %edx,%edx
+ 7de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7e1:	eb 34                	jmp    817 <printf+0x57>
+ 7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7e7:	90                   	nop
+ 7e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7f0:	83 f8 25             	cmp    $0x25,%eax
+ 7f3:	74 18                	je     80d <printf+0x4d>
+  write(fd, &c, 1);
+ 7f5:	83 ec 04             	sub    $0x4,%esp
+ 7f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7fe:	6a 01                	push   $0x1
+ 800:	50                   	push   %eax
+ 801:	57                   	push   %edi
+ 802:	e8 32 fc ff ff       	call   439 <write>
+ 807:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 80a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 80d:	0f b6 1e             	movzbl (%esi),%ebx
+ 810:	83 c6 01             	add    $0x1,%esi
+ 813:	84 db                	test   %bl,%bl
+ 815:	74 29                	je     840 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 817:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 81a:	85 d2                	test   %edx,%edx
+ 81c:	74 ca                	je     7e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 81e:	83 fa 25             	cmp    $0x25,%edx
+ 821:	75 ea                	jne    80d <printf+0x4d>
+      if(c == 'd'){
+ 823:	83 f8 25             	cmp    $0x25,%eax
+ 826:	0f 84 24 01 00 00    	je     950 <printf+0x190>
+ 82c:	83 e8 63             	sub    $0x63,%eax
+ 82f:	83 f8 15             	cmp    $0x15,%eax
+ 832:	77 1c                	ja     850 <printf+0x90>
+ 834:	ff 24 85 48 0b 00 00 	jmp    *0xb48(,%eax,4)
+ 83b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 843:	5b                   	pop    %ebx
+ 844:	5e                   	pop    %esi
+ 845:	5f                   	pop    %edi
+ 846:	5d                   	pop    %ebp
+ 847:	c3                   	ret
+ 848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 856:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 85a:	6a 01                	push   $0x1
+ 85c:	52                   	push   %edx
+ 85d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 860:	57                   	push   %edi
+ 861:	e8 d3 fb ff ff       	call   439 <write>
+ 866:	83 c4 0c             	add    $0xc,%esp
+ 869:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 86c:	6a 01                	push   $0x1
+ 86e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 871:	52                   	push   %edx
+ 872:	57                   	push   %edi
+ 873:	e8 c1 fb ff ff       	call   439 <write>
+        putc(fd, c);
+ 878:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 87b:	31 d2                	xor    %edx,%edx
+ 87d:	eb 8e                	jmp    80d <printf+0x4d>
+ 87f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 880:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 88b:	8b 13                	mov    (%ebx),%edx
+ 88d:	6a 00                	push   $0x0
+ 88f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 891:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 894:	e8 87 fe ff ff       	call   720 <printint>
+        ap++;
+ 899:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 89c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 89f:	31 d2                	xor    %edx,%edx
+ 8a1:	e9 67 ff ff ff       	jmp    80d <printf+0x4d>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8b5:	83 c0 04             	add    $0x4,%eax
+ 8b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8bb:	85 db                	test   %ebx,%ebx
+ 8bd:	0f 84 9d 00 00 00    	je     960 <printf+0x1a0>
+        while(*s != 0){
+ 8c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8c8:	84 c0                	test   %al,%al
+ 8ca:	0f 84 3d ff ff ff    	je     80d <printf+0x4d>
+ 8d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8d6:	89 de                	mov    %ebx,%esi
+ 8d8:	89 d3                	mov    %edx,%ebx
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	53                   	push   %ebx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 47 fb ff ff       	call   439 <write>
+        while(*s != 0){
+ 8f2:	0f b6 06             	movzbl (%esi),%eax
+ 8f5:	83 c4 10             	add    $0x10,%esp
+ 8f8:	84 c0                	test   %al,%al
+ 8fa:	75 e4                	jne    8e0 <printf+0x120>
+      state = 0;
+ 8fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ff:	31 d2                	xor    %edx,%edx
+ 901:	e9 07 ff ff ff       	jmp    80d <printf+0x4d>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 910:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 91b:	8b 13                	mov    (%ebx),%edx
+ 91d:	6a 01                	push   $0x1
+ 91f:	e9 6b ff ff ff       	jmp    88f <printf+0xcf>
+ 924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 928:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 92b:	83 ec 04             	sub    $0x4,%esp
+ 92e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 931:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 933:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 936:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 939:	6a 01                	push   $0x1
+ 93b:	52                   	push   %edx
+ 93c:	57                   	push   %edi
+ 93d:	e8 f7 fa ff ff       	call   439 <write>
+        ap++;
+ 942:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 945:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 948:	31 d2                	xor    %edx,%edx
+ 94a:	e9 be fe ff ff       	jmp    80d <printf+0x4d>
+ 94f:	90                   	nop
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 956:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 959:	6a 01                	push   $0x1
+ 95b:	e9 11 ff ff ff       	jmp    871 <printf+0xb1>
+ 960:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 965:	bb 40 0b 00 00       	mov    $0xb40,%ebx
+ 96a:	e9 61 ff ff ff       	jmp    8d0 <printf+0x110>
+ 96f:	90                   	nop
+
+00000970 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 970:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 971:	a1 c0 ae 00 00       	mov    0xaec0,%eax
+{
+ 976:	89 e5                	mov    %esp,%ebp
+ 978:	57                   	push   %edi
+ 979:	56                   	push   %esi
+ 97a:	53                   	push   %ebx
+ 97b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 97e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 988:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 98a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 98c:	39 ca                	cmp    %ecx,%edx
+ 98e:	73 30                	jae    9c0 <free+0x50>
+ 990:	39 c1                	cmp    %eax,%ecx
+ 992:	72 04                	jb     998 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 994:	39 c2                	cmp    %eax,%edx
+ 996:	72 f0                	jb     988 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 998:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 99b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 99e:	39 f8                	cmp    %edi,%eax
+ 9a0:	74 2e                	je     9d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9a5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9ab:	39 f1                	cmp    %esi,%ecx
+ 9ad:	74 38                	je     9e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9b1:	5b                   	pop    %ebx
+  freep = p;
+ 9b2:	89 15 c0 ae 00 00    	mov    %edx,0xaec0
+}
+ 9b8:	5e                   	pop    %esi
+ 9b9:	5f                   	pop    %edi
+ 9ba:	5d                   	pop    %ebp
+ 9bb:	c3                   	ret
+ 9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9c0:	39 c1                	cmp    %eax,%ecx
+ 9c2:	72 d0                	jb     994 <free+0x24>
+ 9c4:	eb c2                	jmp    988 <free+0x18>
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9d0:	03 70 04             	add    0x4(%eax),%esi
+ 9d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9d6:	8b 02                	mov    (%edx),%eax
+ 9d8:	8b 00                	mov    (%eax),%eax
+ 9da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9e3:	39 f1                	cmp    %esi,%ecx
+ 9e5:	75 c8                	jne    9af <free+0x3f>
+    p->s.size += bp->s.size;
+ 9e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9ea:	89 15 c0 ae 00 00    	mov    %edx,0xaec0
+    p->s.size += bp->s.size;
+ 9f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9f8:	5b                   	pop    %ebx
+ 9f9:	5e                   	pop    %esi
+ 9fa:	5f                   	pop    %edi
+ 9fb:	5d                   	pop    %ebp
+ 9fc:	c3                   	ret
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	57                   	push   %edi
+ a04:	56                   	push   %esi
+ a05:	53                   	push   %ebx
+ a06:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a0c:	8b 15 c0 ae 00 00    	mov    0xaec0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a12:	8d 78 07             	lea    0x7(%eax),%edi
+ a15:	c1 ef 03             	shr    $0x3,%edi
+ a18:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a1b:	85 d2                	test   %edx,%edx
+ a1d:	0f 84 8d 00 00 00    	je     ab0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a23:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a25:	8b 48 04             	mov    0x4(%eax),%ecx
+ a28:	39 f9                	cmp    %edi,%ecx
+ a2a:	73 64                	jae    a90 <malloc+0x90>
+  if(nu < 4096)
+ a2c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a31:	39 df                	cmp    %ebx,%edi
+ a33:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a36:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a3d:	eb 0a                	jmp    a49 <malloc+0x49>
+ a3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a40:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a42:	8b 48 04             	mov    0x4(%eax),%ecx
+ a45:	39 f9                	cmp    %edi,%ecx
+ a47:	73 47                	jae    a90 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a49:	89 c2                	mov    %eax,%edx
+ a4b:	39 05 c0 ae 00 00    	cmp    %eax,0xaec0
+ a51:	75 ed                	jne    a40 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a53:	83 ec 0c             	sub    $0xc,%esp
+ a56:	56                   	push   %esi
+ a57:	e8 15 fb ff ff       	call   571 <sbrk>
+  if(p == (char*)-1)
+ a5c:	83 c4 10             	add    $0x10,%esp
+ a5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a62:	74 1c                	je     a80 <malloc+0x80>
+  hp->s.size = nu;
+ a64:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a67:	83 ec 0c             	sub    $0xc,%esp
+ a6a:	83 c0 08             	add    $0x8,%eax
+ a6d:	50                   	push   %eax
+ a6e:	e8 fd fe ff ff       	call   970 <free>
+  return freep;
+ a73:	8b 15 c0 ae 00 00    	mov    0xaec0,%edx
+      if((p = morecore(nunits)) == 0)
+ a79:	83 c4 10             	add    $0x10,%esp
+ a7c:	85 d2                	test   %edx,%edx
+ a7e:	75 c0                	jne    a40 <malloc+0x40>
+        return 0;
+  }
+}
+ a80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a83:	31 c0                	xor    %eax,%eax
+}
+ a85:	5b                   	pop    %ebx
+ a86:	5e                   	pop    %esi
+ a87:	5f                   	pop    %edi
+ a88:	5d                   	pop    %ebp
+ a89:	c3                   	ret
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a90:	39 cf                	cmp    %ecx,%edi
+ a92:	74 4c                	je     ae0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a94:	29 f9                	sub    %edi,%ecx
+ a96:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a99:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a9c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a9f:	89 15 c0 ae 00 00    	mov    %edx,0xaec0
+}
+ aa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ aa8:	83 c0 08             	add    $0x8,%eax
+}
+ aab:	5b                   	pop    %ebx
+ aac:	5e                   	pop    %esi
+ aad:	5f                   	pop    %edi
+ aae:	5d                   	pop    %ebp
+ aaf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ab0:	c7 05 c0 ae 00 00 c4 	movl   $0xaec4,0xaec0
+ ab7:	ae 00 00 
+    base.s.size = 0;
+ aba:	b8 c4 ae 00 00       	mov    $0xaec4,%eax
+    base.s.ptr = freep = prevp = &base;
+ abf:	c7 05 c4 ae 00 00 c4 	movl   $0xaec4,0xaec4
+ ac6:	ae 00 00 
+    base.s.size = 0;
+ ac9:	c7 05 c8 ae 00 00 00 	movl   $0x0,0xaec8
+ ad0:	00 00 00 
+    if(p->s.size >= nunits){
+ ad3:	e9 54 ff ff ff       	jmp    a2c <malloc+0x2c>
+ ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ae0:	8b 08                	mov    (%eax),%ecx
+ ae2:	89 0a                	mov    %ecx,(%edx)
+ ae4:	eb b9                	jmp    a9f <malloc+0x9f>
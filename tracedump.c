@@ -0,0 +1,37 @@
+// Print the kernel event trace records recorded since the last read.
+// One line per record: cpu tsc-high tsc-low pid event arg
+// Takes one snapshot up front, since printing itself makes system
+// calls that get traced.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "trace.h"
+
+#define N (NCPU*NTRACE)
+
+static char *names[] = {
+[TR_SYSCALL]    "syscall",
+[TR_SCHED]      "sched",
+[TR_SIGPOST]    "sigpost",
+[TR_SIGDELIVER] "sigdeliver",
+[TR_KILLED]     "killed",
+};
+
+int
+main(int argc, char *argv[])
+{
+  static struct traceent buf[N];
+  struct traceent *e;
+  int n;
+
+  n = traceread(buf, N);
+  for(e = buf; e < buf + n; e++){
+    printf(1, "%d %x %x %d %s %d\n", e->cpu, (uint)(e->tsc >> 32),
+           (uint)e->tsc, e->pid,
+           e->event < sizeof(names)/sizeof(names[0]) && names[e->event] ?
+           names[e->event] : "?", e->arg);
+  }
+  exit(0);
+}
@@ -7,10 +7,13 @@
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "vdso.h"
+#include "syscall.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
+extern void sysenter_entry(void);  // in trapasm.S
 struct spinlock tickslock;
 uint ticks;
 
@@ -32,28 +35,51 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
-//PAGEBREAK: 41
+// Point this CPU's SYSENTER MSRs at sysenter_entry, if it has them.
+// The kernel stack pointer is per process; switchuvm() loads it.
 void
+sysenterinit(void)
+{
+  if(!(cpufeatures() & CPUID_SEP))
+    return;
+  wrmsr(MSR_SYSENTER_CS, SEG_KCODE<<3);
+  wrmsr(MSR_SYSENTER_EIP, (uint)sysenter_entry);
+  vdso->sysenter = 1;
+}
+
+//PAGEBREAK: 41
+// Returns non-zero if trapret must run sig_handler_runner
+// before going back to user space (see trapasm.S).
+uint
 trap(struct trapframe *tf)
 {
+  int n;
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
-      exit();
+      exit(-1);
     myproc()->tf = tf;
     syscall();
     if(myproc()->killed)
-      exit();
-    return;
+      exit(-1);
+    return sig_pending(tf);
   }
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
+    // The one-shot timer also fires early for hrtimerset() deadlines.
+    for(n = lapictick(); n > 0; n--){
+      if(cpuid() == 0){
+        acquire(&tickslock);
+        ticks++;
+        vdso->ticks = ticks;
+        release(&tickslock);
+      }
+      timertick();
+      if((tf->cs&3) == DPL_USER)
+        itimertick();
     }
+    hrtick();
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -78,6 +104,16 @@ trap(struct trapframe *tf)
     lapiceoi();
     break;
 
+  case T_PGFLT:
+    // A heap page not yet allocated or a page shared by
+    // copy-on-write fork, touched by user code. System calls fill
+    // in the user memory they use first (see pagein, copyout), so
+    // a fault in the kernel is still a bug.
+    if(myproc() && (tf->cs&3) == DPL_USER &&
+       pagefault(myproc(), rcr2(), tf->err & FEC_WR) == 0)
+      break;
+    // fall through
+
   //PAGEBREAK: 13
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
@@ -98,7 +134,7 @@ trap(struct trapframe *tf)
   // (If it is still executing in the kernel, let it keep running
   // until it gets to the regular system call return.)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
-    exit();
+    exit(-1);
 
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
@@ -108,5 +144,20 @@ trap(struct trapframe *tf)
 
   // Check if the process has been killed since we yielded
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
-    exit();
+    exit(-1);
+
+  return sig_pending(tf);
+}
+
+// System call entered through SYSENTER; sysenter_entry built the
+// same frame as alltraps. Returns 0 if the call may return with
+// SYSEXIT, which restores %eip and %esp but clobbers %ecx and %edx,
+// or non-zero if it must return through trapret.
+uint
+sysenter_trap(struct trapframe *tf)
+{
+  int num = tf->eax;
+
+  // sigret restores every register of the interrupted code.
+  return trap(tf) || num == SYS_sigret;
 }
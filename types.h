@@ -1,6 +1,7 @@
 typedef unsigned int   uint;
 typedef unsigned short ushort;
 typedef unsigned char  uchar;
+typedef unsigned long long uint64;
 typedef uint pde_t;
 
 #define null 0
@@ -8,12 +9,45 @@ typedef uint pde_t;
 #define SIG_DFL 0 /*default signal handling*/
 #define SIG_IGN 1 /*ignore  signal*/
 #define SIGKILL 9
+#define SIGUSR1 10
+#define SIGUSR2 12
 #define SIGSTOP 17
 #define SIGCONT 19
+#define SIGALRM 14 /*ITIMER_REAL expired*/
+#define SIGCHLD 20 /*child exited; ignored by default*/
+#define SIGVTALRM 26 /*ITIMER_VIRTUAL expired*/
 /**********************************************/
 
 
 struct sigaction{
   void  (*sa_handler)(int);
   uint sigmask;
-};
\ No newline at end of file
+};
+
+// Passed as the second argument to a signal handler:
+//   void handler(int signum, struct siginfo *info)
+struct siginfo{
+  int si_signo;
+  int si_pid;   // sender, for signals sent with sigqueue()
+  int si_value; // sigqueue() payload, 0 for kill()
+};
+
+// setitimer() timers. Times are in clock ticks, like sleep().
+#define ITIMER_REAL    0 /*wall-clock time; SIGALRM*/
+#define ITIMER_VIRTUAL 1 /*user-mode CPU time; SIGVTALRM*/
+
+struct itimerval{
+  uint it_interval; // reload value after expiry, 0 for one-shot
+  uint it_value;    // ticks until expiry, 0 if disarmed
+};
+
+// clock_gettime() clocks.
+#define CLOCK_MONOTONIC 1 /*time since boot, from the TSC*/
+
+struct timespec{
+  uint tv_sec;
+  uint tv_nsec;
+};
+
+// waitpid() options.
+#define WNOHANG 1 /*return 0 instead of blocking*/
@@ -3,6 +3,9 @@
 #include "fcntl.h"
 #include "user.h"
 #include "x86.h"
+#include "mmu.h"
+#include "memlayout.h"
+#include "vdso.h"
 
 char*
 strcpy(char *s, const char *t)
@@ -104,3 +107,43 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+    return 0;
+  return old.it_value;
+}
+
+// getpid(), uptime() and clock_gettime() read the pages the kernel
+// maps at VPROC and VDSO instead of trapping. The system calls of the
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+}
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+  return 0;
+}
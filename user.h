@@ -1,10 +1,13 @@
 struct stat;
 struct rtcdate;
 struct sigaction;
+struct traceent;
+struct itimerval;
+struct timespec;
 
 // system calls
 int fork(void);
-int exit(void) __attribute__((noreturn));
+int exit(int) __attribute__((noreturn));
 int wait(void);
 int pipe(int*);
 int write(int, const void*, int);
@@ -20,13 +23,23 @@ int link(const char*, const char*);
 int mkdir(const char*);
 int chdir(const char*);
 int dup(int);
-int getpid(void);
 char* sbrk(int);
 int sleep(int);
-int uptime(void);
 uint sigprocmask(uint); // Task-2.1.3
 int sigaction(int signum, const struct sigaction* act, struct sigaction* oldact); // Task-2.1.4
 void sigret(void); // Task-2.1.5
+int traceread(struct traceent*, int);
+int sigqueue(int, int, int);
+int signalfd(uint);
+int sigwait(uint);
+int sigsuspend(uint);
+int waitpid(int, int*, int);
+int setitimer(int, struct itimerval*, struct itimerval*);
+int nanosleep(struct timespec*);
+void* mmap(void*, int, int, int, int, int);
+int munmap(void*, int);
+int getpid_syscall(void);
+int getpid_int(void);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -41,3 +54,7 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+uint alarm(uint);
+int getpid(void);
+int uptime(void);
+int clock_gettime(int, struct timespec*);
@@ -0,0 +1,7825 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 5a 5d 00 00       	push   $0x5d5a
+      16:	6a 01                	push   $0x1
+      18:	e8 23 49 00 00       	call   4940 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	58                   	pop    %eax
+      1e:	5a                   	pop    %edx
+      1f:	6a 00                	push   $0x0
+      21:	68 6e 5d 00 00       	push   $0x5d6e
+      26:	e8 f6 45 00 00       	call   4621 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 1a                	js     4c <main+0x4c>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	51                   	push   %ecx
+      33:	51                   	push   %ecx
+      34:	68 7c 66 00 00       	push   $0x667c
+      39:	6a 01                	push   $0x1
+      3b:	e8 00 49 00 00       	call   4940 <printf>
+    exit(1);
+      40:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+      47:	e8 05 45 00 00       	call   4551 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      4c:	50                   	push   %eax
+      4d:	50                   	push   %eax
+      4e:	68 00 02 00 00       	push   $0x200
+      53:	68 6e 5d 00 00       	push   $0x5d6e
+      58:	e8 c4 45 00 00       	call   4621 <open>
+      5d:	89 04 24             	mov    %eax,(%esp)
+      60:	e8 6e 45 00 00       	call   45d3 <close>
+
+  argptest();
+      65:	e8 26 41 00 00       	call   4190 <argptest>
+  createdelete();
+      6a:	e8 51 13 00 00       	call   13c0 <createdelete>
+  linkunlink();
+      6f:	e8 bc 1c 00 00       	call   1d30 <linkunlink>
+  concreate();
+      74:	e8 87 19 00 00       	call   1a00 <concreate>
+  fourfiles();
+      79:	e8 22 11 00 00       	call   11a0 <fourfiles>
+  sharedfd();
+      7e:	e8 5d 0f 00 00       	call   fe0 <sharedfd>
+
+  bigargtest();
+      83:	e8 a8 3d 00 00       	call   3e30 <bigargtest>
+  bigwrite();
+      88:	e8 e3 26 00 00       	call   2770 <bigwrite>
+  bigargtest();
+      8d:	e8 9e 3d 00 00       	call   3e30 <bigargtest>
+  bsstest();
+      92:	e8 29 3d 00 00       	call   3dc0 <bsstest>
+  sbrktest();
+      97:	e8 14 31 00 00       	call   31b0 <sbrktest>
+  sbrksigtest();
+      9c:	e8 af 35 00 00       	call   3650 <sbrksigtest>
+  validatetest();
+      a1:	e8 5a 3c 00 00       	call   3d00 <validatetest>
+  txtbusytest();
+      a6:	e8 f5 36 00 00       	call   37a0 <txtbusytest>
+  signalfdtest();
+      ab:	e8 90 37 00 00       	call   3840 <signalfdtest>
+  sigsuspendtest();
+      b0:	e8 7b 39 00 00       	call   3a30 <sigsuspendtest>
+  nanosleeptest();
+      b5:	e8 56 3b 00 00       	call   3c10 <nanosleeptest>
+
+  opentest();
+      ba:	e8 e1 03 00 00       	call   4a0 <opentest>
+  writetest();
+      bf:	e8 7c 04 00 00       	call   540 <writetest>
+  writetest1();
+      c4:	e8 87 06 00 00       	call   750 <writetest1>
+  createtest();
+      c9:	e8 82 08 00 00       	call   950 <createtest>
+
+  openiputtest();
+      ce:	e8 ad 02 00 00       	call   380 <openiputtest>
+  exitiputtest();
+      d3:	e8 88 01 00 00       	call   260 <exitiputtest>
+  iputtest();
+      d8:	e8 83 00 00 00       	call   160 <iputtest>
+
+  mem();
+      dd:	e8 1e 0e 00 00       	call   f00 <mem>
+  pipe1();
+      e2:	e8 69 0a 00 00       	call   b50 <pipe1>
+  preempt();
+      e7:	e8 24 0c 00 00       	call   d10 <preempt>
+  exitwait();
+      ec:	e8 7f 0d 00 00       	call   e70 <exitwait>
+
+  rmdot();
+      f1:	e8 ca 2a 00 00       	call   2bc0 <rmdot>
+  fourteen();
+      f6:	e8 65 29 00 00       	call   2a60 <fourteen>
+  bigfile();
+      fb:	e8 60 27 00 00       	call   2860 <bigfile>
+  subdir();
+     100:	e8 8b 1e 00 00       	call   1f90 <subdir>
+  linktest();
+     105:	e8 a6 16 00 00       	call   17b0 <linktest>
+  unlinkread();
+     10a:	e8 e1 14 00 00       	call   15f0 <unlinkread>
+  dirfile();
+     10f:	e8 5c 2c 00 00       	call   2d70 <dirfile>
+  iref();
+     114:	e8 97 2e 00 00       	call   2fb0 <iref>
+  forktest();
+     119:	e8 c2 2f 00 00       	call   30e0 <forktest>
+  bigdir(); // slow
+     11e:	e8 1d 1d 00 00       	call   1e40 <bigdir>
+
+  uio();
+     123:	e8 e8 3f 00 00       	call   4110 <uio>
+
+  exectest();
+     128:	e8 d3 09 00 00       	call   b00 <exectest>
+
+  exit(0);
+     12d:	31 d2                	xor    %edx,%edx
+     12f:	89 14 24             	mov    %edx,(%esp)
+     132:	e8 1a 44 00 00       	call   4551 <exit>
+     137:	66 90                	xchg   %ax,%ax
+     139:	66 90                	xchg   %ax,%ax
+     13b:	66 90                	xchg   %ax,%ax
+     13d:	66 90                	xchg   %ax,%ax
+     13f:	90                   	nop
+
+00000140 <sbrksig_handler>:
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+  sbrksig_got = signum;
+     143:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     146:	5d                   	pop    %ebp
+  sbrksig_got = signum;
+     147:	a3 44 b9 00 00       	mov    %eax,0xb944
+}
+     14c:	c3                   	ret
+     14d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000150 <suspend_handler>:
+{
+     150:	55                   	push   %ebp
+     151:	89 e5                	mov    %esp,%ebp
+  suspend_got = signum;
+     153:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     156:	5d                   	pop    %ebp
+  suspend_got = signum;
+     157:	a3 40 b9 00 00       	mov    %eax,0xb940
+}
+     15c:	c3                   	ret
+     15d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000160 <iputtest>:
+{
+     160:	55                   	push   %ebp
+     161:	89 e5                	mov    %esp,%ebp
+     163:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     166:	68 fc 4c 00 00       	push   $0x4cfc
+     16b:	ff 35 80 71 00 00    	push   0x7180
+     171:	e8 ca 47 00 00       	call   4940 <printf>
+  if(mkdir("iputdir") < 0){
+     176:	c7 04 24 8f 4c 00 00 	movl   $0x4c8f,(%esp)
+     17d:	e8 21 45 00 00       	call   46a3 <mkdir>
+     182:	83 c4 10             	add    $0x10,%esp
+     185:	85 c0                	test   %eax,%eax
+     187:	78 58                	js     1e1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     189:	83 ec 0c             	sub    $0xc,%esp
+     18c:	68 8f 4c 00 00       	push   $0x4c8f
+     191:	e8 27 45 00 00       	call   46bd <chdir>
+     196:	83 c4 10             	add    $0x10,%esp
+     199:	85 c0                	test   %eax,%eax
+     19b:	0f 88 9a 00 00 00    	js     23b <iputtest+0xdb>
+  if(unlink("../iputdir") < 0){
+     1a1:	83 ec 0c             	sub    $0xc,%esp
+     1a4:	68 8c 4c 00 00       	push   $0x4c8c
+     1a9:	e8 a7 44 00 00       	call   4655 <unlink>
+     1ae:	83 c4 10             	add    $0x10,%esp
+     1b1:	85 c0                	test   %eax,%eax
+     1b3:	78 68                	js     21d <iputtest+0xbd>
+  if(chdir("/") < 0){
+     1b5:	83 ec 0c             	sub    $0xc,%esp
+     1b8:	68 b1 4c 00 00       	push   $0x4cb1
+     1bd:	e8 fb 44 00 00       	call   46bd <chdir>
+     1c2:	83 c4 10             	add    $0x10,%esp
+     1c5:	85 c0                	test   %eax,%eax
+     1c7:	78 36                	js     1ff <iputtest+0x9f>
+  printf(stdout, "iput test ok\n");
+     1c9:	83 ec 08             	sub    $0x8,%esp
+     1cc:	68 34 4d 00 00       	push   $0x4d34
+     1d1:	ff 35 80 71 00 00    	push   0x7180
+     1d7:	e8 64 47 00 00       	call   4940 <printf>
+}
+     1dc:	83 c4 10             	add    $0x10,%esp
+     1df:	c9                   	leave
+     1e0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1e1:	50                   	push   %eax
+     1e2:	50                   	push   %eax
+     1e3:	68 68 4c 00 00       	push   $0x4c68
+     1e8:	ff 35 80 71 00 00    	push   0x7180
+     1ee:	e8 4d 47 00 00       	call   4940 <printf>
+    exit(1);
+     1f3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     1fa:	e8 52 43 00 00       	call   4551 <exit>
+    printf(stdout, "chdir / failed\n");
+     1ff:	50                   	push   %eax
+     200:	50                   	push   %eax
+     201:	68 b3 4c 00 00       	push   $0x4cb3
+     206:	ff 35 80 71 00 00    	push   0x7180
+     20c:	e8 2f 47 00 00       	call   4940 <printf>
+    exit(1);
+     211:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     218:	e8 34 43 00 00       	call   4551 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     21d:	52                   	push   %edx
+     21e:	52                   	push   %edx
+     21f:	68 97 4c 00 00       	push   $0x4c97
+     224:	ff 35 80 71 00 00    	push   0x7180
+     22a:	e8 11 47 00 00       	call   4940 <printf>
+    exit(1);
+     22f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     236:	e8 16 43 00 00       	call   4551 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     23b:	51                   	push   %ecx
+     23c:	51                   	push   %ecx
+     23d:	68 76 4c 00 00       	push   $0x4c76
+     242:	ff 35 80 71 00 00    	push   0x7180
+     248:	e8 f3 46 00 00       	call   4940 <printf>
+    exit(1);
+     24d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     254:	e8 f8 42 00 00       	call   4551 <exit>
+     259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <exitiputtest>:
+{
+     260:	55                   	push   %ebp
+     261:	89 e5                	mov    %esp,%ebp
+     263:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     266:	68 c3 4c 00 00       	push   $0x4cc3
+     26b:	ff 35 80 71 00 00    	push   0x7180
+     271:	e8 ca 46 00 00       	call   4940 <printf>
+  pid = fork();
+     276:	e8 bc 42 00 00       	call   4537 <fork>
+  if(pid < 0){
+     27b:	83 c4 10             	add    $0x10,%esp
+     27e:	85 c0                	test   %eax,%eax
+     280:	0f 88 99 00 00 00    	js     31f <exitiputtest+0xbf>
+  if(pid == 0){
+     286:	75 58                	jne    2e0 <exitiputtest+0x80>
+    if(mkdir("iputdir") < 0){
+     288:	83 ec 0c             	sub    $0xc,%esp
+     28b:	68 8f 4c 00 00       	push   $0x4c8f
+     290:	e8 0e 44 00 00       	call   46a3 <mkdir>
+     295:	83 c4 10             	add    $0x10,%esp
+     298:	85 c0                	test   %eax,%eax
+     29a:	0f 88 9d 00 00 00    	js     33d <exitiputtest+0xdd>
+    if(chdir("iputdir") < 0){
+     2a0:	83 ec 0c             	sub    $0xc,%esp
+     2a3:	68 8f 4c 00 00       	push   $0x4c8f
+     2a8:	e8 10 44 00 00       	call   46bd <chdir>
+     2ad:	83 c4 10             	add    $0x10,%esp
+     2b0:	85 c0                	test   %eax,%eax
+     2b2:	0f 88 a3 00 00 00    	js     35b <exitiputtest+0xfb>
+    if(unlink("../iputdir") < 0){
+     2b8:	83 ec 0c             	sub    $0xc,%esp
+     2bb:	68 8c 4c 00 00       	push   $0x4c8c
+     2c0:	e8 90 43 00 00       	call   4655 <unlink>
+     2c5:	83 c4 10             	add    $0x10,%esp
+     2c8:	85 c0                	test   %eax,%eax
+     2ca:	78 34                	js     300 <exitiputtest+0xa0>
+    exit(0);
+     2cc:	83 ec 0c             	sub    $0xc,%esp
+     2cf:	6a 00                	push   $0x0
+     2d1:	e8 7b 42 00 00       	call   4551 <exit>
+     2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2dd:	8d 76 00             	lea    0x0(%esi),%esi
+  wait();
+     2e0:	e8 86 42 00 00       	call   456b <wait>
+  printf(stdout, "exitiput test ok\n");
+     2e5:	83 ec 08             	sub    $0x8,%esp
+     2e8:	68 e6 4c 00 00       	push   $0x4ce6
+     2ed:	ff 35 80 71 00 00    	push   0x7180
+     2f3:	e8 48 46 00 00       	call   4940 <printf>
+}
+     2f8:	83 c4 10             	add    $0x10,%esp
+     2fb:	c9                   	leave
+     2fc:	c3                   	ret
+     2fd:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     300:	83 ec 08             	sub    $0x8,%esp
+     303:	68 97 4c 00 00       	push   $0x4c97
+     308:	ff 35 80 71 00 00    	push   0x7180
+     30e:	e8 2d 46 00 00       	call   4940 <printf>
+      exit(1);
+     313:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     31a:	e8 32 42 00 00       	call   4551 <exit>
+    printf(stdout, "fork failed\n");
+     31f:	51                   	push   %ecx
+     320:	51                   	push   %ecx
+     321:	68 ad 5c 00 00       	push   $0x5cad
+     326:	ff 35 80 71 00 00    	push   0x7180
+     32c:	e8 0f 46 00 00       	call   4940 <printf>
+    exit(1);
+     331:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     338:	e8 14 42 00 00       	call   4551 <exit>
+      printf(stdout, "mkdir failed\n");
+     33d:	52                   	push   %edx
+     33e:	52                   	push   %edx
+     33f:	68 68 4c 00 00       	push   $0x4c68
+     344:	ff 35 80 71 00 00    	push   0x7180
+     34a:	e8 f1 45 00 00       	call   4940 <printf>
+      exit(1);
+     34f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     356:	e8 f6 41 00 00       	call   4551 <exit>
+      printf(stdout, "child chdir failed\n");
+     35b:	50                   	push   %eax
+     35c:	50                   	push   %eax
+     35d:	68 d2 4c 00 00       	push   $0x4cd2
+     362:	ff 35 80 71 00 00    	push   0x7180
+     368:	e8 d3 45 00 00       	call   4940 <printf>
+      exit(1);
+     36d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     374:	e8 d8 41 00 00       	call   4551 <exit>
+     379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <openiputtest>:
+{
+     380:	55                   	push   %ebp
+     381:	89 e5                	mov    %esp,%ebp
+     383:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     386:	68 f8 4c 00 00       	push   $0x4cf8
+     38b:	ff 35 80 71 00 00    	push   0x7180
+     391:	e8 aa 45 00 00       	call   4940 <printf>
+  if(mkdir("oidir") < 0){
+     396:	c7 04 24 07 4d 00 00 	movl   $0x4d07,(%esp)
+     39d:	e8 01 43 00 00       	call   46a3 <mkdir>
+     3a2:	83 c4 10             	add    $0x10,%esp
+     3a5:	85 c0                	test   %eax,%eax
+     3a7:	0f 88 b3 00 00 00    	js     460 <openiputtest+0xe0>
+  pid = fork();
+     3ad:	e8 85 41 00 00       	call   4537 <fork>
+  if(pid < 0){
+     3b2:	85 c0                	test   %eax,%eax
+     3b4:	0f 88 88 00 00 00    	js     442 <openiputtest+0xc2>
+  if(pid == 0){
+     3ba:	75 3c                	jne    3f8 <openiputtest+0x78>
+    int fd = open("oidir", O_RDWR);
+     3bc:	83 ec 08             	sub    $0x8,%esp
+     3bf:	6a 02                	push   $0x2
+     3c1:	68 07 4d 00 00       	push   $0x4d07
+     3c6:	e8 56 42 00 00       	call   4621 <open>
+    if(fd >= 0){
+     3cb:	83 c4 10             	add    $0x10,%esp
+     3ce:	85 c0                	test   %eax,%eax
+     3d0:	78 66                	js     438 <openiputtest+0xb8>
+      printf(stdout, "open directory for write succeeded\n");
+     3d2:	83 ec 08             	sub    $0x8,%esp
+     3d5:	68 90 5d 00 00       	push   $0x5d90
+     3da:	ff 35 80 71 00 00    	push   0x7180
+     3e0:	e8 5b 45 00 00       	call   4940 <printf>
+      exit(1);
+     3e5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     3ec:	e8 60 41 00 00       	call   4551 <exit>
+     3f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sleep(1);
+     3f8:	83 ec 0c             	sub    $0xc,%esp
+     3fb:	6a 01                	push   $0x1
+     3fd:	e8 09 43 00 00       	call   470b <sleep>
+  if(unlink("oidir") != 0){
+     402:	c7 04 24 07 4d 00 00 	movl   $0x4d07,(%esp)
+     409:	e8 47 42 00 00       	call   4655 <unlink>
+     40e:	83 c4 10             	add    $0x10,%esp
+     411:	85 c0                	test   %eax,%eax
+     413:	75 69                	jne    47e <openiputtest+0xfe>
+  wait();
+     415:	e8 51 41 00 00       	call   456b <wait>
+  printf(stdout, "openiput test ok\n");
+     41a:	83 ec 08             	sub    $0x8,%esp
+     41d:	68 30 4d 00 00       	push   $0x4d30
+     422:	ff 35 80 71 00 00    	push   0x7180
+     428:	e8 13 45 00 00       	call   4940 <printf>
+}
+     42d:	83 c4 10             	add    $0x10,%esp
+     430:	c9                   	leave
+     431:	c3                   	ret
+     432:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit(0);
+     438:	83 ec 0c             	sub    $0xc,%esp
+     43b:	6a 00                	push   $0x0
+     43d:	e8 0f 41 00 00       	call   4551 <exit>
+    printf(stdout, "fork failed\n");
+     442:	52                   	push   %edx
+     443:	52                   	push   %edx
+     444:	68 ad 5c 00 00       	push   $0x5cad
+     449:	ff 35 80 71 00 00    	push   0x7180
+     44f:	e8 ec 44 00 00       	call   4940 <printf>
+    exit(1);
+     454:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     45b:	e8 f1 40 00 00       	call   4551 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     460:	51                   	push   %ecx
+     461:	51                   	push   %ecx
+     462:	68 0d 4d 00 00       	push   $0x4d0d
+     467:	ff 35 80 71 00 00    	push   0x7180
+     46d:	e8 ce 44 00 00       	call   4940 <printf>
+    exit(1);
+     472:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     479:	e8 d3 40 00 00       	call   4551 <exit>
+    printf(stdout, "unlink failed\n");
+     47e:	50                   	push   %eax
+     47f:	50                   	push   %eax
+     480:	68 21 4d 00 00       	push   $0x4d21
+     485:	ff 35 80 71 00 00    	push   0x7180
+     48b:	e8 b0 44 00 00       	call   4940 <printf>
+    exit(1);
+     490:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     497:	e8 b5 40 00 00       	call   4551 <exit>
+     49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <opentest>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     4a6:	68 42 4d 00 00       	push   $0x4d42
+     4ab:	ff 35 80 71 00 00    	push   0x7180
+     4b1:	e8 8a 44 00 00       	call   4940 <printf>
+  fd = open("echo", 0);
+     4b6:	58                   	pop    %eax
+     4b7:	5a                   	pop    %edx
+     4b8:	6a 00                	push   $0x0
+     4ba:	68 4d 4d 00 00       	push   $0x4d4d
+     4bf:	e8 5d 41 00 00       	call   4621 <open>
+  if(fd < 0){
+     4c4:	83 c4 10             	add    $0x10,%esp
+     4c7:	85 c0                	test   %eax,%eax
+     4c9:	78 36                	js     501 <opentest+0x61>
+  close(fd);
+     4cb:	83 ec 0c             	sub    $0xc,%esp
+     4ce:	50                   	push   %eax
+     4cf:	e8 ff 40 00 00       	call   45d3 <close>
+  fd = open("doesnotexist", 0);
+     4d4:	5a                   	pop    %edx
+     4d5:	59                   	pop    %ecx
+     4d6:	6a 00                	push   $0x0
+     4d8:	68 65 4d 00 00       	push   $0x4d65
+     4dd:	e8 3f 41 00 00       	call   4621 <open>
+  if(fd >= 0){
+     4e2:	83 c4 10             	add    $0x10,%esp
+     4e5:	85 c0                	test   %eax,%eax
+     4e7:	79 36                	jns    51f <opentest+0x7f>
+  printf(stdout, "open test ok\n");
+     4e9:	83 ec 08             	sub    $0x8,%esp
+     4ec:	68 90 4d 00 00       	push   $0x4d90
+     4f1:	ff 35 80 71 00 00    	push   0x7180
+     4f7:	e8 44 44 00 00       	call   4940 <printf>
+}
+     4fc:	83 c4 10             	add    $0x10,%esp
+     4ff:	c9                   	leave
+     500:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     501:	50                   	push   %eax
+     502:	50                   	push   %eax
+     503:	68 52 4d 00 00       	push   $0x4d52
+     508:	ff 35 80 71 00 00    	push   0x7180
+     50e:	e8 2d 44 00 00       	call   4940 <printf>
+    exit(1);
+     513:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     51a:	e8 32 40 00 00       	call   4551 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     51f:	50                   	push   %eax
+     520:	50                   	push   %eax
+     521:	68 72 4d 00 00       	push   $0x4d72
+     526:	ff 35 80 71 00 00    	push   0x7180
+     52c:	e8 0f 44 00 00       	call   4940 <printf>
+    exit(1);
+     531:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     538:	e8 14 40 00 00       	call   4551 <exit>
+     53d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000540 <writetest>:
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	56                   	push   %esi
+     544:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     545:	83 ec 08             	sub    $0x8,%esp
+     548:	68 9e 4d 00 00       	push   $0x4d9e
+     54d:	ff 35 80 71 00 00    	push   0x7180
+     553:	e8 e8 43 00 00       	call   4940 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     558:	58                   	pop    %eax
+     559:	5a                   	pop    %edx
+     55a:	68 02 02 00 00       	push   $0x202
+     55f:	68 af 4d 00 00       	push   $0x4daf
+     564:	e8 b8 40 00 00       	call   4621 <open>
+  if(fd >= 0){
+     569:	83 c4 10             	add    $0x10,%esp
+     56c:	85 c0                	test   %eax,%eax
+     56e:	0f 88 af 01 00 00    	js     723 <writetest+0x1e3>
+    printf(stdout, "creat small succeeded; ok\n");
+     574:	83 ec 08             	sub    $0x8,%esp
+     577:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     579:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     57b:	68 b5 4d 00 00       	push   $0x4db5
+     580:	ff 35 80 71 00 00    	push   0x7180
+     586:	e8 b5 43 00 00       	call   4940 <printf>
+     58b:	83 c4 10             	add    $0x10,%esp
+     58e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     590:	83 ec 04             	sub    $0x4,%esp
+     593:	6a 0a                	push   $0xa
+     595:	68 ec 4d 00 00       	push   $0x4dec
+     59a:	56                   	push   %esi
+     59b:	e8 19 40 00 00       	call   45b9 <write>
+     5a0:	83 c4 10             	add    $0x10,%esp
+     5a3:	83 f8 0a             	cmp    $0xa,%eax
+     5a6:	0f 85 dd 00 00 00    	jne    689 <writetest+0x149>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     5ac:	83 ec 04             	sub    $0x4,%esp
+     5af:	6a 0a                	push   $0xa
+     5b1:	68 f7 4d 00 00       	push   $0x4df7
+     5b6:	56                   	push   %esi
+     5b7:	e8 fd 3f 00 00       	call   45b9 <write>
+     5bc:	83 c4 10             	add    $0x10,%esp
+     5bf:	83 f8 0a             	cmp    $0xa,%eax
+     5c2:	0f 85 e1 00 00 00    	jne    6a9 <writetest+0x169>
+  for(i = 0; i < 100; i++){
+     5c8:	83 c3 01             	add    $0x1,%ebx
+     5cb:	83 fb 64             	cmp    $0x64,%ebx
+     5ce:	75 c0                	jne    590 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     5d0:	83 ec 08             	sub    $0x8,%esp
+     5d3:	68 02 4e 00 00       	push   $0x4e02
+     5d8:	ff 35 80 71 00 00    	push   0x7180
+     5de:	e8 5d 43 00 00       	call   4940 <printf>
+  close(fd);
+     5e3:	89 34 24             	mov    %esi,(%esp)
+     5e6:	e8 e8 3f 00 00       	call   45d3 <close>
+  fd = open("small", O_RDONLY);
+     5eb:	5b                   	pop    %ebx
+     5ec:	5e                   	pop    %esi
+     5ed:	6a 00                	push   $0x0
+     5ef:	68 af 4d 00 00       	push   $0x4daf
+     5f4:	e8 28 40 00 00       	call   4621 <open>
+  if(fd >= 0){
+     5f9:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     5fc:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     5fe:	85 c0                	test   %eax,%eax
+     600:	0f 88 c3 00 00 00    	js     6c9 <writetest+0x189>
+    printf(stdout, "open small succeeded ok\n");
+     606:	83 ec 08             	sub    $0x8,%esp
+     609:	68 0d 4e 00 00       	push   $0x4e0d
+     60e:	ff 35 80 71 00 00    	push   0x7180
+     614:	e8 27 43 00 00       	call   4940 <printf>
+  i = read(fd, buf, 2000);
+     619:	83 c4 0c             	add    $0xc,%esp
+     61c:	68 d0 07 00 00       	push   $0x7d0
+     621:	68 c0 98 00 00       	push   $0x98c0
+     626:	53                   	push   %ebx
+     627:	e8 73 3f 00 00       	call   459f <read>
+  if(i == 2000){
+     62c:	83 c4 10             	add    $0x10,%esp
+     62f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     634:	0f 85 ad 00 00 00    	jne    6e7 <writetest+0x1a7>
+    printf(stdout, "read succeeded ok\n");
+     63a:	83 ec 08             	sub    $0x8,%esp
+     63d:	68 41 4e 00 00       	push   $0x4e41
+     642:	ff 35 80 71 00 00    	push   0x7180
+     648:	e8 f3 42 00 00       	call   4940 <printf>
+  close(fd);
+     64d:	89 1c 24             	mov    %ebx,(%esp)
+     650:	e8 7e 3f 00 00       	call   45d3 <close>
+  if(unlink("small") < 0){
+     655:	c7 04 24 af 4d 00 00 	movl   $0x4daf,(%esp)
+     65c:	e8 f4 3f 00 00       	call   4655 <unlink>
+     661:	83 c4 10             	add    $0x10,%esp
+     664:	85 c0                	test   %eax,%eax
+     666:	0f 88 99 00 00 00    	js     705 <writetest+0x1c5>
+  printf(stdout, "small file test ok\n");
+     66c:	83 ec 08             	sub    $0x8,%esp
+     66f:	68 69 4e 00 00       	push   $0x4e69
+     674:	ff 35 80 71 00 00    	push   0x7180
+     67a:	e8 c1 42 00 00       	call   4940 <printf>
+}
+     67f:	83 c4 10             	add    $0x10,%esp
+     682:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     685:	5b                   	pop    %ebx
+     686:	5e                   	pop    %esi
+     687:	5d                   	pop    %ebp
+     688:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     689:	83 ec 04             	sub    $0x4,%esp
+     68c:	53                   	push   %ebx
+     68d:	68 b4 5d 00 00       	push   $0x5db4
+     692:	ff 35 80 71 00 00    	push   0x7180
+     698:	e8 a3 42 00 00       	call   4940 <printf>
+      exit(1);
+     69d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     6a4:	e8 a8 3e 00 00       	call   4551 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     6a9:	83 ec 04             	sub    $0x4,%esp
+     6ac:	53                   	push   %ebx
+     6ad:	68 d8 5d 00 00       	push   $0x5dd8
+     6b2:	ff 35 80 71 00 00    	push   0x7180
+     6b8:	e8 83 42 00 00       	call   4940 <printf>
+      exit(1);
+     6bd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     6c4:	e8 88 3e 00 00       	call   4551 <exit>
+    printf(stdout, "error: open small failed!\n");
+     6c9:	51                   	push   %ecx
+     6ca:	51                   	push   %ecx
+     6cb:	68 26 4e 00 00       	push   $0x4e26
+     6d0:	ff 35 80 71 00 00    	push   0x7180
+     6d6:	e8 65 42 00 00       	call   4940 <printf>
+    exit(1);
+     6db:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     6e2:	e8 6a 3e 00 00       	call   4551 <exit>
+    printf(stdout, "read failed\n");
+     6e7:	52                   	push   %edx
+     6e8:	52                   	push   %edx
+     6e9:	68 6d 51 00 00       	push   $0x516d
+     6ee:	ff 35 80 71 00 00    	push   0x7180
+     6f4:	e8 47 42 00 00       	call   4940 <printf>
+    exit(1);
+     6f9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     700:	e8 4c 3e 00 00       	call   4551 <exit>
+    printf(stdout, "unlink small failed\n");
+     705:	50                   	push   %eax
+     706:	50                   	push   %eax
+     707:	68 54 4e 00 00       	push   $0x4e54
+     70c:	ff 35 80 71 00 00    	push   0x7180
+     712:	e8 29 42 00 00       	call   4940 <printf>
+    exit(1);
+     717:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     71e:	e8 2e 3e 00 00       	call   4551 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     723:	50                   	push   %eax
+     724:	50                   	push   %eax
+     725:	68 d0 4d 00 00       	push   $0x4dd0
+     72a:	ff 35 80 71 00 00    	push   0x7180
+     730:	e8 0b 42 00 00       	call   4940 <printf>
+    exit(1);
+     735:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     73c:	e8 10 3e 00 00       	call   4551 <exit>
+     741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74f:	90                   	nop
+
+00000750 <writetest1>:
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	56                   	push   %esi
+     754:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     755:	83 ec 08             	sub    $0x8,%esp
+     758:	68 7d 4e 00 00       	push   $0x4e7d
+     75d:	ff 35 80 71 00 00    	push   0x7180
+     763:	e8 d8 41 00 00       	call   4940 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     768:	58                   	pop    %eax
+     769:	5a                   	pop    %edx
+     76a:	68 02 02 00 00       	push   $0x202
+     76f:	68 f7 4e 00 00       	push   $0x4ef7
+     774:	e8 a8 3e 00 00       	call   4621 <open>
+  if(fd < 0){
+     779:	83 c4 10             	add    $0x10,%esp
+     77c:	85 c0                	test   %eax,%eax
+     77e:	0f 88 88 01 00 00    	js     90c <writetest1+0x1bc>
+     784:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     786:	31 db                	xor    %ebx,%ebx
+     788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     790:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     793:	89 1d c0 98 00 00    	mov    %ebx,0x98c0
+    if(write(fd, buf, 512) != 512){
+     799:	68 00 02 00 00       	push   $0x200
+     79e:	68 c0 98 00 00       	push   $0x98c0
+     7a3:	56                   	push   %esi
+     7a4:	e8 10 3e 00 00       	call   45b9 <write>
+     7a9:	83 c4 10             	add    $0x10,%esp
+     7ac:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7b1:	0f 85 b7 00 00 00    	jne    86e <writetest1+0x11e>
+  for(i = 0; i < MAXFILE; i++){
+     7b7:	83 c3 01             	add    $0x1,%ebx
+     7ba:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     7c0:	75 ce                	jne    790 <writetest1+0x40>
+  close(fd);
+     7c2:	83 ec 0c             	sub    $0xc,%esp
+     7c5:	56                   	push   %esi
+     7c6:	e8 08 3e 00 00       	call   45d3 <close>
+  fd = open("big", O_RDONLY);
+     7cb:	5b                   	pop    %ebx
+     7cc:	5e                   	pop    %esi
+     7cd:	6a 00                	push   $0x0
+     7cf:	68 f7 4e 00 00       	push   $0x4ef7
+     7d4:	e8 48 3e 00 00       	call   4621 <open>
+  if(fd < 0){
+     7d9:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     7dc:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     7de:	85 c0                	test   %eax,%eax
+     7e0:	0f 88 08 01 00 00    	js     8ee <writetest1+0x19e>
+  n = 0;
+     7e6:	31 f6                	xor    %esi,%esi
+     7e8:	eb 21                	jmp    80b <writetest1+0xbb>
+     7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     7f0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7f5:	0f 85 b1 00 00 00    	jne    8ac <writetest1+0x15c>
+    if(((int*)buf)[0] != n){
+     7fb:	a1 c0 98 00 00       	mov    0x98c0,%eax
+     800:	39 f0                	cmp    %esi,%eax
+     802:	0f 85 86 00 00 00    	jne    88e <writetest1+0x13e>
+    n++;
+     808:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     80b:	83 ec 04             	sub    $0x4,%esp
+     80e:	68 00 02 00 00       	push   $0x200
+     813:	68 c0 98 00 00       	push   $0x98c0
+     818:	53                   	push   %ebx
+     819:	e8 81 3d 00 00       	call   459f <read>
+    if(i == 0){
+     81e:	83 c4 10             	add    $0x10,%esp
+     821:	85 c0                	test   %eax,%eax
+     823:	75 cb                	jne    7f0 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     825:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     82b:	0f 84 9b 00 00 00    	je     8cc <writetest1+0x17c>
+  close(fd);
+     831:	83 ec 0c             	sub    $0xc,%esp
+     834:	53                   	push   %ebx
+     835:	e8 99 3d 00 00       	call   45d3 <close>
+  if(unlink("big") < 0){
+     83a:	c7 04 24 f7 4e 00 00 	movl   $0x4ef7,(%esp)
+     841:	e8 0f 3e 00 00       	call   4655 <unlink>
+     846:	83 c4 10             	add    $0x10,%esp
+     849:	85 c0                	test   %eax,%eax
+     84b:	0f 88 d9 00 00 00    	js     92a <writetest1+0x1da>
+  printf(stdout, "big files ok\n");
+     851:	83 ec 08             	sub    $0x8,%esp
+     854:	68 1e 4f 00 00       	push   $0x4f1e
+     859:	ff 35 80 71 00 00    	push   0x7180
+     85f:	e8 dc 40 00 00       	call   4940 <printf>
+}
+     864:	83 c4 10             	add    $0x10,%esp
+     867:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     86a:	5b                   	pop    %ebx
+     86b:	5e                   	pop    %esi
+     86c:	5d                   	pop    %ebp
+     86d:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     86e:	83 ec 04             	sub    $0x4,%esp
+     871:	53                   	push   %ebx
+     872:	68 a7 4e 00 00       	push   $0x4ea7
+     877:	ff 35 80 71 00 00    	push   0x7180
+     87d:	e8 be 40 00 00       	call   4940 <printf>
+      exit(1);
+     882:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     889:	e8 c3 3c 00 00       	call   4551 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     88e:	50                   	push   %eax
+     88f:	56                   	push   %esi
+     890:	68 fc 5d 00 00       	push   $0x5dfc
+     895:	ff 35 80 71 00 00    	push   0x7180
+     89b:	e8 a0 40 00 00       	call   4940 <printf>
+      exit(1);
+     8a0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     8a7:	e8 a5 3c 00 00       	call   4551 <exit>
+      printf(stdout, "read failed %d\n", i);
+     8ac:	83 ec 04             	sub    $0x4,%esp
+     8af:	50                   	push   %eax
+     8b0:	68 fb 4e 00 00       	push   $0x4efb
+     8b5:	ff 35 80 71 00 00    	push   0x7180
+     8bb:	e8 80 40 00 00       	call   4940 <printf>
+      exit(1);
+     8c0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     8c7:	e8 85 3c 00 00       	call   4551 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     8cc:	52                   	push   %edx
+     8cd:	68 8b 00 00 00       	push   $0x8b
+     8d2:	68 de 4e 00 00       	push   $0x4ede
+     8d7:	ff 35 80 71 00 00    	push   0x7180
+     8dd:	e8 5e 40 00 00       	call   4940 <printf>
+        exit(1);
+     8e2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     8e9:	e8 63 3c 00 00       	call   4551 <exit>
+    printf(stdout, "error: open big failed!\n");
+     8ee:	51                   	push   %ecx
+     8ef:	51                   	push   %ecx
+     8f0:	68 c5 4e 00 00       	push   $0x4ec5
+     8f5:	ff 35 80 71 00 00    	push   0x7180
+     8fb:	e8 40 40 00 00       	call   4940 <printf>
+    exit(1);
+     900:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     907:	e8 45 3c 00 00       	call   4551 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     90c:	50                   	push   %eax
+     90d:	50                   	push   %eax
+     90e:	68 8d 4e 00 00       	push   $0x4e8d
+     913:	ff 35 80 71 00 00    	push   0x7180
+     919:	e8 22 40 00 00       	call   4940 <printf>
+    exit(1);
+     91e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     925:	e8 27 3c 00 00       	call   4551 <exit>
+    printf(stdout, "unlink big failed\n");
+     92a:	50                   	push   %eax
+     92b:	50                   	push   %eax
+     92c:	68 0b 4f 00 00       	push   $0x4f0b
+     931:	ff 35 80 71 00 00    	push   0x7180
+     937:	e8 04 40 00 00       	call   4940 <printf>
+    exit(1);
+     93c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     943:	e8 09 3c 00 00       	call   4551 <exit>
+     948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94f:	90                   	nop
+
+00000950 <createtest>:
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	53                   	push   %ebx
+  name[2] = '\0';
+     954:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     959:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     95c:	68 1c 5e 00 00       	push   $0x5e1c
+     961:	ff 35 80 71 00 00    	push   0x7180
+     967:	e8 d4 3f 00 00       	call   4940 <printf>
+  name[0] = 'a';
+     96c:	c6 05 b0 98 00 00 61 	movb   $0x61,0x98b0
+  name[2] = '\0';
+     973:	83 c4 10             	add    $0x10,%esp
+     976:	c6 05 b2 98 00 00 00 	movb   $0x0,0x98b2
+  for(i = 0; i < 52; i++){
+     97d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     980:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     983:	88 1d b1 98 00 00    	mov    %bl,0x98b1
+  for(i = 0; i < 52; i++){
+     989:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     98c:	68 02 02 00 00       	push   $0x202
+     991:	68 b0 98 00 00       	push   $0x98b0
+     996:	e8 86 3c 00 00       	call   4621 <open>
+    close(fd);
+     99b:	89 04 24             	mov    %eax,(%esp)
+     99e:	e8 30 3c 00 00       	call   45d3 <close>
+  for(i = 0; i < 52; i++){
+     9a3:	83 c4 10             	add    $0x10,%esp
+     9a6:	80 fb 64             	cmp    $0x64,%bl
+     9a9:	75 d5                	jne    980 <createtest+0x30>
+  name[0] = 'a';
+     9ab:	c6 05 b0 98 00 00 61 	movb   $0x61,0x98b0
+  name[2] = '\0';
+     9b2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     9b7:	c6 05 b2 98 00 00 00 	movb   $0x0,0x98b2
+  for(i = 0; i < 52; i++){
+     9be:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     9c0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     9c3:	88 1d b1 98 00 00    	mov    %bl,0x98b1
+  for(i = 0; i < 52; i++){
+     9c9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     9cc:	68 b0 98 00 00       	push   $0x98b0
+     9d1:	e8 7f 3c 00 00       	call   4655 <unlink>
+  for(i = 0; i < 52; i++){
+     9d6:	83 c4 10             	add    $0x10,%esp
+     9d9:	80 fb 64             	cmp    $0x64,%bl
+     9dc:	75 e2                	jne    9c0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     9de:	83 ec 08             	sub    $0x8,%esp
+     9e1:	68 44 5e 00 00       	push   $0x5e44
+     9e6:	ff 35 80 71 00 00    	push   0x7180
+     9ec:	e8 4f 3f 00 00       	call   4940 <printf>
+}
+     9f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9f4:	83 c4 10             	add    $0x10,%esp
+     9f7:	c9                   	leave
+     9f8:	c3                   	ret
+     9f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a00 <dirtest>:
+{
+     a00:	55                   	push   %ebp
+     a01:	89 e5                	mov    %esp,%ebp
+     a03:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     a06:	68 2c 4f 00 00       	push   $0x4f2c
+     a0b:	ff 35 80 71 00 00    	push   0x7180
+     a11:	e8 2a 3f 00 00       	call   4940 <printf>
+  if(mkdir("dir0") < 0){
+     a16:	c7 04 24 38 4f 00 00 	movl   $0x4f38,(%esp)
+     a1d:	e8 81 3c 00 00       	call   46a3 <mkdir>
+     a22:	83 c4 10             	add    $0x10,%esp
+     a25:	85 c0                	test   %eax,%eax
+     a27:	78 58                	js     a81 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     a29:	83 ec 0c             	sub    $0xc,%esp
+     a2c:	68 38 4f 00 00       	push   $0x4f38
+     a31:	e8 87 3c 00 00       	call   46bd <chdir>
+     a36:	83 c4 10             	add    $0x10,%esp
+     a39:	85 c0                	test   %eax,%eax
+     a3b:	0f 88 9a 00 00 00    	js     adb <dirtest+0xdb>
+  if(chdir("..") < 0){
+     a41:	83 ec 0c             	sub    $0xc,%esp
+     a44:	68 dd 54 00 00       	push   $0x54dd
+     a49:	e8 6f 3c 00 00       	call   46bd <chdir>
+     a4e:	83 c4 10             	add    $0x10,%esp
+     a51:	85 c0                	test   %eax,%eax
+     a53:	78 68                	js     abd <dirtest+0xbd>
+  if(unlink("dir0") < 0){
+     a55:	83 ec 0c             	sub    $0xc,%esp
+     a58:	68 38 4f 00 00       	push   $0x4f38
+     a5d:	e8 f3 3b 00 00       	call   4655 <unlink>
+     a62:	83 c4 10             	add    $0x10,%esp
+     a65:	85 c0                	test   %eax,%eax
+     a67:	78 36                	js     a9f <dirtest+0x9f>
+  printf(stdout, "mkdir test ok\n");
+     a69:	83 ec 08             	sub    $0x8,%esp
+     a6c:	68 75 4f 00 00       	push   $0x4f75
+     a71:	ff 35 80 71 00 00    	push   0x7180
+     a77:	e8 c4 3e 00 00       	call   4940 <printf>
+}
+     a7c:	83 c4 10             	add    $0x10,%esp
+     a7f:	c9                   	leave
+     a80:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     a81:	50                   	push   %eax
+     a82:	50                   	push   %eax
+     a83:	68 68 4c 00 00       	push   $0x4c68
+     a88:	ff 35 80 71 00 00    	push   0x7180
+     a8e:	e8 ad 3e 00 00       	call   4940 <printf>
+    exit(1);
+     a93:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     a9a:	e8 b2 3a 00 00       	call   4551 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     a9f:	50                   	push   %eax
+     aa0:	50                   	push   %eax
+     aa1:	68 61 4f 00 00       	push   $0x4f61
+     aa6:	ff 35 80 71 00 00    	push   0x7180
+     aac:	e8 8f 3e 00 00       	call   4940 <printf>
+    exit(1);
+     ab1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     ab8:	e8 94 3a 00 00       	call   4551 <exit>
+    printf(stdout, "chdir .. failed\n");
+     abd:	52                   	push   %edx
+     abe:	52                   	push   %edx
+     abf:	68 50 4f 00 00       	push   $0x4f50
+     ac4:	ff 35 80 71 00 00    	push   0x7180
+     aca:	e8 71 3e 00 00       	call   4940 <printf>
+    exit(1);
+     acf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     ad6:	e8 76 3a 00 00       	call   4551 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     adb:	51                   	push   %ecx
+     adc:	51                   	push   %ecx
+     add:	68 3d 4f 00 00       	push   $0x4f3d
+     ae2:	ff 35 80 71 00 00    	push   0x7180
+     ae8:	e8 53 3e 00 00       	call   4940 <printf>
+    exit(1);
+     aed:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     af4:	e8 58 3a 00 00       	call   4551 <exit>
+     af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b00 <exectest>:
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     b06:	68 84 4f 00 00       	push   $0x4f84
+     b0b:	ff 35 80 71 00 00    	push   0x7180
+     b11:	e8 2a 3e 00 00       	call   4940 <printf>
+  if(exec("echo", echoargv) < 0){
+     b16:	5a                   	pop    %edx
+     b17:	59                   	pop    %ecx
+     b18:	68 84 71 00 00       	push   $0x7184
+     b1d:	68 4d 4d 00 00       	push   $0x4d4d
+     b22:	e8 e0 3a 00 00       	call   4607 <exec>
+     b27:	83 c4 10             	add    $0x10,%esp
+     b2a:	85 c0                	test   %eax,%eax
+     b2c:	78 02                	js     b30 <exectest+0x30>
+}
+     b2e:	c9                   	leave
+     b2f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     b30:	50                   	push   %eax
+     b31:	50                   	push   %eax
+     b32:	68 8f 4f 00 00       	push   $0x4f8f
+     b37:	ff 35 80 71 00 00    	push   0x7180
+     b3d:	e8 fe 3d 00 00       	call   4940 <printf>
+    exit(1);
+     b42:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     b49:	e8 03 3a 00 00       	call   4551 <exit>
+     b4e:	66 90                	xchg   %ax,%ax
+
+00000b50 <pipe1>:
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	57                   	push   %edi
+     b54:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     b55:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     b58:	53                   	push   %ebx
+     b59:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     b5c:	50                   	push   %eax
+     b5d:	e8 23 3a 00 00       	call   4585 <pipe>
+     b62:	83 c4 10             	add    $0x10,%esp
+     b65:	85 c0                	test   %eax,%eax
+     b67:	0f 85 51 01 00 00    	jne    cbe <pipe1+0x16e>
+     b6d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     b6f:	e8 c3 39 00 00       	call   4537 <fork>
+  if(pid == 0){
+     b74:	85 c0                	test   %eax,%eax
+     b76:	0f 84 92 00 00 00    	je     c0e <pipe1+0xbe>
+  } else if(pid > 0){
+     b7c:	0f 8e 56 01 00 00    	jle    cd8 <pipe1+0x188>
+    close(fds[1]);
+     b82:	83 ec 0c             	sub    $0xc,%esp
+     b85:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     b88:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     b8a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     b8f:	e8 3f 3a 00 00       	call   45d3 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     b94:	83 c4 10             	add    $0x10,%esp
+     b97:	83 ec 04             	sub    $0x4,%esp
+     b9a:	57                   	push   %edi
+     b9b:	68 c0 98 00 00       	push   $0x98c0
+     ba0:	ff 75 e0             	push   -0x20(%ebp)
+     ba3:	e8 f7 39 00 00       	call   459f <read>
+     ba8:	83 c4 10             	add    $0x10,%esp
+     bab:	89 c1                	mov    %eax,%ecx
+     bad:	85 c0                	test   %eax,%eax
+     baf:	0f 8e c1 00 00 00    	jle    c76 <pipe1+0x126>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     bb5:	89 f0                	mov    %esi,%eax
+     bb7:	32 05 c0 98 00 00    	xor    0x98c0,%al
+     bbd:	0f b6 c0             	movzbl %al,%eax
+     bc0:	85 c0                	test   %eax,%eax
+     bc2:	75 30                	jne    bf4 <pipe1+0xa4>
+     bc4:	83 c6 01             	add    $0x1,%esi
+     bc7:	eb 0f                	jmp    bd8 <pipe1+0x88>
+     bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bd0:	38 90 c0 98 00 00    	cmp    %dl,0x98c0(%eax)
+     bd6:	75 1c                	jne    bf4 <pipe1+0xa4>
+     bd8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     bdb:	83 c0 01             	add    $0x1,%eax
+     bde:	39 c1                	cmp    %eax,%ecx
+     be0:	75 ee                	jne    bd0 <pipe1+0x80>
+      cc = cc * 2;
+     be2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     be4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     be9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     beb:	89 d6                	mov    %edx,%esi
+     bed:	39 c7                	cmp    %eax,%edi
+     bef:	0f 4f f8             	cmovg  %eax,%edi
+     bf2:	eb a3                	jmp    b97 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     bf4:	83 ec 08             	sub    $0x8,%esp
+     bf7:	68 be 4f 00 00       	push   $0x4fbe
+     bfc:	6a 01                	push   $0x1
+     bfe:	e8 3d 3d 00 00       	call   4940 <printf>
+     c03:	83 c4 10             	add    $0x10,%esp
+}
+     c06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c09:	5b                   	pop    %ebx
+     c0a:	5e                   	pop    %esi
+     c0b:	5f                   	pop    %edi
+     c0c:	5d                   	pop    %ebp
+     c0d:	c3                   	ret
+    close(fds[0]);
+     c0e:	83 ec 0c             	sub    $0xc,%esp
+     c11:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     c14:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     c16:	e8 b8 39 00 00       	call   45d3 <close>
+     c1b:	83 c4 10             	add    $0x10,%esp
+     c1e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     c20:	31 c0                	xor    %eax,%eax
+     c22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     c28:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     c2b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     c2e:	88 90 bf 98 00 00    	mov    %dl,0x98bf(%eax)
+      for(i = 0; i < 1033; i++)
+     c34:	3d 09 04 00 00       	cmp    $0x409,%eax
+     c39:	75 ed                	jne    c28 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     c3b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     c3e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     c44:	68 09 04 00 00       	push   $0x409
+     c49:	68 c0 98 00 00       	push   $0x98c0
+     c4e:	ff 75 e4             	push   -0x1c(%ebp)
+     c51:	e8 63 39 00 00       	call   45b9 <write>
+     c56:	83 c4 10             	add    $0x10,%esp
+     c59:	3d 09 04 00 00       	cmp    $0x409,%eax
+     c5e:	0f 85 8e 00 00 00    	jne    cf2 <pipe1+0x1a2>
+    for(n = 0; n < 5; n++){
+     c64:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     c6a:	75 b4                	jne    c20 <pipe1+0xd0>
+    exit(0);
+     c6c:	83 ec 0c             	sub    $0xc,%esp
+     c6f:	6a 00                	push   $0x0
+     c71:	e8 db 38 00 00       	call   4551 <exit>
+    if(total != 5 * 1033){
+     c76:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     c7c:	75 26                	jne    ca4 <pipe1+0x154>
+    close(fds[0]);
+     c7e:	83 ec 0c             	sub    $0xc,%esp
+     c81:	ff 75 e0             	push   -0x20(%ebp)
+     c84:	e8 4a 39 00 00       	call   45d3 <close>
+    wait();
+     c89:	e8 dd 38 00 00       	call   456b <wait>
+  printf(1, "pipe1 ok\n");
+     c8e:	5a                   	pop    %edx
+     c8f:	59                   	pop    %ecx
+     c90:	68 e3 4f 00 00       	push   $0x4fe3
+     c95:	6a 01                	push   $0x1
+     c97:	e8 a4 3c 00 00       	call   4940 <printf>
+     c9c:	83 c4 10             	add    $0x10,%esp
+     c9f:	e9 62 ff ff ff       	jmp    c06 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     ca4:	56                   	push   %esi
+     ca5:	53                   	push   %ebx
+     ca6:	68 cc 4f 00 00       	push   $0x4fcc
+     cab:	6a 01                	push   $0x1
+     cad:	e8 8e 3c 00 00       	call   4940 <printf>
+      exit(1);
+     cb2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     cb9:	e8 93 38 00 00       	call   4551 <exit>
+    printf(1, "pipe() failed\n");
+     cbe:	50                   	push   %eax
+     cbf:	50                   	push   %eax
+     cc0:	68 a1 4f 00 00       	push   $0x4fa1
+     cc5:	6a 01                	push   $0x1
+     cc7:	e8 74 3c 00 00       	call   4940 <printf>
+    exit(1);
+     ccc:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     cd3:	e8 79 38 00 00       	call   4551 <exit>
+    printf(1, "fork() failed\n");
+     cd8:	50                   	push   %eax
+     cd9:	50                   	push   %eax
+     cda:	68 ed 4f 00 00       	push   $0x4fed
+     cdf:	6a 01                	push   $0x1
+     ce1:	e8 5a 3c 00 00       	call   4940 <printf>
+    exit(1);
+     ce6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     ced:	e8 5f 38 00 00       	call   4551 <exit>
+        printf(1, "pipe1 oops 1\n");
+     cf2:	57                   	push   %edi
+     cf3:	57                   	push   %edi
+     cf4:	68 b0 4f 00 00       	push   $0x4fb0
+     cf9:	6a 01                	push   $0x1
+     cfb:	e8 40 3c 00 00       	call   4940 <printf>
+        exit(1);
+     d00:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     d07:	e8 45 38 00 00       	call   4551 <exit>
+     d0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d10 <preempt>:
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	57                   	push   %edi
+     d14:	56                   	push   %esi
+     d15:	53                   	push   %ebx
+     d16:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     d19:	68 fc 4f 00 00       	push   $0x4ffc
+     d1e:	6a 01                	push   $0x1
+     d20:	e8 1b 3c 00 00       	call   4940 <printf>
+  pid1 = fork();
+     d25:	e8 0d 38 00 00       	call   4537 <fork>
+  if(pid1 == 0)
+     d2a:	83 c4 10             	add    $0x10,%esp
+     d2d:	85 c0                	test   %eax,%eax
+     d2f:	75 07                	jne    d38 <preempt+0x28>
+    for(;;)
+     d31:	eb fe                	jmp    d31 <preempt+0x21>
+     d33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d37:	90                   	nop
+     d38:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     d3a:	e8 f8 37 00 00       	call   4537 <fork>
+     d3f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     d41:	85 c0                	test   %eax,%eax
+     d43:	75 0b                	jne    d50 <preempt+0x40>
+    for(;;)
+     d45:	eb fe                	jmp    d45 <preempt+0x35>
+     d47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     d50:	83 ec 0c             	sub    $0xc,%esp
+     d53:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     d56:	50                   	push   %eax
+     d57:	e8 29 38 00 00       	call   4585 <pipe>
+  pid3 = fork();
+     d5c:	e8 d6 37 00 00       	call   4537 <fork>
+  if(pid3 == 0){
+     d61:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     d64:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     d66:	85 c0                	test   %eax,%eax
+     d68:	75 3e                	jne    da8 <preempt+0x98>
+    close(pfds[0]);
+     d6a:	83 ec 0c             	sub    $0xc,%esp
+     d6d:	ff 75 e0             	push   -0x20(%ebp)
+     d70:	e8 5e 38 00 00       	call   45d3 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     d75:	83 c4 0c             	add    $0xc,%esp
+     d78:	6a 01                	push   $0x1
+     d7a:	68 c1 55 00 00       	push   $0x55c1
+     d7f:	ff 75 e4             	push   -0x1c(%ebp)
+     d82:	e8 32 38 00 00       	call   45b9 <write>
+     d87:	83 c4 10             	add    $0x10,%esp
+     d8a:	83 f8 01             	cmp    $0x1,%eax
+     d8d:	0f 85 be 00 00 00    	jne    e51 <preempt+0x141>
+    close(pfds[1]);
+     d93:	83 ec 0c             	sub    $0xc,%esp
+     d96:	ff 75 e4             	push   -0x1c(%ebp)
+     d99:	e8 35 38 00 00       	call   45d3 <close>
+     d9e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     da1:	eb fe                	jmp    da1 <preempt+0x91>
+     da3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     da7:	90                   	nop
+  close(pfds[1]);
+     da8:	83 ec 0c             	sub    $0xc,%esp
+     dab:	ff 75 e4             	push   -0x1c(%ebp)
+     dae:	e8 20 38 00 00       	call   45d3 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     db3:	83 c4 0c             	add    $0xc,%esp
+     db6:	68 00 20 00 00       	push   $0x2000
+     dbb:	68 c0 98 00 00       	push   $0x98c0
+     dc0:	ff 75 e0             	push   -0x20(%ebp)
+     dc3:	e8 d7 37 00 00       	call   459f <read>
+     dc8:	83 c4 10             	add    $0x10,%esp
+     dcb:	83 f8 01             	cmp    $0x1,%eax
+     dce:	75 6d                	jne    e3d <preempt+0x12d>
+  close(pfds[0]);
+     dd0:	83 ec 0c             	sub    $0xc,%esp
+     dd3:	ff 75 e0             	push   -0x20(%ebp)
+     dd6:	e8 f8 37 00 00       	call   45d3 <close>
+  printf(1, "kill... ");
+     ddb:	58                   	pop    %eax
+     ddc:	5a                   	pop    %edx
+     ddd:	68 2d 50 00 00       	push   $0x502d
+     de2:	6a 01                	push   $0x1
+     de4:	e8 57 3b 00 00       	call   4940 <printf>
+  kill(pid1, SIGKILL);
+     de9:	59                   	pop    %ecx
+     dea:	58                   	pop    %eax
+     deb:	6a 09                	push   $0x9
+     ded:	53                   	push   %ebx
+     dee:	e8 fa 37 00 00       	call   45ed <kill>
+  kill(pid2, SIGKILL);
+     df3:	58                   	pop    %eax
+     df4:	5a                   	pop    %edx
+     df5:	6a 09                	push   $0x9
+     df7:	56                   	push   %esi
+     df8:	e8 f0 37 00 00       	call   45ed <kill>
+  kill(pid3, SIGKILL);
+     dfd:	59                   	pop    %ecx
+     dfe:	5b                   	pop    %ebx
+     dff:	6a 09                	push   $0x9
+     e01:	57                   	push   %edi
+     e02:	e8 e6 37 00 00       	call   45ed <kill>
+  printf(1, "wait... ");
+     e07:	5e                   	pop    %esi
+     e08:	5f                   	pop    %edi
+     e09:	68 36 50 00 00       	push   $0x5036
+     e0e:	6a 01                	push   $0x1
+     e10:	e8 2b 3b 00 00       	call   4940 <printf>
+  wait();
+     e15:	e8 51 37 00 00       	call   456b <wait>
+  wait();
+     e1a:	e8 4c 37 00 00       	call   456b <wait>
+  wait();
+     e1f:	e8 47 37 00 00       	call   456b <wait>
+  printf(1, "preempt ok\n");
+     e24:	58                   	pop    %eax
+     e25:	5a                   	pop    %edx
+     e26:	68 3f 50 00 00       	push   $0x503f
+     e2b:	6a 01                	push   $0x1
+     e2d:	e8 0e 3b 00 00       	call   4940 <printf>
+     e32:	83 c4 10             	add    $0x10,%esp
+}
+     e35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e38:	5b                   	pop    %ebx
+     e39:	5e                   	pop    %esi
+     e3a:	5f                   	pop    %edi
+     e3b:	5d                   	pop    %ebp
+     e3c:	c3                   	ret
+    printf(1, "preempt read error");
+     e3d:	83 ec 08             	sub    $0x8,%esp
+     e40:	68 1a 50 00 00       	push   $0x501a
+     e45:	6a 01                	push   $0x1
+     e47:	e8 f4 3a 00 00       	call   4940 <printf>
+     e4c:	83 c4 10             	add    $0x10,%esp
+     e4f:	eb e4                	jmp    e35 <preempt+0x125>
+      printf(1, "preempt write error");
+     e51:	83 ec 08             	sub    $0x8,%esp
+     e54:	68 06 50 00 00       	push   $0x5006
+     e59:	6a 01                	push   $0x1
+     e5b:	e8 e0 3a 00 00       	call   4940 <printf>
+     e60:	83 c4 10             	add    $0x10,%esp
+     e63:	e9 2b ff ff ff       	jmp    d93 <preempt+0x83>
+     e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6f:	90                   	nop
+
+00000e70 <exitwait>:
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	56                   	push   %esi
+     e74:	be 64 00 00 00       	mov    $0x64,%esi
+     e79:	53                   	push   %ebx
+     e7a:	eb 14                	jmp    e90 <exitwait+0x20>
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     e80:	74 68                	je     eea <exitwait+0x7a>
+      if(wait() != pid){
+     e82:	e8 e4 36 00 00       	call   456b <wait>
+     e87:	39 d8                	cmp    %ebx,%eax
+     e89:	75 2d                	jne    eb8 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     e8b:	83 ee 01             	sub    $0x1,%esi
+     e8e:	74 41                	je     ed1 <exitwait+0x61>
+    pid = fork();
+     e90:	e8 a2 36 00 00       	call   4537 <fork>
+     e95:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     e97:	85 c0                	test   %eax,%eax
+     e99:	79 e5                	jns    e80 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     e9b:	83 ec 08             	sub    $0x8,%esp
+     e9e:	68 ad 5c 00 00       	push   $0x5cad
+     ea3:	6a 01                	push   $0x1
+     ea5:	e8 96 3a 00 00       	call   4940 <printf>
+      return;
+     eaa:	83 c4 10             	add    $0x10,%esp
+}
+     ead:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     eb0:	5b                   	pop    %ebx
+     eb1:	5e                   	pop    %esi
+     eb2:	5d                   	pop    %ebp
+     eb3:	c3                   	ret
+     eb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     eb8:	83 ec 08             	sub    $0x8,%esp
+     ebb:	68 4b 50 00 00       	push   $0x504b
+     ec0:	6a 01                	push   $0x1
+     ec2:	e8 79 3a 00 00       	call   4940 <printf>
+        return;
+     ec7:	83 c4 10             	add    $0x10,%esp
+}
+     eca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ecd:	5b                   	pop    %ebx
+     ece:	5e                   	pop    %esi
+     ecf:	5d                   	pop    %ebp
+     ed0:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     ed1:	83 ec 08             	sub    $0x8,%esp
+     ed4:	68 5b 50 00 00       	push   $0x505b
+     ed9:	6a 01                	push   $0x1
+     edb:	e8 60 3a 00 00       	call   4940 <printf>
+     ee0:	83 c4 10             	add    $0x10,%esp
+}
+     ee3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ee6:	5b                   	pop    %ebx
+     ee7:	5e                   	pop    %esi
+     ee8:	5d                   	pop    %ebp
+     ee9:	c3                   	ret
+      exit(0);
+     eea:	83 ec 0c             	sub    $0xc,%esp
+     eed:	6a 00                	push   $0x0
+     eef:	e8 5d 36 00 00       	call   4551 <exit>
+     ef4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+
+00000f00 <mem>:
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	56                   	push   %esi
+     f04:	31 f6                	xor    %esi,%esi
+     f06:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     f07:	83 ec 08             	sub    $0x8,%esp
+     f0a:	68 68 50 00 00       	push   $0x5068
+     f0f:	6a 01                	push   $0x1
+     f11:	e8 2a 3a 00 00       	call   4940 <printf>
+  ppid = getpid();
+     f16:	e8 85 35 00 00       	call   44a0 <getpid>
+     f1b:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     f1d:	e8 15 36 00 00       	call   4537 <fork>
+     f22:	83 c4 10             	add    $0x10,%esp
+     f25:	85 c0                	test   %eax,%eax
+     f27:	74 0b                	je     f34 <mem+0x34>
+     f29:	e9 9a 00 00 00       	jmp    fc8 <mem+0xc8>
+     f2e:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     f30:	89 30                	mov    %esi,(%eax)
+     f32:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     f34:	83 ec 0c             	sub    $0xc,%esp
+     f37:	68 11 27 00 00       	push   $0x2711
+     f3c:	e8 3f 3c 00 00       	call   4b80 <malloc>
+     f41:	83 c4 10             	add    $0x10,%esp
+     f44:	85 c0                	test   %eax,%eax
+     f46:	75 e8                	jne    f30 <mem+0x30>
+    while(m1){
+     f48:	85 f6                	test   %esi,%esi
+     f4a:	74 18                	je     f64 <mem+0x64>
+     f4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     f50:	89 f0                	mov    %esi,%eax
+      free(m1);
+     f52:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     f55:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     f57:	50                   	push   %eax
+     f58:	e8 93 3b 00 00       	call   4af0 <free>
+    while(m1){
+     f5d:	83 c4 10             	add    $0x10,%esp
+     f60:	85 f6                	test   %esi,%esi
+     f62:	75 ec                	jne    f50 <mem+0x50>
+    m1 = malloc(1024*20);
+     f64:	83 ec 0c             	sub    $0xc,%esp
+     f67:	68 00 50 00 00       	push   $0x5000
+     f6c:	e8 0f 3c 00 00       	call   4b80 <malloc>
+    if(m1 == 0){
+     f71:	83 c4 10             	add    $0x10,%esp
+     f74:	85 c0                	test   %eax,%eax
+     f76:	74 28                	je     fa0 <mem+0xa0>
+    free(m1);
+     f78:	83 ec 0c             	sub    $0xc,%esp
+     f7b:	50                   	push   %eax
+     f7c:	e8 6f 3b 00 00       	call   4af0 <free>
+    printf(1, "mem ok\n");
+     f81:	58                   	pop    %eax
+     f82:	5a                   	pop    %edx
+     f83:	68 8c 50 00 00       	push   $0x508c
+     f88:	6a 01                	push   $0x1
+     f8a:	e8 b1 39 00 00       	call   4940 <printf>
+    exit(0);
+     f8f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     f96:	e8 b6 35 00 00       	call   4551 <exit>
+     f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f9f:	90                   	nop
+      printf(1, "couldn't allocate mem?!!\n");
+     fa0:	83 ec 08             	sub    $0x8,%esp
+     fa3:	68 72 50 00 00       	push   $0x5072
+     fa8:	6a 01                	push   $0x1
+     faa:	e8 91 39 00 00       	call   4940 <printf>
+      kill(ppid, SIGKILL);
+     faf:	59                   	pop    %ecx
+     fb0:	5e                   	pop    %esi
+     fb1:	6a 09                	push   $0x9
+     fb3:	53                   	push   %ebx
+     fb4:	e8 34 36 00 00       	call   45ed <kill>
+      exit(1);
+     fb9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     fc0:	e8 8c 35 00 00       	call   4551 <exit>
+     fc5:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     fc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fcb:	5b                   	pop    %ebx
+     fcc:	5e                   	pop    %esi
+     fcd:	5d                   	pop    %ebp
+    wait();
+     fce:	e9 98 35 00 00       	jmp    456b <wait>
+     fd3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000fe0 <sharedfd>:
+{
+     fe0:	55                   	push   %ebp
+     fe1:	89 e5                	mov    %esp,%ebp
+     fe3:	57                   	push   %edi
+     fe4:	56                   	push   %esi
+     fe5:	53                   	push   %ebx
+     fe6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     fe9:	68 94 50 00 00       	push   $0x5094
+     fee:	6a 01                	push   $0x1
+     ff0:	e8 4b 39 00 00       	call   4940 <printf>
+  unlink("sharedfd");
+     ff5:	c7 04 24 a3 50 00 00 	movl   $0x50a3,(%esp)
+     ffc:	e8 54 36 00 00       	call   4655 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1001:	5b                   	pop    %ebx
+    1002:	5e                   	pop    %esi
+    1003:	68 02 02 00 00       	push   $0x202
+    1008:	68 a3 50 00 00       	push   $0x50a3
+    100d:	e8 0f 36 00 00       	call   4621 <open>
+  if(fd < 0){
+    1012:	83 c4 10             	add    $0x10,%esp
+    1015:	85 c0                	test   %eax,%eax
+    1017:	0f 88 2a 01 00 00    	js     1147 <sharedfd+0x167>
+    101d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    101f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    1022:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    1027:	e8 0b 35 00 00       	call   4537 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    102c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    102f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1032:	19 c0                	sbb    %eax,%eax
+    1034:	83 ec 04             	sub    $0x4,%esp
+    1037:	83 e0 f3             	and    $0xfffffff3,%eax
+    103a:	6a 0a                	push   $0xa
+    103c:	83 c0 70             	add    $0x70,%eax
+    103f:	50                   	push   %eax
+    1040:	56                   	push   %esi
+    1041:	e8 9a 32 00 00       	call   42e0 <memset>
+    1046:	83 c4 10             	add    $0x10,%esp
+    1049:	eb 0a                	jmp    1055 <sharedfd+0x75>
+    104b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    104f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    1050:	83 eb 01             	sub    $0x1,%ebx
+    1053:	74 26                	je     107b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1055:	83 ec 04             	sub    $0x4,%esp
+    1058:	6a 0a                	push   $0xa
+    105a:	56                   	push   %esi
+    105b:	57                   	push   %edi
+    105c:	e8 58 35 00 00       	call   45b9 <write>
+    1061:	83 c4 10             	add    $0x10,%esp
+    1064:	83 f8 0a             	cmp    $0xa,%eax
+    1067:	74 e7                	je     1050 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1069:	83 ec 08             	sub    $0x8,%esp
+    106c:	68 98 5e 00 00       	push   $0x5e98
+    1071:	6a 01                	push   $0x1
+    1073:	e8 c8 38 00 00       	call   4940 <printf>
+      break;
+    1078:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    107b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    107e:	85 c9                	test   %ecx,%ecx
+    1080:	0f 84 f5 00 00 00    	je     117b <sharedfd+0x19b>
+    wait();
+    1086:	e8 e0 34 00 00       	call   456b <wait>
+  close(fd);
+    108b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    108e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1090:	57                   	push   %edi
+    1091:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    1094:	e8 3a 35 00 00       	call   45d3 <close>
+  fd = open("sharedfd", 0);
+    1099:	58                   	pop    %eax
+    109a:	5a                   	pop    %edx
+    109b:	6a 00                	push   $0x0
+    109d:	68 a3 50 00 00       	push   $0x50a3
+    10a2:	e8 7a 35 00 00       	call   4621 <open>
+  if(fd < 0){
+    10a7:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    10aa:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    10ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    10af:	85 c0                	test   %eax,%eax
+    10b1:	0f 88 aa 00 00 00    	js     1161 <sharedfd+0x181>
+    10b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10be:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    10c0:	83 ec 04             	sub    $0x4,%esp
+    10c3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    10c6:	6a 0a                	push   $0xa
+    10c8:	56                   	push   %esi
+    10c9:	ff 75 d0             	push   -0x30(%ebp)
+    10cc:	e8 ce 34 00 00       	call   459f <read>
+    10d1:	83 c4 10             	add    $0x10,%esp
+    10d4:	85 c0                	test   %eax,%eax
+    10d6:	7e 28                	jle    1100 <sharedfd+0x120>
+    10d8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    10db:	89 f0                	mov    %esi,%eax
+    10dd:	eb 13                	jmp    10f2 <sharedfd+0x112>
+    10df:	90                   	nop
+        np++;
+    10e0:	80 f9 70             	cmp    $0x70,%cl
+    10e3:	0f 94 c1             	sete   %cl
+    10e6:	0f b6 c9             	movzbl %cl,%ecx
+    10e9:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    10eb:	83 c0 01             	add    $0x1,%eax
+    10ee:	39 f8                	cmp    %edi,%eax
+    10f0:	74 ce                	je     10c0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    10f2:	0f b6 08             	movzbl (%eax),%ecx
+    10f5:	80 f9 63             	cmp    $0x63,%cl
+    10f8:	75 e6                	jne    10e0 <sharedfd+0x100>
+        nc++;
+    10fa:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    10fd:	eb ec                	jmp    10eb <sharedfd+0x10b>
+    10ff:	90                   	nop
+  close(fd);
+    1100:	83 ec 0c             	sub    $0xc,%esp
+    1103:	ff 75 d0             	push   -0x30(%ebp)
+    1106:	e8 c8 34 00 00       	call   45d3 <close>
+  unlink("sharedfd");
+    110b:	c7 04 24 a3 50 00 00 	movl   $0x50a3,(%esp)
+    1112:	e8 3e 35 00 00       	call   4655 <unlink>
+  if(nc == 10000 && np == 10000){
+    1117:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    111a:	83 c4 10             	add    $0x10,%esp
+    111d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1123:	75 60                	jne    1185 <sharedfd+0x1a5>
+    1125:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    112b:	75 58                	jne    1185 <sharedfd+0x1a5>
+    printf(1, "sharedfd ok\n");
+    112d:	83 ec 08             	sub    $0x8,%esp
+    1130:	68 ac 50 00 00       	push   $0x50ac
+    1135:	6a 01                	push   $0x1
+    1137:	e8 04 38 00 00       	call   4940 <printf>
+    113c:	83 c4 10             	add    $0x10,%esp
+}
+    113f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1142:	5b                   	pop    %ebx
+    1143:	5e                   	pop    %esi
+    1144:	5f                   	pop    %edi
+    1145:	5d                   	pop    %ebp
+    1146:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1147:	83 ec 08             	sub    $0x8,%esp
+    114a:	68 6c 5e 00 00       	push   $0x5e6c
+    114f:	6a 01                	push   $0x1
+    1151:	e8 ea 37 00 00       	call   4940 <printf>
+    return;
+    1156:	83 c4 10             	add    $0x10,%esp
+}
+    1159:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    115c:	5b                   	pop    %ebx
+    115d:	5e                   	pop    %esi
+    115e:	5f                   	pop    %edi
+    115f:	5d                   	pop    %ebp
+    1160:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1161:	83 ec 08             	sub    $0x8,%esp
+    1164:	68 b8 5e 00 00       	push   $0x5eb8
+    1169:	6a 01                	push   $0x1
+    116b:	e8 d0 37 00 00       	call   4940 <printf>
+    return;
+    1170:	83 c4 10             	add    $0x10,%esp
+}
+    1173:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1176:	5b                   	pop    %ebx
+    1177:	5e                   	pop    %esi
+    1178:	5f                   	pop    %edi
+    1179:	5d                   	pop    %ebp
+    117a:	c3                   	ret
+    exit(0);
+    117b:	83 ec 0c             	sub    $0xc,%esp
+    117e:	6a 00                	push   $0x0
+    1180:	e8 cc 33 00 00       	call   4551 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1185:	53                   	push   %ebx
+    1186:	52                   	push   %edx
+    1187:	68 b9 50 00 00       	push   $0x50b9
+    118c:	6a 01                	push   $0x1
+    118e:	e8 ad 37 00 00       	call   4940 <printf>
+    exit(1);
+    1193:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    119a:	e8 b2 33 00 00       	call   4551 <exit>
+    119f:	90                   	nop
+
+000011a0 <fourfiles>:
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	57                   	push   %edi
+    11a4:	56                   	push   %esi
+    11a5:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    11a6:	31 db                	xor    %ebx,%ebx
+{
+    11a8:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    11ab:	c7 45 d8 ce 50 00 00 	movl   $0x50ce,-0x28(%ebp)
+    11b2:	c7 45 dc 17 52 00 00 	movl   $0x5217,-0x24(%ebp)
+    11b9:	c7 45 e0 1b 52 00 00 	movl   $0x521b,-0x20(%ebp)
+    11c0:	c7 45 e4 d1 50 00 00 	movl   $0x50d1,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    11c7:	68 d4 50 00 00       	push   $0x50d4
+    11cc:	6a 01                	push   $0x1
+    11ce:	e8 6d 37 00 00       	call   4940 <printf>
+    11d3:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    11d6:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    11da:	83 ec 0c             	sub    $0xc,%esp
+    11dd:	56                   	push   %esi
+    11de:	e8 72 34 00 00       	call   4655 <unlink>
+    pid = fork();
+    11e3:	e8 4f 33 00 00       	call   4537 <fork>
+    if(pid < 0){
+    11e8:	83 c4 10             	add    $0x10,%esp
+    11eb:	85 c0                	test   %eax,%eax
+    11ed:	0f 88 7d 01 00 00    	js     1370 <fourfiles+0x1d0>
+    if(pid == 0){
+    11f3:	0f 84 f2 00 00 00    	je     12eb <fourfiles+0x14b>
+  for(pi = 0; pi < 4; pi++){
+    11f9:	83 c3 01             	add    $0x1,%ebx
+    11fc:	83 fb 04             	cmp    $0x4,%ebx
+    11ff:	75 d5                	jne    11d6 <fourfiles+0x36>
+    wait();
+    1201:	e8 65 33 00 00       	call   456b <wait>
+  for(i = 0; i < 2; i++){
+    1206:	31 f6                	xor    %esi,%esi
+    wait();
+    1208:	e8 5e 33 00 00       	call   456b <wait>
+    120d:	e8 59 33 00 00       	call   456b <wait>
+    1212:	e8 54 33 00 00       	call   456b <wait>
+    fname = names[i];
+    1217:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    121b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    121e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    1220:	6a 00                	push   $0x0
+    1222:	53                   	push   %ebx
+    1223:	e8 f9 33 00 00       	call   4621 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1228:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    122b:	83 c4 10             	add    $0x10,%esp
+    122e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1238:	83 ec 04             	sub    $0x4,%esp
+    123b:	68 00 20 00 00       	push   $0x2000
+    1240:	68 c0 98 00 00       	push   $0x98c0
+    1245:	ff 75 d4             	push   -0x2c(%ebp)
+    1248:	e8 52 33 00 00       	call   459f <read>
+    124d:	83 c4 10             	add    $0x10,%esp
+    1250:	89 c3                	mov    %eax,%ebx
+    1252:	85 c0                	test   %eax,%eax
+    1254:	7e 28                	jle    127e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1256:	31 c0                	xor    %eax,%eax
+    1258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    125f:	90                   	nop
+        if(buf[j] != '0'+i){
+    1260:	83 fe 01             	cmp    $0x1,%esi
+    1263:	0f be 88 c0 98 00 00 	movsbl 0x98c0(%eax),%ecx
+    126a:	19 d2                	sbb    %edx,%edx
+    126c:	83 c2 31             	add    $0x31,%edx
+    126f:	39 d1                	cmp    %edx,%ecx
+    1271:	75 5d                	jne    12d0 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1273:	83 c0 01             	add    $0x1,%eax
+    1276:	39 c3                	cmp    %eax,%ebx
+    1278:	75 e6                	jne    1260 <fourfiles+0xc0>
+      total += n;
+    127a:	01 df                	add    %ebx,%edi
+    127c:	eb ba                	jmp    1238 <fourfiles+0x98>
+    close(fd);
+    127e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1281:	83 ec 0c             	sub    $0xc,%esp
+    1284:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1287:	51                   	push   %ecx
+    1288:	e8 46 33 00 00       	call   45d3 <close>
+    if(total != 12*500){
+    128d:	83 c4 10             	add    $0x10,%esp
+    1290:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1296:	0f 85 ef 00 00 00    	jne    138b <fourfiles+0x1eb>
+    unlink(fname);
+    129c:	83 ec 0c             	sub    $0xc,%esp
+    129f:	53                   	push   %ebx
+    12a0:	e8 b0 33 00 00       	call   4655 <unlink>
+  for(i = 0; i < 2; i++){
+    12a5:	83 c4 10             	add    $0x10,%esp
+    12a8:	85 f6                	test   %esi,%esi
+    12aa:	75 0a                	jne    12b6 <fourfiles+0x116>
+    12ac:	be 01 00 00 00       	mov    $0x1,%esi
+    12b1:	e9 61 ff ff ff       	jmp    1217 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    12b6:	83 ec 08             	sub    $0x8,%esp
+    12b9:	68 12 51 00 00       	push   $0x5112
+    12be:	6a 01                	push   $0x1
+    12c0:	e8 7b 36 00 00       	call   4940 <printf>
+}
+    12c5:	83 c4 10             	add    $0x10,%esp
+    12c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12cb:	5b                   	pop    %ebx
+    12cc:	5e                   	pop    %esi
+    12cd:	5f                   	pop    %edi
+    12ce:	5d                   	pop    %ebp
+    12cf:	c3                   	ret
+          printf(1, "wrong char\n");
+    12d0:	83 ec 08             	sub    $0x8,%esp
+    12d3:	68 f5 50 00 00       	push   $0x50f5
+    12d8:	6a 01                	push   $0x1
+    12da:	e8 61 36 00 00       	call   4940 <printf>
+          exit(1);
+    12df:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    12e6:	e8 66 32 00 00       	call   4551 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    12eb:	83 ec 08             	sub    $0x8,%esp
+    12ee:	68 02 02 00 00       	push   $0x202
+    12f3:	56                   	push   %esi
+    12f4:	e8 28 33 00 00       	call   4621 <open>
+      if(fd < 0){
+    12f9:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    12fc:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    12fe:	85 c0                	test   %eax,%eax
+    1300:	78 4a                	js     134c <fourfiles+0x1ac>
+      memset(buf, '0'+pi, 512);
+    1302:	83 ec 04             	sub    $0x4,%esp
+    1305:	83 c3 30             	add    $0x30,%ebx
+    1308:	68 00 02 00 00       	push   $0x200
+    130d:	53                   	push   %ebx
+    130e:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    1313:	68 c0 98 00 00       	push   $0x98c0
+    1318:	e8 c3 2f 00 00       	call   42e0 <memset>
+    131d:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1320:	83 ec 04             	sub    $0x4,%esp
+    1323:	68 f4 01 00 00       	push   $0x1f4
+    1328:	68 c0 98 00 00       	push   $0x98c0
+    132d:	56                   	push   %esi
+    132e:	e8 86 32 00 00       	call   45b9 <write>
+    1333:	83 c4 10             	add    $0x10,%esp
+    1336:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    133b:	75 68                	jne    13a5 <fourfiles+0x205>
+      for(i = 0; i < 12; i++){
+    133d:	83 eb 01             	sub    $0x1,%ebx
+    1340:	75 de                	jne    1320 <fourfiles+0x180>
+      exit(0);
+    1342:	83 ec 0c             	sub    $0xc,%esp
+    1345:	6a 00                	push   $0x0
+    1347:	e8 05 32 00 00       	call   4551 <exit>
+        printf(1, "create failed\n");
+    134c:	51                   	push   %ecx
+    134d:	51                   	push   %ecx
+    134e:	68 6f 53 00 00       	push   $0x536f
+    1353:	6a 01                	push   $0x1
+    1355:	e8 e6 35 00 00       	call   4940 <printf>
+        exit(1);
+    135a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1361:	e8 eb 31 00 00       	call   4551 <exit>
+    1366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136d:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(1, "fork failed\n");
+    1370:	83 ec 08             	sub    $0x8,%esp
+    1373:	68 ad 5c 00 00       	push   $0x5cad
+    1378:	6a 01                	push   $0x1
+    137a:	e8 c1 35 00 00       	call   4940 <printf>
+      exit(1);
+    137f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1386:	e8 c6 31 00 00       	call   4551 <exit>
+      printf(1, "wrong length %d\n", total);
+    138b:	50                   	push   %eax
+    138c:	57                   	push   %edi
+    138d:	68 01 51 00 00       	push   $0x5101
+    1392:	6a 01                	push   $0x1
+    1394:	e8 a7 35 00 00       	call   4940 <printf>
+      exit(1);
+    1399:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    13a0:	e8 ac 31 00 00       	call   4551 <exit>
+          printf(1, "write failed %d\n", n);
+    13a5:	52                   	push   %edx
+    13a6:	50                   	push   %eax
+    13a7:	68 e4 50 00 00       	push   $0x50e4
+    13ac:	6a 01                	push   $0x1
+    13ae:	e8 8d 35 00 00       	call   4940 <printf>
+          exit(1);
+    13b3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    13ba:	e8 92 31 00 00       	call   4551 <exit>
+    13bf:	90                   	nop
+
+000013c0 <createdelete>:
+{
+    13c0:	55                   	push   %ebp
+    13c1:	89 e5                	mov    %esp,%ebp
+    13c3:	57                   	push   %edi
+    13c4:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    13c5:	31 f6                	xor    %esi,%esi
+{
+    13c7:	53                   	push   %ebx
+    13c8:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    13cb:	68 20 51 00 00       	push   $0x5120
+    13d0:	6a 01                	push   $0x1
+    13d2:	e8 69 35 00 00       	call   4940 <printf>
+    13d7:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    13da:	e8 58 31 00 00       	call   4537 <fork>
+    13df:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    13e1:	85 c0                	test   %eax,%eax
+    13e3:	0f 88 c3 01 00 00    	js     15ac <createdelete+0x1ec>
+    if(pid == 0){
+    13e9:	0f 84 01 01 00 00    	je     14f0 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    13ef:	83 c6 01             	add    $0x1,%esi
+    13f2:	83 fe 04             	cmp    $0x4,%esi
+    13f5:	75 e3                	jne    13da <createdelete+0x1a>
+    wait();
+    13f7:	e8 6f 31 00 00       	call   456b <wait>
+  for(i = 0; i < N; i++){
+    13fc:	31 ff                	xor    %edi,%edi
+    13fe:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1401:	e8 65 31 00 00       	call   456b <wait>
+    1406:	e8 60 31 00 00       	call   456b <wait>
+    140b:	e8 5b 31 00 00       	call   456b <wait>
+  name[0] = name[1] = name[2] = 0;
+    1410:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1414:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1418:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    141a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    141d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1422:	0f 94 c2             	sete   %dl
+    1425:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1428:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    142b:	0f 9f c0             	setg   %al
+    142e:	09 c2                	or     %eax,%edx
+    1430:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1433:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1437:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    143a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    143d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    1440:	6a 00                	push   $0x0
+    1442:	56                   	push   %esi
+    1443:	e8 d9 31 00 00       	call   4621 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    1448:	83 c4 10             	add    $0x10,%esp
+    144b:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    144f:	74 7f                	je     14d0 <createdelete+0x110>
+    1451:	85 c0                	test   %eax,%eax
+    1453:	0f 88 37 01 00 00    	js     1590 <createdelete+0x1d0>
+        close(fd);
+    1459:	83 ec 0c             	sub    $0xc,%esp
+    145c:	50                   	push   %eax
+    145d:	e8 71 31 00 00       	call   45d3 <close>
+    1462:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1465:	83 c3 01             	add    $0x1,%ebx
+    1468:	80 fb 74             	cmp    $0x74,%bl
+    146b:	75 c6                	jne    1433 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    146d:	83 c7 01             	add    $0x1,%edi
+    1470:	83 ff 14             	cmp    $0x14,%edi
+    1473:	75 a3                	jne    1418 <createdelete+0x58>
+    1475:	bf 70 00 00 00       	mov    $0x70,%edi
+    147a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1480:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1483:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1488:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    148b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    148d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1490:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1493:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1497:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    149a:	56                   	push   %esi
+    149b:	e8 b5 31 00 00       	call   4655 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    14a0:	83 c4 10             	add    $0x10,%esp
+    14a3:	83 eb 01             	sub    $0x1,%ebx
+    14a6:	75 e3                	jne    148b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    14a8:	83 c7 01             	add    $0x1,%edi
+    14ab:	89 f8                	mov    %edi,%eax
+    14ad:	3c 84                	cmp    $0x84,%al
+    14af:	75 cf                	jne    1480 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    14b1:	83 ec 08             	sub    $0x8,%esp
+    14b4:	68 33 51 00 00       	push   $0x5133
+    14b9:	6a 01                	push   $0x1
+    14bb:	e8 80 34 00 00       	call   4940 <printf>
+}
+    14c0:	83 c4 10             	add    $0x10,%esp
+    14c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14c6:	5b                   	pop    %ebx
+    14c7:	5e                   	pop    %esi
+    14c8:	5f                   	pop    %edi
+    14c9:	5d                   	pop    %ebp
+    14ca:	c3                   	ret
+    14cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    14cf:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    14d0:	85 c0                	test   %eax,%eax
+    14d2:	78 91                	js     1465 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    14d4:	50                   	push   %eax
+    14d5:	56                   	push   %esi
+    14d6:	68 08 5f 00 00       	push   $0x5f08
+    14db:	6a 01                	push   $0x1
+    14dd:	e8 5e 34 00 00       	call   4940 <printf>
+        exit(1);
+    14e2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    14e9:	e8 63 30 00 00       	call   4551 <exit>
+    14ee:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    14f0:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    14f3:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    14f7:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    14fa:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    14fd:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1500:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1503:	8d 43 30             	lea    0x30(%ebx),%eax
+    1506:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1509:	68 02 02 00 00       	push   $0x202
+    150e:	56                   	push   %esi
+    150f:	e8 0d 31 00 00       	call   4621 <open>
+        if(fd < 0){
+    1514:	83 c4 10             	add    $0x10,%esp
+    1517:	85 c0                	test   %eax,%eax
+    1519:	0f 88 a8 00 00 00    	js     15c7 <createdelete+0x207>
+        close(fd);
+    151f:	83 ec 0c             	sub    $0xc,%esp
+    1522:	50                   	push   %eax
+    1523:	e8 ab 30 00 00       	call   45d3 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1528:	83 c4 10             	add    $0x10,%esp
+    152b:	85 db                	test   %ebx,%ebx
+    152d:	74 21                	je     1550 <createdelete+0x190>
+    152f:	f6 c3 01             	test   $0x1,%bl
+    1532:	74 23                	je     1557 <createdelete+0x197>
+      for(i = 0; i < N; i++){
+    1534:	83 c3 01             	add    $0x1,%ebx
+    1537:	83 fb 14             	cmp    $0x14,%ebx
+    153a:	75 c4                	jne    1500 <createdelete+0x140>
+      exit(0);
+    153c:	83 ec 0c             	sub    $0xc,%esp
+    153f:	6a 00                	push   $0x0
+    1541:	e8 0b 30 00 00       	call   4551 <exit>
+    1546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    154d:	8d 76 00             	lea    0x0(%esi),%esi
+      for(i = 0; i < N; i++){
+    1550:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1555:	eb a9                	jmp    1500 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    1557:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    1559:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    155c:	d1 f8                	sar    %eax
+    155e:	83 c0 30             	add    $0x30,%eax
+    1561:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    1564:	56                   	push   %esi
+    1565:	e8 eb 30 00 00       	call   4655 <unlink>
+    156a:	83 c4 10             	add    $0x10,%esp
+    156d:	85 c0                	test   %eax,%eax
+    156f:	79 c3                	jns    1534 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1571:	52                   	push   %edx
+    1572:	52                   	push   %edx
+    1573:	68 21 4d 00 00       	push   $0x4d21
+    1578:	6a 01                	push   $0x1
+    157a:	e8 c1 33 00 00       	call   4940 <printf>
+            exit(1);
+    157f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1586:	e8 c6 2f 00 00       	call   4551 <exit>
+    158b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    158f:	90                   	nop
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1590:	83 ec 04             	sub    $0x4,%esp
+    1593:	56                   	push   %esi
+    1594:	68 e4 5e 00 00       	push   $0x5ee4
+    1599:	6a 01                	push   $0x1
+    159b:	e8 a0 33 00 00       	call   4940 <printf>
+        exit(1);
+    15a0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    15a7:	e8 a5 2f 00 00       	call   4551 <exit>
+      printf(1, "fork failed\n");
+    15ac:	83 ec 08             	sub    $0x8,%esp
+    15af:	68 ad 5c 00 00       	push   $0x5cad
+    15b4:	6a 01                	push   $0x1
+    15b6:	e8 85 33 00 00       	call   4940 <printf>
+      exit(1);
+    15bb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    15c2:	e8 8a 2f 00 00       	call   4551 <exit>
+          printf(1, "create failed\n");
+    15c7:	83 ec 08             	sub    $0x8,%esp
+    15ca:	68 6f 53 00 00       	push   $0x536f
+    15cf:	6a 01                	push   $0x1
+    15d1:	e8 6a 33 00 00       	call   4940 <printf>
+          exit(1);
+    15d6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    15dd:	e8 6f 2f 00 00       	call   4551 <exit>
+    15e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000015f0 <unlinkread>:
+{
+    15f0:	55                   	push   %ebp
+    15f1:	89 e5                	mov    %esp,%ebp
+    15f3:	56                   	push   %esi
+    15f4:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    15f5:	83 ec 08             	sub    $0x8,%esp
+    15f8:	68 44 51 00 00       	push   $0x5144
+    15fd:	6a 01                	push   $0x1
+    15ff:	e8 3c 33 00 00       	call   4940 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1604:	5b                   	pop    %ebx
+    1605:	5e                   	pop    %esi
+    1606:	68 02 02 00 00       	push   $0x202
+    160b:	68 55 51 00 00       	push   $0x5155
+    1610:	e8 0c 30 00 00       	call   4621 <open>
+  if(fd < 0){
+    1615:	83 c4 10             	add    $0x10,%esp
+    1618:	85 c0                	test   %eax,%eax
+    161a:	0f 88 e6 00 00 00    	js     1706 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1620:	83 ec 04             	sub    $0x4,%esp
+    1623:	89 c3                	mov    %eax,%ebx
+    1625:	6a 05                	push   $0x5
+    1627:	68 7a 51 00 00       	push   $0x517a
+    162c:	50                   	push   %eax
+    162d:	e8 87 2f 00 00       	call   45b9 <write>
+  close(fd);
+    1632:	89 1c 24             	mov    %ebx,(%esp)
+    1635:	e8 99 2f 00 00       	call   45d3 <close>
+  fd = open("unlinkread", O_RDWR);
+    163a:	58                   	pop    %eax
+    163b:	5a                   	pop    %edx
+    163c:	6a 02                	push   $0x2
+    163e:	68 55 51 00 00       	push   $0x5155
+    1643:	e8 d9 2f 00 00       	call   4621 <open>
+  if(fd < 0){
+    1648:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    164b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    164d:	85 c0                	test   %eax,%eax
+    164f:	0f 88 33 01 00 00    	js     1788 <unlinkread+0x198>
+  if(unlink("unlinkread") != 0){
+    1655:	83 ec 0c             	sub    $0xc,%esp
+    1658:	68 55 51 00 00       	push   $0x5155
+    165d:	e8 f3 2f 00 00       	call   4655 <unlink>
+    1662:	83 c4 10             	add    $0x10,%esp
+    1665:	85 c0                	test   %eax,%eax
+    1667:	0f 85 01 01 00 00    	jne    176e <unlinkread+0x17e>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    166d:	83 ec 08             	sub    $0x8,%esp
+    1670:	68 02 02 00 00       	push   $0x202
+    1675:	68 55 51 00 00       	push   $0x5155
+    167a:	e8 a2 2f 00 00       	call   4621 <open>
+  write(fd1, "yyy", 3);
+    167f:	83 c4 0c             	add    $0xc,%esp
+    1682:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1684:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    1686:	68 b2 51 00 00       	push   $0x51b2
+    168b:	50                   	push   %eax
+    168c:	e8 28 2f 00 00       	call   45b9 <write>
+  close(fd1);
+    1691:	89 34 24             	mov    %esi,(%esp)
+    1694:	e8 3a 2f 00 00       	call   45d3 <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1699:	83 c4 0c             	add    $0xc,%esp
+    169c:	68 00 20 00 00       	push   $0x2000
+    16a1:	68 c0 98 00 00       	push   $0x98c0
+    16a6:	53                   	push   %ebx
+    16a7:	e8 f3 2e 00 00       	call   459f <read>
+    16ac:	83 c4 10             	add    $0x10,%esp
+    16af:	83 f8 05             	cmp    $0x5,%eax
+    16b2:	0f 85 9c 00 00 00    	jne    1754 <unlinkread+0x164>
+  if(buf[0] != 'h'){
+    16b8:	80 3d c0 98 00 00 68 	cmpb   $0x68,0x98c0
+    16bf:	75 79                	jne    173a <unlinkread+0x14a>
+  if(write(fd, buf, 10) != 10){
+    16c1:	83 ec 04             	sub    $0x4,%esp
+    16c4:	6a 0a                	push   $0xa
+    16c6:	68 c0 98 00 00       	push   $0x98c0
+    16cb:	53                   	push   %ebx
+    16cc:	e8 e8 2e 00 00       	call   45b9 <write>
+    16d1:	83 c4 10             	add    $0x10,%esp
+    16d4:	83 f8 0a             	cmp    $0xa,%eax
+    16d7:	75 47                	jne    1720 <unlinkread+0x130>
+  close(fd);
+    16d9:	83 ec 0c             	sub    $0xc,%esp
+    16dc:	53                   	push   %ebx
+    16dd:	e8 f1 2e 00 00       	call   45d3 <close>
+  unlink("unlinkread");
+    16e2:	c7 04 24 55 51 00 00 	movl   $0x5155,(%esp)
+    16e9:	e8 67 2f 00 00       	call   4655 <unlink>
+  printf(1, "unlinkread ok\n");
+    16ee:	58                   	pop    %eax
+    16ef:	5a                   	pop    %edx
+    16f0:	68 fd 51 00 00       	push   $0x51fd
+    16f5:	6a 01                	push   $0x1
+    16f7:	e8 44 32 00 00       	call   4940 <printf>
+}
+    16fc:	83 c4 10             	add    $0x10,%esp
+    16ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1702:	5b                   	pop    %ebx
+    1703:	5e                   	pop    %esi
+    1704:	5d                   	pop    %ebp
+    1705:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1706:	51                   	push   %ecx
+    1707:	51                   	push   %ecx
+    1708:	68 60 51 00 00       	push   $0x5160
+    170d:	6a 01                	push   $0x1
+    170f:	e8 2c 32 00 00       	call   4940 <printf>
+    exit(1);
+    1714:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    171b:	e8 31 2e 00 00       	call   4551 <exit>
+    printf(1, "unlinkread write failed\n");
+    1720:	51                   	push   %ecx
+    1721:	51                   	push   %ecx
+    1722:	68 e4 51 00 00       	push   $0x51e4
+    1727:	6a 01                	push   $0x1
+    1729:	e8 12 32 00 00       	call   4940 <printf>
+    exit(1);
+    172e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1735:	e8 17 2e 00 00       	call   4551 <exit>
+    printf(1, "unlinkread wrong data\n");
+    173a:	53                   	push   %ebx
+    173b:	53                   	push   %ebx
+    173c:	68 cd 51 00 00       	push   $0x51cd
+    1741:	6a 01                	push   $0x1
+    1743:	e8 f8 31 00 00       	call   4940 <printf>
+    exit(1);
+    1748:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    174f:	e8 fd 2d 00 00       	call   4551 <exit>
+    printf(1, "unlinkread read failed");
+    1754:	56                   	push   %esi
+    1755:	56                   	push   %esi
+    1756:	68 b6 51 00 00       	push   $0x51b6
+    175b:	6a 01                	push   $0x1
+    175d:	e8 de 31 00 00       	call   4940 <printf>
+    exit(1);
+    1762:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1769:	e8 e3 2d 00 00       	call   4551 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    176e:	50                   	push   %eax
+    176f:	50                   	push   %eax
+    1770:	68 98 51 00 00       	push   $0x5198
+    1775:	6a 01                	push   $0x1
+    1777:	e8 c4 31 00 00       	call   4940 <printf>
+    exit(1);
+    177c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1783:	e8 c9 2d 00 00       	call   4551 <exit>
+    printf(1, "open unlinkread failed\n");
+    1788:	50                   	push   %eax
+    1789:	50                   	push   %eax
+    178a:	68 80 51 00 00       	push   $0x5180
+    178f:	6a 01                	push   $0x1
+    1791:	e8 aa 31 00 00       	call   4940 <printf>
+    exit(1);
+    1796:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    179d:	e8 af 2d 00 00       	call   4551 <exit>
+    17a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000017b0 <linktest>:
+{
+    17b0:	55                   	push   %ebp
+    17b1:	89 e5                	mov    %esp,%ebp
+    17b3:	53                   	push   %ebx
+    17b4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    17b7:	68 0c 52 00 00       	push   $0x520c
+    17bc:	6a 01                	push   $0x1
+    17be:	e8 7d 31 00 00       	call   4940 <printf>
+  unlink("lf1");
+    17c3:	c7 04 24 16 52 00 00 	movl   $0x5216,(%esp)
+    17ca:	e8 86 2e 00 00       	call   4655 <unlink>
+  unlink("lf2");
+    17cf:	c7 04 24 1a 52 00 00 	movl   $0x521a,(%esp)
+    17d6:	e8 7a 2e 00 00       	call   4655 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    17db:	58                   	pop    %eax
+    17dc:	5a                   	pop    %edx
+    17dd:	68 02 02 00 00       	push   $0x202
+    17e2:	68 16 52 00 00       	push   $0x5216
+    17e7:	e8 35 2e 00 00       	call   4621 <open>
+  if(fd < 0){
+    17ec:	83 c4 10             	add    $0x10,%esp
+    17ef:	85 c0                	test   %eax,%eax
+    17f1:	0f 88 1e 01 00 00    	js     1915 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    17f7:	83 ec 04             	sub    $0x4,%esp
+    17fa:	89 c3                	mov    %eax,%ebx
+    17fc:	6a 05                	push   $0x5
+    17fe:	68 7a 51 00 00       	push   $0x517a
+    1803:	50                   	push   %eax
+    1804:	e8 b0 2d 00 00       	call   45b9 <write>
+    1809:	83 c4 10             	add    $0x10,%esp
+    180c:	83 f8 05             	cmp    $0x5,%eax
+    180f:	0f 85 d0 01 00 00    	jne    19e5 <linktest+0x235>
+  close(fd);
+    1815:	83 ec 0c             	sub    $0xc,%esp
+    1818:	53                   	push   %ebx
+    1819:	e8 b5 2d 00 00       	call   45d3 <close>
+  if(link("lf1", "lf2") < 0){
+    181e:	5b                   	pop    %ebx
+    181f:	58                   	pop    %eax
+    1820:	68 1a 52 00 00       	push   $0x521a
+    1825:	68 16 52 00 00       	push   $0x5216
+    182a:	e8 5a 2e 00 00       	call   4689 <link>
+    182f:	83 c4 10             	add    $0x10,%esp
+    1832:	85 c0                	test   %eax,%eax
+    1834:	0f 88 91 01 00 00    	js     19cb <linktest+0x21b>
+  unlink("lf1");
+    183a:	83 ec 0c             	sub    $0xc,%esp
+    183d:	68 16 52 00 00       	push   $0x5216
+    1842:	e8 0e 2e 00 00       	call   4655 <unlink>
+  if(open("lf1", 0) >= 0){
+    1847:	58                   	pop    %eax
+    1848:	5a                   	pop    %edx
+    1849:	6a 00                	push   $0x0
+    184b:	68 16 52 00 00       	push   $0x5216
+    1850:	e8 cc 2d 00 00       	call   4621 <open>
+    1855:	83 c4 10             	add    $0x10,%esp
+    1858:	85 c0                	test   %eax,%eax
+    185a:	0f 89 51 01 00 00    	jns    19b1 <linktest+0x201>
+  fd = open("lf2", 0);
+    1860:	83 ec 08             	sub    $0x8,%esp
+    1863:	6a 00                	push   $0x0
+    1865:	68 1a 52 00 00       	push   $0x521a
+    186a:	e8 b2 2d 00 00       	call   4621 <open>
+  if(fd < 0){
+    186f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1872:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1874:	85 c0                	test   %eax,%eax
+    1876:	0f 88 1b 01 00 00    	js     1997 <linktest+0x1e7>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    187c:	83 ec 04             	sub    $0x4,%esp
+    187f:	68 00 20 00 00       	push   $0x2000
+    1884:	68 c0 98 00 00       	push   $0x98c0
+    1889:	50                   	push   %eax
+    188a:	e8 10 2d 00 00       	call   459f <read>
+    188f:	83 c4 10             	add    $0x10,%esp
+    1892:	83 f8 05             	cmp    $0x5,%eax
+    1895:	0f 85 e2 00 00 00    	jne    197d <linktest+0x1cd>
+  close(fd);
+    189b:	83 ec 0c             	sub    $0xc,%esp
+    189e:	53                   	push   %ebx
+    189f:	e8 2f 2d 00 00       	call   45d3 <close>
+  if(link("lf2", "lf2") >= 0){
+    18a4:	58                   	pop    %eax
+    18a5:	5a                   	pop    %edx
+    18a6:	68 1a 52 00 00       	push   $0x521a
+    18ab:	68 1a 52 00 00       	push   $0x521a
+    18b0:	e8 d4 2d 00 00       	call   4689 <link>
+    18b5:	83 c4 10             	add    $0x10,%esp
+    18b8:	85 c0                	test   %eax,%eax
+    18ba:	0f 89 a3 00 00 00    	jns    1963 <linktest+0x1b3>
+  unlink("lf2");
+    18c0:	83 ec 0c             	sub    $0xc,%esp
+    18c3:	68 1a 52 00 00       	push   $0x521a
+    18c8:	e8 88 2d 00 00       	call   4655 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    18cd:	59                   	pop    %ecx
+    18ce:	5b                   	pop    %ebx
+    18cf:	68 16 52 00 00       	push   $0x5216
+    18d4:	68 1a 52 00 00       	push   $0x521a
+    18d9:	e8 ab 2d 00 00       	call   4689 <link>
+    18de:	83 c4 10             	add    $0x10,%esp
+    18e1:	85 c0                	test   %eax,%eax
+    18e3:	79 64                	jns    1949 <linktest+0x199>
+  if(link(".", "lf1") >= 0){
+    18e5:	83 ec 08             	sub    $0x8,%esp
+    18e8:	68 16 52 00 00       	push   $0x5216
+    18ed:	68 de 54 00 00       	push   $0x54de
+    18f2:	e8 92 2d 00 00       	call   4689 <link>
+    18f7:	83 c4 10             	add    $0x10,%esp
+    18fa:	85 c0                	test   %eax,%eax
+    18fc:	79 31                	jns    192f <linktest+0x17f>
+  printf(1, "linktest ok\n");
+    18fe:	83 ec 08             	sub    $0x8,%esp
+    1901:	68 b4 52 00 00       	push   $0x52b4
+    1906:	6a 01                	push   $0x1
+    1908:	e8 33 30 00 00       	call   4940 <printf>
+}
+    190d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1910:	83 c4 10             	add    $0x10,%esp
+    1913:	c9                   	leave
+    1914:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1915:	50                   	push   %eax
+    1916:	50                   	push   %eax
+    1917:	68 1e 52 00 00       	push   $0x521e
+    191c:	6a 01                	push   $0x1
+    191e:	e8 1d 30 00 00       	call   4940 <printf>
+    exit(1);
+    1923:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    192a:	e8 22 2c 00 00       	call   4551 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    192f:	50                   	push   %eax
+    1930:	50                   	push   %eax
+    1931:	68 98 52 00 00       	push   $0x5298
+    1936:	6a 01                	push   $0x1
+    1938:	e8 03 30 00 00       	call   4940 <printf>
+    exit(1);
+    193d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1944:	e8 08 2c 00 00       	call   4551 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    1949:	52                   	push   %edx
+    194a:	52                   	push   %edx
+    194b:	68 50 5f 00 00       	push   $0x5f50
+    1950:	6a 01                	push   $0x1
+    1952:	e8 e9 2f 00 00       	call   4940 <printf>
+    exit(1);
+    1957:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    195e:	e8 ee 2b 00 00       	call   4551 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1963:	50                   	push   %eax
+    1964:	50                   	push   %eax
+    1965:	68 7a 52 00 00       	push   $0x527a
+    196a:	6a 01                	push   $0x1
+    196c:	e8 cf 2f 00 00       	call   4940 <printf>
+    exit(1);
+    1971:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1978:	e8 d4 2b 00 00       	call   4551 <exit>
+    printf(1, "read lf2 failed\n");
+    197d:	51                   	push   %ecx
+    197e:	51                   	push   %ecx
+    197f:	68 69 52 00 00       	push   $0x5269
+    1984:	6a 01                	push   $0x1
+    1986:	e8 b5 2f 00 00       	call   4940 <printf>
+    exit(1);
+    198b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1992:	e8 ba 2b 00 00       	call   4551 <exit>
+    printf(1, "open lf2 failed\n");
+    1997:	53                   	push   %ebx
+    1998:	53                   	push   %ebx
+    1999:	68 58 52 00 00       	push   $0x5258
+    199e:	6a 01                	push   $0x1
+    19a0:	e8 9b 2f 00 00       	call   4940 <printf>
+    exit(1);
+    19a5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    19ac:	e8 a0 2b 00 00       	call   4551 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    19b1:	50                   	push   %eax
+    19b2:	50                   	push   %eax
+    19b3:	68 28 5f 00 00       	push   $0x5f28
+    19b8:	6a 01                	push   $0x1
+    19ba:	e8 81 2f 00 00       	call   4940 <printf>
+    exit(1);
+    19bf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    19c6:	e8 86 2b 00 00       	call   4551 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    19cb:	51                   	push   %ecx
+    19cc:	51                   	push   %ecx
+    19cd:	68 43 52 00 00       	push   $0x5243
+    19d2:	6a 01                	push   $0x1
+    19d4:	e8 67 2f 00 00       	call   4940 <printf>
+    exit(1);
+    19d9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    19e0:	e8 6c 2b 00 00       	call   4551 <exit>
+    printf(1, "write lf1 failed\n");
+    19e5:	50                   	push   %eax
+    19e6:	50                   	push   %eax
+    19e7:	68 31 52 00 00       	push   $0x5231
+    19ec:	6a 01                	push   $0x1
+    19ee:	e8 4d 2f 00 00       	call   4940 <printf>
+    exit(1);
+    19f3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    19fa:	e8 52 2b 00 00       	call   4551 <exit>
+    19ff:	90                   	nop
+
+00001a00 <concreate>:
+{
+    1a00:	55                   	push   %ebp
+    1a01:	89 e5                	mov    %esp,%ebp
+    1a03:	57                   	push   %edi
+    1a04:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1a05:	31 f6                	xor    %esi,%esi
+{
+    1a07:	53                   	push   %ebx
+    1a08:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    1a0b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    1a0e:	68 c1 52 00 00       	push   $0x52c1
+    1a13:	6a 01                	push   $0x1
+    1a15:	e8 26 2f 00 00       	call   4940 <printf>
+  file[0] = 'C';
+    1a1a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    1a1e:	83 c4 10             	add    $0x10,%esp
+    1a21:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1a25:	eb 4c                	jmp    1a73 <concreate+0x73>
+    1a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a2e:	66 90                	xchg   %ax,%ax
+    1a30:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1a36:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    1a3b:	0f 83 97 00 00 00    	jae    1ad8 <concreate+0xd8>
+      fd = open(file, O_CREATE | O_RDWR);
+    1a41:	83 ec 08             	sub    $0x8,%esp
+    1a44:	68 02 02 00 00       	push   $0x202
+    1a49:	53                   	push   %ebx
+    1a4a:	e8 d2 2b 00 00       	call   4621 <open>
+      if(fd < 0){
+    1a4f:	83 c4 10             	add    $0x10,%esp
+    1a52:	85 c0                	test   %eax,%eax
+    1a54:	78 63                	js     1ab9 <concreate+0xb9>
+      close(fd);
+    1a56:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1a59:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    1a5c:	50                   	push   %eax
+    1a5d:	e8 71 2b 00 00       	call   45d3 <close>
+    1a62:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1a65:	e8 01 2b 00 00       	call   456b <wait>
+  for(i = 0; i < 40; i++){
+    1a6a:	83 fe 28             	cmp    $0x28,%esi
+    1a6d:	0f 84 87 00 00 00    	je     1afa <concreate+0xfa>
+    unlink(file);
+    1a73:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1a76:	8d 46 30             	lea    0x30(%esi),%eax
+    1a79:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    1a7c:	53                   	push   %ebx
+    1a7d:	e8 d3 2b 00 00       	call   4655 <unlink>
+    pid = fork();
+    1a82:	e8 b0 2a 00 00       	call   4537 <fork>
+    if(pid && (i % 3) == 1){
+    1a87:	83 c4 10             	add    $0x10,%esp
+    1a8a:	85 c0                	test   %eax,%eax
+    1a8c:	75 a2                	jne    1a30 <concreate+0x30>
+      link("C0", file);
+    1a8e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1a94:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    1a9a:	0f 83 e0 00 00 00    	jae    1b80 <concreate+0x180>
+      fd = open(file, O_CREATE | O_RDWR);
+    1aa0:	83 ec 08             	sub    $0x8,%esp
+    1aa3:	68 02 02 00 00       	push   $0x202
+    1aa8:	53                   	push   %ebx
+    1aa9:	e8 73 2b 00 00       	call   4621 <open>
+      if(fd < 0){
+    1aae:	83 c4 10             	add    $0x10,%esp
+    1ab1:	85 c0                	test   %eax,%eax
+    1ab3:	0f 89 01 02 00 00    	jns    1cba <concreate+0x2ba>
+        printf(1, "concreate create %s failed\n", file);
+    1ab9:	83 ec 04             	sub    $0x4,%esp
+    1abc:	53                   	push   %ebx
+    1abd:	68 d4 52 00 00       	push   $0x52d4
+    1ac2:	6a 01                	push   $0x1
+    1ac4:	e8 77 2e 00 00       	call   4940 <printf>
+        exit(1);
+    1ac9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1ad0:	e8 7c 2a 00 00       	call   4551 <exit>
+    1ad5:	8d 76 00             	lea    0x0(%esi),%esi
+      link("C0", file);
+    1ad8:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1adb:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1ade:	53                   	push   %ebx
+    1adf:	68 d1 52 00 00       	push   $0x52d1
+    1ae4:	e8 a0 2b 00 00       	call   4689 <link>
+    1ae9:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1aec:	e8 7a 2a 00 00       	call   456b <wait>
+  for(i = 0; i < 40; i++){
+    1af1:	83 fe 28             	cmp    $0x28,%esi
+    1af4:	0f 85 79 ff ff ff    	jne    1a73 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    1afa:	83 ec 04             	sub    $0x4,%esp
+    1afd:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1b00:	6a 28                	push   $0x28
+    1b02:	6a 00                	push   $0x0
+    1b04:	50                   	push   %eax
+    1b05:	e8 d6 27 00 00       	call   42e0 <memset>
+  fd = open(".", 0);
+    1b0a:	5e                   	pop    %esi
+    1b0b:	5f                   	pop    %edi
+    1b0c:	6a 00                	push   $0x0
+    1b0e:	68 de 54 00 00       	push   $0x54de
+    1b13:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    1b16:	e8 06 2b 00 00       	call   4621 <open>
+  n = 0;
+    1b1b:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1b22:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1b25:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b2e:	66 90                	xchg   %ax,%ax
+    1b30:	83 ec 04             	sub    $0x4,%esp
+    1b33:	6a 10                	push   $0x10
+    1b35:	57                   	push   %edi
+    1b36:	56                   	push   %esi
+    1b37:	e8 63 2a 00 00       	call   459f <read>
+    1b3c:	83 c4 10             	add    $0x10,%esp
+    1b3f:	85 c0                	test   %eax,%eax
+    1b41:	7e 5d                	jle    1ba0 <concreate+0x1a0>
+    if(de.inum == 0)
+    1b43:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1b48:	74 e6                	je     1b30 <concreate+0x130>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1b4a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    1b4e:	75 e0                	jne    1b30 <concreate+0x130>
+    1b50:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1b54:	75 da                	jne    1b30 <concreate+0x130>
+      i = de.name[1] - '0';
+    1b56:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    1b5a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1b5d:	83 f8 27             	cmp    $0x27,%eax
+    1b60:	0f 87 65 01 00 00    	ja     1ccb <concreate+0x2cb>
+      if(fa[i]){
+    1b66:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    1b6b:	0f 85 93 01 00 00    	jne    1d04 <concreate+0x304>
+      n++;
+    1b71:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1b75:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    1b7a:	eb b4                	jmp    1b30 <concreate+0x130>
+    1b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1b80:	83 ec 08             	sub    $0x8,%esp
+    1b83:	53                   	push   %ebx
+    1b84:	68 d1 52 00 00       	push   $0x52d1
+    1b89:	e8 fb 2a 00 00       	call   4689 <link>
+    1b8e:	83 c4 10             	add    $0x10,%esp
+      exit(0);
+    1b91:	83 ec 0c             	sub    $0xc,%esp
+    1b94:	6a 00                	push   $0x0
+    1b96:	e8 b6 29 00 00       	call   4551 <exit>
+    1b9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1b9f:	90                   	nop
+  close(fd);
+    1ba0:	83 ec 0c             	sub    $0xc,%esp
+    1ba3:	56                   	push   %esi
+    1ba4:	e8 2a 2a 00 00       	call   45d3 <close>
+  if(n != 40){
+    1ba9:	83 c4 10             	add    $0x10,%esp
+    1bac:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1bb0:	0f 85 34 01 00 00    	jne    1cea <concreate+0x2ea>
+  for(i = 0; i < 40; i++){
+    1bb6:	31 f6                	xor    %esi,%esi
+    1bb8:	eb 48                	jmp    1c02 <concreate+0x202>
+    1bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1bc0:	85 ff                	test   %edi,%edi
+    1bc2:	74 05                	je     1bc9 <concreate+0x1c9>
+    1bc4:	83 f8 01             	cmp    $0x1,%eax
+    1bc7:	74 68                	je     1c31 <concreate+0x231>
+      unlink(file);
+    1bc9:	83 ec 0c             	sub    $0xc,%esp
+    1bcc:	53                   	push   %ebx
+    1bcd:	e8 83 2a 00 00       	call   4655 <unlink>
+      unlink(file);
+    1bd2:	89 1c 24             	mov    %ebx,(%esp)
+    1bd5:	e8 7b 2a 00 00       	call   4655 <unlink>
+      unlink(file);
+    1bda:	89 1c 24             	mov    %ebx,(%esp)
+    1bdd:	e8 73 2a 00 00       	call   4655 <unlink>
+      unlink(file);
+    1be2:	89 1c 24             	mov    %ebx,(%esp)
+    1be5:	e8 6b 2a 00 00       	call   4655 <unlink>
+    1bea:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1bed:	85 ff                	test   %edi,%edi
+    1bef:	74 a0                	je     1b91 <concreate+0x191>
+      wait();
+    1bf1:	e8 75 29 00 00       	call   456b <wait>
+  for(i = 0; i < 40; i++){
+    1bf6:	83 c6 01             	add    $0x1,%esi
+    1bf9:	83 fe 28             	cmp    $0x28,%esi
+    1bfc:	0f 84 86 00 00 00    	je     1c88 <concreate+0x288>
+    file[1] = '0' + i;
+    1c02:	8d 46 30             	lea    0x30(%esi),%eax
+    1c05:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1c08:	e8 2a 29 00 00       	call   4537 <fork>
+    1c0d:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1c0f:	85 c0                	test   %eax,%eax
+    1c11:	0f 88 88 00 00 00    	js     1c9f <concreate+0x29f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1c17:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1c1c:	f7 e6                	mul    %esi
+    1c1e:	89 d0                	mov    %edx,%eax
+    1c20:	83 e2 fe             	and    $0xfffffffe,%edx
+    1c23:	d1 e8                	shr    %eax
+    1c25:	01 c2                	add    %eax,%edx
+    1c27:	89 f0                	mov    %esi,%eax
+    1c29:	29 d0                	sub    %edx,%eax
+    1c2b:	89 c1                	mov    %eax,%ecx
+    1c2d:	09 f9                	or     %edi,%ecx
+    1c2f:	75 8f                	jne    1bc0 <concreate+0x1c0>
+      close(open(file, 0));
+    1c31:	83 ec 08             	sub    $0x8,%esp
+    1c34:	6a 00                	push   $0x0
+    1c36:	53                   	push   %ebx
+    1c37:	e8 e5 29 00 00       	call   4621 <open>
+    1c3c:	89 04 24             	mov    %eax,(%esp)
+    1c3f:	e8 8f 29 00 00       	call   45d3 <close>
+      close(open(file, 0));
+    1c44:	58                   	pop    %eax
+    1c45:	5a                   	pop    %edx
+    1c46:	6a 00                	push   $0x0
+    1c48:	53                   	push   %ebx
+    1c49:	e8 d3 29 00 00       	call   4621 <open>
+    1c4e:	89 04 24             	mov    %eax,(%esp)
+    1c51:	e8 7d 29 00 00       	call   45d3 <close>
+      close(open(file, 0));
+    1c56:	59                   	pop    %ecx
+    1c57:	58                   	pop    %eax
+    1c58:	6a 00                	push   $0x0
+    1c5a:	53                   	push   %ebx
+    1c5b:	e8 c1 29 00 00       	call   4621 <open>
+    1c60:	89 04 24             	mov    %eax,(%esp)
+    1c63:	e8 6b 29 00 00       	call   45d3 <close>
+      close(open(file, 0));
+    1c68:	58                   	pop    %eax
+    1c69:	5a                   	pop    %edx
+    1c6a:	6a 00                	push   $0x0
+    1c6c:	53                   	push   %ebx
+    1c6d:	e8 af 29 00 00       	call   4621 <open>
+    1c72:	89 04 24             	mov    %eax,(%esp)
+    1c75:	e8 59 29 00 00       	call   45d3 <close>
+    1c7a:	83 c4 10             	add    $0x10,%esp
+    1c7d:	e9 6b ff ff ff       	jmp    1bed <concreate+0x1ed>
+    1c82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1c88:	83 ec 08             	sub    $0x8,%esp
+    1c8b:	68 26 53 00 00       	push   $0x5326
+    1c90:	6a 01                	push   $0x1
+    1c92:	e8 a9 2c 00 00       	call   4940 <printf>
+}
+    1c97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c9a:	5b                   	pop    %ebx
+    1c9b:	5e                   	pop    %esi
+    1c9c:	5f                   	pop    %edi
+    1c9d:	5d                   	pop    %ebp
+    1c9e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1c9f:	83 ec 08             	sub    $0x8,%esp
+    1ca2:	68 ad 5c 00 00       	push   $0x5cad
+    1ca7:	6a 01                	push   $0x1
+    1ca9:	e8 92 2c 00 00       	call   4940 <printf>
+      exit(1);
+    1cae:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1cb5:	e8 97 28 00 00       	call   4551 <exit>
+      close(fd);
+    1cba:	83 ec 0c             	sub    $0xc,%esp
+    1cbd:	50                   	push   %eax
+    1cbe:	e8 10 29 00 00       	call   45d3 <close>
+    1cc3:	83 c4 10             	add    $0x10,%esp
+    1cc6:	e9 c6 fe ff ff       	jmp    1b91 <concreate+0x191>
+        printf(1, "concreate weird file %s\n", de.name);
+    1ccb:	83 ec 04             	sub    $0x4,%esp
+    1cce:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1cd1:	50                   	push   %eax
+    1cd2:	68 f0 52 00 00       	push   $0x52f0
+    1cd7:	6a 01                	push   $0x1
+    1cd9:	e8 62 2c 00 00       	call   4940 <printf>
+        exit(1);
+    1cde:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1ce5:	e8 67 28 00 00       	call   4551 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1cea:	51                   	push   %ecx
+    1ceb:	51                   	push   %ecx
+    1cec:	68 74 5f 00 00       	push   $0x5f74
+    1cf1:	6a 01                	push   $0x1
+    1cf3:	e8 48 2c 00 00       	call   4940 <printf>
+    exit(1);
+    1cf8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1cff:	e8 4d 28 00 00       	call   4551 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1d04:	83 ec 04             	sub    $0x4,%esp
+    1d07:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1d0a:	50                   	push   %eax
+    1d0b:	68 09 53 00 00       	push   $0x5309
+    1d10:	6a 01                	push   $0x1
+    1d12:	e8 29 2c 00 00       	call   4940 <printf>
+        exit(1);
+    1d17:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1d1e:	e8 2e 28 00 00       	call   4551 <exit>
+    1d23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001d30 <linkunlink>:
+{
+    1d30:	55                   	push   %ebp
+    1d31:	89 e5                	mov    %esp,%ebp
+    1d33:	57                   	push   %edi
+    1d34:	56                   	push   %esi
+    1d35:	53                   	push   %ebx
+    1d36:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1d39:	68 34 53 00 00       	push   $0x5334
+    1d3e:	6a 01                	push   $0x1
+    1d40:	e8 fb 2b 00 00       	call   4940 <printf>
+  unlink("x");
+    1d45:	c7 04 24 c1 55 00 00 	movl   $0x55c1,(%esp)
+    1d4c:	e8 04 29 00 00       	call   4655 <unlink>
+  pid = fork();
+    1d51:	e8 e1 27 00 00       	call   4537 <fork>
+  if(pid < 0){
+    1d56:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1d59:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1d5c:	85 c0                	test   %eax,%eax
+    1d5e:	0f 88 b6 00 00 00    	js     1e1a <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1d64:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1d68:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1d6d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1d72:	19 ff                	sbb    %edi,%edi
+    1d74:	83 e7 60             	and    $0x60,%edi
+    1d77:	83 c7 01             	add    $0x1,%edi
+    1d7a:	eb 1e                	jmp    1d9a <linkunlink+0x6a>
+    1d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1d80:	83 f8 01             	cmp    $0x1,%eax
+    1d83:	74 7b                	je     1e00 <linkunlink+0xd0>
+      unlink("x");
+    1d85:	83 ec 0c             	sub    $0xc,%esp
+    1d88:	68 c1 55 00 00       	push   $0x55c1
+    1d8d:	e8 c3 28 00 00       	call   4655 <unlink>
+    1d92:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1d95:	83 eb 01             	sub    $0x1,%ebx
+    1d98:	74 41                	je     1ddb <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1d9a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1da0:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1da6:	89 f8                	mov    %edi,%eax
+    1da8:	f7 e6                	mul    %esi
+    1daa:	89 d0                	mov    %edx,%eax
+    1dac:	83 e2 fe             	and    $0xfffffffe,%edx
+    1daf:	d1 e8                	shr    %eax
+    1db1:	01 c2                	add    %eax,%edx
+    1db3:	89 f8                	mov    %edi,%eax
+    1db5:	29 d0                	sub    %edx,%eax
+    1db7:	75 c7                	jne    1d80 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1db9:	83 ec 08             	sub    $0x8,%esp
+    1dbc:	68 02 02 00 00       	push   $0x202
+    1dc1:	68 c1 55 00 00       	push   $0x55c1
+    1dc6:	e8 56 28 00 00       	call   4621 <open>
+    1dcb:	89 04 24             	mov    %eax,(%esp)
+    1dce:	e8 00 28 00 00       	call   45d3 <close>
+    1dd3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1dd6:	83 eb 01             	sub    $0x1,%ebx
+    1dd9:	75 bf                	jne    1d9a <linkunlink+0x6a>
+  if(pid)
+    1ddb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1dde:	85 c0                	test   %eax,%eax
+    1de0:	74 52                	je     1e34 <linkunlink+0x104>
+    wait();
+    1de2:	e8 84 27 00 00       	call   456b <wait>
+  printf(1, "linkunlink ok\n");
+    1de7:	83 ec 08             	sub    $0x8,%esp
+    1dea:	68 49 53 00 00       	push   $0x5349
+    1def:	6a 01                	push   $0x1
+    1df1:	e8 4a 2b 00 00       	call   4940 <printf>
+}
+    1df6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1df9:	5b                   	pop    %ebx
+    1dfa:	5e                   	pop    %esi
+    1dfb:	5f                   	pop    %edi
+    1dfc:	5d                   	pop    %ebp
+    1dfd:	c3                   	ret
+    1dfe:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1e00:	83 ec 08             	sub    $0x8,%esp
+    1e03:	68 c1 55 00 00       	push   $0x55c1
+    1e08:	68 45 53 00 00       	push   $0x5345
+    1e0d:	e8 77 28 00 00       	call   4689 <link>
+    1e12:	83 c4 10             	add    $0x10,%esp
+    1e15:	e9 7b ff ff ff       	jmp    1d95 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1e1a:	52                   	push   %edx
+    1e1b:	52                   	push   %edx
+    1e1c:	68 ad 5c 00 00       	push   $0x5cad
+    1e21:	6a 01                	push   $0x1
+    1e23:	e8 18 2b 00 00       	call   4940 <printf>
+    exit(1);
+    1e28:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1e2f:	e8 1d 27 00 00       	call   4551 <exit>
+    exit(0);
+    1e34:	83 ec 0c             	sub    $0xc,%esp
+    1e37:	6a 00                	push   $0x0
+    1e39:	e8 13 27 00 00       	call   4551 <exit>
+    1e3e:	66 90                	xchg   %ax,%ax
+
+00001e40 <bigdir>:
+{
+    1e40:	55                   	push   %ebp
+    1e41:	89 e5                	mov    %esp,%ebp
+    1e43:	57                   	push   %edi
+    1e44:	56                   	push   %esi
+    1e45:	53                   	push   %ebx
+    1e46:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1e49:	68 58 53 00 00       	push   $0x5358
+    1e4e:	6a 01                	push   $0x1
+    1e50:	e8 eb 2a 00 00       	call   4940 <printf>
+  unlink("bd");
+    1e55:	c7 04 24 65 53 00 00 	movl   $0x5365,(%esp)
+    1e5c:	e8 f4 27 00 00       	call   4655 <unlink>
+  fd = open("bd", O_CREATE);
+    1e61:	5a                   	pop    %edx
+    1e62:	59                   	pop    %ecx
+    1e63:	68 00 02 00 00       	push   $0x200
+    1e68:	68 65 53 00 00       	push   $0x5365
+    1e6d:	e8 af 27 00 00       	call   4621 <open>
+  if(fd < 0){
+    1e72:	83 c4 10             	add    $0x10,%esp
+    1e75:	85 c0                	test   %eax,%eax
+    1e77:	0f 88 ec 00 00 00    	js     1f69 <bigdir+0x129>
+  close(fd);
+    1e7d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1e80:	31 f6                	xor    %esi,%esi
+    1e82:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1e85:	50                   	push   %eax
+    1e86:	e8 48 27 00 00       	call   45d3 <close>
+    1e8b:	83 c4 10             	add    $0x10,%esp
+    1e8e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1e90:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1e92:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1e95:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1e99:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1e9c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1ea0:	83 c0 30             	add    $0x30,%eax
+    1ea3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1ea6:	89 f0                	mov    %esi,%eax
+    1ea8:	83 e0 3f             	and    $0x3f,%eax
+    1eab:	83 c0 30             	add    $0x30,%eax
+    1eae:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1eb1:	57                   	push   %edi
+    1eb2:	68 65 53 00 00       	push   $0x5365
+    1eb7:	e8 cd 27 00 00       	call   4689 <link>
+    1ebc:	83 c4 10             	add    $0x10,%esp
+    1ebf:	89 c3                	mov    %eax,%ebx
+    1ec1:	85 c0                	test   %eax,%eax
+    1ec3:	75 6e                	jne    1f33 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1ec5:	83 c6 01             	add    $0x1,%esi
+    1ec8:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1ece:	75 c0                	jne    1e90 <bigdir+0x50>
+  unlink("bd");
+    1ed0:	83 ec 0c             	sub    $0xc,%esp
+    1ed3:	68 65 53 00 00       	push   $0x5365
+    1ed8:	e8 78 27 00 00       	call   4655 <unlink>
+    1edd:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1ee0:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1ee2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1ee5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1ee9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1eec:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1ef0:	83 c0 30             	add    $0x30,%eax
+    1ef3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1ef6:	89 d8                	mov    %ebx,%eax
+    1ef8:	83 e0 3f             	and    $0x3f,%eax
+    1efb:	83 c0 30             	add    $0x30,%eax
+    1efe:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1f01:	57                   	push   %edi
+    1f02:	e8 4e 27 00 00       	call   4655 <unlink>
+    1f07:	83 c4 10             	add    $0x10,%esp
+    1f0a:	85 c0                	test   %eax,%eax
+    1f0c:	75 40                	jne    1f4e <bigdir+0x10e>
+  for(i = 0; i < 500; i++){
+    1f0e:	83 c3 01             	add    $0x1,%ebx
+    1f11:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1f17:	75 c7                	jne    1ee0 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1f19:	83 ec 08             	sub    $0x8,%esp
+    1f1c:	68 a7 53 00 00       	push   $0x53a7
+    1f21:	6a 01                	push   $0x1
+    1f23:	e8 18 2a 00 00       	call   4940 <printf>
+    1f28:	83 c4 10             	add    $0x10,%esp
+}
+    1f2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f2e:	5b                   	pop    %ebx
+    1f2f:	5e                   	pop    %esi
+    1f30:	5f                   	pop    %edi
+    1f31:	5d                   	pop    %ebp
+    1f32:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1f33:	83 ec 08             	sub    $0x8,%esp
+    1f36:	68 7e 53 00 00       	push   $0x537e
+    1f3b:	6a 01                	push   $0x1
+    1f3d:	e8 fe 29 00 00       	call   4940 <printf>
+      exit(1);
+    1f42:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1f49:	e8 03 26 00 00       	call   4551 <exit>
+      printf(1, "bigdir unlink failed");
+    1f4e:	83 ec 08             	sub    $0x8,%esp
+    1f51:	68 92 53 00 00       	push   $0x5392
+    1f56:	6a 01                	push   $0x1
+    1f58:	e8 e3 29 00 00       	call   4940 <printf>
+      exit(1);
+    1f5d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1f64:	e8 e8 25 00 00       	call   4551 <exit>
+    printf(1, "bigdir create failed\n");
+    1f69:	50                   	push   %eax
+    1f6a:	50                   	push   %eax
+    1f6b:	68 68 53 00 00       	push   $0x5368
+    1f70:	6a 01                	push   $0x1
+    1f72:	e8 c9 29 00 00       	call   4940 <printf>
+    exit(1);
+    1f77:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1f7e:	e8 ce 25 00 00       	call   4551 <exit>
+    1f83:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001f90 <subdir>:
+{
+    1f90:	55                   	push   %ebp
+    1f91:	89 e5                	mov    %esp,%ebp
+    1f93:	53                   	push   %ebx
+    1f94:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1f97:	68 b2 53 00 00       	push   $0x53b2
+    1f9c:	6a 01                	push   $0x1
+    1f9e:	e8 9d 29 00 00       	call   4940 <printf>
+  unlink("ff");
+    1fa3:	c7 04 24 3b 54 00 00 	movl   $0x543b,(%esp)
+    1faa:	e8 a6 26 00 00       	call   4655 <unlink>
+  if(mkdir("dd") != 0){
+    1faf:	c7 04 24 d8 54 00 00 	movl   $0x54d8,(%esp)
+    1fb6:	e8 e8 26 00 00       	call   46a3 <mkdir>
+    1fbb:	83 c4 10             	add    $0x10,%esp
+    1fbe:	85 c0                	test   %eax,%eax
+    1fc0:	0f 85 4d 06 00 00    	jne    2613 <subdir+0x683>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1fc6:	83 ec 08             	sub    $0x8,%esp
+    1fc9:	68 02 02 00 00       	push   $0x202
+    1fce:	68 11 54 00 00       	push   $0x5411
+    1fd3:	e8 49 26 00 00       	call   4621 <open>
+  if(fd < 0){
+    1fd8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1fdb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1fdd:	85 c0                	test   %eax,%eax
+    1fdf:	0f 88 14 06 00 00    	js     25f9 <subdir+0x669>
+  write(fd, "ff", 2);
+    1fe5:	83 ec 04             	sub    $0x4,%esp
+    1fe8:	6a 02                	push   $0x2
+    1fea:	68 3b 54 00 00       	push   $0x543b
+    1fef:	50                   	push   %eax
+    1ff0:	e8 c4 25 00 00       	call   45b9 <write>
+  close(fd);
+    1ff5:	89 1c 24             	mov    %ebx,(%esp)
+    1ff8:	e8 d6 25 00 00       	call   45d3 <close>
+  if(unlink("dd") >= 0){
+    1ffd:	c7 04 24 d8 54 00 00 	movl   $0x54d8,(%esp)
+    2004:	e8 4c 26 00 00       	call   4655 <unlink>
+    2009:	83 c4 10             	add    $0x10,%esp
+    200c:	85 c0                	test   %eax,%eax
+    200e:	0f 89 cb 05 00 00    	jns    25df <subdir+0x64f>
+  if(mkdir("/dd/dd") != 0){
+    2014:	83 ec 0c             	sub    $0xc,%esp
+    2017:	68 ec 53 00 00       	push   $0x53ec
+    201c:	e8 82 26 00 00       	call   46a3 <mkdir>
+    2021:	83 c4 10             	add    $0x10,%esp
+    2024:	85 c0                	test   %eax,%eax
+    2026:	0f 85 99 05 00 00    	jne    25c5 <subdir+0x635>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    202c:	83 ec 08             	sub    $0x8,%esp
+    202f:	68 02 02 00 00       	push   $0x202
+    2034:	68 0e 54 00 00       	push   $0x540e
+    2039:	e8 e3 25 00 00       	call   4621 <open>
+  if(fd < 0){
+    203e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2041:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2043:	85 c0                	test   %eax,%eax
+    2045:	0f 88 5c 04 00 00    	js     24a7 <subdir+0x517>
+  write(fd, "FF", 2);
+    204b:	83 ec 04             	sub    $0x4,%esp
+    204e:	6a 02                	push   $0x2
+    2050:	68 2f 54 00 00       	push   $0x542f
+    2055:	50                   	push   %eax
+    2056:	e8 5e 25 00 00       	call   45b9 <write>
+  close(fd);
+    205b:	89 1c 24             	mov    %ebx,(%esp)
+    205e:	e8 70 25 00 00       	call   45d3 <close>
+  fd = open("dd/dd/../ff", 0);
+    2063:	58                   	pop    %eax
+    2064:	5a                   	pop    %edx
+    2065:	6a 00                	push   $0x0
+    2067:	68 32 54 00 00       	push   $0x5432
+    206c:	e8 b0 25 00 00       	call   4621 <open>
+  if(fd < 0){
+    2071:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    2074:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2076:	85 c0                	test   %eax,%eax
+    2078:	0f 88 0f 04 00 00    	js     248d <subdir+0x4fd>
+  cc = read(fd, buf, sizeof(buf));
+    207e:	83 ec 04             	sub    $0x4,%esp
+    2081:	68 00 20 00 00       	push   $0x2000
+    2086:	68 c0 98 00 00       	push   $0x98c0
+    208b:	50                   	push   %eax
+    208c:	e8 0e 25 00 00       	call   459f <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2091:	83 c4 10             	add    $0x10,%esp
+    2094:	83 f8 02             	cmp    $0x2,%eax
+    2097:	0f 85 3a 03 00 00    	jne    23d7 <subdir+0x447>
+    209d:	80 3d c0 98 00 00 66 	cmpb   $0x66,0x98c0
+    20a4:	0f 85 2d 03 00 00    	jne    23d7 <subdir+0x447>
+  close(fd);
+    20aa:	83 ec 0c             	sub    $0xc,%esp
+    20ad:	53                   	push   %ebx
+    20ae:	e8 20 25 00 00       	call   45d3 <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    20b3:	59                   	pop    %ecx
+    20b4:	5b                   	pop    %ebx
+    20b5:	68 72 54 00 00       	push   $0x5472
+    20ba:	68 0e 54 00 00       	push   $0x540e
+    20bf:	e8 c5 25 00 00       	call   4689 <link>
+    20c4:	83 c4 10             	add    $0x10,%esp
+    20c7:	85 c0                	test   %eax,%eax
+    20c9:	0f 85 0c 04 00 00    	jne    24db <subdir+0x54b>
+  if(unlink("dd/dd/ff") != 0){
+    20cf:	83 ec 0c             	sub    $0xc,%esp
+    20d2:	68 0e 54 00 00       	push   $0x540e
+    20d7:	e8 79 25 00 00       	call   4655 <unlink>
+    20dc:	83 c4 10             	add    $0x10,%esp
+    20df:	85 c0                	test   %eax,%eax
+    20e1:	0f 85 24 03 00 00    	jne    240b <subdir+0x47b>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    20e7:	83 ec 08             	sub    $0x8,%esp
+    20ea:	6a 00                	push   $0x0
+    20ec:	68 0e 54 00 00       	push   $0x540e
+    20f1:	e8 2b 25 00 00       	call   4621 <open>
+    20f6:	83 c4 10             	add    $0x10,%esp
+    20f9:	85 c0                	test   %eax,%eax
+    20fb:	0f 89 aa 04 00 00    	jns    25ab <subdir+0x61b>
+  if(chdir("dd") != 0){
+    2101:	83 ec 0c             	sub    $0xc,%esp
+    2104:	68 d8 54 00 00       	push   $0x54d8
+    2109:	e8 af 25 00 00       	call   46bd <chdir>
+    210e:	83 c4 10             	add    $0x10,%esp
+    2111:	85 c0                	test   %eax,%eax
+    2113:	0f 85 78 04 00 00    	jne    2591 <subdir+0x601>
+  if(chdir("dd/../../dd") != 0){
+    2119:	83 ec 0c             	sub    $0xc,%esp
+    211c:	68 a6 54 00 00       	push   $0x54a6
+    2121:	e8 97 25 00 00       	call   46bd <chdir>
+    2126:	83 c4 10             	add    $0x10,%esp
+    2129:	85 c0                	test   %eax,%eax
+    212b:	0f 85 c0 02 00 00    	jne    23f1 <subdir+0x461>
+  if(chdir("dd/../../../dd") != 0){
+    2131:	83 ec 0c             	sub    $0xc,%esp
+    2134:	68 cc 54 00 00       	push   $0x54cc
+    2139:	e8 7f 25 00 00       	call   46bd <chdir>
+    213e:	83 c4 10             	add    $0x10,%esp
+    2141:	85 c0                	test   %eax,%eax
+    2143:	0f 85 a8 02 00 00    	jne    23f1 <subdir+0x461>
+  if(chdir("./..") != 0){
+    2149:	83 ec 0c             	sub    $0xc,%esp
+    214c:	68 db 54 00 00       	push   $0x54db
+    2151:	e8 67 25 00 00       	call   46bd <chdir>
+    2156:	83 c4 10             	add    $0x10,%esp
+    2159:	85 c0                	test   %eax,%eax
+    215b:	0f 85 60 03 00 00    	jne    24c1 <subdir+0x531>
+  fd = open("dd/dd/ffff", 0);
+    2161:	83 ec 08             	sub    $0x8,%esp
+    2164:	6a 00                	push   $0x0
+    2166:	68 72 54 00 00       	push   $0x5472
+    216b:	e8 b1 24 00 00       	call   4621 <open>
+  if(fd < 0){
+    2170:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2173:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2175:	85 c0                	test   %eax,%eax
+    2177:	0f 88 ce 05 00 00    	js     274b <subdir+0x7bb>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    217d:	83 ec 04             	sub    $0x4,%esp
+    2180:	68 00 20 00 00       	push   $0x2000
+    2185:	68 c0 98 00 00       	push   $0x98c0
+    218a:	50                   	push   %eax
+    218b:	e8 0f 24 00 00       	call   459f <read>
+    2190:	83 c4 10             	add    $0x10,%esp
+    2193:	83 f8 02             	cmp    $0x2,%eax
+    2196:	0f 85 95 05 00 00    	jne    2731 <subdir+0x7a1>
+  close(fd);
+    219c:	83 ec 0c             	sub    $0xc,%esp
+    219f:	53                   	push   %ebx
+    21a0:	e8 2e 24 00 00       	call   45d3 <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    21a5:	58                   	pop    %eax
+    21a6:	5a                   	pop    %edx
+    21a7:	6a 00                	push   $0x0
+    21a9:	68 0e 54 00 00       	push   $0x540e
+    21ae:	e8 6e 24 00 00       	call   4621 <open>
+    21b3:	83 c4 10             	add    $0x10,%esp
+    21b6:	85 c0                	test   %eax,%eax
+    21b8:	0f 89 81 02 00 00    	jns    243f <subdir+0x4af>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    21be:	83 ec 08             	sub    $0x8,%esp
+    21c1:	68 02 02 00 00       	push   $0x202
+    21c6:	68 26 55 00 00       	push   $0x5526
+    21cb:	e8 51 24 00 00       	call   4621 <open>
+    21d0:	83 c4 10             	add    $0x10,%esp
+    21d3:	85 c0                	test   %eax,%eax
+    21d5:	0f 89 4a 02 00 00    	jns    2425 <subdir+0x495>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    21db:	83 ec 08             	sub    $0x8,%esp
+    21de:	68 02 02 00 00       	push   $0x202
+    21e3:	68 4b 55 00 00       	push   $0x554b
+    21e8:	e8 34 24 00 00       	call   4621 <open>
+    21ed:	83 c4 10             	add    $0x10,%esp
+    21f0:	85 c0                	test   %eax,%eax
+    21f2:	0f 89 7f 03 00 00    	jns    2577 <subdir+0x5e7>
+  if(open("dd", O_CREATE) >= 0){
+    21f8:	83 ec 08             	sub    $0x8,%esp
+    21fb:	68 00 02 00 00       	push   $0x200
+    2200:	68 d8 54 00 00       	push   $0x54d8
+    2205:	e8 17 24 00 00       	call   4621 <open>
+    220a:	83 c4 10             	add    $0x10,%esp
+    220d:	85 c0                	test   %eax,%eax
+    220f:	0f 89 48 03 00 00    	jns    255d <subdir+0x5cd>
+  if(open("dd", O_RDWR) >= 0){
+    2215:	83 ec 08             	sub    $0x8,%esp
+    2218:	6a 02                	push   $0x2
+    221a:	68 d8 54 00 00       	push   $0x54d8
+    221f:	e8 fd 23 00 00       	call   4621 <open>
+    2224:	83 c4 10             	add    $0x10,%esp
+    2227:	85 c0                	test   %eax,%eax
+    2229:	0f 89 14 03 00 00    	jns    2543 <subdir+0x5b3>
+  if(open("dd", O_WRONLY) >= 0){
+    222f:	83 ec 08             	sub    $0x8,%esp
+    2232:	6a 01                	push   $0x1
+    2234:	68 d8 54 00 00       	push   $0x54d8
+    2239:	e8 e3 23 00 00       	call   4621 <open>
+    223e:	83 c4 10             	add    $0x10,%esp
+    2241:	85 c0                	test   %eax,%eax
+    2243:	0f 89 e0 02 00 00    	jns    2529 <subdir+0x599>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2249:	83 ec 08             	sub    $0x8,%esp
+    224c:	68 ba 55 00 00       	push   $0x55ba
+    2251:	68 26 55 00 00       	push   $0x5526
+    2256:	e8 2e 24 00 00       	call   4689 <link>
+    225b:	83 c4 10             	add    $0x10,%esp
+    225e:	85 c0                	test   %eax,%eax
+    2260:	0f 84 a9 02 00 00    	je     250f <subdir+0x57f>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2266:	83 ec 08             	sub    $0x8,%esp
+    2269:	68 ba 55 00 00       	push   $0x55ba
+    226e:	68 4b 55 00 00       	push   $0x554b
+    2273:	e8 11 24 00 00       	call   4689 <link>
+    2278:	83 c4 10             	add    $0x10,%esp
+    227b:	85 c0                	test   %eax,%eax
+    227d:	0f 84 72 02 00 00    	je     24f5 <subdir+0x565>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2283:	83 ec 08             	sub    $0x8,%esp
+    2286:	68 72 54 00 00       	push   $0x5472
+    228b:	68 11 54 00 00       	push   $0x5411
+    2290:	e8 f4 23 00 00       	call   4689 <link>
+    2295:	83 c4 10             	add    $0x10,%esp
+    2298:	85 c0                	test   %eax,%eax
+    229a:	0f 84 d3 01 00 00    	je     2473 <subdir+0x4e3>
+  if(mkdir("dd/ff/ff") == 0){
+    22a0:	83 ec 0c             	sub    $0xc,%esp
+    22a3:	68 26 55 00 00       	push   $0x5526
+    22a8:	e8 f6 23 00 00       	call   46a3 <mkdir>
+    22ad:	83 c4 10             	add    $0x10,%esp
+    22b0:	85 c0                	test   %eax,%eax
+    22b2:	0f 84 a1 01 00 00    	je     2459 <subdir+0x4c9>
+  if(mkdir("dd/xx/ff") == 0){
+    22b8:	83 ec 0c             	sub    $0xc,%esp
+    22bb:	68 4b 55 00 00       	push   $0x554b
+    22c0:	e8 de 23 00 00       	call   46a3 <mkdir>
+    22c5:	83 c4 10             	add    $0x10,%esp
+    22c8:	85 c0                	test   %eax,%eax
+    22ca:	0f 84 47 04 00 00    	je     2717 <subdir+0x787>
+  if(mkdir("dd/dd/ffff") == 0){
+    22d0:	83 ec 0c             	sub    $0xc,%esp
+    22d3:	68 72 54 00 00       	push   $0x5472
+    22d8:	e8 c6 23 00 00       	call   46a3 <mkdir>
+    22dd:	83 c4 10             	add    $0x10,%esp
+    22e0:	85 c0                	test   %eax,%eax
+    22e2:	0f 84 15 04 00 00    	je     26fd <subdir+0x76d>
+  if(unlink("dd/xx/ff") == 0){
+    22e8:	83 ec 0c             	sub    $0xc,%esp
+    22eb:	68 4b 55 00 00       	push   $0x554b
+    22f0:	e8 60 23 00 00       	call   4655 <unlink>
+    22f5:	83 c4 10             	add    $0x10,%esp
+    22f8:	85 c0                	test   %eax,%eax
+    22fa:	0f 84 e3 03 00 00    	je     26e3 <subdir+0x753>
+  if(unlink("dd/ff/ff") == 0){
+    2300:	83 ec 0c             	sub    $0xc,%esp
+    2303:	68 26 55 00 00       	push   $0x5526
+    2308:	e8 48 23 00 00       	call   4655 <unlink>
+    230d:	83 c4 10             	add    $0x10,%esp
+    2310:	85 c0                	test   %eax,%eax
+    2312:	0f 84 b1 03 00 00    	je     26c9 <subdir+0x739>
+  if(chdir("dd/ff") == 0){
+    2318:	83 ec 0c             	sub    $0xc,%esp
+    231b:	68 11 54 00 00       	push   $0x5411
+    2320:	e8 98 23 00 00       	call   46bd <chdir>
+    2325:	83 c4 10             	add    $0x10,%esp
+    2328:	85 c0                	test   %eax,%eax
+    232a:	0f 84 7f 03 00 00    	je     26af <subdir+0x71f>
+  if(chdir("dd/xx") == 0){
+    2330:	83 ec 0c             	sub    $0xc,%esp
+    2333:	68 bd 55 00 00       	push   $0x55bd
+    2338:	e8 80 23 00 00       	call   46bd <chdir>
+    233d:	83 c4 10             	add    $0x10,%esp
+    2340:	85 c0                	test   %eax,%eax
+    2342:	0f 84 4d 03 00 00    	je     2695 <subdir+0x705>
+  if(unlink("dd/dd/ffff") != 0){
+    2348:	83 ec 0c             	sub    $0xc,%esp
+    234b:	68 72 54 00 00       	push   $0x5472
+    2350:	e8 00 23 00 00       	call   4655 <unlink>
+    2355:	83 c4 10             	add    $0x10,%esp
+    2358:	85 c0                	test   %eax,%eax
+    235a:	0f 85 ab 00 00 00    	jne    240b <subdir+0x47b>
+  if(unlink("dd/ff") != 0){
+    2360:	83 ec 0c             	sub    $0xc,%esp
+    2363:	68 11 54 00 00       	push   $0x5411
+    2368:	e8 e8 22 00 00       	call   4655 <unlink>
+    236d:	83 c4 10             	add    $0x10,%esp
+    2370:	85 c0                	test   %eax,%eax
+    2372:	0f 85 03 03 00 00    	jne    267b <subdir+0x6eb>
+  if(unlink("dd") == 0){
+    2378:	83 ec 0c             	sub    $0xc,%esp
+    237b:	68 d8 54 00 00       	push   $0x54d8
+    2380:	e8 d0 22 00 00       	call   4655 <unlink>
+    2385:	83 c4 10             	add    $0x10,%esp
+    2388:	85 c0                	test   %eax,%eax
+    238a:	0f 84 d1 02 00 00    	je     2661 <subdir+0x6d1>
+  if(unlink("dd/dd") < 0){
+    2390:	83 ec 0c             	sub    $0xc,%esp
+    2393:	68 ed 53 00 00       	push   $0x53ed
+    2398:	e8 b8 22 00 00       	call   4655 <unlink>
+    239d:	83 c4 10             	add    $0x10,%esp
+    23a0:	85 c0                	test   %eax,%eax
+    23a2:	0f 88 9f 02 00 00    	js     2647 <subdir+0x6b7>
+  if(unlink("dd") < 0){
+    23a8:	83 ec 0c             	sub    $0xc,%esp
+    23ab:	68 d8 54 00 00       	push   $0x54d8
+    23b0:	e8 a0 22 00 00       	call   4655 <unlink>
+    23b5:	83 c4 10             	add    $0x10,%esp
+    23b8:	85 c0                	test   %eax,%eax
+    23ba:	0f 88 6d 02 00 00    	js     262d <subdir+0x69d>
+  printf(1, "subdir ok\n");
+    23c0:	83 ec 08             	sub    $0x8,%esp
+    23c3:	68 ba 56 00 00       	push   $0x56ba
+    23c8:	6a 01                	push   $0x1
+    23ca:	e8 71 25 00 00       	call   4940 <printf>
+}
+    23cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    23d2:	83 c4 10             	add    $0x10,%esp
+    23d5:	c9                   	leave
+    23d6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    23d7:	50                   	push   %eax
+    23d8:	50                   	push   %eax
+    23d9:	68 57 54 00 00       	push   $0x5457
+    23de:	6a 01                	push   $0x1
+    23e0:	e8 5b 25 00 00       	call   4940 <printf>
+    exit(1);
+    23e5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    23ec:	e8 60 21 00 00       	call   4551 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    23f1:	50                   	push   %eax
+    23f2:	50                   	push   %eax
+    23f3:	68 b2 54 00 00       	push   $0x54b2
+    23f8:	6a 01                	push   $0x1
+    23fa:	e8 41 25 00 00       	call   4940 <printf>
+    exit(1);
+    23ff:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2406:	e8 46 21 00 00       	call   4551 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    240b:	50                   	push   %eax
+    240c:	50                   	push   %eax
+    240d:	68 7d 54 00 00       	push   $0x547d
+    2412:	6a 01                	push   $0x1
+    2414:	e8 27 25 00 00       	call   4940 <printf>
+    exit(1);
+    2419:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2420:	e8 2c 21 00 00       	call   4551 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2425:	51                   	push   %ecx
+    2426:	51                   	push   %ecx
+    2427:	68 2f 55 00 00       	push   $0x552f
+    242c:	6a 01                	push   $0x1
+    242e:	e8 0d 25 00 00       	call   4940 <printf>
+    exit(1);
+    2433:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    243a:	e8 12 21 00 00       	call   4551 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    243f:	53                   	push   %ebx
+    2440:	53                   	push   %ebx
+    2441:	68 18 60 00 00       	push   $0x6018
+    2446:	6a 01                	push   $0x1
+    2448:	e8 f3 24 00 00       	call   4940 <printf>
+    exit(1);
+    244d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2454:	e8 f8 20 00 00       	call   4551 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2459:	51                   	push   %ecx
+    245a:	51                   	push   %ecx
+    245b:	68 c3 55 00 00       	push   $0x55c3
+    2460:	6a 01                	push   $0x1
+    2462:	e8 d9 24 00 00       	call   4940 <printf>
+    exit(1);
+    2467:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    246e:	e8 de 20 00 00       	call   4551 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2473:	53                   	push   %ebx
+    2474:	53                   	push   %ebx
+    2475:	68 88 60 00 00       	push   $0x6088
+    247a:	6a 01                	push   $0x1
+    247c:	e8 bf 24 00 00       	call   4940 <printf>
+    exit(1);
+    2481:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2488:	e8 c4 20 00 00       	call   4551 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    248d:	50                   	push   %eax
+    248e:	50                   	push   %eax
+    248f:	68 3e 54 00 00       	push   $0x543e
+    2494:	6a 01                	push   $0x1
+    2496:	e8 a5 24 00 00       	call   4940 <printf>
+    exit(1);
+    249b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    24a2:	e8 aa 20 00 00       	call   4551 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    24a7:	51                   	push   %ecx
+    24a8:	51                   	push   %ecx
+    24a9:	68 17 54 00 00       	push   $0x5417
+    24ae:	6a 01                	push   $0x1
+    24b0:	e8 8b 24 00 00       	call   4940 <printf>
+    exit(1);
+    24b5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    24bc:	e8 90 20 00 00       	call   4551 <exit>
+    printf(1, "chdir ./.. failed\n");
+    24c1:	50                   	push   %eax
+    24c2:	50                   	push   %eax
+    24c3:	68 e0 54 00 00       	push   $0x54e0
+    24c8:	6a 01                	push   $0x1
+    24ca:	e8 71 24 00 00       	call   4940 <printf>
+    exit(1);
+    24cf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    24d6:	e8 76 20 00 00       	call   4551 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    24db:	52                   	push   %edx
+    24dc:	52                   	push   %edx
+    24dd:	68 d0 5f 00 00       	push   $0x5fd0
+    24e2:	6a 01                	push   $0x1
+    24e4:	e8 57 24 00 00       	call   4940 <printf>
+    exit(1);
+    24e9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    24f0:	e8 5c 20 00 00       	call   4551 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    24f5:	50                   	push   %eax
+    24f6:	50                   	push   %eax
+    24f7:	68 64 60 00 00       	push   $0x6064
+    24fc:	6a 01                	push   $0x1
+    24fe:	e8 3d 24 00 00       	call   4940 <printf>
+    exit(1);
+    2503:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    250a:	e8 42 20 00 00       	call   4551 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    250f:	50                   	push   %eax
+    2510:	50                   	push   %eax
+    2511:	68 40 60 00 00       	push   $0x6040
+    2516:	6a 01                	push   $0x1
+    2518:	e8 23 24 00 00       	call   4940 <printf>
+    exit(1);
+    251d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2524:	e8 28 20 00 00       	call   4551 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    2529:	50                   	push   %eax
+    252a:	50                   	push   %eax
+    252b:	68 9f 55 00 00       	push   $0x559f
+    2530:	6a 01                	push   $0x1
+    2532:	e8 09 24 00 00       	call   4940 <printf>
+    exit(1);
+    2537:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    253e:	e8 0e 20 00 00       	call   4551 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2543:	50                   	push   %eax
+    2544:	50                   	push   %eax
+    2545:	68 86 55 00 00       	push   $0x5586
+    254a:	6a 01                	push   $0x1
+    254c:	e8 ef 23 00 00       	call   4940 <printf>
+    exit(1);
+    2551:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2558:	e8 f4 1f 00 00       	call   4551 <exit>
+    printf(1, "create dd succeeded!\n");
+    255d:	50                   	push   %eax
+    255e:	50                   	push   %eax
+    255f:	68 70 55 00 00       	push   $0x5570
+    2564:	6a 01                	push   $0x1
+    2566:	e8 d5 23 00 00       	call   4940 <printf>
+    exit(1);
+    256b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2572:	e8 da 1f 00 00       	call   4551 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2577:	52                   	push   %edx
+    2578:	52                   	push   %edx
+    2579:	68 54 55 00 00       	push   $0x5554
+    257e:	6a 01                	push   $0x1
+    2580:	e8 bb 23 00 00       	call   4940 <printf>
+    exit(1);
+    2585:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    258c:	e8 c0 1f 00 00       	call   4551 <exit>
+    printf(1, "chdir dd failed\n");
+    2591:	50                   	push   %eax
+    2592:	50                   	push   %eax
+    2593:	68 95 54 00 00       	push   $0x5495
+    2598:	6a 01                	push   $0x1
+    259a:	e8 a1 23 00 00       	call   4940 <printf>
+    exit(1);
+    259f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    25a6:	e8 a6 1f 00 00       	call   4551 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    25ab:	50                   	push   %eax
+    25ac:	50                   	push   %eax
+    25ad:	68 f4 5f 00 00       	push   $0x5ff4
+    25b2:	6a 01                	push   $0x1
+    25b4:	e8 87 23 00 00       	call   4940 <printf>
+    exit(1);
+    25b9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    25c0:	e8 8c 1f 00 00       	call   4551 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    25c5:	53                   	push   %ebx
+    25c6:	53                   	push   %ebx
+    25c7:	68 f3 53 00 00       	push   $0x53f3
+    25cc:	6a 01                	push   $0x1
+    25ce:	e8 6d 23 00 00       	call   4940 <printf>
+    exit(1);
+    25d3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    25da:	e8 72 1f 00 00       	call   4551 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    25df:	50                   	push   %eax
+    25e0:	50                   	push   %eax
+    25e1:	68 a8 5f 00 00       	push   $0x5fa8
+    25e6:	6a 01                	push   $0x1
+    25e8:	e8 53 23 00 00       	call   4940 <printf>
+    exit(1);
+    25ed:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    25f4:	e8 58 1f 00 00       	call   4551 <exit>
+    printf(1, "create dd/ff failed\n");
+    25f9:	50                   	push   %eax
+    25fa:	50                   	push   %eax
+    25fb:	68 d7 53 00 00       	push   $0x53d7
+    2600:	6a 01                	push   $0x1
+    2602:	e8 39 23 00 00       	call   4940 <printf>
+    exit(1);
+    2607:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    260e:	e8 3e 1f 00 00       	call   4551 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2613:	50                   	push   %eax
+    2614:	50                   	push   %eax
+    2615:	68 bf 53 00 00       	push   $0x53bf
+    261a:	6a 01                	push   $0x1
+    261c:	e8 1f 23 00 00       	call   4940 <printf>
+    exit(1);
+    2621:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2628:	e8 24 1f 00 00       	call   4551 <exit>
+    printf(1, "unlink dd failed\n");
+    262d:	50                   	push   %eax
+    262e:	50                   	push   %eax
+    262f:	68 a8 56 00 00       	push   $0x56a8
+    2634:	6a 01                	push   $0x1
+    2636:	e8 05 23 00 00       	call   4940 <printf>
+    exit(1);
+    263b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2642:	e8 0a 1f 00 00       	call   4551 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    2647:	52                   	push   %edx
+    2648:	52                   	push   %edx
+    2649:	68 93 56 00 00       	push   $0x5693
+    264e:	6a 01                	push   $0x1
+    2650:	e8 eb 22 00 00       	call   4940 <printf>
+    exit(1);
+    2655:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    265c:	e8 f0 1e 00 00       	call   4551 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2661:	51                   	push   %ecx
+    2662:	51                   	push   %ecx
+    2663:	68 ac 60 00 00       	push   $0x60ac
+    2668:	6a 01                	push   $0x1
+    266a:	e8 d1 22 00 00       	call   4940 <printf>
+    exit(1);
+    266f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2676:	e8 d6 1e 00 00       	call   4551 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    267b:	53                   	push   %ebx
+    267c:	53                   	push   %ebx
+    267d:	68 7e 56 00 00       	push   $0x567e
+    2682:	6a 01                	push   $0x1
+    2684:	e8 b7 22 00 00       	call   4940 <printf>
+    exit(1);
+    2689:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2690:	e8 bc 1e 00 00       	call   4551 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2695:	50                   	push   %eax
+    2696:	50                   	push   %eax
+    2697:	68 66 56 00 00       	push   $0x5666
+    269c:	6a 01                	push   $0x1
+    269e:	e8 9d 22 00 00       	call   4940 <printf>
+    exit(1);
+    26a3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    26aa:	e8 a2 1e 00 00       	call   4551 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    26af:	50                   	push   %eax
+    26b0:	50                   	push   %eax
+    26b1:	68 4e 56 00 00       	push   $0x564e
+    26b6:	6a 01                	push   $0x1
+    26b8:	e8 83 22 00 00       	call   4940 <printf>
+    exit(1);
+    26bd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    26c4:	e8 88 1e 00 00       	call   4551 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    26c9:	50                   	push   %eax
+    26ca:	50                   	push   %eax
+    26cb:	68 32 56 00 00       	push   $0x5632
+    26d0:	6a 01                	push   $0x1
+    26d2:	e8 69 22 00 00       	call   4940 <printf>
+    exit(1);
+    26d7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    26de:	e8 6e 1e 00 00       	call   4551 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    26e3:	50                   	push   %eax
+    26e4:	50                   	push   %eax
+    26e5:	68 16 56 00 00       	push   $0x5616
+    26ea:	6a 01                	push   $0x1
+    26ec:	e8 4f 22 00 00       	call   4940 <printf>
+    exit(1);
+    26f1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    26f8:	e8 54 1e 00 00       	call   4551 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    26fd:	50                   	push   %eax
+    26fe:	50                   	push   %eax
+    26ff:	68 f9 55 00 00       	push   $0x55f9
+    2704:	6a 01                	push   $0x1
+    2706:	e8 35 22 00 00       	call   4940 <printf>
+    exit(1);
+    270b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2712:	e8 3a 1e 00 00       	call   4551 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2717:	52                   	push   %edx
+    2718:	52                   	push   %edx
+    2719:	68 de 55 00 00       	push   $0x55de
+    271e:	6a 01                	push   $0x1
+    2720:	e8 1b 22 00 00       	call   4940 <printf>
+    exit(1);
+    2725:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    272c:	e8 20 1e 00 00       	call   4551 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    2731:	51                   	push   %ecx
+    2732:	51                   	push   %ecx
+    2733:	68 0b 55 00 00       	push   $0x550b
+    2738:	6a 01                	push   $0x1
+    273a:	e8 01 22 00 00       	call   4940 <printf>
+    exit(1);
+    273f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2746:	e8 06 1e 00 00       	call   4551 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    274b:	53                   	push   %ebx
+    274c:	53                   	push   %ebx
+    274d:	68 f3 54 00 00       	push   $0x54f3
+    2752:	6a 01                	push   $0x1
+    2754:	e8 e7 21 00 00       	call   4940 <printf>
+    exit(1);
+    2759:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2760:	e8 ec 1d 00 00       	call   4551 <exit>
+    2765:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    276c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002770 <bigwrite>:
+{
+    2770:	55                   	push   %ebp
+    2771:	89 e5                	mov    %esp,%ebp
+    2773:	56                   	push   %esi
+    2774:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2775:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    277a:	83 ec 08             	sub    $0x8,%esp
+    277d:	68 c5 56 00 00       	push   $0x56c5
+    2782:	6a 01                	push   $0x1
+    2784:	e8 b7 21 00 00       	call   4940 <printf>
+  unlink("bigwrite");
+    2789:	c7 04 24 d4 56 00 00 	movl   $0x56d4,(%esp)
+    2790:	e8 c0 1e 00 00       	call   4655 <unlink>
+    2795:	83 c4 10             	add    $0x10,%esp
+    2798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    279f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    27a0:	83 ec 08             	sub    $0x8,%esp
+    27a3:	68 02 02 00 00       	push   $0x202
+    27a8:	68 d4 56 00 00       	push   $0x56d4
+    27ad:	e8 6f 1e 00 00       	call   4621 <open>
+    if(fd < 0){
+    27b2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    27b5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    27b7:	85 c0                	test   %eax,%eax
+    27b9:	0f 88 85 00 00 00    	js     2844 <bigwrite+0xd4>
+      int cc = write(fd, buf, sz);
+    27bf:	83 ec 04             	sub    $0x4,%esp
+    27c2:	53                   	push   %ebx
+    27c3:	68 c0 98 00 00       	push   $0x98c0
+    27c8:	50                   	push   %eax
+    27c9:	e8 eb 1d 00 00       	call   45b9 <write>
+      if(cc != sz){
+    27ce:	83 c4 10             	add    $0x10,%esp
+    27d1:	39 d8                	cmp    %ebx,%eax
+    27d3:	75 55                	jne    282a <bigwrite+0xba>
+      int cc = write(fd, buf, sz);
+    27d5:	83 ec 04             	sub    $0x4,%esp
+    27d8:	53                   	push   %ebx
+    27d9:	68 c0 98 00 00       	push   $0x98c0
+    27de:	56                   	push   %esi
+    27df:	e8 d5 1d 00 00       	call   45b9 <write>
+      if(cc != sz){
+    27e4:	83 c4 10             	add    $0x10,%esp
+    27e7:	39 c3                	cmp    %eax,%ebx
+    27e9:	75 3f                	jne    282a <bigwrite+0xba>
+    close(fd);
+    27eb:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    27ee:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    27f4:	56                   	push   %esi
+    27f5:	e8 d9 1d 00 00       	call   45d3 <close>
+    unlink("bigwrite");
+    27fa:	c7 04 24 d4 56 00 00 	movl   $0x56d4,(%esp)
+    2801:	e8 4f 1e 00 00       	call   4655 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2806:	83 c4 10             	add    $0x10,%esp
+    2809:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    280f:	75 8f                	jne    27a0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    2811:	83 ec 08             	sub    $0x8,%esp
+    2814:	68 07 57 00 00       	push   $0x5707
+    2819:	6a 01                	push   $0x1
+    281b:	e8 20 21 00 00       	call   4940 <printf>
+}
+    2820:	83 c4 10             	add    $0x10,%esp
+    2823:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2826:	5b                   	pop    %ebx
+    2827:	5e                   	pop    %esi
+    2828:	5d                   	pop    %ebp
+    2829:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    282a:	50                   	push   %eax
+    282b:	53                   	push   %ebx
+    282c:	68 f5 56 00 00       	push   $0x56f5
+    2831:	6a 01                	push   $0x1
+    2833:	e8 08 21 00 00       	call   4940 <printf>
+        exit(1);
+    2838:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    283f:	e8 0d 1d 00 00       	call   4551 <exit>
+      printf(1, "cannot create bigwrite\n");
+    2844:	83 ec 08             	sub    $0x8,%esp
+    2847:	68 dd 56 00 00       	push   $0x56dd
+    284c:	6a 01                	push   $0x1
+    284e:	e8 ed 20 00 00       	call   4940 <printf>
+      exit(1);
+    2853:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    285a:	e8 f2 1c 00 00       	call   4551 <exit>
+    285f:	90                   	nop
+
+00002860 <bigfile>:
+{
+    2860:	55                   	push   %ebp
+    2861:	89 e5                	mov    %esp,%ebp
+    2863:	57                   	push   %edi
+    2864:	56                   	push   %esi
+    2865:	53                   	push   %ebx
+    2866:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    2869:	68 14 57 00 00       	push   $0x5714
+    286e:	6a 01                	push   $0x1
+    2870:	e8 cb 20 00 00       	call   4940 <printf>
+  unlink("bigfile");
+    2875:	c7 04 24 30 57 00 00 	movl   $0x5730,(%esp)
+    287c:	e8 d4 1d 00 00       	call   4655 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2881:	58                   	pop    %eax
+    2882:	5a                   	pop    %edx
+    2883:	68 02 02 00 00       	push   $0x202
+    2888:	68 30 57 00 00       	push   $0x5730
+    288d:	e8 8f 1d 00 00       	call   4621 <open>
+  if(fd < 0){
+    2892:	83 c4 10             	add    $0x10,%esp
+    2895:	85 c0                	test   %eax,%eax
+    2897:	0f 88 81 01 00 00    	js     2a1e <bigfile+0x1be>
+    289d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    289f:	31 db                	xor    %ebx,%ebx
+    28a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    28a8:	83 ec 04             	sub    $0x4,%esp
+    28ab:	68 58 02 00 00       	push   $0x258
+    28b0:	53                   	push   %ebx
+    28b1:	68 c0 98 00 00       	push   $0x98c0
+    28b6:	e8 25 1a 00 00       	call   42e0 <memset>
+    if(write(fd, buf, 600) != 600){
+    28bb:	83 c4 0c             	add    $0xc,%esp
+    28be:	68 58 02 00 00       	push   $0x258
+    28c3:	68 c0 98 00 00       	push   $0x98c0
+    28c8:	56                   	push   %esi
+    28c9:	e8 eb 1c 00 00       	call   45b9 <write>
+    28ce:	83 c4 10             	add    $0x10,%esp
+    28d1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    28d6:	0f 85 0d 01 00 00    	jne    29e9 <bigfile+0x189>
+  for(i = 0; i < 20; i++){
+    28dc:	83 c3 01             	add    $0x1,%ebx
+    28df:	83 fb 14             	cmp    $0x14,%ebx
+    28e2:	75 c4                	jne    28a8 <bigfile+0x48>
+  close(fd);
+    28e4:	83 ec 0c             	sub    $0xc,%esp
+    28e7:	56                   	push   %esi
+    28e8:	e8 e6 1c 00 00       	call   45d3 <close>
+  fd = open("bigfile", 0);
+    28ed:	5e                   	pop    %esi
+    28ee:	5f                   	pop    %edi
+    28ef:	6a 00                	push   $0x0
+    28f1:	68 30 57 00 00       	push   $0x5730
+    28f6:	e8 26 1d 00 00       	call   4621 <open>
+  if(fd < 0){
+    28fb:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    28fe:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2900:	85 c0                	test   %eax,%eax
+    2902:	0f 88 fc 00 00 00    	js     2a04 <bigfile+0x1a4>
+  total = 0;
+    2908:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    290a:	31 ff                	xor    %edi,%edi
+    290c:	eb 30                	jmp    293e <bigfile+0xde>
+    290e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2910:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2915:	0f 85 98 00 00 00    	jne    29b3 <bigfile+0x153>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    291b:	89 fa                	mov    %edi,%edx
+    291d:	0f be 05 c0 98 00 00 	movsbl 0x98c0,%eax
+    2924:	d1 fa                	sar    %edx
+    2926:	39 d0                	cmp    %edx,%eax
+    2928:	75 6e                	jne    2998 <bigfile+0x138>
+    292a:	0f be 15 eb 99 00 00 	movsbl 0x99eb,%edx
+    2931:	39 d0                	cmp    %edx,%eax
+    2933:	75 63                	jne    2998 <bigfile+0x138>
+    total += cc;
+    2935:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    293b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    293e:	83 ec 04             	sub    $0x4,%esp
+    2941:	68 2c 01 00 00       	push   $0x12c
+    2946:	68 c0 98 00 00       	push   $0x98c0
+    294b:	56                   	push   %esi
+    294c:	e8 4e 1c 00 00       	call   459f <read>
+    if(cc < 0){
+    2951:	83 c4 10             	add    $0x10,%esp
+    2954:	85 c0                	test   %eax,%eax
+    2956:	78 76                	js     29ce <bigfile+0x16e>
+    if(cc == 0)
+    2958:	75 b6                	jne    2910 <bigfile+0xb0>
+  close(fd);
+    295a:	83 ec 0c             	sub    $0xc,%esp
+    295d:	56                   	push   %esi
+    295e:	e8 70 1c 00 00       	call   45d3 <close>
+  if(total != 20*600){
+    2963:	83 c4 10             	add    $0x10,%esp
+    2966:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    296c:	0f 85 c6 00 00 00    	jne    2a38 <bigfile+0x1d8>
+  unlink("bigfile");
+    2972:	83 ec 0c             	sub    $0xc,%esp
+    2975:	68 30 57 00 00       	push   $0x5730
+    297a:	e8 d6 1c 00 00       	call   4655 <unlink>
+  printf(1, "bigfile test ok\n");
+    297f:	58                   	pop    %eax
+    2980:	5a                   	pop    %edx
+    2981:	68 bf 57 00 00       	push   $0x57bf
+    2986:	6a 01                	push   $0x1
+    2988:	e8 b3 1f 00 00       	call   4940 <printf>
+}
+    298d:	83 c4 10             	add    $0x10,%esp
+    2990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2993:	5b                   	pop    %ebx
+    2994:	5e                   	pop    %esi
+    2995:	5f                   	pop    %edi
+    2996:	5d                   	pop    %ebp
+    2997:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2998:	83 ec 08             	sub    $0x8,%esp
+    299b:	68 8c 57 00 00       	push   $0x578c
+    29a0:	6a 01                	push   $0x1
+    29a2:	e8 99 1f 00 00       	call   4940 <printf>
+      exit(1);
+    29a7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    29ae:	e8 9e 1b 00 00       	call   4551 <exit>
+      printf(1, "short read bigfile\n");
+    29b3:	83 ec 08             	sub    $0x8,%esp
+    29b6:	68 78 57 00 00       	push   $0x5778
+    29bb:	6a 01                	push   $0x1
+    29bd:	e8 7e 1f 00 00       	call   4940 <printf>
+      exit(1);
+    29c2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    29c9:	e8 83 1b 00 00       	call   4551 <exit>
+      printf(1, "read bigfile failed\n");
+    29ce:	83 ec 08             	sub    $0x8,%esp
+    29d1:	68 63 57 00 00       	push   $0x5763
+    29d6:	6a 01                	push   $0x1
+    29d8:	e8 63 1f 00 00       	call   4940 <printf>
+      exit(1);
+    29dd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    29e4:	e8 68 1b 00 00       	call   4551 <exit>
+      printf(1, "write bigfile failed\n");
+    29e9:	83 ec 08             	sub    $0x8,%esp
+    29ec:	68 38 57 00 00       	push   $0x5738
+    29f1:	6a 01                	push   $0x1
+    29f3:	e8 48 1f 00 00       	call   4940 <printf>
+      exit(1);
+    29f8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    29ff:	e8 4d 1b 00 00       	call   4551 <exit>
+    printf(1, "cannot open bigfile\n");
+    2a04:	53                   	push   %ebx
+    2a05:	53                   	push   %ebx
+    2a06:	68 4e 57 00 00       	push   $0x574e
+    2a0b:	6a 01                	push   $0x1
+    2a0d:	e8 2e 1f 00 00       	call   4940 <printf>
+    exit(1);
+    2a12:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2a19:	e8 33 1b 00 00       	call   4551 <exit>
+    printf(1, "cannot create bigfile");
+    2a1e:	50                   	push   %eax
+    2a1f:	50                   	push   %eax
+    2a20:	68 22 57 00 00       	push   $0x5722
+    2a25:	6a 01                	push   $0x1
+    2a27:	e8 14 1f 00 00       	call   4940 <printf>
+    exit(1);
+    2a2c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2a33:	e8 19 1b 00 00       	call   4551 <exit>
+    printf(1, "read bigfile wrong total\n");
+    2a38:	51                   	push   %ecx
+    2a39:	51                   	push   %ecx
+    2a3a:	68 a5 57 00 00       	push   $0x57a5
+    2a3f:	6a 01                	push   $0x1
+    2a41:	e8 fa 1e 00 00       	call   4940 <printf>
+    exit(1);
+    2a46:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2a4d:	e8 ff 1a 00 00       	call   4551 <exit>
+    2a52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002a60 <fourteen>:
+{
+    2a60:	55                   	push   %ebp
+    2a61:	89 e5                	mov    %esp,%ebp
+    2a63:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2a66:	68 d0 57 00 00       	push   $0x57d0
+    2a6b:	6a 01                	push   $0x1
+    2a6d:	e8 ce 1e 00 00       	call   4940 <printf>
+  if(mkdir("12345678901234") != 0){
+    2a72:	c7 04 24 0b 58 00 00 	movl   $0x580b,(%esp)
+    2a79:	e8 25 1c 00 00       	call   46a3 <mkdir>
+    2a7e:	83 c4 10             	add    $0x10,%esp
+    2a81:	85 c0                	test   %eax,%eax
+    2a83:	0f 85 9b 00 00 00    	jne    2b24 <fourteen+0xc4>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2a89:	83 ec 0c             	sub    $0xc,%esp
+    2a8c:	68 cc 60 00 00       	push   $0x60cc
+    2a91:	e8 0d 1c 00 00       	call   46a3 <mkdir>
+    2a96:	83 c4 10             	add    $0x10,%esp
+    2a99:	85 c0                	test   %eax,%eax
+    2a9b:	0f 85 05 01 00 00    	jne    2ba6 <fourteen+0x146>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2aa1:	83 ec 08             	sub    $0x8,%esp
+    2aa4:	68 00 02 00 00       	push   $0x200
+    2aa9:	68 1c 61 00 00       	push   $0x611c
+    2aae:	e8 6e 1b 00 00       	call   4621 <open>
+  if(fd < 0){
+    2ab3:	83 c4 10             	add    $0x10,%esp
+    2ab6:	85 c0                	test   %eax,%eax
+    2ab8:	0f 88 ce 00 00 00    	js     2b8c <fourteen+0x12c>
+  close(fd);
+    2abe:	83 ec 0c             	sub    $0xc,%esp
+    2ac1:	50                   	push   %eax
+    2ac2:	e8 0c 1b 00 00       	call   45d3 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2ac7:	58                   	pop    %eax
+    2ac8:	5a                   	pop    %edx
+    2ac9:	6a 00                	push   $0x0
+    2acb:	68 8c 61 00 00       	push   $0x618c
+    2ad0:	e8 4c 1b 00 00       	call   4621 <open>
+  if(fd < 0){
+    2ad5:	83 c4 10             	add    $0x10,%esp
+    2ad8:	85 c0                	test   %eax,%eax
+    2ada:	0f 88 92 00 00 00    	js     2b72 <fourteen+0x112>
+  close(fd);
+    2ae0:	83 ec 0c             	sub    $0xc,%esp
+    2ae3:	50                   	push   %eax
+    2ae4:	e8 ea 1a 00 00       	call   45d3 <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2ae9:	c7 04 24 fc 57 00 00 	movl   $0x57fc,(%esp)
+    2af0:	e8 ae 1b 00 00       	call   46a3 <mkdir>
+    2af5:	83 c4 10             	add    $0x10,%esp
+    2af8:	85 c0                	test   %eax,%eax
+    2afa:	74 5c                	je     2b58 <fourteen+0xf8>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2afc:	83 ec 0c             	sub    $0xc,%esp
+    2aff:	68 28 62 00 00       	push   $0x6228
+    2b04:	e8 9a 1b 00 00       	call   46a3 <mkdir>
+    2b09:	83 c4 10             	add    $0x10,%esp
+    2b0c:	85 c0                	test   %eax,%eax
+    2b0e:	74 2e                	je     2b3e <fourteen+0xde>
+  printf(1, "fourteen ok\n");
+    2b10:	83 ec 08             	sub    $0x8,%esp
+    2b13:	68 1a 58 00 00       	push   $0x581a
+    2b18:	6a 01                	push   $0x1
+    2b1a:	e8 21 1e 00 00       	call   4940 <printf>
+}
+    2b1f:	83 c4 10             	add    $0x10,%esp
+    2b22:	c9                   	leave
+    2b23:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2b24:	50                   	push   %eax
+    2b25:	50                   	push   %eax
+    2b26:	68 df 57 00 00       	push   $0x57df
+    2b2b:	6a 01                	push   $0x1
+    2b2d:	e8 0e 1e 00 00       	call   4940 <printf>
+    exit(1);
+    2b32:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2b39:	e8 13 1a 00 00       	call   4551 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2b3e:	50                   	push   %eax
+    2b3f:	50                   	push   %eax
+    2b40:	68 48 62 00 00       	push   $0x6248
+    2b45:	6a 01                	push   $0x1
+    2b47:	e8 f4 1d 00 00       	call   4940 <printf>
+    exit(1);
+    2b4c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2b53:	e8 f9 19 00 00       	call   4551 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2b58:	52                   	push   %edx
+    2b59:	52                   	push   %edx
+    2b5a:	68 f8 61 00 00       	push   $0x61f8
+    2b5f:	6a 01                	push   $0x1
+    2b61:	e8 da 1d 00 00       	call   4940 <printf>
+    exit(1);
+    2b66:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2b6d:	e8 df 19 00 00       	call   4551 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2b72:	51                   	push   %ecx
+    2b73:	51                   	push   %ecx
+    2b74:	68 bc 61 00 00       	push   $0x61bc
+    2b79:	6a 01                	push   $0x1
+    2b7b:	e8 c0 1d 00 00       	call   4940 <printf>
+    exit(1);
+    2b80:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2b87:	e8 c5 19 00 00       	call   4551 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    2b8c:	51                   	push   %ecx
+    2b8d:	51                   	push   %ecx
+    2b8e:	68 4c 61 00 00       	push   $0x614c
+    2b93:	6a 01                	push   $0x1
+    2b95:	e8 a6 1d 00 00       	call   4940 <printf>
+    exit(1);
+    2b9a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2ba1:	e8 ab 19 00 00       	call   4551 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2ba6:	50                   	push   %eax
+    2ba7:	50                   	push   %eax
+    2ba8:	68 ec 60 00 00       	push   $0x60ec
+    2bad:	6a 01                	push   $0x1
+    2baf:	e8 8c 1d 00 00       	call   4940 <printf>
+    exit(1);
+    2bb4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2bbb:	e8 91 19 00 00       	call   4551 <exit>
+
+00002bc0 <rmdot>:
+{
+    2bc0:	55                   	push   %ebp
+    2bc1:	89 e5                	mov    %esp,%ebp
+    2bc3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2bc6:	68 27 58 00 00       	push   $0x5827
+    2bcb:	6a 01                	push   $0x1
+    2bcd:	e8 6e 1d 00 00       	call   4940 <printf>
+  if(mkdir("dots") != 0){
+    2bd2:	c7 04 24 33 58 00 00 	movl   $0x5833,(%esp)
+    2bd9:	e8 c5 1a 00 00       	call   46a3 <mkdir>
+    2bde:	83 c4 10             	add    $0x10,%esp
+    2be1:	85 c0                	test   %eax,%eax
+    2be3:	0f 85 b4 00 00 00    	jne    2c9d <rmdot+0xdd>
+  if(chdir("dots") != 0){
+    2be9:	83 ec 0c             	sub    $0xc,%esp
+    2bec:	68 33 58 00 00       	push   $0x5833
+    2bf1:	e8 c7 1a 00 00       	call   46bd <chdir>
+    2bf6:	83 c4 10             	add    $0x10,%esp
+    2bf9:	85 c0                	test   %eax,%eax
+    2bfb:	0f 85 52 01 00 00    	jne    2d53 <rmdot+0x193>
+  if(unlink(".") == 0){
+    2c01:	83 ec 0c             	sub    $0xc,%esp
+    2c04:	68 de 54 00 00       	push   $0x54de
+    2c09:	e8 47 1a 00 00       	call   4655 <unlink>
+    2c0e:	83 c4 10             	add    $0x10,%esp
+    2c11:	85 c0                	test   %eax,%eax
+    2c13:	0f 84 20 01 00 00    	je     2d39 <rmdot+0x179>
+  if(unlink("..") == 0){
+    2c19:	83 ec 0c             	sub    $0xc,%esp
+    2c1c:	68 dd 54 00 00       	push   $0x54dd
+    2c21:	e8 2f 1a 00 00       	call   4655 <unlink>
+    2c26:	83 c4 10             	add    $0x10,%esp
+    2c29:	85 c0                	test   %eax,%eax
+    2c2b:	0f 84 ee 00 00 00    	je     2d1f <rmdot+0x15f>
+  if(chdir("/") != 0){
+    2c31:	83 ec 0c             	sub    $0xc,%esp
+    2c34:	68 b1 4c 00 00       	push   $0x4cb1
+    2c39:	e8 7f 1a 00 00       	call   46bd <chdir>
+    2c3e:	83 c4 10             	add    $0x10,%esp
+    2c41:	85 c0                	test   %eax,%eax
+    2c43:	0f 85 bc 00 00 00    	jne    2d05 <rmdot+0x145>
+  if(unlink("dots/.") == 0){
+    2c49:	83 ec 0c             	sub    $0xc,%esp
+    2c4c:	68 7b 58 00 00       	push   $0x587b
+    2c51:	e8 ff 19 00 00       	call   4655 <unlink>
+    2c56:	83 c4 10             	add    $0x10,%esp
+    2c59:	85 c0                	test   %eax,%eax
+    2c5b:	0f 84 8a 00 00 00    	je     2ceb <rmdot+0x12b>
+  if(unlink("dots/..") == 0){
+    2c61:	83 ec 0c             	sub    $0xc,%esp
+    2c64:	68 99 58 00 00       	push   $0x5899
+    2c69:	e8 e7 19 00 00       	call   4655 <unlink>
+    2c6e:	83 c4 10             	add    $0x10,%esp
+    2c71:	85 c0                	test   %eax,%eax
+    2c73:	74 5c                	je     2cd1 <rmdot+0x111>
+  if(unlink("dots") != 0){
+    2c75:	83 ec 0c             	sub    $0xc,%esp
+    2c78:	68 33 58 00 00       	push   $0x5833
+    2c7d:	e8 d3 19 00 00       	call   4655 <unlink>
+    2c82:	83 c4 10             	add    $0x10,%esp
+    2c85:	85 c0                	test   %eax,%eax
+    2c87:	75 2e                	jne    2cb7 <rmdot+0xf7>
+  printf(1, "rmdot ok\n");
+    2c89:	83 ec 08             	sub    $0x8,%esp
+    2c8c:	68 ce 58 00 00       	push   $0x58ce
+    2c91:	6a 01                	push   $0x1
+    2c93:	e8 a8 1c 00 00       	call   4940 <printf>
+}
+    2c98:	83 c4 10             	add    $0x10,%esp
+    2c9b:	c9                   	leave
+    2c9c:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2c9d:	50                   	push   %eax
+    2c9e:	50                   	push   %eax
+    2c9f:	68 38 58 00 00       	push   $0x5838
+    2ca4:	6a 01                	push   $0x1
+    2ca6:	e8 95 1c 00 00       	call   4940 <printf>
+    exit(1);
+    2cab:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2cb2:	e8 9a 18 00 00       	call   4551 <exit>
+    printf(1, "unlink dots failed!\n");
+    2cb7:	50                   	push   %eax
+    2cb8:	50                   	push   %eax
+    2cb9:	68 b9 58 00 00       	push   $0x58b9
+    2cbe:	6a 01                	push   $0x1
+    2cc0:	e8 7b 1c 00 00       	call   4940 <printf>
+    exit(1);
+    2cc5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2ccc:	e8 80 18 00 00       	call   4551 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2cd1:	52                   	push   %edx
+    2cd2:	52                   	push   %edx
+    2cd3:	68 a1 58 00 00       	push   $0x58a1
+    2cd8:	6a 01                	push   $0x1
+    2cda:	e8 61 1c 00 00       	call   4940 <printf>
+    exit(1);
+    2cdf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2ce6:	e8 66 18 00 00       	call   4551 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2ceb:	51                   	push   %ecx
+    2cec:	51                   	push   %ecx
+    2ced:	68 82 58 00 00       	push   $0x5882
+    2cf2:	6a 01                	push   $0x1
+    2cf4:	e8 47 1c 00 00       	call   4940 <printf>
+    exit(1);
+    2cf9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d00:	e8 4c 18 00 00       	call   4551 <exit>
+    printf(1, "chdir / failed\n");
+    2d05:	50                   	push   %eax
+    2d06:	50                   	push   %eax
+    2d07:	68 b3 4c 00 00       	push   $0x4cb3
+    2d0c:	6a 01                	push   $0x1
+    2d0e:	e8 2d 1c 00 00       	call   4940 <printf>
+    exit(1);
+    2d13:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d1a:	e8 32 18 00 00       	call   4551 <exit>
+    printf(1, "rm .. worked!\n");
+    2d1f:	50                   	push   %eax
+    2d20:	50                   	push   %eax
+    2d21:	68 6c 58 00 00       	push   $0x586c
+    2d26:	6a 01                	push   $0x1
+    2d28:	e8 13 1c 00 00       	call   4940 <printf>
+    exit(1);
+    2d2d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d34:	e8 18 18 00 00       	call   4551 <exit>
+    printf(1, "rm . worked!\n");
+    2d39:	50                   	push   %eax
+    2d3a:	50                   	push   %eax
+    2d3b:	68 5e 58 00 00       	push   $0x585e
+    2d40:	6a 01                	push   $0x1
+    2d42:	e8 f9 1b 00 00       	call   4940 <printf>
+    exit(1);
+    2d47:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d4e:	e8 fe 17 00 00       	call   4551 <exit>
+    printf(1, "chdir dots failed\n");
+    2d53:	50                   	push   %eax
+    2d54:	50                   	push   %eax
+    2d55:	68 4b 58 00 00       	push   $0x584b
+    2d5a:	6a 01                	push   $0x1
+    2d5c:	e8 df 1b 00 00       	call   4940 <printf>
+    exit(1);
+    2d61:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d68:	e8 e4 17 00 00       	call   4551 <exit>
+    2d6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002d70 <dirfile>:
+{
+    2d70:	55                   	push   %ebp
+    2d71:	89 e5                	mov    %esp,%ebp
+    2d73:	53                   	push   %ebx
+    2d74:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2d77:	68 d8 58 00 00       	push   $0x58d8
+    2d7c:	6a 01                	push   $0x1
+    2d7e:	e8 bd 1b 00 00       	call   4940 <printf>
+  fd = open("dirfile", O_CREATE);
+    2d83:	5b                   	pop    %ebx
+    2d84:	58                   	pop    %eax
+    2d85:	68 00 02 00 00       	push   $0x200
+    2d8a:	68 e5 58 00 00       	push   $0x58e5
+    2d8f:	e8 8d 18 00 00       	call   4621 <open>
+  if(fd < 0){
+    2d94:	83 c4 10             	add    $0x10,%esp
+    2d97:	85 c0                	test   %eax,%eax
+    2d99:	0f 88 51 01 00 00    	js     2ef0 <dirfile+0x180>
+  close(fd);
+    2d9f:	83 ec 0c             	sub    $0xc,%esp
+    2da2:	50                   	push   %eax
+    2da3:	e8 2b 18 00 00       	call   45d3 <close>
+  if(chdir("dirfile") == 0){
+    2da8:	c7 04 24 e5 58 00 00 	movl   $0x58e5,(%esp)
+    2daf:	e8 09 19 00 00       	call   46bd <chdir>
+    2db4:	83 c4 10             	add    $0x10,%esp
+    2db7:	85 c0                	test   %eax,%eax
+    2db9:	0f 84 17 01 00 00    	je     2ed6 <dirfile+0x166>
+  fd = open("dirfile/xx", 0);
+    2dbf:	83 ec 08             	sub    $0x8,%esp
+    2dc2:	6a 00                	push   $0x0
+    2dc4:	68 1e 59 00 00       	push   $0x591e
+    2dc9:	e8 53 18 00 00       	call   4621 <open>
+  if(fd >= 0){
+    2dce:	83 c4 10             	add    $0x10,%esp
+    2dd1:	85 c0                	test   %eax,%eax
+    2dd3:	0f 89 e3 00 00 00    	jns    2ebc <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2dd9:	83 ec 08             	sub    $0x8,%esp
+    2ddc:	68 00 02 00 00       	push   $0x200
+    2de1:	68 1e 59 00 00       	push   $0x591e
+    2de6:	e8 36 18 00 00       	call   4621 <open>
+  if(fd >= 0){
+    2deb:	83 c4 10             	add    $0x10,%esp
+    2dee:	85 c0                	test   %eax,%eax
+    2df0:	0f 89 c6 00 00 00    	jns    2ebc <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2df6:	83 ec 0c             	sub    $0xc,%esp
+    2df9:	68 1e 59 00 00       	push   $0x591e
+    2dfe:	e8 a0 18 00 00       	call   46a3 <mkdir>
+    2e03:	83 c4 10             	add    $0x10,%esp
+    2e06:	85 c0                	test   %eax,%eax
+    2e08:	0f 84 7e 01 00 00    	je     2f8c <dirfile+0x21c>
+  if(unlink("dirfile/xx") == 0){
+    2e0e:	83 ec 0c             	sub    $0xc,%esp
+    2e11:	68 1e 59 00 00       	push   $0x591e
+    2e16:	e8 3a 18 00 00       	call   4655 <unlink>
+    2e1b:	83 c4 10             	add    $0x10,%esp
+    2e1e:	85 c0                	test   %eax,%eax
+    2e20:	0f 84 4c 01 00 00    	je     2f72 <dirfile+0x202>
+  if(link("README", "dirfile/xx") == 0){
+    2e26:	83 ec 08             	sub    $0x8,%esp
+    2e29:	68 1e 59 00 00       	push   $0x591e
+    2e2e:	68 82 59 00 00       	push   $0x5982
+    2e33:	e8 51 18 00 00       	call   4689 <link>
+    2e38:	83 c4 10             	add    $0x10,%esp
+    2e3b:	85 c0                	test   %eax,%eax
+    2e3d:	0f 84 15 01 00 00    	je     2f58 <dirfile+0x1e8>
+  if(unlink("dirfile") != 0){
+    2e43:	83 ec 0c             	sub    $0xc,%esp
+    2e46:	68 e5 58 00 00       	push   $0x58e5
+    2e4b:	e8 05 18 00 00       	call   4655 <unlink>
+    2e50:	83 c4 10             	add    $0x10,%esp
+    2e53:	85 c0                	test   %eax,%eax
+    2e55:	0f 85 e3 00 00 00    	jne    2f3e <dirfile+0x1ce>
+  fd = open(".", O_RDWR);
+    2e5b:	83 ec 08             	sub    $0x8,%esp
+    2e5e:	6a 02                	push   $0x2
+    2e60:	68 de 54 00 00       	push   $0x54de
+    2e65:	e8 b7 17 00 00       	call   4621 <open>
+  if(fd >= 0){
+    2e6a:	83 c4 10             	add    $0x10,%esp
+    2e6d:	85 c0                	test   %eax,%eax
+    2e6f:	0f 89 af 00 00 00    	jns    2f24 <dirfile+0x1b4>
+  fd = open(".", 0);
+    2e75:	83 ec 08             	sub    $0x8,%esp
+    2e78:	6a 00                	push   $0x0
+    2e7a:	68 de 54 00 00       	push   $0x54de
+    2e7f:	e8 9d 17 00 00       	call   4621 <open>
+  if(write(fd, "x", 1) > 0){
+    2e84:	83 c4 0c             	add    $0xc,%esp
+    2e87:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2e89:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2e8b:	68 c1 55 00 00       	push   $0x55c1
+    2e90:	50                   	push   %eax
+    2e91:	e8 23 17 00 00       	call   45b9 <write>
+    2e96:	83 c4 10             	add    $0x10,%esp
+    2e99:	85 c0                	test   %eax,%eax
+    2e9b:	7f 6d                	jg     2f0a <dirfile+0x19a>
+  close(fd);
+    2e9d:	83 ec 0c             	sub    $0xc,%esp
+    2ea0:	53                   	push   %ebx
+    2ea1:	e8 2d 17 00 00       	call   45d3 <close>
+  printf(1, "dir vs file OK\n");
+    2ea6:	58                   	pop    %eax
+    2ea7:	5a                   	pop    %edx
+    2ea8:	68 b5 59 00 00       	push   $0x59b5
+    2ead:	6a 01                	push   $0x1
+    2eaf:	e8 8c 1a 00 00       	call   4940 <printf>
+}
+    2eb4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2eb7:	83 c4 10             	add    $0x10,%esp
+    2eba:	c9                   	leave
+    2ebb:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2ebc:	50                   	push   %eax
+    2ebd:	50                   	push   %eax
+    2ebe:	68 29 59 00 00       	push   $0x5929
+    2ec3:	6a 01                	push   $0x1
+    2ec5:	e8 76 1a 00 00       	call   4940 <printf>
+    exit(1);
+    2eca:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2ed1:	e8 7b 16 00 00       	call   4551 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2ed6:	52                   	push   %edx
+    2ed7:	52                   	push   %edx
+    2ed8:	68 04 59 00 00       	push   $0x5904
+    2edd:	6a 01                	push   $0x1
+    2edf:	e8 5c 1a 00 00       	call   4940 <printf>
+    exit(1);
+    2ee4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2eeb:	e8 61 16 00 00       	call   4551 <exit>
+    printf(1, "create dirfile failed\n");
+    2ef0:	51                   	push   %ecx
+    2ef1:	51                   	push   %ecx
+    2ef2:	68 ed 58 00 00       	push   $0x58ed
+    2ef7:	6a 01                	push   $0x1
+    2ef9:	e8 42 1a 00 00       	call   4940 <printf>
+    exit(1);
+    2efe:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2f05:	e8 47 16 00 00       	call   4551 <exit>
+    printf(1, "write . succeeded!\n");
+    2f0a:	51                   	push   %ecx
+    2f0b:	51                   	push   %ecx
+    2f0c:	68 a1 59 00 00       	push   $0x59a1
+    2f11:	6a 01                	push   $0x1
+    2f13:	e8 28 1a 00 00       	call   4940 <printf>
+    exit(1);
+    2f18:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2f1f:	e8 2d 16 00 00       	call   4551 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2f24:	53                   	push   %ebx
+    2f25:	53                   	push   %ebx
+    2f26:	68 9c 62 00 00       	push   $0x629c
+    2f2b:	6a 01                	push   $0x1
+    2f2d:	e8 0e 1a 00 00       	call   4940 <printf>
+    exit(1);
+    2f32:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2f39:	e8 13 16 00 00       	call   4551 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2f3e:	50                   	push   %eax
+    2f3f:	50                   	push   %eax
+    2f40:	68 89 59 00 00       	push   $0x5989
+    2f45:	6a 01                	push   $0x1
+    2f47:	e8 f4 19 00 00       	call   4940 <printf>
+    exit(1);
+    2f4c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2f53:	e8 f9 15 00 00       	call   4551 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2f58:	50                   	push   %eax
+    2f59:	50                   	push   %eax
+    2f5a:	68 7c 62 00 00       	push   $0x627c
+    2f5f:	6a 01                	push   $0x1
+    2f61:	e8 da 19 00 00       	call   4940 <printf>
+    exit(1);
+    2f66:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2f6d:	e8 df 15 00 00       	call   4551 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2f72:	50                   	push   %eax
+    2f73:	50                   	push   %eax
+    2f74:	68 64 59 00 00       	push   $0x5964
+    2f79:	6a 01                	push   $0x1
+    2f7b:	e8 c0 19 00 00       	call   4940 <printf>
+    exit(1);
+    2f80:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2f87:	e8 c5 15 00 00       	call   4551 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2f8c:	50                   	push   %eax
+    2f8d:	50                   	push   %eax
+    2f8e:	68 47 59 00 00       	push   $0x5947
+    2f93:	6a 01                	push   $0x1
+    2f95:	e8 a6 19 00 00       	call   4940 <printf>
+    exit(1);
+    2f9a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2fa1:	e8 ab 15 00 00       	call   4551 <exit>
+    2fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2fad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002fb0 <iref>:
+{
+    2fb0:	55                   	push   %ebp
+    2fb1:	89 e5                	mov    %esp,%ebp
+    2fb3:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2fb4:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2fb9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2fbc:	68 c5 59 00 00       	push   $0x59c5
+    2fc1:	6a 01                	push   $0x1
+    2fc3:	e8 78 19 00 00       	call   4940 <printf>
+    2fc8:	83 c4 10             	add    $0x10,%esp
+    2fcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2fcf:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2fd0:	83 ec 0c             	sub    $0xc,%esp
+    2fd3:	68 d6 59 00 00       	push   $0x59d6
+    2fd8:	e8 c6 16 00 00       	call   46a3 <mkdir>
+    2fdd:	83 c4 10             	add    $0x10,%esp
+    2fe0:	85 c0                	test   %eax,%eax
+    2fe2:	0f 85 bb 00 00 00    	jne    30a3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2fe8:	83 ec 0c             	sub    $0xc,%esp
+    2feb:	68 d6 59 00 00       	push   $0x59d6
+    2ff0:	e8 c8 16 00 00       	call   46bd <chdir>
+    2ff5:	83 c4 10             	add    $0x10,%esp
+    2ff8:	85 c0                	test   %eax,%eax
+    2ffa:	0f 85 be 00 00 00    	jne    30be <iref+0x10e>
+    mkdir("");
+    3000:	83 ec 0c             	sub    $0xc,%esp
+    3003:	68 8b 50 00 00       	push   $0x508b
+    3008:	e8 96 16 00 00       	call   46a3 <mkdir>
+    link("README", "");
+    300d:	59                   	pop    %ecx
+    300e:	58                   	pop    %eax
+    300f:	68 8b 50 00 00       	push   $0x508b
+    3014:	68 82 59 00 00       	push   $0x5982
+    3019:	e8 6b 16 00 00       	call   4689 <link>
+    fd = open("", O_CREATE);
+    301e:	58                   	pop    %eax
+    301f:	5a                   	pop    %edx
+    3020:	68 00 02 00 00       	push   $0x200
+    3025:	68 8b 50 00 00       	push   $0x508b
+    302a:	e8 f2 15 00 00       	call   4621 <open>
+    if(fd >= 0)
+    302f:	83 c4 10             	add    $0x10,%esp
+    3032:	85 c0                	test   %eax,%eax
+    3034:	78 0c                	js     3042 <iref+0x92>
+      close(fd);
+    3036:	83 ec 0c             	sub    $0xc,%esp
+    3039:	50                   	push   %eax
+    303a:	e8 94 15 00 00       	call   45d3 <close>
+    303f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3042:	83 ec 08             	sub    $0x8,%esp
+    3045:	68 00 02 00 00       	push   $0x200
+    304a:	68 c0 55 00 00       	push   $0x55c0
+    304f:	e8 cd 15 00 00       	call   4621 <open>
+    if(fd >= 0)
+    3054:	83 c4 10             	add    $0x10,%esp
+    3057:	85 c0                	test   %eax,%eax
+    3059:	78 0c                	js     3067 <iref+0xb7>
+      close(fd);
+    305b:	83 ec 0c             	sub    $0xc,%esp
+    305e:	50                   	push   %eax
+    305f:	e8 6f 15 00 00       	call   45d3 <close>
+    3064:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    3067:	83 ec 0c             	sub    $0xc,%esp
+    306a:	68 c0 55 00 00       	push   $0x55c0
+    306f:	e8 e1 15 00 00       	call   4655 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    3074:	83 c4 10             	add    $0x10,%esp
+    3077:	83 eb 01             	sub    $0x1,%ebx
+    307a:	0f 85 50 ff ff ff    	jne    2fd0 <iref+0x20>
+  chdir("/");
+    3080:	83 ec 0c             	sub    $0xc,%esp
+    3083:	68 b1 4c 00 00       	push   $0x4cb1
+    3088:	e8 30 16 00 00       	call   46bd <chdir>
+  printf(1, "empty file name OK\n");
+    308d:	58                   	pop    %eax
+    308e:	5a                   	pop    %edx
+    308f:	68 04 5a 00 00       	push   $0x5a04
+    3094:	6a 01                	push   $0x1
+    3096:	e8 a5 18 00 00       	call   4940 <printf>
+}
+    309b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    309e:	83 c4 10             	add    $0x10,%esp
+    30a1:	c9                   	leave
+    30a2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    30a3:	83 ec 08             	sub    $0x8,%esp
+    30a6:	68 dc 59 00 00       	push   $0x59dc
+    30ab:	6a 01                	push   $0x1
+    30ad:	e8 8e 18 00 00       	call   4940 <printf>
+      exit(1);
+    30b2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    30b9:	e8 93 14 00 00       	call   4551 <exit>
+      printf(1, "chdir irefd failed\n");
+    30be:	83 ec 08             	sub    $0x8,%esp
+    30c1:	68 f0 59 00 00       	push   $0x59f0
+    30c6:	6a 01                	push   $0x1
+    30c8:	e8 73 18 00 00       	call   4940 <printf>
+      exit(1);
+    30cd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    30d4:	e8 78 14 00 00       	call   4551 <exit>
+    30d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000030e0 <forktest>:
+{
+    30e0:	55                   	push   %ebp
+    30e1:	89 e5                	mov    %esp,%ebp
+    30e3:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    30e4:	31 db                	xor    %ebx,%ebx
+{
+    30e6:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    30e9:	68 18 5a 00 00       	push   $0x5a18
+    30ee:	6a 01                	push   $0x1
+    30f0:	e8 4b 18 00 00       	call   4940 <printf>
+    30f5:	83 c4 10             	add    $0x10,%esp
+    30f8:	eb 17                	jmp    3111 <forktest+0x31>
+    30fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    3100:	74 4d                	je     314f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    3102:	83 c3 01             	add    $0x1,%ebx
+    3105:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    310b:	0f 84 7d 00 00 00    	je     318e <forktest+0xae>
+    pid = fork();
+    3111:	e8 21 14 00 00       	call   4537 <fork>
+    if(pid < 0)
+    3116:	85 c0                	test   %eax,%eax
+    3118:	79 e6                	jns    3100 <forktest+0x20>
+  for(; n > 0; n--){
+    311a:	85 db                	test   %ebx,%ebx
+    311c:	74 10                	je     312e <forktest+0x4e>
+    311e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+    3120:	e8 46 14 00 00       	call   456b <wait>
+    3125:	85 c0                	test   %eax,%eax
+    3127:	78 30                	js     3159 <forktest+0x79>
+  for(; n > 0; n--){
+    3129:	83 eb 01             	sub    $0x1,%ebx
+    312c:	75 f2                	jne    3120 <forktest+0x40>
+  if(wait() != -1){
+    312e:	e8 38 14 00 00       	call   456b <wait>
+    3133:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3136:	75 3c                	jne    3174 <forktest+0x94>
+  printf(1, "fork test OK\n");
+    3138:	83 ec 08             	sub    $0x8,%esp
+    313b:	68 4a 5a 00 00       	push   $0x5a4a
+    3140:	6a 01                	push   $0x1
+    3142:	e8 f9 17 00 00       	call   4940 <printf>
+}
+    3147:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    314a:	83 c4 10             	add    $0x10,%esp
+    314d:	c9                   	leave
+    314e:	c3                   	ret
+      exit(0);
+    314f:	83 ec 0c             	sub    $0xc,%esp
+    3152:	6a 00                	push   $0x0
+    3154:	e8 f8 13 00 00       	call   4551 <exit>
+      printf(1, "wait stopped early\n");
+    3159:	83 ec 08             	sub    $0x8,%esp
+    315c:	68 23 5a 00 00       	push   $0x5a23
+    3161:	6a 01                	push   $0x1
+    3163:	e8 d8 17 00 00       	call   4940 <printf>
+      exit(1);
+    3168:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    316f:	e8 dd 13 00 00       	call   4551 <exit>
+    printf(1, "wait got too many\n");
+    3174:	50                   	push   %eax
+    3175:	50                   	push   %eax
+    3176:	68 37 5a 00 00       	push   $0x5a37
+    317b:	6a 01                	push   $0x1
+    317d:	e8 be 17 00 00       	call   4940 <printf>
+    exit(1);
+    3182:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3189:	e8 c3 13 00 00       	call   4551 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    318e:	52                   	push   %edx
+    318f:	52                   	push   %edx
+    3190:	68 bc 62 00 00       	push   $0x62bc
+    3195:	6a 01                	push   $0x1
+    3197:	e8 a4 17 00 00       	call   4940 <printf>
+    exit(1);
+    319c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    31a3:	e8 a9 13 00 00       	call   4551 <exit>
+    31a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    31af:	90                   	nop
+
+000031b0 <sbrktest>:
+{
+    31b0:	55                   	push   %ebp
+    31b1:	89 e5                	mov    %esp,%ebp
+    31b3:	57                   	push   %edi
+    31b4:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    31b5:	31 f6                	xor    %esi,%esi
+{
+    31b7:	53                   	push   %ebx
+    31b8:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    31bb:	68 58 5a 00 00       	push   $0x5a58
+    31c0:	ff 35 80 71 00 00    	push   0x7180
+    31c6:	e8 75 17 00 00       	call   4940 <printf>
+  oldbrk = sbrk(0);
+    31cb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    31d2:	e8 1a 15 00 00       	call   46f1 <sbrk>
+    31d7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    31da:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    31e1:	e8 0b 15 00 00       	call   46f1 <sbrk>
+    31e6:	83 c4 10             	add    $0x10,%esp
+    31e9:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    31eb:	eb 05                	jmp    31f2 <sbrktest+0x42>
+    31ed:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    31f0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    31f2:	83 ec 0c             	sub    $0xc,%esp
+    31f5:	6a 01                	push   $0x1
+    31f7:	e8 f5 14 00 00       	call   46f1 <sbrk>
+    if(b != a){
+    31fc:	83 c4 10             	add    $0x10,%esp
+    31ff:	39 d8                	cmp    %ebx,%eax
+    3201:	0f 85 a4 02 00 00    	jne    34ab <sbrktest+0x2fb>
+  for(i = 0; i < 5000; i++){
+    3207:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    320a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    320d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3210:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3216:	75 d8                	jne    31f0 <sbrktest+0x40>
+  pid = fork();
+    3218:	e8 1a 13 00 00       	call   4537 <fork>
+    321d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    321f:	85 c0                	test   %eax,%eax
+    3221:	0f 88 2a 03 00 00    	js     3551 <sbrktest+0x3a1>
+  c = sbrk(1);
+    3227:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    322a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    322d:	6a 01                	push   $0x1
+    322f:	e8 bd 14 00 00       	call   46f1 <sbrk>
+  c = sbrk(1);
+    3234:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    323b:	e8 b1 14 00 00       	call   46f1 <sbrk>
+  if(c != a + 1){
+    3240:	83 c4 10             	add    $0x10,%esp
+    3243:	39 c3                	cmp    %eax,%ebx
+    3245:	0f 85 84 03 00 00    	jne    35cf <sbrktest+0x41f>
+  if(pid == 0)
+    324b:	85 f6                	test   %esi,%esi
+    324d:	0f 84 72 03 00 00    	je     35c5 <sbrktest+0x415>
+  wait();
+    3253:	e8 13 13 00 00       	call   456b <wait>
+  a = sbrk(0);
+    3258:	83 ec 0c             	sub    $0xc,%esp
+    325b:	6a 00                	push   $0x0
+    325d:	e8 8f 14 00 00       	call   46f1 <sbrk>
+    3262:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3264:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3269:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    326b:	89 04 24             	mov    %eax,(%esp)
+    326e:	e8 7e 14 00 00       	call   46f1 <sbrk>
+  if (p != a) {
+    3273:	83 c4 10             	add    $0x10,%esp
+    3276:	39 c3                	cmp    %eax,%ebx
+    3278:	0f 85 b5 02 00 00    	jne    3533 <sbrktest+0x383>
+  a = sbrk(0);
+    327e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3281:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3288:	6a 00                	push   $0x0
+    328a:	e8 62 14 00 00       	call   46f1 <sbrk>
+  c = sbrk(-4096);
+    328f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3296:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3298:	e8 54 14 00 00       	call   46f1 <sbrk>
+  if(c == (char*)0xffffffff){
+    329d:	83 c4 10             	add    $0x10,%esp
+    32a0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    32a3:	0f 84 80 03 00 00    	je     3629 <sbrktest+0x479>
+  c = sbrk(0);
+    32a9:	83 ec 0c             	sub    $0xc,%esp
+    32ac:	6a 00                	push   $0x0
+    32ae:	e8 3e 14 00 00       	call   46f1 <sbrk>
+  if(c != a - 4096){
+    32b3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    32b9:	83 c4 10             	add    $0x10,%esp
+    32bc:	39 d0                	cmp    %edx,%eax
+    32be:	0f 85 47 03 00 00    	jne    360b <sbrktest+0x45b>
+  a = sbrk(0);
+    32c4:	83 ec 0c             	sub    $0xc,%esp
+    32c7:	6a 00                	push   $0x0
+    32c9:	e8 23 14 00 00       	call   46f1 <sbrk>
+  c = sbrk(4096);
+    32ce:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    32d5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    32d7:	e8 15 14 00 00       	call   46f1 <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    32dc:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    32df:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    32e1:	39 c3                	cmp    %eax,%ebx
+    32e3:	0f 85 04 03 00 00    	jne    35ed <sbrktest+0x43d>
+    32e9:	83 ec 0c             	sub    $0xc,%esp
+    32ec:	6a 00                	push   $0x0
+    32ee:	e8 fe 13 00 00       	call   46f1 <sbrk>
+    32f3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    32f9:	83 c4 10             	add    $0x10,%esp
+    32fc:	39 c2                	cmp    %eax,%edx
+    32fe:	0f 85 e9 02 00 00    	jne    35ed <sbrktest+0x43d>
+  if(*lastaddr == 99){
+    3304:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    330b:	0f 84 5e 02 00 00    	je     356f <sbrktest+0x3bf>
+  a = sbrk(0);
+    3311:	83 ec 0c             	sub    $0xc,%esp
+    3314:	6a 00                	push   $0x0
+    3316:	e8 d6 13 00 00       	call   46f1 <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    331b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3322:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3324:	e8 c8 13 00 00       	call   46f1 <sbrk>
+    3329:	89 c2                	mov    %eax,%edx
+    332b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    332e:	29 d0                	sub    %edx,%eax
+    3330:	89 04 24             	mov    %eax,(%esp)
+    3333:	e8 b9 13 00 00       	call   46f1 <sbrk>
+  if(c != a){
+    3338:	83 c4 10             	add    $0x10,%esp
+    333b:	39 c3                	cmp    %eax,%ebx
+    333d:	0f 85 d2 01 00 00    	jne    3515 <sbrktest+0x365>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3343:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    334f:	90                   	nop
+    ppid = getpid();
+    3350:	e8 4b 11 00 00       	call   44a0 <getpid>
+    3355:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3357:	e8 db 11 00 00       	call   4537 <fork>
+    if(pid < 0){
+    335c:	85 c0                	test   %eax,%eax
+    335e:	0f 88 67 01 00 00    	js     34cb <sbrktest+0x31b>
+    if(pid == 0){
+    3364:	0f 84 80 01 00 00    	je     34ea <sbrktest+0x33a>
+    wait();
+    336a:	e8 fc 11 00 00       	call   456b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    336f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3375:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    337b:	75 d3                	jne    3350 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    337d:	83 ec 0c             	sub    $0xc,%esp
+    3380:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3383:	50                   	push   %eax
+    3384:	e8 fc 11 00 00       	call   4585 <pipe>
+    3389:	83 c4 10             	add    $0x10,%esp
+    338c:	85 c0                	test   %eax,%eax
+    338e:	0f 85 17 02 00 00    	jne    35ab <sbrktest+0x3fb>
+    3394:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3397:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    339a:	89 df                	mov    %ebx,%edi
+    339c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    33a0:	e8 92 11 00 00       	call   4537 <fork>
+    33a5:	89 07                	mov    %eax,(%edi)
+    33a7:	85 c0                	test   %eax,%eax
+    33a9:	0f 84 93 00 00 00    	je     3442 <sbrktest+0x292>
+    if(pids[i] != -1)
+    33af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    33b2:	74 14                	je     33c8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    33b4:	83 ec 04             	sub    $0x4,%esp
+    33b7:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    33ba:	6a 01                	push   $0x1
+    33bc:	50                   	push   %eax
+    33bd:	ff 75 b8             	push   -0x48(%ebp)
+    33c0:	e8 da 11 00 00       	call   459f <read>
+    33c5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    33c8:	83 c7 04             	add    $0x4,%edi
+    33cb:	39 f7                	cmp    %esi,%edi
+    33cd:	75 d1                	jne    33a0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    33cf:	83 ec 0c             	sub    $0xc,%esp
+    33d2:	68 00 10 00 00       	push   $0x1000
+    33d7:	e8 15 13 00 00       	call   46f1 <sbrk>
+    33dc:	83 c4 10             	add    $0x10,%esp
+    33df:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    33e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    33e8:	8b 03                	mov    (%ebx),%eax
+    33ea:	83 f8 ff             	cmp    $0xffffffff,%eax
+    33ed:	74 13                	je     3402 <sbrktest+0x252>
+    kill(pids[i], SIGKILL);
+    33ef:	83 ec 08             	sub    $0x8,%esp
+    33f2:	6a 09                	push   $0x9
+    33f4:	50                   	push   %eax
+    33f5:	e8 f3 11 00 00       	call   45ed <kill>
+    wait();
+    33fa:	e8 6c 11 00 00       	call   456b <wait>
+    33ff:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3402:	83 c3 04             	add    $0x4,%ebx
+    3405:	39 f3                	cmp    %esi,%ebx
+    3407:	75 df                	jne    33e8 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3409:	83 ff ff             	cmp    $0xffffffff,%edi
+    340c:	0f 84 7b 01 00 00    	je     358d <sbrktest+0x3dd>
+  if(sbrk(0) > oldbrk)
+    3412:	83 ec 0c             	sub    $0xc,%esp
+    3415:	6a 00                	push   $0x0
+    3417:	e8 d5 12 00 00       	call   46f1 <sbrk>
+    341c:	83 c4 10             	add    $0x10,%esp
+    341f:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3422:	72 66                	jb     348a <sbrktest+0x2da>
+  printf(stdout, "sbrk test OK\n");
+    3424:	83 ec 08             	sub    $0x8,%esp
+    3427:	68 00 5b 00 00       	push   $0x5b00
+    342c:	ff 35 80 71 00 00    	push   0x7180
+    3432:	e8 09 15 00 00       	call   4940 <printf>
+}
+    3437:	83 c4 10             	add    $0x10,%esp
+    343a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    343d:	5b                   	pop    %ebx
+    343e:	5e                   	pop    %esi
+    343f:	5f                   	pop    %edi
+    3440:	5d                   	pop    %ebp
+    3441:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3442:	83 ec 0c             	sub    $0xc,%esp
+    3445:	6a 00                	push   $0x0
+    3447:	e8 a5 12 00 00       	call   46f1 <sbrk>
+    344c:	89 c2                	mov    %eax,%edx
+    344e:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3453:	29 d0                	sub    %edx,%eax
+    3455:	89 04 24             	mov    %eax,(%esp)
+    3458:	e8 94 12 00 00       	call   46f1 <sbrk>
+      write(fds[1], "x", 1);
+    345d:	83 c4 0c             	add    $0xc,%esp
+    3460:	6a 01                	push   $0x1
+    3462:	68 c1 55 00 00       	push   $0x55c1
+    3467:	ff 75 bc             	push   -0x44(%ebp)
+    346a:	e8 4a 11 00 00       	call   45b9 <write>
+    346f:	83 c4 10             	add    $0x10,%esp
+    3472:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      for(;;) sleep(1000);
+    3478:	83 ec 0c             	sub    $0xc,%esp
+    347b:	68 e8 03 00 00       	push   $0x3e8
+    3480:	e8 86 12 00 00       	call   470b <sleep>
+    3485:	83 c4 10             	add    $0x10,%esp
+    3488:	eb ee                	jmp    3478 <sbrktest+0x2c8>
+    sbrk(-(sbrk(0) - oldbrk));
+    348a:	83 ec 0c             	sub    $0xc,%esp
+    348d:	6a 00                	push   $0x0
+    348f:	e8 5d 12 00 00       	call   46f1 <sbrk>
+    3494:	89 c2                	mov    %eax,%edx
+    3496:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3499:	29 d0                	sub    %edx,%eax
+    349b:	89 04 24             	mov    %eax,(%esp)
+    349e:	e8 4e 12 00 00       	call   46f1 <sbrk>
+    34a3:	83 c4 10             	add    $0x10,%esp
+    34a6:	e9 79 ff ff ff       	jmp    3424 <sbrktest+0x274>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    34ab:	83 ec 0c             	sub    $0xc,%esp
+    34ae:	50                   	push   %eax
+    34af:	53                   	push   %ebx
+    34b0:	56                   	push   %esi
+    34b1:	68 63 5a 00 00       	push   $0x5a63
+    34b6:	ff 35 80 71 00 00    	push   0x7180
+    34bc:	e8 7f 14 00 00       	call   4940 <printf>
+      exit(1);
+    34c1:	83 c4 14             	add    $0x14,%esp
+    34c4:	6a 01                	push   $0x1
+    34c6:	e8 86 10 00 00       	call   4551 <exit>
+      printf(stdout, "fork failed\n");
+    34cb:	83 ec 08             	sub    $0x8,%esp
+    34ce:	68 ad 5c 00 00       	push   $0x5cad
+    34d3:	ff 35 80 71 00 00    	push   0x7180
+    34d9:	e8 62 14 00 00       	call   4940 <printf>
+      exit(1);
+    34de:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    34e5:	e8 67 10 00 00       	call   4551 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    34ea:	0f be 03             	movsbl (%ebx),%eax
+    34ed:	50                   	push   %eax
+    34ee:	53                   	push   %ebx
+    34ef:	68 cc 5a 00 00       	push   $0x5acc
+    34f4:	ff 35 80 71 00 00    	push   0x7180
+    34fa:	e8 41 14 00 00       	call   4940 <printf>
+      kill(ppid, SIGKILL);
+    34ff:	59                   	pop    %ecx
+    3500:	5b                   	pop    %ebx
+    3501:	6a 09                	push   $0x9
+    3503:	56                   	push   %esi
+    3504:	e8 e4 10 00 00       	call   45ed <kill>
+      exit(1);
+    3509:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3510:	e8 3c 10 00 00       	call   4551 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3515:	50                   	push   %eax
+    3516:	53                   	push   %ebx
+    3517:	68 b0 63 00 00       	push   $0x63b0
+    351c:	ff 35 80 71 00 00    	push   0x7180
+    3522:	e8 19 14 00 00       	call   4940 <printf>
+    exit(1);
+    3527:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    352e:	e8 1e 10 00 00       	call   4551 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3533:	50                   	push   %eax
+    3534:	50                   	push   %eax
+    3535:	68 e0 62 00 00       	push   $0x62e0
+    353a:	ff 35 80 71 00 00    	push   0x7180
+    3540:	e8 fb 13 00 00       	call   4940 <printf>
+    exit(1);
+    3545:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    354c:	e8 00 10 00 00       	call   4551 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3551:	50                   	push   %eax
+    3552:	50                   	push   %eax
+    3553:	68 7e 5a 00 00       	push   $0x5a7e
+    3558:	ff 35 80 71 00 00    	push   0x7180
+    355e:	e8 dd 13 00 00       	call   4940 <printf>
+    exit(1);
+    3563:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    356a:	e8 e2 0f 00 00       	call   4551 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    356f:	56                   	push   %esi
+    3570:	56                   	push   %esi
+    3571:	68 80 63 00 00       	push   $0x6380
+    3576:	ff 35 80 71 00 00    	push   0x7180
+    357c:	e8 bf 13 00 00       	call   4940 <printf>
+    exit(1);
+    3581:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3588:	e8 c4 0f 00 00       	call   4551 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    358d:	50                   	push   %eax
+    358e:	50                   	push   %eax
+    358f:	68 e5 5a 00 00       	push   $0x5ae5
+    3594:	ff 35 80 71 00 00    	push   0x7180
+    359a:	e8 a1 13 00 00       	call   4940 <printf>
+    exit(1);
+    359f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    35a6:	e8 a6 0f 00 00       	call   4551 <exit>
+    printf(1, "pipe() failed\n");
+    35ab:	52                   	push   %edx
+    35ac:	52                   	push   %edx
+    35ad:	68 a1 4f 00 00       	push   $0x4fa1
+    35b2:	6a 01                	push   $0x1
+    35b4:	e8 87 13 00 00       	call   4940 <printf>
+    exit(1);
+    35b9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    35c0:	e8 8c 0f 00 00       	call   4551 <exit>
+    exit(0);
+    35c5:	83 ec 0c             	sub    $0xc,%esp
+    35c8:	6a 00                	push   $0x0
+    35ca:	e8 82 0f 00 00       	call   4551 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    35cf:	50                   	push   %eax
+    35d0:	50                   	push   %eax
+    35d1:	68 95 5a 00 00       	push   $0x5a95
+    35d6:	ff 35 80 71 00 00    	push   0x7180
+    35dc:	e8 5f 13 00 00       	call   4940 <printf>
+    exit(1);
+    35e1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    35e8:	e8 64 0f 00 00       	call   4551 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    35ed:	56                   	push   %esi
+    35ee:	53                   	push   %ebx
+    35ef:	68 58 63 00 00       	push   $0x6358
+    35f4:	ff 35 80 71 00 00    	push   0x7180
+    35fa:	e8 41 13 00 00       	call   4940 <printf>
+    exit(1);
+    35ff:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3606:	e8 46 0f 00 00       	call   4551 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    360b:	50                   	push   %eax
+    360c:	53                   	push   %ebx
+    360d:	68 20 63 00 00       	push   $0x6320
+    3612:	ff 35 80 71 00 00    	push   0x7180
+    3618:	e8 23 13 00 00       	call   4940 <printf>
+    exit(1);
+    361d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3624:	e8 28 0f 00 00       	call   4551 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    3629:	57                   	push   %edi
+    362a:	57                   	push   %edi
+    362b:	68 b1 5a 00 00       	push   $0x5ab1
+    3630:	ff 35 80 71 00 00    	push   0x7180
+    3636:	e8 05 13 00 00       	call   4940 <printf>
+    exit(1);
+    363b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3642:	e8 0a 0f 00 00       	call   4551 <exit>
+    3647:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    364e:	66 90                	xchg   %ax,%ax
+
+00003650 <sbrksigtest>:
+{
+    3650:	55                   	push   %ebp
+    3651:	89 e5                	mov    %esp,%ebp
+    3653:	57                   	push   %edi
+    3654:	56                   	push   %esi
+    3655:	53                   	push   %ebx
+    3656:	83 ec 34             	sub    $0x34,%esp
+  printf(stdout, "sbrk signal stack test\n");
+    3659:	68 0e 5b 00 00       	push   $0x5b0e
+    365e:	ff 35 80 71 00 00    	push   0x7180
+    3664:	e8 d7 12 00 00       	call   4940 <printf>
+  if(sigaction(SIGUSR1, &act, 0) < 0){
+    3669:	83 c4 0c             	add    $0xc,%esp
+    366c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  act.sa_handler = sbrksig_handler;
+    366f:	c7 45 e0 40 01 00 00 	movl   $0x140,-0x20(%ebp)
+  act.sigmask = 0;
+    3676:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if(sigaction(SIGUSR1, &act, 0) < 0){
+    367d:	6a 00                	push   $0x0
+    367f:	50                   	push   %eax
+    3680:	6a 0a                	push   $0xa
+    3682:	e8 b8 10 00 00       	call   473f <sigaction>
+    3687:	83 c4 10             	add    $0x10,%esp
+    368a:	85 c0                	test   %eax,%eax
+    368c:	0f 88 e9 00 00 00    	js     377b <sbrksigtest+0x12b>
+  oldbrk = sbrk(0);
+    3692:	83 ec 0c             	sub    $0xc,%esp
+    3695:	6a 00                	push   $0x0
+    3697:	e8 55 10 00 00       	call   46f1 <sbrk>
+    369c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  a = sbrk(2*4096);
+    369f:	c7 04 24 00 20 00 00 	movl   $0x2000,(%esp)
+    36a6:	e8 46 10 00 00       	call   46f1 <sbrk>
+  if(a == (char*)0xffffffff){
+    36ab:	83 c4 10             	add    $0x10,%esp
+  a = sbrk(2*4096);
+    36ae:	89 c6                	mov    %eax,%esi
+  if(a == (char*)0xffffffff){
+    36b0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    36b3:	0f 84 a4 00 00 00    	je     375d <sbrksigtest+0x10d>
+  pid = getpid();
+    36b9:	e8 e2 0d 00 00       	call   44a0 <getpid>
+               "a" (SYS_kill), "r" (a + 2*4096), "n" (T_SYSCALL),
+    36be:	81 c6 00 20 00 00    	add    $0x2000,%esi
+  sbrksig_got = 0;
+    36c4:	c7 05 44 b9 00 00 00 	movl   $0x0,0xb944
+    36cb:	00 00 00 
+  pid = getpid();
+    36ce:	89 c1                	mov    %eax,%ecx
+  asm volatile("mov %%esp, %%ebx\n\t"
+    36d0:	b8 06 00 00 00       	mov    $0x6,%eax
+    36d5:	89 cf                	mov    %ecx,%edi
+    36d7:	89 e3                	mov    %esp,%ebx
+    36d9:	89 f4                	mov    %esi,%esp
+    36db:	6a 0a                	push   $0xa
+    36dd:	57                   	push   %edi
+    36de:	6a 00                	push   $0x0
+    36e0:	cd 40                	int    $0x40
+    36e2:	89 dc                	mov    %ebx,%esp
+  if(res != 0 || sbrksig_got != SIGUSR1){
+    36e4:	85 c0                	test   %eax,%eax
+    36e6:	75 57                	jne    373f <sbrksigtest+0xef>
+    36e8:	a1 44 b9 00 00       	mov    0xb944,%eax
+    36ed:	83 f8 0a             	cmp    $0xa,%eax
+    36f0:	75 4d                	jne    373f <sbrksigtest+0xef>
+  sbrk(-(sbrk(0) - oldbrk));
+    36f2:	83 ec 0c             	sub    $0xc,%esp
+    36f5:	6a 00                	push   $0x0
+    36f7:	e8 f5 0f 00 00       	call   46f1 <sbrk>
+    36fc:	89 c2                	mov    %eax,%edx
+    36fe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    3701:	29 d0                	sub    %edx,%eax
+    3703:	89 04 24             	mov    %eax,(%esp)
+    3706:	e8 e6 0f 00 00       	call   46f1 <sbrk>
+  sigaction(SIGUSR1, &act, 0);
+    370b:	83 c4 0c             	add    $0xc,%esp
+    370e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  act.sa_handler = (void (*)(int))SIG_DFL;
+    3711:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  sigaction(SIGUSR1, &act, 0);
+    3718:	6a 00                	push   $0x0
+    371a:	50                   	push   %eax
+    371b:	6a 0a                	push   $0xa
+    371d:	e8 1d 10 00 00       	call   473f <sigaction>
+  printf(stdout, "sbrk signal stack test ok\n");
+    3722:	58                   	pop    %eax
+    3723:	5a                   	pop    %edx
+    3724:	68 45 5b 00 00       	push   $0x5b45
+    3729:	ff 35 80 71 00 00    	push   0x7180
+    372f:	e8 0c 12 00 00       	call   4940 <printf>
+}
+    3734:	83 c4 10             	add    $0x10,%esp
+    3737:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    373a:	5b                   	pop    %ebx
+    373b:	5e                   	pop    %esi
+    373c:	5f                   	pop    %edi
+    373d:	5d                   	pop    %ebp
+    373e:	c3                   	ret
+    printf(stdout, "sbrk signal stack: handler did not run\n");
+    373f:	51                   	push   %ecx
+    3740:	51                   	push   %ecx
+    3741:	68 d4 63 00 00       	push   $0x63d4
+    3746:	ff 35 80 71 00 00    	push   0x7180
+    374c:	e8 ef 11 00 00       	call   4940 <printf>
+    exit(1);
+    3751:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3758:	e8 f4 0d 00 00       	call   4551 <exit>
+    printf(stdout, "sbrk failed\n");
+    375d:	53                   	push   %ebx
+    375e:	53                   	push   %ebx
+    375f:	68 38 5b 00 00       	push   $0x5b38
+    3764:	ff 35 80 71 00 00    	push   0x7180
+    376a:	e8 d1 11 00 00       	call   4940 <printf>
+    exit(1);
+    376f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3776:	e8 d6 0d 00 00       	call   4551 <exit>
+    printf(stdout, "sigaction failed\n");
+    377b:	56                   	push   %esi
+    377c:	56                   	push   %esi
+    377d:	68 26 5b 00 00       	push   $0x5b26
+    3782:	ff 35 80 71 00 00    	push   0x7180
+    3788:	e8 b3 11 00 00       	call   4940 <printf>
+    exit(1);
+    378d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3794:	e8 b8 0d 00 00       	call   4551 <exit>
+    3799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000037a0 <txtbusytest>:
+{
+    37a0:	55                   	push   %ebp
+    37a1:	89 e5                	mov    %esp,%ebp
+    37a3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "running program write test\n");
+    37a6:	68 60 5b 00 00       	push   $0x5b60
+    37ab:	ff 35 80 71 00 00    	push   0x7180
+    37b1:	e8 8a 11 00 00       	call   4940 <printf>
+  if((fd = open("usertests", O_RDWR)) >= 0){
+    37b6:	58                   	pop    %eax
+    37b7:	5a                   	pop    %edx
+    37b8:	6a 02                	push   $0x2
+    37ba:	68 7c 5b 00 00       	push   $0x5b7c
+    37bf:	e8 5d 0e 00 00       	call   4621 <open>
+    37c4:	83 c4 10             	add    $0x10,%esp
+    37c7:	85 c0                	test   %eax,%eax
+    37c9:	79 36                	jns    3801 <txtbusytest+0x61>
+  if((fd = open("usertests", O_RDONLY)) < 0){
+    37cb:	83 ec 08             	sub    $0x8,%esp
+    37ce:	6a 00                	push   $0x0
+    37d0:	68 7c 5b 00 00       	push   $0x5b7c
+    37d5:	e8 47 0e 00 00       	call   4621 <open>
+    37da:	83 c4 10             	add    $0x10,%esp
+    37dd:	85 c0                	test   %eax,%eax
+    37df:	78 3e                	js     381f <txtbusytest+0x7f>
+  close(fd);
+    37e1:	83 ec 0c             	sub    $0xc,%esp
+    37e4:	50                   	push   %eax
+    37e5:	e8 e9 0d 00 00       	call   45d3 <close>
+  printf(stdout, "running program write test ok\n");
+    37ea:	58                   	pop    %eax
+    37eb:	5a                   	pop    %edx
+    37ec:	68 48 64 00 00       	push   $0x6448
+    37f1:	ff 35 80 71 00 00    	push   0x7180
+    37f7:	e8 44 11 00 00       	call   4940 <printf>
+}
+    37fc:	83 c4 10             	add    $0x10,%esp
+    37ff:	c9                   	leave
+    3800:	c3                   	ret
+    printf(stdout, "opened running usertests for writing\n");
+    3801:	50                   	push   %eax
+    3802:	50                   	push   %eax
+    3803:	68 fc 63 00 00       	push   $0x63fc
+    3808:	ff 35 80 71 00 00    	push   0x7180
+    380e:	e8 2d 11 00 00       	call   4940 <printf>
+    exit(1);
+    3813:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    381a:	e8 32 0d 00 00       	call   4551 <exit>
+    printf(stdout, "open usertests for reading failed\n");
+    381f:	51                   	push   %ecx
+    3820:	51                   	push   %ecx
+    3821:	68 24 64 00 00       	push   $0x6424
+    3826:	ff 35 80 71 00 00    	push   0x7180
+    382c:	e8 0f 11 00 00       	call   4940 <printf>
+    exit(1);
+    3831:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3838:	e8 14 0d 00 00       	call   4551 <exit>
+    383d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003840 <signalfdtest>:
+{
+    3840:	55                   	push   %ebp
+    3841:	89 e5                	mov    %esp,%ebp
+    3843:	57                   	push   %edi
+    3844:	56                   	push   %esi
+    3845:	53                   	push   %ebx
+    3846:	83 ec 54             	sub    $0x54,%esp
+  printf(stdout, "signalfd test\n");
+    3849:	68 86 5b 00 00       	push   $0x5b86
+    384e:	ff 35 80 71 00 00    	push   0x7180
+    3854:	e8 e7 10 00 00       	call   4940 <printf>
+  ppid = getpid();
+    3859:	e8 42 0c 00 00       	call   44a0 <getpid>
+  old = sigprocmask(1 << SIGUSR1);
+    385e:	c7 04 24 00 04 00 00 	movl   $0x400,(%esp)
+  ppid = getpid();
+    3865:	89 c6                	mov    %eax,%esi
+  old = sigprocmask(1 << SIGUSR1);
+    3867:	e8 b9 0e 00 00       	call   4725 <sigprocmask>
+    386c:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  if((fd = signalfd(1 << SIGUSR1)) < 0){
+    386f:	c7 04 24 00 04 00 00 	movl   $0x400,(%esp)
+    3876:	e8 2c 0f 00 00       	call   47a7 <signalfd>
+    387b:	83 c4 10             	add    $0x10,%esp
+    387e:	85 c0                	test   %eax,%eax
+    3880:	0f 88 2c 01 00 00    	js     39b2 <signalfdtest+0x172>
+  sigqueue(ppid, SIGUSR1, 42);
+    3886:	83 ec 04             	sub    $0x4,%esp
+    3889:	89 c3                	mov    %eax,%ebx
+  if(read(fd, info, sizeof(info[0]) - 1) != -1){
+    388b:	8d 7d b8             	lea    -0x48(%ebp),%edi
+  sigqueue(ppid, SIGUSR1, 42);
+    388e:	6a 2a                	push   $0x2a
+    3890:	6a 0a                	push   $0xa
+    3892:	56                   	push   %esi
+    3893:	e8 f5 0e 00 00       	call   478d <sigqueue>
+  sigqueue(ppid, SIGUSR1, 43);
+    3898:	83 c4 0c             	add    $0xc,%esp
+    389b:	6a 2b                	push   $0x2b
+    389d:	6a 0a                	push   $0xa
+    389f:	56                   	push   %esi
+    38a0:	e8 e8 0e 00 00       	call   478d <sigqueue>
+  if(read(fd, info, sizeof(info[0]) - 1) != -1){
+    38a5:	83 c4 0c             	add    $0xc,%esp
+    38a8:	6a 0b                	push   $0xb
+    38aa:	57                   	push   %edi
+    38ab:	53                   	push   %ebx
+    38ac:	e8 ee 0c 00 00       	call   459f <read>
+    38b1:	83 c4 10             	add    $0x10,%esp
+    38b4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    38b7:	0f 85 52 01 00 00    	jne    3a0f <signalfdtest+0x1cf>
+  n = read(fd, info, sizeof(info));
+    38bd:	83 ec 04             	sub    $0x4,%esp
+    38c0:	6a 30                	push   $0x30
+    38c2:	57                   	push   %edi
+    38c3:	53                   	push   %ebx
+    38c4:	e8 d6 0c 00 00       	call   459f <read>
+  if(n != 2 * sizeof(info[0]) ||
+    38c9:	83 c4 10             	add    $0x10,%esp
+    38cc:	83 f8 18             	cmp    $0x18,%eax
+    38cf:	0f 85 9d 00 00 00    	jne    3972 <signalfdtest+0x132>
+    38d5:	83 7d b8 0a          	cmpl   $0xa,-0x48(%ebp)
+    38d9:	0f 85 93 00 00 00    	jne    3972 <signalfdtest+0x132>
+     info[0].si_signo != SIGUSR1 || info[0].si_pid != ppid ||
+    38df:	39 75 bc             	cmp    %esi,-0x44(%ebp)
+    38e2:	0f 85 8a 00 00 00    	jne    3972 <signalfdtest+0x132>
+    38e8:	83 7d c0 2a          	cmpl   $0x2a,-0x40(%ebp)
+    38ec:	0f 85 80 00 00 00    	jne    3972 <signalfdtest+0x132>
+     info[0].si_value != 42 ||
+    38f2:	83 7d c4 0a          	cmpl   $0xa,-0x3c(%ebp)
+    38f6:	75 7a                	jne    3972 <signalfdtest+0x132>
+     info[1].si_signo != SIGUSR1 || info[1].si_value != 43){
+    38f8:	83 7d cc 2b          	cmpl   $0x2b,-0x34(%ebp)
+    38fc:	75 74                	jne    3972 <signalfdtest+0x132>
+  pid = fork();
+    38fe:	e8 34 0c 00 00       	call   4537 <fork>
+  if(pid < 0){
+    3903:	85 c0                	test   %eax,%eax
+    3905:	0f 88 c5 00 00 00    	js     39d0 <signalfdtest+0x190>
+  if(pid == 0){
+    390b:	0f 84 dd 00 00 00    	je     39ee <signalfdtest+0x1ae>
+  n = read(fd, info, sizeof(info));
+    3911:	83 ec 04             	sub    $0x4,%esp
+    3914:	89 45 b0             	mov    %eax,-0x50(%ebp)
+    3917:	6a 30                	push   $0x30
+    3919:	57                   	push   %edi
+    391a:	53                   	push   %ebx
+    391b:	e8 7f 0c 00 00       	call   459f <read>
+    3920:	89 c6                	mov    %eax,%esi
+  wait();
+    3922:	e8 44 0c 00 00       	call   456b <wait>
+  if(n != sizeof(info[0]) || info[0].si_signo != SIGUSR1 ||
+    3927:	83 c4 10             	add    $0x10,%esp
+    392a:	83 fe 0c             	cmp    $0xc,%esi
+    392d:	75 63                	jne    3992 <signalfdtest+0x152>
+    392f:	83 7d b8 0a          	cmpl   $0xa,-0x48(%ebp)
+    3933:	75 5d                	jne    3992 <signalfdtest+0x152>
+    3935:	8b 55 b0             	mov    -0x50(%ebp),%edx
+    3938:	39 55 bc             	cmp    %edx,-0x44(%ebp)
+    393b:	75 55                	jne    3992 <signalfdtest+0x152>
+     info[0].si_pid != pid || info[0].si_value != 7){
+    393d:	83 7d c0 07          	cmpl   $0x7,-0x40(%ebp)
+    3941:	75 4f                	jne    3992 <signalfdtest+0x152>
+  close(fd);
+    3943:	83 ec 0c             	sub    $0xc,%esp
+    3946:	53                   	push   %ebx
+    3947:	e8 87 0c 00 00       	call   45d3 <close>
+  sigprocmask(old);
+    394c:	58                   	pop    %eax
+    394d:	ff 75 b4             	push   -0x4c(%ebp)
+    3950:	e8 d0 0d 00 00       	call   4725 <sigprocmask>
+  printf(stdout, "signalfd test ok\n");
+    3955:	5a                   	pop    %edx
+    3956:	59                   	pop    %ecx
+    3957:	68 a6 5b 00 00       	push   $0x5ba6
+    395c:	ff 35 80 71 00 00    	push   0x7180
+    3962:	e8 d9 0f 00 00       	call   4940 <printf>
+}
+    3967:	83 c4 10             	add    $0x10,%esp
+    396a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    396d:	5b                   	pop    %ebx
+    396e:	5e                   	pop    %esi
+    396f:	5f                   	pop    %edi
+    3970:	5d                   	pop    %ebp
+    3971:	c3                   	ret
+    printf(stdout, "signalfd read %d bytes, wrong records\n", n);
+    3972:	83 ec 04             	sub    $0x4,%esp
+    3975:	50                   	push   %eax
+    3976:	68 98 64 00 00       	push   $0x6498
+    397b:	ff 35 80 71 00 00    	push   0x7180
+    3981:	e8 ba 0f 00 00       	call   4940 <printf>
+    exit(1);
+    3986:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    398d:	e8 bf 0b 00 00       	call   4551 <exit>
+    printf(stdout, "signalfd blocking read %d bytes, wrong record\n", n);
+    3992:	83 ec 04             	sub    $0x4,%esp
+    3995:	56                   	push   %esi
+    3996:	68 c0 64 00 00       	push   $0x64c0
+    399b:	ff 35 80 71 00 00    	push   0x7180
+    39a1:	e8 9a 0f 00 00       	call   4940 <printf>
+    exit(1);
+    39a6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    39ad:	e8 9f 0b 00 00       	call   4551 <exit>
+    printf(stdout, "signalfd failed\n");
+    39b2:	50                   	push   %eax
+    39b3:	50                   	push   %eax
+    39b4:	68 95 5b 00 00       	push   $0x5b95
+    39b9:	ff 35 80 71 00 00    	push   0x7180
+    39bf:	e8 7c 0f 00 00       	call   4940 <printf>
+    exit(1);
+    39c4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    39cb:	e8 81 0b 00 00       	call   4551 <exit>
+    printf(stdout, "fork failed\n");
+    39d0:	56                   	push   %esi
+    39d1:	56                   	push   %esi
+    39d2:	68 ad 5c 00 00       	push   $0x5cad
+    39d7:	ff 35 80 71 00 00    	push   0x7180
+    39dd:	e8 5e 0f 00 00       	call   4940 <printf>
+    exit(1);
+    39e2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    39e9:	e8 63 0b 00 00       	call   4551 <exit>
+    sleep(5);
+    39ee:	83 ec 0c             	sub    $0xc,%esp
+    exit(0);
+    39f1:	31 db                	xor    %ebx,%ebx
+    sleep(5);
+    39f3:	6a 05                	push   $0x5
+    39f5:	e8 11 0d 00 00       	call   470b <sleep>
+    sigqueue(ppid, SIGUSR1, 7);
+    39fa:	83 c4 0c             	add    $0xc,%esp
+    39fd:	6a 07                	push   $0x7
+    39ff:	6a 0a                	push   $0xa
+    3a01:	56                   	push   %esi
+    3a02:	e8 86 0d 00 00       	call   478d <sigqueue>
+    exit(0);
+    3a07:	89 1c 24             	mov    %ebx,(%esp)
+    3a0a:	e8 42 0b 00 00       	call   4551 <exit>
+    printf(stdout, "signalfd read of part of a record succeeded\n");
+    3a0f:	57                   	push   %edi
+    3a10:	57                   	push   %edi
+    3a11:	68 68 64 00 00       	push   $0x6468
+    3a16:	ff 35 80 71 00 00    	push   0x7180
+    3a1c:	e8 1f 0f 00 00       	call   4940 <printf>
+    exit(1);
+    3a21:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3a28:	e8 24 0b 00 00       	call   4551 <exit>
+    3a2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003a30 <sigsuspendtest>:
+{
+    3a30:	55                   	push   %ebp
+    3a31:	89 e5                	mov    %esp,%ebp
+    3a33:	56                   	push   %esi
+    3a34:	53                   	push   %ebx
+  if(sigaction(SIGUSR1, &act, 0) < 0 || sigaction(SIGALRM, &act, 0) < 0){
+    3a35:	8d 5d f0             	lea    -0x10(%ebp),%ebx
+{
+    3a38:	83 ec 18             	sub    $0x18,%esp
+  printf(stdout, "sigsuspend test\n");
+    3a3b:	68 b8 5b 00 00       	push   $0x5bb8
+    3a40:	ff 35 80 71 00 00    	push   0x7180
+    3a46:	e8 f5 0e 00 00       	call   4940 <printf>
+  if(sigaction(SIGUSR1, &act, 0) < 0 || sigaction(SIGALRM, &act, 0) < 0){
+    3a4b:	83 c4 0c             	add    $0xc,%esp
+  act.sa_handler = suspend_handler;
+    3a4e:	c7 45 f0 50 01 00 00 	movl   $0x150,-0x10(%ebp)
+  act.sigmask = 0;
+    3a55:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(sigaction(SIGUSR1, &act, 0) < 0 || sigaction(SIGALRM, &act, 0) < 0){
+    3a5c:	6a 00                	push   $0x0
+    3a5e:	53                   	push   %ebx
+    3a5f:	6a 0a                	push   $0xa
+    3a61:	e8 d9 0c 00 00       	call   473f <sigaction>
+    3a66:	83 c4 10             	add    $0x10,%esp
+    3a69:	85 c0                	test   %eax,%eax
+    3a6b:	0f 88 0d 01 00 00    	js     3b7e <sigsuspendtest+0x14e>
+    3a71:	83 ec 04             	sub    $0x4,%esp
+    3a74:	6a 00                	push   $0x0
+    3a76:	53                   	push   %ebx
+    3a77:	6a 0e                	push   $0xe
+    3a79:	e8 c1 0c 00 00       	call   473f <sigaction>
+    3a7e:	83 c4 10             	add    $0x10,%esp
+    3a81:	85 c0                	test   %eax,%eax
+    3a83:	0f 88 f5 00 00 00    	js     3b7e <sigsuspendtest+0x14e>
+  old = sigprocmask(mask);
+    3a89:	83 ec 0c             	sub    $0xc,%esp
+    3a8c:	68 00 44 00 00       	push   $0x4400
+    3a91:	e8 8f 0c 00 00       	call   4725 <sigprocmask>
+  suspend_got = 0;
+    3a96:	c7 05 40 b9 00 00 00 	movl   $0x0,0xb940
+    3a9d:	00 00 00 
+  old = sigprocmask(mask);
+    3aa0:	89 c6                	mov    %eax,%esi
+  kill(getpid(), SIGUSR1);
+    3aa2:	e8 f9 09 00 00       	call   44a0 <getpid>
+    3aa7:	5a                   	pop    %edx
+    3aa8:	59                   	pop    %ecx
+    3aa9:	6a 0a                	push   $0xa
+    3aab:	50                   	push   %eax
+    3aac:	e8 3c 0b 00 00       	call   45ed <kill>
+  if(suspend_got != 0){
+    3ab1:	a1 40 b9 00 00       	mov    0xb940,%eax
+    3ab6:	83 c4 10             	add    $0x10,%esp
+    3ab9:	85 c0                	test   %eax,%eax
+    3abb:	0f 85 23 01 00 00    	jne    3be4 <sigsuspendtest+0x1b4>
+  sigsuspend(mask & ~(1 << SIGUSR1));
+    3ac1:	83 ec 0c             	sub    $0xc,%esp
+    3ac4:	68 00 40 00 00       	push   $0x4000
+    3ac9:	e8 0d 0d 00 00       	call   47db <sigsuspend>
+  cur = sigprocmask(mask);
+    3ace:	c7 04 24 00 44 00 00 	movl   $0x4400,(%esp)
+    3ad5:	e8 4b 0c 00 00       	call   4725 <sigprocmask>
+  if(suspend_got != SIGUSR1 || cur != mask){
+    3ada:	8b 15 40 b9 00 00    	mov    0xb940,%edx
+    3ae0:	83 c4 10             	add    $0x10,%esp
+    3ae3:	83 fa 0a             	cmp    $0xa,%edx
+    3ae6:	0f 85 d4 00 00 00    	jne    3bc0 <sigsuspendtest+0x190>
+    3aec:	3d 00 44 00 00       	cmp    $0x4400,%eax
+    3af1:	0f 85 c9 00 00 00    	jne    3bc0 <sigsuspendtest+0x190>
+  suspend_got = 0;
+    3af7:	c7 05 40 b9 00 00 00 	movl   $0x0,0xb940
+    3afe:	00 00 00 
+  alarm(2);
+    3b01:	83 ec 0c             	sub    $0xc,%esp
+    3b04:	6a 02                	push   $0x2
+    3b06:	e8 55 09 00 00       	call   4460 <alarm>
+  sigsuspend(mask & ~(1 << SIGALRM));
+    3b0b:	c7 04 24 00 04 00 00 	movl   $0x400,(%esp)
+    3b12:	e8 c4 0c 00 00       	call   47db <sigsuspend>
+  cur = sigprocmask(mask);
+    3b17:	c7 04 24 00 44 00 00 	movl   $0x4400,(%esp)
+    3b1e:	e8 02 0c 00 00       	call   4725 <sigprocmask>
+  if(suspend_got != SIGALRM || cur != mask){
+    3b23:	8b 15 40 b9 00 00    	mov    0xb940,%edx
+    3b29:	83 c4 10             	add    $0x10,%esp
+    3b2c:	3d 00 44 00 00       	cmp    $0x4400,%eax
+    3b31:	75 69                	jne    3b9c <sigsuspendtest+0x16c>
+    3b33:	83 fa 0e             	cmp    $0xe,%edx
+    3b36:	75 64                	jne    3b9c <sigsuspendtest+0x16c>
+  sigprocmask(old);
+    3b38:	83 ec 0c             	sub    $0xc,%esp
+    3b3b:	56                   	push   %esi
+    3b3c:	e8 e4 0b 00 00       	call   4725 <sigprocmask>
+  sigaction(SIGUSR1, &act, 0);
+    3b41:	83 c4 0c             	add    $0xc,%esp
+  act.sa_handler = (void (*)(int))SIG_DFL;
+    3b44:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  sigaction(SIGUSR1, &act, 0);
+    3b4b:	6a 00                	push   $0x0
+    3b4d:	53                   	push   %ebx
+    3b4e:	6a 0a                	push   $0xa
+    3b50:	e8 ea 0b 00 00       	call   473f <sigaction>
+  sigaction(SIGALRM, &act, 0);
+    3b55:	83 c4 0c             	add    $0xc,%esp
+    3b58:	6a 00                	push   $0x0
+    3b5a:	53                   	push   %ebx
+    3b5b:	6a 0e                	push   $0xe
+    3b5d:	e8 dd 0b 00 00       	call   473f <sigaction>
+  printf(stdout, "sigsuspend test ok\n");
+    3b62:	58                   	pop    %eax
+    3b63:	5a                   	pop    %edx
+    3b64:	68 c9 5b 00 00       	push   $0x5bc9
+    3b69:	ff 35 80 71 00 00    	push   0x7180
+    3b6f:	e8 cc 0d 00 00       	call   4940 <printf>
+}
+    3b74:	83 c4 10             	add    $0x10,%esp
+    3b77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3b7a:	5b                   	pop    %ebx
+    3b7b:	5e                   	pop    %esi
+    3b7c:	5d                   	pop    %ebp
+    3b7d:	c3                   	ret
+    printf(stdout, "sigaction failed\n");
+    3b7e:	53                   	push   %ebx
+    3b7f:	53                   	push   %ebx
+    3b80:	68 26 5b 00 00       	push   $0x5b26
+    3b85:	ff 35 80 71 00 00    	push   0x7180
+    3b8b:	e8 b0 0d 00 00       	call   4940 <printf>
+    exit(1);
+    3b90:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3b97:	e8 b5 09 00 00       	call   4551 <exit>
+    printf(stdout, "sigsuspend SIGALRM got %d mask %x\n", suspend_got, cur);
+    3b9c:	8b 15 40 b9 00 00    	mov    0xb940,%edx
+    3ba2:	50                   	push   %eax
+    3ba3:	52                   	push   %edx
+    3ba4:	68 34 65 00 00       	push   $0x6534
+    3ba9:	ff 35 80 71 00 00    	push   0x7180
+    3baf:	e8 8c 0d 00 00       	call   4940 <printf>
+    exit(1);
+    3bb4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3bbb:	e8 91 09 00 00       	call   4551 <exit>
+    printf(stdout, "sigsuspend SIGUSR1 got %d mask %x\n", suspend_got, cur);
+    3bc0:	8b 15 40 b9 00 00    	mov    0xb940,%edx
+    3bc6:	50                   	push   %eax
+    3bc7:	52                   	push   %edx
+    3bc8:	68 10 65 00 00       	push   $0x6510
+    3bcd:	ff 35 80 71 00 00    	push   0x7180
+    3bd3:	e8 68 0d 00 00       	call   4940 <printf>
+    exit(1);
+    3bd8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3bdf:	e8 6d 09 00 00       	call   4551 <exit>
+    printf(stdout, "blocked SIGUSR1 was delivered\n");
+    3be4:	51                   	push   %ecx
+    3be5:	51                   	push   %ecx
+    3be6:	68 f0 64 00 00       	push   $0x64f0
+    3beb:	ff 35 80 71 00 00    	push   0x7180
+    3bf1:	e8 4a 0d 00 00       	call   4940 <printf>
+    exit(1);
+    3bf6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3bfd:	e8 4f 09 00 00       	call   4551 <exit>
+    3c02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003c10 <nanosleeptest>:
+{
+    3c10:	55                   	push   %ebp
+    3c11:	89 e5                	mov    %esp,%ebp
+    3c13:	53                   	push   %ebx
+    3c14:	83 ec 2c             	sub    $0x2c,%esp
+  printf(stdout, "nanosleep test\n");
+    3c17:	68 dd 5b 00 00       	push   $0x5bdd
+    3c1c:	ff 35 80 71 00 00    	push   0x7180
+    3c22:	e8 19 0d 00 00       	call   4940 <printf>
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+    3c27:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  req.tv_sec = 2;
+    3c2a:	c7 45 e0 02 00 00 00 	movl   $0x2,-0x20(%ebp)
+  req.tv_nsec = 500000000;
+    3c31:	c7 45 e4 00 65 cd 1d 	movl   $0x1dcd6500,-0x1c(%ebp)
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+    3c38:	59                   	pop    %ecx
+    3c39:	5b                   	pop    %ebx
+    3c3a:	50                   	push   %eax
+    3c3b:	6a 01                	push   $0x1
+    3c3d:	e8 7e 08 00 00       	call   44c0 <clock_gettime>
+  if(nanosleep(&req) < 0){
+    3c42:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    3c45:	89 04 24             	mov    %eax,(%esp)
+    3c48:	e8 dc 0b 00 00       	call   4829 <nanosleep>
+    3c4d:	83 c4 10             	add    $0x10,%esp
+    3c50:	85 c0                	test   %eax,%eax
+    3c52:	78 5c                	js     3cb0 <nanosleeptest+0xa0>
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+    3c54:	83 ec 08             	sub    $0x8,%esp
+    3c57:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    3c5a:	50                   	push   %eax
+    3c5b:	6a 01                	push   $0x1
+    3c5d:	e8 5e 08 00 00       	call   44c0 <clock_gettime>
+       ((int)t1.tv_nsec - (int)t0.tv_nsec) / 1000000;
+    3c62:	b8 83 de 1b 43       	mov    $0x431bde83,%eax
+    3c67:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    3c6a:	2b 5d ec             	sub    -0x14(%ebp),%ebx
+    3c6d:	f7 eb                	imul   %ebx
+  ms = (t1.tv_sec - t0.tv_sec) * 1000 +
+    3c6f:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    3c72:	2b 4d e8             	sub    -0x18(%ebp),%ecx
+       ((int)t1.tv_nsec - (int)t0.tv_nsec) / 1000000;
+    3c75:	c1 fb 1f             	sar    $0x1f,%ebx
+  ms = (t1.tv_sec - t0.tv_sec) * 1000 +
+    3c78:	69 c9 e8 03 00 00    	imul   $0x3e8,%ecx,%ecx
+  if(ms < 2500 || ms > 3500){
+    3c7e:	83 c4 10             	add    $0x10,%esp
+       ((int)t1.tv_nsec - (int)t0.tv_nsec) / 1000000;
+    3c81:	c1 fa 12             	sar    $0x12,%edx
+    3c84:	29 da                	sub    %ebx,%edx
+  ms = (t1.tv_sec - t0.tv_sec) * 1000 +
+    3c86:	01 d1                	add    %edx,%ecx
+  if(ms < 2500 || ms > 3500){
+    3c88:	8d 81 3c f6 ff ff    	lea    -0x9c4(%ecx),%eax
+    3c8e:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    3c93:	77 39                	ja     3cce <nanosleeptest+0xbe>
+  printf(stdout, "nanosleep test ok\n");
+    3c95:	83 ec 08             	sub    $0x8,%esp
+    3c98:	68 ff 5b 00 00       	push   $0x5bff
+    3c9d:	ff 35 80 71 00 00    	push   0x7180
+    3ca3:	e8 98 0c 00 00       	call   4940 <printf>
+}
+    3ca8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3cab:	83 c4 10             	add    $0x10,%esp
+    3cae:	c9                   	leave
+    3caf:	c3                   	ret
+    printf(stdout, "nanosleep failed\n");
+    3cb0:	52                   	push   %edx
+    3cb1:	52                   	push   %edx
+    3cb2:	68 ed 5b 00 00       	push   $0x5bed
+    3cb7:	ff 35 80 71 00 00    	push   0x7180
+    3cbd:	e8 7e 0c 00 00       	call   4940 <printf>
+    exit(1);
+    3cc2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3cc9:	e8 83 08 00 00       	call   4551 <exit>
+    printf(stdout, "nanosleep 2500 ms slept %d ms\n", ms);
+    3cce:	50                   	push   %eax
+    3ccf:	51                   	push   %ecx
+    3cd0:	68 58 65 00 00       	push   $0x6558
+    3cd5:	ff 35 80 71 00 00    	push   0x7180
+    3cdb:	e8 60 0c 00 00       	call   4940 <printf>
+    exit(1);
+    3ce0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3ce7:	e8 65 08 00 00       	call   4551 <exit>
+    3cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003cf0 <validateint>:
+}
+    3cf0:	c3                   	ret
+    3cf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3cff:	90                   	nop
+
+00003d00 <validatetest>:
+{
+    3d00:	55                   	push   %ebp
+    3d01:	89 e5                	mov    %esp,%ebp
+    3d03:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3d04:	31 f6                	xor    %esi,%esi
+{
+    3d06:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3d07:	83 ec 08             	sub    $0x8,%esp
+    3d0a:	68 12 5c 00 00       	push   $0x5c12
+    3d0f:	ff 35 80 71 00 00    	push   0x7180
+    3d15:	e8 26 0c 00 00       	call   4940 <printf>
+    3d1a:	83 c4 10             	add    $0x10,%esp
+    3d1d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3d20:	e8 12 08 00 00       	call   4537 <fork>
+    3d25:	89 c3                	mov    %eax,%ebx
+    3d27:	85 c0                	test   %eax,%eax
+    3d29:	74 65                	je     3d90 <validatetest+0x90>
+    sleep(0);
+    3d2b:	83 ec 0c             	sub    $0xc,%esp
+    3d2e:	6a 00                	push   $0x0
+    3d30:	e8 d6 09 00 00       	call   470b <sleep>
+    sleep(0);
+    3d35:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3d3c:	e8 ca 09 00 00       	call   470b <sleep>
+    kill(pid, SIGKILL);
+    3d41:	58                   	pop    %eax
+    3d42:	5a                   	pop    %edx
+    3d43:	6a 09                	push   $0x9
+    3d45:	53                   	push   %ebx
+    3d46:	e8 a2 08 00 00       	call   45ed <kill>
+    wait();
+    3d4b:	e8 1b 08 00 00       	call   456b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3d50:	59                   	pop    %ecx
+    3d51:	5b                   	pop    %ebx
+    3d52:	56                   	push   %esi
+    3d53:	68 21 5c 00 00       	push   $0x5c21
+    3d58:	e8 2c 09 00 00       	call   4689 <link>
+    3d5d:	83 c4 10             	add    $0x10,%esp
+    3d60:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d63:	75 35                	jne    3d9a <validatetest+0x9a>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3d65:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3d6b:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    3d71:	75 ad                	jne    3d20 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3d73:	83 ec 08             	sub    $0x8,%esp
+    3d76:	68 45 5c 00 00       	push   $0x5c45
+    3d7b:	ff 35 80 71 00 00    	push   0x7180
+    3d81:	e8 ba 0b 00 00       	call   4940 <printf>
+}
+    3d86:	83 c4 10             	add    $0x10,%esp
+    3d89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3d8c:	5b                   	pop    %ebx
+    3d8d:	5e                   	pop    %esi
+    3d8e:	5d                   	pop    %ebp
+    3d8f:	c3                   	ret
+      exit(0);
+    3d90:	83 ec 0c             	sub    $0xc,%esp
+    3d93:	6a 00                	push   $0x0
+    3d95:	e8 b7 07 00 00       	call   4551 <exit>
+      printf(stdout, "link should not succeed\n");
+    3d9a:	83 ec 08             	sub    $0x8,%esp
+    3d9d:	68 2c 5c 00 00       	push   $0x5c2c
+    3da2:	ff 35 80 71 00 00    	push   0x7180
+    3da8:	e8 93 0b 00 00       	call   4940 <printf>
+      exit(1);
+    3dad:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3db4:	e8 98 07 00 00       	call   4551 <exit>
+    3db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003dc0 <bsstest>:
+{
+    3dc0:	55                   	push   %ebp
+    3dc1:	89 e5                	mov    %esp,%ebp
+    3dc3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3dc6:	68 52 5c 00 00       	push   $0x5c52
+    3dcb:	ff 35 80 71 00 00    	push   0x7180
+    3dd1:	e8 6a 0b 00 00       	call   4940 <printf>
+    3dd6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3dd9:	31 c0                	xor    %eax,%eax
+    3ddb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3ddf:	90                   	nop
+    if(uninit[i] != '\0'){
+    3de0:	80 b8 a0 71 00 00 00 	cmpb   $0x0,0x71a0(%eax)
+    3de7:	75 22                	jne    3e0b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3de9:	83 c0 01             	add    $0x1,%eax
+    3dec:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3df1:	75 ed                	jne    3de0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3df3:	83 ec 08             	sub    $0x8,%esp
+    3df6:	68 6d 5c 00 00       	push   $0x5c6d
+    3dfb:	ff 35 80 71 00 00    	push   0x7180
+    3e01:	e8 3a 0b 00 00       	call   4940 <printf>
+}
+    3e06:	83 c4 10             	add    $0x10,%esp
+    3e09:	c9                   	leave
+    3e0a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    3e0b:	83 ec 08             	sub    $0x8,%esp
+    3e0e:	68 5c 5c 00 00       	push   $0x5c5c
+    3e13:	ff 35 80 71 00 00    	push   0x7180
+    3e19:	e8 22 0b 00 00       	call   4940 <printf>
+      exit(1);
+    3e1e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3e25:	e8 27 07 00 00       	call   4551 <exit>
+    3e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003e30 <bigargtest>:
+{
+    3e30:	55                   	push   %ebp
+    3e31:	89 e5                	mov    %esp,%ebp
+    3e33:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3e36:	68 7a 5c 00 00       	push   $0x5c7a
+    3e3b:	e8 15 08 00 00       	call   4655 <unlink>
+  pid = fork();
+    3e40:	e8 f2 06 00 00       	call   4537 <fork>
+  if(pid == 0){
+    3e45:	83 c4 10             	add    $0x10,%esp
+    3e48:	85 c0                	test   %eax,%eax
+    3e4a:	74 44                	je     3e90 <bigargtest+0x60>
+  } else if(pid < 0){
+    3e4c:	0f 88 cf 00 00 00    	js     3f21 <bigargtest+0xf1>
+  wait();
+    3e52:	e8 14 07 00 00       	call   456b <wait>
+  fd = open("bigarg-ok", 0);
+    3e57:	83 ec 08             	sub    $0x8,%esp
+    3e5a:	6a 00                	push   $0x0
+    3e5c:	68 7a 5c 00 00       	push   $0x5c7a
+    3e61:	e8 bb 07 00 00       	call   4621 <open>
+  if(fd < 0){
+    3e66:	83 c4 10             	add    $0x10,%esp
+    3e69:	85 c0                	test   %eax,%eax
+    3e6b:	0f 88 92 00 00 00    	js     3f03 <bigargtest+0xd3>
+  close(fd);
+    3e71:	83 ec 0c             	sub    $0xc,%esp
+    3e74:	50                   	push   %eax
+    3e75:	e8 59 07 00 00       	call   45d3 <close>
+  unlink("bigarg-ok");
+    3e7a:	c7 04 24 7a 5c 00 00 	movl   $0x5c7a,(%esp)
+    3e81:	e8 cf 07 00 00       	call   4655 <unlink>
+}
+    3e86:	83 c4 10             	add    $0x10,%esp
+    3e89:	c9                   	leave
+    3e8a:	c3                   	ret
+    3e8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3e8f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3e90:	c7 04 85 c0 b8 00 00 	movl   $0x6578,0xb8c0(,%eax,4)
+    3e97:	78 65 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3e9b:	83 c0 01             	add    $0x1,%eax
+    3e9e:	83 f8 1f             	cmp    $0x1f,%eax
+    3ea1:	75 ed                	jne    3e90 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3ea3:	31 c9                	xor    %ecx,%ecx
+    3ea5:	89 0d 3c b9 00 00    	mov    %ecx,0xb93c
+    printf(stdout, "bigarg test\n");
+    3eab:	50                   	push   %eax
+    3eac:	50                   	push   %eax
+    3ead:	68 84 5c 00 00       	push   $0x5c84
+    3eb2:	ff 35 80 71 00 00    	push   0x7180
+    3eb8:	e8 83 0a 00 00       	call   4940 <printf>
+    exec("echo", args);
+    3ebd:	58                   	pop    %eax
+    3ebe:	5a                   	pop    %edx
+    3ebf:	68 c0 b8 00 00       	push   $0xb8c0
+    3ec4:	68 4d 4d 00 00       	push   $0x4d4d
+    3ec9:	e8 39 07 00 00       	call   4607 <exec>
+    printf(stdout, "bigarg test ok\n");
+    3ece:	59                   	pop    %ecx
+    3ecf:	58                   	pop    %eax
+    3ed0:	68 91 5c 00 00       	push   $0x5c91
+    3ed5:	ff 35 80 71 00 00    	push   0x7180
+    3edb:	e8 60 0a 00 00       	call   4940 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3ee0:	58                   	pop    %eax
+    3ee1:	5a                   	pop    %edx
+    3ee2:	68 00 02 00 00       	push   $0x200
+    3ee7:	68 7a 5c 00 00       	push   $0x5c7a
+    3eec:	e8 30 07 00 00       	call   4621 <open>
+    close(fd);
+    3ef1:	89 04 24             	mov    %eax,(%esp)
+    3ef4:	e8 da 06 00 00       	call   45d3 <close>
+    exit(0);
+    3ef9:	31 c9                	xor    %ecx,%ecx
+    3efb:	89 0c 24             	mov    %ecx,(%esp)
+    3efe:	e8 4e 06 00 00       	call   4551 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    3f03:	50                   	push   %eax
+    3f04:	50                   	push   %eax
+    3f05:	68 ba 5c 00 00       	push   $0x5cba
+    3f0a:	ff 35 80 71 00 00    	push   0x7180
+    3f10:	e8 2b 0a 00 00       	call   4940 <printf>
+    exit(1);
+    3f15:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3f1c:	e8 30 06 00 00       	call   4551 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3f21:	52                   	push   %edx
+    3f22:	52                   	push   %edx
+    3f23:	68 a1 5c 00 00       	push   $0x5ca1
+    3f28:	ff 35 80 71 00 00    	push   0x7180
+    3f2e:	e8 0d 0a 00 00       	call   4940 <printf>
+    exit(1);
+    3f33:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3f3a:	e8 12 06 00 00       	call   4551 <exit>
+    3f3f:	90                   	nop
+
+00003f40 <fsfull>:
+{
+    3f40:	55                   	push   %ebp
+    3f41:	89 e5                	mov    %esp,%ebp
+    3f43:	57                   	push   %edi
+    3f44:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3f45:	31 f6                	xor    %esi,%esi
+{
+    3f47:	53                   	push   %ebx
+    3f48:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    3f4b:	68 cf 5c 00 00       	push   $0x5ccf
+    3f50:	6a 01                	push   $0x1
+    3f52:	e8 e9 09 00 00       	call   4940 <printf>
+    3f57:	83 c4 10             	add    $0x10,%esp
+    3f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3f60:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3f65:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    3f6a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    3f6d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3f71:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    3f73:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3f77:	c1 ea 06             	shr    $0x6,%edx
+    3f7a:	8d 42 30             	lea    0x30(%edx),%eax
+    3f7d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3f80:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3f86:	89 f2                	mov    %esi,%edx
+    3f88:	29 c2                	sub    %eax,%edx
+    3f8a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    3f8f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3f91:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3f96:	c1 ea 05             	shr    $0x5,%edx
+    3f99:	83 c2 30             	add    $0x30,%edx
+    3f9c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3f9f:	f7 e6                	mul    %esi
+    3fa1:	c1 ea 05             	shr    $0x5,%edx
+    3fa4:	6b c2 64             	imul   $0x64,%edx,%eax
+    3fa7:	89 f2                	mov    %esi,%edx
+    3fa9:	29 c2                	sub    %eax,%edx
+    3fab:	89 d0                	mov    %edx,%eax
+    3fad:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3faf:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3fb1:	c1 ea 03             	shr    $0x3,%edx
+    3fb4:	83 c2 30             	add    $0x30,%edx
+    3fb7:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3fba:	f7 e1                	mul    %ecx
+    3fbc:	89 f0                	mov    %esi,%eax
+    3fbe:	c1 ea 03             	shr    $0x3,%edx
+    3fc1:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3fc4:	01 d2                	add    %edx,%edx
+    3fc6:	29 d0                	sub    %edx,%eax
+    3fc8:	83 c0 30             	add    $0x30,%eax
+    3fcb:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    3fce:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3fd1:	50                   	push   %eax
+    3fd2:	68 dc 5c 00 00       	push   $0x5cdc
+    3fd7:	6a 01                	push   $0x1
+    3fd9:	e8 62 09 00 00       	call   4940 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    3fde:	58                   	pop    %eax
+    3fdf:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3fe2:	5a                   	pop    %edx
+    3fe3:	68 02 02 00 00       	push   $0x202
+    3fe8:	50                   	push   %eax
+    3fe9:	e8 33 06 00 00       	call   4621 <open>
+    if(fd < 0){
+    3fee:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3ff1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3ff3:	85 c0                	test   %eax,%eax
+    3ff5:	78 4f                	js     4046 <fsfull+0x106>
+    int total = 0;
+    3ff7:	31 db                	xor    %ebx,%ebx
+    3ff9:	eb 07                	jmp    4002 <fsfull+0xc2>
+    3ffb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3fff:	90                   	nop
+      total += cc;
+    4000:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4002:	83 ec 04             	sub    $0x4,%esp
+    4005:	68 00 02 00 00       	push   $0x200
+    400a:	68 c0 98 00 00       	push   $0x98c0
+    400f:	57                   	push   %edi
+    4010:	e8 a4 05 00 00       	call   45b9 <write>
+      if(cc < 512)
+    4015:	83 c4 10             	add    $0x10,%esp
+    4018:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    401d:	7f e1                	jg     4000 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    401f:	83 ec 04             	sub    $0x4,%esp
+    4022:	53                   	push   %ebx
+    4023:	68 f8 5c 00 00       	push   $0x5cf8
+    4028:	6a 01                	push   $0x1
+    402a:	e8 11 09 00 00       	call   4940 <printf>
+    close(fd);
+    402f:	89 3c 24             	mov    %edi,(%esp)
+    4032:	e8 9c 05 00 00       	call   45d3 <close>
+    if(total == 0)
+    4037:	83 c4 10             	add    $0x10,%esp
+    403a:	85 db                	test   %ebx,%ebx
+    403c:	74 1e                	je     405c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    403e:	83 c6 01             	add    $0x1,%esi
+    4041:	e9 1a ff ff ff       	jmp    3f60 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    4046:	83 ec 04             	sub    $0x4,%esp
+    4049:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    404c:	50                   	push   %eax
+    404d:	68 e8 5c 00 00       	push   $0x5ce8
+    4052:	6a 01                	push   $0x1
+    4054:	e8 e7 08 00 00       	call   4940 <printf>
+      break;
+    4059:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    405c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4061:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    4066:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    406d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4070:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    4072:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    4075:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4079:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    407b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    407f:	c1 ea 06             	shr    $0x6,%edx
+    4082:	8d 42 30             	lea    0x30(%edx),%eax
+    4085:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4088:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    408e:	89 f2                	mov    %esi,%edx
+    4090:	29 c2                	sub    %eax,%edx
+    4092:	89 d0                	mov    %edx,%eax
+    4094:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4096:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4098:	c1 ea 05             	shr    $0x5,%edx
+    409b:	83 c2 30             	add    $0x30,%edx
+    409e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    40a1:	f7 e3                	mul    %ebx
+    40a3:	c1 ea 05             	shr    $0x5,%edx
+    40a6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    40a9:	89 f2                	mov    %esi,%edx
+    40ab:	29 ca                	sub    %ecx,%edx
+    40ad:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    40b2:	89 d0                	mov    %edx,%eax
+    40b4:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    40b6:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    40b8:	c1 ea 03             	shr    $0x3,%edx
+    40bb:	83 c2 30             	add    $0x30,%edx
+    40be:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    40c1:	f7 e1                	mul    %ecx
+    40c3:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    40c5:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    40c8:	c1 ea 03             	shr    $0x3,%edx
+    40cb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    40ce:	01 d2                	add    %edx,%edx
+    40d0:	29 d0                	sub    %edx,%eax
+    40d2:	83 c0 30             	add    $0x30,%eax
+    40d5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    40d8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    40db:	50                   	push   %eax
+    40dc:	e8 74 05 00 00       	call   4655 <unlink>
+  while(nfiles >= 0){
+    40e1:	83 c4 10             	add    $0x10,%esp
+    40e4:	83 fe ff             	cmp    $0xffffffff,%esi
+    40e7:	75 87                	jne    4070 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    40e9:	83 ec 08             	sub    $0x8,%esp
+    40ec:	68 08 5d 00 00       	push   $0x5d08
+    40f1:	6a 01                	push   $0x1
+    40f3:	e8 48 08 00 00       	call   4940 <printf>
+}
+    40f8:	83 c4 10             	add    $0x10,%esp
+    40fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    40fe:	5b                   	pop    %ebx
+    40ff:	5e                   	pop    %esi
+    4100:	5f                   	pop    %edi
+    4101:	5d                   	pop    %ebp
+    4102:	c3                   	ret
+    4103:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    410a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004110 <uio>:
+{
+    4110:	55                   	push   %ebp
+    4111:	89 e5                	mov    %esp,%ebp
+    4113:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    4116:	68 1e 5d 00 00       	push   $0x5d1e
+    411b:	6a 01                	push   $0x1
+    411d:	e8 1e 08 00 00       	call   4940 <printf>
+  pid = fork();
+    4122:	e8 10 04 00 00       	call   4537 <fork>
+  if(pid == 0){
+    4127:	83 c4 10             	add    $0x10,%esp
+    412a:	85 c0                	test   %eax,%eax
+    412c:	74 1b                	je     4149 <uio+0x39>
+  } else if(pid < 0){
+    412e:	78 44                	js     4174 <uio+0x64>
+  wait();
+    4130:	e8 36 04 00 00       	call   456b <wait>
+  printf(1, "uio test done\n");
+    4135:	83 ec 08             	sub    $0x8,%esp
+    4138:	68 28 5d 00 00       	push   $0x5d28
+    413d:	6a 01                	push   $0x1
+    413f:	e8 fc 07 00 00       	call   4940 <printf>
+}
+    4144:	83 c4 10             	add    $0x10,%esp
+    4147:	c9                   	leave
+    4148:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    4149:	b8 09 00 00 00       	mov    $0x9,%eax
+    414e:	ba 70 00 00 00       	mov    $0x70,%edx
+    4153:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    4154:	ba 71 00 00 00       	mov    $0x71,%edx
+    4159:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    415a:	52                   	push   %edx
+    415b:	52                   	push   %edx
+    415c:	68 58 66 00 00       	push   $0x6658
+    4161:	6a 01                	push   $0x1
+    4163:	e8 d8 07 00 00       	call   4940 <printf>
+    exit(1);
+    4168:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    416f:	e8 dd 03 00 00       	call   4551 <exit>
+    printf (1, "fork failed\n");
+    4174:	50                   	push   %eax
+    4175:	50                   	push   %eax
+    4176:	68 ad 5c 00 00       	push   $0x5cad
+    417b:	6a 01                	push   $0x1
+    417d:	e8 be 07 00 00       	call   4940 <printf>
+    exit(1);
+    4182:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    4189:	e8 c3 03 00 00       	call   4551 <exit>
+    418e:	66 90                	xchg   %ax,%ax
+
+00004190 <argptest>:
+{
+    4190:	55                   	push   %ebp
+    4191:	89 e5                	mov    %esp,%ebp
+    4193:	53                   	push   %ebx
+    4194:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    4197:	6a 00                	push   $0x0
+    4199:	68 37 5d 00 00       	push   $0x5d37
+    419e:	e8 7e 04 00 00       	call   4621 <open>
+  if (fd < 0) {
+    41a3:	83 c4 10             	add    $0x10,%esp
+    41a6:	85 c0                	test   %eax,%eax
+    41a8:	78 39                	js     41e3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    41aa:	83 ec 0c             	sub    $0xc,%esp
+    41ad:	89 c3                	mov    %eax,%ebx
+    41af:	6a 00                	push   $0x0
+    41b1:	e8 3b 05 00 00       	call   46f1 <sbrk>
+    41b6:	83 c4 0c             	add    $0xc,%esp
+    41b9:	83 e8 01             	sub    $0x1,%eax
+    41bc:	6a ff                	push   $0xffffffff
+    41be:	50                   	push   %eax
+    41bf:	53                   	push   %ebx
+    41c0:	e8 da 03 00 00       	call   459f <read>
+  close(fd);
+    41c5:	89 1c 24             	mov    %ebx,(%esp)
+    41c8:	e8 06 04 00 00       	call   45d3 <close>
+  printf(1, "arg test passed\n");
+    41cd:	58                   	pop    %eax
+    41ce:	5a                   	pop    %edx
+    41cf:	68 49 5d 00 00       	push   $0x5d49
+    41d4:	6a 01                	push   $0x1
+    41d6:	e8 65 07 00 00       	call   4940 <printf>
+}
+    41db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    41de:	83 c4 10             	add    $0x10,%esp
+    41e1:	c9                   	leave
+    41e2:	c3                   	ret
+    printf(2, "open failed\n");
+    41e3:	51                   	push   %ecx
+    41e4:	51                   	push   %ecx
+    41e5:	68 3c 5d 00 00       	push   $0x5d3c
+    41ea:	6a 02                	push   $0x2
+    41ec:	e8 4f 07 00 00       	call   4940 <printf>
+    exit(1);
+    41f1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    41f8:	e8 54 03 00 00       	call   4551 <exit>
+    41fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004200 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    4200:	69 05 7c 71 00 00 0d 	imul   $0x19660d,0x717c,%eax
+    4207:	66 19 00 
+    420a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    420f:	a3 7c 71 00 00       	mov    %eax,0x717c
+}
+    4214:	c3                   	ret
+    4215:	66 90                	xchg   %ax,%ax
+    4217:	66 90                	xchg   %ax,%ax
+    4219:	66 90                	xchg   %ax,%ax
+    421b:	66 90                	xchg   %ax,%ax
+    421d:	66 90                	xchg   %ax,%ax
+    421f:	90                   	nop
+
+00004220 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    4220:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4221:	31 c0                	xor    %eax,%eax
+{
+    4223:	89 e5                	mov    %esp,%ebp
+    4225:	53                   	push   %ebx
+    4226:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    422c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4230:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4234:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4237:	83 c0 01             	add    $0x1,%eax
+    423a:	84 d2                	test   %dl,%dl
+    423c:	75 f2                	jne    4230 <strcpy+0x10>
+    ;
+  return os;
+}
+    423e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4241:	89 c8                	mov    %ecx,%eax
+    4243:	c9                   	leave
+    4244:	c3                   	ret
+    4245:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    424c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004250 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    4250:	55                   	push   %ebp
+    4251:	89 e5                	mov    %esp,%ebp
+    4253:	53                   	push   %ebx
+    4254:	8b 55 08             	mov    0x8(%ebp),%edx
+    4257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    425a:	0f b6 02             	movzbl (%edx),%eax
+    425d:	84 c0                	test   %al,%al
+    425f:	75 17                	jne    4278 <strcmp+0x28>
+    4261:	eb 3a                	jmp    429d <strcmp+0x4d>
+    4263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4267:	90                   	nop
+    4268:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    426c:	83 c2 01             	add    $0x1,%edx
+    426f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    4272:	84 c0                	test   %al,%al
+    4274:	74 1a                	je     4290 <strcmp+0x40>
+    p++, q++;
+    4276:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    4278:	0f b6 19             	movzbl (%ecx),%ebx
+    427b:	38 c3                	cmp    %al,%bl
+    427d:	74 e9                	je     4268 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    427f:	29 d8                	sub    %ebx,%eax
+}
+    4281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4284:	c9                   	leave
+    4285:	c3                   	ret
+    4286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    428d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    4290:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    4294:	31 c0                	xor    %eax,%eax
+    4296:	29 d8                	sub    %ebx,%eax
+}
+    4298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    429b:	c9                   	leave
+    429c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    429d:	0f b6 19             	movzbl (%ecx),%ebx
+    42a0:	31 c0                	xor    %eax,%eax
+    42a2:	eb db                	jmp    427f <strcmp+0x2f>
+    42a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    42af:	90                   	nop
+
+000042b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    42b0:	55                   	push   %ebp
+    42b1:	89 e5                	mov    %esp,%ebp
+    42b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    42b6:	80 3a 00             	cmpb   $0x0,(%edx)
+    42b9:	74 15                	je     42d0 <strlen+0x20>
+    42bb:	31 c0                	xor    %eax,%eax
+    42bd:	8d 76 00             	lea    0x0(%esi),%esi
+    42c0:	83 c0 01             	add    $0x1,%eax
+    42c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    42c7:	89 c1                	mov    %eax,%ecx
+    42c9:	75 f5                	jne    42c0 <strlen+0x10>
+    ;
+  return n;
+}
+    42cb:	89 c8                	mov    %ecx,%eax
+    42cd:	5d                   	pop    %ebp
+    42ce:	c3                   	ret
+    42cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    42d0:	31 c9                	xor    %ecx,%ecx
+}
+    42d2:	5d                   	pop    %ebp
+    42d3:	89 c8                	mov    %ecx,%eax
+    42d5:	c3                   	ret
+    42d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000042e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    42e0:	55                   	push   %ebp
+    42e1:	89 e5                	mov    %esp,%ebp
+    42e3:	57                   	push   %edi
+    42e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    42e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    42ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+    42ed:	89 d7                	mov    %edx,%edi
+    42ef:	fc                   	cld
+    42f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    42f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    42f5:	89 d0                	mov    %edx,%eax
+    42f7:	c9                   	leave
+    42f8:	c3                   	ret
+    42f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004300 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4300:	55                   	push   %ebp
+    4301:	89 e5                	mov    %esp,%ebp
+    4303:	8b 45 08             	mov    0x8(%ebp),%eax
+    4306:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    430a:	0f b6 10             	movzbl (%eax),%edx
+    430d:	84 d2                	test   %dl,%dl
+    430f:	75 12                	jne    4323 <strchr+0x23>
+    4311:	eb 1d                	jmp    4330 <strchr+0x30>
+    4313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4317:	90                   	nop
+    4318:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    431c:	83 c0 01             	add    $0x1,%eax
+    431f:	84 d2                	test   %dl,%dl
+    4321:	74 0d                	je     4330 <strchr+0x30>
+    if(*s == c)
+    4323:	38 d1                	cmp    %dl,%cl
+    4325:	75 f1                	jne    4318 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4327:	5d                   	pop    %ebp
+    4328:	c3                   	ret
+    4329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4330:	31 c0                	xor    %eax,%eax
+}
+    4332:	5d                   	pop    %ebp
+    4333:	c3                   	ret
+    4334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    433b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    433f:	90                   	nop
+
+00004340 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4340:	55                   	push   %ebp
+    4341:	89 e5                	mov    %esp,%ebp
+    4343:	57                   	push   %edi
+    4344:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4345:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4348:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4349:	31 db                	xor    %ebx,%ebx
+{
+    434b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    434e:	eb 27                	jmp    4377 <gets+0x37>
+    cc = read(0, &c, 1);
+    4350:	83 ec 04             	sub    $0x4,%esp
+    4353:	6a 01                	push   $0x1
+    4355:	56                   	push   %esi
+    4356:	6a 00                	push   $0x0
+    4358:	e8 42 02 00 00       	call   459f <read>
+    if(cc < 1)
+    435d:	83 c4 10             	add    $0x10,%esp
+    4360:	85 c0                	test   %eax,%eax
+    4362:	7e 1d                	jle    4381 <gets+0x41>
+      break;
+    buf[i++] = c;
+    4364:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    4368:	8b 55 08             	mov    0x8(%ebp),%edx
+    436b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    436f:	3c 0a                	cmp    $0xa,%al
+    4371:	74 10                	je     4383 <gets+0x43>
+    4373:	3c 0d                	cmp    $0xd,%al
+    4375:	74 0c                	je     4383 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    4377:	89 df                	mov    %ebx,%edi
+    4379:	83 c3 01             	add    $0x1,%ebx
+    437c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    437f:	7c cf                	jl     4350 <gets+0x10>
+    4381:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    4383:	8b 45 08             	mov    0x8(%ebp),%eax
+    4386:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    438a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    438d:	5b                   	pop    %ebx
+    438e:	5e                   	pop    %esi
+    438f:	5f                   	pop    %edi
+    4390:	5d                   	pop    %ebp
+    4391:	c3                   	ret
+    4392:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000043a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    43a0:	55                   	push   %ebp
+    43a1:	89 e5                	mov    %esp,%ebp
+    43a3:	56                   	push   %esi
+    43a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    43a5:	83 ec 08             	sub    $0x8,%esp
+    43a8:	6a 00                	push   $0x0
+    43aa:	ff 75 08             	push   0x8(%ebp)
+    43ad:	e8 6f 02 00 00       	call   4621 <open>
+  if(fd < 0)
+    43b2:	83 c4 10             	add    $0x10,%esp
+    43b5:	85 c0                	test   %eax,%eax
+    43b7:	78 27                	js     43e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    43b9:	83 ec 08             	sub    $0x8,%esp
+    43bc:	ff 75 0c             	push   0xc(%ebp)
+    43bf:	89 c3                	mov    %eax,%ebx
+    43c1:	50                   	push   %eax
+    43c2:	e8 a8 02 00 00       	call   466f <fstat>
+  close(fd);
+    43c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    43ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+    43cc:	e8 02 02 00 00       	call   45d3 <close>
+  return r;
+    43d1:	83 c4 10             	add    $0x10,%esp
+}
+    43d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    43d7:	89 f0                	mov    %esi,%eax
+    43d9:	5b                   	pop    %ebx
+    43da:	5e                   	pop    %esi
+    43db:	5d                   	pop    %ebp
+    43dc:	c3                   	ret
+    43dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    43e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    43e5:	eb ed                	jmp    43d4 <stat+0x34>
+    43e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43ee:	66 90                	xchg   %ax,%ax
+
+000043f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    43f0:	55                   	push   %ebp
+    43f1:	89 e5                	mov    %esp,%ebp
+    43f3:	53                   	push   %ebx
+    43f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    43f7:	0f be 02             	movsbl (%edx),%eax
+    43fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    43fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    4400:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    4405:	77 1e                	ja     4425 <atoi+0x35>
+    4407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    440e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4410:	83 c2 01             	add    $0x1,%edx
+    4413:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4416:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    441a:	0f be 02             	movsbl (%edx),%eax
+    441d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4420:	80 fb 09             	cmp    $0x9,%bl
+    4423:	76 eb                	jbe    4410 <atoi+0x20>
+  return n;
+}
+    4425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4428:	89 c8                	mov    %ecx,%eax
+    442a:	c9                   	leave
+    442b:	c3                   	ret
+    442c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004430 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4430:	55                   	push   %ebp
+    4431:	89 e5                	mov    %esp,%ebp
+    4433:	57                   	push   %edi
+    4434:	56                   	push   %esi
+    4435:	8b 45 10             	mov    0x10(%ebp),%eax
+    4438:	8b 55 08             	mov    0x8(%ebp),%edx
+    443b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    443e:	85 c0                	test   %eax,%eax
+    4440:	7e 13                	jle    4455 <memmove+0x25>
+    4442:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4444:	89 d7                	mov    %edx,%edi
+    4446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    444d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    4450:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    4451:	39 f8                	cmp    %edi,%eax
+    4453:	75 fb                	jne    4450 <memmove+0x20>
+  return vdst;
+}
+    4455:	5e                   	pop    %esi
+    4456:	89 d0                	mov    %edx,%eax
+    4458:	5f                   	pop    %edi
+    4459:	5d                   	pop    %ebp
+    445a:	c3                   	ret
+    445b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    445f:	90                   	nop
+
+00004460 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+    4460:	55                   	push   %ebp
+    4461:	89 e5                	mov    %esp,%ebp
+    4463:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+    4466:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+    4469:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+    4470:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+    4473:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    4476:	50                   	push   %eax
+    4477:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    447a:	50                   	push   %eax
+    447b:	6a 00                	push   $0x0
+    447d:	e8 8d 03 00 00       	call   480f <setitimer>
+    4482:	83 c4 10             	add    $0x10,%esp
+    4485:	89 c2                	mov    %eax,%edx
+    4487:	31 c0                	xor    %eax,%eax
+    4489:	85 d2                	test   %edx,%edx
+    448b:	78 03                	js     4490 <alarm+0x30>
+    return 0;
+  return old.it_value;
+    448d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    4490:	c9                   	leave
+    4491:	c3                   	ret
+    4492:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000044a0 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+    44a0:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+    44a5:	c3                   	ret
+    44a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000044b0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+    44b0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+    44b5:	c3                   	ret
+    44b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000044c0 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+    44c0:	55                   	push   %ebp
+    44c1:	89 e5                	mov    %esp,%ebp
+    44c3:	57                   	push   %edi
+    44c4:	56                   	push   %esi
+    44c5:	53                   	push   %ebx
+    44c6:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+    44c9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+    44cd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+    44d0:	75 5e                	jne    4530 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+    44d2:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+    44d8:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+    44da:	89 d3                	mov    %edx,%ebx
+    44dc:	89 c1                	mov    %eax,%ecx
+    44de:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+    44e4:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+    44ea:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+    44ed:	31 d2                	xor    %edx,%edx
+    44ef:	89 d8                	mov    %ebx,%eax
+    44f1:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+    44f4:	f7 f6                	div    %esi
+    44f6:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+    44f8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    44fb:	f7 f6                	div    %esi
+    44fd:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+    44ff:	89 da                	mov    %ebx,%edx
+    4501:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+    4506:	f7 f3                	div    %ebx
+    4508:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+    450a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+    450f:	89 d3                	mov    %edx,%ebx
+    4511:	f7 e1                	mul    %ecx
+    4513:	f7 f6                	div    %esi
+    4515:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+    451b:	01 c3                	add    %eax,%ebx
+  return 0;
+    451d:	31 c0                	xor    %eax,%eax
+    451f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+    4522:	83 c4 0c             	add    $0xc,%esp
+    4525:	5b                   	pop    %ebx
+    4526:	5e                   	pop    %esi
+    4527:	5f                   	pop    %edi
+    4528:	5d                   	pop    %ebp
+    4529:	c3                   	ret
+    452a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+    4530:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    4535:	eb eb                	jmp    4522 <clock_gettime+0x62>
+
+00004537 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    4537:	b8 01 00 00 00       	mov    $0x1,%eax
+    453c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4543:	74 09                	je     454e <fork+0x17>
+    4545:	89 e1                	mov    %esp,%ecx
+    4547:	ba 50 45 00 00       	mov    $0x4550,%edx
+    454c:	0f 34                	sysenter
+    454e:	cd 40                	int    $0x40
+    4550:	c3                   	ret
+
+00004551 <exit>:
+SYSCALL(exit)
+    4551:	b8 02 00 00 00       	mov    $0x2,%eax
+    4556:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    455d:	74 09                	je     4568 <exit+0x17>
+    455f:	89 e1                	mov    %esp,%ecx
+    4561:	ba 6a 45 00 00       	mov    $0x456a,%edx
+    4566:	0f 34                	sysenter
+    4568:	cd 40                	int    $0x40
+    456a:	c3                   	ret
+
+0000456b <wait>:
+SYSCALL(wait)
+    456b:	b8 03 00 00 00       	mov    $0x3,%eax
+    4570:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4577:	74 09                	je     4582 <wait+0x17>
+    4579:	89 e1                	mov    %esp,%ecx
+    457b:	ba 84 45 00 00       	mov    $0x4584,%edx
+    4580:	0f 34                	sysenter
+    4582:	cd 40                	int    $0x40
+    4584:	c3                   	ret
+
+00004585 <pipe>:
+SYSCALL(pipe)
+    4585:	b8 04 00 00 00       	mov    $0x4,%eax
+    458a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4591:	74 09                	je     459c <pipe+0x17>
+    4593:	89 e1                	mov    %esp,%ecx
+    4595:	ba 9e 45 00 00       	mov    $0x459e,%edx
+    459a:	0f 34                	sysenter
+    459c:	cd 40                	int    $0x40
+    459e:	c3                   	ret
+
+0000459f <read>:
+SYSCALL(read)
+    459f:	b8 05 00 00 00       	mov    $0x5,%eax
+    45a4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    45ab:	74 09                	je     45b6 <read+0x17>
+    45ad:	89 e1                	mov    %esp,%ecx
+    45af:	ba b8 45 00 00       	mov    $0x45b8,%edx
+    45b4:	0f 34                	sysenter
+    45b6:	cd 40                	int    $0x40
+    45b8:	c3                   	ret
+
+000045b9 <write>:
+SYSCALL(write)
+    45b9:	b8 10 00 00 00       	mov    $0x10,%eax
+    45be:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    45c5:	74 09                	je     45d0 <write+0x17>
+    45c7:	89 e1                	mov    %esp,%ecx
+    45c9:	ba d2 45 00 00       	mov    $0x45d2,%edx
+    45ce:	0f 34                	sysenter
+    45d0:	cd 40                	int    $0x40
+    45d2:	c3                   	ret
+
+000045d3 <close>:
+SYSCALL(close)
+    45d3:	b8 15 00 00 00       	mov    $0x15,%eax
+    45d8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    45df:	74 09                	je     45ea <close+0x17>
+    45e1:	89 e1                	mov    %esp,%ecx
+    45e3:	ba ec 45 00 00       	mov    $0x45ec,%edx
+    45e8:	0f 34                	sysenter
+    45ea:	cd 40                	int    $0x40
+    45ec:	c3                   	ret
+
+000045ed <kill>:
+SYSCALL(kill)
+    45ed:	b8 06 00 00 00       	mov    $0x6,%eax
+    45f2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    45f9:	74 09                	je     4604 <kill+0x17>
+    45fb:	89 e1                	mov    %esp,%ecx
+    45fd:	ba 06 46 00 00       	mov    $0x4606,%edx
+    4602:	0f 34                	sysenter
+    4604:	cd 40                	int    $0x40
+    4606:	c3                   	ret
+
+00004607 <exec>:
+SYSCALL(exec)
+    4607:	b8 07 00 00 00       	mov    $0x7,%eax
+    460c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4613:	74 09                	je     461e <exec+0x17>
+    4615:	89 e1                	mov    %esp,%ecx
+    4617:	ba 20 46 00 00       	mov    $0x4620,%edx
+    461c:	0f 34                	sysenter
+    461e:	cd 40                	int    $0x40
+    4620:	c3                   	ret
+
+00004621 <open>:
+SYSCALL(open)
+    4621:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4626:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    462d:	74 09                	je     4638 <open+0x17>
+    462f:	89 e1                	mov    %esp,%ecx
+    4631:	ba 3a 46 00 00       	mov    $0x463a,%edx
+    4636:	0f 34                	sysenter
+    4638:	cd 40                	int    $0x40
+    463a:	c3                   	ret
+
+0000463b <mknod>:
+SYSCALL(mknod)
+    463b:	b8 11 00 00 00       	mov    $0x11,%eax
+    4640:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4647:	74 09                	je     4652 <mknod+0x17>
+    4649:	89 e1                	mov    %esp,%ecx
+    464b:	ba 54 46 00 00       	mov    $0x4654,%edx
+    4650:	0f 34                	sysenter
+    4652:	cd 40                	int    $0x40
+    4654:	c3                   	ret
+
+00004655 <unlink>:
+SYSCALL(unlink)
+    4655:	b8 12 00 00 00       	mov    $0x12,%eax
+    465a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4661:	74 09                	je     466c <unlink+0x17>
+    4663:	89 e1                	mov    %esp,%ecx
+    4665:	ba 6e 46 00 00       	mov    $0x466e,%edx
+    466a:	0f 34                	sysenter
+    466c:	cd 40                	int    $0x40
+    466e:	c3                   	ret
+
+0000466f <fstat>:
+SYSCALL(fstat)
+    466f:	b8 08 00 00 00       	mov    $0x8,%eax
+    4674:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    467b:	74 09                	je     4686 <fstat+0x17>
+    467d:	89 e1                	mov    %esp,%ecx
+    467f:	ba 88 46 00 00       	mov    $0x4688,%edx
+    4684:	0f 34                	sysenter
+    4686:	cd 40                	int    $0x40
+    4688:	c3                   	ret
+
+00004689 <link>:
+SYSCALL(link)
+    4689:	b8 13 00 00 00       	mov    $0x13,%eax
+    468e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4695:	74 09                	je     46a0 <link+0x17>
+    4697:	89 e1                	mov    %esp,%ecx
+    4699:	ba a2 46 00 00       	mov    $0x46a2,%edx
+    469e:	0f 34                	sysenter
+    46a0:	cd 40                	int    $0x40
+    46a2:	c3                   	ret
+
+000046a3 <mkdir>:
+SYSCALL(mkdir)
+    46a3:	b8 14 00 00 00       	mov    $0x14,%eax
+    46a8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    46af:	74 09                	je     46ba <mkdir+0x17>
+    46b1:	89 e1                	mov    %esp,%ecx
+    46b3:	ba bc 46 00 00       	mov    $0x46bc,%edx
+    46b8:	0f 34                	sysenter
+    46ba:	cd 40                	int    $0x40
+    46bc:	c3                   	ret
+
+000046bd <chdir>:
+SYSCALL(chdir)
+    46bd:	b8 09 00 00 00       	mov    $0x9,%eax
+    46c2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    46c9:	74 09                	je     46d4 <chdir+0x17>
+    46cb:	89 e1                	mov    %esp,%ecx
+    46cd:	ba d6 46 00 00       	mov    $0x46d6,%edx
+    46d2:	0f 34                	sysenter
+    46d4:	cd 40                	int    $0x40
+    46d6:	c3                   	ret
+
+000046d7 <dup>:
+SYSCALL(dup)
+    46d7:	b8 0a 00 00 00       	mov    $0xa,%eax
+    46dc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    46e3:	74 09                	je     46ee <dup+0x17>
+    46e5:	89 e1                	mov    %esp,%ecx
+    46e7:	ba f0 46 00 00       	mov    $0x46f0,%edx
+    46ec:	0f 34                	sysenter
+    46ee:	cd 40                	int    $0x40
+    46f0:	c3                   	ret
+
+000046f1 <sbrk>:
+SYSCALL(sbrk)
+    46f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+    46f6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    46fd:	74 09                	je     4708 <sbrk+0x17>
+    46ff:	89 e1                	mov    %esp,%ecx
+    4701:	ba 0a 47 00 00       	mov    $0x470a,%edx
+    4706:	0f 34                	sysenter
+    4708:	cd 40                	int    $0x40
+    470a:	c3                   	ret
+
+0000470b <sleep>:
+SYSCALL(sleep)
+    470b:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4710:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4717:	74 09                	je     4722 <sleep+0x17>
+    4719:	89 e1                	mov    %esp,%ecx
+    471b:	ba 24 47 00 00       	mov    $0x4724,%edx
+    4720:	0f 34                	sysenter
+    4722:	cd 40                	int    $0x40
+    4724:	c3                   	ret
+
+00004725 <sigprocmask>:
+SYSCALL(sigprocmask)
+    4725:	b8 16 00 00 00       	mov    $0x16,%eax
+    472a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4731:	74 09                	je     473c <sigprocmask+0x17>
+    4733:	89 e1                	mov    %esp,%ecx
+    4735:	ba 3e 47 00 00       	mov    $0x473e,%edx
+    473a:	0f 34                	sysenter
+    473c:	cd 40                	int    $0x40
+    473e:	c3                   	ret
+
+0000473f <sigaction>:
+SYSCALL(sigaction)
+    473f:	b8 17 00 00 00       	mov    $0x17,%eax
+    4744:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    474b:	74 09                	je     4756 <sigaction+0x17>
+    474d:	89 e1                	mov    %esp,%ecx
+    474f:	ba 58 47 00 00       	mov    $0x4758,%edx
+    4754:	0f 34                	sysenter
+    4756:	cd 40                	int    $0x40
+    4758:	c3                   	ret
+
+00004759 <sigret>:
+SYSCALL(sigret)
+    4759:	b8 18 00 00 00       	mov    $0x18,%eax
+    475e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4765:	74 09                	je     4770 <sigret+0x17>
+    4767:	89 e1                	mov    %esp,%ecx
+    4769:	ba 72 47 00 00       	mov    $0x4772,%edx
+    476e:	0f 34                	sysenter
+    4770:	cd 40                	int    $0x40
+    4772:	c3                   	ret
+
+00004773 <traceread>:
+SYSCALL(traceread)
+    4773:	b8 19 00 00 00       	mov    $0x19,%eax
+    4778:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    477f:	74 09                	je     478a <traceread+0x17>
+    4781:	89 e1                	mov    %esp,%ecx
+    4783:	ba 8c 47 00 00       	mov    $0x478c,%edx
+    4788:	0f 34                	sysenter
+    478a:	cd 40                	int    $0x40
+    478c:	c3                   	ret
+
+0000478d <sigqueue>:
+SYSCALL(sigqueue)
+    478d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4792:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4799:	74 09                	je     47a4 <sigqueue+0x17>
+    479b:	89 e1                	mov    %esp,%ecx
+    479d:	ba a6 47 00 00       	mov    $0x47a6,%edx
+    47a2:	0f 34                	sysenter
+    47a4:	cd 40                	int    $0x40
+    47a6:	c3                   	ret
+
+000047a7 <signalfd>:
+SYSCALL(signalfd)
+    47a7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    47ac:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    47b3:	74 09                	je     47be <signalfd+0x17>
+    47b5:	89 e1                	mov    %esp,%ecx
+    47b7:	ba c0 47 00 00       	mov    $0x47c0,%edx
+    47bc:	0f 34                	sysenter
+    47be:	cd 40                	int    $0x40
+    47c0:	c3                   	ret
+
+000047c1 <sigwait>:
+SYSCALL(sigwait)
+    47c1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    47c6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    47cd:	74 09                	je     47d8 <sigwait+0x17>
+    47cf:	89 e1                	mov    %esp,%ecx
+    47d1:	ba da 47 00 00       	mov    $0x47da,%edx
+    47d6:	0f 34                	sysenter
+    47d8:	cd 40                	int    $0x40
+    47da:	c3                   	ret
+
+000047db <sigsuspend>:
+SYSCALL(sigsuspend)
+    47db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    47e0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    47e7:	74 09                	je     47f2 <sigsuspend+0x17>
+    47e9:	89 e1                	mov    %esp,%ecx
+    47eb:	ba f4 47 00 00       	mov    $0x47f4,%edx
+    47f0:	0f 34                	sysenter
+    47f2:	cd 40                	int    $0x40
+    47f4:	c3                   	ret
+
+000047f5 <waitpid>:
+SYSCALL(waitpid)
+    47f5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    47fa:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4801:	74 09                	je     480c <waitpid+0x17>
+    4803:	89 e1                	mov    %esp,%ecx
+    4805:	ba 0e 48 00 00       	mov    $0x480e,%edx
+    480a:	0f 34                	sysenter
+    480c:	cd 40                	int    $0x40
+    480e:	c3                   	ret
+
+0000480f <setitimer>:
+SYSCALL(setitimer)
+    480f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    4814:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    481b:	74 09                	je     4826 <setitimer+0x17>
+    481d:	89 e1                	mov    %esp,%ecx
+    481f:	ba 28 48 00 00       	mov    $0x4828,%edx
+    4824:	0f 34                	sysenter
+    4826:	cd 40                	int    $0x40
+    4828:	c3                   	ret
+
+00004829 <nanosleep>:
+SYSCALL(nanosleep)
+    4829:	b8 21 00 00 00       	mov    $0x21,%eax
+    482e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4835:	74 09                	je     4840 <nanosleep+0x17>
+    4837:	89 e1                	mov    %esp,%ecx
+    4839:	ba 42 48 00 00       	mov    $0x4842,%edx
+    483e:	0f 34                	sysenter
+    4840:	cd 40                	int    $0x40
+    4842:	c3                   	ret
+
+00004843 <mmap>:
+SYSCALL(mmap)
+    4843:	b8 22 00 00 00       	mov    $0x22,%eax
+    4848:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    484f:	74 09                	je     485a <mmap+0x17>
+    4851:	89 e1                	mov    %esp,%ecx
+    4853:	ba 5c 48 00 00       	mov    $0x485c,%edx
+    4858:	0f 34                	sysenter
+    485a:	cd 40                	int    $0x40
+    485c:	c3                   	ret
+
+0000485d <munmap>:
+SYSCALL(munmap)
+    485d:	b8 23 00 00 00       	mov    $0x23,%eax
+    4862:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4869:	74 09                	je     4874 <munmap+0x17>
+    486b:	89 e1                	mov    %esp,%ecx
+    486d:	ba 76 48 00 00       	mov    $0x4876,%edx
+    4872:	0f 34                	sysenter
+    4874:	cd 40                	int    $0x40
+    4876:	c3                   	ret
+
+00004877 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+    4877:	b8 0b 00 00 00       	mov    $0xb,%eax
+    487c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+    4883:	74 09                	je     488e <getpid_syscall+0x17>
+    4885:	89 e1                	mov    %esp,%ecx
+    4887:	ba 90 48 00 00       	mov    $0x4890,%edx
+    488c:	0f 34                	sysenter
+    488e:	cd 40                	int    $0x40
+    4890:	c3                   	ret
+
+00004891 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+    4891:	b8 0b 00 00 00       	mov    $0xb,%eax
+    4896:	cd 40                	int    $0x40
+    4898:	c3                   	ret
+    4899:	66 90                	xchg   %ax,%ax
+    489b:	66 90                	xchg   %ax,%ax
+    489d:	66 90                	xchg   %ax,%ax
+    489f:	90                   	nop
+
+000048a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    48a0:	55                   	push   %ebp
+    48a1:	89 e5                	mov    %esp,%ebp
+    48a3:	57                   	push   %edi
+    48a4:	56                   	push   %esi
+    48a5:	53                   	push   %ebx
+    48a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    48a8:	89 d1                	mov    %edx,%ecx
+{
+    48aa:	83 ec 3c             	sub    $0x3c,%esp
+    48ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    48b0:	85 d2                	test   %edx,%edx
+    48b2:	0f 89 80 00 00 00    	jns    4938 <printint+0x98>
+    48b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    48bc:	74 7a                	je     4938 <printint+0x98>
+    x = -xx;
+    48be:	f7 d9                	neg    %ecx
+    neg = 1;
+    48c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    48c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    48c8:	31 f6                	xor    %esi,%esi
+    48ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    48d0:	89 c8                	mov    %ecx,%eax
+    48d2:	31 d2                	xor    %edx,%edx
+    48d4:	89 f7                	mov    %esi,%edi
+    48d6:	f7 f3                	div    %ebx
+    48d8:	8d 76 01             	lea    0x1(%esi),%esi
+    48db:	0f b6 92 08 67 00 00 	movzbl 0x6708(%edx),%edx
+    48e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    48e6:	89 ca                	mov    %ecx,%edx
+    48e8:	89 c1                	mov    %eax,%ecx
+    48ea:	39 da                	cmp    %ebx,%edx
+    48ec:	73 e2                	jae    48d0 <printint+0x30>
+  if(neg)
+    48ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    48f1:	85 c0                	test   %eax,%eax
+    48f3:	74 07                	je     48fc <printint+0x5c>
+    buf[i++] = '-';
+    48f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    48fa:	89 f7                	mov    %esi,%edi
+    48fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    48ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    4902:	01 df                	add    %ebx,%edi
+    4904:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    4908:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    490b:	83 ec 04             	sub    $0x4,%esp
+    490e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    4911:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    4914:	6a 01                	push   $0x1
+    4916:	50                   	push   %eax
+    4917:	56                   	push   %esi
+    4918:	e8 9c fc ff ff       	call   45b9 <write>
+  while(--i >= 0)
+    491d:	89 f8                	mov    %edi,%eax
+    491f:	83 c4 10             	add    $0x10,%esp
+    4922:	83 ef 01             	sub    $0x1,%edi
+    4925:	39 d8                	cmp    %ebx,%eax
+    4927:	75 df                	jne    4908 <printint+0x68>
+}
+    4929:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    492c:	5b                   	pop    %ebx
+    492d:	5e                   	pop    %esi
+    492e:	5f                   	pop    %edi
+    492f:	5d                   	pop    %ebp
+    4930:	c3                   	ret
+    4931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    4938:	31 c0                	xor    %eax,%eax
+    493a:	eb 89                	jmp    48c5 <printint+0x25>
+    493c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004940 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    4940:	55                   	push   %ebp
+    4941:	89 e5                	mov    %esp,%ebp
+    4943:	57                   	push   %edi
+    4944:	56                   	push   %esi
+    4945:	53                   	push   %ebx
+    4946:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    4949:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    494c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    494f:	0f b6 1e             	movzbl (%esi),%ebx
+    4952:	83 c6 01             	add    $0x1,%esi
+    4955:	84 db                	test   %bl,%bl
+    4957:	74 67                	je     49c0 <printf+0x80>
+    4959:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    495c:	31 d2                	xor    %edx,%edx
+    495e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    4961:	eb 34                	jmp    4997 <printf+0x57>
+    4963:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4967:	90                   	nop
+    4968:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    496b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    4970:	83 f8 25             	cmp    $0x25,%eax
+    4973:	74 18                	je     498d <printf+0x4d>
+  write(fd, &c, 1);
+    4975:	83 ec 04             	sub    $0x4,%esp
+    4978:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    497b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    497e:	6a 01                	push   $0x1
+    4980:	50                   	push   %eax
+    4981:	57                   	push   %edi
+    4982:	e8 32 fc ff ff       	call   45b9 <write>
+    4987:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    498a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    498d:	0f b6 1e             	movzbl (%esi),%ebx
+    4990:	83 c6 01             	add    $0x1,%esi
+    4993:	84 db                	test   %bl,%bl
+    4995:	74 29                	je     49c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4997:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    499a:	85 d2                	test   %edx,%edx
+    499c:	74 ca                	je     4968 <printf+0x28>
+      }
+    } else if(state == '%'){
+    499e:	83 fa 25             	cmp    $0x25,%edx
+    49a1:	75 ea                	jne    498d <printf+0x4d>
+      if(c == 'd'){
+    49a3:	83 f8 25             	cmp    $0x25,%eax
+    49a6:	0f 84 24 01 00 00    	je     4ad0 <printf+0x190>
+    49ac:	83 e8 63             	sub    $0x63,%eax
+    49af:	83 f8 15             	cmp    $0x15,%eax
+    49b2:	77 1c                	ja     49d0 <printf+0x90>
+    49b4:	ff 24 85 b0 66 00 00 	jmp    *0x66b0(,%eax,4)
+    49bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    49bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    49c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    49c3:	5b                   	pop    %ebx
+    49c4:	5e                   	pop    %esi
+    49c5:	5f                   	pop    %edi
+    49c6:	5d                   	pop    %ebp
+    49c7:	c3                   	ret
+    49c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49cf:	90                   	nop
+  write(fd, &c, 1);
+    49d0:	83 ec 04             	sub    $0x4,%esp
+    49d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    49d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    49da:	6a 01                	push   $0x1
+    49dc:	52                   	push   %edx
+    49dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    49e0:	57                   	push   %edi
+    49e1:	e8 d3 fb ff ff       	call   45b9 <write>
+    49e6:	83 c4 0c             	add    $0xc,%esp
+    49e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    49ec:	6a 01                	push   $0x1
+    49ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    49f1:	52                   	push   %edx
+    49f2:	57                   	push   %edi
+    49f3:	e8 c1 fb ff ff       	call   45b9 <write>
+        putc(fd, c);
+    49f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    49fb:	31 d2                	xor    %edx,%edx
+    49fd:	eb 8e                	jmp    498d <printf+0x4d>
+    49ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    4a00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4a03:	83 ec 0c             	sub    $0xc,%esp
+    4a06:	b9 10 00 00 00       	mov    $0x10,%ecx
+    4a0b:	8b 13                	mov    (%ebx),%edx
+    4a0d:	6a 00                	push   $0x0
+    4a0f:	89 f8                	mov    %edi,%eax
+        ap++;
+    4a11:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    4a14:	e8 87 fe ff ff       	call   48a0 <printint>
+        ap++;
+    4a19:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4a1c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4a1f:	31 d2                	xor    %edx,%edx
+    4a21:	e9 67 ff ff ff       	jmp    498d <printf+0x4d>
+    4a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4a2d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    4a30:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4a33:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    4a35:	83 c0 04             	add    $0x4,%eax
+    4a38:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    4a3b:	85 db                	test   %ebx,%ebx
+    4a3d:	0f 84 9d 00 00 00    	je     4ae0 <printf+0x1a0>
+        while(*s != 0){
+    4a43:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    4a46:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    4a48:	84 c0                	test   %al,%al
+    4a4a:	0f 84 3d ff ff ff    	je     498d <printf+0x4d>
+    4a50:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4a53:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    4a56:	89 de                	mov    %ebx,%esi
+    4a58:	89 d3                	mov    %edx,%ebx
+    4a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    4a60:	83 ec 04             	sub    $0x4,%esp
+    4a63:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    4a66:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    4a69:	6a 01                	push   $0x1
+    4a6b:	53                   	push   %ebx
+    4a6c:	57                   	push   %edi
+    4a6d:	e8 47 fb ff ff       	call   45b9 <write>
+        while(*s != 0){
+    4a72:	0f b6 06             	movzbl (%esi),%eax
+    4a75:	83 c4 10             	add    $0x10,%esp
+    4a78:	84 c0                	test   %al,%al
+    4a7a:	75 e4                	jne    4a60 <printf+0x120>
+      state = 0;
+    4a7c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    4a7f:	31 d2                	xor    %edx,%edx
+    4a81:	e9 07 ff ff ff       	jmp    498d <printf+0x4d>
+    4a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4a8d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4a90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4a93:	83 ec 0c             	sub    $0xc,%esp
+    4a96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    4a9b:	8b 13                	mov    (%ebx),%edx
+    4a9d:	6a 01                	push   $0x1
+    4a9f:	e9 6b ff ff ff       	jmp    4a0f <printf+0xcf>
+    4aa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4aa8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    4aab:	83 ec 04             	sub    $0x4,%esp
+    4aae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4ab1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4ab3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4ab6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4ab9:	6a 01                	push   $0x1
+    4abb:	52                   	push   %edx
+    4abc:	57                   	push   %edi
+    4abd:	e8 f7 fa ff ff       	call   45b9 <write>
+        ap++;
+    4ac2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4ac5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4ac8:	31 d2                	xor    %edx,%edx
+    4aca:	e9 be fe ff ff       	jmp    498d <printf+0x4d>
+    4acf:	90                   	nop
+  write(fd, &c, 1);
+    4ad0:	83 ec 04             	sub    $0x4,%esp
+    4ad3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4ad6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4ad9:	6a 01                	push   $0x1
+    4adb:	e9 11 ff ff ff       	jmp    49f1 <printf+0xb1>
+    4ae0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4ae5:	bb a6 66 00 00       	mov    $0x66a6,%ebx
+    4aea:	e9 61 ff ff ff       	jmp    4a50 <printf+0x110>
+    4aef:	90                   	nop
+
+00004af0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4af0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4af1:	a1 48 b9 00 00       	mov    0xb948,%eax
+{
+    4af6:	89 e5                	mov    %esp,%ebp
+    4af8:	57                   	push   %edi
+    4af9:	56                   	push   %esi
+    4afa:	53                   	push   %ebx
+    4afb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    4afe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4b08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4b0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4b0c:	39 ca                	cmp    %ecx,%edx
+    4b0e:	73 30                	jae    4b40 <free+0x50>
+    4b10:	39 c1                	cmp    %eax,%ecx
+    4b12:	72 04                	jb     4b18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4b14:	39 c2                	cmp    %eax,%edx
+    4b16:	72 f0                	jb     4b08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4b18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    4b1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    4b1e:	39 f8                	cmp    %edi,%eax
+    4b20:	74 2e                	je     4b50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4b22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4b25:	8b 42 04             	mov    0x4(%edx),%eax
+    4b28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4b2b:	39 f1                	cmp    %esi,%ecx
+    4b2d:	74 38                	je     4b67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    4b2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4b31:	5b                   	pop    %ebx
+  freep = p;
+    4b32:	89 15 48 b9 00 00    	mov    %edx,0xb948
+}
+    4b38:	5e                   	pop    %esi
+    4b39:	5f                   	pop    %edi
+    4b3a:	5d                   	pop    %ebp
+    4b3b:	c3                   	ret
+    4b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4b40:	39 c1                	cmp    %eax,%ecx
+    4b42:	72 d0                	jb     4b14 <free+0x24>
+    4b44:	eb c2                	jmp    4b08 <free+0x18>
+    4b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4b4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    4b50:	03 70 04             	add    0x4(%eax),%esi
+    4b53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4b56:	8b 02                	mov    (%edx),%eax
+    4b58:	8b 00                	mov    (%eax),%eax
+    4b5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    4b5d:	8b 42 04             	mov    0x4(%edx),%eax
+    4b60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4b63:	39 f1                	cmp    %esi,%ecx
+    4b65:	75 c8                	jne    4b2f <free+0x3f>
+    p->s.size += bp->s.size;
+    4b67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    4b6a:	89 15 48 b9 00 00    	mov    %edx,0xb948
+    p->s.size += bp->s.size;
+    4b70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4b73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4b76:	89 0a                	mov    %ecx,(%edx)
+}
+    4b78:	5b                   	pop    %ebx
+    4b79:	5e                   	pop    %esi
+    4b7a:	5f                   	pop    %edi
+    4b7b:	5d                   	pop    %ebp
+    4b7c:	c3                   	ret
+    4b7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004b80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4b80:	55                   	push   %ebp
+    4b81:	89 e5                	mov    %esp,%ebp
+    4b83:	57                   	push   %edi
+    4b84:	56                   	push   %esi
+    4b85:	53                   	push   %ebx
+    4b86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    4b8c:	8b 15 48 b9 00 00    	mov    0xb948,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4b92:	8d 78 07             	lea    0x7(%eax),%edi
+    4b95:	c1 ef 03             	shr    $0x3,%edi
+    4b98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    4b9b:	85 d2                	test   %edx,%edx
+    4b9d:	0f 84 8d 00 00 00    	je     4c30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4ba3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4ba5:	8b 48 04             	mov    0x4(%eax),%ecx
+    4ba8:	39 f9                	cmp    %edi,%ecx
+    4baa:	73 64                	jae    4c10 <malloc+0x90>
+  if(nu < 4096)
+    4bac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4bb1:	39 df                	cmp    %ebx,%edi
+    4bb3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4bb6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    4bbd:	eb 0a                	jmp    4bc9 <malloc+0x49>
+    4bbf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4bc0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4bc2:	8b 48 04             	mov    0x4(%eax),%ecx
+    4bc5:	39 f9                	cmp    %edi,%ecx
+    4bc7:	73 47                	jae    4c10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4bc9:	89 c2                	mov    %eax,%edx
+    4bcb:	39 05 48 b9 00 00    	cmp    %eax,0xb948
+    4bd1:	75 ed                	jne    4bc0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4bd3:	83 ec 0c             	sub    $0xc,%esp
+    4bd6:	56                   	push   %esi
+    4bd7:	e8 15 fb ff ff       	call   46f1 <sbrk>
+  if(p == (char*)-1)
+    4bdc:	83 c4 10             	add    $0x10,%esp
+    4bdf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4be2:	74 1c                	je     4c00 <malloc+0x80>
+  hp->s.size = nu;
+    4be4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4be7:	83 ec 0c             	sub    $0xc,%esp
+    4bea:	83 c0 08             	add    $0x8,%eax
+    4bed:	50                   	push   %eax
+    4bee:	e8 fd fe ff ff       	call   4af0 <free>
+  return freep;
+    4bf3:	8b 15 48 b9 00 00    	mov    0xb948,%edx
+      if((p = morecore(nunits)) == 0)
+    4bf9:	83 c4 10             	add    $0x10,%esp
+    4bfc:	85 d2                	test   %edx,%edx
+    4bfe:	75 c0                	jne    4bc0 <malloc+0x40>
+        return 0;
+  }
+}
+    4c00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4c03:	31 c0                	xor    %eax,%eax
+}
+    4c05:	5b                   	pop    %ebx
+    4c06:	5e                   	pop    %esi
+    4c07:	5f                   	pop    %edi
+    4c08:	5d                   	pop    %ebp
+    4c09:	c3                   	ret
+    4c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4c10:	39 cf                	cmp    %ecx,%edi
+    4c12:	74 4c                	je     4c60 <malloc+0xe0>
+        p->s.size -= nunits;
+    4c14:	29 f9                	sub    %edi,%ecx
+    4c16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4c19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    4c1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    4c1f:	89 15 48 b9 00 00    	mov    %edx,0xb948
+}
+    4c25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4c28:	83 c0 08             	add    $0x8,%eax
+}
+    4c2b:	5b                   	pop    %ebx
+    4c2c:	5e                   	pop    %esi
+    4c2d:	5f                   	pop    %edi
+    4c2e:	5d                   	pop    %ebp
+    4c2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4c30:	c7 05 48 b9 00 00 4c 	movl   $0xb94c,0xb948
+    4c37:	b9 00 00 
+    base.s.size = 0;
+    4c3a:	b8 4c b9 00 00       	mov    $0xb94c,%eax
+    base.s.ptr = freep = prevp = &base;
+    4c3f:	c7 05 4c b9 00 00 4c 	movl   $0xb94c,0xb94c
+    4c46:	b9 00 00 
+    base.s.size = 0;
+    4c49:	c7 05 50 b9 00 00 00 	movl   $0x0,0xb950
+    4c50:	00 00 00 
+    if(p->s.size >= nunits){
+    4c53:	e9 54 ff ff ff       	jmp    4bac <malloc+0x2c>
+    4c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4c5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4c60:	8b 08                	mov    (%eax),%ecx
+    4c62:	89 0a                	mov    %ecx,(%edx)
+    4c64:	eb b9                	jmp    4c1f <malloc+0x9f>
@@ -0,0 +1,34 @@
+// Kernel data that user code reads directly, without a system call.
+// Both pages are mapped read-only into every process (see vm.c):
+// VDSO is one page shared by all processes, VPROC is the process's own.
+// Include after types.h and x86.h.
+
+// Byte offset of vdso.sysenter, for usys.S. vm.c checks it.
+#define VDSO_SYSENTER 16
+
+#ifndef __ASSEMBLER__
+struct vdso {
+  volatile uint ticks;   // Clock ticks since boot, as uptime() returns
+  uint tsckhz;           // TSC cycles per millisecond
+  uint64 tsc0;           // TSC at boot; CLOCK_MONOTONIC counts from here
+  uint sysenter;         // Non-zero if system calls may use SYSENTER
+};
+
+struct vproc {
+  int pid;               // As getpid() returns
+};
+
+// Convert a TSC interval to seconds and nanoseconds, given the TSC
+// rate in cycles per millisecond.
+static inline void
+vdso_tsc2ts(uint64 cycles, uint khz, struct timespec *ts)
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+}
+#endif
@@ -6,9 +6,22 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "vdso.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "fcntl.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
+static char *trampoline;  // page holding the signal return code
+struct vdso *vdso;        // page of clock data user code reads directly
+
+// usys.S finds vdso.sysenter at VDSO_SYSENTER; fail to compile if
+// struct vdso moves it.
+typedef char vdso_sysenter_offset[
+  __builtin_offsetof(struct vdso, sysenter) == VDSO_SYSENTER ? 1 : -1];
 
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
@@ -87,8 +100,12 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 //
 // setupkvm() and exec() set up every page table like this:
 //
-//   0..KERNBASE: user memory (text+data+stack+heap), mapped to
+//   0..USERTOP: user memory (text+data+stack+heap), mapped to
 //                phys memory allocated by the kernel
+//   VPROC: the process's own read-only struct vproc (see mapvproc)
+//   VDSO: one read-only struct vdso page shared by every process
+//   TRAMPOLINE: one read-only page shared by every process, holding
+//                the code signal handlers return to (see trampinit)
 //   KERNBASE..KERNBASE+EXTMEM: mapped to 0..EXTMEM (for I/O space)
 //   KERNBASE+EXTMEM..data: mapped to EXTMEM..V2P(data)
 //                for the kernel's instructions and r/o data
@@ -132,9 +149,53 @@ setupkvm(void)
       freevm(pgdir);
       return 0;
     }
+  if(trampoline &&
+     mappages(pgdir, (void*)TRAMPOLINE, PGSIZE, V2P(trampoline), PTE_U) < 0){
+    freevm(pgdir);
+    return 0;
+  }
+  if(vdso &&
+     mappages(pgdir, (void*)VDSO, PGSIZE, V2P(vdso), PTE_U) < 0){
+    freevm(pgdir);
+    return 0;
+  }
   return pgdir;
 }
 
+// Map a process's struct vproc page, read-only, at VPROC in pgdir.
+int
+mapvproc(pde_t *pgdir, char *page)
+{
+  return mappages(pgdir, (void*)VPROC, PGSIZE, V2P(page), PTE_U);
+}
+
+// Allocate the page setupkvm() maps at VDSO and publish the clock
+// calibration in it. Must run after lapicinit() on the boot CPU.
+void
+vdsoinit(void)
+{
+  if((vdso = (struct vdso*)kalloc()) == 0)
+    panic("vdsoinit");
+  memset(vdso, 0, PGSIZE);
+  vdso->tsckhz = tsckhz;
+  vdso->tsc0 = tsc0;
+}
+
+// Copy the signal return code (implicit_sigret.S) into a page of
+// its own. setupkvm() maps that page read-only at TRAMPOLINE in every
+// page table, so delivering a signal only has to push a return address.
+void
+trampinit(void)
+{
+  uint n;
+
+  n = (uint)done_implicit_sigret - (uint)start_implicit_sigret;
+  if((trampoline = kalloc()) == 0 || n > PGSIZE)
+    panic("trampinit");
+  memset(trampoline, 0, PGSIZE);
+  memmove(trampoline, start_implicit_sigret, n);
+}
+
 // Allocate one page table for the machine for the kernel address
 // space for scheduler processes.
 void
@@ -173,6 +234,8 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
+  if(vdso->sysenter)
+    wrmsr(MSR_SYSENTER_ESP, (uint)p->kstack + KSTACKSIZE);
   lcr3(V2P(p->pgdir));  // switch to process's address space
   popcli();
 }
@@ -192,30 +255,6 @@ inituvm(pde_t *pgdir, char *init, uint sz)
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, P2V(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
@@ -224,7 +263,7 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   char *mem;
   uint a;
 
-  if(newsz >= KERNBASE)
+  if(newsz > USERTOP)
     return 0;
   if(newsz < oldsz)
     return oldsz;
@@ -287,7 +326,7 @@ freevm(pde_t *pgdir)
 
   if(pgdir == 0)
     panic("freevm: no pgdir");
-  deallocuvm(pgdir, KERNBASE, 0);
+  deallocuvm(pgdir, USERTOP, 0);
   for(i = 0; i < NPDENTRIES; i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
@@ -310,37 +349,251 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Map the pages of pgdir in [start, end) into d as well.
+// With cow set, writable pages become read-only PTE_COW
+// pages in both, and cowpage() copies them on the first
+// write. Pages never touched (see pagefault) are skipped.
+// The caller must flush pgdir's TLB entries.
+int
+sharerange(pde_t *pgdir, pde_t *d, uint start, uint end, int cow)
+{
+  pte_t *pte;
+  uint pa, i;
+
+  for(i = start; i < end; i += PGSIZE){
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0 || !(*pte & PTE_P))
+      continue;
+    if(cow && (*pte & PTE_W))
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+    pa = PTE_ADDR(*pte);
+    if(mappages(d, (void*)i, PGSIZE, pa, PTE_FLAGS(*pte)) < 0)
+      return -1;
+    kref(P2V(pa));
+  }
+  return 0;
+}
+
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child. The child shares the parent's pages
+// copy-on-write (see sharerange). pgdir must be the
+// current page table.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
+
+  if((d = setupkvm()) == 0)
+    return 0;
+  if(sharerange(pgdir, d, 0, sz, 1) < 0){
+    lcr3(V2P(pgdir));
+    freevm(d);
+    return 0;
+  }
+  lcr3(V2P(pgdir));  // the parent's pages are read-only now
+  return d;
+}
+
+// Make the user page at va in pgdir writable, giving it a
+// private copy first if it is a shared copy-on-write page.
+// Returns 0 if the page is writable, -1 if it cannot be.
+int
+cowpage(pde_t *pgdir, uint va)
+{
   pte_t *pte;
-  uint pa, i, flags;
+  uint pa;
   char *mem;
 
-  if((d = setupkvm()) == 0)
+  if(va >= USERTOP)
+    return -1;
+  pte = walkpgdir(pgdir, (void*)va, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+    return -1;
+  if(*pte & PTE_W)
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
+  if(!(*pte & PTE_COW))
+    return -1;
+
+  pa = PTE_ADDR(*pte);
+  // Only this page table can take new references to the page,
+  // so if it holds the last one the page is already private.
+  if(krefcount(P2V(pa)) > 1){
     if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
-      goto bad;
-    }
+      return -1;
+    memmove(mem, P2V(pa), PGSIZE);
+    *pte = V2P(mem) | PTE_FLAGS(*pte);
+    kfree(P2V(pa));
   }
-  return d;
+  *pte = (*pte | PTE_W) & ~PTE_COW;
+  invlpg((void*)PGROUNDDOWN(va));
+  return 0;
+}
+
+// The program segment of p that va falls in, or 0.
+static struct seg*
+findseg(struct proc *p, uint va)
+{
+  struct seg *s;
+
+  for(s = p->seg; s < &p->seg[p->nseg]; s++)
+    if(va >= s->va && va - s->va < s->memsz)
+      return s;
+  return 0;
+}
+
+// Read n bytes of ip at off into a zeroed page. Returns 0 on
+// failure.
+static char*
+readpage(struct inode *ip, uint off, uint n)
+{
+  char *mem;
+
+  if((mem = kalloc()) == 0)
+    return 0;
+  memset(mem, 0, PGSIZE);
+  ilock(ip);
+  if(readi(ip, mem, off, n) != n){
+    iunlock(ip);
+    kfree(mem);
+    return 0;
+  }
+  iunlock(ip);
+  return mem;
+}
+
+// Find or read in the page holding n bytes of ip from off, and
+// return it with *perm set to the permissions to map it with.
+// Pages in the executable page cache (pcache.c) are shared
+// copy-on-write. Returns 0 on failure.
+static char*
+loadpage(struct inode *ip, uint off, uint n, uint *perm)
+{
+  char *mem;
+  uint gen;
 
-bad:
-  freevm(d);
+  *perm = PTE_U|PTE_COW;
+  if((mem = pcacheget(ip, off, n, &gen)) != 0)
+    return mem;
+  if((mem = readpage(ip, off, n)) == 0)
+    return 0;
+  if(!pcacheput(ip, off, n, mem, gen))
+    *perm = PTE_W|PTE_U;
+  return mem;
+}
+
+// Handle a fault at va, at or above p->sz, in p's mmap()
+// regions. Anonymous pages start out zero. Private file pages
+// come from the page cache like program pages; shared ones are
+// the frame every shared mapping of the page maps (see shget).
+// May sleep. Returns 0 if the faulting access can be retried.
+static int
+vmafault(struct proc *p, uint va, int write)
+{
+  struct vma *v;
+  struct inode *ip;
+  pte_t *pte;
+  char *mem;
+  uint a, off, n, perm;
+
+  if((v = vmafind(p, va)) == 0)
+    return -1;
+  if(write && !(v->prot & PROT_WRITE))
+    return -1;
+  pte = walkpgdir(p->pgdir, (void*)va, 0);
+  if(pte && (*pte & PTE_P))
+    return write ? cowpage(p->pgdir, va) : -1;
+
+  a = PGROUNDDOWN(va);
+  n = 0;
+  perm = PTE_W|PTE_U;
+  if(v->f){
+    // Past the end of the file the page is zero.
+    ip = v->f->ip;
+    off = v->off + (a - v->start);
+    ilock(ip);
+    if(off < ip->size)
+      n = ip->size - off < PGSIZE ? ip->size - off : PGSIZE;
+    iunlock(ip);
+  }
+  if(v->f && (v->flags & MAP_SHARED))
+    mem = shget(ip, off);
+  else if(n > 0)
+    mem = loadpage(ip, off, n, &perm);
+  else if((mem = kalloc()) != 0)
+    memset(mem, 0, PGSIZE);
+  if(mem == 0)
+    return -1;
+  if(!(v->prot & PROT_WRITE))
+    perm &= ~PTE_W;
+  if(mappages(p->pgdir, (void*)a, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Handle a fault at user address va in p, the current process.
+// Program pages not yet touched are read in from p->exe (see
+// exec), other pages below p->sz that were never touched get a
+// zeroed page, and writes to copy-on-write pages get a private
+// copy. Faults above p->sz go to vmafault(). May sleep reading
+// a file. Returns 0 if the faulting access can be retried.
+int
+pagefault(struct proc *p, uint va, int write)
+{
+  pte_t *pte;
+  char *mem;
+  struct seg *s;
+  uint a, n, perm;
+
+  if(va >= p->sz)
+    return vmafault(p, va, write);
+  pte = walkpgdir(p->pgdir, (void*)va, 0);
+  if(pte && (*pte & PTE_P))
+    return write ? cowpage(p->pgdir, va) : -1;
+
+  a = PGROUNDDOWN(va);
+  if((s = findseg(p, a)) != 0 && a - s->va < s->filesz){
+    n = s->filesz - (a - s->va);
+    if(n > PGSIZE)
+      n = PGSIZE;
+    if((mem = loadpage(p->exe, s->off + (a - s->va), n, &perm)) == 0)
+      return -1;
+  } else {
+    if((mem = kalloc()) == 0)
+      return -1;
+    memset(mem, 0, PGSIZE);
+    perm = PTE_W|PTE_U;
+  }
+  if(mappages(p->pgdir, (void*)a, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  // A write fault on a shared page retries into cowpage().
+  return 0;
+}
+
+// Fill in the pages of p, the current process, in [va, va+n)
+// that were not touched yet, as pagefault() would, and with write
+// set give it private copies of copy-on-write ones. System calls
+// do this for the user memory they use up front: trap() only
+// handles faults from user code, and the kernel may touch the
+// memory while holding locks, when pagefault() cannot sleep.
+int
+pagein(struct proc *p, uint va, uint n, int write)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+    pte = walkpgdir(p->pgdir, (void*)a, 0);
+    if((pte == 0 || !(*pte & PTE_P)) && pagefault(p, a, write) < 0)
+      return -1;
+    pte = walkpgdir(p->pgdir, (void*)a, 0);
+    if(!(*pte & PTE_U))
+      return -1;
+    if(write && cowpage(p->pgdir, a) < 0)
+      return -1;
+  }
   return 0;
 }
 
@@ -352,16 +605,31 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
   return (char*)P2V(PTE_ADDR(*pte));
 }
 
+// Kernel address of the page mapped at user address va in
+// pgdir, or 0 if there is none. With dirty set, only if user
+// code has written to it.
+char*
+uvmpage(pde_t *pgdir, uint va, int dirty)
+{
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, (void*)va, 0);
+  if(pte == 0 || !(*pte & PTE_P) || (dirty && !(*pte & PTE_D)))
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+}
+
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
-// uva2ka ensures this only works for PTE_U pages.
+// cowpage ensures this only works for writable PTE_U pages.
+// May sleep if pgdir is the current page table.
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
@@ -371,6 +639,15 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    // A page of the current process never touched, such as a
+    // fresh sbrk() stack a signal frame goes on, is filled in
+    // as a write fault would.
+    if(uva2ka(pgdir, (char*)va0) == 0 &&
+       (pgdir != myproc()->pgdir || pagefault(myproc(), va0, 1) < 0))
+      return -1;
+    // The kernel mapping ignores PTE_W, so unshare the page here.
+    if(cowpage(pgdir, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
@@ -0,0 +1,1672 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 60                	jmp    8b <main+0x8b>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit(1);
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 6f 00 00 00       	call   b0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 0a 05 00 00       	call   553 <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 30                	je     81 <main+0x81>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 44 05 00 00       	call   5a1 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 0b 0c 00 00       	push   $0xc0b
+  6e:	6a 01                	push   $0x1
+  70:	e8 4b 08 00 00       	call   8c0 <printf>
+      exit(1);
+  75:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  7c:	e8 50 04 00 00       	call   4d1 <exit>
+  }
+  exit(0);
+  81:	83 ec 0c             	sub    $0xc,%esp
+  84:	6a 00                	push   $0x0
+  86:	e8 46 04 00 00       	call   4d1 <exit>
+    wc(0, "");
+  8b:	52                   	push   %edx
+  8c:	52                   	push   %edx
+  8d:	68 fd 0b 00 00       	push   $0xbfd
+  92:	6a 00                	push   $0x0
+  94:	e8 17 00 00 00       	call   b0 <wc>
+    exit(0);
+  99:	31 c9                	xor    %ecx,%ecx
+  9b:	89 0c 24             	mov    %ecx,(%esp)
+  9e:	e8 2e 04 00 00       	call   4d1 <exit>
+  a3:	66 90                	xchg   %ax,%ax
+  a5:	66 90                	xchg   %ax,%ax
+  a7:	66 90                	xchg   %ax,%ax
+  a9:	66 90                	xchg   %ax,%ax
+  ab:	66 90                	xchg   %ax,%ax
+  ad:	66 90                	xchg   %ax,%ax
+  af:	90                   	nop
+
+000000b0 <wc>:
+{
+  b0:	55                   	push   %ebp
+  l = w = c = 0;
+  b1:	31 d2                	xor    %edx,%edx
+{
+  b3:	89 e5                	mov    %esp,%ebp
+  b5:	57                   	push   %edi
+  b6:	56                   	push   %esi
+  inword = 0;
+  b7:	31 f6                	xor    %esi,%esi
+{
+  b9:	53                   	push   %ebx
+  l = w = c = 0;
+  ba:	31 db                	xor    %ebx,%ebx
+{
+  bc:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  bf:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  c6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  d0:	83 ec 04             	sub    $0x4,%esp
+  d3:	68 00 02 00 00       	push   $0x200
+  d8:	68 e0 0f 00 00       	push   $0xfe0
+  dd:	ff 75 08             	push   0x8(%ebp)
+  e0:	e8 3a 04 00 00       	call   51f <read>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	89 c1                	mov    %eax,%ecx
+  ea:	85 c0                	test   %eax,%eax
+  ec:	7e 62                	jle    150 <wc+0xa0>
+    for(i=0; i<n; i++){
+  ee:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  f1:	31 ff                	xor    %edi,%edi
+  f3:	eb 0d                	jmp    102 <wc+0x52>
+  f5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  f8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  fa:	83 c7 01             	add    $0x1,%edi
+  fd:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 100:	74 3e                	je     140 <wc+0x90>
+      if(buf[i] == '\n')
+ 102:	0f be 87 e0 0f 00 00 	movsbl 0xfe0(%edi),%eax
+        l++;
+ 109:	31 c9                	xor    %ecx,%ecx
+ 10b:	3c 0a                	cmp    $0xa,%al
+ 10d:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 110:	83 ec 08             	sub    $0x8,%esp
+ 113:	50                   	push   %eax
+        l++;
+ 114:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 116:	68 e8 0b 00 00       	push   $0xbe8
+ 11b:	e8 60 01 00 00       	call   280 <strchr>
+ 120:	83 c4 10             	add    $0x10,%esp
+ 123:	85 c0                	test   %eax,%eax
+ 125:	75 d1                	jne    f8 <wc+0x48>
+      else if(!inword){
+ 127:	85 f6                	test   %esi,%esi
+ 129:	75 cf                	jne    fa <wc+0x4a>
+        w++;
+ 12b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 12f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 134:	83 c7 01             	add    $0x1,%edi
+ 137:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 13a:	75 c6                	jne    102 <wc+0x52>
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 140:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 143:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 146:	eb 88                	jmp    d0 <wc+0x20>
+ 148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+  if(n < 0){
+ 150:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 153:	75 22                	jne    177 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 155:	83 ec 08             	sub    $0x8,%esp
+ 158:	ff 75 0c             	push   0xc(%ebp)
+ 15b:	52                   	push   %edx
+ 15c:	ff 75 e0             	push   -0x20(%ebp)
+ 15f:	53                   	push   %ebx
+ 160:	68 fe 0b 00 00       	push   $0xbfe
+ 165:	6a 01                	push   $0x1
+ 167:	e8 54 07 00 00       	call   8c0 <printf>
+}
+ 16c:	83 c4 20             	add    $0x20,%esp
+ 16f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 172:	5b                   	pop    %ebx
+ 173:	5e                   	pop    %esi
+ 174:	5f                   	pop    %edi
+ 175:	5d                   	pop    %ebp
+ 176:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 177:	50                   	push   %eax
+ 178:	50                   	push   %eax
+ 179:	68 ee 0b 00 00       	push   $0xbee
+ 17e:	6a 01                	push   $0x1
+ 180:	e8 3b 07 00 00       	call   8c0 <printf>
+    exit(1);
+ 185:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 18c:	e8 40 03 00 00       	call   4d1 <exit>
+ 191:	66 90                	xchg   %ax,%ax
+ 193:	66 90                	xchg   %ax,%ax
+ 195:	66 90                	xchg   %ax,%ax
+ 197:	66 90                	xchg   %ax,%ax
+ 199:	66 90                	xchg   %ax,%ax
+ 19b:	66 90                	xchg   %ax,%ax
+ 19d:	66 90                	xchg   %ax,%ax
+ 19f:	90                   	nop
+
+000001a0 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1a1:	31 c0                	xor    %eax,%eax
+{
+ 1a3:	89 e5                	mov    %esp,%ebp
+ 1a5:	53                   	push   %ebx
+ 1a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1b7:	83 c0 01             	add    $0x1,%eax
+ 1ba:	84 d2                	test   %dl,%dl
+ 1bc:	75 f2                	jne    1b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c1:	89 c8                	mov    %ecx,%eax
+ 1c3:	c9                   	leave
+ 1c4:	c3                   	ret
+ 1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	53                   	push   %ebx
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1da:	0f b6 02             	movzbl (%edx),%eax
+ 1dd:	84 c0                	test   %al,%al
+ 1df:	75 17                	jne    1f8 <strcmp+0x28>
+ 1e1:	eb 3a                	jmp    21d <strcmp+0x4d>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1ec:	83 c2 01             	add    $0x1,%edx
+ 1ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1f2:	84 c0                	test   %al,%al
+ 1f4:	74 1a                	je     210 <strcmp+0x40>
+    p++, q++;
+ 1f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1fb:	38 c3                	cmp    %al,%bl
+ 1fd:	74 e9                	je     1e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1ff:	29 d8                	sub    %ebx,%eax
+}
+ 201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 204:	c9                   	leave
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 214:	31 c0                	xor    %eax,%eax
+ 216:	29 d8                	sub    %ebx,%eax
+}
+ 218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 21b:	c9                   	leave
+ 21c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 21d:	0f b6 19             	movzbl (%ecx),%ebx
+ 220:	31 c0                	xor    %eax,%eax
+ 222:	eb db                	jmp    1ff <strcmp+0x2f>
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 236:	80 3a 00             	cmpb   $0x0,(%edx)
+ 239:	74 15                	je     250 <strlen+0x20>
+ 23b:	31 c0                	xor    %eax,%eax
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+ 240:	83 c0 01             	add    $0x1,%eax
+ 243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 247:	89 c1                	mov    %eax,%ecx
+ 249:	75 f5                	jne    240 <strlen+0x10>
+    ;
+  return n;
+}
+ 24b:	89 c8                	mov    %ecx,%eax
+ 24d:	5d                   	pop    %ebp
+ 24e:	c3                   	ret
+ 24f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 250:	31 c9                	xor    %ecx,%ecx
+}
+ 252:	5d                   	pop    %ebp
+ 253:	89 c8                	mov    %ecx,%eax
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 26a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26d:	89 d7                	mov    %edx,%edi
+ 26f:	fc                   	cld
+ 270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 272:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 275:	89 d0                	mov    %edx,%eax
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 28a:	0f b6 10             	movzbl (%eax),%edx
+ 28d:	84 d2                	test   %dl,%dl
+ 28f:	75 12                	jne    2a3 <strchr+0x23>
+ 291:	eb 1d                	jmp    2b0 <strchr+0x30>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 29c:	83 c0 01             	add    $0x1,%eax
+ 29f:	84 d2                	test   %dl,%dl
+ 2a1:	74 0d                	je     2b0 <strchr+0x30>
+    if(*s == c)
+ 2a3:	38 d1                	cmp    %dl,%cl
+ 2a5:	75 f1                	jne    298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2a7:	5d                   	pop    %ebp
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2b0:	31 c0                	xor    %eax,%eax
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	c3                   	ret
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2c9:	31 db                	xor    %ebx,%ebx
+{
+ 2cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ce:	eb 27                	jmp    2f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2d0:	83 ec 04             	sub    $0x4,%esp
+ 2d3:	6a 01                	push   $0x1
+ 2d5:	56                   	push   %esi
+ 2d6:	6a 00                	push   $0x0
+ 2d8:	e8 42 02 00 00       	call   51f <read>
+    if(cc < 1)
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	7e 1d                	jle    301 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ef:	3c 0a                	cmp    $0xa,%al
+ 2f1:	74 10                	je     303 <gets+0x43>
+ 2f3:	3c 0d                	cmp    $0xd,%al
+ 2f5:	74 0c                	je     303 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2f7:	89 df                	mov    %ebx,%edi
+ 2f9:	83 c3 01             	add    $0x1,%ebx
+ 2fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ff:	7c cf                	jl     2d0 <gets+0x10>
+ 301:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 30a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 30d:	5b                   	pop    %ebx
+ 30e:	5e                   	pop    %esi
+ 30f:	5f                   	pop    %edi
+ 310:	5d                   	pop    %ebp
+ 311:	c3                   	ret
+ 312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+ 324:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 325:	83 ec 08             	sub    $0x8,%esp
+ 328:	6a 00                	push   $0x0
+ 32a:	ff 75 08             	push   0x8(%ebp)
+ 32d:	e8 6f 02 00 00       	call   5a1 <open>
+  if(fd < 0)
+ 332:	83 c4 10             	add    $0x10,%esp
+ 335:	85 c0                	test   %eax,%eax
+ 337:	78 27                	js     360 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 339:	83 ec 08             	sub    $0x8,%esp
+ 33c:	ff 75 0c             	push   0xc(%ebp)
+ 33f:	89 c3                	mov    %eax,%ebx
+ 341:	50                   	push   %eax
+ 342:	e8 a8 02 00 00       	call   5ef <fstat>
+  close(fd);
+ 347:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 34a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 34c:	e8 02 02 00 00       	call   553 <close>
+  return r;
+ 351:	83 c4 10             	add    $0x10,%esp
+}
+ 354:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 357:	89 f0                	mov    %esi,%eax
+ 359:	5b                   	pop    %ebx
+ 35a:	5e                   	pop    %esi
+ 35b:	5d                   	pop    %ebp
+ 35c:	c3                   	ret
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 360:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 365:	eb ed                	jmp    354 <stat+0x34>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 377:	0f be 02             	movsbl (%edx),%eax
+ 37a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 37d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 380:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 385:	77 1e                	ja     3a5 <atoi+0x35>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 390:	83 c2 01             	add    $0x1,%edx
+ 393:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 396:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 39a:	0f be 02             	movsbl (%edx),%eax
+ 39d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3a0:	80 fb 09             	cmp    $0x9,%bl
+ 3a3:	76 eb                	jbe    390 <atoi+0x20>
+  return n;
+}
+ 3a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a8:	89 c8                	mov    %ecx,%eax
+ 3aa:	c9                   	leave
+ 3ab:	c3                   	ret
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3be:	85 c0                	test   %eax,%eax
+ 3c0:	7e 13                	jle    3d5 <memmove+0x25>
+ 3c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3c4:	89 d7                	mov    %edx,%edi
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3d1:	39 f8                	cmp    %edi,%eax
+ 3d3:	75 fb                	jne    3d0 <memmove+0x20>
+  return vdst;
+}
+ 3d5:	5e                   	pop    %esi
+ 3d6:	89 d0                	mov    %edx,%eax
+ 3d8:	5f                   	pop    %edi
+ 3d9:	5d                   	pop    %ebp
+ 3da:	c3                   	ret
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 3e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 3e9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 3f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 3f3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 3f6:	50                   	push   %eax
+ 3f7:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 3fa:	50                   	push   %eax
+ 3fb:	6a 00                	push   $0x0
+ 3fd:	e8 8d 03 00 00       	call   78f <setitimer>
+ 402:	83 c4 10             	add    $0x10,%esp
+ 405:	89 c2                	mov    %eax,%edx
+ 407:	31 c0                	xor    %eax,%eax
+ 409:	85 d2                	test   %edx,%edx
+ 40b:	78 03                	js     410 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 40d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 410:	c9                   	leave
+ 411:	c3                   	ret
+ 412:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 420:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 430:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 435:	c3                   	ret
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 449:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 44d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 450:	75 5e                	jne    4b0 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 452:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 458:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 45a:	89 d3                	mov    %edx,%ebx
+ 45c:	89 c1                	mov    %eax,%ecx
+ 45e:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 464:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 46a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 46d:	31 d2                	xor    %edx,%edx
+ 46f:	89 d8                	mov    %ebx,%eax
+ 471:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 474:	f7 f6                	div    %esi
+ 476:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 478:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 47b:	f7 f6                	div    %esi
+ 47d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 47f:	89 da                	mov    %ebx,%edx
+ 481:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 486:	f7 f3                	div    %ebx
+ 488:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 48a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 48f:	89 d3                	mov    %edx,%ebx
+ 491:	f7 e1                	mul    %ecx
+ 493:	f7 f6                	div    %esi
+ 495:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 49b:	01 c3                	add    %eax,%ebx
+  return 0;
+ 49d:	31 c0                	xor    %eax,%eax
+ 49f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 4a2:	83 c4 0c             	add    $0xc,%esp
+ 4a5:	5b                   	pop    %ebx
+ 4a6:	5e                   	pop    %esi
+ 4a7:	5f                   	pop    %edi
+ 4a8:	5d                   	pop    %ebp
+ 4a9:	c3                   	ret
+ 4aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 4b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4b5:	eb eb                	jmp    4a2 <clock_gettime+0x62>
+
+000004b7 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4b7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4bc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4c3:	74 09                	je     4ce <fork+0x17>
+ 4c5:	89 e1                	mov    %esp,%ecx
+ 4c7:	ba d0 04 00 00       	mov    $0x4d0,%edx
+ 4cc:	0f 34                	sysenter
+ 4ce:	cd 40                	int    $0x40
+ 4d0:	c3                   	ret
+
+000004d1 <exit>:
+SYSCALL(exit)
+ 4d1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4d6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4dd:	74 09                	je     4e8 <exit+0x17>
+ 4df:	89 e1                	mov    %esp,%ecx
+ 4e1:	ba ea 04 00 00       	mov    $0x4ea,%edx
+ 4e6:	0f 34                	sysenter
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <wait>:
+SYSCALL(wait)
+ 4eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4f0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4f7:	74 09                	je     502 <wait+0x17>
+ 4f9:	89 e1                	mov    %esp,%ecx
+ 4fb:	ba 04 05 00 00       	mov    $0x504,%edx
+ 500:	0f 34                	sysenter
+ 502:	cd 40                	int    $0x40
+ 504:	c3                   	ret
+
+00000505 <pipe>:
+SYSCALL(pipe)
+ 505:	b8 04 00 00 00       	mov    $0x4,%eax
+ 50a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 511:	74 09                	je     51c <pipe+0x17>
+ 513:	89 e1                	mov    %esp,%ecx
+ 515:	ba 1e 05 00 00       	mov    $0x51e,%edx
+ 51a:	0f 34                	sysenter
+ 51c:	cd 40                	int    $0x40
+ 51e:	c3                   	ret
+
+0000051f <read>:
+SYSCALL(read)
+ 51f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 524:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 52b:	74 09                	je     536 <read+0x17>
+ 52d:	89 e1                	mov    %esp,%ecx
+ 52f:	ba 38 05 00 00       	mov    $0x538,%edx
+ 534:	0f 34                	sysenter
+ 536:	cd 40                	int    $0x40
+ 538:	c3                   	ret
+
+00000539 <write>:
+SYSCALL(write)
+ 539:	b8 10 00 00 00       	mov    $0x10,%eax
+ 53e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 545:	74 09                	je     550 <write+0x17>
+ 547:	89 e1                	mov    %esp,%ecx
+ 549:	ba 52 05 00 00       	mov    $0x552,%edx
+ 54e:	0f 34                	sysenter
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <close>:
+SYSCALL(close)
+ 553:	b8 15 00 00 00       	mov    $0x15,%eax
+ 558:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 55f:	74 09                	je     56a <close+0x17>
+ 561:	89 e1                	mov    %esp,%ecx
+ 563:	ba 6c 05 00 00       	mov    $0x56c,%edx
+ 568:	0f 34                	sysenter
+ 56a:	cd 40                	int    $0x40
+ 56c:	c3                   	ret
+
+0000056d <kill>:
+SYSCALL(kill)
+ 56d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 572:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 579:	74 09                	je     584 <kill+0x17>
+ 57b:	89 e1                	mov    %esp,%ecx
+ 57d:	ba 86 05 00 00       	mov    $0x586,%edx
+ 582:	0f 34                	sysenter
+ 584:	cd 40                	int    $0x40
+ 586:	c3                   	ret
+
+00000587 <exec>:
+SYSCALL(exec)
+ 587:	b8 07 00 00 00       	mov    $0x7,%eax
+ 58c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 593:	74 09                	je     59e <exec+0x17>
+ 595:	89 e1                	mov    %esp,%ecx
+ 597:	ba a0 05 00 00       	mov    $0x5a0,%edx
+ 59c:	0f 34                	sysenter
+ 59e:	cd 40                	int    $0x40
+ 5a0:	c3                   	ret
+
+000005a1 <open>:
+SYSCALL(open)
+ 5a1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5a6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5ad:	74 09                	je     5b8 <open+0x17>
+ 5af:	89 e1                	mov    %esp,%ecx
+ 5b1:	ba ba 05 00 00       	mov    $0x5ba,%edx
+ 5b6:	0f 34                	sysenter
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <mknod>:
+SYSCALL(mknod)
+ 5bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5c0:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5c7:	74 09                	je     5d2 <mknod+0x17>
+ 5c9:	89 e1                	mov    %esp,%ecx
+ 5cb:	ba d4 05 00 00       	mov    $0x5d4,%edx
+ 5d0:	0f 34                	sysenter
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	c3                   	ret
+
+000005d5 <unlink>:
+SYSCALL(unlink)
+ 5d5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5da:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5e1:	74 09                	je     5ec <unlink+0x17>
+ 5e3:	89 e1                	mov    %esp,%ecx
+ 5e5:	ba ee 05 00 00       	mov    $0x5ee,%edx
+ 5ea:	0f 34                	sysenter
+ 5ec:	cd 40                	int    $0x40
+ 5ee:	c3                   	ret
+
+000005ef <fstat>:
+SYSCALL(fstat)
+ 5ef:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5f4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5fb:	74 09                	je     606 <fstat+0x17>
+ 5fd:	89 e1                	mov    %esp,%ecx
+ 5ff:	ba 08 06 00 00       	mov    $0x608,%edx
+ 604:	0f 34                	sysenter
+ 606:	cd 40                	int    $0x40
+ 608:	c3                   	ret
+
+00000609 <link>:
+SYSCALL(link)
+ 609:	b8 13 00 00 00       	mov    $0x13,%eax
+ 60e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 615:	74 09                	je     620 <link+0x17>
+ 617:	89 e1                	mov    %esp,%ecx
+ 619:	ba 22 06 00 00       	mov    $0x622,%edx
+ 61e:	0f 34                	sysenter
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <mkdir>:
+SYSCALL(mkdir)
+ 623:	b8 14 00 00 00       	mov    $0x14,%eax
+ 628:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 62f:	74 09                	je     63a <mkdir+0x17>
+ 631:	89 e1                	mov    %esp,%ecx
+ 633:	ba 3c 06 00 00       	mov    $0x63c,%edx
+ 638:	0f 34                	sysenter
+ 63a:	cd 40                	int    $0x40
+ 63c:	c3                   	ret
+
+0000063d <chdir>:
+SYSCALL(chdir)
+ 63d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 642:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 649:	74 09                	je     654 <chdir+0x17>
+ 64b:	89 e1                	mov    %esp,%ecx
+ 64d:	ba 56 06 00 00       	mov    $0x656,%edx
+ 652:	0f 34                	sysenter
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <dup>:
+SYSCALL(dup)
+ 657:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 65c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 663:	74 09                	je     66e <dup+0x17>
+ 665:	89 e1                	mov    %esp,%ecx
+ 667:	ba 70 06 00 00       	mov    $0x670,%edx
+ 66c:	0f 34                	sysenter
+ 66e:	cd 40                	int    $0x40
+ 670:	c3                   	ret
+
+00000671 <sbrk>:
+SYSCALL(sbrk)
+ 671:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 676:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 67d:	74 09                	je     688 <sbrk+0x17>
+ 67f:	89 e1                	mov    %esp,%ecx
+ 681:	ba 8a 06 00 00       	mov    $0x68a,%edx
+ 686:	0f 34                	sysenter
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <sleep>:
+SYSCALL(sleep)
+ 68b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 690:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 697:	74 09                	je     6a2 <sleep+0x17>
+ 699:	89 e1                	mov    %esp,%ecx
+ 69b:	ba a4 06 00 00       	mov    $0x6a4,%edx
+ 6a0:	0f 34                	sysenter
+ 6a2:	cd 40                	int    $0x40
+ 6a4:	c3                   	ret
+
+000006a5 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 6a5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6aa:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6b1:	74 09                	je     6bc <sigprocmask+0x17>
+ 6b3:	89 e1                	mov    %esp,%ecx
+ 6b5:	ba be 06 00 00       	mov    $0x6be,%edx
+ 6ba:	0f 34                	sysenter
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <sigaction>:
+SYSCALL(sigaction)
+ 6bf:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6c4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6cb:	74 09                	je     6d6 <sigaction+0x17>
+ 6cd:	89 e1                	mov    %esp,%ecx
+ 6cf:	ba d8 06 00 00       	mov    $0x6d8,%edx
+ 6d4:	0f 34                	sysenter
+ 6d6:	cd 40                	int    $0x40
+ 6d8:	c3                   	ret
+
+000006d9 <sigret>:
+SYSCALL(sigret)
+ 6d9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6de:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6e5:	74 09                	je     6f0 <sigret+0x17>
+ 6e7:	89 e1                	mov    %esp,%ecx
+ 6e9:	ba f2 06 00 00       	mov    $0x6f2,%edx
+ 6ee:	0f 34                	sysenter
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <traceread>:
+SYSCALL(traceread)
+ 6f3:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6f8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6ff:	74 09                	je     70a <traceread+0x17>
+ 701:	89 e1                	mov    %esp,%ecx
+ 703:	ba 0c 07 00 00       	mov    $0x70c,%edx
+ 708:	0f 34                	sysenter
+ 70a:	cd 40                	int    $0x40
+ 70c:	c3                   	ret
+
+0000070d <sigqueue>:
+SYSCALL(sigqueue)
+ 70d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 712:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 719:	74 09                	je     724 <sigqueue+0x17>
+ 71b:	89 e1                	mov    %esp,%ecx
+ 71d:	ba 26 07 00 00       	mov    $0x726,%edx
+ 722:	0f 34                	sysenter
+ 724:	cd 40                	int    $0x40
+ 726:	c3                   	ret
+
+00000727 <signalfd>:
+SYSCALL(signalfd)
+ 727:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 72c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 733:	74 09                	je     73e <signalfd+0x17>
+ 735:	89 e1                	mov    %esp,%ecx
+ 737:	ba 40 07 00 00       	mov    $0x740,%edx
+ 73c:	0f 34                	sysenter
+ 73e:	cd 40                	int    $0x40
+ 740:	c3                   	ret
+
+00000741 <sigwait>:
+SYSCALL(sigwait)
+ 741:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 746:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 74d:	74 09                	je     758 <sigwait+0x17>
+ 74f:	89 e1                	mov    %esp,%ecx
+ 751:	ba 5a 07 00 00       	mov    $0x75a,%edx
+ 756:	0f 34                	sysenter
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <sigsuspend>:
+SYSCALL(sigsuspend)
+ 75b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 760:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 767:	74 09                	je     772 <sigsuspend+0x17>
+ 769:	89 e1                	mov    %esp,%ecx
+ 76b:	ba 74 07 00 00       	mov    $0x774,%edx
+ 770:	0f 34                	sysenter
+ 772:	cd 40                	int    $0x40
+ 774:	c3                   	ret
+
+00000775 <waitpid>:
+SYSCALL(waitpid)
+ 775:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 77a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 781:	74 09                	je     78c <waitpid+0x17>
+ 783:	89 e1                	mov    %esp,%ecx
+ 785:	ba 8e 07 00 00       	mov    $0x78e,%edx
+ 78a:	0f 34                	sysenter
+ 78c:	cd 40                	int    $0x40
+ 78e:	c3                   	ret
+
+0000078f <setitimer>:
+SYSCALL(setitimer)
+ 78f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 794:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 79b:	74 09                	je     7a6 <setitimer+0x17>
+ 79d:	89 e1                	mov    %esp,%ecx
+ 79f:	ba a8 07 00 00       	mov    $0x7a8,%edx
+ 7a4:	0f 34                	sysenter
+ 7a6:	cd 40                	int    $0x40
+ 7a8:	c3                   	ret
+
+000007a9 <nanosleep>:
+SYSCALL(nanosleep)
+ 7a9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7ae:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7b5:	74 09                	je     7c0 <nanosleep+0x17>
+ 7b7:	89 e1                	mov    %esp,%ecx
+ 7b9:	ba c2 07 00 00       	mov    $0x7c2,%edx
+ 7be:	0f 34                	sysenter
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <mmap>:
+SYSCALL(mmap)
+ 7c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7c8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7cf:	74 09                	je     7da <mmap+0x17>
+ 7d1:	89 e1                	mov    %esp,%ecx
+ 7d3:	ba dc 07 00 00       	mov    $0x7dc,%edx
+ 7d8:	0f 34                	sysenter
+ 7da:	cd 40                	int    $0x40
+ 7dc:	c3                   	ret
+
+000007dd <munmap>:
+SYSCALL(munmap)
+ 7dd:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7e2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 7e9:	74 09                	je     7f4 <munmap+0x17>
+ 7eb:	89 e1                	mov    %esp,%ecx
+ 7ed:	ba f6 07 00 00       	mov    $0x7f6,%edx
+ 7f2:	0f 34                	sysenter
+ 7f4:	cd 40                	int    $0x40
+ 7f6:	c3                   	ret
+
+000007f7 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 7f7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7fc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 803:	74 09                	je     80e <getpid_syscall+0x17>
+ 805:	89 e1                	mov    %esp,%ecx
+ 807:	ba 10 08 00 00       	mov    $0x810,%edx
+ 80c:	0f 34                	sysenter
+ 80e:	cd 40                	int    $0x40
+ 810:	c3                   	ret
+
+00000811 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 811:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 816:	cd 40                	int    $0x40
+ 818:	c3                   	ret
+ 819:	66 90                	xchg   %ax,%ax
+ 81b:	66 90                	xchg   %ax,%ax
+ 81d:	66 90                	xchg   %ax,%ax
+ 81f:	90                   	nop
+
+00000820 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 828:	89 d1                	mov    %edx,%ecx
+{
+ 82a:	83 ec 3c             	sub    $0x3c,%esp
+ 82d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 830:	85 d2                	test   %edx,%edx
+ 832:	0f 89 80 00 00 00    	jns    8b8 <printint+0x98>
+ 838:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 83c:	74 7a                	je     8b8 <printint+0x98>
+    x = -xx;
+ 83e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 840:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 845:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 848:	31 f6                	xor    %esi,%esi
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 850:	89 c8                	mov    %ecx,%eax
+ 852:	31 d2                	xor    %edx,%edx
+ 854:	89 f7                	mov    %esi,%edi
+ 856:	f7 f3                	div    %ebx
+ 858:	8d 76 01             	lea    0x1(%esi),%esi
+ 85b:	0f b6 92 80 0c 00 00 	movzbl 0xc80(%edx),%edx
+ 862:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 866:	89 ca                	mov    %ecx,%edx
+ 868:	89 c1                	mov    %eax,%ecx
+ 86a:	39 da                	cmp    %ebx,%edx
+ 86c:	73 e2                	jae    850 <printint+0x30>
+  if(neg)
+ 86e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 871:	85 c0                	test   %eax,%eax
+ 873:	74 07                	je     87c <printint+0x5c>
+    buf[i++] = '-';
+ 875:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 87a:	89 f7                	mov    %esi,%edi
+ 87c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 87f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 882:	01 df                	add    %ebx,%edi
+ 884:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 888:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 88b:	83 ec 04             	sub    $0x4,%esp
+ 88e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 891:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 894:	6a 01                	push   $0x1
+ 896:	50                   	push   %eax
+ 897:	56                   	push   %esi
+ 898:	e8 9c fc ff ff       	call   539 <write>
+  while(--i >= 0)
+ 89d:	89 f8                	mov    %edi,%eax
+ 89f:	83 c4 10             	add    $0x10,%esp
+ 8a2:	83 ef 01             	sub    $0x1,%edi
+ 8a5:	39 d8                	cmp    %ebx,%eax
+ 8a7:	75 df                	jne    888 <printint+0x68>
+}
+ 8a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8ac:	5b                   	pop    %ebx
+ 8ad:	5e                   	pop    %esi
+ 8ae:	5f                   	pop    %edi
+ 8af:	5d                   	pop    %ebp
+ 8b0:	c3                   	ret
+ 8b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8b8:	31 c0                	xor    %eax,%eax
+ 8ba:	eb 89                	jmp    845 <printint+0x25>
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 8d2:	83 c6 01             	add    $0x1,%esi
+ 8d5:	84 db                	test   %bl,%bl
+ 8d7:	74 67                	je     940 <printf+0x80>
+ 8d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8dc:	31 d2                	xor    %edx,%edx
+ 8de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8e1:	eb 34                	jmp    917 <printf+0x57>
+ 8e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8e7:	90                   	nop
+ 8e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8f0:	83 f8 25             	cmp    $0x25,%eax
+ 8f3:	74 18                	je     90d <printf+0x4d>
+  write(fd, &c, 1);
+ 8f5:	83 ec 04             	sub    $0x4,%esp
+ 8f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8fe:	6a 01                	push   $0x1
+ 900:	50                   	push   %eax
+ 901:	57                   	push   %edi
+ 902:	e8 32 fc ff ff       	call   539 <write>
+ 907:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 90a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 90d:	0f b6 1e             	movzbl (%esi),%ebx
+ 910:	83 c6 01             	add    $0x1,%esi
+ 913:	84 db                	test   %bl,%bl
+ 915:	74 29                	je     940 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 917:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 91a:	85 d2                	test   %edx,%edx
+ 91c:	74 ca                	je     8e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 91e:	83 fa 25             	cmp    $0x25,%edx
+ 921:	75 ea                	jne    90d <printf+0x4d>
+      if(c == 'd'){
+ 923:	83 f8 25             	cmp    $0x25,%eax
+ 926:	0f 84 24 01 00 00    	je     a50 <printf+0x190>
+ 92c:	83 e8 63             	sub    $0x63,%eax
+ 92f:	83 f8 15             	cmp    $0x15,%eax
+ 932:	77 1c                	ja     950 <printf+0x90>
+ 934:	ff 24 85 28 0c 00 00 	jmp    *0xc28(,%eax,4)
+ 93b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 943:	5b                   	pop    %ebx
+ 944:	5e                   	pop    %esi
+ 945:	5f                   	pop    %edi
+ 946:	5d                   	pop    %ebp
+ 947:	c3                   	ret
+ 948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 956:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 95a:	6a 01                	push   $0x1
+ 95c:	52                   	push   %edx
+ 95d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 960:	57                   	push   %edi
+ 961:	e8 d3 fb ff ff       	call   539 <write>
+ 966:	83 c4 0c             	add    $0xc,%esp
+ 969:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 96c:	6a 01                	push   $0x1
+ 96e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 971:	52                   	push   %edx
+ 972:	57                   	push   %edi
+ 973:	e8 c1 fb ff ff       	call   539 <write>
+        putc(fd, c);
+ 978:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 97b:	31 d2                	xor    %edx,%edx
+ 97d:	eb 8e                	jmp    90d <printf+0x4d>
+ 97f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 980:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 98b:	8b 13                	mov    (%ebx),%edx
+ 98d:	6a 00                	push   $0x0
+ 98f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 991:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 994:	e8 87 fe ff ff       	call   820 <printint>
+        ap++;
+ 999:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 99c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 99f:	31 d2                	xor    %edx,%edx
+ 9a1:	e9 67 ff ff ff       	jmp    90d <printf+0x4d>
+ 9a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9b5:	83 c0 04             	add    $0x4,%eax
+ 9b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9bb:	85 db                	test   %ebx,%ebx
+ 9bd:	0f 84 9d 00 00 00    	je     a60 <printf+0x1a0>
+        while(*s != 0){
+ 9c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9c8:	84 c0                	test   %al,%al
+ 9ca:	0f 84 3d ff ff ff    	je     90d <printf+0x4d>
+ 9d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9d6:	89 de                	mov    %ebx,%esi
+ 9d8:	89 d3                	mov    %edx,%ebx
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9e9:	6a 01                	push   $0x1
+ 9eb:	53                   	push   %ebx
+ 9ec:	57                   	push   %edi
+ 9ed:	e8 47 fb ff ff       	call   539 <write>
+        while(*s != 0){
+ 9f2:	0f b6 06             	movzbl (%esi),%eax
+ 9f5:	83 c4 10             	add    $0x10,%esp
+ 9f8:	84 c0                	test   %al,%al
+ 9fa:	75 e4                	jne    9e0 <printf+0x120>
+      state = 0;
+ 9fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9ff:	31 d2                	xor    %edx,%edx
+ a01:	e9 07 ff ff ff       	jmp    90d <printf+0x4d>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a13:	83 ec 0c             	sub    $0xc,%esp
+ a16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a1b:	8b 13                	mov    (%ebx),%edx
+ a1d:	6a 01                	push   $0x1
+ a1f:	e9 6b ff ff ff       	jmp    98f <printf+0xcf>
+ a24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a28:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a2b:	83 ec 04             	sub    $0x4,%esp
+ a2e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a31:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a33:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a36:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a39:	6a 01                	push   $0x1
+ a3b:	52                   	push   %edx
+ a3c:	57                   	push   %edi
+ a3d:	e8 f7 fa ff ff       	call   539 <write>
+        ap++;
+ a42:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a45:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a48:	31 d2                	xor    %edx,%edx
+ a4a:	e9 be fe ff ff       	jmp    90d <printf+0x4d>
+ a4f:	90                   	nop
+  write(fd, &c, 1);
+ a50:	83 ec 04             	sub    $0x4,%esp
+ a53:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a56:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a59:	6a 01                	push   $0x1
+ a5b:	e9 11 ff ff ff       	jmp    971 <printf+0xb1>
+ a60:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a65:	bb 1f 0c 00 00       	mov    $0xc1f,%ebx
+ a6a:	e9 61 ff ff ff       	jmp    9d0 <printf+0x110>
+ a6f:	90                   	nop
+
+00000a70 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a71:	a1 e0 11 00 00       	mov    0x11e0,%eax
+{
+ a76:	89 e5                	mov    %esp,%ebp
+ a78:	57                   	push   %edi
+ a79:	56                   	push   %esi
+ a7a:	53                   	push   %ebx
+ a7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a7e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a88:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a8a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a8c:	39 ca                	cmp    %ecx,%edx
+ a8e:	73 30                	jae    ac0 <free+0x50>
+ a90:	39 c1                	cmp    %eax,%ecx
+ a92:	72 04                	jb     a98 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a94:	39 c2                	cmp    %eax,%edx
+ a96:	72 f0                	jb     a88 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a98:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a9b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a9e:	39 f8                	cmp    %edi,%eax
+ aa0:	74 2e                	je     ad0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ aa2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ aa5:	8b 42 04             	mov    0x4(%edx),%eax
+ aa8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ aab:	39 f1                	cmp    %esi,%ecx
+ aad:	74 38                	je     ae7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ aaf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ab1:	5b                   	pop    %ebx
+  freep = p;
+ ab2:	89 15 e0 11 00 00    	mov    %edx,0x11e0
+}
+ ab8:	5e                   	pop    %esi
+ ab9:	5f                   	pop    %edi
+ aba:	5d                   	pop    %ebp
+ abb:	c3                   	ret
+ abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ac0:	39 c1                	cmp    %eax,%ecx
+ ac2:	72 d0                	jb     a94 <free+0x24>
+ ac4:	eb c2                	jmp    a88 <free+0x18>
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ad0:	03 70 04             	add    0x4(%eax),%esi
+ ad3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ad6:	8b 02                	mov    (%edx),%eax
+ ad8:	8b 00                	mov    (%eax),%eax
+ ada:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ add:	8b 42 04             	mov    0x4(%edx),%eax
+ ae0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ae3:	39 f1                	cmp    %esi,%ecx
+ ae5:	75 c8                	jne    aaf <free+0x3f>
+    p->s.size += bp->s.size;
+ ae7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ aea:	89 15 e0 11 00 00    	mov    %edx,0x11e0
+    p->s.size += bp->s.size;
+ af0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ af3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ af6:	89 0a                	mov    %ecx,(%edx)
+}
+ af8:	5b                   	pop    %ebx
+ af9:	5e                   	pop    %esi
+ afa:	5f                   	pop    %edi
+ afb:	5d                   	pop    %ebp
+ afc:	c3                   	ret
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	53                   	push   %ebx
+ b06:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b0c:	8b 15 e0 11 00 00    	mov    0x11e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b12:	8d 78 07             	lea    0x7(%eax),%edi
+ b15:	c1 ef 03             	shr    $0x3,%edi
+ b18:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b1b:	85 d2                	test   %edx,%edx
+ b1d:	0f 84 8d 00 00 00    	je     bb0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b23:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b25:	8b 48 04             	mov    0x4(%eax),%ecx
+ b28:	39 f9                	cmp    %edi,%ecx
+ b2a:	73 64                	jae    b90 <malloc+0x90>
+  if(nu < 4096)
+ b2c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b31:	39 df                	cmp    %ebx,%edi
+ b33:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b36:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b3d:	eb 0a                	jmp    b49 <malloc+0x49>
+ b3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b40:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b42:	8b 48 04             	mov    0x4(%eax),%ecx
+ b45:	39 f9                	cmp    %edi,%ecx
+ b47:	73 47                	jae    b90 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b49:	89 c2                	mov    %eax,%edx
+ b4b:	39 05 e0 11 00 00    	cmp    %eax,0x11e0
+ b51:	75 ed                	jne    b40 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b53:	83 ec 0c             	sub    $0xc,%esp
+ b56:	56                   	push   %esi
+ b57:	e8 15 fb ff ff       	call   671 <sbrk>
+  if(p == (char*)-1)
+ b5c:	83 c4 10             	add    $0x10,%esp
+ b5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b62:	74 1c                	je     b80 <malloc+0x80>
+  hp->s.size = nu;
+ b64:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b67:	83 ec 0c             	sub    $0xc,%esp
+ b6a:	83 c0 08             	add    $0x8,%eax
+ b6d:	50                   	push   %eax
+ b6e:	e8 fd fe ff ff       	call   a70 <free>
+  return freep;
+ b73:	8b 15 e0 11 00 00    	mov    0x11e0,%edx
+      if((p = morecore(nunits)) == 0)
+ b79:	83 c4 10             	add    $0x10,%esp
+ b7c:	85 d2                	test   %edx,%edx
+ b7e:	75 c0                	jne    b40 <malloc+0x40>
+        return 0;
+  }
+}
+ b80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b83:	31 c0                	xor    %eax,%eax
+}
+ b85:	5b                   	pop    %ebx
+ b86:	5e                   	pop    %esi
+ b87:	5f                   	pop    %edi
+ b88:	5d                   	pop    %ebp
+ b89:	c3                   	ret
+ b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b90:	39 cf                	cmp    %ecx,%edi
+ b92:	74 4c                	je     be0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b94:	29 f9                	sub    %edi,%ecx
+ b96:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b99:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b9c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b9f:	89 15 e0 11 00 00    	mov    %edx,0x11e0
+}
+ ba5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ba8:	83 c0 08             	add    $0x8,%eax
+}
+ bab:	5b                   	pop    %ebx
+ bac:	5e                   	pop    %esi
+ bad:	5f                   	pop    %edi
+ bae:	5d                   	pop    %ebp
+ baf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ bb0:	c7 05 e0 11 00 00 e4 	movl   $0x11e4,0x11e0
+ bb7:	11 00 00 
+    base.s.size = 0;
+ bba:	b8 e4 11 00 00       	mov    $0x11e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ bbf:	c7 05 e4 11 00 00 e4 	movl   $0x11e4,0x11e4
+ bc6:	11 00 00 
+    base.s.size = 0;
+ bc9:	c7 05 e8 11 00 00 00 	movl   $0x0,0x11e8
+ bd0:	00 00 00 
+    if(p->s.size >= nunits){
+ bd3:	e9 54 ff ff ff       	jmp    b2c <malloc+0x2c>
+ bd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bdf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ be0:	8b 08                	mov    (%eax),%ecx
+ be2:	89 0a                	mov    %ecx,(%edx)
+ be4:	eb b9                	jmp    b9f <malloc+0x9f>
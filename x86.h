@@ -130,6 +130,89 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Atomically replace *addr with newval if it still holds old.
+// Returns the value *addr held before the operation.
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+               "=a" (result), "+m" (*addr) :
+               "r" (newval), "0" (old) :
+               "cc", "memory");
+  return result;
+}
+
+// Atomically OR bits into *addr.
+static inline void
+atomic_or(volatile uint *addr, uint bits)
+{
+  asm volatile("lock; orl %1, %0" : "+m" (*addr) : "r" (bits) : "cc", "memory");
+}
+
+// Index of the least significant set bit of v.  v must be non-zero.
+static inline uint
+bsf(uint v)
+{
+  uint idx;
+
+  asm volatile("bsfl %1, %0" : "=r" (idx) : "rm" (v) : "cc");
+  return idx;
+}
+
+// Index of the most significant set bit of v.  v must be non-zero.
+static inline uint
+bsr(uint v)
+{
+  uint idx;
+
+  asm volatile("bsrl %1, %0" : "=r" (idx) : "rm" (v) : "cc");
+  return idx;
+}
+
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((uint64)hi << 32) | lo;
+}
+
+// Divide n by d with a single divl, storing the remainder in *rem if
+// rem is non-zero. The quotient must fit in 32 bits (n < d * 2^32).
+// Saves pulling in libgcc's 64-bit division.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+               "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d) : "cc");
+  if(rem)
+    *rem = r;
+  return q;
+}
+
+// Write a model-specific register.
+static inline void
+wrmsr(uint msr, uint64 val)
+{
+  asm volatile("wrmsr" : : "c" (msr), "a" ((uint)val), "d" ((uint)(val >> 32)));
+}
+
+// Feature flags in %edx of CPUID leaf 1.
+static inline uint
+cpufeatures(void)
+{
+  uint a, b, c, d;
+
+  asm volatile("cpuid" : "=a" (a), "=b" (b), "=c" (c), "=d" (d) : "a" (1));
+  return d;
+}
+
 static inline uint
 rcr2(void)
 {
@@ -144,6 +227,12 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
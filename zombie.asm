@@ -0,0 +1,1501 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 41 03 00 00       	call   357 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 07 05 00 00       	call   52b <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit(0);
+  27:	83 ec 0c             	sub    $0xc,%esp
+  2a:	6a 00                	push   $0x0
+  2c:	e8 40 03 00 00       	call   371 <exit>
+  31:	66 90                	xchg   %ax,%ax
+  33:	66 90                	xchg   %ax,%ax
+  35:	66 90                	xchg   %ax,%ax
+  37:	66 90                	xchg   %ax,%ax
+  39:	66 90                	xchg   %ax,%ax
+  3b:	66 90                	xchg   %ax,%ax
+  3d:	66 90                	xchg   %ax,%ax
+  3f:	90                   	nop
+
+00000040 <strcpy>:
+#include "memlayout.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  40:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  41:	31 c0                	xor    %eax,%eax
+{
+  43:	89 e5                	mov    %esp,%ebp
+  45:	53                   	push   %ebx
+  46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  49:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  50:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  54:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  57:	83 c0 01             	add    $0x1,%eax
+  5a:	84 d2                	test   %dl,%dl
+  5c:	75 f2                	jne    50 <strcpy+0x10>
+    ;
+  return os;
+}
+  5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  61:	89 c8                	mov    %ecx,%eax
+  63:	c9                   	leave
+  64:	c3                   	ret
+  65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000070 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	53                   	push   %ebx
+  74:	8b 55 08             	mov    0x8(%ebp),%edx
+  77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  7a:	0f b6 02             	movzbl (%edx),%eax
+  7d:	84 c0                	test   %al,%al
+  7f:	75 17                	jne    98 <strcmp+0x28>
+  81:	eb 3a                	jmp    bd <strcmp+0x4d>
+  83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  87:	90                   	nop
+  88:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  8c:	83 c2 01             	add    $0x1,%edx
+  8f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  92:	84 c0                	test   %al,%al
+  94:	74 1a                	je     b0 <strcmp+0x40>
+    p++, q++;
+  96:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  98:	0f b6 19             	movzbl (%ecx),%ebx
+  9b:	38 c3                	cmp    %al,%bl
+  9d:	74 e9                	je     88 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  9f:	29 d8                	sub    %ebx,%eax
+}
+  a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a4:	c9                   	leave
+  a5:	c3                   	ret
+  a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  b4:	31 c0                	xor    %eax,%eax
+  b6:	29 d8                	sub    %ebx,%eax
+}
+  b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  bb:	c9                   	leave
+  bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  bd:	0f b6 19             	movzbl (%ecx),%ebx
+  c0:	31 c0                	xor    %eax,%eax
+  c2:	eb db                	jmp    9f <strcmp+0x2f>
+  c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  cf:	90                   	nop
+
+000000d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  d6:	80 3a 00             	cmpb   $0x0,(%edx)
+  d9:	74 15                	je     f0 <strlen+0x20>
+  db:	31 c0                	xor    %eax,%eax
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  e0:	83 c0 01             	add    $0x1,%eax
+  e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  e7:	89 c1                	mov    %eax,%ecx
+  e9:	75 f5                	jne    e0 <strlen+0x10>
+    ;
+  return n;
+}
+  eb:	89 c8                	mov    %ecx,%eax
+  ed:	5d                   	pop    %ebp
+  ee:	c3                   	ret
+  ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+  f0:	31 c9                	xor    %ecx,%ecx
+}
+  f2:	5d                   	pop    %ebp
+  f3:	89 c8                	mov    %ecx,%eax
+  f5:	c3                   	ret
+  f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000100 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 107:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 10a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10d:	89 d7                	mov    %edx,%edi
+ 10f:	fc                   	cld
+ 110:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 112:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 115:	89 d0                	mov    %edx,%eax
+ 117:	c9                   	leave
+ 118:	c3                   	ret
+ 119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	8b 45 08             	mov    0x8(%ebp),%eax
+ 126:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 12a:	0f b6 10             	movzbl (%eax),%edx
+ 12d:	84 d2                	test   %dl,%dl
+ 12f:	75 12                	jne    143 <strchr+0x23>
+ 131:	eb 1d                	jmp    150 <strchr+0x30>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 13c:	83 c0 01             	add    $0x1,%eax
+ 13f:	84 d2                	test   %dl,%dl
+ 141:	74 0d                	je     150 <strchr+0x30>
+    if(*s == c)
+ 143:	38 d1                	cmp    %dl,%cl
+ 145:	75 f1                	jne    138 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 147:	5d                   	pop    %ebp
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 150:	31 c0                	xor    %eax,%eax
+}
+ 152:	5d                   	pop    %ebp
+ 153:	c3                   	ret
+ 154:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+
+00000160 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 165:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 168:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 169:	31 db                	xor    %ebx,%ebx
+{
+ 16b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 16e:	eb 27                	jmp    197 <gets+0x37>
+    cc = read(0, &c, 1);
+ 170:	83 ec 04             	sub    $0x4,%esp
+ 173:	6a 01                	push   $0x1
+ 175:	56                   	push   %esi
+ 176:	6a 00                	push   $0x0
+ 178:	e8 42 02 00 00       	call   3bf <read>
+    if(cc < 1)
+ 17d:	83 c4 10             	add    $0x10,%esp
+ 180:	85 c0                	test   %eax,%eax
+ 182:	7e 1d                	jle    1a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 184:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 188:	8b 55 08             	mov    0x8(%ebp),%edx
+ 18b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 18f:	3c 0a                	cmp    $0xa,%al
+ 191:	74 10                	je     1a3 <gets+0x43>
+ 193:	3c 0d                	cmp    $0xd,%al
+ 195:	74 0c                	je     1a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 197:	89 df                	mov    %ebx,%edi
+ 199:	83 c3 01             	add    $0x1,%ebx
+ 19c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 19f:	7c cf                	jl     170 <gets+0x10>
+ 1a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ad:	5b                   	pop    %ebx
+ 1ae:	5e                   	pop    %esi
+ 1af:	5f                   	pop    %edi
+ 1b0:	5d                   	pop    %ebp
+ 1b1:	c3                   	ret
+ 1b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	56                   	push   %esi
+ 1c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1c5:	83 ec 08             	sub    $0x8,%esp
+ 1c8:	6a 00                	push   $0x0
+ 1ca:	ff 75 08             	push   0x8(%ebp)
+ 1cd:	e8 6f 02 00 00       	call   441 <open>
+  if(fd < 0)
+ 1d2:	83 c4 10             	add    $0x10,%esp
+ 1d5:	85 c0                	test   %eax,%eax
+ 1d7:	78 27                	js     200 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1d9:	83 ec 08             	sub    $0x8,%esp
+ 1dc:	ff 75 0c             	push   0xc(%ebp)
+ 1df:	89 c3                	mov    %eax,%ebx
+ 1e1:	50                   	push   %eax
+ 1e2:	e8 a8 02 00 00       	call   48f <fstat>
+  close(fd);
+ 1e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1ec:	e8 02 02 00 00       	call   3f3 <close>
+  return r;
+ 1f1:	83 c4 10             	add    $0x10,%esp
+}
+ 1f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1f7:	89 f0                	mov    %esi,%eax
+ 1f9:	5b                   	pop    %ebx
+ 1fa:	5e                   	pop    %esi
+ 1fb:	5d                   	pop    %ebp
+ 1fc:	c3                   	ret
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 200:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 205:	eb ed                	jmp    1f4 <stat+0x34>
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+
+00000210 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	53                   	push   %ebx
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 217:	0f be 02             	movsbl (%edx),%eax
+ 21a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 21d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 220:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 225:	77 1e                	ja     245 <atoi+0x35>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 230:	83 c2 01             	add    $0x1,%edx
+ 233:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 236:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 23a:	0f be 02             	movsbl (%edx),%eax
+ 23d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 240:	80 fb 09             	cmp    $0x9,%bl
+ 243:	76 eb                	jbe    230 <atoi+0x20>
+  return n;
+}
+ 245:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 248:	89 c8                	mov    %ecx,%eax
+ 24a:	c9                   	leave
+ 24b:	c3                   	ret
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	56                   	push   %esi
+ 255:	8b 45 10             	mov    0x10(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 25e:	85 c0                	test   %eax,%eax
+ 260:	7e 13                	jle    275 <memmove+0x25>
+ 262:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 264:	89 d7                	mov    %edx,%edi
+ 266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 270:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 271:	39 f8                	cmp    %edi,%eax
+ 273:	75 fb                	jne    270 <memmove+0x20>
+  return vdst;
+}
+ 275:	5e                   	pop    %esi
+ 276:	89 d0                	mov    %edx,%eax
+ 278:	5f                   	pop    %edi
+ 279:	5d                   	pop    %ebp
+ 27a:	c3                   	ret
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <alarm>:
+
+// Post SIGALRM to this process after n clock ticks; 0 cancels.
+// Returns the ticks that were left on the previous alarm.
+uint
+alarm(uint n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	83 ec 1c             	sub    $0x1c,%esp
+  struct itimerval v, old;
+
+  v.it_interval = 0;
+  v.it_value = n;
+ 286:	8b 45 08             	mov    0x8(%ebp),%eax
+  v.it_interval = 0;
+ 289:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  v.it_value = n;
+ 290:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(setitimer(ITIMER_REAL, &v, &old) < 0)
+ 293:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 296:	50                   	push   %eax
+ 297:	8d 45 e8             	lea    -0x18(%ebp),%eax
+ 29a:	50                   	push   %eax
+ 29b:	6a 00                	push   $0x0
+ 29d:	e8 8d 03 00 00       	call   62f <setitimer>
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	89 c2                	mov    %eax,%edx
+ 2a7:	31 c0                	xor    %eax,%eax
+ 2a9:	85 d2                	test   %edx,%edx
+ 2ab:	78 03                	js     2b0 <alarm+0x30>
+    return 0;
+  return old.it_value;
+ 2ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 2b0:	c9                   	leave
+ 2b1:	c3                   	ret
+ 2b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <getpid>:
+// same names remain for code that issues them directly.
+int
+getpid(void)
+{
+  return ((struct vproc*)VPROC)->pid;
+}
+ 2c0:	a1 00 d0 ff 7f       	mov    0x7fffd000,%eax
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <uptime>:
+
+int
+uptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 2d0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+}
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <clock_gettime>:
+
+int
+clock_gettime(int clock, struct timespec *ts)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+ 2e5:	53                   	push   %ebx
+ 2e6:	83 ec 0c             	sub    $0xc,%esp
+  struct vdso *v = (struct vdso*)VDSO;
+
+  if(clock != CLOCK_MONOTONIC)
+ 2e9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 2ed:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(clock != CLOCK_MONOTONIC)
+ 2f0:	75 5e                	jne    350 <clock_gettime+0x70>
+    return -1;
+  vdso_tsc2ts(rdtsc() - v->tsc0, v->tsckhz, ts);
+ 2f2:	8b 35 04 e0 ff 7f    	mov    0x7fffe004,%esi
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 2f8:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 2fa:	89 d3                	mov    %edx,%ebx
+ 2fc:	89 c1                	mov    %eax,%ecx
+ 2fe:	2b 0d 08 e0 ff 7f    	sub    0x7fffe008,%ecx
+ 304:	1b 1d 0c e0 ff 7f    	sbb    0x7fffe00c,%ebx
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r) :
+ 30a:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 30d:	31 d2                	xor    %edx,%edx
+ 30f:	89 d8                	mov    %ebx,%eax
+ 311:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 314:	f7 f6                	div    %esi
+ 316:	89 c3                	mov    %eax,%ebx
+{
+  uint hi, lo, r, ms;
+
+  // Two divl steps so that any 64-bit interval fits.
+  hi = divl(cycles >> 32, khz, &r);
+  lo = divl(((uint64)r << 32) | (uint)cycles, khz, &r);
+ 318:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 31b:	f7 f6                	div    %esi
+ 31d:	89 d1                	mov    %edx,%ecx
+  ts->tv_sec = divl(((uint64)hi << 32) | lo, 1000, &ms);
+ 31f:	89 da                	mov    %ebx,%edx
+ 321:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+ 326:	f7 f3                	div    %ebx
+ 328:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = ms * 1000000 + divl((uint64)r * 1000000, khz, 0);
+ 32a:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 32f:	89 d3                	mov    %edx,%ebx
+ 331:	f7 e1                	mul    %ecx
+ 333:	f7 f6                	div    %esi
+ 335:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+ 33b:	01 c3                	add    %eax,%ebx
+  return 0;
+ 33d:	31 c0                	xor    %eax,%eax
+ 33f:	89 5f 04             	mov    %ebx,0x4(%edi)
+}
+ 342:	83 c4 0c             	add    $0xc,%esp
+ 345:	5b                   	pop    %ebx
+ 346:	5e                   	pop    %esi
+ 347:	5f                   	pop    %edi
+ 348:	5d                   	pop    %ebp
+ 349:	c3                   	ret
+ 34a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+ 350:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 355:	eb eb                	jmp    342 <clock_gettime+0x62>
+
+00000357 <fork>:
+  sym: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 357:	b8 01 00 00 00       	mov    $0x1,%eax
+ 35c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 363:	74 09                	je     36e <fork+0x17>
+ 365:	89 e1                	mov    %esp,%ecx
+ 367:	ba 70 03 00 00       	mov    $0x370,%edx
+ 36c:	0f 34                	sysenter
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <exit>:
+SYSCALL(exit)
+ 371:	b8 02 00 00 00       	mov    $0x2,%eax
+ 376:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 37d:	74 09                	je     388 <exit+0x17>
+ 37f:	89 e1                	mov    %esp,%ecx
+ 381:	ba 8a 03 00 00       	mov    $0x38a,%edx
+ 386:	0f 34                	sysenter
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <wait>:
+SYSCALL(wait)
+ 38b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 390:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 397:	74 09                	je     3a2 <wait+0x17>
+ 399:	89 e1                	mov    %esp,%ecx
+ 39b:	ba a4 03 00 00       	mov    $0x3a4,%edx
+ 3a0:	0f 34                	sysenter
+ 3a2:	cd 40                	int    $0x40
+ 3a4:	c3                   	ret
+
+000003a5 <pipe>:
+SYSCALL(pipe)
+ 3a5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3aa:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3b1:	74 09                	je     3bc <pipe+0x17>
+ 3b3:	89 e1                	mov    %esp,%ecx
+ 3b5:	ba be 03 00 00       	mov    $0x3be,%edx
+ 3ba:	0f 34                	sysenter
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <read>:
+SYSCALL(read)
+ 3bf:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c4:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3cb:	74 09                	je     3d6 <read+0x17>
+ 3cd:	89 e1                	mov    %esp,%ecx
+ 3cf:	ba d8 03 00 00       	mov    $0x3d8,%edx
+ 3d4:	0f 34                	sysenter
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <write>:
+SYSCALL(write)
+ 3d9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3de:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3e5:	74 09                	je     3f0 <write+0x17>
+ 3e7:	89 e1                	mov    %esp,%ecx
+ 3e9:	ba f2 03 00 00       	mov    $0x3f2,%edx
+ 3ee:	0f 34                	sysenter
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <close>:
+SYSCALL(close)
+ 3f3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3f8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 3ff:	74 09                	je     40a <close+0x17>
+ 401:	89 e1                	mov    %esp,%ecx
+ 403:	ba 0c 04 00 00       	mov    $0x40c,%edx
+ 408:	0f 34                	sysenter
+ 40a:	cd 40                	int    $0x40
+ 40c:	c3                   	ret
+
+0000040d <kill>:
+SYSCALL(kill)
+ 40d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 412:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 419:	74 09                	je     424 <kill+0x17>
+ 41b:	89 e1                	mov    %esp,%ecx
+ 41d:	ba 26 04 00 00       	mov    $0x426,%edx
+ 422:	0f 34                	sysenter
+ 424:	cd 40                	int    $0x40
+ 426:	c3                   	ret
+
+00000427 <exec>:
+SYSCALL(exec)
+ 427:	b8 07 00 00 00       	mov    $0x7,%eax
+ 42c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 433:	74 09                	je     43e <exec+0x17>
+ 435:	89 e1                	mov    %esp,%ecx
+ 437:	ba 40 04 00 00       	mov    $0x440,%edx
+ 43c:	0f 34                	sysenter
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <open>:
+SYSCALL(open)
+ 441:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 446:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 44d:	74 09                	je     458 <open+0x17>
+ 44f:	89 e1                	mov    %esp,%ecx
+ 451:	ba 5a 04 00 00       	mov    $0x45a,%edx
+ 456:	0f 34                	sysenter
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mknod>:
+SYSCALL(mknod)
+ 45b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 460:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 467:	74 09                	je     472 <mknod+0x17>
+ 469:	89 e1                	mov    %esp,%ecx
+ 46b:	ba 74 04 00 00       	mov    $0x474,%edx
+ 470:	0f 34                	sysenter
+ 472:	cd 40                	int    $0x40
+ 474:	c3                   	ret
+
+00000475 <unlink>:
+SYSCALL(unlink)
+ 475:	b8 12 00 00 00       	mov    $0x12,%eax
+ 47a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 481:	74 09                	je     48c <unlink+0x17>
+ 483:	89 e1                	mov    %esp,%ecx
+ 485:	ba 8e 04 00 00       	mov    $0x48e,%edx
+ 48a:	0f 34                	sysenter
+ 48c:	cd 40                	int    $0x40
+ 48e:	c3                   	ret
+
+0000048f <fstat>:
+SYSCALL(fstat)
+ 48f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 494:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 49b:	74 09                	je     4a6 <fstat+0x17>
+ 49d:	89 e1                	mov    %esp,%ecx
+ 49f:	ba a8 04 00 00       	mov    $0x4a8,%edx
+ 4a4:	0f 34                	sysenter
+ 4a6:	cd 40                	int    $0x40
+ 4a8:	c3                   	ret
+
+000004a9 <link>:
+SYSCALL(link)
+ 4a9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4ae:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4b5:	74 09                	je     4c0 <link+0x17>
+ 4b7:	89 e1                	mov    %esp,%ecx
+ 4b9:	ba c2 04 00 00       	mov    $0x4c2,%edx
+ 4be:	0f 34                	sysenter
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <mkdir>:
+SYSCALL(mkdir)
+ 4c3:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4c8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4cf:	74 09                	je     4da <mkdir+0x17>
+ 4d1:	89 e1                	mov    %esp,%ecx
+ 4d3:	ba dc 04 00 00       	mov    $0x4dc,%edx
+ 4d8:	0f 34                	sysenter
+ 4da:	cd 40                	int    $0x40
+ 4dc:	c3                   	ret
+
+000004dd <chdir>:
+SYSCALL(chdir)
+ 4dd:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4e2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 4e9:	74 09                	je     4f4 <chdir+0x17>
+ 4eb:	89 e1                	mov    %esp,%ecx
+ 4ed:	ba f6 04 00 00       	mov    $0x4f6,%edx
+ 4f2:	0f 34                	sysenter
+ 4f4:	cd 40                	int    $0x40
+ 4f6:	c3                   	ret
+
+000004f7 <dup>:
+SYSCALL(dup)
+ 4f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4fc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 503:	74 09                	je     50e <dup+0x17>
+ 505:	89 e1                	mov    %esp,%ecx
+ 507:	ba 10 05 00 00       	mov    $0x510,%edx
+ 50c:	0f 34                	sysenter
+ 50e:	cd 40                	int    $0x40
+ 510:	c3                   	ret
+
+00000511 <sbrk>:
+SYSCALL(sbrk)
+ 511:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 516:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 51d:	74 09                	je     528 <sbrk+0x17>
+ 51f:	89 e1                	mov    %esp,%ecx
+ 521:	ba 2a 05 00 00       	mov    $0x52a,%edx
+ 526:	0f 34                	sysenter
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <sleep>:
+SYSCALL(sleep)
+ 52b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 530:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 537:	74 09                	je     542 <sleep+0x17>
+ 539:	89 e1                	mov    %esp,%ecx
+ 53b:	ba 44 05 00 00       	mov    $0x544,%edx
+ 540:	0f 34                	sysenter
+ 542:	cd 40                	int    $0x40
+ 544:	c3                   	ret
+
+00000545 <sigprocmask>:
+SYSCALL(sigprocmask)
+ 545:	b8 16 00 00 00       	mov    $0x16,%eax
+ 54a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 551:	74 09                	je     55c <sigprocmask+0x17>
+ 553:	89 e1                	mov    %esp,%ecx
+ 555:	ba 5e 05 00 00       	mov    $0x55e,%edx
+ 55a:	0f 34                	sysenter
+ 55c:	cd 40                	int    $0x40
+ 55e:	c3                   	ret
+
+0000055f <sigaction>:
+SYSCALL(sigaction)
+ 55f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 564:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 56b:	74 09                	je     576 <sigaction+0x17>
+ 56d:	89 e1                	mov    %esp,%ecx
+ 56f:	ba 78 05 00 00       	mov    $0x578,%edx
+ 574:	0f 34                	sysenter
+ 576:	cd 40                	int    $0x40
+ 578:	c3                   	ret
+
+00000579 <sigret>:
+SYSCALL(sigret)
+ 579:	b8 18 00 00 00       	mov    $0x18,%eax
+ 57e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 585:	74 09                	je     590 <sigret+0x17>
+ 587:	89 e1                	mov    %esp,%ecx
+ 589:	ba 92 05 00 00       	mov    $0x592,%edx
+ 58e:	0f 34                	sysenter
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <traceread>:
+SYSCALL(traceread)
+ 593:	b8 19 00 00 00       	mov    $0x19,%eax
+ 598:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 59f:	74 09                	je     5aa <traceread+0x17>
+ 5a1:	89 e1                	mov    %esp,%ecx
+ 5a3:	ba ac 05 00 00       	mov    $0x5ac,%edx
+ 5a8:	0f 34                	sysenter
+ 5aa:	cd 40                	int    $0x40
+ 5ac:	c3                   	ret
+
+000005ad <sigqueue>:
+SYSCALL(sigqueue)
+ 5ad:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5b2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5b9:	74 09                	je     5c4 <sigqueue+0x17>
+ 5bb:	89 e1                	mov    %esp,%ecx
+ 5bd:	ba c6 05 00 00       	mov    $0x5c6,%edx
+ 5c2:	0f 34                	sysenter
+ 5c4:	cd 40                	int    $0x40
+ 5c6:	c3                   	ret
+
+000005c7 <signalfd>:
+SYSCALL(signalfd)
+ 5c7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5cc:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5d3:	74 09                	je     5de <signalfd+0x17>
+ 5d5:	89 e1                	mov    %esp,%ecx
+ 5d7:	ba e0 05 00 00       	mov    $0x5e0,%edx
+ 5dc:	0f 34                	sysenter
+ 5de:	cd 40                	int    $0x40
+ 5e0:	c3                   	ret
+
+000005e1 <sigwait>:
+SYSCALL(sigwait)
+ 5e1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5e6:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 5ed:	74 09                	je     5f8 <sigwait+0x17>
+ 5ef:	89 e1                	mov    %esp,%ecx
+ 5f1:	ba fa 05 00 00       	mov    $0x5fa,%edx
+ 5f6:	0f 34                	sysenter
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <sigsuspend>:
+SYSCALL(sigsuspend)
+ 5fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 600:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 607:	74 09                	je     612 <sigsuspend+0x17>
+ 609:	89 e1                	mov    %esp,%ecx
+ 60b:	ba 14 06 00 00       	mov    $0x614,%edx
+ 610:	0f 34                	sysenter
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <waitpid>:
+SYSCALL(waitpid)
+ 615:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 61a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 621:	74 09                	je     62c <waitpid+0x17>
+ 623:	89 e1                	mov    %esp,%ecx
+ 625:	ba 2e 06 00 00       	mov    $0x62e,%edx
+ 62a:	0f 34                	sysenter
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <setitimer>:
+SYSCALL(setitimer)
+ 62f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 634:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 63b:	74 09                	je     646 <setitimer+0x17>
+ 63d:	89 e1                	mov    %esp,%ecx
+ 63f:	ba 48 06 00 00       	mov    $0x648,%edx
+ 644:	0f 34                	sysenter
+ 646:	cd 40                	int    $0x40
+ 648:	c3                   	ret
+
+00000649 <nanosleep>:
+SYSCALL(nanosleep)
+ 649:	b8 21 00 00 00       	mov    $0x21,%eax
+ 64e:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 655:	74 09                	je     660 <nanosleep+0x17>
+ 657:	89 e1                	mov    %esp,%ecx
+ 659:	ba 62 06 00 00       	mov    $0x662,%edx
+ 65e:	0f 34                	sysenter
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <mmap>:
+SYSCALL(mmap)
+ 663:	b8 22 00 00 00       	mov    $0x22,%eax
+ 668:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 66f:	74 09                	je     67a <mmap+0x17>
+ 671:	89 e1                	mov    %esp,%ecx
+ 673:	ba 7c 06 00 00       	mov    $0x67c,%edx
+ 678:	0f 34                	sysenter
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <munmap>:
+SYSCALL(munmap)
+ 67d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 682:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 689:	74 09                	je     694 <munmap+0x17>
+ 68b:	89 e1                	mov    %esp,%ecx
+ 68d:	ba 96 06 00 00       	mov    $0x696,%edx
+ 692:	0f 34                	sysenter
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <getpid_syscall>:
+
+// ulib reads getpid() from the VPROC page; these stubs still trap.
+SYSCALL_AS(getpid_syscall, getpid)
+ 697:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 69c:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+ 6a3:	74 09                	je     6ae <getpid_syscall+0x17>
+ 6a5:	89 e1                	mov    %esp,%ecx
+ 6a7:	ba b0 06 00 00       	mov    $0x6b0,%edx
+ 6ac:	0f 34                	sysenter
+ 6ae:	cd 40                	int    $0x40
+ 6b0:	c3                   	ret
+
+000006b1 <getpid_int>:
+SYSCALL_INT(getpid_int, getpid)
+ 6b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6b6:	cd 40                	int    $0x40
+ 6b8:	c3                   	ret
+ 6b9:	66 90                	xchg   %ax,%ax
+ 6bb:	66 90                	xchg   %ax,%ax
+ 6bd:	66 90                	xchg   %ax,%ax
+ 6bf:	90                   	nop
+
+000006c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	56                   	push   %esi
+ 6c5:	53                   	push   %ebx
+ 6c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6c8:	89 d1                	mov    %edx,%ecx
+{
+ 6ca:	83 ec 3c             	sub    $0x3c,%esp
+ 6cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6d0:	85 d2                	test   %edx,%edx
+ 6d2:	0f 89 80 00 00 00    	jns    758 <printint+0x98>
+ 6d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6dc:	74 7a                	je     758 <printint+0x98>
+    x = -xx;
+ 6de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6e8:	31 f6                	xor    %esi,%esi
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6f0:	89 c8                	mov    %ecx,%eax
+ 6f2:	31 d2                	xor    %edx,%edx
+ 6f4:	89 f7                	mov    %esi,%edi
+ 6f6:	f7 f3                	div    %ebx
+ 6f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6fb:	0f b6 92 e8 0a 00 00 	movzbl 0xae8(%edx),%edx
+ 702:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 706:	89 ca                	mov    %ecx,%edx
+ 708:	89 c1                	mov    %eax,%ecx
+ 70a:	39 da                	cmp    %ebx,%edx
+ 70c:	73 e2                	jae    6f0 <printint+0x30>
+  if(neg)
+ 70e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 711:	85 c0                	test   %eax,%eax
+ 713:	74 07                	je     71c <printint+0x5c>
+    buf[i++] = '-';
+ 715:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 71a:	89 f7                	mov    %esi,%edi
+ 71c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 71f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 722:	01 df                	add    %ebx,%edi
+ 724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 728:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 72b:	83 ec 04             	sub    $0x4,%esp
+ 72e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 731:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 734:	6a 01                	push   $0x1
+ 736:	50                   	push   %eax
+ 737:	56                   	push   %esi
+ 738:	e8 9c fc ff ff       	call   3d9 <write>
+  while(--i >= 0)
+ 73d:	89 f8                	mov    %edi,%eax
+ 73f:	83 c4 10             	add    $0x10,%esp
+ 742:	83 ef 01             	sub    $0x1,%edi
+ 745:	39 d8                	cmp    %ebx,%eax
+ 747:	75 df                	jne    728 <printint+0x68>
+}
+ 749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 74c:	5b                   	pop    %ebx
+ 74d:	5e                   	pop    %esi
+ 74e:	5f                   	pop    %edi
+ 74f:	5d                   	pop    %ebp
+ 750:	c3                   	ret
+ 751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 758:	31 c0                	xor    %eax,%eax
+ 75a:	eb 89                	jmp    6e5 <printint+0x25>
+ 75c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	57                   	push   %edi
+ 764:	56                   	push   %esi
+ 765:	53                   	push   %ebx
+ 766:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 769:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 76c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 76f:	0f b6 1e             	movzbl (%esi),%ebx
+ 772:	83 c6 01             	add    $0x1,%esi
+ 775:	84 db                	test   %bl,%bl
+ 777:	74 67                	je     7e0 <printf+0x80>
+ 779:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 77c:	31 d2                	xor    %edx,%edx
+ 77e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 781:	eb 34                	jmp    7b7 <printf+0x57>
+ 783:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 787:	90                   	nop
+ 788:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 78b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 790:	83 f8 25             	cmp    $0x25,%eax
+ 793:	74 18                	je     7ad <printf+0x4d>
+  write(fd, &c, 1);
+ 795:	83 ec 04             	sub    $0x4,%esp
+ 798:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 79b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 79e:	6a 01                	push   $0x1
+ 7a0:	50                   	push   %eax
+ 7a1:	57                   	push   %edi
+ 7a2:	e8 32 fc ff ff       	call   3d9 <write>
+ 7a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 7b0:	83 c6 01             	add    $0x1,%esi
+ 7b3:	84 db                	test   %bl,%bl
+ 7b5:	74 29                	je     7e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ba:	85 d2                	test   %edx,%edx
+ 7bc:	74 ca                	je     788 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7be:	83 fa 25             	cmp    $0x25,%edx
+ 7c1:	75 ea                	jne    7ad <printf+0x4d>
+      if(c == 'd'){
+ 7c3:	83 f8 25             	cmp    $0x25,%eax
+ 7c6:	0f 84 24 01 00 00    	je     8f0 <printf+0x190>
+ 7cc:	83 e8 63             	sub    $0x63,%eax
+ 7cf:	83 f8 15             	cmp    $0x15,%eax
+ 7d2:	77 1c                	ja     7f0 <printf+0x90>
+ 7d4:	ff 24 85 90 0a 00 00 	jmp    *0xa90(,%eax,4)
+ 7db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7e3:	5b                   	pop    %ebx
+ 7e4:	5e                   	pop    %esi
+ 7e5:	5f                   	pop    %edi
+ 7e6:	5d                   	pop    %ebp
+ 7e7:	c3                   	ret
+ 7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7fa:	6a 01                	push   $0x1
+ 7fc:	52                   	push   %edx
+ 7fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 800:	57                   	push   %edi
+ 801:	e8 d3 fb ff ff       	call   3d9 <write>
+ 806:	83 c4 0c             	add    $0xc,%esp
+ 809:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 80c:	6a 01                	push   $0x1
+ 80e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 811:	52                   	push   %edx
+ 812:	57                   	push   %edi
+ 813:	e8 c1 fb ff ff       	call   3d9 <write>
+        putc(fd, c);
+ 818:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 81b:	31 d2                	xor    %edx,%edx
+ 81d:	eb 8e                	jmp    7ad <printf+0x4d>
+ 81f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 820:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 82b:	8b 13                	mov    (%ebx),%edx
+ 82d:	6a 00                	push   $0x0
+ 82f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 831:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 834:	e8 87 fe ff ff       	call   6c0 <printint>
+        ap++;
+ 839:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 83c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 83f:	31 d2                	xor    %edx,%edx
+ 841:	e9 67 ff ff ff       	jmp    7ad <printf+0x4d>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 850:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 853:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 855:	83 c0 04             	add    $0x4,%eax
+ 858:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 85b:	85 db                	test   %ebx,%ebx
+ 85d:	0f 84 9d 00 00 00    	je     900 <printf+0x1a0>
+        while(*s != 0){
+ 863:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 866:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 868:	84 c0                	test   %al,%al
+ 86a:	0f 84 3d ff ff ff    	je     7ad <printf+0x4d>
+ 870:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 873:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 876:	89 de                	mov    %ebx,%esi
+ 878:	89 d3                	mov    %edx,%ebx
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 886:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 889:	6a 01                	push   $0x1
+ 88b:	53                   	push   %ebx
+ 88c:	57                   	push   %edi
+ 88d:	e8 47 fb ff ff       	call   3d9 <write>
+        while(*s != 0){
+ 892:	0f b6 06             	movzbl (%esi),%eax
+ 895:	83 c4 10             	add    $0x10,%esp
+ 898:	84 c0                	test   %al,%al
+ 89a:	75 e4                	jne    880 <printf+0x120>
+      state = 0;
+ 89c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 89f:	31 d2                	xor    %edx,%edx
+ 8a1:	e9 07 ff ff ff       	jmp    7ad <printf+0x4d>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8bb:	8b 13                	mov    (%ebx),%edx
+ 8bd:	6a 01                	push   $0x1
+ 8bf:	e9 6b ff ff ff       	jmp    82f <printf+0xcf>
+ 8c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8cb:	83 ec 04             	sub    $0x4,%esp
+ 8ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8d9:	6a 01                	push   $0x1
+ 8db:	52                   	push   %edx
+ 8dc:	57                   	push   %edi
+ 8dd:	e8 f7 fa ff ff       	call   3d9 <write>
+        ap++;
+ 8e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8e8:	31 d2                	xor    %edx,%edx
+ 8ea:	e9 be fe ff ff       	jmp    7ad <printf+0x4d>
+ 8ef:	90                   	nop
+  write(fd, &c, 1);
+ 8f0:	83 ec 04             	sub    $0x4,%esp
+ 8f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8f9:	6a 01                	push   $0x1
+ 8fb:	e9 11 ff ff ff       	jmp    811 <printf+0xb1>
+ 900:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 905:	bb 88 0a 00 00       	mov    $0xa88,%ebx
+ 90a:	e9 61 ff ff ff       	jmp    870 <printf+0x110>
+ 90f:	90                   	nop
+
+00000910 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 910:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 911:	a1 fc 0d 00 00       	mov    0xdfc,%eax
+{
+ 916:	89 e5                	mov    %esp,%ebp
+ 918:	57                   	push   %edi
+ 919:	56                   	push   %esi
+ 91a:	53                   	push   %ebx
+ 91b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 91e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 921:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 928:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 92a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 92c:	39 ca                	cmp    %ecx,%edx
+ 92e:	73 30                	jae    960 <free+0x50>
+ 930:	39 c1                	cmp    %eax,%ecx
+ 932:	72 04                	jb     938 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 934:	39 c2                	cmp    %eax,%edx
+ 936:	72 f0                	jb     928 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 938:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 93b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 93e:	39 f8                	cmp    %edi,%eax
+ 940:	74 2e                	je     970 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 942:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 945:	8b 42 04             	mov    0x4(%edx),%eax
+ 948:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 94b:	39 f1                	cmp    %esi,%ecx
+ 94d:	74 38                	je     987 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 94f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 951:	5b                   	pop    %ebx
+  freep = p;
+ 952:	89 15 fc 0d 00 00    	mov    %edx,0xdfc
+}
+ 958:	5e                   	pop    %esi
+ 959:	5f                   	pop    %edi
+ 95a:	5d                   	pop    %ebp
+ 95b:	c3                   	ret
+ 95c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 960:	39 c1                	cmp    %eax,%ecx
+ 962:	72 d0                	jb     934 <free+0x24>
+ 964:	eb c2                	jmp    928 <free+0x18>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 970:	03 70 04             	add    0x4(%eax),%esi
+ 973:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 976:	8b 02                	mov    (%edx),%eax
+ 978:	8b 00                	mov    (%eax),%eax
+ 97a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 97d:	8b 42 04             	mov    0x4(%edx),%eax
+ 980:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 983:	39 f1                	cmp    %esi,%ecx
+ 985:	75 c8                	jne    94f <free+0x3f>
+    p->s.size += bp->s.size;
+ 987:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 98a:	89 15 fc 0d 00 00    	mov    %edx,0xdfc
+    p->s.size += bp->s.size;
+ 990:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 993:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 996:	89 0a                	mov    %ecx,(%edx)
+}
+ 998:	5b                   	pop    %ebx
+ 999:	5e                   	pop    %esi
+ 99a:	5f                   	pop    %edi
+ 99b:	5d                   	pop    %ebp
+ 99c:	c3                   	ret
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9ac:	8b 15 fc 0d 00 00    	mov    0xdfc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9b2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9b5:	c1 ef 03             	shr    $0x3,%edi
+ 9b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9bb:	85 d2                	test   %edx,%edx
+ 9bd:	0f 84 8d 00 00 00    	je     a50 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9c5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9c8:	39 f9                	cmp    %edi,%ecx
+ 9ca:	73 64                	jae    a30 <malloc+0x90>
+  if(nu < 4096)
+ 9cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9d1:	39 df                	cmp    %ebx,%edi
+ 9d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9dd:	eb 0a                	jmp    9e9 <malloc+0x49>
+ 9df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9e2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9e5:	39 f9                	cmp    %edi,%ecx
+ 9e7:	73 47                	jae    a30 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9e9:	89 c2                	mov    %eax,%edx
+ 9eb:	39 05 fc 0d 00 00    	cmp    %eax,0xdfc
+ 9f1:	75 ed                	jne    9e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9f3:	83 ec 0c             	sub    $0xc,%esp
+ 9f6:	56                   	push   %esi
+ 9f7:	e8 15 fb ff ff       	call   511 <sbrk>
+  if(p == (char*)-1)
+ 9fc:	83 c4 10             	add    $0x10,%esp
+ 9ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a02:	74 1c                	je     a20 <malloc+0x80>
+  hp->s.size = nu;
+ a04:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a07:	83 ec 0c             	sub    $0xc,%esp
+ a0a:	83 c0 08             	add    $0x8,%eax
+ a0d:	50                   	push   %eax
+ a0e:	e8 fd fe ff ff       	call   910 <free>
+  return freep;
+ a13:	8b 15 fc 0d 00 00    	mov    0xdfc,%edx
+      if((p = morecore(nunits)) == 0)
+ a19:	83 c4 10             	add    $0x10,%esp
+ a1c:	85 d2                	test   %edx,%edx
+ a1e:	75 c0                	jne    9e0 <malloc+0x40>
+        return 0;
+  }
+}
+ a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a23:	31 c0                	xor    %eax,%eax
+}
+ a25:	5b                   	pop    %ebx
+ a26:	5e                   	pop    %esi
+ a27:	5f                   	pop    %edi
+ a28:	5d                   	pop    %ebp
+ a29:	c3                   	ret
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a30:	39 cf                	cmp    %ecx,%edi
+ a32:	74 4c                	je     a80 <malloc+0xe0>
+        p->s.size -= nunits;
+ a34:	29 f9                	sub    %edi,%ecx
+ a36:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a39:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a3c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a3f:	89 15 fc 0d 00 00    	mov    %edx,0xdfc
+}
+ a45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a48:	83 c0 08             	add    $0x8,%eax
+}
+ a4b:	5b                   	pop    %ebx
+ a4c:	5e                   	pop    %esi
+ a4d:	5f                   	pop    %edi
+ a4e:	5d                   	pop    %ebp
+ a4f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a50:	c7 05 fc 0d 00 00 00 	movl   $0xe00,0xdfc
+ a57:	0e 00 00 
+    base.s.size = 0;
+ a5a:	b8 00 0e 00 00       	mov    $0xe00,%eax
+    base.s.ptr = freep = prevp = &base;
+ a5f:	c7 05 00 0e 00 00 00 	movl   $0xe00,0xe00
+ a66:	0e 00 00 
+    base.s.size = 0;
+ a69:	c7 05 04 0e 00 00 00 	movl   $0x0,0xe04
+ a70:	00 00 00 
+    if(p->s.size >= nunits){
+ a73:	e9 54 ff ff ff       	jmp    9cc <malloc+0x2c>
+ a78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a80:	8b 08                	mov    (%eax),%ecx
+ a82:	89 0a                	mov    %ecx,(%edx)
+ a84:	eb b9                	jmp    a3f <malloc+0x9f>